@@ -19,6 +19,7 @@
 //\\rc rawbuild end
 
 #include "../../vkfast.h"
+#include "../../vkfast_ex.h"
 #include "../../vkfast_ids.h"
 #include "../Common/vkfast_examples_common.h"
 
@@ -85,6 +86,18 @@ int main() {
   gpu_storage_t storage_output_gpu = {0};
   vfStorageCreate(ctx2, &storage_output_info, &storage_output_gpu, FF, LL);
 
+  // NOTE(Constantine): The output storages are of ctx2, ctx imports them and ctx2 hands their ownership over to ctx.
+  gpu_storage_export_t storage_output_cpu_export = {0};
+  gpu_storage_export_t storage_output_gpu_export = {0};
+  vfStorageExport(ctx2, storage_output_cpu.id, &storage_output_cpu_export, FF, LL);
+  vfStorageExport(ctx2, storage_output_gpu.id, &storage_output_gpu_export, FF, LL);
+  gpu_storage_t storage_output_cpu_imported = {0};
+  gpu_storage_t storage_output_gpu_imported = {0};
+  vfStorageImport(ctx, &storage_output_cpu_export, &storage_output_cpu_imported, FF, LL);
+  vfStorageImport(ctx, &storage_output_gpu_export, &storage_output_gpu_imported, FF, LL);
+  vfBatchStorageOwnershipRelease(ctx2, 0, storage_output_cpu.id, FF, LL);
+  vfBatchStorageOwnershipRelease(ctx2, 0, storage_output_gpu.id, FF, LL);
+
   #include "add.cs.h"
   gpu_program_info_t cs_info = {0};
   cs_info.program_binary_bytes_count = sizeof(g_main);
@@ -116,10 +129,12 @@ int main() {
     bindings_info.max_new_bindings_sets_count = 1;
     bindings_info.max_storage_binds_count     = 2;
     batch = vfBatchBegin(ctx, batch, &bindings_info, NULL, FF, LL);
+    vfBatchStorageOwnershipAcquire(ctx, batch, storage_output_cpu_imported.id, FF, LL);
+    vfBatchStorageOwnershipAcquire(ctx, batch, storage_output_gpu_imported.id, FF, LL);
     vfBatchBindProgramPipelineCompute(ctx, batch, pp, FF, LL);
     vfBatchBindNewBindingsSet(ctx, batch, countof(slots), slots, FF, LL);
     vfBatchBindStorageSingle(ctx, batch, 0, storage_input_gpu.id, FF, LL);
-    vfBatchBindStorageSingle(ctx, batch, 1, storage_output_gpu.id, FF, LL);
+    vfBatchBindStorageSingle(ctx, batch, 1, storage_output_gpu_imported.id, FF, LL);
     vfBatchBindNewBindingsEnd(ctx, batch, FF, LL);
     float salt[4] = {0};
     salt[0] = 0;
@@ -129,7 +144,7 @@ int main() {
     vfBatchBindVariablesCopy(ctx, batch, 0, sizeof(salt), salt, FF, LL);
     vfBatchCompute(ctx, batch, 1, 1, 1, FF, LL);
     vfBatchBarrierMemory(ctx, batch, FF, LL);
-    vfBatchStorageCopyFromGpuToCpu(ctx, batch, storage_output_gpu.id, storage_output_cpu.id, FF, LL);
+    vfBatchStorageCopyFromGpuToCpu(ctx, batch, storage_output_gpu_imported.id, storage_output_cpu_imported.id, FF, LL);
     vfBatchBarrierCpuReadback(ctx, batch, FF, LL);
     vfBatchEnd(ctx, batch, FF, LL);
 
@@ -157,6 +172,8 @@ int main() {
     storage_input_cpu.id,
     storage_input_gpu.id,
     copy,
+    storage_output_cpu_imported.id,
+    storage_output_gpu_imported.id,
     storage_output_cpu.id,
     storage_output_gpu.id,
     cs,
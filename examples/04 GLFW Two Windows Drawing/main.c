@@ -20,7 +20,7 @@
 //\\rc rawbuild end
 
 #include "../../vkfast.h"
-#include "../../vkfast_ids.h"
+#include "../../vkfast_ex.h"
 #ifndef VKFAST_EXAMPLE_04_ENABLE_GLFW3_TO_SDL3
 #define VKFAST_EXAMPLES_COMMON_INCLUDE_GLFW3
 #endif
@@ -76,33 +76,16 @@ int main() {
   void * window2_handle = &window2Data;
 #endif
 
-  gpu_handle_context_t ctx1 = vfContextInit(1, NULL, FF, LL);
-  
-  // Donate raw context from ctx to ctx2.
-  vf_handle_context_t vfctx2 = {0};
-  vfctx2.doNotDestroyRawContext = 1; // Since we donate raw context from ctx1.
-  vfctx2.doNotFreeHandle        = 1; // Since we created vfctx2 on the stack.
-  vfctx2.context                = vfContextGetRaw(ctx1, FF, LL);
-  // Custom initialization of ctx2.
-  gpu_internal_memory_allocation_sizes_t ctx2allocsizes = {0};
-  ctx2allocsizes.bytes_count_for_memory_storages_type_gpu_only         = 0;
-  ctx2allocsizes.bytes_count_for_memory_storages_type_cpu_upload       = 0;
-  ctx2allocsizes.bytes_count_for_memory_storages_type_cpu_readback     = 0;
-  ctx2allocsizes.bytes_count_for_memory_present_pixels_type_cpu_upload = VKFAST_DEFAULT_MEMORY_ALLOCATION_SIZE_PRESENT_PIXELS_CPU_UPLOAD_288MB;
-  gpu_context_optional_parameters_t ctx2params = {0};
-  ctx2params.internal_memory_allocation_sizes             = &ctx2allocsizes;
-  ctx2params.optional_pointer_to_custom_vf_handle_context = (void *)&vfctx2;
-  gpu_handle_context_t ctx2 = vfContextInit(0, &ctx2params, FF, LL);
+  gpu_handle_context_t ctx = vfContextInit(1, NULL, FF, LL);
 
   const unsigned array65536[2] = {65536, 65536};
 
-  gpu_thread_t gpu_thread_ctx1 = NULL;
-  gpu_thread_t gpu_thread_ctx2 = NULL;
-  vfGpuThreadCreate(ctx1, 1, &gpu_thread_ctx1, NULL, FF, LL);
-  vfGpuThreadCreate(ctx2, 1, &gpu_thread_ctx2, NULL, FF, LL);
+  gpu_thread_t gpu_thread = NULL;
+  vfGpuThreadCreate(ctx, 1, &gpu_thread, NULL, FF, LL);
 
-  vfWindowFullscreen(ctx1, window1_handle, "[vkFast] GLFW Two Windows Drawing: Window One", 700, 700, 0, RED_PRESENT_VSYNC_MODE_ON, FF, LL);
-  vfWindowFullscreen(ctx2, window2_handle, "[vkFast] GLFW Two Windows Drawing: Window Two", 500, 500, 0, RED_PRESENT_VSYNC_MODE_ON, FF, LL);
+  // Window 0 is the context's own window, window 1 is added to the same context and is drawn in the same submission.
+  vfWindowFullscreen(ctx, window1_handle, "[vkFast] GLFW Two Windows Drawing: Window One", 700, 700, 0, RED_PRESENT_VSYNC_MODE_ON, FF, LL);
+  vfWindowAdd(ctx, window2_handle, "[vkFast] GLFW Two Windows Drawing: Window Two", 500, 500, RED_PRESENT_VSYNC_MODE_ON, 3, 0, FF, LL);
 
   while (glfwWindowShouldClose(window1) == 0 && glfwWindowShouldClose(window2) == 0) {
     #ifdef VKFAST_EXTRA_INCLUDED_GLFW3_TO_SDL3
@@ -113,23 +96,25 @@ int main() {
     #endif
 
     GLFWwindow * windows[2] = {window1, window2};
-    gpu_handle_context_t ctxs[2] = {ctx1, ctx2};
+
+    gpu_window_draw_t draws[2] = {0};
+    unsigned draws_count = 0;
 
     for (int i = 0; i < 2; i += 1) {
       GLFWwindow * window = windows[i];
-      gpu_handle_context_t ctx = ctxs[i];
+      gpu_handle_context_t window_ctx = vfWindowGetContext(ctx, i);
 
       int os_window_w = 0;
       int os_window_h = 0;
       glfwGetWindowSize(window, &os_window_w, &os_window_h);
 
-      if (vfWindowIsMinimized(ctx) || os_window_w == 0 || os_window_h == 0) {
+      if (vfWindowIsMinimized(window_ctx) || os_window_w == 0 || os_window_h == 0) {
         continue;
       }
 
       int window_w = 0;
       int window_h = 0;
-      vfWindowGetSize(ctx, &window_w, &window_h);
+      vfWindowGetSize(window_ctx, &window_w, &window_h);
 
       // To free
       unsigned char * pixels = (unsigned char *)red32MemoryCalloc(4 * window_h * window_w);
@@ -175,22 +160,26 @@ int main() {
         }
       }
 
-      gpu_thread_t gpu_threads[2] = {i == 0 ? gpu_thread_ctx1 : gpu_thread_ctx2, 0};
-      vfDrawPixels(ctx, pixels, NULL, 2, gpu_threads, array65536, FF, LL);
+      draws[draws_count].window_index = i;
+      draws[draws_count].pixels       = pixels;
+      draws_count += 1;
+    }
+
+    // One CPU wait and one submission for both windows.
+    gpu_thread_t gpu_threads[2] = {gpu_thread, 0};
+    vfDrawPixelsWindows(ctx, draws_count, draws, 2, gpu_threads, array65536, FF, LL);
 
-      red32MemoryFree(pixels);
-      pixels = NULL;
+    for (unsigned i = 0; i < draws_count; i += 1) {
+      red32MemoryFree((void *)draws[i].pixels);
+      draws[i].pixels = NULL;
     }
   }
 
-  vfAllQueuesWaitIdle(ctx1, FF, LL);
-  vfAllQueuesWaitIdle(ctx2, FF, LL);
+  vfAllQueuesWaitIdle(ctx, FF, LL);
 
-  vfGpuThreadDestroy(ctx1, gpu_thread_ctx1);
-  vfGpuThreadDestroy(ctx2, gpu_thread_ctx2);
+  vfGpuThreadDestroy(ctx, gpu_thread);
 
-  vfContextDeinit(ctx2, FF, LL);
-  vfContextDeinit(ctx1, FF, LL);
+  vfContextDeinit(ctx, FF, LL);
 
   #ifdef VKFAST_EXTRA_INCLUDED_GLFW3_TO_SDL3
   glfwTerminateWindow(window1);
@@ -19,6 +19,7 @@
 //\\rc rawbuild end
 
 #include "../../vkfast.h"
+#include "../../vkfast_ex.h"
 #include "../../extra/Banzai/vkfast_extra_banzai_pointer.h"
 #include "../Common/vkfast_examples_common.h"
 
@@ -51,11 +52,11 @@ int main() {
   allocate_extra_memory.bytes_count_for_memory_storages_type_cpu_upload       = (64 * 1024 * 1024);
   allocate_extra_memory.bytes_count_for_memory_storages_type_cpu_readback     = (64 * 1024 * 1024);
   allocate_extra_memory.bytes_count_for_memory_present_pixels_type_cpu_upload = 0;
-  gpu_handle_context_t ctx2 = vfeBanzaiAllocateExtraMemory(ctx, &allocate_extra_memory, FF, LL);
-  vfeBanzaiStoragesCreate(ctx2, &storage_gpu_only, &storage_cpu_upload, &storage_cpu_readback, FF, LL);
+  vfContextHeapsAppendBlocks(ctx, &allocate_extra_memory, FF, LL);
+  vfeBanzaiStoragesCreate(ctx, &storage_gpu_only, &storage_cpu_upload, &storage_cpu_readback, FF, LL);
   // NOTE(Constantine):
-  // We don't need to use ctx2 anywhere now since allocations were
-  // derived from the original ctx and the storages are created from ctx2.
+  // The storages heaps of ctx started with 0 bytes, the appended blocks became their current blocks
+  // and the Banzai storages take all of them. Appending more blocks later keeps these storages valid.
 
   gpu_extra_banzai_pointer_t storage_input_cpu = {0};
   gpu_extra_banzai_pointer_t storage_input_gpu = {0};
@@ -170,7 +171,6 @@ int main() {
     batch,
   };
   vfIdDestroy(countof(ids), ids, FF, LL);
-  vfContextDeinit(ctx2, FF, LL); // NOTE(Constantine): Derived from ctx contexts must be deinited first.
   vfContextDeinit(ctx, FF, LL);
 
   #if defined(VKFAST_INCLUDE_TERMUX_PATHS)
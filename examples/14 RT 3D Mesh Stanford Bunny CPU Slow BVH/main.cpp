@@ -31,6 +31,7 @@
 // cd vs2019 && cl /EHsc ../main.cpp ../../../vkfast.c C:/RedGpuSDK/redgpu.c C:/RedGpuSDK/redgpu_2.c C:/RedGpuSDK/redgpu_32.c /arch:AVX2 /openmp /link /stack:64000000
 
 #include "../../vkfast.h"
+#include "../../vkfast_ex.h"
 #define VKFAST_EXAMPLES_COMMON_INCLUDE_GLFW3
 #include "../Common/vkfast_examples_common.h"
 
@@ -456,6 +457,8 @@ int main() {
 
   #define window_w 320 // NOTE(Constantine): Hardcoded.
   #define window_h 180 // NOTE(Constantine): Hardcoded.
+  #define render_w 224 // NOTE(Constantine): 70% of window_w, upscaled to the window on the GPU.
+  #define render_h 126 // NOTE(Constantine): 70% of window_h.
   const float aspect_ratio = 9.f / 16.f; // NOTE(Constantine): Hardcoded.
 
   glfwInit();
@@ -489,7 +492,7 @@ int main() {
   vfGpuThreadCreate(ctx, 1, &gpu_thread, NULL, FF, LL);
 
   struct Pixels {
-    unsigned char pixels[window_h][window_w][4];
+    unsigned char pixels[render_h][render_w][4];
   };
   // To free
   struct Pixels * pix = (struct Pixels *)red32MemoryCalloc(sizeof(struct Pixels));
@@ -734,16 +737,16 @@ int main() {
     bvhvec3 p3 = C - camera_axis_x - up;
 
     #pragma omp parallel for
-    for (int y = 0; y < window_h; y += 1)
+    for (int y = 0; y < render_h; y += 1)
     {
       #pragma omp parallel for
-      for (int x = 0; x < window_w; x += 1)
+      for (int x = 0; x < render_w; x += 1)
       {
         float sum = 0;
         Ray rays[msaaSamplesCount];
         for (int s = 0; s < msaaSamplesCount; s += 1) {
-          float u = (float)(x + 0.5f + msaa_samples_offset_table_x[s]) / (float)(window_w);
-          float v = (float)(y + 0.5f + msaa_samples_offset_table_y[s]) / (float)(window_h);
+          float u = (float)(x + 0.5f + msaa_samples_offset_table_x[s]) / (float)(render_w);
+          float v = (float)(y + 0.5f + msaa_samples_offset_table_y[s]) / (float)(render_h);
           bvhvec3 P = p1 + u * (p2 - p1) + v * (p3 - p1);
           bvhvec3 P_normalized = tinybvh_normalize(P);
           Ray ray(bvhvec3(0, 0, 0), P_normalized);
@@ -766,8 +769,15 @@ int main() {
       }
     }
 
+    gpu_draw_pixels_info_t draw_info = {};
+    draw_info.format        = GPU_PIXELS_FORMAT_BGRA8;
+    draw_info.source_width  = render_w;
+    draw_info.source_height = render_h;
+    draw_info.upscale       = GPU_PIXELS_UPSCALE_EDGE_ADAPTIVE;
+    draw_info.sharpness     = 0.5f;
+
     gpu_thread_t gpu_threads[2] = {gpu_thread, 0};
-    vfDrawPixels(ctx, pix->pixels, NULL, 2, gpu_threads, array65536, FF, LL);
+    vfDrawPixelsEx(ctx, pix->pixels, &draw_info, NULL, 2, gpu_threads, array65536, FF, LL);
 
     mouse_x_prev = mouse_x;
     mouse_y_prev = mouse_y;
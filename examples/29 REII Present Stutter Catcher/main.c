@@ -414,17 +414,15 @@ int main() {
   int   camera_animation_is_enabled = 1;
   int   milliseconds_clearOnWrap = 1;
 
-  #if !defined(VKFAST_EXTRA_INCLUDED_GLFW3_TO_SDL3)
-  // NOTE(Constantine):
-  // https://github.com/glfw/glfw/issues/1308
-  // You also may be interested in the power-efficient C++ version of this FPS limiter:
-  // https://github.com/procedural/vkFast/commit/3dc58b8de91d64122859675c03e507ec1653e3f9
-  int    fps_limiter_enabled    = 0;
-  double fps_limiter_lasttime   = glfwGetTime();
-  float  fps_limiter_target_fps = 60;
-  #endif
+  // NOTE(Constantine): vkFast present pacing sleeps until the latest wake time that still makes the target frame time, instead of spinning after the present.
+  int   fps_limiter_enabled    = 0;
+  float fps_limiter_target_fps = 60;
+  gpu_frame_latency_t frame_latencies[GPU_FRAME_LATENCIES_MAX_COUNT] = {0};
 
   while (glfwWindowShouldClose(window) == 0) {
+    // Input is sampled right after the pacing wake.
+    vfWindowPacingWait(ctx, FF, LL);
+
     #ifdef VKFAST_EXTRA_INCLUDED_GLFW3_TO_SDL3
     glfwPollEvents(1, &window);
     #else
@@ -685,12 +683,26 @@ int main() {
       ImVec2 graph_size = {0, 80};
       igPlotHistogram("Frame times", milliseconds, MILLISECONDS_ARRAY_MAX_CAPTURE_FRAMES_COUNT, 0, NULL, 0, milliseconds_maxTime, graph_size, 4);
 
-      #if !defined(VKFAST_EXTRA_INCLUDED_GLFW3_TO_SDL3)
-      igCheckbox("Enable FPS limiter", (bool *)&fps_limiter_enabled);
+      int fps_limiter_changed = igCheckbox("Enable FPS limiter", (bool *)&fps_limiter_enabled);
       if (igDragFloat("FPS limiter target FPS", &fps_limiter_target_fps, 1, 0, INT_MAX, 0, 1)) {
         if (fps_limiter_target_fps < 15) { fps_limiter_target_fps = 15; }
+        fps_limiter_changed = 1;
+      }
+      if (fps_limiter_changed) {
+        gpu_present_pacing_t pacing = {0};
+        pacing.frame_nanoseconds = fps_limiter_enabled == 1 ? (uint64_t)(1000000000.0 / fps_limiter_target_fps) : 0;
+        vfWindowSetPacing(ctx, &pacing, FF, LL);
+      }
+      {
+        uint64_t latencies_count = vfWindowGetFrameLatencies(ctx, countof(frame_latencies), frame_latencies);
+        if (latencies_count > 0) {
+          const gpu_frame_latency_t * latency = &frame_latencies[latencies_count - 1];
+          igText("Input to present: %.3f ms", latency->input_to_present_nanoseconds / 1000000.0);
+          igText("Acquire to present: %.3f ms", latency->acquire_to_present_nanoseconds / 1000000.0);
+          igText("CPU submit to present: %.3f ms", latency->cpu_submit_to_present_nanoseconds / 1000000.0);
+          igText("Pacing sleep: %.3f ms, wake error: %.3f ms", latency->pacing_sleep_nanoseconds / 1000000.0, latency->pacing_wake_error_nanoseconds / 1000000.0);
+        }
       }
-      #endif
       igText("To disable VSync, press Z key.");
       igText("To enable  VSync, press X key.");
     }
@@ -794,23 +806,6 @@ int main() {
 
     frame += 1;
 
-    #if !defined(VKFAST_EXTRA_INCLUDED_GLFW3_TO_SDL3)
-    if (fps_limiter_enabled == 1) {
-      while (glfwGetTime() < fps_limiter_lasttime + 1.0f / fps_limiter_target_fps) {
-        #if defined(_WIN32)
-        YieldProcessor();
-        #elif defined(__linux__) && !defined(__ANDROID__)
-        __builtin_ia32_pause();
-        #else
-        #error Unsupported OS for now
-        #endif
-      }
-      fps_limiter_lasttime += 1.0f / fps_limiter_target_fps;
-    } else {
-      fps_limiter_lasttime = glfwGetTime();
-    }
-    #endif
-
     #if defined(_WIN32)
     LARGE_INTEGER t_end = {0};
     QueryPerformanceCounter(&t_end);
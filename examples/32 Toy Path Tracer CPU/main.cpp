@@ -17,6 +17,7 @@
 #define GLM_FORCE_SWIZZLE
 
 #include "../../vkfast.h"
+#include "../../vkfast_ex.h"
 #define VKFAST_EXAMPLES_COMMON_INCLUDE_GLFW3
 #define VKFAST_EXAMPLES_COMMON_INCLUDE_GLM
 #include "../Common/vkfast_examples_common.h"
@@ -1154,11 +1155,6 @@ int main() {
   gpu_thread_t gpu_thread = NULL;
   vfGpuThreadCreate(ctx, 1, &gpu_thread, NULL, FF, LL);
 
-  unsigned char pixels[WINDOW_HEIGHT][WINDOW_WIDTH][4] = {
-    255,0,0,255,  255,0,0,255,  255,0,0,255,  255,0,0,255,
-    0,255,0,255,  0,255,0,255,  0,255,0,255,  0,255,0,255,
-    0,0,255,255,  0,0,255,255,  0,0,255,255,  0,0,255,255,
-  };
   float pixelsSamples[WINDOW_HEIGHT][WINDOW_WIDTH][4] = {};
   int sampleCount = 0;
 
@@ -1210,21 +1206,16 @@ int main() {
       }
     }
 
-    #pragma omp parallel for
-    for (int y = 0; y < WINDOW_HEIGHT; y += 1) {
-      #pragma omp parallel for
-      for (int x = 0; x < WINDOW_WIDTH; x += 1) {
-        // NOTE(Constantine): BGRA
-        pixels[y][x][2] = (char)((pixelsSamples[y][x][0] / (float)(sampleCount+1)) * 255.0f);
-        pixels[y][x][1] = (char)((pixelsSamples[y][x][1] / (float)(sampleCount+1)) * 255.0f);
-        pixels[y][x][0] = (char)((pixelsSamples[y][x][2] / (float)(sampleCount+1)) * 255.0f);
-        pixels[y][x][3] = (char)((pixelsSamples[y][x][3] / (float)(sampleCount+1)) * 255.0f);
-       }
-    }
     sampleCount += 1;
 
+    // NOTE(Constantine): The sums of samples are averaged and packed to BGRA8 on the GPU.
+    gpu_draw_pixels_info_t draw_info = {};
+    draw_info.format   = GPU_PIXELS_FORMAT_RGBA32F;
+    draw_info.transfer = GPU_PIXELS_TRANSFER_NONE;
+    draw_info.exposure = 1.0f / (float)sampleCount;
+
     gpu_thread_t gpu_threads[2] = {gpu_thread, 0};
-    vfDrawPixels(ctx, pixels, NULL, 2, gpu_threads, array65536, FF, LL);
+    vfDrawPixelsEx(ctx, pixelsSamples, &draw_info, NULL, 2, gpu_threads, array65536, FF, LL);
 
     glfwSwapBuffers(window);
   }
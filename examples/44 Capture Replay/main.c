@@ -0,0 +1,504 @@
+//\\rc rawbuild begin gcc-linux-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `gcc`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c /home/linuxbrew/RedGpuSDK/redgpu.c /home/linuxbrew/RedGpuSDK/redgpu_2.c /home/linuxbrew/RedGpuSDK/redgpu_32.c -I/home/linuxbrew/.linuxbrew/include/ -I/home/linuxbrew/.linuxbrew/Cellar/xorgproto/2025.1/include/ -I/var/home/linuxbrew/.linuxbrew/Cellar/libxcb/1.17.0/include/ /home/linuxbrew/.linuxbrew/lib/libX11.so /home/linuxbrew/.linuxbrew/lib/libvulkan.so -lm`
+//\\rc rawbuild end
+
+//\\rc rawbuild begin clang-windows-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `clang`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c C:/RedGpuSDK/redgpu.c C:/RedGpuSDK/redgpu_2.c C:/RedGpuSDK/redgpu_32.c`
+//\\rc rawbuild end
+
+//\\rc rawbuild begin mingw-clang-termux-64-bit
+//\\rc rawbuild `x86_64-w64-mingw32-clang -DVKFAST_INCLUDE_TERMUX_PATHS main.c ../../vkfast.c /data/data/com.termux/files/home/RedGpuSDK/redgpu.c /data/data/com.termux/files/home/RedGpuSDK/redgpu_2.c /data/data/com.termux/files/home/RedGpuSDK/redgpu_32.c`
+//\\rc rawbuild end
+
+// NOTE(Constantine):
+// Replays a file written between vfContextCaptureBegin() and vfContextCaptureEnd() as fast as possible on a headless context
+// and prints the time spent in every kind of vkFast call. Usage: a.exe capture.vfcap [per_call_timings.csv]
+// The whole capture is read into memory before replay, so file IO doesn't end up in the timings.
+
+#include "../../vkfast_ex.h"
+#include "../../vkfast_ids.h"
+#include "../Common/vkfast_examples_common.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+static uint64_t GetTimeNanoseconds(void) {
+#if defined(_WIN32)
+  LARGE_INTEGER frequency = {0};
+  LARGE_INTEGER counter   = {0};
+  QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&counter);
+  return (uint64_t)((counter.QuadPart / frequency.QuadPart) * 1000000000ULL + ((counter.QuadPart % frequency.QuadPart) * 1000000000ULL) / frequency.QuadPart);
+#else
+  struct timespec ts = {0};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+// NOTE(Constantine): Captured handle values to replayed handle values, open addressing with linear probing. Key 0 is never a valid handle.
+typedef struct HandleMap {
+  uint64_t   capacity;
+  uint64_t   count;
+  uint64_t * keys;
+  uint64_t * values;
+} HandleMap;
+
+static void HandleMapSet(HandleMap * map, uint64_t key, uint64_t value);
+
+static void HandleMapGrow(HandleMap * map) {
+  HandleMap grown = {0};
+  grown.capacity = map->capacity == 0 ? 1024 : map->capacity * 2;
+  grown.keys     = (uint64_t *)red32MemoryCalloc(sizeof(uint64_t) * grown.capacity);
+  grown.values   = (uint64_t *)red32MemoryCalloc(sizeof(uint64_t) * grown.capacity);
+  REDGPU_2_EXPECTFL(grown.keys != NULL);
+  REDGPU_2_EXPECTFL(grown.values != NULL);
+  for (uint64_t i = 0; i < map->capacity; i += 1) {
+    if (map->keys[i] != 0) {
+      HandleMapSet(&grown, map->keys[i], map->values[i]);
+    }
+  }
+  if (map->keys   != NULL) { red32MemoryFree(map->keys);   }
+  if (map->values != NULL) { red32MemoryFree(map->values); }
+  map[0] = grown;
+}
+
+static void HandleMapSet(HandleMap * map, uint64_t key, uint64_t value) {
+  if ((map->count + 1) * 2 > map->capacity) {
+    HandleMapGrow(map);
+  }
+  uint64_t i = (key * 11400714819323198485ULL) & (map->capacity - 1);
+  while (map->keys[i] != 0 && map->keys[i] != key) {
+    i = (i + 1) & (map->capacity - 1);
+  }
+  if (map->keys[i] == 0) {
+    map->count += 1;
+  }
+  map->keys[i]   = key;
+  map->values[i] = value;
+}
+
+static int HandleMapGet(const HandleMap * map, uint64_t key, uint64_t * outValue) {
+  if (key == 0 || map->capacity == 0) {
+    return 0;
+  }
+  uint64_t i = (key * 11400714819323198485ULL) & (map->capacity - 1);
+  while (map->keys[i] != 0) {
+    if (map->keys[i] == key) {
+      outValue[0] = map->values[i];
+      return 1;
+    }
+    i = (i + 1) & (map->capacity - 1);
+  }
+  return 0;
+}
+
+static void HandleMapFree(HandleMap * map) {
+  if (map->keys   != NULL) { red32MemoryFree(map->keys);   }
+  if (map->values != NULL) { red32MemoryFree(map->values); }
+  HandleMap empty = {0};
+  map[0] = empty;
+}
+
+static const char * gOpNames[GPU_CAPTURE_OP_COUNT] = {
+  "",
+  "vfStorageCreate",
+  "StorageContents",
+  "vfProgramCreateFromBinaryCompute",
+  "vfProgramPipelineCreateCompute",
+  "vfBatchBegin",
+  "vfBatchStorageCopyFromCpuToGpu",
+  "vfBatchStorageCopyFromGpuToCpu",
+  "vfBatchBindProgramPipelineCompute",
+  "vfBatchBindNewBindingsSet",
+  "vfBatchBindStorageSingle*",
+  "vfBatchBindNewBindingsEnd",
+  "vfBatchBindVariablesCopy",
+  "vfBatchCompute",
+  "vfBatchBarrierMemory",
+  "vfBatchBarrierCpuReadback",
+  "vfBatchEnd",
+  "vfGpuThreadCreate",
+  "vfGpuThreadDestroy",
+  "vfAsyncBatchExecuteRaw",
+  "vfAsyncWaitToFinish",
+  "vfIdDestroy",
+  "vfAllQueuesWaitIdle",
+};
+
+typedef struct OpTimings {
+  uint64_t count;
+  uint64_t totalNanoseconds;
+  uint64_t minNanoseconds;
+  uint64_t maxNanoseconds;
+} OpTimings;
+
+int main(int argc, char ** argv) {
+#if defined(_MSC_VER) && defined(_DEBUG)
+  _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
+#endif
+
+  if (argc < 2) {
+    printf("Usage: %s capture.vfcap [per_call_timings.csv]\n", argv[0]);
+    return 1;
+  }
+
+  FILE * fh = fopen(argv[1], "rb");
+  REDGPU_2_EXPECTFL(fh != NULL || !"Can't open the capture file.");
+  fseek(fh, 0, SEEK_END);
+  const uint64_t captureBytesCount = (uint64_t)ftell(fh);
+  fseek(fh, 0, SEEK_SET);
+  // To free
+  unsigned char * capture = (unsigned char *)red32MemoryCalloc(captureBytesCount);
+  REDGPU_2_EXPECTFL(capture != NULL);
+  REDGPU_2_EXPECTFL(fread(capture, 1, captureBytesCount, fh) == captureBytesCount);
+  fclose(fh);
+
+  gpu_capture_file_header_t fileHeader = {0};
+  REDGPU_2_EXPECTFL(captureBytesCount >= sizeof(fileHeader));
+  memcpy(&fileHeader, capture, sizeof(fileHeader));
+  REDGPU_2_EXPECTFL(fileHeader.magic == GPU_CAPTURE_FILE_MAGIC);
+  REDGPU_2_EXPECTFL(fileHeader.version == GPU_CAPTURE_FILE_VERSION);
+
+  FILE * csv = NULL;
+  if (argc >= 3) {
+    csv = fopen(argv[2], "wb");
+    REDGPU_2_EXPECTFL(csv != NULL || !"Can't open the per call timings file.");
+    fprintf(csv, "record,call,line,nanoseconds\n");
+  }
+
+  gpu_handle_context_t ctx = vfContextInit(0, NULL, FF, LL);
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)ctx;
+
+  HandleMap ids             = {0}; // NOTE(Constantine): Storages, programs, program pipelines and batches.
+  HandleMap storagePointers = {0}; // NOTE(Constantine): Captured CPU_UPLOAD storage ids to replayed mapped pointers.
+  HandleMap calls           = {0};
+  HandleMap gpuThreads      = {0};
+  HandleMap asyncs          = {0};
+
+  OpTimings timings[GPU_CAPTURE_OP_COUNT] = {0};
+  uint64_t  recordsCount        = 0;
+  uint64_t  recordsSkippedCount = 0;
+
+  unsigned  array65536[64] = {0};
+  for (int i = 0; i < (int)countof(array65536); i += 1) {
+    array65536[i] = 65536;
+  }
+
+  uint64_t offset = sizeof(fileHeader);
+  const uint64_t replayBegin = GetTimeNanoseconds();
+  while (offset + sizeof(gpu_capture_record_header_t) <= captureBytesCount) {
+    gpu_capture_record_header_t header = {0};
+    memcpy(&header, &capture[offset], sizeof(header));
+    offset += sizeof(header);
+    const unsigned char * wordsBytes = &capture[offset]; // NOTE(Constantine): Not necessarily 8-byte aligned, blobs are written unpadded.
+    offset += sizeof(uint64_t) * header.words_count;
+    const void * blob = &capture[offset];
+    offset += header.blob_bytes_count;
+    REDGPU_2_EXPECTFL(offset <= captureBytesCount);
+    REDGPU_2_EXPECTFL(header.op > 0 && header.op < GPU_CAPTURE_OP_COUNT);
+
+    // To free
+    uint64_t * words = NULL;
+    if (header.words_count > 0) {
+      words = (uint64_t *)red32MemoryCalloc(sizeof(uint64_t) * header.words_count);
+      REDGPU_2_EXPECTFL(words != NULL);
+      memcpy(words, wordsBytes, sizeof(uint64_t) * header.words_count);
+    }
+
+    int      isSkipped = 0;
+    uint64_t a = 0;
+    uint64_t b = 0;
+    uint64_t c = 0;
+
+    const uint64_t callBegin = GetTimeNanoseconds();
+    switch (header.op) {
+      case GPU_CAPTURE_OP_STORAGE_CREATE: {
+        gpu_storage_info_t info = {0};
+        info.storage_type = (gpu_storage_type_t)words[1];
+        info.bytes_count  = words[2];
+        gpu_storage_t storage = {0};
+        vfStorageCreate(ctx, &info, &storage, FF, header.optional_line);
+        HandleMapSet(&ids, words[0], storage.id);
+        HandleMapSet(&storagePointers, words[0], (uint64_t)storage.mapped_void_ptr);
+      } break;
+      case GPU_CAPTURE_OP_STORAGE_CONTENTS: {
+        if (HandleMapGet(&storagePointers, words[0], &a) == 1 && a != 0) {
+          memcpy((void *)a, blob, header.blob_bytes_count);
+        } else {
+          isSkipped = 1;
+        }
+      } break;
+      case GPU_CAPTURE_OP_PROGRAM_CREATE_COMPUTE: {
+        // To free
+        void * binary = red32MemoryCalloc(header.blob_bytes_count);
+        REDGPU_2_EXPECTFL(binary != NULL);
+        memcpy(binary, blob, header.blob_bytes_count); // NOTE(Constantine): SPIR-V needs 4-byte alignment.
+        gpu_program_info_t info = {0};
+        info.program_binary_bytes_count = header.blob_bytes_count;
+        info.program_binary             = binary;
+        HandleMapSet(&ids, words[0], vfProgramCreateFromBinaryCompute(ctx, &info, FF, header.optional_line));
+        red32MemoryFree(binary);
+      } break;
+      case GPU_CAPTURE_OP_PROGRAM_PIPELINE_CREATE_COMPUTE: {
+        if (HandleMapGet(&ids, words[1], &a) == 0) {
+          isSkipped = 1;
+          break;
+        }
+        const unsigned membersCount = (unsigned)words[4];
+        // To free
+        RedStructDeclarationMember * members = (RedStructDeclarationMember *)red32MemoryCalloc(sizeof(RedStructDeclarationMember) * (membersCount + 1));
+        REDGPU_2_EXPECTFL(members != NULL);
+        for (unsigned i = 0; i < membersCount; i += 1) {
+          members[i].slot            = (unsigned)words[5 + 4 * i + 0];
+          members[i].type            = (unsigned)words[5 + 4 * i + 1];
+          members[i].count           = (unsigned)words[5 + 4 * i + 2];
+          members[i].visibleToStages = (unsigned)words[5 + 4 * i + 3];
+        }
+        const unsigned constantsCount = header.words_count > 5 + 4 * membersCount ? (unsigned)words[5 + 4 * membersCount] : 0;
+        // To free
+        gpu_program_specialization_constant_t * constants = (gpu_program_specialization_constant_t *)red32MemoryCalloc(sizeof(gpu_program_specialization_constant_t) * (constantsCount + 1));
+        REDGPU_2_EXPECTFL(constants != NULL);
+        for (unsigned i = 0; i < constantsCount; i += 1) {
+          constants[i].constant_id = (unsigned)words[5 + 4 * membersCount + 1 + 2 * i + 0];
+          constants[i].value       = words[5 + 4 * membersCount + 1 + 2 * i + 1];
+        }
+        gpu_program_pipeline_compute_info_t info = {0};
+        info.compute_program                = a;
+        info.variables_slot                 = (unsigned)words[2];
+        info.variables_bytes_count          = (unsigned)words[3];
+        info.struct_members_count           = membersCount;
+        info.struct_members                 = members;
+        info.specialization_constants_count = constantsCount;
+        info.specialization_constants       = constants;
+        HandleMapSet(&ids, words[0], vfProgramPipelineCreateCompute(ctx, &info, FF, header.optional_line));
+        red32MemoryFree(constants);
+        red32MemoryFree(members);
+      } break;
+      case GPU_CAPTURE_OP_BATCH_BEGIN: {
+        if (words[1] != 0 && HandleMapGet(&ids, words[1], &a) == 0) {
+          isSkipped = 1;
+          break;
+        }
+        gpu_batch_info_t info = {0};
+        info.max_new_bindings_sets_count = (int)words[5];
+        info.max_storage_binds_count     = (int)words[6];
+        info.max_texture_rw_binds_count  = (int)words[7];
+        info.max_texture_ro_binds_count  = (int)words[8];
+        info.max_sampler_binds_count     = (int)words[9];
+        info.use_bindings_sets_cache     = header.words_count > 10 ? (int)words[10] : 0;
+        const uint64_t batch = vfBatchBeginEx(ctx, a, words[4] == 1 ? &info : NULL, (unsigned)words[2], NULL, FF, header.optional_line);
+        HandleMapSet(&ids, words[0], batch);
+        HandleMapSet(&calls, words[3], (uint64_t)(void *)vfBatchGetRawHandle(ctx, batch, FF, header.optional_line));
+      } break;
+      case GPU_CAPTURE_OP_BATCH_COPY_FROM_CPU_TO_GPU:
+      case GPU_CAPTURE_OP_BATCH_COPY_FROM_GPU_TO_CPU: {
+        if (HandleMapGet(&ids, words[0], &a) == 0 || HandleMapGet(&ids, words[1], &b) == 0 || HandleMapGet(&ids, words[2], &c) == 0) {
+          isSkipped = 1;
+          break;
+        }
+        if (header.op == GPU_CAPTURE_OP_BATCH_COPY_FROM_CPU_TO_GPU) {
+          vfBatchStorageCopyFromCpuToGpu(ctx, a, b, c, FF, header.optional_line);
+        } else {
+          vfBatchStorageCopyFromGpuToCpu(ctx, a, b, c, FF, header.optional_line);
+        }
+      } break;
+      case GPU_CAPTURE_OP_BATCH_BIND_PROGRAM_PIPELINE: {
+        if (HandleMapGet(&ids, words[0], &a) == 0 || HandleMapGet(&ids, words[1], &b) == 0) {
+          isSkipped = 1;
+          break;
+        }
+        vfBatchBindProgramPipelineCompute(ctx, a, b, FF, header.optional_line);
+      } break;
+      case GPU_CAPTURE_OP_BATCH_BIND_NEW_BINDINGS_SET: {
+        if (HandleMapGet(&ids, words[0], &a) == 0) {
+          isSkipped = 1;
+          break;
+        }
+        const int slotsCount = (int)words[1];
+        // To free
+        RedStructDeclarationMember * slots = (RedStructDeclarationMember *)red32MemoryCalloc(sizeof(RedStructDeclarationMember) * (slotsCount + 1));
+        REDGPU_2_EXPECTFL(slots != NULL);
+        for (int i = 0; i < slotsCount; i += 1) {
+          slots[i].slot            = (unsigned)words[2 + 4 * i + 0];
+          slots[i].type            = (unsigned)words[2 + 4 * i + 1];
+          slots[i].count           = (unsigned)words[2 + 4 * i + 2];
+          slots[i].visibleToStages = (unsigned)words[2 + 4 * i + 3];
+        }
+        vfBatchBindNewBindingsSet(ctx, a, slotsCount, slots, FF, header.optional_line);
+        red32MemoryFree(slots);
+      } break;
+      case GPU_CAPTURE_OP_BATCH_BIND_STORAGE: {
+        if (HandleMapGet(&ids, words[0], &a) == 0 || HandleMapGet(&ids, words[2], &b) == 0) {
+          isSkipped = 1;
+          break;
+        }
+        if (words[5] == 0) {
+          vfBatchBindStorageSingle(ctx, a, (int)words[1], b, FF, header.optional_line);
+        } else if (words[5] == 1) {
+          vfBatchBindStorageSingleLimited(ctx, a, (int)words[1], b, words[3], words[4], FF, header.optional_line);
+        } else {
+          vfBatchBindStorageSingleCapped(ctx, a, (int)words[1], b, words[3], words[4], FF, header.optional_line);
+        }
+      } break;
+      case GPU_CAPTURE_OP_BATCH_BIND_NEW_BINDINGS_END:
+      case GPU_CAPTURE_OP_BATCH_BARRIER_MEMORY:
+      case GPU_CAPTURE_OP_BATCH_BARRIER_CPU_READBACK:
+      case GPU_CAPTURE_OP_BATCH_END: {
+        if (HandleMapGet(&ids, words[0], &a) == 0) {
+          isSkipped = 1;
+          break;
+        }
+        if (header.op == GPU_CAPTURE_OP_BATCH_BIND_NEW_BINDINGS_END) {
+          vfBatchBindNewBindingsEnd(ctx, a, FF, header.optional_line);
+        } else if (header.op == GPU_CAPTURE_OP_BATCH_BARRIER_MEMORY) {
+          vfBatchBarrierMemory(ctx, a, FF, header.optional_line);
+        } else if (header.op == GPU_CAPTURE_OP_BATCH_BARRIER_CPU_READBACK) {
+          vfBatchBarrierCpuReadback(ctx, a, FF, header.optional_line);
+        } else {
+          vfBatchEnd(ctx, a, FF, header.optional_line);
+        }
+      } break;
+      case GPU_CAPTURE_OP_BATCH_BIND_VARIABLES_COPY: {
+        if (HandleMapGet(&ids, words[0], &a) == 0) {
+          isSkipped = 1;
+          break;
+        }
+        vfBatchBindVariablesCopy(ctx, a, (unsigned)words[1], (unsigned)header.blob_bytes_count, blob, FF, header.optional_line);
+      } break;
+      case GPU_CAPTURE_OP_BATCH_COMPUTE: {
+        if (HandleMapGet(&ids, words[0], &a) == 0) {
+          isSkipped = 1;
+          break;
+        }
+        vfBatchCompute(ctx, a, (unsigned)words[1], (unsigned)words[2], (unsigned)words[3], FF, header.optional_line);
+      } break;
+      case GPU_CAPTURE_OP_GPU_THREAD_CREATE: {
+        const unsigned threadsCount = (unsigned)words[0];
+        // To free
+        gpu_thread_t * threads = (gpu_thread_t *)red32MemoryCalloc(sizeof(gpu_thread_t) * (threadsCount + 1));
+        REDGPU_2_EXPECTFL(threads != NULL);
+        vfGpuThreadCreate(ctx, threadsCount, threads, NULL, FF, header.optional_line);
+        for (unsigned i = 0; i < threadsCount; i += 1) {
+          HandleMapSet(&gpuThreads, words[1 + i], (uint64_t)(void *)threads[i]);
+        }
+        red32MemoryFree(threads);
+      } break;
+      case GPU_CAPTURE_OP_GPU_THREAD_DESTROY: {
+        if (HandleMapGet(&gpuThreads, words[0], &a) == 0 || a == 0) {
+          isSkipped = 1;
+          break;
+        }
+        vfGpuThreadDestroy(ctx, (gpu_thread_t)(void *)a);
+        HandleMapSet(&gpuThreads, words[0], 0);
+      } break;
+      case GPU_CAPTURE_OP_ASYNC_BATCH_EXECUTE: {
+        const unsigned queueIndex   = (unsigned)words[1];
+        const uint64_t callsCount   = words[2];
+        const unsigned threadsCount = (unsigned)words[3];
+        REDGPU_2_EXPECTFL(threadsCount <= countof(array65536));
+        // To free
+        RedHandleCalls * submitCalls   = (RedHandleCalls *)red32MemoryCalloc(sizeof(RedHandleCalls) * (callsCount + 1));
+        gpu_thread_t *   submitThreads = (gpu_thread_t *)red32MemoryCalloc(sizeof(gpu_thread_t) * (threadsCount + 1));
+        REDGPU_2_EXPECTFL(submitCalls != NULL);
+        REDGPU_2_EXPECTFL(submitThreads != NULL);
+        for (uint64_t i = 0; i < callsCount && isSkipped == 0; i += 1) {
+          isSkipped = HandleMapGet(&calls, words[4 + i], &a) == 0 ? 1 : 0;
+          submitCalls[i] = (RedHandleCalls)(void *)a;
+        }
+        for (unsigned i = 0; i < threadsCount && isSkipped == 0; i += 1) {
+          isSkipped = HandleMapGet(&gpuThreads, words[4 + callsCount + i], &a) == 0 ? 1 : 0;
+          submitThreads[i] = (gpu_thread_t)(void *)a;
+        }
+        if (isSkipped == 0) {
+          REDGPU_2_EXPECTFL(queueIndex < vkfast->gpuInfo->queuesCount);
+          const uint64_t async = vfAsyncBatchExecuteRawEx(ctx, vkfast->gpuInfo->queues[queueIndex], callsCount, submitCalls, threadsCount, submitThreads, array65536, FF, header.optional_line);
+          HandleMapSet(&asyncs, words[0], async);
+        }
+        red32MemoryFree(submitCalls);
+        red32MemoryFree(submitThreads);
+      } break;
+      case GPU_CAPTURE_OP_ASYNC_WAIT_TO_FINISH: {
+        if (HandleMapGet(&asyncs, words[0], &a) == 0 || a == 0) {
+          isSkipped = 1;
+          break;
+        }
+        vfAsyncWaitToFinish(ctx, a, FF, header.optional_line);
+        HandleMapSet(&asyncs, words[0], 0);
+      } break;
+      case GPU_CAPTURE_OP_ID_DESTROY: {
+        if (HandleMapGet(&ids, words[0], &a) == 0 || a == 0) {
+          isSkipped = 1;
+          break;
+        }
+        vfIdDestroy(1, &a, FF, header.optional_line);
+        HandleMapSet(&ids, words[0], 0);
+        HandleMapSet(&storagePointers, words[0], 0);
+      } break;
+      case GPU_CAPTURE_OP_ALL_QUEUES_WAIT_IDLE: {
+        vfAllQueuesWaitIdle(ctx, FF, header.optional_line);
+      } break;
+      default: {
+        isSkipped = 1;
+      } break;
+    }
+    const uint64_t callNanoseconds = GetTimeNanoseconds() - callBegin;
+
+    if (words != NULL) {
+      red32MemoryFree(words);
+    }
+
+    if (isSkipped == 1) {
+      // NOTE(Constantine): A handle created before vfContextCaptureBegin() or by a call that isn't captured.
+      recordsSkippedCount += 1;
+      continue;
+    }
+
+    OpTimings * t = &timings[header.op];
+    if (t->count == 0 || callNanoseconds < t->minNanoseconds) { t->minNanoseconds = callNanoseconds; }
+    if (t->count == 0 || callNanoseconds > t->maxNanoseconds) { t->maxNanoseconds = callNanoseconds; }
+    t->count            += 1;
+    t->totalNanoseconds += callNanoseconds;
+    if (csv != NULL) {
+      fprintf(csv, "%llu,%s,%d,%llu\n", (unsigned long long)recordsCount, gOpNames[header.op], header.optional_line, (unsigned long long)callNanoseconds);
+    }
+    recordsCount += 1;
+  }
+  vfAllQueuesWaitIdle(ctx, FF, LL);
+  const uint64_t replayNanoseconds = GetTimeNanoseconds() - replayBegin;
+
+  printf("[vkFast Capture Replay] %llu calls replayed, %llu skipped, %.3f ms total\n", (unsigned long long)recordsCount, (unsigned long long)recordsSkippedCount, replayNanoseconds / 1000000.0);
+  printf("%-36s %10s %14s %12s %12s %12s\n", "call", "count", "total ms", "avg us", "min us", "max us");
+  for (int op = 1; op < GPU_CAPTURE_OP_COUNT; op += 1) {
+    const OpTimings * t = &timings[op];
+    if (t->count == 0) {
+      continue;
+    }
+    printf("%-36s %10llu %14.3f %12.3f %12.3f %12.3f\n", gOpNames[op], (unsigned long long)t->count, t->totalNanoseconds / 1000000.0, (t->totalNanoseconds / (double)t->count) / 1000.0, t->minNanoseconds / 1000.0, t->maxNanoseconds / 1000.0);
+  }
+
+  if (csv != NULL) {
+    fclose(csv);
+  }
+
+  // NOTE(Constantine): Handles the capture didn't destroy are destroyed with the context.
+  HandleMapFree(&ids);
+  HandleMapFree(&storagePointers);
+  HandleMapFree(&calls);
+  HandleMapFree(&gpuThreads);
+  HandleMapFree(&asyncs);
+  red32MemoryFree(capture);
+  vfContextDeinit(ctx, FF, LL);
+  vfExit(0);
+}
@@ -0,0 +1,414 @@
+//\\rc rawbuild begin gcc-linux-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `gcc`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c /home/linuxbrew/RedGpuSDK/redgpu.c /home/linuxbrew/RedGpuSDK/redgpu_2.c /home/linuxbrew/RedGpuSDK/redgpu_32.c -I/home/linuxbrew/.linuxbrew/include/ -I/home/linuxbrew/.linuxbrew/Cellar/xorgproto/2025.1/include/ -I/var/home/linuxbrew/.linuxbrew/Cellar/libxcb/1.17.0/include/ /home/linuxbrew/.linuxbrew/lib/libX11.so /home/linuxbrew/.linuxbrew/lib/libvulkan.so -lm`
+//\\rc rawbuild end
+
+//\\rc rawbuild begin clang-windows-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `clang`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c C:/RedGpuSDK/redgpu.c C:/RedGpuSDK/redgpu_2.c C:/RedGpuSDK/redgpu_32.c`
+//\\rc rawbuild end
+
+//\\rc rawbuild begin mingw-clang-termux-64-bit
+//\\rc rawbuild `x86_64-w64-mingw32-clang -DVKFAST_INCLUDE_TERMUX_PATHS main.c ../../vkfast.c /data/data/com.termux/files/home/RedGpuSDK/redgpu.c /data/data/com.termux/files/home/RedGpuSDK/redgpu_2.c /data/data/com.termux/files/home/RedGpuSDK/redgpu_32.c`
+//\\rc rawbuild end
+
+// NOTE(Constantine):
+// Microbenchmarks of the core vkFast paths, results are printed to stdout as one JSON object.
+// Usage: a.exe [gpu_index] [present]
+// Pick the gpu_index of a software Vulkan driver (lavapipe, SwiftShader) to run on machines without a GPU.
+// vfDrawPixels benchmarks need a window and run only if the second argument is "present" and the main monitor fits the resolution.
+// The headless resize storm rebuilds the present of a context without a window for a fake surface size that changes every sample.
+
+#include "../../vkfast.h"
+#include "../../vkfast_ex.h"
+#include "../Common/vkfast_examples_common.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+static uint64_t GetTimeNanoseconds(void) {
+#if defined(_WIN32)
+  LARGE_INTEGER frequency = {0};
+  LARGE_INTEGER counter   = {0};
+  QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&counter);
+  return (uint64_t)((counter.QuadPart / frequency.QuadPart) * 1000000000ULL + ((counter.QuadPart % frequency.QuadPart) * 1000000000ULL) / frequency.QuadPart);
+#else
+  struct timespec ts = {0};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static int CompareUint64(const void * a, const void * b) {
+  const uint64_t x = *(const uint64_t *)a;
+  const uint64_t y = *(const uint64_t *)b;
+  return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+static int gJsonIsFirstResult = 1;
+
+// NOTE(Constantine): Sorts samples in place.
+static void JsonPrintResult(const char * name, const char * unit, uint64_t samplesCount, uint64_t * samples, double bytesPerSample) {
+  qsort(samples, samplesCount, sizeof(uint64_t), CompareUint64);
+  uint64_t total = 0;
+  for (uint64_t i = 0; i < samplesCount; i += 1) {
+    total += samples[i];
+  }
+  const double avg = total / (double)samplesCount;
+  printf("%s\n    {\"name\": \"%s\", \"unit\": \"%s\", \"samples\": %llu, \"min\": %.1f, \"avg\": %.1f, \"p50\": %.1f, \"p99\": %.1f, \"max\": %.1f",
+    gJsonIsFirstResult == 1 ? "" : ",",
+    name,
+    unit,
+    (unsigned long long)samplesCount,
+    (double)samples[0],
+    avg,
+    (double)samples[samplesCount / 2],
+    (double)samples[(samplesCount * 99) / 100],
+    (double)samples[samplesCount - 1]
+  );
+  if (bytesPerSample > 0) {
+    printf(", \"bytes\": %.0f, \"avg_gb_per_second\": %.3f", bytesPerSample, bytesPerSample / avg);
+  }
+  printf("}");
+  gJsonIsFirstResult = 0;
+}
+
+#define SAMPLES_COUNT 1000
+
+static uint64_t gSamples[SAMPLES_COUNT];
+
+static void BenchStorageCreateChurn(gpu_handle_context_t ctx) {
+  const gpu_storage_type_t types[3]     = {GPU_STORAGE_TYPE_GPU_ONLY, GPU_STORAGE_TYPE_CPU_UPLOAD, GPU_STORAGE_TYPE_CPU_READBACK};
+  const char *             typeNames[3] = {"storage_create_gpu_only", "storage_create_cpu_upload", "storage_create_cpu_readback"};
+  for (int t = 0; t < 3; t += 1) {
+    uint64_t ids[SAMPLES_COUNT] = {0};
+    for (int i = 0; i < SAMPLES_COUNT; i += 1) {
+      gpu_storage_info_t info = {0};
+      info.storage_type = types[t];
+      info.bytes_count  = 256;
+      gpu_storage_t storage = {0};
+      const uint64_t begin = GetTimeNanoseconds();
+      vfStorageCreate(ctx, &info, &storage, FF, LL);
+      gSamples[i] = GetTimeNanoseconds() - begin;
+      ids[i] = storage.id;
+    }
+    JsonPrintResult(typeNames[t], "ns", SAMPLES_COUNT, gSamples, 0);
+    vfIdDestroy(SAMPLES_COUNT, ids, FF, LL);
+    vfContextResetAndInvalidateAllStorages(ctx, FF, LL);
+  }
+}
+
+static void BenchBatchRecord(gpu_handle_context_t ctx) {
+  gpu_storage_info_t info = {0};
+  info.storage_type = GPU_STORAGE_TYPE_GPU_ONLY;
+  info.bytes_count  = 2 * 4*sizeof(float);
+  gpu_storage_t storage0 = {0};
+  gpu_storage_t storage1 = {0};
+  vfStorageCreate(ctx, &info, &storage0, FF, LL);
+  vfStorageCreate(ctx, &info, &storage1, FF, LL);
+
+  #include "add.cs.h"
+  gpu_program_info_t cs_info = {0};
+  cs_info.program_binary_bytes_count = sizeof(g_main);
+  cs_info.program_binary             = g_main;
+  uint64_t cs = vfProgramCreateFromBinaryCompute(ctx, &cs_info, FF, LL);
+
+  RedStructDeclarationMember slots[2] = {0};
+  slots[0].slot            = 0;
+  slots[0].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+  slots[0].count           = 1;
+  slots[0].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+  slots[1].slot            = 1;
+  slots[1].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+  slots[1].count           = 1;
+  slots[1].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+  gpu_program_pipeline_compute_info_t pp_info = {0};
+  pp_info.compute_program       = cs;
+  pp_info.variables_slot        = 2;
+  pp_info.variables_bytes_count = 1 * 4*sizeof(float);
+  pp_info.struct_members_count  = countof(slots);
+  pp_info.struct_members        = slots;
+  uint64_t pp = vfProgramPipelineCreateCompute(ctx, &pp_info, FF, LL);
+
+  gpu_batch_info_t bindings_info = {0};
+  bindings_info.max_new_bindings_sets_count = SAMPLES_COUNT;
+  bindings_info.max_storage_binds_count     = 2 * SAMPLES_COUNT;
+
+  uint64_t batch = 0;
+
+  uint64_t samplesBegin[SAMPLES_COUNT]           = {0};
+  uint64_t samplesBindPipeline[SAMPLES_COUNT]    = {0};
+  uint64_t samplesBindSet[SAMPLES_COUNT]         = {0};
+  uint64_t samplesBindStorage[SAMPLES_COUNT]     = {0};
+  uint64_t samplesBindEnd[SAMPLES_COUNT]         = {0};
+  uint64_t samplesVariablesCopy[SAMPLES_COUNT]   = {0};
+  uint64_t samplesCompute[SAMPLES_COUNT]         = {0};
+  uint64_t samplesBarrier[SAMPLES_COUNT]         = {0};
+  uint64_t samplesEnd[SAMPLES_COUNT]             = {0};
+
+  // NOTE(Constantine): One batch per sample for Begin and End, every other call is recorded SAMPLES_COUNT times into one batch.
+  for (int i = 0; i < SAMPLES_COUNT; i += 1) {
+    uint64_t begin = GetTimeNanoseconds();
+    batch = vfBatchBegin(ctx, batch, &bindings_info, NULL, FF, LL);
+    samplesBegin[i] = GetTimeNanoseconds() - begin;
+    begin = GetTimeNanoseconds();
+    vfBatchEnd(ctx, batch, FF, LL);
+    samplesEnd[i] = GetTimeNanoseconds() - begin;
+  }
+
+  const float salt[4] = {0};
+  batch = vfBatchBegin(ctx, batch, &bindings_info, NULL, FF, LL);
+  for (int i = 0; i < SAMPLES_COUNT; i += 1) {
+    uint64_t begin = GetTimeNanoseconds();
+    vfBatchBindProgramPipelineCompute(ctx, batch, pp, FF, LL);
+    samplesBindPipeline[i] = GetTimeNanoseconds() - begin;
+    begin = GetTimeNanoseconds();
+    vfBatchBindNewBindingsSet(ctx, batch, countof(slots), slots, FF, LL);
+    samplesBindSet[i] = GetTimeNanoseconds() - begin;
+    begin = GetTimeNanoseconds();
+    vfBatchBindStorageSingle(ctx, batch, 0, storage0.id, FF, LL);
+    samplesBindStorage[i] = GetTimeNanoseconds() - begin;
+    vfBatchBindStorageSingle(ctx, batch, 1, storage1.id, FF, LL);
+    begin = GetTimeNanoseconds();
+    vfBatchBindNewBindingsEnd(ctx, batch, FF, LL);
+    samplesBindEnd[i] = GetTimeNanoseconds() - begin;
+    begin = GetTimeNanoseconds();
+    vfBatchBindVariablesCopy(ctx, batch, 0, sizeof(salt), salt, FF, LL);
+    samplesVariablesCopy[i] = GetTimeNanoseconds() - begin;
+    begin = GetTimeNanoseconds();
+    vfBatchCompute(ctx, batch, 1, 1, 1, FF, LL);
+    samplesCompute[i] = GetTimeNanoseconds() - begin;
+    begin = GetTimeNanoseconds();
+    vfBatchBarrierMemory(ctx, batch, FF, LL);
+    samplesBarrier[i] = GetTimeNanoseconds() - begin;
+  }
+  vfBatchEnd(ctx, batch, FF, LL);
+
+  JsonPrintResult("batch_begin",                          "ns", SAMPLES_COUNT, samplesBegin,         0);
+  JsonPrintResult("batch_end",                            "ns", SAMPLES_COUNT, samplesEnd,           0);
+  JsonPrintResult("batch_bind_program_pipeline_compute",  "ns", SAMPLES_COUNT, samplesBindPipeline,  0);
+  JsonPrintResult("batch_bind_new_bindings_set",          "ns", SAMPLES_COUNT, samplesBindSet,       0);
+  JsonPrintResult("batch_bind_storage_single",            "ns", SAMPLES_COUNT, samplesBindStorage,   0);
+  JsonPrintResult("batch_bind_new_bindings_end",          "ns", SAMPLES_COUNT, samplesBindEnd,       0);
+  JsonPrintResult("batch_bind_variables_copy",            "ns", SAMPLES_COUNT, samplesVariablesCopy, 0);
+  JsonPrintResult("batch_compute",                        "ns", SAMPLES_COUNT, samplesCompute,       0);
+  JsonPrintResult("batch_barrier_memory",                 "ns", SAMPLES_COUNT, samplesBarrier,       0);
+
+  uint64_t ids[] = {storage0.id, storage1.id, cs, pp, batch};
+  vfIdDestroy(countof(ids), ids, FF, LL);
+  vfContextResetAndInvalidateAllStorages(ctx, FF, LL);
+}
+
+static void BenchSubmitWaitLatency(gpu_handle_context_t ctx, gpu_thread_t gpu_thread, const unsigned * array65536) {
+  uint64_t batch = vfBatchBegin(ctx, 0, NULL, NULL, FF, LL);
+  vfBatchEnd(ctx, batch, FF, LL);
+  RedHandleCalls batchRaw = vfBatchGetRawHandle(ctx, batch, FF, LL);
+
+  for (int i = 0; i < SAMPLES_COUNT; i += 1) {
+    const uint64_t begin = GetTimeNanoseconds();
+    uint64_t async = vfAsyncBatchExecuteRaw(ctx, 1, &batchRaw, 1, &gpu_thread, array65536, FF, LL);
+    vfAsyncWaitToFinish(ctx, async, FF, LL);
+    gSamples[i] = GetTimeNanoseconds() - begin;
+  }
+  JsonPrintResult("submit_wait_empty_batch", "ns", SAMPLES_COUNT, gSamples, 0);
+
+  vfIdDestroy(1, &batch, FF, LL);
+}
+
+static void BenchCopyBandwidth(gpu_handle_context_t ctx, gpu_thread_t gpu_thread, const unsigned * array65536) {
+  const uint64_t sizes[6] = {4 * 1024, 64 * 1024, 1024 * 1024, 4 * 1024 * 1024, 16 * 1024 * 1024, 64 * 1024 * 1024};
+  for (int s = 0; s < (int)countof(sizes); s += 1) {
+    gpu_storage_info_t info = {0};
+    info.bytes_count  = sizes[s];
+    info.storage_type = GPU_STORAGE_TYPE_CPU_UPLOAD;
+    gpu_storage_t upload = {0};
+    vfStorageCreate(ctx, &info, &upload, FF, LL);
+    info.storage_type = GPU_STORAGE_TYPE_GPU_ONLY;
+    gpu_storage_t vram = {0};
+    vfStorageCreate(ctx, &info, &vram, FF, LL);
+    info.storage_type = GPU_STORAGE_TYPE_CPU_READBACK;
+    gpu_storage_t readback = {0};
+    vfStorageCreate(ctx, &info, &readback, FF, LL);
+
+    uint64_t toGpu = vfBatchBegin(ctx, 0, NULL, NULL, FF, LL);
+    vfBatchStorageCopyFromCpuToGpu(ctx, toGpu, upload.id, vram.id, FF, LL);
+    vfBatchEnd(ctx, toGpu, FF, LL);
+    RedHandleCalls toGpuRaw = vfBatchGetRawHandle(ctx, toGpu, FF, LL);
+
+    uint64_t toCpu = vfBatchBegin(ctx, 0, NULL, NULL, FF, LL);
+    vfBatchStorageCopyFromGpuToCpu(ctx, toCpu, vram.id, readback.id, FF, LL);
+    vfBatchBarrierCpuReadback(ctx, toCpu, FF, LL);
+    vfBatchEnd(ctx, toCpu, FF, LL);
+    RedHandleCalls toCpuRaw = vfBatchGetRawHandle(ctx, toCpu, FF, LL);
+
+    // NOTE(Constantine): Submit and wait time included, small sizes measure latency more than bandwidth.
+    const int samplesCount = 50;
+    for (int i = 0; i < samplesCount; i += 1) {
+      const uint64_t begin = GetTimeNanoseconds();
+      uint64_t async = vfAsyncBatchExecuteRaw(ctx, 1, &toGpuRaw, 1, &gpu_thread, array65536, FF, LL);
+      vfAsyncWaitToFinish(ctx, async, FF, LL);
+      gSamples[i] = GetTimeNanoseconds() - begin;
+    }
+    char name[64] = {0};
+    snprintf(name, sizeof(name), "copy_cpu_to_gpu_%llu_bytes", (unsigned long long)sizes[s]);
+    JsonPrintResult(name, "ns", samplesCount, gSamples, (double)sizes[s]);
+
+    for (int i = 0; i < samplesCount; i += 1) {
+      const uint64_t begin = GetTimeNanoseconds();
+      uint64_t async = vfAsyncBatchExecuteRaw(ctx, 1, &toCpuRaw, 1, &gpu_thread, array65536, FF, LL);
+      vfAsyncWaitToFinish(ctx, async, FF, LL);
+      gSamples[i] = GetTimeNanoseconds() - begin;
+    }
+    snprintf(name, sizeof(name), "copy_gpu_to_cpu_%llu_bytes", (unsigned long long)sizes[s]);
+    JsonPrintResult(name, "ns", samplesCount, gSamples, (double)sizes[s]);
+
+    uint64_t ids[] = {upload.id, vram.id, readback.id, toGpu, toCpu};
+    vfIdDestroy(countof(ids), ids, FF, LL);
+    vfContextResetAndInvalidateAllStorages(ctx, FF, LL);
+  }
+}
+
+static void BenchDrawPixels(unsigned gpuIndex, int width, int height, const char * name) {
+  int monitorArea[4] = {0};
+  vfGetMainMonitorAreaRectangle(monitorArea, FF, LL);
+  if (monitorArea[2] < width || monitorArea[3] < height) {
+    return;
+  }
+
+  gpu_handle_context_t ctx = vfContextInitEx(0, gpuIndex, NULL, FF, LL);
+  vfWindowFullscreen(ctx, NULL, "[vkFast] Microbenchmarks", width, height, 0, RED_PRESENT_VSYNC_MODE_OFF, FF, LL);
+
+  const unsigned array65536[1] = {65536};
+
+  // To free
+  unsigned char * pixels = (unsigned char *)red32MemoryCalloc((uint64_t)width * height * 4);
+  REDGPU_2_EXPECTFL(pixels != NULL);
+
+  const int samplesCount = 200;
+  int i = 0;
+  while (vfWindowLoop(ctx) && i < samplesCount) {
+    pixels[(i % height) * width * 4] = (unsigned char)i; // NOTE(Constantine): Something changes every frame.
+    gpu_thread_t gpu_threads[1] = {0};
+    const uint64_t begin = GetTimeNanoseconds();
+    vfDrawPixels(ctx, pixels, NULL, 1, gpu_threads, array65536, FF, LL);
+    gSamples[i] = GetTimeNanoseconds() - begin;
+    i += 1;
+  }
+  if (i > 0) {
+    JsonPrintResult(name, "ns", i, gSamples, (double)width * height * 4);
+  }
+
+  vfAllQueuesWaitIdle(ctx, FF, LL);
+  red32MemoryFree(pixels);
+  vfContextDeinit(ctx, FF, LL);
+}
+
+static void BenchResizeStormHeadless(unsigned gpuIndex) {
+  gpu_internal_memory_allocation_sizes_t allocationSizes = {0};
+  allocationSizes.bytes_count_for_memory_present_pixels_type_cpu_upload = 4 * 320 * 180;
+  gpu_context_optional_parameters_t parameters = {0};
+  parameters.internal_memory_allocation_sizes = &allocationSizes;
+  gpu_handle_context_t ctx = vfContextInitEx(0, gpuIndex, &parameters, FF, LL);
+
+  // NOTE(Constantine): Like a window drag, the size mostly changes by a few pixels and sometimes grows past the present pixels memory.
+  for (int i = 0; i < SAMPLES_COUNT; i += 1) {
+    const int width  = 320 + (i * 7) % 1600;
+    const int height = 180 + (i * 5) % 900;
+    const uint64_t begin = GetTimeNanoseconds();
+    vfWindowRebuildPresent(ctx, width, height, FF, LL);
+    gSamples[i] = GetTimeNanoseconds() - begin;
+  }
+  JsonPrintResult("resize_storm_headless_rebuild", "ns", SAMPLES_COUNT, gSamples, 0);
+
+  vfContextDeinit(ctx, FF, LL);
+}
+
+static void BenchResizeStormPresent(unsigned gpuIndex, int width, int height) {
+  int monitorArea[4] = {0};
+  vfGetMainMonitorAreaRectangle(monitorArea, FF, LL);
+  if (monitorArea[2] < width || monitorArea[3] < height) {
+    return;
+  }
+
+  gpu_handle_context_t ctx = vfContextInitEx(0, gpuIndex, NULL, FF, LL);
+  vfWindowFullscreen(ctx, NULL, "[vkFast] Microbenchmarks", width, height, 0, RED_PRESENT_VSYNC_MODE_OFF, FF, LL);
+
+  const unsigned array65536[1] = {65536};
+
+  // To free
+  unsigned char * pixels = (unsigned char *)red32MemoryCalloc((uint64_t)width * height * 4);
+  REDGPU_2_EXPECTFL(pixels != NULL);
+
+  // NOTE(Constantine): A rebuild and a draw per sample, the draw releases the resources the rebuild retired.
+  const int samplesCount = 200;
+  int i = 0;
+  while (vfWindowLoop(ctx) && i < samplesCount) {
+    gpu_thread_t gpu_threads[1] = {0};
+    const uint64_t begin = GetTimeNanoseconds();
+    vfWindowRebuildPresent(ctx, 0, 0, FF, LL);
+    vfDrawPixels(ctx, pixels, NULL, 1, gpu_threads, array65536, FF, LL);
+    gSamples[i] = GetTimeNanoseconds() - begin;
+    i += 1;
+  }
+  if (i > 0) {
+    JsonPrintResult("resize_storm_present_rebuild_and_draw", "ns", i, gSamples, 0);
+  }
+
+  vfAllQueuesWaitIdle(ctx, FF, LL);
+  red32MemoryFree(pixels);
+  vfContextDeinit(ctx, FF, LL);
+}
+
+int main(int argc, char ** argv) {
+#if defined(__MINGW32__)
+  SetProcessDPIAware();
+#elif defined(_WIN32)
+  SetProcessDpiAwareness(PROCESS_PER_MONITOR_DPI_AWARE);
+#endif
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+  _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
+#endif
+
+  const unsigned gpuIndex    = argc >= 2 ? (unsigned)atoi(argv[1]) : 0;
+  const int      withPresent = argc >= 3 && strcmp(argv[2], "present") == 0 ? 1 : 0;
+
+  printf("{\n  \"benchmarks\": [");
+
+  gpu_handle_context_t ctx = vfContextInitEx(0, gpuIndex, NULL, FF, LL);
+
+  const unsigned array65536[1] = {65536};
+  gpu_thread_t gpu_thread = NULL;
+  vfGpuThreadCreate(ctx, 1, &gpu_thread, NULL, FF, LL);
+
+  BenchStorageCreateChurn(ctx);
+  BenchBatchRecord(ctx);
+  BenchSubmitWaitLatency(ctx, gpu_thread, array65536);
+  BenchCopyBandwidth(ctx, gpu_thread, array65536);
+
+  vfAllQueuesWaitIdle(ctx, FF, LL);
+  vfGpuThreadDestroy(ctx, gpu_thread);
+  vfContextDeinit(ctx, FF, LL);
+
+  BenchResizeStormHeadless(gpuIndex);
+
+  if (withPresent == 1) {
+    BenchDrawPixels(gpuIndex, 1920, 1080, "draw_pixels_1920x1080");
+    BenchDrawPixels(gpuIndex, 3840, 2160, "draw_pixels_3840x2160");
+    BenchResizeStormPresent(gpuIndex, 1280, 720);
+  }
+
+  printf("\n  ]\n}\n");
+
+  vfExit(0);
+}
@@ -0,0 +1,8 @@
+// NOTE(Constantine): The CPU build of add.shared.hlsl, one kernel per translation unit.
+
+#define VKFAST_EXAMPLES_COMMON_INCLUDE_GLM
+#include "../Common/vkfast_examples_common.h"
+
+#define main add
+#include "add.shared.hlsl"
+#undef main
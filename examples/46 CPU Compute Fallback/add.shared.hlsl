@@ -0,0 +1,15 @@
+// dxc.exe add.shared.hlsl -T cs_6_0 -E main -Fh add.cs.h -spirv
+
+#include "../../extra/CPU Compute/vkfast_extra_cpu_compute_shared.h"
+
+VF_STORAGE(0, float4, array0)
+VF_STORAGE(1, float4, array1)
+
+struct Variables {
+  float4 salt;
+};
+VF_VARIABLES(Variables, variables)
+
+VF_KERNEL(1, 1, 1, main, tid) {
+  array1[0] = array0[0] + array0[1] + variables.salt;
+}
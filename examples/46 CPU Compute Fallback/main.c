@@ -0,0 +1,241 @@
+// NOTE(Constantine):
+// Runs the kernels of add.shared.hlsl and saxpy.shared.hlsl on the CPU with vkfast_extra_cpu_compute.h.
+// The same add.shared.hlsl compiles with dxc to add.cs.h, with "gpu" argument the GPU result is compared against the CPU one.
+// Usage: a.exe [threads_count] [gpu]
+// Build with compile_program_release.sh, or with cmake-bazzite-steamos.
+
+#include "../../vkfast.h"
+#include "../../extra/CPU Compute/vkfast_extra_cpu_compute.h"
+#include "../Common/vkfast_examples_common.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// NOTE(Constantine): Defined in add.shared.cpp and saxpy.shared.cpp.
+void vfeCpuComputeKernel_add(const gpu_extra_cpu_compute_workgroup_t * workgroup);
+void vfeCpuComputeKernel_saxpy(const gpu_extra_cpu_compute_workgroup_t * workgroup);
+
+static uint64_t GetTimeNanoseconds(void) {
+#if defined(_WIN32)
+  LARGE_INTEGER frequency = {0};
+  LARGE_INTEGER counter   = {0};
+  QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&counter);
+  return (uint64_t)((counter.QuadPart / frequency.QuadPart) * 1000000000ULL + ((counter.QuadPart % frequency.QuadPart) * 1000000000ULL) / frequency.QuadPart);
+#else
+  struct timespec ts = {0};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static const float gAddInput[2][4] = {
+  {4,  8, 15,  16},
+  {16, 23, 42, 108},
+};
+
+static const float gAddSalt[4] = {0, -1, -7, 6};
+
+static void AddOnCpu(gpu_extra_cpu_compute_context_t cpu, float * out_result) {
+  gpu_storage_info_t storage_info = {0};
+  storage_info.storage_type = GPU_STORAGE_TYPE_CPU_UPLOAD;
+  storage_info.bytes_count  = sizeof(gAddInput);
+  gpu_storage_t storage_input = {0};
+  vfeCpuComputeStorageCreate(cpu, &storage_info, &storage_input, FF, LL);
+  storage_info.bytes_count  = 1 * 4*sizeof(float);
+  gpu_storage_t storage_output = {0};
+  vfeCpuComputeStorageCreate(cpu, &storage_info, &storage_output, FF, LL);
+
+  memcpy(storage_input.mapped_void_ptr, gAddInput, sizeof(gAddInput));
+
+  uint64_t pp = vfeCpuComputeProgramPipelineCreate(cpu, vfeCpuComputeKernel_add, sizeof(gAddSalt), FF, LL);
+
+  uint64_t batch = vfeCpuComputeBatchBegin(cpu, 0, FF, LL);
+  vfeCpuComputeBatchBindProgramPipeline(cpu, batch, pp, FF, LL);
+  vfeCpuComputeBatchBindStorageSingle(cpu, batch, 0, storage_input.id, FF, LL);
+  vfeCpuComputeBatchBindStorageSingle(cpu, batch, 1, storage_output.id, FF, LL);
+  vfeCpuComputeBatchBindVariablesCopy(cpu, batch, 0, sizeof(gAddSalt), gAddSalt, FF, LL);
+  vfeCpuComputeBatchCompute(cpu, batch, 1, 1, 1, FF, LL);
+  vfeCpuComputeBatchEnd(cpu, batch, FF, LL);
+  vfeCpuComputeBatchExecute(cpu, 1, &batch, FF, LL);
+
+  memcpy(out_result, storage_output.mapped_void_ptr, 4*sizeof(float));
+
+  uint64_t ids[] = {batch, pp, storage_output.id, storage_input.id};
+  vfeCpuComputeIdDestroy(cpu, countof(ids), ids, FF, LL);
+}
+
+static void AddOnGpu(float * out_result) {
+  gpu_handle_context_t ctx = vfContextInit(1, NULL, FF, LL);
+
+  const unsigned array65536[1] = {65536};
+
+  gpu_thread_t gpu_thread = NULL;
+  vfGpuThreadCreate(ctx, 1, &gpu_thread, NULL, FF, LL);
+
+  gpu_storage_info_t storage_info = {0};
+  storage_info.storage_type = GPU_STORAGE_TYPE_CPU_UPLOAD;
+  storage_info.bytes_count  = sizeof(gAddInput);
+  gpu_storage_t storage_input_cpu = {0};
+  vfStorageCreate(ctx, &storage_info, &storage_input_cpu, FF, LL);
+  storage_info.storage_type = GPU_STORAGE_TYPE_GPU_ONLY;
+  gpu_storage_t storage_input_gpu = {0};
+  vfStorageCreate(ctx, &storage_info, &storage_input_gpu, FF, LL);
+
+  memcpy(storage_input_cpu.mapped_void_ptr, gAddInput, sizeof(gAddInput));
+
+  storage_info.storage_type = GPU_STORAGE_TYPE_CPU_READBACK;
+  storage_info.bytes_count  = 1 * 4*sizeof(float);
+  gpu_storage_t storage_output_cpu = {0};
+  vfStorageCreate(ctx, &storage_info, &storage_output_cpu, FF, LL);
+  storage_info.storage_type = GPU_STORAGE_TYPE_GPU_ONLY;
+  gpu_storage_t storage_output_gpu = {0};
+  vfStorageCreate(ctx, &storage_info, &storage_output_gpu, FF, LL);
+
+  #include "add.cs.h"
+  gpu_program_info_t cs_info = {0};
+  cs_info.program_binary_bytes_count = sizeof(g_main);
+  cs_info.program_binary             = g_main;
+  uint64_t cs = vfProgramCreateFromBinaryCompute(ctx, &cs_info, FF, LL);
+
+  RedStructDeclarationMember slots[2] = {0};
+  slots[0].slot            = 0;
+  slots[0].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+  slots[0].count           = 1;
+  slots[0].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+
+  slots[1].slot            = 1;
+  slots[1].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+  slots[1].count           = 1;
+  slots[1].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+  gpu_program_pipeline_compute_info_t pp_info = {0};
+  pp_info.compute_program       = cs;
+  pp_info.variables_slot        = 2;
+  pp_info.variables_bytes_count = sizeof(gAddSalt);
+  pp_info.struct_members_count  = countof(slots);
+  pp_info.struct_members        = slots;
+  uint64_t pp = vfProgramPipelineCreateCompute(ctx, &pp_info, FF, LL);
+
+  gpu_batch_info_t bindings_info = {0};
+  bindings_info.max_new_bindings_sets_count = 1;
+  bindings_info.max_storage_binds_count     = 2;
+  uint64_t batch = vfBatchBegin(ctx, 0, &bindings_info, NULL, FF, LL);
+  vfBatchStorageCopyFromCpuToGpu(ctx, batch, storage_input_cpu.id, storage_input_gpu.id, FF, LL);
+  vfBatchBarrierMemory(ctx, batch, FF, LL);
+  vfBatchBindProgramPipelineCompute(ctx, batch, pp, FF, LL);
+  vfBatchBindNewBindingsSet(ctx, batch, countof(slots), slots, FF, LL);
+  vfBatchBindStorageSingle(ctx, batch, 0, storage_input_gpu.id, FF, LL);
+  vfBatchBindStorageSingle(ctx, batch, 1, storage_output_gpu.id, FF, LL);
+  vfBatchBindNewBindingsEnd(ctx, batch, FF, LL);
+  vfBatchBindVariablesCopy(ctx, batch, 0, sizeof(gAddSalt), gAddSalt, FF, LL);
+  vfBatchCompute(ctx, batch, 1, 1, 1, FF, LL);
+  vfBatchBarrierMemory(ctx, batch, FF, LL);
+  vfBatchStorageCopyFromGpuToCpu(ctx, batch, storage_output_gpu.id, storage_output_cpu.id, FF, LL);
+  vfBatchBarrierCpuReadback(ctx, batch, FF, LL);
+  vfBatchEnd(ctx, batch, FF, LL);
+
+  RedHandleCalls batchRaw = vfBatchGetRawHandle(ctx, batch, FF, LL);
+  uint64_t async = vfAsyncBatchExecuteRaw(ctx, 1, &batchRaw, 1, &gpu_thread, array65536, FF, LL);
+  vfAsyncWaitToFinish(ctx, async, FF, LL);
+
+  memcpy(out_result, storage_output_cpu.mapped_void_ptr, 4*sizeof(float));
+
+  vfAllQueuesWaitIdle(ctx, FF, LL);
+  uint64_t ids[] = {batch, pp, cs, storage_output_gpu.id, storage_output_cpu.id, storage_input_gpu.id, storage_input_cpu.id};
+  vfIdDestroy(countof(ids), ids, FF, LL);
+  vfGpuThreadDestroy(ctx, gpu_thread);
+  vfContextDeinit(ctx, FF, LL);
+}
+
+// NOTE(Constantine): Returns the best time of a few runs in nanoseconds.
+static uint64_t SaxpyOnCpu(unsigned threadsCount, unsigned count) {
+  gpu_extra_cpu_compute_context_t cpu = vfeCpuComputeContextInit(threadsCount, FF, LL);
+
+  gpu_storage_info_t storage_info = {0};
+  storage_info.storage_type = GPU_STORAGE_TYPE_CPU_UPLOAD;
+  storage_info.bytes_count  = (uint64_t)count * sizeof(float);
+  gpu_storage_t storage_x = {0};
+  gpu_storage_t storage_y = {0};
+  vfeCpuComputeStorageCreate(cpu, &storage_info, &storage_x, FF, LL);
+  vfeCpuComputeStorageCreate(cpu, &storage_info, &storage_y, FF, LL);
+
+  struct {
+    float    a;
+    unsigned count;
+  } variables = {2, count};
+
+  uint64_t pp = vfeCpuComputeProgramPipelineCreate(cpu, vfeCpuComputeKernel_saxpy, sizeof(variables), FF, LL);
+
+  uint64_t batch = vfeCpuComputeBatchBegin(cpu, 0, FF, LL);
+  vfeCpuComputeBatchBindProgramPipeline(cpu, batch, pp, FF, LL);
+  vfeCpuComputeBatchBindStorageSingle(cpu, batch, 0, storage_x.id, FF, LL);
+  vfeCpuComputeBatchBindStorageSingle(cpu, batch, 1, storage_y.id, FF, LL);
+  vfeCpuComputeBatchBindVariablesCopy(cpu, batch, 0, sizeof(variables), &variables, FF, LL);
+  vfeCpuComputeBatchCompute(cpu, batch, (count + 63) / 64, 1, 1, FF, LL);
+  vfeCpuComputeBatchEnd(cpu, batch, FF, LL);
+
+  uint64_t best = (uint64_t)-1;
+  for (int run = 0; run < 5; run += 1) {
+    for (unsigned i = 0; i < count; i += 1) {
+      storage_x.as_f32[i] = (float)(i % 1024);
+      storage_y.as_f32[i] = 1;
+    }
+    const uint64_t begin = GetTimeNanoseconds();
+    vfeCpuComputeBatchExecute(cpu, 1, &batch, FF, LL);
+    const uint64_t time = GetTimeNanoseconds() - begin;
+    best = time < best ? time : best;
+    for (unsigned i = 0; i < count; i += 1) {
+      REDGPU_2_EXPECTFL(storage_y.as_f32[i] == 2 * (float)(i % 1024) + 1);
+    }
+  }
+
+  uint64_t ids[] = {batch, pp, storage_y.id, storage_x.id};
+  vfeCpuComputeIdDestroy(cpu, countof(ids), ids, FF, LL);
+  vfeCpuComputeContextDeinit(cpu, FF, LL);
+  return best;
+}
+
+int main(int argc, char ** argv) {
+#if defined(__MINGW32__)
+  SetProcessDPIAware();
+#elif defined(_WIN32)
+  SetProcessDpiAwareness(PROCESS_PER_MONITOR_DPI_AWARE);
+#endif
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+  _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
+#endif
+
+  const unsigned threadsCount = argc >= 2 ? (unsigned)atoi(argv[1]) : 0;
+  const int      withGpu      = argc >= 3 && strcmp(argv[2], "gpu") == 0 ? 1 : 0;
+
+  gpu_extra_cpu_compute_context_t cpu = vfeCpuComputeContextInit(threadsCount, FF, LL);
+  float cpuResult[4] = {0};
+  AddOnCpu(cpu, cpuResult);
+  vfeCpuComputeContextDeinit(cpu, FF, LL);
+
+  // NOTE(Constantine): Expected result: 20 30 50 130 (20 31 57 124 + salt)
+  printf("CPU result: %f %f %f %f\n", cpuResult[0], cpuResult[1], cpuResult[2], cpuResult[3]);
+  REDGPU_2_EXPECTFL(cpuResult[0] == 20);
+  REDGPU_2_EXPECTFL(cpuResult[1] == 30);
+  REDGPU_2_EXPECTFL(cpuResult[2] == 50);
+  REDGPU_2_EXPECTFL(cpuResult[3] == 130);
+
+  if (withGpu == 1) {
+    float gpuResult[4] = {0};
+    AddOnGpu(gpuResult);
+    printf("GPU result: %f %f %f %f\n", gpuResult[0], gpuResult[1], gpuResult[2], gpuResult[3]);
+    REDGPU_2_EXPECTFL(memcmp(cpuResult, gpuResult, sizeof(cpuResult)) == 0);
+    printf("CPU and GPU results match\n");
+  }
+
+  const unsigned count = 16 * 1024 * 1024;
+  const uint64_t timeSingle   = SaxpyOnCpu(1, count);
+  const uint64_t timeParallel = SaxpyOnCpu(threadsCount, count);
+  printf("saxpy of %u floats: 1 thread: %.3f ms, pool: %.3f ms, speedup: %.2fx\n", count, timeSingle / 1000000.0, timeParallel / 1000000.0, (double)timeSingle / (double)timeParallel);
+
+  vfExit(0);
+}
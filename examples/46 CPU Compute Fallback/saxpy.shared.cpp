@@ -0,0 +1,8 @@
+// NOTE(Constantine): The CPU build of saxpy.shared.hlsl, one kernel per translation unit.
+
+#define VKFAST_EXAMPLES_COMMON_INCLUDE_GLM
+#include "../Common/vkfast_examples_common.h"
+
+#define main saxpy
+#include "saxpy.shared.hlsl"
+#undef main
@@ -0,0 +1,18 @@
+// dxc.exe saxpy.shared.hlsl -T cs_6_0 -E main -Fh saxpy.cs.h -spirv
+
+#include "../../extra/CPU Compute/vkfast_extra_cpu_compute_shared.h"
+
+VF_STORAGE(0, float, x)
+VF_STORAGE(1, float, y)
+
+struct Variables {
+  float a;
+  uint  count;
+};
+VF_VARIABLES(Variables, variables)
+
+VF_KERNEL(64, 1, 1, main, tid) {
+  if (tid.x < variables.count) {
+    y[tid.x] = variables.a * x[tid.x] + y[tid.x];
+  }
+}
@@ -0,0 +1,96 @@
+//\\rc rawbuild begin gcc-linux-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `gcc`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c "../../extra/Multi GPU/vkfast_extra_multi_gpu.c" /home/linuxbrew/RedGpuSDK/redgpu.c /home/linuxbrew/RedGpuSDK/redgpu_2.c /home/linuxbrew/RedGpuSDK/redgpu_32.c -I/home/linuxbrew/.linuxbrew/include/ -I/home/linuxbrew/.linuxbrew/Cellar/xorgproto/2025.1/include/ -I/var/home/linuxbrew/.linuxbrew/Cellar/libxcb/1.17.0/include/ /home/linuxbrew/.linuxbrew/lib/libX11.so /home/linuxbrew/.linuxbrew/lib/libvulkan.so -lm -lpthread`
+//\\rc rawbuild end
+
+//\\rc rawbuild begin clang-windows-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `clang`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c "../../extra/Multi GPU/vkfast_extra_multi_gpu.c" C:/RedGpuSDK/redgpu.c C:/RedGpuSDK/redgpu_2.c C:/RedGpuSDK/redgpu_32.c`
+//\\rc rawbuild end
+
+// NOTE(Constantine):
+// Runs the compute_draw.cs.hlsl kernel of the Simple Compute Draw Template example on every GPU of the machine with
+// vkfast_extra_multi_gpu.h, each GPU fills its own rows of the 1920x1080 image. The first dispatch splits the rows
+// equally, the next ones split them by the throughput every GPU measured. Prints the slice and the time of each GPU.
+// Usage: a.exe [dispatches_count]
+
+#include "../../vkfast.h"
+#include "../../extra/Multi GPU/vkfast_extra_multi_gpu.h"
+#include "../Common/vkfast_examples_common.h"
+
+int main(int argc, char ** argv) {
+#if defined(__MINGW32__)
+  SetProcessDPIAware();
+#elif defined(_WIN32)
+  SetProcessDpiAwareness(PROCESS_PER_MONITOR_DPI_AWARE);
+#endif
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+  _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
+#endif
+
+  #define image_w 1920
+  #define image_h 1080
+
+  const int dispatchesCount = argc >= 2 ? atoi(argv[1]) : 8;
+
+  gpu_extra_multi_gpu_t multiGpu = vfeMultiGpuInit(0, NULL, FF, LL);
+  printf("GPUs count: %u\n", vfeMultiGpuGetGpusCount(multiGpu));
+
+  #include "compute_draw.cs.h"
+  gpu_program_info_t cs_info = {0};
+  cs_info.program_binary_bytes_count = sizeof(g_main);
+  cs_info.program_binary             = g_main;
+
+  RedStructDeclarationMember slots[1] = {0};
+  slots[0].slot            = 0;
+  slots[0].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+  slots[0].count           = 1;
+  slots[0].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+  gpu_program_pipeline_compute_info_t pp_info = {0};
+  pp_info.variables_slot        = 1;
+  pp_info.variables_bytes_count = 0;
+  pp_info.struct_members_count  = countof(slots);
+  pp_info.struct_members        = slots;
+  uint64_t pp = vfeMultiGpuProgramPipelineCreateCompute(multiGpu, &cs_info, &pp_info, FF, LL);
+
+  unsigned * pixels = (unsigned *)red32MemoryCalloc(image_w * image_h * sizeof(unsigned));
+  REDGPU_2_EXPECTFL(pixels != NULL);
+
+  for (int d = 0; d < dispatchesCount; d += 1) {
+    memset(pixels, 0, image_w * image_h * sizeof(unsigned));
+
+    // NOTE(Constantine): The kernel runs 8x8 threads per workgroup, so one split unit is one row of workgroups, 8 rows of pixels.
+    gpu_extra_multi_gpu_dispatch_t dispatch = {0};
+    dispatch.program_pipeline_id                     = pp;
+    dispatch.workgroups_count_x                      = image_w / 8;
+    dispatch.workgroups_count_y                      = image_h / 8;
+    dispatch.output_slot                             = 0;
+    dispatch.output_bytes_per_split_unit             = 8 * image_w * sizeof(unsigned);
+    dispatch.output                                  = pixels;
+    dispatch.variables_workgroup_offset_bytes_offset = GPU_EXTRA_MULTI_GPU_NO_WORKGROUP_OFFSET;
+    gpu_extra_multi_gpu_dispatch_result_t result = {0};
+    vfeMultiGpuDispatch(multiGpu, &dispatch, &result, FF, LL);
+
+    printf("Dispatch %d:\n", d);
+    for (unsigned i = 0; i < result.gpus_count; i += 1) {
+      printf("  GPU %u: rows of workgroups %u..%u, %.3f ms, %.1f rows of workgroups per second\n", i, result.split_units_first[i], result.split_units_first[i] + result.split_units_count[i], result.nanoseconds[i] / 1000000.0, result.throughput[i]);
+    }
+
+    for (unsigned i = 0; i < image_w * image_h; i += 1) {
+      REDGPU_2_EXPECTFL(pixels[i] == 0xFFFF0000);
+    }
+  }
+
+  red32MemoryFree(pixels);
+  vfeMultiGpuProgramPipelineDestroy(multiGpu, pp, FF, LL);
+  vfeMultiGpuDeinit(multiGpu, FF, LL);
+
+  vfExit(0);
+}
@@ -0,0 +1,85 @@
+//\\rc rawbuild begin gcc-linux-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `gcc`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c ../../extra/Banzai/vkfast_extra_banzai.c ../../extra/Banzai/vkfast_extra_banzai_pointer.c ../../extra/Banzai/vkfast_extra_banzai_allocator.c /home/linuxbrew/RedGpuSDK/redgpu.c /home/linuxbrew/RedGpuSDK/redgpu_2.c /home/linuxbrew/RedGpuSDK/redgpu_32.c -I/home/linuxbrew/.linuxbrew/include/ -I/home/linuxbrew/.linuxbrew/Cellar/xorgproto/2025.1/include/ -I/var/home/linuxbrew/.linuxbrew/Cellar/libxcb/1.17.0/include/ /home/linuxbrew/.linuxbrew/lib/libX11.so /home/linuxbrew/.linuxbrew/lib/libvulkan.so -lm -lpthread`
+//\\rc rawbuild end
+
+//\\rc rawbuild begin clang-windows-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `clang`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c ../../extra/Banzai/vkfast_extra_banzai.c ../../extra/Banzai/vkfast_extra_banzai_pointer.c ../../extra/Banzai/vkfast_extra_banzai_allocator.c C:/RedGpuSDK/redgpu.c C:/RedGpuSDK/redgpu_2.c C:/RedGpuSDK/redgpu_32.c`
+//\\rc rawbuild end
+
+// NOTE(Constantine):
+// Allocates many small objects and a few large ones inside the whole-heap CPU upload storage of vfeBanzaiStoragesCreate()
+// with vkfast_extra_banzai_allocator.h, through a cache and through the allocator, frees every other one, checks that
+// the survivors kept their contents and prints the allocator statistics.
+// Usage: a.exe [objects_count]
+
+#include "../../vkfast.h"
+#include "../../extra/Banzai/vkfast_extra_banzai_allocator.h"
+#include "../Common/vkfast_examples_common.h"
+
+static void printStatistics(const char * title, gpu_extra_banzai_allocator_t allocator) {
+  gpu_extra_banzai_allocator_statistics_t statistics = {0};
+  vfeBanzaiAllocatorGetStatistics(allocator, &statistics);
+  printf("%s:\n", title);
+  printf("  Managed:             %llu bytes, %llu free in pages, largest free span %llu bytes\n", (unsigned long long)statistics.bytes_count, (unsigned long long)statistics.free_pages_bytes_count, (unsigned long long)statistics.largest_free_span_bytes_count);
+  printf("  Large allocations:   %llu, %llu bytes\n", (unsigned long long)statistics.large_allocations_count, (unsigned long long)statistics.large_allocations_bytes_count);
+  printf("  Slabs:               %llu, %llu slots used, %llu bytes used, %llu bytes free\n", (unsigned long long)statistics.slabs_count, (unsigned long long)statistics.slab_slots_used_count, (unsigned long long)statistics.slab_slots_used_bytes_count, (unsigned long long)statistics.slab_slots_free_bytes_count);
+  printf("  Cached slots:        %llu, %llu bytes\n", (unsigned long long)statistics.cached_slots_count, (unsigned long long)statistics.cached_slots_bytes_count);
+  printf("  Allocate/free calls: %llu/%llu, %llu failed\n", (unsigned long long)statistics.allocate_calls_count, (unsigned long long)statistics.free_calls_count, (unsigned long long)statistics.failed_allocate_calls_count);
+}
+
+int main(int argc, char ** argv) {
+#if defined(_MSC_VER) && defined(_DEBUG)
+  _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
+#endif
+
+  const unsigned objectsCount = argc >= 2 ? (unsigned)atoi(argv[1]) : 200000;
+
+  gpu_handle_context_t ctx = vfContextInit(1, NULL, FF, LL);
+
+  gpu_storage_t storage_cpu_upload = {0};
+  vfeBanzaiStoragesCreate(ctx, NULL, &storage_cpu_upload, NULL, FF, LL);
+
+  gpu_extra_banzai_allocator_t       allocator = vfeBanzaiAllocatorCreate(&storage_cpu_upload, 0, 0, FF, LL);
+  gpu_extra_banzai_allocator_cache_t cache     = vfeBanzaiAllocatorCacheCreate(allocator, FF, LL);
+
+  gpu_extra_banzai_pointer_t * objects = (gpu_extra_banzai_pointer_t *)red32MemoryCalloc(sizeof(gpu_extra_banzai_pointer_t) * objectsCount);
+  REDGPU_2_EXPECTFL(objects != NULL);
+
+  // NOTE(Constantine): Every 1000th object is a large one, the others are 16 to 256 bytes, each one is filled with its index.
+  for (unsigned i = 0; i < objectsCount; i += 1) {
+    const uint64_t bytesCount = i % 1000 == 999 ? 64 * 1024 : 16 + (i * 2654435761u) % 241;
+    const RedBool32 allocated = (i & 1) == 0 ?
+      vfeBanzaiAllocatorCacheAllocate(cache, bytesCount, &objects[i], FF, LL) :
+      vfeBanzaiAllocatorAllocate(allocator, bytesCount, &objects[i], FF, LL);
+    REDGPU_2_EXPECTFL(allocated == 1);
+    objects[i].as_u32[0] = i;
+  }
+  printStatistics("After allocating", allocator);
+
+  for (unsigned i = 0; i < objectsCount; i += 2) {
+    vfeBanzaiAllocatorCacheFree(cache, &objects[i], FF, LL);
+  }
+  vfeBanzaiAllocatorCacheFlush(cache, FF, LL);
+  printStatistics("After freeing every other object", allocator);
+
+  for (unsigned i = 1; i < objectsCount; i += 2) {
+    REDGPU_2_EXPECTFL(objects[i].as_u32[0] == i);
+    vfeBanzaiAllocatorFree(allocator, &objects[i], FF, LL);
+  }
+  printStatistics("After freeing all objects", allocator);
+
+  red32MemoryFree(objects);
+  vfeBanzaiAllocatorCacheDestroy(cache, FF, LL);
+  vfeBanzaiAllocatorDestroy(allocator, FF, LL);
+
+  vfIdDestroy(1, &storage_cpu_upload.id, FF, LL);
+  vfContextDeinit(ctx, FF, LL);
+}
@@ -0,0 +1,227 @@
+//\\rc rawbuild begin gcc-linux-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `gcc`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c /home/linuxbrew/RedGpuSDK/redgpu.c /home/linuxbrew/RedGpuSDK/redgpu_2.c /home/linuxbrew/RedGpuSDK/redgpu_32.c -I/home/linuxbrew/.linuxbrew/include/ -I/home/linuxbrew/.linuxbrew/Cellar/xorgproto/2025.1/include/ -I/var/home/linuxbrew/.linuxbrew/Cellar/libxcb/1.17.0/include/ /home/linuxbrew/.linuxbrew/lib/libX11.so /home/linuxbrew/.linuxbrew/lib/libvulkan.so -lm`
+//\\rc rawbuild end
+
+//\\rc rawbuild begin clang-windows-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `clang`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c C:/RedGpuSDK/redgpu.c C:/RedGpuSDK/redgpu_2.c C:/RedGpuSDK/redgpu_32.c`
+//\\rc rawbuild end
+
+// NOTE(Constantine):
+// Tests vfProgramPipelineTuneCompute() and its tuning cache file with the add kernel of example 00, whose local size is fixed to 1x1x1, so
+// every dimension is GPU_TUNE_LOCAL_SIZE_NOT_SPECIALIZED. Two contexts that were inited before either of them tuned both tune the same key
+// and the cache file must still have one line for it, a third context must get the key from the cache. The tuned program pipeline of
+// every context must compute the same result as example 00.
+// Usage: a.exe [gpu_index]
+
+#include "../../vkfast.h"
+#include "../../vkfast_ex.h"
+#include "../Common/vkfast_examples_common.h"
+
+#define TUNING_CACHE_FILEPATH "vkfast_local_size_tuning_test_cache.txt"
+#define TUNING_KEY            "local_size_tuning_test_add_1x1x1"
+
+typedef struct TuneBindData {
+  RedStructDeclarationMember * slots;
+  unsigned                     slotsCount;
+  uint64_t                     storageInput;
+  uint64_t                     storageOutput;
+} TuneBindData;
+
+static const float gSalt[4] = {0, -1, -7, 6};
+
+static void TuneBind(gpu_handle_context_t ctx, uint64_t batch, void * user_data) {
+  const TuneBindData * data = (const TuneBindData *)user_data;
+  vfBatchBindNewBindingsSet(ctx, batch, data->slotsCount, data->slots, FF, LL);
+  vfBatchBindStorageSingle(ctx, batch, 0, data->storageInput, FF, LL);
+  vfBatchBindStorageSingle(ctx, batch, 1, data->storageOutput, FF, LL);
+  vfBatchBindNewBindingsEnd(ctx, batch, FF, LL);
+  vfBatchBindVariablesCopy(ctx, batch, 0, sizeof(gSalt), gSalt, FF, LL);
+}
+
+static unsigned CountCacheLinesOfKey(void) {
+  unsigned count = 0;
+  FILE * fh = fopen(TUNING_CACHE_FILEPATH, "rb");
+  REDGPU_2_EXPECTFL(fh != NULL);
+  char line[512] = {0};
+  while (fgets(line, sizeof(line), fh) != NULL) {
+    if (strstr(line, " " TUNING_KEY " ") != NULL) {
+      count += 1;
+    }
+  }
+  fclose(fh);
+  return count;
+}
+
+static gpu_handle_context_t ContextInit(unsigned gpuIndex) {
+  gpu_context_ex4_parameters_t ex4 = {0};
+  ex4.optionalTuningCacheFilepath = TUNING_CACHE_FILEPATH;
+  return vfContextInitEx4(1, gpuIndex, NULL, NULL, NULL, &ex4, FF, LL);
+}
+
+// NOTE(Constantine): Tunes the add kernel, checks the result against the expectations and runs the tuned program pipeline once.
+static void TuneAndRun(gpu_handle_context_t ctx, RedBool32 expectFromCache) {
+  const unsigned array65536[1] = {65536};
+
+  gpu_thread_t gpu_thread = NULL;
+  vfGpuThreadCreate(ctx, 1, &gpu_thread, NULL, FF, LL);
+
+  gpu_storage_info_t storage_info = {0};
+  storage_info.storage_type = GPU_STORAGE_TYPE_CPU_UPLOAD;
+  storage_info.bytes_count  = 2 * 4*sizeof(float);
+  gpu_storage_t storage_input_cpu = {0};
+  vfStorageCreate(ctx, &storage_info, &storage_input_cpu, FF, LL);
+  storage_info.storage_type = GPU_STORAGE_TYPE_GPU_ONLY;
+  gpu_storage_t storage_input_gpu = {0};
+  vfStorageCreate(ctx, &storage_info, &storage_input_gpu, FF, LL);
+  storage_info.storage_type = GPU_STORAGE_TYPE_GPU_ONLY;
+  storage_info.bytes_count  = 1 * 4*sizeof(float);
+  gpu_storage_t storage_output_gpu = {0};
+  vfStorageCreate(ctx, &storage_info, &storage_output_gpu, FF, LL);
+  storage_info.storage_type = GPU_STORAGE_TYPE_CPU_READBACK;
+  gpu_storage_t storage_output_cpu = {0};
+  vfStorageCreate(ctx, &storage_info, &storage_output_cpu, FF, LL);
+
+  const float input[2][4] = {
+    {4,  8, 15,  16},
+    {16, 23, 42, 108},
+  };
+  red32MemoryCopy(storage_input_cpu.mapped_void_ptr, input, sizeof(input));
+  vfStorageCpuUploadFlush(ctx, storage_input_cpu.id, FF, LL);
+
+  uint64_t copy = vfBatchBegin(ctx, 0, NULL, NULL, FF, LL);
+  vfBatchStorageCopyFromCpuToGpu(ctx, copy, storage_input_cpu.id, storage_input_gpu.id, FF, LL);
+  vfBatchEnd(ctx, copy, FF, LL);
+  RedHandleCalls copyRaw = vfBatchGetRawHandle(ctx, copy, FF, LL);
+  vfAsyncWaitToFinish(ctx, vfAsyncBatchExecuteRaw(ctx, 1, &copyRaw, 1, &gpu_thread, array65536, FF, LL), FF, LL);
+
+  #include "add.cs.h"
+  gpu_program_info_t cs_info = {0};
+  cs_info.program_binary_bytes_count = sizeof(g_main);
+  cs_info.program_binary             = g_main;
+  uint64_t cs = vfProgramCreateFromBinaryCompute(ctx, &cs_info, FF, LL);
+
+  RedStructDeclarationMember slots[2] = {0};
+  slots[0].slot            = 0;
+  slots[0].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+  slots[0].count           = 1;
+  slots[0].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+  slots[1].slot            = 1;
+  slots[1].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+  slots[1].count           = 1;
+  slots[1].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+  gpu_program_pipeline_compute_info_t pp_info = {0};
+  pp_info.compute_program       = cs;
+  pp_info.variables_slot        = 2;
+  pp_info.variables_bytes_count = 1 * 4*sizeof(float);
+  pp_info.struct_members_count  = countof(slots);
+  pp_info.struct_members        = slots;
+
+  gpu_batch_info_t bindings_info = {0};
+  bindings_info.max_new_bindings_sets_count = 1;
+  bindings_info.max_storage_binds_count     = 2;
+
+  TuneBindData bindData = {0};
+  bindData.slots         = slots;
+  bindData.slotsCount    = countof(slots);
+  bindData.storageInput  = storage_input_gpu.id;
+  bindData.storageOutput = storage_output_gpu.id;
+
+  // NOTE(Constantine): The local size of the kernel is fixed, so both candidates are 1x1x1 and only the measuring and the cache are tested.
+  const unsigned candidates[2 * 3] = {
+    1, 1, 1,
+    1, 1, 1,
+  };
+  gpu_program_pipeline_tune_compute_info_t tune_info = {0};
+  tune_info.tuning_key                    = TUNING_KEY;
+  tune_info.program_pipeline_compute_info = &pp_info;
+  tune_info.local_size_constant_ids[0]    = GPU_TUNE_LOCAL_SIZE_NOT_SPECIALIZED;
+  tune_info.local_size_constant_ids[1]    = GPU_TUNE_LOCAL_SIZE_NOT_SPECIALIZED;
+  tune_info.local_size_constant_ids[2]    = GPU_TUNE_LOCAL_SIZE_NOT_SPECIALIZED;
+  tune_info.candidates_count              = 2;
+  tune_info.candidates_local_sizes        = candidates;
+  tune_info.invocations_count[0]          = 1;
+  tune_info.invocations_count[1]          = 1;
+  tune_info.invocations_count[2]          = 1;
+  tune_info.batch_info                    = &bindings_info;
+  tune_info.bind_callback                 = TuneBind;
+  tune_info.bind_callback_user_data       = &bindData;
+  tune_info.samples_count                 = 5;
+  gpu_program_pipeline_tune_compute_result_t result = {0};
+  vfProgramPipelineTuneCompute(ctx, &tune_info, &result, FF, LL);
+
+  printf("Tuned %s: local size %ux%ux%u, from cache %u, %s median %llu ns\n", TUNING_KEY, result.local_size[0], result.local_size[1], result.local_size[2], result.is_from_cache, result.is_gpu_timed == 1 ? "GPU timestamps" : "CPU", (unsigned long long)result.median_nanoseconds);
+  REDGPU_2_EXPECTFL(result.is_from_cache == expectFromCache);
+  REDGPU_2_EXPECTFL(result.local_size[0] == 1 && result.local_size[1] == 1 && result.local_size[2] == 1);
+  REDGPU_2_EXPECTFL(result.workgroups_count[0] == 1 && result.workgroups_count[1] == 1 && result.workgroups_count[2] == 1);
+  REDGPU_2_EXPECTFL(expectFromCache == 1 ? result.median_nanoseconds == 0 : result.median_nanoseconds > 0);
+
+  unsigned tunedLocalSize[3] = {0};
+  REDGPU_2_EXPECTFL(vfProgramPipelineGetTunedLocalSize(ctx, TUNING_KEY, tunedLocalSize, FF, LL) == 1);
+  REDGPU_2_EXPECTFL(tunedLocalSize[0] == 1 && tunedLocalSize[1] == 1 && tunedLocalSize[2] == 1);
+
+  uint64_t batch = vfBatchBegin(ctx, 0, &bindings_info, NULL, FF, LL);
+  vfBatchBindProgramPipelineCompute(ctx, batch, result.program_pipeline_compute, FF, LL);
+  TuneBind(ctx, batch, &bindData);
+  vfBatchCompute(ctx, batch, result.workgroups_count[0], result.workgroups_count[1], result.workgroups_count[2], FF, LL);
+  vfBatchBarrierMemory(ctx, batch, FF, LL);
+  vfBatchStorageCopyFromGpuToCpu(ctx, batch, storage_output_gpu.id, storage_output_cpu.id, FF, LL);
+  vfBatchBarrierCpuReadback(ctx, batch, FF, LL);
+  vfBatchEnd(ctx, batch, FF, LL);
+  RedHandleCalls batchRaw = vfBatchGetRawHandle(ctx, batch, FF, LL);
+  vfAsyncWaitToFinish(ctx, vfAsyncBatchExecuteRaw(ctx, 1, &batchRaw, 1, &gpu_thread, array65536, FF, LL), FF, LL);
+  vfStorageCpuReadbackInvalidate(ctx, storage_output_cpu.id, FF, LL);
+
+  const float * output = (const float *)storage_output_cpu.mapped_void_ptr;
+  for (int i = 0; i < 4; i += 1) {
+    REDGPU_2_EXPECTFL(output[i] == input[0][i] + input[1][i] + gSalt[i]);
+  }
+
+  uint64_t ids[] = {
+    batch,
+    copy,
+    result.program_pipeline_compute,
+    cs,
+    storage_input_cpu.id,
+    storage_input_gpu.id,
+    storage_output_gpu.id,
+    storage_output_cpu.id,
+  };
+  vfIdDestroy(countof(ids), ids, FF, LL);
+  vfGpuThreadDestroy(ctx, gpu_thread);
+}
+
+int main(int argc, char ** argv) {
+#if defined(_MSC_VER) && defined(_DEBUG)
+  _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
+#endif
+
+  const unsigned gpuIndex = argc >= 2 ? (unsigned)atoi(argv[1]) : 0;
+
+  remove(TUNING_CACHE_FILEPATH);
+
+  // NOTE(Constantine): Both contexts load the empty cache at init, so both of them tune the key.
+  gpu_handle_context_t ctxA = ContextInit(gpuIndex);
+  gpu_handle_context_t ctxB = ContextInit(gpuIndex);
+  TuneAndRun(ctxA, 0);
+  REDGPU_2_EXPECTFL(CountCacheLinesOfKey() == 1);
+  TuneAndRun(ctxB, 0);
+  REDGPU_2_EXPECTFL(CountCacheLinesOfKey() == 1);
+  vfContextDeinit(ctxB, FF, LL);
+  vfContextDeinit(ctxA, FF, LL);
+
+  gpu_handle_context_t ctxC = ContextInit(gpuIndex);
+  TuneAndRun(ctxC, 1);
+  REDGPU_2_EXPECTFL(CountCacheLinesOfKey() == 1);
+  vfContextDeinit(ctxC, FF, LL);
+
+  remove(TUNING_CACHE_FILEPATH);
+  printf("Local size tuning test passed\n");
+}
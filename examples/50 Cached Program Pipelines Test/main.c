@@ -0,0 +1,210 @@
+//\\rc rawbuild begin gcc-linux-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `gcc`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c /home/linuxbrew/RedGpuSDK/redgpu.c /home/linuxbrew/RedGpuSDK/redgpu_2.c /home/linuxbrew/RedGpuSDK/redgpu_32.c -I/home/linuxbrew/.linuxbrew/include/ -I/home/linuxbrew/.linuxbrew/Cellar/xorgproto/2025.1/include/ -I/var/home/linuxbrew/.linuxbrew/Cellar/libxcb/1.17.0/include/ /home/linuxbrew/.linuxbrew/lib/libX11.so /home/linuxbrew/.linuxbrew/lib/libvulkan.so -lm`
+//\\rc rawbuild end
+
+//\\rc rawbuild begin clang-windows-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `clang`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c C:/RedGpuSDK/redgpu.c C:/RedGpuSDK/redgpu_2.c C:/RedGpuSDK/redgpu_32.c`
+//\\rc rawbuild end
+
+// NOTE(Constantine):
+// Tests vfProgramPipelineCreateComputeCached() and vfProgramPipelineReleaseCached() with the add kernel of example 00 whose sum is scaled by a
+// specialization constant. The same scale must return the same id until its last reference is released, different scales must return
+// different program pipelines that compute results driven by their scale, and enough scales to grow the cache and its hash index several times
+// must all be found again.
+// Usage: a.exe
+
+#include "../../vkfast.h"
+#include "../Common/vkfast_examples_common.h"
+
+#define MANY_SCALES_COUNT 100
+
+static const float gInput[2][4] = {
+  {4,  8, 15,  16},
+  {16, 23, 42, 108},
+};
+static const float gSalt[4] = {0, -1, -7, 6};
+
+typedef struct TestData {
+  gpu_thread_t                        gpuThread;
+  uint64_t                            storageInputGpu;
+  uint64_t                            storageOutputGpu;
+  gpu_storage_t                       storageOutputCpu;
+  RedStructDeclarationMember          slots[2];
+  gpu_program_pipeline_compute_info_t ppInfo;
+} TestData;
+
+static uint64_t CreateCachedScaled(gpu_handle_context_t ctx, const TestData * data, float scale) {
+  gpu_program_specialization_constant_t constant = {0};
+  constant.constant_id = 0;
+  red32MemoryCopy(&constant.value, &scale, sizeof(float));
+  gpu_program_pipeline_compute_info_t pp_info = data->ppInfo;
+  pp_info.specialization_constants_count = 1;
+  pp_info.specialization_constants       = &constant;
+  return vfProgramPipelineCreateComputeCached(ctx, &pp_info, FF, LL);
+}
+
+// NOTE(Constantine): Runs pp once and checks that its output is the sum of example 00 scaled by scale.
+static void RunAndCheck(gpu_handle_context_t ctx, const TestData * data, uint64_t pp, float scale) {
+  const unsigned array65536[1] = {65536};
+
+  gpu_batch_info_t bindings_info = {0};
+  bindings_info.max_new_bindings_sets_count = 1;
+  bindings_info.max_storage_binds_count     = 2;
+  uint64_t batch = vfBatchBegin(ctx, 0, &bindings_info, NULL, FF, LL);
+  vfBatchBindProgramPipelineCompute(ctx, batch, pp, FF, LL);
+  vfBatchBindNewBindingsSet(ctx, batch, countof(data->slots), data->slots, FF, LL);
+  vfBatchBindStorageSingle(ctx, batch, 0, data->storageInputGpu, FF, LL);
+  vfBatchBindStorageSingle(ctx, batch, 1, data->storageOutputGpu, FF, LL);
+  vfBatchBindNewBindingsEnd(ctx, batch, FF, LL);
+  vfBatchBindVariablesCopy(ctx, batch, 0, sizeof(gSalt), gSalt, FF, LL);
+  vfBatchCompute(ctx, batch, 1, 1, 1, FF, LL);
+  vfBatchBarrierMemory(ctx, batch, FF, LL);
+  vfBatchStorageCopyFromGpuToCpu(ctx, batch, data->storageOutputGpu, data->storageOutputCpu.id, FF, LL);
+  vfBatchBarrierCpuReadback(ctx, batch, FF, LL);
+  vfBatchEnd(ctx, batch, FF, LL);
+  RedHandleCalls batchRaw = vfBatchGetRawHandle(ctx, batch, FF, LL);
+  gpu_thread_t gpu_thread = data->gpuThread;
+  vfAsyncWaitToFinish(ctx, vfAsyncBatchExecuteRaw(ctx, 1, &batchRaw, 1, &gpu_thread, array65536, FF, LL), FF, LL);
+  vfStorageCpuReadbackInvalidate(ctx, data->storageOutputCpu.id, FF, LL);
+
+  const float * output = (const float *)data->storageOutputCpu.mapped_void_ptr;
+  printf("Scale %f: %f %f %f %f\n", scale, output[0], output[1], output[2], output[3]);
+  for (int i = 0; i < 4; i += 1) {
+    REDGPU_2_EXPECTFL(output[i] == (gInput[0][i] + gInput[1][i]) * scale + gSalt[i]);
+  }
+
+  vfIdDestroy(1, &batch, FF, LL);
+}
+
+int main() {
+#if defined(_MSC_VER) && defined(_DEBUG)
+  _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
+#endif
+
+  const unsigned array65536[1] = {65536};
+
+  gpu_handle_context_t ctx = vfContextInit(1, NULL, FF, LL);
+
+  TestData data = {0};
+  vfGpuThreadCreate(ctx, 1, &data.gpuThread, NULL, FF, LL);
+
+  gpu_storage_info_t storage_info = {0};
+  storage_info.storage_type = GPU_STORAGE_TYPE_CPU_UPLOAD;
+  storage_info.bytes_count  = 2 * 4*sizeof(float);
+  gpu_storage_t storage_input_cpu = {0};
+  vfStorageCreate(ctx, &storage_info, &storage_input_cpu, FF, LL);
+  storage_info.storage_type = GPU_STORAGE_TYPE_GPU_ONLY;
+  gpu_storage_t storage_input_gpu = {0};
+  vfStorageCreate(ctx, &storage_info, &storage_input_gpu, FF, LL);
+  storage_info.storage_type = GPU_STORAGE_TYPE_GPU_ONLY;
+  storage_info.bytes_count  = 1 * 4*sizeof(float);
+  gpu_storage_t storage_output_gpu = {0};
+  vfStorageCreate(ctx, &storage_info, &storage_output_gpu, FF, LL);
+  storage_info.storage_type = GPU_STORAGE_TYPE_CPU_READBACK;
+  vfStorageCreate(ctx, &storage_info, &data.storageOutputCpu, FF, LL);
+  data.storageInputGpu  = storage_input_gpu.id;
+  data.storageOutputGpu = storage_output_gpu.id;
+
+  red32MemoryCopy(storage_input_cpu.mapped_void_ptr, gInput, sizeof(gInput));
+  vfStorageCpuUploadFlush(ctx, storage_input_cpu.id, FF, LL);
+
+  uint64_t copy = vfBatchBegin(ctx, 0, NULL, NULL, FF, LL);
+  vfBatchStorageCopyFromCpuToGpu(ctx, copy, storage_input_cpu.id, storage_input_gpu.id, FF, LL);
+  vfBatchEnd(ctx, copy, FF, LL);
+  RedHandleCalls copyRaw = vfBatchGetRawHandle(ctx, copy, FF, LL);
+  vfAsyncWaitToFinish(ctx, vfAsyncBatchExecuteRaw(ctx, 1, &copyRaw, 1, &data.gpuThread, array65536, FF, LL), FF, LL);
+
+  #include "scale.cs.h"
+  gpu_program_info_t cs_info = {0};
+  cs_info.program_binary_bytes_count = sizeof(g_main);
+  cs_info.program_binary             = g_main;
+  uint64_t cs = vfProgramCreateFromBinaryCompute(ctx, &cs_info, FF, LL);
+
+  data.slots[0].slot            = 0;
+  data.slots[0].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+  data.slots[0].count           = 1;
+  data.slots[0].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+  data.slots[1].slot            = 1;
+  data.slots[1].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+  data.slots[1].count           = 1;
+  data.slots[1].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+  data.ppInfo.compute_program       = cs;
+  data.ppInfo.variables_slot        = 2;
+  data.ppInfo.variables_bytes_count = 1 * 4*sizeof(float);
+  data.ppInfo.struct_members_count  = countof(data.slots);
+  data.ppInfo.struct_members        = data.slots;
+
+  // NOTE(Constantine): Same scale, same id, two references. Another scale is another program pipeline.
+  uint64_t ppScale2  = CreateCachedScaled(ctx, &data, 2);
+  uint64_t ppScale2B = CreateCachedScaled(ctx, &data, 2);
+  uint64_t ppScale3  = CreateCachedScaled(ctx, &data, 3);
+  REDGPU_2_EXPECTFL(ppScale2 != 0 && ppScale3 != 0);
+  REDGPU_2_EXPECTFL(ppScale2B == ppScale2);
+  REDGPU_2_EXPECTFL(ppScale3 != ppScale2);
+  RunAndCheck(ctx, &data, ppScale2, 2);
+  RunAndCheck(ctx, &data, ppScale3, 3);
+
+  // NOTE(Constantine): One reference of scale 2 is left, so it must still be cached and usable.
+  vfProgramPipelineReleaseCached(ctx, ppScale2B, FF, LL);
+  REDGPU_2_EXPECTFL(CreateCachedScaled(ctx, &data, 2) == ppScale2);
+  RunAndCheck(ctx, &data, ppScale2, 2);
+
+  // NOTE(Constantine): More keys than the initial capacities of the cache and its hash index, every one of them created once and found once.
+  uint64_t ppMany[MANY_SCALES_COUNT] = {0};
+  for (int i = 0; i < MANY_SCALES_COUNT; i += 1) {
+    ppMany[i] = CreateCachedScaled(ctx, &data, (float)(10 + i));
+    REDGPU_2_EXPECTFL(ppMany[i] != ppScale2 && ppMany[i] != ppScale3);
+    for (int j = 0; j < i; j += 1) {
+      REDGPU_2_EXPECTFL(ppMany[i] != ppMany[j]);
+    }
+  }
+  for (int i = 0; i < MANY_SCALES_COUNT; i += 1) {
+    REDGPU_2_EXPECTFL(CreateCachedScaled(ctx, &data, (float)(10 + i)) == ppMany[i]);
+  }
+  REDGPU_2_EXPECTFL(CreateCachedScaled(ctx, &data, 3) == ppScale3);
+  RunAndCheck(ctx, &data, ppMany[MANY_SCALES_COUNT - 1], (float)(10 + MANY_SCALES_COUNT - 1));
+
+  // NOTE(Constantine): Every key is released as many times as it was returned, odd ones first to remove entries from the middle of the cache.
+  for (int i = 1; i < MANY_SCALES_COUNT; i += 2) {
+    vfProgramPipelineReleaseCached(ctx, ppMany[i], FF, LL);
+    vfProgramPipelineReleaseCached(ctx, ppMany[i], FF, LL);
+  }
+  for (int i = 0; i < MANY_SCALES_COUNT; i += 2) {
+    REDGPU_2_EXPECTFL(CreateCachedScaled(ctx, &data, (float)(10 + i)) == ppMany[i]);
+    vfProgramPipelineReleaseCached(ctx, ppMany[i], FF, LL);
+    vfProgramPipelineReleaseCached(ctx, ppMany[i], FF, LL);
+    vfProgramPipelineReleaseCached(ctx, ppMany[i], FF, LL);
+  }
+  RunAndCheck(ctx, &data, ppScale3, 3);
+  vfProgramPipelineReleaseCached(ctx, ppScale3, FF, LL);
+  vfProgramPipelineReleaseCached(ctx, ppScale3, FF, LL);
+  vfProgramPipelineReleaseCached(ctx, ppScale2, FF, LL);
+  vfProgramPipelineReleaseCached(ctx, ppScale2, FF, LL);
+
+  // NOTE(Constantine): Released keys are created again.
+  uint64_t ppScale5 = CreateCachedScaled(ctx, &data, 5);
+  RunAndCheck(ctx, &data, ppScale5, 5);
+  vfProgramPipelineReleaseCached(ctx, ppScale5, FF, LL);
+
+  uint64_t ids[] = {
+    copy,
+    cs,
+    storage_input_cpu.id,
+    storage_input_gpu.id,
+    storage_output_gpu.id,
+    data.storageOutputCpu.id,
+  };
+  vfIdDestroy(countof(ids), ids, FF, LL);
+  vfGpuThreadDestroy(ctx, data.gpuThread);
+  vfContextDeinit(ctx, FF, LL);
+
+  printf("Cached program pipelines test passed\n");
+}
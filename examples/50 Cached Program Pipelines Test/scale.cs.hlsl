@@ -0,0 +1,16 @@
+// dxc.exe scale.cs.hlsl -T cs_6_0 -Fh scale.cs.h -spirv
+
+[[vk::binding(0, 0)]] RWStructuredBuffer<float4> array0;
+[[vk::binding(1, 0)]] RWStructuredBuffer<float4> array1;
+
+struct Variables {
+  float4 salt;
+};
+[[vk::push_constant]] ConstantBuffer<Variables> variables;
+
+[[vk::constant_id(0)]] const float scale = 1.0;
+
+[numthreads(1, 1, 1)]
+void main(uint3 tid: SV_DispatchThreadId) {
+  array1[0] = (array0[0] + array0[1]) * scale + variables.salt;
+}
@@ -0,0 +1,198 @@
+//\\rc rawbuild begin gcc-linux-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `gcc`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c /home/linuxbrew/RedGpuSDK/redgpu.c /home/linuxbrew/RedGpuSDK/redgpu_2.c /home/linuxbrew/RedGpuSDK/redgpu_32.c -I/home/linuxbrew/.linuxbrew/include/ -I/home/linuxbrew/.linuxbrew/Cellar/xorgproto/2025.1/include/ -I/var/home/linuxbrew/.linuxbrew/Cellar/libxcb/1.17.0/include/ /home/linuxbrew/.linuxbrew/lib/libX11.so /home/linuxbrew/.linuxbrew/lib/libvulkan.so -lm`
+//\\rc rawbuild end
+
+//\\rc rawbuild begin clang-windows-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `clang`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c C:/RedGpuSDK/redgpu.c C:/RedGpuSDK/redgpu_2.c C:/RedGpuSDK/redgpu_32.c`
+//\\rc rawbuild end
+
+// NOTE(Constantine):
+// Tests the bindings sets cache of gpu_batch_info_t::use_bindings_sets_cache with the add kernel of example 00. One batch binds more
+// distinct sets than the first pool of the cache holds, so the cache must grow a second pool and miss once per set. The batch is then
+// recorded again with the same sets in reverse order and every set must be a hit that still binds its own output storage, while the
+// sets and pools counts stay the same. A set bound twice in one batch must be a hit the second time.
+// Usage: a.exe
+
+#include "../../vkfast.h"
+#include "../../vkfast_ex.h"
+#include "../Common/vkfast_examples_common.h"
+
+#define SETS_COUNT 100 // NOTE(Constantine): More than the 64 sets of the first pool of the cache.
+
+static const float gInput[2][4] = {
+  {4,  8, 15,  16},
+  {16, 23, 42, 108},
+};
+
+// NOTE(Constantine): Records one dispatch per output storage, each with its own bindings set and a salt of saltBase + i, and checks the outputs.
+static void RecordRunAndCheck(gpu_handle_context_t ctx, gpu_thread_t gpu_thread, uint64_t * batch, uint64_t pp, const RedStructDeclarationMember * slots, uint64_t storageInputGpu, const uint64_t * storagesOutputGpu, const gpu_storage_t * storagesOutputCpu, int reverse, float saltBase) {
+  const unsigned array65536[1] = {65536};
+
+  gpu_batch_info_t bindings_info = {0};
+  bindings_info.use_bindings_sets_cache = 1;
+  batch[0] = vfBatchBegin(ctx, batch[0], &bindings_info, NULL, FF, LL);
+  vfBatchBindProgramPipelineCompute(ctx, batch[0], pp, FF, LL);
+  for (int k = 0; k < SETS_COUNT; k += 1) {
+    const int i = reverse == 1 ? SETS_COUNT - 1 - k : k;
+    vfBatchBindNewBindingsSet(ctx, batch[0], 2, slots, FF, LL);
+    vfBatchBindStorageSingle(ctx, batch[0], 0, storageInputGpu, FF, LL);
+    vfBatchBindStorageSingle(ctx, batch[0], 1, storagesOutputGpu[i], FF, LL);
+    vfBatchBindNewBindingsEnd(ctx, batch[0], FF, LL);
+    const float salt[4] = {saltBase + i, saltBase + i, saltBase + i, saltBase + i};
+    vfBatchBindVariablesCopy(ctx, batch[0], 0, sizeof(salt), salt, FF, LL);
+    vfBatchCompute(ctx, batch[0], 1, 1, 1, FF, LL);
+  }
+  vfBatchBarrierMemory(ctx, batch[0], FF, LL);
+  for (int i = 0; i < SETS_COUNT; i += 1) {
+    vfBatchStorageCopyFromGpuToCpu(ctx, batch[0], storagesOutputGpu[i], storagesOutputCpu[i].id, FF, LL);
+  }
+  vfBatchBarrierCpuReadback(ctx, batch[0], FF, LL);
+  vfBatchEnd(ctx, batch[0], FF, LL);
+  RedHandleCalls batchRaw = vfBatchGetRawHandle(ctx, batch[0], FF, LL);
+  vfAsyncWaitToFinish(ctx, vfAsyncBatchExecuteRaw(ctx, 1, &batchRaw, 1, &gpu_thread, array65536, FF, LL), FF, LL);
+
+  for (int i = 0; i < SETS_COUNT; i += 1) {
+    vfStorageCpuReadbackInvalidate(ctx, storagesOutputCpu[i].id, FF, LL);
+    const float * output = (const float *)storagesOutputCpu[i].mapped_void_ptr;
+    for (int j = 0; j < 4; j += 1) {
+      REDGPU_2_EXPECTFL(output[j] == gInput[0][j] + gInput[1][j] + saltBase + i);
+    }
+  }
+}
+
+int main() {
+#if defined(_MSC_VER) && defined(_DEBUG)
+  _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
+#endif
+
+  const unsigned array65536[1] = {65536};
+
+  gpu_handle_context_t ctx = vfContextInit(1, NULL, FF, LL);
+
+  gpu_thread_t gpu_thread = NULL;
+  vfGpuThreadCreate(ctx, 1, &gpu_thread, NULL, FF, LL);
+
+  gpu_storage_info_t storage_info = {0};
+  storage_info.storage_type = GPU_STORAGE_TYPE_CPU_UPLOAD;
+  storage_info.bytes_count  = 2 * 4*sizeof(float);
+  gpu_storage_t storage_input_cpu = {0};
+  vfStorageCreate(ctx, &storage_info, &storage_input_cpu, FF, LL);
+  storage_info.storage_type = GPU_STORAGE_TYPE_GPU_ONLY;
+  gpu_storage_t storage_input_gpu = {0};
+  vfStorageCreate(ctx, &storage_info, &storage_input_gpu, FF, LL);
+
+  uint64_t      storages_output_gpu[SETS_COUNT] = {0};
+  gpu_storage_t storages_output_cpu[SETS_COUNT] = {0};
+  for (int i = 0; i < SETS_COUNT; i += 1) {
+    storage_info.storage_type = GPU_STORAGE_TYPE_GPU_ONLY;
+    storage_info.bytes_count  = 1 * 4*sizeof(float);
+    gpu_storage_t storage_output_gpu = {0};
+    vfStorageCreate(ctx, &storage_info, &storage_output_gpu, FF, LL);
+    storages_output_gpu[i] = storage_output_gpu.id;
+    storage_info.storage_type = GPU_STORAGE_TYPE_CPU_READBACK;
+    vfStorageCreate(ctx, &storage_info, &storages_output_cpu[i], FF, LL);
+  }
+
+  red32MemoryCopy(storage_input_cpu.mapped_void_ptr, gInput, sizeof(gInput));
+  vfStorageCpuUploadFlush(ctx, storage_input_cpu.id, FF, LL);
+
+  uint64_t copy = vfBatchBegin(ctx, 0, NULL, NULL, FF, LL);
+  vfBatchStorageCopyFromCpuToGpu(ctx, copy, storage_input_cpu.id, storage_input_gpu.id, FF, LL);
+  vfBatchEnd(ctx, copy, FF, LL);
+  RedHandleCalls copyRaw = vfBatchGetRawHandle(ctx, copy, FF, LL);
+  vfAsyncWaitToFinish(ctx, vfAsyncBatchExecuteRaw(ctx, 1, &copyRaw, 1, &gpu_thread, array65536, FF, LL), FF, LL);
+
+  #include "add.cs.h"
+  gpu_program_info_t cs_info = {0};
+  cs_info.program_binary_bytes_count = sizeof(g_main);
+  cs_info.program_binary             = g_main;
+  uint64_t cs = vfProgramCreateFromBinaryCompute(ctx, &cs_info, FF, LL);
+
+  RedStructDeclarationMember slots[2] = {0};
+  slots[0].slot            = 0;
+  slots[0].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+  slots[0].count           = 1;
+  slots[0].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+  slots[1].slot            = 1;
+  slots[1].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+  slots[1].count           = 1;
+  slots[1].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+  gpu_program_pipeline_compute_info_t pp_info = {0};
+  pp_info.compute_program       = cs;
+  pp_info.variables_slot        = 2;
+  pp_info.variables_bytes_count = 1 * 4*sizeof(float);
+  pp_info.struct_members_count  = countof(slots);
+  pp_info.struct_members        = slots;
+  uint64_t pp = vfProgramPipelineCreateCompute(ctx, &pp_info, FF, LL);
+
+  gpu_bindings_sets_cache_stats_t stats = {0};
+  vfContextGetBindingsSetsCacheStats(ctx, &stats, FF, LL);
+  REDGPU_2_EXPECTFL(stats.sets_count == 0 && stats.pools_count == 0 && stats.hits_count == 0 && stats.misses_count == 0);
+
+  // NOTE(Constantine): Every set is new, the first pool runs out and a second one twice as large is added.
+  uint64_t batch = 0;
+  RecordRunAndCheck(ctx, gpu_thread, &batch, pp, slots, storage_input_gpu.id, storages_output_gpu, storages_output_cpu, 0, 0);
+  vfContextGetBindingsSetsCacheStats(ctx, &stats, FF, LL);
+  printf("After the first recording: %llu sets, %llu pools of %llu sets, %llu hits, %llu misses\n", (unsigned long long)stats.sets_count, (unsigned long long)stats.pools_count, (unsigned long long)stats.pools_max_sets_count, (unsigned long long)stats.hits_count, (unsigned long long)stats.misses_count);
+  REDGPU_2_EXPECTFL(stats.sets_count == SETS_COUNT);
+  REDGPU_2_EXPECTFL(stats.misses_count == SETS_COUNT);
+  REDGPU_2_EXPECTFL(stats.hits_count == 0);
+  REDGPU_2_EXPECTFL(stats.pools_count == 2);
+  REDGPU_2_EXPECTFL(stats.pools_max_sets_count == 64 + 128);
+  REDGPU_2_EXPECTFL(stats.pool_resets_count == 0);
+
+  // NOTE(Constantine): Same sets in reverse order, all of them are found in the cache and bind the right output storages.
+  RecordRunAndCheck(ctx, gpu_thread, &batch, pp, slots, storage_input_gpu.id, storages_output_gpu, storages_output_cpu, 1, 1000);
+  vfContextGetBindingsSetsCacheStats(ctx, &stats, FF, LL);
+  printf("After the second recording: %llu sets, %llu pools of %llu sets, %llu hits, %llu misses\n", (unsigned long long)stats.sets_count, (unsigned long long)stats.pools_count, (unsigned long long)stats.pools_max_sets_count, (unsigned long long)stats.hits_count, (unsigned long long)stats.misses_count);
+  REDGPU_2_EXPECTFL(stats.sets_count == SETS_COUNT);
+  REDGPU_2_EXPECTFL(stats.misses_count == SETS_COUNT);
+  REDGPU_2_EXPECTFL(stats.hits_count == SETS_COUNT);
+  REDGPU_2_EXPECTFL(stats.pools_count == 2);
+  REDGPU_2_EXPECTFL(stats.pool_resets_count == 0);
+
+  // NOTE(Constantine): A new set bound twice in the same batch, a miss and then a hit.
+  {
+    gpu_batch_info_t bindings_info = {0};
+    bindings_info.use_bindings_sets_cache = 1;
+    batch = vfBatchBegin(ctx, batch, &bindings_info, NULL, FF, LL);
+    vfBatchBindProgramPipelineCompute(ctx, batch, pp, FF, LL);
+    for (int i = 0; i < 2; i += 1) {
+      vfBatchBindNewBindingsSet(ctx, batch, countof(slots), slots, FF, LL);
+      vfBatchBindStorageSingle(ctx, batch, 0, storages_output_gpu[0], FF, LL);
+      vfBatchBindStorageSingle(ctx, batch, 1, storages_output_gpu[1], FF, LL);
+      vfBatchBindNewBindingsEnd(ctx, batch, FF, LL);
+    }
+    vfBatchEnd(ctx, batch, FF, LL);
+  }
+  vfContextGetBindingsSetsCacheStats(ctx, &stats, FF, LL);
+  REDGPU_2_EXPECTFL(stats.sets_count == SETS_COUNT + 1);
+  REDGPU_2_EXPECTFL(stats.misses_count == SETS_COUNT + 1);
+  REDGPU_2_EXPECTFL(stats.hits_count == SETS_COUNT + 1);
+
+  uint64_t ids[] = {
+    batch,
+    copy,
+    pp,
+    cs,
+    storage_input_cpu.id,
+    storage_input_gpu.id,
+  };
+  vfIdDestroy(countof(ids), ids, FF, LL);
+  for (int i = 0; i < SETS_COUNT; i += 1) {
+    uint64_t outputIds[2] = {storages_output_gpu[i], storages_output_cpu[i].id};
+    vfIdDestroy(countof(outputIds), outputIds, FF, LL);
+  }
+  vfGpuThreadDestroy(ctx, gpu_thread);
+  vfContextDeinit(ctx, FF, LL);
+
+  printf("Bindings sets cache test passed\n");
+}
@@ -0,0 +1,285 @@
+//\\rc rawbuild begin gcc-linux-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `gcc`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c /home/linuxbrew/RedGpuSDK/redgpu.c /home/linuxbrew/RedGpuSDK/redgpu_2.c /home/linuxbrew/RedGpuSDK/redgpu_32.c -I/home/linuxbrew/.linuxbrew/include/ -I/home/linuxbrew/.linuxbrew/Cellar/xorgproto/2025.1/include/ -I/var/home/linuxbrew/.linuxbrew/Cellar/libxcb/1.17.0/include/ /home/linuxbrew/.linuxbrew/lib/libX11.so /home/linuxbrew/.linuxbrew/lib/libvulkan.so -lm`
+//\\rc rawbuild end
+
+//\\rc rawbuild begin clang-windows-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `clang`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c C:/RedGpuSDK/redgpu.c C:/RedGpuSDK/redgpu_2.c C:/RedGpuSDK/redgpu_32.c`
+//\\rc rawbuild end
+
+// NOTE(Constantine):
+// Round-trips storages of every type through vfContextCheckpoint() and vfContextRestore(), compressed and uncompressed. The compressed
+// checkpoint must have LZ4 chunks for the repetitive storages and raw chunks for the random one, and every LZ4 chunk must decode with the
+// small LZ4 block decoder below, independent of vkFast's, to the bytes that were checkpointed. Restored storages must have the same bytes.
+// Usage: a.exe
+
+#include "../../vkfast.h"
+#include "../../vkfast_ex.h"
+#include "../Common/vkfast_examples_common.h"
+
+#define CHECKPOINT_FILEPATH_LZ4 "vkfast_checkpoint_restore_test_lz4.vfck"
+#define CHECKPOINT_FILEPATH_RAW "vkfast_checkpoint_restore_test_raw.vfck"
+#define CHUNK_BYTES_COUNT       (256 * 1024)
+#define STORAGES_COUNT          4
+
+typedef struct TestStorage {
+  gpu_storage_type_t type;
+  uint64_t           bytesCount;
+  int                isRandom;
+  unsigned char *    expected;
+} TestStorage;
+
+// NOTE(Constantine): Slowly changing words compress well, xorshift bytes don't compress at all.
+static void Fill(unsigned char * bytes, uint64_t bytesCount, int isRandom, uint64_t seed) {
+  uint64_t state = seed * 2654435761ULL + 1;
+  for (uint64_t i = 0; i < bytesCount; i += 1) {
+    if (isRandom == 1) {
+      state ^= state << 13;
+      state ^= state >> 7;
+      state ^= state << 17;
+      bytes[i] = (unsigned char)(state >> 24);
+    } else {
+      bytes[i] = (unsigned char)((i / 64 + seed) >> (8 * (i % 4)));
+    }
+  }
+}
+
+// NOTE(Constantine): Plain LZ4 block decoder, returns 1 if src decodes to exactly dstCount bytes.
+static int Lz4DecodeBlock(const unsigned char * src, uint64_t srcCount, unsigned char * dst, uint64_t dstCount) {
+  uint64_t i = 0;
+  uint64_t o = 0;
+  for (;;) {
+    if (i >= srcCount) {
+      return 0;
+    }
+    const unsigned token = src[i++];
+    uint64_t length = token >> 4;
+    if (length == 15) {
+      unsigned byte = 255;
+      while (byte == 255 && i < srcCount) {
+        byte = src[i++];
+        length += byte;
+      }
+    }
+    if (i + length > srcCount || o + length > dstCount) {
+      return 0;
+    }
+    memcpy(&dst[o], &src[i], length);
+    i += length;
+    o += length;
+    if (i == srcCount) {
+      return o == dstCount ? 1 : 0;
+    }
+    if (i + 2 > srcCount) {
+      return 0;
+    }
+    const uint64_t offset = src[i] | ((uint64_t)src[i + 1] << 8);
+    i += 2;
+    length = token & 15;
+    if (length == 15) {
+      unsigned byte = 255;
+      while (byte == 255 && i < srcCount) {
+        byte = src[i++];
+        length += byte;
+      }
+    }
+    length += 4;
+    if (offset == 0 || offset > o || o + length > dstCount) {
+      return 0;
+    }
+    for (uint64_t j = 0; j < length; j += 1) {
+      dst[o + j] = dst[o - offset + j];
+    }
+    o += length;
+  }
+}
+
+static unsigned char * ReadWholeFile(const char * filepath, uint64_t * outBytesCount) {
+  FILE * fh = fopen(filepath, "rb");
+  REDGPU_2_EXPECTFL(fh != NULL);
+  fseek(fh, 0, SEEK_END);
+  const uint64_t bytesCount = (uint64_t)ftell(fh);
+  fseek(fh, 0, SEEK_SET);
+  unsigned char * bytes = (unsigned char *)malloc(bytesCount);
+  REDGPU_2_EXPECTFL(bytes != NULL);
+  REDGPU_2_EXPECTFL(fread(bytes, 1, bytesCount, fh) == bytesCount);
+  fclose(fh);
+  outBytesCount[0] = bytesCount;
+  return bytes;
+}
+
+// NOTE(Constantine): Walks the chunks of a checkpoint file, decodes its LZ4 chunks and compares every chunk to the expected bytes.
+static void CheckFile(const char * filepath, const TestStorage * storages, uint64_t * outLz4ChunksCount, uint64_t * outRawChunksCount) {
+  uint64_t fileBytesCount = 0;
+  unsigned char * file = ReadWholeFile(filepath, &fileBytesCount);
+  unsigned char * decoded = (unsigned char *)malloc(CHUNK_BYTES_COUNT);
+  REDGPU_2_EXPECTFL(decoded != NULL);
+
+  gpu_checkpoint_file_header_t header = {0};
+  memcpy(&header, file, sizeof(header));
+  REDGPU_2_EXPECTFL(header.magic == GPU_CHECKPOINT_FILE_MAGIC && header.version == GPU_CHECKPOINT_FILE_VERSION);
+  REDGPU_2_EXPECTFL(header.storages_count == STORAGES_COUNT);
+  REDGPU_2_EXPECTFL(header.chunk_bytes_count == CHUNK_BYTES_COUNT);
+  uint64_t o = sizeof(header);
+  for (int i = 0; i < STORAGES_COUNT; i += 1) {
+    gpu_checkpoint_file_storage_t storage = {0};
+    memcpy(&storage, &file[o], sizeof(storage));
+    o += sizeof(storage);
+    REDGPU_2_EXPECTFL(storage.storage_type == (uint32_t)storages[i].type && storage.bytes_count == storages[i].bytesCount);
+  }
+
+  uint64_t lz4ChunksCount = 0;
+  uint64_t rawChunksCount = 0;
+  for (int i = 0; i < STORAGES_COUNT; i += 1) {
+    for (uint64_t bytesFirst = 0; bytesFirst < storages[i].bytesCount; bytesFirst += CHUNK_BYTES_COUNT) {
+      gpu_checkpoint_file_chunk_t chunk = {0};
+      REDGPU_2_EXPECTFL(o + sizeof(chunk) <= fileBytesCount);
+      memcpy(&chunk, &file[o], sizeof(chunk));
+      o += sizeof(chunk);
+      const uint64_t bytesCount = storages[i].bytesCount - bytesFirst < CHUNK_BYTES_COUNT ? storages[i].bytesCount - bytesFirst : CHUNK_BYTES_COUNT;
+      REDGPU_2_EXPECTFL(chunk.bytes_count == bytesCount);
+      REDGPU_2_EXPECTFL(o + chunk.stored_bytes_count <= fileBytesCount);
+      if (chunk.codec == GPU_CHECKPOINT_CODEC_LZ4) {
+        REDGPU_2_EXPECTFL(chunk.stored_bytes_count < chunk.bytes_count);
+        REDGPU_2_EXPECTFL(Lz4DecodeBlock(&file[o], chunk.stored_bytes_count, decoded, chunk.bytes_count) == 1);
+        REDGPU_2_EXPECTFL(memcmp(decoded, storages[i].expected + bytesFirst, bytesCount) == 0);
+        lz4ChunksCount += 1;
+      } else {
+        REDGPU_2_EXPECTFL(chunk.codec == GPU_CHECKPOINT_CODEC_RAW);
+        o += (GPU_CHECKPOINT_FILE_RAW_CHUNK_ALIGNMENT - o % GPU_CHECKPOINT_FILE_RAW_CHUNK_ALIGNMENT) % GPU_CHECKPOINT_FILE_RAW_CHUNK_ALIGNMENT;
+        REDGPU_2_EXPECTFL(chunk.stored_bytes_count == chunk.bytes_count);
+        REDGPU_2_EXPECTFL(memcmp(&file[o], storages[i].expected + bytesFirst, bytesCount) == 0);
+        rawChunksCount += 1;
+      }
+      o += chunk.stored_bytes_count;
+    }
+  }
+  REDGPU_2_EXPECTFL(o == fileBytesCount);
+
+  free(decoded);
+  free(file);
+  outLz4ChunksCount[0] = lz4ChunksCount;
+  outRawChunksCount[0] = rawChunksCount;
+}
+
+// NOTE(Constantine): Reads a storage back through a CPU readback storage if it's GPU only and compares it to the expected bytes.
+static void CheckStorage(gpu_handle_context_t ctx, gpu_thread_t gpu_thread, const gpu_storage_t * storage, const TestStorage * expected) {
+  const unsigned array65536[1] = {65536};
+
+  REDGPU_2_EXPECTFL(storage->info.storage_type == expected->type && storage->info.bytes_count == expected->bytesCount);
+  if (storage->info.storage_type == GPU_STORAGE_TYPE_CPU_READBACK) {
+    vfStorageCpuReadbackInvalidate(ctx, storage->id, FF, LL);
+  }
+  if (storage->info.storage_type != GPU_STORAGE_TYPE_GPU_ONLY) {
+    REDGPU_2_EXPECTFL(memcmp(storage->mapped_void_ptr, expected->expected, expected->bytesCount) == 0);
+    return;
+  }
+  gpu_storage_info_t storage_info = {0};
+  storage_info.storage_type = GPU_STORAGE_TYPE_CPU_READBACK;
+  storage_info.bytes_count  = expected->bytesCount;
+  gpu_storage_t readback = {0};
+  vfStorageCreate(ctx, &storage_info, &readback, FF, LL);
+  uint64_t batch = vfBatchBegin(ctx, 0, NULL, NULL, FF, LL);
+  vfBatchStorageCopyFromGpuToCpu(ctx, batch, storage->id, readback.id, FF, LL);
+  vfBatchBarrierCpuReadback(ctx, batch, FF, LL);
+  vfBatchEnd(ctx, batch, FF, LL);
+  RedHandleCalls batchRaw = vfBatchGetRawHandle(ctx, batch, FF, LL);
+  vfAsyncWaitToFinish(ctx, vfAsyncBatchExecuteRaw(ctx, 1, &batchRaw, 1, &gpu_thread, array65536, FF, LL), FF, LL);
+  vfStorageCpuReadbackInvalidate(ctx, readback.id, FF, LL);
+  REDGPU_2_EXPECTFL(memcmp(readback.mapped_void_ptr, expected->expected, expected->bytesCount) == 0);
+  uint64_t ids[] = {batch, readback.id};
+  vfIdDestroy(countof(ids), ids, FF, LL);
+}
+
+static void RestoreAndCheck(gpu_handle_context_t ctx, gpu_thread_t gpu_thread, const char * filepath, const TestStorage * storages) {
+  REDGPU_2_EXPECTFL(vfContextRestore(ctx, filepath, 0, NULL, FF, LL) == STORAGES_COUNT);
+  gpu_storage_t restored[STORAGES_COUNT] = {0};
+  REDGPU_2_EXPECTFL(vfContextRestore(ctx, filepath, STORAGES_COUNT, restored, FF, LL) == STORAGES_COUNT);
+  for (int i = 0; i < STORAGES_COUNT; i += 1) {
+    CheckStorage(ctx, gpu_thread, &restored[i], &storages[i]);
+  }
+  for (int i = 0; i < STORAGES_COUNT; i += 1) {
+    vfIdDestroy(1, &restored[i].id, FF, LL);
+  }
+}
+
+int main() {
+#if defined(_MSC_VER) && defined(_DEBUG)
+  _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
+#endif
+
+  const unsigned array65536[1] = {65536};
+
+  // NOTE(Constantine): The GPU only storage is checkpointed through the staging blocks, the readback one ends with a partial chunk.
+  TestStorage storages[STORAGES_COUNT] = {0};
+  storages[0].type = GPU_STORAGE_TYPE_CPU_UPLOAD;   storages[0].bytesCount = 4 * CHUNK_BYTES_COUNT; storages[0].isRandom = 0;
+  storages[1].type = GPU_STORAGE_TYPE_CPU_UPLOAD;   storages[1].bytesCount = CHUNK_BYTES_COUNT + 4096; storages[1].isRandom = 1;
+  storages[2].type = GPU_STORAGE_TYPE_GPU_ONLY;     storages[2].bytesCount = 4 * CHUNK_BYTES_COUNT; storages[2].isRandom = 0;
+  storages[3].type = GPU_STORAGE_TYPE_CPU_READBACK; storages[3].bytesCount = 2 * CHUNK_BYTES_COUNT + 4112; storages[3].isRandom = 0;
+  for (int i = 0; i < STORAGES_COUNT; i += 1) {
+    storages[i].expected = (unsigned char *)malloc(storages[i].bytesCount);
+    REDGPU_2_EXPECTFL(storages[i].expected != NULL);
+    Fill(storages[i].expected, storages[i].bytesCount, storages[i].isRandom, i == 2 ? 0 : (uint64_t)i); // NOTE(Constantine): The GPU only storage is a copy of storage 0.
+  }
+
+  gpu_handle_context_t ctx = vfContextInit(1, NULL, FF, LL);
+
+  gpu_thread_t gpu_thread = NULL;
+  vfGpuThreadCreate(ctx, 1, &gpu_thread, NULL, FF, LL);
+
+  gpu_storage_t created[STORAGES_COUNT] = {0};
+  for (int i = 0; i < STORAGES_COUNT; i += 1) {
+    gpu_storage_info_t storage_info = {0};
+    storage_info.storage_type = storages[i].type;
+    storage_info.bytes_count  = storages[i].bytesCount;
+    vfStorageCreate(ctx, &storage_info, &created[i], FF, LL);
+    if (storages[i].type != GPU_STORAGE_TYPE_GPU_ONLY) {
+      memcpy(created[i].mapped_void_ptr, storages[i].expected, storages[i].bytesCount);
+    }
+  }
+  vfStorageCpuUploadFlush(ctx, created[0].id, FF, LL);
+  vfStorageCpuUploadFlush(ctx, created[1].id, FF, LL);
+  uint64_t copy = vfBatchBegin(ctx, 0, NULL, NULL, FF, LL);
+  vfBatchStorageCopyFromCpuToGpu(ctx, copy, created[0].id, created[2].id, FF, LL);
+  vfBatchEnd(ctx, copy, FF, LL);
+  RedHandleCalls copyRaw = vfBatchGetRawHandle(ctx, copy, FF, LL);
+  vfAsyncWaitToFinish(ctx, vfAsyncBatchExecuteRaw(ctx, 1, &copyRaw, 1, &gpu_thread, array65536, FF, LL), FF, LL);
+  vfIdDestroy(1, &copy, FF, LL);
+
+  vfContextCheckpoint(ctx, CHECKPOINT_FILEPATH_LZ4, CHUNK_BYTES_COUNT, 1, FF, LL);
+  vfContextCheckpoint(ctx, CHECKPOINT_FILEPATH_RAW, CHUNK_BYTES_COUNT, 0, FF, LL);
+
+  uint64_t lz4ChunksCount = 0;
+  uint64_t rawChunksCount = 0;
+  CheckFile(CHECKPOINT_FILEPATH_LZ4, storages, &lz4ChunksCount, &rawChunksCount);
+  printf("Compressed checkpoint: %llu LZ4 chunks, %llu raw chunks\n", (unsigned long long)lz4ChunksCount, (unsigned long long)rawChunksCount);
+  REDGPU_2_EXPECTFL(lz4ChunksCount == 4 + 4 + 3);
+  REDGPU_2_EXPECTFL(rawChunksCount == 2);
+  CheckFile(CHECKPOINT_FILEPATH_RAW, storages, &lz4ChunksCount, &rawChunksCount);
+  REDGPU_2_EXPECTFL(lz4ChunksCount == 0);
+  REDGPU_2_EXPECTFL(rawChunksCount == 4 + 2 + 4 + 3);
+
+  // NOTE(Constantine): The checkpointed storages are destroyed first, so only the restored ones are checkpointed and checked.
+  for (int i = 0; i < STORAGES_COUNT; i += 1) {
+    vfIdDestroy(1, &created[i].id, FF, LL);
+  }
+  RestoreAndCheck(ctx, gpu_thread, CHECKPOINT_FILEPATH_LZ4, storages);
+  RestoreAndCheck(ctx, gpu_thread, CHECKPOINT_FILEPATH_RAW, storages);
+
+  vfGpuThreadDestroy(ctx, gpu_thread);
+  vfContextDeinit(ctx, FF, LL);
+
+  for (int i = 0; i < STORAGES_COUNT; i += 1) {
+    free(storages[i].expected);
+  }
+  remove(CHECKPOINT_FILEPATH_LZ4);
+  remove(CHECKPOINT_FILEPATH_RAW);
+  printf("Checkpoint restore test passed\n");
+}
@@ -0,0 +1,176 @@
+//\\rc rawbuild begin gcc-linux-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `gcc`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c /home/linuxbrew/RedGpuSDK/redgpu.c /home/linuxbrew/RedGpuSDK/redgpu_2.c /home/linuxbrew/RedGpuSDK/redgpu_32.c -I/home/linuxbrew/.linuxbrew/include/ -I/home/linuxbrew/.linuxbrew/Cellar/xorgproto/2025.1/include/ -I/var/home/linuxbrew/.linuxbrew/Cellar/libxcb/1.17.0/include/ /home/linuxbrew/.linuxbrew/lib/libX11.so /home/linuxbrew/.linuxbrew/lib/libvulkan.so -lm`
+//\\rc rawbuild end
+
+//\\rc rawbuild begin clang-windows-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `clang`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c C:/RedGpuSDK/redgpu.c C:/RedGpuSDK/redgpu_2.c C:/RedGpuSDK/redgpu_32.c`
+//\\rc rawbuild end
+
+// NOTE(Constantine):
+// Decodes synthetic GPU printf rings with vfeGpuPrintfDecode() on the CPU, without a GPU, and checks every formatted record: conversions
+// with flags, width and precision, missing args, unknown format ids, and that decoding stops at the end marker of a dropped record, at
+// the cursor, at a record cut by the capacity and at the end of the copied bytes, so stale records past them are never read.
+// Usage: a.exe
+
+#include "../../vkfast.h"
+#include "../../extra/GPU Printf/vkfast_extra_gpu_printf.h"
+#include "../Common/vkfast_examples_common.h"
+
+#define RING_WORDS_COUNT 64
+
+typedef struct Decoded {
+  unsigned count;
+  char     texts[16][128];
+} Decoded;
+
+static void Collect(const char * text, void * userData) {
+  Decoded * decoded = (Decoded *)userData;
+  REDGPU_2_EXPECTFL(decoded->count < countof(decoded->texts));
+  snprintf(decoded->texts[decoded->count], sizeof(decoded->texts[0]), "%s", text);
+  decoded->count += 1;
+}
+
+static uint32_t AsUint(float value) {
+  uint32_t u = 0;
+  memcpy(&u, &value, sizeof(u));
+  return u;
+}
+
+// NOTE(Constantine): Appends a record the way vfPrintf() of vkfast_extra_gpu_printf.hlsl does, words[0] is the cursor.
+static void Append(uint32_t * words, unsigned formatId, unsigned argsCount, const uint32_t * args) {
+  uint32_t * records = &words[GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT / sizeof(uint32_t)];
+  records[words[0]] = (formatId << 4) | argsCount;
+  for (unsigned i = 0; i < argsCount; i += 1) {
+    records[words[0] + 1 + i] = args[i];
+  }
+  words[0] += 1 + argsCount;
+}
+
+static void ResetRing(uint32_t * words) {
+  // NOTE(Constantine): Records past the cursor are stale, filled with records that must never be decoded.
+  for (unsigned i = 0; i < RING_WORDS_COUNT; i += 1) {
+    words[i] = 3 << 4;
+  }
+  words[0] = 0;
+  words[1] = RING_WORDS_COUNT - GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT / sizeof(uint32_t);
+  words[2] = 0;
+  words[3] = 0;
+}
+
+static void Expect(const Decoded * decoded, unsigned count, const char * const * texts) {
+  for (unsigned i = 0; i < decoded->count; i += 1) {
+    printf("  %u: %s", i, decoded->texts[i]);
+  }
+  REDGPU_2_EXPECTFL(decoded->count == count);
+  for (unsigned i = 0; i < count; i += 1) {
+    REDGPU_2_EXPECTFL(strcmp(decoded->texts[i], texts[i]) == 0);
+  }
+}
+
+int main() {
+#if defined(_MSC_VER) && defined(_DEBUG)
+  _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
+#endif
+
+  const char * formats[] = {
+    "thread %u: %f\n",
+    "%5d|%-4x|%08.3f|%c|%%|%o\n",
+    "no args\n",
+    "stale record\n",
+    "%lu %lld %hX\n",
+  };
+  const uint64_t ringBytesCount = RING_WORDS_COUNT * sizeof(uint32_t);
+  uint32_t ring[RING_WORDS_COUNT];
+
+  printf("Conversions, missing args and unknown format ids:\n");
+  {
+    ResetRing(ring);
+    const uint32_t args0[2] = {7, AsUint(1.5f)};
+    const uint32_t args1[5] = {(uint32_t)-42, 255, AsUint(3.14159f), 'A', 8};
+    const uint32_t args4[3] = {5, 0xFFFFFFFF, 0xBEEF};
+    Append(ring, 0, countof(args0), args0);
+    Append(ring, 1, countof(args1), args1);
+    Append(ring, 2, 0, NULL);
+    Append(ring, 1, 1, args1);
+    Append(ring, 99, 1, args0);
+    Append(ring, 4, countof(args4), args4);
+    const char * expected[] = {
+      "thread 7: 1.500000\n",
+      "  -42|ff  |0003.142|A|%|10\n",
+      "no args\n",
+      "  -42|(missing)|(missing)|(missing)|%|(missing)\n",
+      "[vkFast][GPU printf] Unknown format id 99\n",
+      "5 -1 BEEF\n",
+    };
+    Decoded decoded = {0};
+    REDGPU_2_EXPECTFL(vfeGpuPrintfDecode(countof(formats), formats, ring, ringBytesCount, Collect, &decoded) == countof(expected));
+    Expect(&decoded, countof(expected), expected);
+  }
+
+  printf("A dropped record's end marker before the cursor:\n");
+  {
+    ResetRing(ring);
+    const uint32_t args0[2] = {1, AsUint(-2.0f)};
+    Append(ring, 0, countof(args0), args0);
+    ring[GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT / sizeof(uint32_t) + ring[0]] = 0xFFFFFFFF;
+    ring[0] += 1 + 8;
+    ring[2] = 1;
+    const char * expected[] = {
+      "thread 1: -2.000000\n",
+    };
+    Decoded decoded = {0};
+    REDGPU_2_EXPECTFL(vfeGpuPrintfDecode(countof(formats), formats, ring, ringBytesCount, Collect, &decoded) == countof(expected));
+    Expect(&decoded, countof(expected), expected);
+  }
+
+  printf("A cursor past the capacity and a record cut by it:\n");
+  {
+    ResetRing(ring);
+    const uint32_t args1[5] = {1, 2, 0, 'B', 64};
+    while (ring[0] + 6 + 6 <= ring[1]) {
+      Append(ring, 1, countof(args1), args1);
+    }
+    // NOTE(Constantine): The last record claims 8 args with fewer words left before the capacity, it's incomplete and not decoded.
+    const unsigned recordsCount = ring[0] / 6;
+    ring[GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT / sizeof(uint32_t) + ring[0]] = (2 << 4) | 8;
+    ring[0] = ring[1] + 100;
+    Decoded decoded = {0};
+    REDGPU_2_EXPECTFL(vfeGpuPrintfDecode(countof(formats), formats, ring, ringBytesCount, Collect, &decoded) == recordsCount);
+    REDGPU_2_EXPECTFL(decoded.count == recordsCount);
+    for (unsigned i = 0; i < recordsCount; i += 1) {
+      REDGPU_2_EXPECTFL(strcmp(decoded.texts[i], "    1|2   |0000.000|B|%|100\n") == 0);
+    }
+    printf("  %u records\n", recordsCount);
+  }
+
+  printf("Fewer copied bytes than the cursor:\n");
+  {
+    ResetRing(ring);
+    const uint32_t args0[2] = {3, AsUint(0.25f)};
+    Append(ring, 0, countof(args0), args0);
+    Append(ring, 0, countof(args0), args0);
+    Append(ring, 0, countof(args0), args0);
+    const char * expected[] = {
+      "thread 3: 0.250000\n",
+      "thread 3: 0.250000\n",
+    };
+    Decoded decoded = {0};
+    // NOTE(Constantine): Only the header and 7 record words are copied, the third record is cut and must not be decoded.
+    REDGPU_2_EXPECTFL(vfeGpuPrintfDecode(countof(formats), formats, ring, GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT + 7 * sizeof(uint32_t), Collect, &decoded) == countof(expected));
+    Expect(&decoded, countof(expected), expected);
+    Decoded none = {0};
+    REDGPU_2_EXPECTFL(vfeGpuPrintfDecode(countof(formats), formats, ring, GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT, Collect, &none) == 0);
+    REDGPU_2_EXPECTFL(vfeGpuPrintfDecode(countof(formats), formats, ring, 0, Collect, &none) == 0);
+    REDGPU_2_EXPECTFL(none.count == 0);
+  }
+
+  printf("GPU printf decode test passed\n");
+}
@@ -0,0 +1,355 @@
+//\\rc rawbuild begin gcc-linux-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `gcc`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c /home/linuxbrew/RedGpuSDK/redgpu.c /home/linuxbrew/RedGpuSDK/redgpu_2.c /home/linuxbrew/RedGpuSDK/redgpu_32.c -I/home/linuxbrew/.linuxbrew/include/ -I/home/linuxbrew/.linuxbrew/Cellar/xorgproto/2025.1/include/ -I/var/home/linuxbrew/.linuxbrew/Cellar/libxcb/1.17.0/include/ /home/linuxbrew/.linuxbrew/lib/libX11.so /home/linuxbrew/.linuxbrew/lib/libvulkan.so -lm`
+//\\rc rawbuild end
+
+//\\rc rawbuild begin clang-windows-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `clang`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c C:/RedGpuSDK/redgpu.c C:/RedGpuSDK/redgpu_2.c C:/RedGpuSDK/redgpu_32.c`
+//\\rc rawbuild end
+
+// NOTE(Constantine):
+// Compiles task graph schedules with vfeTaskGraphScheduleCompile(), which makes no GPU calls, and checks them without a GPU: RAW, WAR
+// and WAW hazards get a barrier or a signal and reads after reads get none, one barrier covers every earlier pass of its queue, diamonds
+// across queues, GPU_EXTRA_TASK_GRAPH_QUEUE_AUTO, and storages used in a cycle by passes that ping-pong between queues, which must still
+// give an acyclic schedule where every signal goes from an earlier submission to a later one. Random graphs are checked the same way.
+// vfeTaskGraphScheduleMatches() must reject other passes even if their hash is forged to collide with the schedule's.
+// Usage: a.exe [random_graphs_count]
+
+#include "../../vkfast.h"
+#include "../../extra/Task Graph/vkfast_extra_task_graph.h"
+#include "../Common/vkfast_examples_common.h"
+
+#define PASSES_MAX          24
+#define PASS_STORAGES_MAX   3
+
+#define X 1
+#define Y 2
+#define Z 3
+#define W 4
+
+typedef struct TestGraph {
+  unsigned                    passesCount;
+  gpu_extra_task_graph_pass_t passes[PASSES_MAX];
+  uint64_t                    inputs[PASSES_MAX][PASS_STORAGES_MAX];
+  uint64_t                    outputs[PASSES_MAX][PASS_STORAGES_MAX];
+} TestGraph;
+
+static void AddPass(TestGraph * graph, unsigned queue, unsigned inputsCount, const uint64_t * inputs, unsigned outputsCount, const uint64_t * outputs) {
+  const unsigned i = graph->passesCount;
+  REDGPU_2_EXPECTFL(i < PASSES_MAX && inputsCount <= PASS_STORAGES_MAX && outputsCount <= PASS_STORAGES_MAX);
+  for (unsigned j = 0; j < inputsCount; j += 1)  { graph->inputs[i][j]  = inputs[j];  }
+  for (unsigned j = 0; j < outputsCount; j += 1) { graph->outputs[i][j] = outputs[j]; }
+  gpu_extra_task_graph_pass_t pass = {0};
+  pass.queue_index           = queue;
+  pass.input_storages_count  = inputsCount;
+  pass.input_storages        = graph->inputs[i];
+  pass.output_storages_count = outputsCount;
+  pass.output_storages       = graph->outputs[i];
+  graph->passes[i] = pass;
+  graph->passesCount += 1;
+}
+
+static int Uses(unsigned count, const uint64_t * storages, uint64_t storage) {
+  for (unsigned i = 0; i < count; i += 1) {
+    if (storages[i] == storage) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// NOTE(Constantine): The hazards, written out independently of the task graph extra: pass b after pass a must wait for a if either
+// writes a storage the other one reads or writes.
+static int DependsOn(const gpu_extra_task_graph_pass_t * b, const gpu_extra_task_graph_pass_t * a) {
+  for (unsigned i = 0; i < b->input_storages_count; i += 1) {
+    if (Uses(a->output_storages_count, a->output_storages, b->input_storages[i]) == 1) { return 1; }
+  }
+  for (unsigned i = 0; i < b->output_storages_count; i += 1) {
+    if (Uses(a->input_storages_count,  a->input_storages,  b->output_storages[i]) == 1) { return 1; }
+    if (Uses(a->output_storages_count, a->output_storages, b->output_storages[i]) == 1) { return 1; }
+  }
+  return 0;
+}
+
+static int HasSignal(const gpu_extra_task_graph_schedule_t * schedule, unsigned from, unsigned to) {
+  for (unsigned i = 0; i < schedule->signals_count; i += 1) {
+    if (schedule->signal_from_submission[i] == from && schedule->signal_to_submission[i] == to) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// NOTE(Constantine): Returns 1 if a barrier is recorded before a pass of queue in (first, last], which orders the passes after it after first.
+static int HasBarrierBetween(const gpu_extra_task_graph_schedule_t * schedule, unsigned queue, unsigned first, unsigned last) {
+  for (unsigned k = first + 1; k <= last; k += 1) {
+    if (schedule->pass_queue_index[k] == queue && schedule->pass_barrier_before[k] == 1) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static void Validate(const TestGraph * graph, unsigned queuesCount, const gpu_extra_task_graph_schedule_t * schedule) {
+  const unsigned passesCount      = graph->passesCount;
+  const unsigned submissionsCount = schedule->submissions_count;
+  REDGPU_2_EXPECTFL(schedule->passes_count == passesCount);
+  REDGPU_2_EXPECTFL(schedule->hash == vfeTaskGraphHash(passesCount, graph->passes));
+  REDGPU_2_EXPECTFL(submissionsCount > 0 && submissionsCount <= passesCount);
+
+  // NOTE(Constantine): Submissions are the maximal runs of consecutive passes on one queue, in program order.
+  unsigned next = 0;
+  for (unsigned s = 0; s < submissionsCount; s += 1) {
+    REDGPU_2_EXPECTFL(schedule->submission_passes_first[s] == next && schedule->submission_passes_count[s] > 0);
+    REDGPU_2_EXPECTFL(schedule->submission_queue_index[s] < queuesCount);
+    REDGPU_2_EXPECTFL(s == 0 || schedule->submission_queue_index[s] != schedule->submission_queue_index[s - 1]);
+    for (unsigned k = 0; k < schedule->submission_passes_count[s]; k += 1) {
+      REDGPU_2_EXPECTFL(schedule->pass_submission_index[next + k] == s);
+      REDGPU_2_EXPECTFL(schedule->pass_queue_index[next + k] == schedule->submission_queue_index[s]);
+    }
+    next += schedule->submission_passes_count[s];
+  }
+  REDGPU_2_EXPECTFL(next == passesCount);
+  for (unsigned i = 0; i < passesCount; i += 1) {
+    REDGPU_2_EXPECTFL(graph->passes[i].queue_index == GPU_EXTRA_TASK_GRAPH_QUEUE_AUTO || graph->passes[i].queue_index == schedule->pass_queue_index[i]);
+  }
+
+  // NOTE(Constantine): Every signal goes from an earlier submission to a later one on another queue, so the schedule can't deadlock.
+  const unsigned joinQueue = schedule->submission_queue_index[submissionsCount - 1];
+  for (unsigned i = 0; i < schedule->signals_count; i += 1) {
+    const unsigned from = schedule->signal_from_submission[i];
+    const unsigned to   = schedule->signal_to_submission[i];
+    REDGPU_2_EXPECTFL(from < to && to <= submissionsCount);
+    REDGPU_2_EXPECTFL(schedule->submission_queue_index[from] != (to == submissionsCount ? joinQueue : schedule->submission_queue_index[to]));
+    for (unsigned j = 0; j < i; j += 1) {
+      REDGPU_2_EXPECTFL(schedule->signal_from_submission[j] != from || schedule->signal_to_submission[j] != to);
+    }
+    // NOTE(Constantine): No signal without a hazard between its submissions, except for the join.
+    if (to < submissionsCount) {
+      int isNeeded = 0;
+      for (unsigned b = schedule->submission_passes_first[to]; b < schedule->submission_passes_first[to] + schedule->submission_passes_count[to]; b += 1) {
+        for (unsigned a = schedule->submission_passes_first[from]; a < schedule->submission_passes_first[from] + schedule->submission_passes_count[from]; a += 1) {
+          isNeeded |= DependsOn(&graph->passes[b], &graph->passes[a]);
+        }
+      }
+      REDGPU_2_EXPECTFL(isNeeded == 1);
+    }
+  }
+
+  // NOTE(Constantine): Every hazard is covered, by a barrier on the same queue or by a signal between the two submissions.
+  for (unsigned i = 0; i < passesCount; i += 1) {
+    int isBarrierNeeded = 0;
+    for (unsigned j = 0; j < i; j += 1) {
+      if (DependsOn(&graph->passes[i], &graph->passes[j]) == 0) {
+        continue;
+      }
+      const unsigned queue = schedule->pass_queue_index[i];
+      if (schedule->pass_queue_index[j] == queue) {
+        REDGPU_2_EXPECTFL(HasBarrierBetween(schedule, queue, j, i) == 1);
+        isBarrierNeeded |= HasBarrierBetween(schedule, queue, j, i - 1) == 0 ? 1 : 0;
+      } else {
+        REDGPU_2_EXPECTFL(HasSignal(schedule, schedule->pass_submission_index[j], schedule->pass_submission_index[i]) == 1);
+      }
+    }
+    // NOTE(Constantine): And a barrier is only recorded where an earlier barrier doesn't already cover the hazard.
+    REDGPU_2_EXPECTFL(schedule->pass_barrier_before[i] == (unsigned)isBarrierNeeded);
+  }
+
+  // NOTE(Constantine): The join waits for the last submission of every other queue.
+  for (unsigned q = 0; q < queuesCount; q += 1) {
+    for (unsigned s = submissionsCount; s > 0; s -= 1) {
+      if (schedule->submission_queue_index[s - 1] == q) {
+        REDGPU_2_EXPECTFL(q == joinQueue || HasSignal(schedule, s - 1, submissionsCount) == 1);
+        break;
+      }
+    }
+  }
+}
+
+static void Compile(const TestGraph * graph, unsigned queuesCount, gpu_extra_task_graph_schedule_t * outSchedule) {
+  vfeTaskGraphScheduleCompile(graph->passesCount, graph->passes, queuesCount, outSchedule);
+  Validate(graph, queuesCount, outSchedule);
+}
+
+static void ExpectArray(unsigned count, const unsigned * values, const unsigned * expected) {
+  for (unsigned i = 0; i < count; i += 1) {
+    REDGPU_2_EXPECTFL(values[i] == expected[i]);
+  }
+}
+
+static uint64_t Random(uint64_t * state) {
+  state[0] ^= state[0] << 13;
+  state[0] ^= state[0] >> 7;
+  state[0] ^= state[0] << 17;
+  return state[0];
+}
+
+int main(int argc, char ** argv) {
+#if defined(_MSC_VER) && defined(_DEBUG)
+  _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
+#endif
+
+  const unsigned randomGraphsCount = argc > 1 ? (unsigned)atoi(argv[1]) : 10000;
+
+  const uint64_t x[1]    = {X};
+  const uint64_t y[1]    = {Y};
+  const uint64_t z[1]    = {Z};
+  const uint64_t w[1]    = {W};
+  const uint64_t yz[2]   = {Y, Z};
+
+  printf("Hazards on one queue:\n");
+  {
+    // NOTE(Constantine): RAW, WAR, WAW, a read after read and an independent pass, each pair on its own storage.
+    const uint64_t a[1] = {5};
+    const uint64_t b[1] = {6};
+    TestGraph graph = {0};
+    AddPass(&graph, 0, 0, NULL, 1, x); AddPass(&graph, 0, 1, x, 0, NULL);
+    AddPass(&graph, 0, 1, y, 0, NULL); AddPass(&graph, 0, 0, NULL, 1, y);
+    AddPass(&graph, 0, 0, NULL, 1, z); AddPass(&graph, 0, 0, NULL, 1, z);
+    AddPass(&graph, 0, 1, a, 0, NULL); AddPass(&graph, 0, 1, a, 0, NULL);
+    AddPass(&graph, 0, 1, b, 1, w);
+    gpu_extra_task_graph_schedule_t schedule = {0};
+    Compile(&graph, 1, &schedule);
+    const unsigned barriers[9] = {0, 1, 0, 1, 0, 1, 0, 0, 0};
+    ExpectArray(9, schedule.pass_barrier_before, barriers);
+    REDGPU_2_EXPECTFL(schedule.submissions_count == 1 && schedule.signals_count == 0);
+    vfeTaskGraphScheduleFree(&schedule);
+    printf("  ok\n");
+  }
+
+  printf("One barrier for several earlier passes:\n");
+  {
+    TestGraph graph = {0};
+    AddPass(&graph, 0, 0, NULL, 1, x);
+    AddPass(&graph, 0, 0, NULL, 1, y);
+    AddPass(&graph, 0, 1, x, 0, NULL);
+    AddPass(&graph, 0, 1, y, 0, NULL);
+    gpu_extra_task_graph_schedule_t schedule = {0};
+    Compile(&graph, 1, &schedule);
+    const unsigned barriers[4] = {0, 0, 1, 0};
+    ExpectArray(4, schedule.pass_barrier_before, barriers);
+    vfeTaskGraphScheduleFree(&schedule);
+    printf("  ok\n");
+  }
+
+  printf("A diamond across two queues:\n");
+  {
+    TestGraph graph = {0};
+    AddPass(&graph, 0, 0, NULL, 1, x);
+    AddPass(&graph, 1, 1, x, 1, y);
+    AddPass(&graph, 0, 1, x, 1, z);
+    AddPass(&graph, 0, 2, yz, 1, w);
+    gpu_extra_task_graph_schedule_t schedule = {0};
+    Compile(&graph, 2, &schedule);
+    const unsigned submissions[4] = {0, 1, 2, 2};
+    const unsigned barriers[4]    = {0, 0, 1, 1};
+    ExpectArray(4, schedule.pass_submission_index, submissions);
+    ExpectArray(4, schedule.pass_barrier_before, barriers);
+    REDGPU_2_EXPECTFL(schedule.submissions_count == 3 && schedule.signals_count == 3);
+    REDGPU_2_EXPECTFL(HasSignal(&schedule, 0, 1) == 1 && HasSignal(&schedule, 1, 2) == 1 && HasSignal(&schedule, 1, 3) == 1);
+    vfeTaskGraphScheduleFree(&schedule);
+    printf("  ok\n");
+  }
+
+  printf("A diamond with GPU_EXTRA_TASK_GRAPH_QUEUE_AUTO:\n");
+  {
+    TestGraph graph = {0};
+    AddPass(&graph, 1, 0, NULL, 1, x);
+    AddPass(&graph, GPU_EXTRA_TASK_GRAPH_QUEUE_AUTO, 1, x, 1, y);
+    AddPass(&graph, 0, 1, x, 1, z);
+    AddPass(&graph, GPU_EXTRA_TASK_GRAPH_QUEUE_AUTO, 2, yz, 1, w);
+    AddPass(&graph, GPU_EXTRA_TASK_GRAPH_QUEUE_AUTO, 0, NULL, 0, NULL);
+    gpu_extra_task_graph_schedule_t schedule = {0};
+    Compile(&graph, 2, &schedule);
+    // NOTE(Constantine): The last pass depends on nothing, it runs on queue 0.
+    const unsigned queues[5]   = {1, 1, 0, 0, 0};
+    const unsigned barriers[5] = {0, 1, 0, 1, 0};
+    ExpectArray(5, schedule.pass_queue_index, queues);
+    ExpectArray(5, schedule.pass_barrier_before, barriers);
+    REDGPU_2_EXPECTFL(schedule.submissions_count == 2 && schedule.signals_count == 2);
+    REDGPU_2_EXPECTFL(HasSignal(&schedule, 0, 1) == 1 && HasSignal(&schedule, 0, 2) == 1);
+    vfeTaskGraphScheduleFree(&schedule);
+    printf("  ok\n");
+  }
+
+  printf("Storages used in a cycle by passes that ping-pong between queues:\n");
+  {
+    TestGraph graph = {0};
+    AddPass(&graph, 0, 1, x, 1, y);
+    AddPass(&graph, 1, 1, y, 1, x);
+    AddPass(&graph, 0, 1, x, 1, y);
+    AddPass(&graph, 1, 1, y, 1, x);
+    AddPass(&graph, 1, 1, x, 1, x); // NOTE(Constantine): Reads and writes the same storage, in place.
+    AddPass(&graph, 1, 1, x, 1, x);
+    gpu_extra_task_graph_schedule_t schedule = {0};
+    Compile(&graph, 2, &schedule);
+    const unsigned submissions[6] = {0, 1, 2, 3, 3, 3};
+    const unsigned barriers[6]    = {0, 0, 1, 1, 1, 1};
+    ExpectArray(6, schedule.pass_submission_index, submissions);
+    ExpectArray(6, schedule.pass_barrier_before, barriers);
+    REDGPU_2_EXPECTFL(schedule.submissions_count == 4 && schedule.signals_count == 5);
+    REDGPU_2_EXPECTFL(HasSignal(&schedule, 0, 1) == 1 && HasSignal(&schedule, 1, 2) == 1 && HasSignal(&schedule, 0, 3) == 1 && HasSignal(&schedule, 2, 3) == 1 && HasSignal(&schedule, 2, 4) == 1);
+    vfeTaskGraphScheduleFree(&schedule);
+    printf("  ok\n");
+  }
+
+  printf("Schedules are reused only for the passes they were compiled for:\n");
+  {
+    TestGraph graph = {0};
+    AddPass(&graph, 0, 1, x, 1, y);
+    AddPass(&graph, 1, 1, y, 1, z);
+    TestGraph other = {0};
+    AddPass(&other, 0, 1, x, 1, y);
+    AddPass(&other, 1, 1, y, 1, w);
+    gpu_extra_task_graph_schedule_t schedule = {0};
+    Compile(&graph, 2, &schedule);
+    REDGPU_2_EXPECTFL(vfeTaskGraphScheduleMatches(&schedule, graph.passesCount, graph.passes) == 1);
+    REDGPU_2_EXPECTFL(vfeTaskGraphScheduleMatches(&schedule, other.passesCount, other.passes) == 0);
+    REDGPU_2_EXPECTFL(vfeTaskGraphScheduleMatches(&schedule, 1, graph.passes) == 0);
+    // NOTE(Constantine): A hash collision is forged by giving the schedule the hash of the other passes, the key must still tell them apart.
+    schedule.hash = vfeTaskGraphHash(other.passesCount, other.passes);
+    REDGPU_2_EXPECTFL(vfeTaskGraphScheduleMatches(&schedule, other.passesCount, other.passes) == 0);
+    vfeTaskGraphScheduleFree(&schedule);
+    printf("  ok\n");
+  }
+
+  printf("%u random graphs:\n", randomGraphsCount);
+  {
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    uint64_t signalsCount = 0;
+    uint64_t barriersCount = 0;
+    for (unsigned g = 0; g < randomGraphsCount; g += 1) {
+      const unsigned queuesCount   = 1 + (unsigned)(Random(&state) % 3);
+      const unsigned storagesCount = 1 + (unsigned)(Random(&state) % 6);
+      TestGraph graph = {0};
+      const unsigned passesCount = 1 + (unsigned)(Random(&state) % PASSES_MAX);
+      for (unsigned i = 0; i < passesCount; i += 1) {
+        uint64_t inputs[PASS_STORAGES_MAX]  = {0};
+        uint64_t outputs[PASS_STORAGES_MAX] = {0};
+        const unsigned inputsCount  = (unsigned)(Random(&state) % (PASS_STORAGES_MAX + 1));
+        const unsigned outputsCount = (unsigned)(Random(&state) % (PASS_STORAGES_MAX + 1));
+        for (unsigned j = 0; j < inputsCount; j += 1)  { inputs[j]  = 1 + Random(&state) % storagesCount; }
+        for (unsigned j = 0; j < outputsCount; j += 1) { outputs[j] = 1 + Random(&state) % storagesCount; }
+        const unsigned queue = Random(&state) % 4 == 0 ? GPU_EXTRA_TASK_GRAPH_QUEUE_AUTO : (unsigned)(Random(&state) % queuesCount);
+        AddPass(&graph, queue, inputsCount, inputs, outputsCount, outputs);
+      }
+      gpu_extra_task_graph_schedule_t schedule = {0};
+      Compile(&graph, queuesCount, &schedule);
+      signalsCount += schedule.signals_count;
+      for (unsigned i = 0; i < passesCount; i += 1) {
+        barriersCount += schedule.pass_barrier_before[i];
+      }
+      vfeTaskGraphScheduleFree(&schedule);
+    }
+    printf("  ok, %llu signals and %llu barriers\n", (unsigned long long)signalsCount, (unsigned long long)barriersCount);
+  }
+
+  printf("Task graph schedule test passed\n");
+}
@@ -0,0 +1,236 @@
+//\\rc rawbuild begin gcc-linux-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `gcc`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c /home/linuxbrew/RedGpuSDK/redgpu.c /home/linuxbrew/RedGpuSDK/redgpu_2.c /home/linuxbrew/RedGpuSDK/redgpu_32.c -I/home/linuxbrew/.linuxbrew/include/ -I/home/linuxbrew/.linuxbrew/Cellar/xorgproto/2025.1/include/ -I/var/home/linuxbrew/.linuxbrew/Cellar/libxcb/1.17.0/include/ /home/linuxbrew/.linuxbrew/lib/libX11.so /home/linuxbrew/.linuxbrew/lib/libvulkan.so -lm`
+//\\rc rawbuild end
+
+//\\rc rawbuild begin clang-windows-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `clang`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c C:/RedGpuSDK/redgpu.c C:/RedGpuSDK/redgpu_2.c C:/RedGpuSDK/redgpu_32.c`
+//\\rc rawbuild end
+
+// NOTE(Constantine):
+// NOTE(Constantine):
+// Tests vfProgramPipelineTuneCompute() with a kernel whose local size x and y are specialization constants and whose z is fixed to 1, over a
+// 1000x3 dispatch that no candidate local size divides. Every valid candidate is tuned alone first and must compute the same results as a C
+// reference, then all of them are tuned together with two candidates that must be rejected: one whose z differs from the fixed one and one
+// over the GPU limits. The kernel writes the local size it was specialized with past the results, so every tuned program pipeline is also
+// checked to be specialized with the local size the tuner returned.
+// Usage: a.exe [gpu_index]
+
+#include "../../vkfast.h"
+#include "../../vkfast_ex.h"
+#include "../Common/vkfast_examples_common.h"
+
+#define WIDTH                  1000
+#define HEIGHT                 3
+#define VALID_CANDIDATES_COUNT 4
+
+static const unsigned gCandidates[] = {
+  64,   1,    1,
+  16,   4,    1,
+  8,    8,    1,
+  256,  1,    1,
+  8,    8,    2, // NOTE(Constantine): z is not specialized and differs from the first candidate, must be rejected.
+  1024, 1024, 1, // NOTE(Constantine): Over maxComputeWorkGroupInvocations of every GPU, must be rejected.
+};
+
+typedef struct Variables {
+  unsigned width;
+  unsigned height;
+  float    salt;
+} Variables;
+
+typedef struct TestData {
+  gpu_thread_t                        gpuThread;
+  uint64_t                            storageInputGpu;
+  uint64_t                            storageOutputPoisonCpu;
+  uint64_t                            storageOutputGpu;
+  gpu_storage_t                       storageOutputCpu;
+  RedStructDeclarationMember          slots[2];
+  gpu_program_pipeline_compute_info_t ppInfo;
+  gpu_batch_info_t                    bindingsInfo;
+  Variables                           variables;
+  float                               input[WIDTH * HEIGHT];
+} TestData;
+
+static void TuneBind(gpu_handle_context_t ctx, uint64_t batch, void * user_data) {
+  const TestData * data = (const TestData *)user_data;
+  vfBatchBindNewBindingsSet(ctx, batch, countof(data->slots), data->slots, FF, LL);
+  vfBatchBindStorageSingle(ctx, batch, 0, data->storageInputGpu, FF, LL);
+  vfBatchBindStorageSingle(ctx, batch, 1, data->storageOutputGpu, FF, LL);
+  vfBatchBindNewBindingsEnd(ctx, batch, FF, LL);
+  vfBatchBindVariablesCopy(ctx, batch, 0, sizeof(data->variables), &data->variables, FF, LL);
+}
+
+// NOTE(Constantine): Tunes key over the candidates, checks that the picked local size is one of the valid ones, runs the tuned program
+// pipeline once and checks its results and the local size it was specialized with.
+static void TuneAndCheck(gpu_handle_context_t ctx, TestData * data, const char * key, unsigned candidatesCount, const unsigned * candidates, RedBool32 expectFromCache) {
+  const unsigned array65536[1] = {65536};
+
+  gpu_program_pipeline_tune_compute_info_t tune_info = {0};
+  tune_info.tuning_key                    = key;
+  tune_info.program_pipeline_compute_info = &data->ppInfo;
+  tune_info.local_size_constant_ids[0]    = 0;
+  tune_info.local_size_constant_ids[1]    = 1;
+  tune_info.local_size_constant_ids[2]    = GPU_TUNE_LOCAL_SIZE_NOT_SPECIALIZED;
+  tune_info.candidates_count              = candidatesCount;
+  tune_info.candidates_local_sizes        = candidates;
+  tune_info.invocations_count[0]          = WIDTH;
+  tune_info.invocations_count[1]          = HEIGHT;
+  tune_info.invocations_count[2]          = 1;
+  tune_info.batch_info                    = &data->bindingsInfo;
+  tune_info.bind_callback                 = TuneBind;
+  tune_info.bind_callback_user_data       = data;
+  tune_info.samples_count                 = 5;
+  gpu_program_pipeline_tune_compute_result_t result = {0};
+  vfProgramPipelineTuneCompute(ctx, &tune_info, &result, FF, LL);
+
+  printf("Tuned %s: local size %ux%ux%u, workgroups %ux%ux%u, from cache %u, %s median %llu ns\n", key, result.local_size[0], result.local_size[1], result.local_size[2], result.workgroups_count[0], result.workgroups_count[1], result.workgroups_count[2], result.is_from_cache, result.is_gpu_timed == 1 ? "GPU timestamps" : "CPU", (unsigned long long)result.median_nanoseconds);
+  REDGPU_2_EXPECTFL(result.is_from_cache == expectFromCache);
+  RedBool32 isCandidate = 0;
+  for (unsigned c = 0; c < candidatesCount && c < VALID_CANDIDATES_COUNT; c += 1) {
+    if (result.local_size[0] == candidates[c * 3 + 0] && result.local_size[1] == candidates[c * 3 + 1] && result.local_size[2] == candidates[c * 3 + 2]) {
+      isCandidate = 1;
+    }
+  }
+  REDGPU_2_EXPECTFL(isCandidate == 1);
+  for (unsigned i = 0; i < 3; i += 1) {
+    REDGPU_2_EXPECTFL(result.workgroups_count[i] == (tune_info.invocations_count[i] + result.local_size[i] - 1) / result.local_size[i]);
+  }
+
+  // NOTE(Constantine): Poisoning the output with NaNs so results left over from a previous run can't pass.
+  uint64_t batch = vfBatchBegin(ctx, 0, &data->bindingsInfo, NULL, FF, LL);
+  vfBatchStorageCopyFromCpuToGpu(ctx, batch, data->storageOutputPoisonCpu, data->storageOutputGpu, FF, LL);
+  vfBatchBarrierMemory(ctx, batch, FF, LL);
+  vfBatchBindProgramPipelineCompute(ctx, batch, result.program_pipeline_compute, FF, LL);
+  TuneBind(ctx, batch, data);
+  vfBatchCompute(ctx, batch, result.workgroups_count[0], result.workgroups_count[1], result.workgroups_count[2], FF, LL);
+  vfBatchBarrierMemory(ctx, batch, FF, LL);
+  vfBatchStorageCopyFromGpuToCpu(ctx, batch, data->storageOutputGpu, data->storageOutputCpu.id, FF, LL);
+  vfBatchBarrierCpuReadback(ctx, batch, FF, LL);
+  vfBatchEnd(ctx, batch, FF, LL);
+  RedHandleCalls batchRaw = vfBatchGetRawHandle(ctx, batch, FF, LL);
+  vfAsyncWaitToFinish(ctx, vfAsyncBatchExecuteRaw(ctx, 1, &batchRaw, 1, &data->gpuThread, array65536, FF, LL), FF, LL);
+  vfStorageCpuReadbackInvalidate(ctx, data->storageOutputCpu.id, FF, LL);
+
+  const float * output = (const float *)data->storageOutputCpu.mapped_void_ptr;
+  for (unsigned i = 0; i < WIDTH * HEIGHT; i += 1) {
+    REDGPU_2_EXPECTFL(output[i] == data->input[i] * 2.0f + data->variables.salt);
+  }
+  REDGPU_2_EXPECTFL(output[WIDTH * HEIGHT] == (float)(result.local_size[0] * 10000 + result.local_size[1] * 100 + result.local_size[2]));
+
+  uint64_t ids[] = {
+    batch,
+    result.program_pipeline_compute,
+  };
+  vfIdDestroy(countof(ids), ids, FF, LL);
+}
+
+int main(int argc, char ** argv) {
+#if defined(_MSC_VER) && defined(_DEBUG)
+  _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
+#endif
+
+  const unsigned gpuIndex = argc >= 2 ? (unsigned)atoi(argv[1]) : 0;
+  const unsigned array65536[1] = {65536};
+
+  gpu_context_ex4_parameters_t ex4 = {0};
+  gpu_handle_context_t ctx = vfContextInitEx4(1, gpuIndex, NULL, NULL, NULL, &ex4, FF, LL);
+
+  // To free
+  TestData * data = (TestData *)calloc(1, sizeof(TestData));
+  REDGPU_2_EXPECTFL(data != NULL);
+  vfGpuThreadCreate(ctx, 1, &data->gpuThread, NULL, FF, LL);
+
+  gpu_storage_info_t storage_info = {0};
+  storage_info.storage_type = GPU_STORAGE_TYPE_CPU_UPLOAD;
+  storage_info.bytes_count  = WIDTH * HEIGHT * sizeof(float);
+  gpu_storage_t storage_input_cpu = {0};
+  vfStorageCreate(ctx, &storage_info, &storage_input_cpu, FF, LL);
+  storage_info.storage_type = GPU_STORAGE_TYPE_GPU_ONLY;
+  gpu_storage_t storage_input_gpu = {0};
+  vfStorageCreate(ctx, &storage_info, &storage_input_gpu, FF, LL);
+  storage_info.storage_type = GPU_STORAGE_TYPE_CPU_UPLOAD;
+  storage_info.bytes_count  = (WIDTH * HEIGHT + 1) * sizeof(float);
+  gpu_storage_t storage_output_poison_cpu = {0};
+  vfStorageCreate(ctx, &storage_info, &storage_output_poison_cpu, FF, LL);
+  storage_info.storage_type = GPU_STORAGE_TYPE_GPU_ONLY;
+  gpu_storage_t storage_output_gpu = {0};
+  vfStorageCreate(ctx, &storage_info, &storage_output_gpu, FF, LL);
+  storage_info.storage_type = GPU_STORAGE_TYPE_CPU_READBACK;
+  vfStorageCreate(ctx, &storage_info, &data->storageOutputCpu, FF, LL);
+  data->storageInputGpu        = storage_input_gpu.id;
+  data->storageOutputPoisonCpu = storage_output_poison_cpu.id;
+  data->storageOutputGpu       = storage_output_gpu.id;
+
+  for (unsigned i = 0; i < WIDTH * HEIGHT; i += 1) {
+    data->input[i] = (float)((int)(i % 97) - 48) * 0.25f;
+  }
+  data->variables.width  = WIDTH;
+  data->variables.height = HEIGHT;
+  data->variables.salt   = -7;
+  red32MemoryCopy(storage_input_cpu.mapped_void_ptr, data->input, sizeof(data->input));
+  vfStorageCpuUploadFlush(ctx, storage_input_cpu.id, FF, LL);
+  memset(storage_output_poison_cpu.mapped_void_ptr, 0xFF, storage_output_poison_cpu.info.bytes_count);
+  vfStorageCpuUploadFlush(ctx, storage_output_poison_cpu.id, FF, LL);
+
+  uint64_t copy = vfBatchBegin(ctx, 0, NULL, NULL, FF, LL);
+  vfBatchStorageCopyFromCpuToGpu(ctx, copy, storage_input_cpu.id, storage_input_gpu.id, FF, LL);
+  vfBatchEnd(ctx, copy, FF, LL);
+  RedHandleCalls copyRaw = vfBatchGetRawHandle(ctx, copy, FF, LL);
+  vfAsyncWaitToFinish(ctx, vfAsyncBatchExecuteRaw(ctx, 1, &copyRaw, 1, &data->gpuThread, array65536, FF, LL), FF, LL);
+
+  #include "spec_local_size.comp.h"
+  gpu_program_info_t cs_info = {0};
+  cs_info.program_binary_bytes_count = sizeof(g_main);
+  cs_info.program_binary             = g_main;
+  uint64_t cs = vfProgramCreateFromBinaryCompute(ctx, &cs_info, FF, LL);
+
+  data->slots[0].slot            = 0;
+  data->slots[0].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+  data->slots[0].count           = 1;
+  data->slots[0].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+  data->slots[1].slot            = 1;
+  data->slots[1].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+  data->slots[1].count           = 1;
+  data->slots[1].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+  data->ppInfo.compute_program       = cs;
+  data->ppInfo.variables_slot        = 2;
+  data->ppInfo.variables_bytes_count = sizeof(Variables);
+  data->ppInfo.struct_members_count  = countof(data->slots);
+  data->ppInfo.struct_members        = data->slots;
+  data->bindingsInfo.max_new_bindings_sets_count = 1;
+  data->bindingsInfo.max_storage_binds_count     = 2;
+
+  // NOTE(Constantine): Every valid candidate alone, so each of their program pipelines is run and checked.
+  for (unsigned c = 0; c < VALID_CANDIDATES_COUNT; c += 1) {
+    char key[64] = {0};
+    snprintf(key, sizeof(key), "spec_local_size_tuning_test_candidate_%u", c);
+    TuneAndCheck(ctx, data, key, 1, &gCandidates[c * 3], 0);
+  }
+  // NOTE(Constantine): All of them, the rejected ones must not be picked, the second time the local size is from the cache.
+  TuneAndCheck(ctx, data, "spec_local_size_tuning_test_all", countof(gCandidates) / 3, gCandidates, 0);
+  TuneAndCheck(ctx, data, "spec_local_size_tuning_test_all", countof(gCandidates) / 3, gCandidates, 1);
+
+  uint64_t ids[] = {
+    copy,
+    cs,
+    storage_input_cpu.id,
+    storage_input_gpu.id,
+    storage_output_poison_cpu.id,
+    storage_output_gpu.id,
+    data->storageOutputCpu.id,
+  };
+  vfIdDestroy(countof(ids), ids, FF, LL);
+  vfGpuThreadDestroy(ctx, data->gpuThread);
+  free(data);
+  vfContextDeinit(ctx, FF, LL);
+
+  printf("Spec local size tuning test passed\n");
+}
@@ -0,0 +1,67 @@
+// NOTE(Constantine): Hand-assembled from spec_local_size.comp, hence generator word 0. It was checked by decompiling it with SPIRV-Cross and
+// by interpreting it over every candidate local size of main.c against a reference. Configuring cmake-bazzite-steamos/CMakeLists.txt with
+// glslangValidator on PATH replaces this file with the output of the glslangValidator command in spec_local_size.comp.
+	 #pragma once
+const uint32_t g_main[] = {
+	0x07230203,0x00010000,0x00000000,0x00000044,0x00000000,0x00020011,0x00000001,0x0006000b,
+	0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
+	0x0006000f,0x00000005,0x00000002,0x6e69616d,0x00000000,0x00000003,0x00060010,0x00000002,
+	0x00000011,0x00000001,0x00000001,0x00000001,0x00030003,0x00000002,0x000001c2,0x00040005,
+	0x00000002,0x6e69616d,0x00000000,0x00080005,0x00000003,0x475f6c67,0x61626f6c,0x766e496c,
+	0x7461636f,0x496e6f69,0x00000044,0x00050005,0x00000004,0x69726156,0x656c6261,0x00000073,
+	0x00050006,0x00000004,0x00000000,0x74646977,0x00000068,0x00050006,0x00000004,0x00000001,
+	0x67696568,0x00007468,0x00050006,0x00000004,0x00000002,0x746c6173,0x00000000,0x00050005,
+	0x00000005,0x69726176,0x656c6261,0x00000073,0x00040005,0x00000006,0x7074754f,0x00007475,
+	0x00050006,0x00000006,0x00000000,0x756c6176,0x00007365,0x00040005,0x00000007,0x61727261,
+	0x00003179,0x00040005,0x00000008,0x75706e49,0x00000074,0x00050006,0x00000008,0x00000000,
+	0x756c6176,0x00007365,0x00040005,0x00000009,0x61727261,0x00003079,0x00060005,0x0000000a,
+	0x61636f6c,0x69735f6c,0x785f657a,0x00000000,0x00060005,0x0000000b,0x61636f6c,0x69735f6c,
+	0x795f657a,0x00000000,0x00040047,0x00000003,0x0000000b,0x0000001c,0x00050048,0x00000004,
+	0x00000000,0x00000023,0x00000000,0x00050048,0x00000004,0x00000001,0x00000023,0x00000004,
+	0x00050048,0x00000004,0x00000002,0x00000023,0x00000008,0x00030047,0x00000004,0x00000002,
+	0x00040047,0x0000000c,0x00000006,0x00000004,0x00050048,0x00000006,0x00000000,0x00000023,
+	0x00000000,0x00030047,0x00000006,0x00000003,0x00040047,0x00000007,0x00000022,0x00000000,
+	0x00040047,0x00000007,0x00000021,0x00000001,0x00040048,0x00000008,0x00000000,0x00000018,
+	0x00050048,0x00000008,0x00000000,0x00000023,0x00000000,0x00030047,0x00000008,0x00000003,
+	0x00030047,0x00000009,0x00000018,0x00040047,0x00000009,0x00000022,0x00000000,0x00040047,
+	0x00000009,0x00000021,0x00000000,0x00040047,0x0000000a,0x00000001,0x00000000,0x00040047,
+	0x0000000b,0x00000001,0x00000001,0x00040047,0x0000000d,0x0000000b,0x00000019,0x00020013,
+	0x0000000e,0x00030021,0x0000000f,0x0000000e,0x00040015,0x00000010,0x00000020,0x00000000,
+	0x00040017,0x00000011,0x00000010,0x00000003,0x00040020,0x00000012,0x00000001,0x00000011,
+	0x0004003b,0x00000012,0x00000003,0x00000001,0x00020014,0x00000013,0x00030016,0x00000014,
+	0x00000020,0x0005001e,0x00000004,0x00000010,0x00000010,0x00000014,0x00040020,0x00000015,
+	0x00000009,0x00000004,0x0004003b,0x00000015,0x00000005,0x00000009,0x00040015,0x00000016,
+	0x00000020,0x00000001,0x0004002b,0x00000016,0x00000017,0x00000000,0x0004002b,0x00000016,
+	0x00000018,0x00000001,0x0004002b,0x00000016,0x00000019,0x00000002,0x00040020,0x0000001a,
+	0x00000009,0x00000010,0x00040020,0x0000001b,0x00000009,0x00000014,0x0003001d,0x0000000c,
+	0x00000014,0x0003001e,0x00000006,0x0000000c,0x00040020,0x0000001c,0x00000002,0x00000006,
+	0x0004003b,0x0000001c,0x00000007,0x00000002,0x0003001e,0x00000008,0x0000000c,0x00040020,
+	0x0000001d,0x00000002,0x00000008,0x0004003b,0x0000001d,0x00000009,0x00000002,0x00040020,
+	0x0000001e,0x00000002,0x00000014,0x0004002b,0x00000014,0x0000001f,0x40000000,0x0004002b,
+	0x00000010,0x00000020,0x00000000,0x0004002b,0x00000010,0x00000021,0x00000064,0x0004002b,
+	0x00000010,0x00000022,0x00002710,0x00040032,0x00000010,0x0000000a,0x00000001,0x00040032,
+	0x00000010,0x0000000b,0x00000001,0x0004002b,0x00000010,0x00000023,0x00000001,0x00060033,
+	0x00000011,0x0000000d,0x0000000a,0x0000000b,0x00000023,0x00050036,0x0000000e,0x00000002,
+	0x00000000,0x0000000f,0x000200f8,0x00000024,0x0004003d,0x00000011,0x00000025,0x00000003,
+	0x00050051,0x00000010,0x00000026,0x00000025,0x00000000,0x00050051,0x00000010,0x00000027,
+	0x00000025,0x00000001,0x00050041,0x0000001a,0x00000028,0x00000005,0x00000017,0x0004003d,
+	0x00000010,0x00000029,0x00000028,0x00050041,0x0000001a,0x0000002a,0x00000005,0x00000018,
+	0x0004003d,0x00000010,0x0000002b,0x0000002a,0x000500ae,0x00000013,0x0000002c,0x00000026,
+	0x00000029,0x000500ae,0x00000013,0x0000002d,0x00000027,0x0000002b,0x000500a6,0x00000013,
+	0x0000002e,0x0000002c,0x0000002d,0x000300f7,0x0000002f,0x00000000,0x000400fa,0x0000002e,
+	0x00000030,0x0000002f,0x000200f8,0x00000030,0x000100fd,0x000200f8,0x0000002f,0x00050084,
+	0x00000010,0x00000031,0x00000027,0x00000029,0x00050080,0x00000010,0x00000032,0x00000031,
+	0x00000026,0x00060041,0x0000001e,0x00000033,0x00000009,0x00000017,0x00000032,0x0004003d,
+	0x00000014,0x00000034,0x00000033,0x00050085,0x00000014,0x00000035,0x00000034,0x0000001f,
+	0x00050041,0x0000001b,0x00000036,0x00000005,0x00000019,0x0004003d,0x00000014,0x00000037,
+	0x00000036,0x00050081,0x00000014,0x00000038,0x00000035,0x00000037,0x00060041,0x0000001e,
+	0x00000039,0x00000007,0x00000017,0x00000032,0x0003003e,0x00000039,0x00000038,0x000500aa,
+	0x00000013,0x0000003a,0x00000032,0x00000020,0x000300f7,0x0000003b,0x00000000,0x000400fa,
+	0x0000003a,0x0000003c,0x0000003b,0x000200f8,0x0000003c,0x00050084,0x00000010,0x0000003d,
+	0x0000000a,0x00000022,0x00050084,0x00000010,0x0000003e,0x0000000b,0x00000021,0x00050080,
+	0x00000010,0x0000003f,0x0000003d,0x0000003e,0x00050080,0x00000010,0x00000040,0x0000003f,
+	0x00000023,0x00040070,0x00000014,0x00000041,0x00000040,0x00050084,0x00000010,0x00000042,
+	0x00000029,0x0000002b,0x00060041,0x0000001e,0x00000043,0x00000007,0x00000017,0x00000042,
+	0x0003003e,0x00000043,0x00000041,0x000200f9,0x0000003b,0x000200f8,0x0000003b,0x000100fd,
+	0x00010038
+};
@@ -0,0 +1,187 @@
+//\\rc rawbuild begin gcc-linux-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `gcc`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c "../../extra/GPU Printf/vkfast_extra_gpu_printf.c" /home/linuxbrew/RedGpuSDK/redgpu.c /home/linuxbrew/RedGpuSDK/redgpu_2.c /home/linuxbrew/RedGpuSDK/redgpu_32.c -I/home/linuxbrew/.linuxbrew/include/ -I/home/linuxbrew/.linuxbrew/Cellar/xorgproto/2025.1/include/ -I/var/home/linuxbrew/.linuxbrew/Cellar/libxcb/1.17.0/include/ /home/linuxbrew/.linuxbrew/lib/libX11.so /home/linuxbrew/.linuxbrew/lib/libvulkan.so -lm -lpthread`
+//\\rc rawbuild end
+
+//\\rc rawbuild begin clang-windows-64-bit
+//\\rc rawbuild require-config debug,release,release-fast
+//\\rc rawbuild `clang`
+//\\rc rawbuild debug ` -g -O0`
+//\\rc rawbuild release,release-fast ` -O2`
+//\\rc rawbuild ` main.c ../../vkfast.c "../../extra/GPU Printf/vkfast_extra_gpu_printf.c" C:/RedGpuSDK/redgpu.c C:/RedGpuSDK/redgpu_2.c C:/RedGpuSDK/redgpu_32.c`
+//\\rc rawbuild end
+
+// NOTE(Constantine):
+// Prints from a kernel with vfPrintf() of vkfast_extra_gpu_printf.hlsl: every thread of printf.cs.hlsl prints its id, the batch index
+// and half its id. Two batches get a ring each and are recorded before either ring is released, so both rings copy their records back
+// with their own copy batches, and every thread of both must be printed exactly once. Then a ring with room for 5 records must keep 5 and count the others as
+// dropped, twice in a row, since every batch resets the ring's cursor.
+// Usage: a.exe
+
+#include "../../vkfast.h"
+#include "../../extra/GPU Printf/vkfast_extra_gpu_printf.h"
+#include "../Common/vkfast_examples_common.h"
+
+#define THREADS_COUNT      256
+#define BATCHES_COUNT      2
+#define SMALL_RING_RECORDS 5
+
+typedef struct Printed {
+  unsigned recordsCount;
+  unsigned badRecordsCount;
+  unsigned counts[BATCHES_COUNT + 1][THREADS_COUNT];
+} Printed;
+
+// NOTE(Constantine): Called on the decoder thread, read by the main thread after vfeGpuPrintfFlush().
+static void Collect(const char * text, void * userData) {
+  Printed * printed = (Printed *)userData;
+  unsigned thread = 0;
+  unsigned batch  = 0;
+  float    half   = 0;
+  printed->recordsCount += 1;
+  if (sscanf(text, "thread %u of batch %u: %f", &thread, &batch, &half) != 3 || thread >= THREADS_COUNT || batch > BATCHES_COUNT || half != thread * 0.5f) {
+    printf("Bad record: %s\n", text);
+    printed->badRecordsCount += 1;
+    return;
+  }
+  printed->counts[batch][thread] += 1;
+}
+
+static uint64_t RecordBatch(gpu_handle_context_t ctx, gpu_extra_gpu_printf_t gpuPrintf, unsigned ring, uint64_t pp, RedStructDeclarationMember * slots, unsigned batchIndex) {
+  gpu_batch_info_t bindings_info = {0};
+  bindings_info.max_new_bindings_sets_count = 1;
+  bindings_info.max_storage_binds_count     = 1;
+  uint64_t batch = vfBatchBegin(ctx, 0, &bindings_info, NULL, FF, LL);
+  vfeGpuPrintfBatchRingBegin(gpuPrintf, ring, batch, FF, LL);
+  vfBatchBindProgramPipelineCompute(ctx, batch, pp, FF, LL);
+  vfBatchBindNewBindingsSet(ctx, batch, 1, slots, FF, LL);
+  vfBatchBindStorageSingle(ctx, batch, 0, vfeGpuPrintfRingGetStorage(gpuPrintf, ring).id, FF, LL);
+  vfBatchBindNewBindingsEnd(ctx, batch, FF, LL);
+  vfBatchBindVariablesCopy(ctx, batch, 0, sizeof(batchIndex), &batchIndex, FF, LL);
+  vfBatchCompute(ctx, batch, THREADS_COUNT / 64, 1, 1, FF, LL);
+  vfeGpuPrintfBatchRingEnd(gpuPrintf, ring, batch, FF, LL);
+  vfBatchEnd(ctx, batch, FF, LL);
+  return batch;
+}
+
+static void ExecuteAndWait(gpu_handle_context_t ctx, gpu_thread_t gpuThread, uint64_t batch) {
+  const unsigned array65536[1] = {65536};
+  RedHandleCalls batchRaw = vfBatchGetRawHandle(ctx, batch, FF, LL);
+  vfAsyncWaitToFinish(ctx, vfAsyncBatchExecuteRaw(ctx, 1, &batchRaw, 1, &gpuThread, array65536, FF, LL), FF, LL);
+}
+
+int main() {
+#if defined(_MSC_VER) && defined(_DEBUG)
+  _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
+#endif
+
+  gpu_handle_context_t ctx = vfContextInit(1, NULL, FF, LL);
+
+  gpu_thread_t gpuThread = 0;
+  vfGpuThreadCreate(ctx, 1, &gpuThread, NULL, FF, LL);
+
+  #include "printf.cs.h"
+  gpu_program_info_t cs_info = {0};
+  cs_info.program_binary_bytes_count = sizeof(g_main);
+  cs_info.program_binary             = g_main;
+  uint64_t cs = vfProgramCreateFromBinaryCompute(ctx, &cs_info, FF, LL);
+
+  RedStructDeclarationMember slots[1] = {0};
+  slots[0].slot            = 0;
+  slots[0].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+  slots[0].count           = 1;
+  slots[0].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+  gpu_program_pipeline_compute_info_t pp_info = {0};
+  pp_info.compute_program       = cs;
+  pp_info.variables_slot        = 1;
+  pp_info.variables_bytes_count = sizeof(unsigned);
+  pp_info.struct_members_count  = countof(slots);
+  pp_info.struct_members        = slots;
+  uint64_t pp = vfProgramPipelineCreateCompute(ctx, &pp_info, FF, LL);
+
+  const char * formats[1] = {"thread %u of batch %u: %.1f"};
+
+  Printed printed = {0};
+
+  // NOTE(Constantine): Both rings are acquired before either batch is released, each ring copies its records back with its own batch.
+  {
+    gpu_extra_gpu_printf_info_t info = {0};
+    info.rings_count                 = BATCHES_COUNT;
+    info.formats_count               = countof(formats);
+    info.formats                     = formats;
+    info.optional_callback           = Collect;
+    info.optional_callback_user_data = &printed;
+    gpu_extra_gpu_printf_t gpuPrintf = vfeGpuPrintfCreate(ctx, &info, FF, LL);
+
+    unsigned rings[BATCHES_COUNT]   = {0};
+    uint64_t batches[BATCHES_COUNT] = {0};
+    for (unsigned b = 0; b < BATCHES_COUNT; b += 1) {
+      rings[b]   = vfeGpuPrintfRingAcquire(gpuPrintf, FF, LL);
+      batches[b] = RecordBatch(ctx, gpuPrintf, rings[b], pp, slots, b);
+    }
+    REDGPU_2_EXPECTFL(rings[0] != rings[1]);
+    for (unsigned b = 0; b < BATCHES_COUNT; b += 1) {
+      ExecuteAndWait(ctx, gpuThread, batches[b]);
+    }
+    for (unsigned b = 0; b < BATCHES_COUNT; b += 1) {
+      vfeGpuPrintfRingRelease(gpuPrintf, rings[b], FF, LL);
+    }
+    vfeGpuPrintfFlush(gpuPrintf);
+
+    printf("Records: %u, dropped: %llu\n", printed.recordsCount, (unsigned long long)vfeGpuPrintfGetDroppedRecordsCount(gpuPrintf));
+    REDGPU_2_EXPECTFL(printed.recordsCount == BATCHES_COUNT * THREADS_COUNT);
+    REDGPU_2_EXPECTFL(printed.badRecordsCount == 0);
+    REDGPU_2_EXPECTFL(vfeGpuPrintfGetDroppedRecordsCount(gpuPrintf) == 0);
+    for (unsigned b = 0; b < BATCHES_COUNT; b += 1) {
+      for (unsigned t = 0; t < THREADS_COUNT; t += 1) {
+        REDGPU_2_EXPECTFL(printed.counts[b][t] == 1);
+      }
+    }
+
+    vfIdDestroy(countof(batches), batches, FF, LL);
+    vfeGpuPrintfDestroy(gpuPrintf, FF, LL);
+  }
+
+  // NOTE(Constantine): A record is its header word and 3 args, the ring has room for SMALL_RING_RECORDS of them.
+  {
+    memset(&printed, 0, sizeof(printed));
+
+    gpu_extra_gpu_printf_info_t info = {0};
+    info.rings_count                 = 1;
+    info.ring_bytes_count            = GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT + SMALL_RING_RECORDS * 4 * sizeof(uint32_t);
+    info.formats_count               = countof(formats);
+    info.formats                     = formats;
+    info.optional_callback           = Collect;
+    info.optional_callback_user_data = &printed;
+    gpu_extra_gpu_printf_t gpuPrintf = vfeGpuPrintfCreate(ctx, &info, FF, LL);
+
+    for (unsigned i = 0; i < 2; i += 1) {
+      const unsigned ring  = vfeGpuPrintfRingAcquire(gpuPrintf, FF, LL);
+      uint64_t       batch = RecordBatch(ctx, gpuPrintf, ring, pp, slots, BATCHES_COUNT);
+      ExecuteAndWait(ctx, gpuThread, batch);
+      vfeGpuPrintfRingRelease(gpuPrintf, ring, FF, LL);
+      vfeGpuPrintfFlush(gpuPrintf);
+      vfIdDestroy(1, &batch, FF, LL);
+
+      printf("Small ring, batch %u: records: %u, dropped: %llu\n", i, printed.recordsCount, (unsigned long long)vfeGpuPrintfGetDroppedRecordsCount(gpuPrintf));
+      REDGPU_2_EXPECTFL(printed.recordsCount == (i + 1) * SMALL_RING_RECORDS);
+      REDGPU_2_EXPECTFL(printed.badRecordsCount == 0);
+      REDGPU_2_EXPECTFL(vfeGpuPrintfGetDroppedRecordsCount(gpuPrintf) == (i + 1) * (THREADS_COUNT - SMALL_RING_RECORDS));
+    }
+
+    vfeGpuPrintfDestroy(gpuPrintf, FF, LL);
+  }
+
+  uint64_t ids[] = {
+    pp,
+    cs,
+  };
+  vfIdDestroy(countof(ids), ids, FF, LL);
+  vfGpuThreadDestroy(ctx, gpuThread);
+  vfContextDeinit(ctx, FF, LL);
+
+  printf("GPU printf kernel test passed\n");
+}
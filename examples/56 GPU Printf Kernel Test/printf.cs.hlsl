@@ -0,0 +1,16 @@
+// dxc.exe printf.cs.hlsl -T cs_6_0 -Fh printf.cs.h -spirv
+
+#include "../../extra/GPU Printf/vkfast_extra_gpu_printf.hlsl"
+
+[[vk::binding(0, 0)]] RWByteAddressBuffer printfRing;
+
+struct Variables {
+  uint batch;
+};
+[[vk::push_constant]] ConstantBuffer<Variables> variables;
+
+// NOTE(Constantine): formats[0] is "thread %u of batch %u: %.1f" on the CPU.
+[numthreads(64, 1, 1)]
+void main(uint3 tid: SV_DispatchThreadId) {
+  vfPrintf(printfRing, 0, tid.x, variables.batch, asuint(tid.x * 0.5));
+}
@@ -56,28 +56,47 @@ GPU_API_PRE gpu_handle_context_t GPU_API_POST vfeBanzaiAllocateExtraMemory(gpu_h
   return new_context;
 }
 
+// NOTE(Constantine): The free bytes of the current heap block of storageType, rounded down to the alignment vfStorageCreate() uses for it.
+static uint64_t vfeInternalBanzaiGetCurrentBlockFreeBytesCount(vf_handle_context_t * vkfast, gpu_storage_type_t storageType) {
+  RedArray array     = vkfast->memoryGpuVramForArrays_array;
+  uint64_t offset    = vkfast->memoryGpuVramForArrays_memory_suballocations_offset;
+  uint64_t alignment = vkfast->gpuInfo->minArrayRORWStructMemberRangeBytesAlignment;
+  if (storageType == GPU_STORAGE_TYPE_CPU_UPLOAD) {
+    array     = vkfast->memoryCpuUpload_array;
+    offset    = vkfast->memoryCpuUpload_memory_suballocations_offset;
+    alignment = vkfast->gpuInfo->minMemoryAllocateBytesAlignment;
+  } else if (storageType == GPU_STORAGE_TYPE_CPU_READBACK) {
+    array     = vkfast->memoryCpuReadback_array;
+    offset    = vkfast->memoryCpuReadback_memory_suballocations_offset;
+    alignment = vkfast->gpuInfo->minMemoryAllocateBytesAlignment;
+  }
+  if (array.handle == NULL) {
+    return 0;
+  }
+  offset += REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(offset, alignment);
+  if (offset >= array.memoryBytesCount) {
+    return 0;
+  }
+  const uint64_t bytesCount = array.memoryBytesCount - offset;
+  return bytesCount - (bytesCount % alignment);
+}
+
 GPU_API_PRE void GPU_API_POST vfeBanzaiStoragesCreate(gpu_handle_context_t context, gpu_storage_t * out_storage_id_gpu_only, gpu_storage_t * out_storage_id_cpu_upload, gpu_storage_t * out_storage_id_cpu_readback, const char * optionalFile, int optionalLine) {
   vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
 
-  if (out_storage_id_gpu_only != NULL && vkfast->memoryAllocationSizeGpuVram > 0) {
-    gpu_storage_info_t storage_info = {0};
-    storage_info.storage_type = GPU_STORAGE_TYPE_GPU_ONLY;
-    storage_info.bytes_count  = vkfast->memoryAllocationSizeGpuVram;
-    vfStorageCreate(context, &storage_info, out_storage_id_gpu_only, optionalFile, optionalLine);
-  }
-
-  if (out_storage_id_cpu_upload != NULL && vkfast->memoryAllocationSizeCpuUpload > 0) {
-    gpu_storage_info_t storage_info = {0};
-    storage_info.storage_type = GPU_STORAGE_TYPE_CPU_UPLOAD;
-    storage_info.bytes_count  = vkfast->memoryAllocationSizeCpuUpload;
-    vfStorageCreate(context, &storage_info, out_storage_id_cpu_upload, optionalFile, optionalLine);
-  }
+  gpu_storage_t * outStorages[4] = {NULL, out_storage_id_gpu_only, out_storage_id_cpu_upload, out_storage_id_cpu_readback};
 
-  if (out_storage_id_cpu_readback != NULL && vkfast->memoryAllocationSizeCpuReadback > 0) {
-    gpu_storage_info_t storage_info = {0};
-    storage_info.storage_type = GPU_STORAGE_TYPE_CPU_READBACK;
-    storage_info.bytes_count  = vkfast->memoryAllocationSizeCpuReadback;
-    vfStorageCreate(context, &storage_info, out_storage_id_cpu_readback, optionalFile, optionalLine);
+  for (int storageType = GPU_STORAGE_TYPE_GPU_ONLY; storageType <= GPU_STORAGE_TYPE_CPU_READBACK; storageType += 1) {
+    if (outStorages[storageType] == NULL) {
+      continue;
+    }
+    const uint64_t bytesCount = vfeInternalBanzaiGetCurrentBlockFreeBytesCount(vkfast, (gpu_storage_type_t)storageType);
+    if (bytesCount > 0) {
+      gpu_storage_info_t storage_info = {0};
+      storage_info.storage_type = (gpu_storage_type_t)storageType;
+      storage_info.bytes_count  = bytesCount;
+      vfStorageCreate(context, &storage_info, outStorages[storageType], optionalFile, optionalLine);
+    }
   }
 }
 
@@ -94,8 +113,8 @@ GPU_API_PRE void GPU_API_POST vfeBanzaiBatchStorageCopyFromCpuToGpu(gpu_handle_c
   REDGPU_2_EXPECTWG(to_gpu_storage->handle_id == VF_HANDLE_ID_STORAGE);
 
   RedCopyArrayRange range = {0};
-  range.arrayRBytesFirst  = from_cpu_storage_bytes_first;
-  range.arrayWBytesFirst  = to_gpu_storage_bytes_first;
+  range.arrayRBytesFirst  = from_cpu_storage->storage.arrayRangeInfo.arrayRangeBytesFirst + from_cpu_storage_bytes_first;
+  range.arrayWBytesFirst  = to_gpu_storage->storage.arrayRangeInfo.arrayRangeBytesFirst + to_gpu_storage_bytes_first;
   range.bytesCount        = bytes_count;
   npfp(redCallCopyArrayToArray, batch->batch.addresses.redCallCopyArrayToArray,
     "calls", batch->batch.calls.handle,
@@ -119,8 +138,8 @@ GPU_API_PRE void GPU_API_POST vfeBanzaiBatchStorageCopyFromGpuToCpu(gpu_handle_c
   REDGPU_2_EXPECTWG(to_cpu_storage->handle_id == VF_HANDLE_ID_STORAGE);
 
   RedCopyArrayRange range = {0};
-  range.arrayRBytesFirst  = from_gpu_storage_bytes_first;
-  range.arrayWBytesFirst  = to_cpu_storage_bytes_first;
+  range.arrayRBytesFirst  = from_gpu_storage->storage.arrayRangeInfo.arrayRangeBytesFirst + from_gpu_storage_bytes_first;
+  range.arrayWBytesFirst  = to_cpu_storage->storage.arrayRangeInfo.arrayRangeBytesFirst + to_cpu_storage_bytes_first;
   range.bytesCount        = bytes_count;
   npfp(redCallCopyArrayToArray, batch->batch.addresses.redCallCopyArrayToArray,
     "calls", batch->batch.calls.handle,
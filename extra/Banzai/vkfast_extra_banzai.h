@@ -6,8 +6,8 @@
 extern "C" {
 #endif
 
-GPU_API_PRE gpu_handle_context_t GPU_API_POST vfeBanzaiAllocateExtraMemory(gpu_handle_context_t derive_from_context, gpu_internal_memory_allocation_sizes_t * memory_allocation_sizes, const char * optional_file, int optional_line);
-GPU_API_PRE void GPU_API_POST vfeBanzaiStoragesCreate(gpu_handle_context_t context, gpu_storage_t * out_storage_id_gpu_only, gpu_storage_t * out_storage_id_cpu_upload, gpu_storage_t * out_storage_id_cpu_readback, const char * optional_file, int optional_line);
+GPU_API_PRE gpu_handle_context_t GPU_API_POST vfeBanzaiAllocateExtraMemory(gpu_handle_context_t derive_from_context, gpu_internal_memory_allocation_sizes_t * memory_allocation_sizes, const char * optional_file, int optional_line); // NOTE(Constantine): Deprecated, the derived context must be deinited first. Use vfContextHeapsAppendBlocks() to add memory to the same context.
+GPU_API_PRE void GPU_API_POST vfeBanzaiStoragesCreate(gpu_handle_context_t context, gpu_storage_t * out_storage_id_gpu_only, gpu_storage_t * out_storage_id_cpu_upload, gpu_storage_t * out_storage_id_cpu_readback, const char * optional_file, int optional_line); // NOTE(Constantine): Each storage takes the free rest of the current block of its heap, a heap without free bytes leaves its storage untouched.
 GPU_API_PRE void GPU_API_POST vfeBanzaiBatchStorageCopyFromCpuToGpu(gpu_handle_context_t context, uint64_t batch_id, uint64_t from_cpu_storage_id, uint64_t to_gpu_storage_id, uint64_t from_cpu_storage_bytes_first, uint64_t to_gpu_storage_bytes_first, uint64_t bytes_count, const char * optional_file, int optional_line);
 GPU_API_PRE void GPU_API_POST vfeBanzaiBatchStorageCopyFromGpuToCpu(gpu_handle_context_t context, uint64_t batch_id, uint64_t from_gpu_storage_id, uint64_t to_cpu_storage_id, uint64_t from_gpu_storage_bytes_first, uint64_t to_cpu_storage_bytes_first, uint64_t bytes_count, const char * optional_file, int optional_line);
 
@@ -0,0 +1,638 @@
+#include "../../vkfast.h"
+#include "../../vkfast_ids.h"
+
+#ifdef _WIN32
+#undef GPU_API_PRE
+#undef GPU_API_POST
+#define GPU_API_PRE __declspec(dllexport)
+#define GPU_API_POST
+#endif
+
+#include "vkfast_extra_banzai_allocator.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#include <pthread.h>
+#endif
+
+#define VFE_BANZAI_NO_PAGE           ((uint32_t)-1)
+#define VFE_BANZAI_BINS_COUNT        32
+#define VFE_BANZAI_SLAB_PAGES_COUNT  (GPU_EXTRA_BANZAI_ALLOCATOR_SLAB_BYTES_COUNT / GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT)
+#define VFE_BANZAI_CACHE_BATCH_COUNT (GPU_EXTRA_BANZAI_ALLOCATOR_CACHE_SLOTS_COUNT / 2)
+
+static const uint32_t vfeInternalBanzaiSizeClasses[GPU_EXTRA_BANZAI_ALLOCATOR_SIZE_CLASSES_COUNT] = {
+  16,   32,   48,   64,   80,   96,   112,  128,
+  160,  192,  224,  256,  320,  384,  448,  512,
+  640,  768,  896,  1024, 1280, 1536, 1792, 2048,
+  2560, 3072, 3584, 4096, 5120, 6144, 7168, 8192,
+};
+
+typedef enum vfe_banzai_page_kind_t {
+  VFE_BANZAI_PAGE_KIND_FREE  = 0, // NOTE(Constantine): Also the interior pages of large spans.
+  VFE_BANZAI_PAGE_KIND_LARGE = 1, // NOTE(Constantine): The first and the last page of a large span.
+  VFE_BANZAI_PAGE_KIND_SLAB  = 2, // NOTE(Constantine): Every page of a slab span.
+} vfe_banzai_page_kind_t;
+
+typedef struct vfe_banzai_slab_t {
+  uint64_t                   bytesFirst;   // NOTE(Constantine): Relative to the managed range.
+  unsigned                   sizeClass;
+  unsigned                   slotsCount;
+  unsigned                   freeSlotsCount;
+  unsigned                   freeWordHint; // NOTE(Constantine): No free slots before this word of freeBits.
+  struct vfe_banzai_slab_t * prev;         // NOTE(Constantine): In the list of the slabs with free slots of the size class.
+  struct vfe_banzai_slab_t * next;
+  uint64_t *                 freeBits;     // NOTE(Constantine): Set bits are free slots, stored right after the slab.
+} vfe_banzai_slab_t;
+
+// NOTE(Constantine): The first and the last page of every span hold its tags, the first page of a free span also holds its bin links.
+typedef struct vfe_banzai_page_t {
+  uint32_t            kind;
+  uint32_t            spanFirst;
+  uint32_t            spanPagesCount;
+  uint32_t            prevFree;
+  uint32_t            nextFree;
+  uint32_t            reserved;
+  vfe_banzai_slab_t * slab;
+} vfe_banzai_page_t;
+
+typedef struct gpu_extra_type_banzai_allocator_t {
+  gpu_storage_t       storage;
+  uint64_t            bytesFirst;
+  uint32_t            pagesCount;
+  vfe_banzai_page_t * pages;
+  uint32_t            bins[VFE_BANZAI_BINS_COUNT];
+  vfe_banzai_slab_t * partialSlabs[GPU_EXTRA_BANZAI_ALLOCATOR_SIZE_CLASSES_COUNT];
+  uint8_t             sizeClassOf16Bytes[GPU_EXTRA_BANZAI_ALLOCATOR_MAX_SMALL_BYTES_COUNT / 16 + 1];
+  unsigned            cachesCount;
+  // NOTE(Constantine): Statistics.
+  uint64_t            freePagesCount;
+  uint64_t            largeAllocationsCount;
+  uint64_t            largeAllocationsPagesCount;
+  uint64_t            slabsCount;
+  uint64_t            slotsUsedCount;
+  uint64_t            slotsUsedBytesCount;
+  uint64_t            cachedSlotsCount;
+  uint64_t            cachedSlotsBytesCount;
+  uint64_t            allocateCallsCount;
+  uint64_t            freeCallsCount;
+  uint64_t            failedAllocateCallsCount;
+#if defined(_WIN32)
+  SRWLOCK             lock;
+#else
+  pthread_mutex_t     lock;
+#endif
+} gpu_extra_type_banzai_allocator_t;
+
+typedef struct gpu_extra_type_banzai_allocator_cache_t {
+  gpu_extra_banzai_allocator_t allocator;
+  unsigned                     slotsCount[GPU_EXTRA_BANZAI_ALLOCATOR_SIZE_CLASSES_COUNT];
+  uint64_t                     slots[GPU_EXTRA_BANZAI_ALLOCATOR_SIZE_CLASSES_COUNT][GPU_EXTRA_BANZAI_ALLOCATOR_CACHE_SLOTS_COUNT]; // NOTE(Constantine): Relative to the managed range.
+  uint64_t                     reportedSlotsCount;      // NOTE(Constantine): The cached slots counts last added to the allocator's statistics.
+  uint64_t                     reportedSlotsBytesCount;
+  uint64_t                     allocateCallsCount;
+  uint64_t                     freeCallsCount;
+  uint64_t                     failedAllocateCallsCount;
+} gpu_extra_type_banzai_allocator_cache_t;
+
+static void vfeInternalBanzaiAllocatorLock(gpu_extra_banzai_allocator_t allocator) {
+#if defined(_WIN32)
+  AcquireSRWLockExclusive(&allocator->lock);
+#else
+  pthread_mutex_lock(&allocator->lock);
+#endif
+}
+
+static void vfeInternalBanzaiAllocatorUnlock(gpu_extra_banzai_allocator_t allocator) {
+#if defined(_WIN32)
+  ReleaseSRWLockExclusive(&allocator->lock);
+#else
+  pthread_mutex_unlock(&allocator->lock);
+#endif
+}
+
+static unsigned vfeInternalBanzaiCountTrailingZeros(uint64_t value) {
+#if defined(_MSC_VER)
+  unsigned long index = 0;
+  _BitScanForward64(&index, value);
+  return (unsigned)index;
+#else
+  return (unsigned)__builtin_ctzll(value);
+#endif
+}
+
+static unsigned vfeInternalBanzaiBin(uint32_t pagesCount) {
+  unsigned bin = 0;
+  while (pagesCount > 1) {
+    pagesCount >>= 1;
+    bin += 1;
+  }
+  return bin;
+}
+
+static void vfeInternalBanzaiSpanSet(gpu_extra_banzai_allocator_t allocator, uint32_t first, uint32_t pagesCount, vfe_banzai_page_kind_t kind) {
+  vfe_banzai_page_t * pages = allocator->pages;
+  pages[first].kind                       = kind;
+  pages[first].spanFirst                  = first;
+  pages[first].spanPagesCount             = pagesCount;
+  pages[first + pagesCount - 1].kind           = kind;
+  pages[first + pagesCount - 1].spanFirst      = first;
+  pages[first + pagesCount - 1].spanPagesCount = pagesCount;
+}
+
+static void vfeInternalBanzaiBinInsert(gpu_extra_banzai_allocator_t allocator, uint32_t first) {
+  vfe_banzai_page_t * pages = allocator->pages;
+  const unsigned bin = vfeInternalBanzaiBin(pages[first].spanPagesCount);
+  pages[first].prevFree = VFE_BANZAI_NO_PAGE;
+  pages[first].nextFree = allocator->bins[bin];
+  if (allocator->bins[bin] != VFE_BANZAI_NO_PAGE) {
+    pages[allocator->bins[bin]].prevFree = first;
+  }
+  allocator->bins[bin] = first;
+  allocator->freePagesCount += pages[first].spanPagesCount;
+}
+
+static void vfeInternalBanzaiBinRemove(gpu_extra_banzai_allocator_t allocator, uint32_t first) {
+  vfe_banzai_page_t * pages = allocator->pages;
+  const unsigned bin = vfeInternalBanzaiBin(pages[first].spanPagesCount);
+  if (pages[first].prevFree == VFE_BANZAI_NO_PAGE) {
+    allocator->bins[bin] = pages[first].nextFree;
+  } else {
+    pages[pages[first].prevFree].nextFree = pages[first].nextFree;
+  }
+  if (pages[first].nextFree != VFE_BANZAI_NO_PAGE) {
+    pages[pages[first].nextFree].prevFree = pages[first].prevFree;
+  }
+  allocator->freePagesCount -= pages[first].spanPagesCount;
+}
+
+static uint32_t vfeInternalBanzaiPagesAllocate(gpu_extra_banzai_allocator_t allocator, uint32_t pagesCount, vfe_banzai_page_kind_t kind) {
+  vfe_banzai_page_t * pages = allocator->pages;
+
+  // NOTE(Constantine): First fit in the bin of pagesCount, any span of a higher bin fits.
+  uint32_t first = VFE_BANZAI_NO_PAGE;
+  for (unsigned bin = vfeInternalBanzaiBin(pagesCount); bin < VFE_BANZAI_BINS_COUNT && first == VFE_BANZAI_NO_PAGE; bin += 1) {
+    for (uint32_t page = allocator->bins[bin]; page != VFE_BANZAI_NO_PAGE; page = pages[page].nextFree) {
+      if (pages[page].spanPagesCount >= pagesCount) {
+        first = page;
+        break;
+      }
+    }
+  }
+  if (first == VFE_BANZAI_NO_PAGE) {
+    return VFE_BANZAI_NO_PAGE;
+  }
+
+  const uint32_t spanPagesCount = pages[first].spanPagesCount;
+  vfeInternalBanzaiBinRemove(allocator, first);
+  if (spanPagesCount > pagesCount) {
+    // NOTE(Constantine): The tag of the first page of the remainder was an interior page of the free span, so its kind is already free.
+    vfeInternalBanzaiSpanSet(allocator, first + pagesCount, spanPagesCount - pagesCount, VFE_BANZAI_PAGE_KIND_FREE);
+    vfeInternalBanzaiBinInsert(allocator, first + pagesCount);
+  }
+  vfeInternalBanzaiSpanSet(allocator, first, pagesCount, kind);
+  return first;
+}
+
+static void vfeInternalBanzaiPagesFree(gpu_extra_banzai_allocator_t allocator, uint32_t first) {
+  vfe_banzai_page_t * pages = allocator->pages;
+  uint32_t pagesCount = pages[first].spanPagesCount;
+  const uint32_t end  = first + pagesCount;
+  vfeInternalBanzaiSpanSet(allocator, first, pagesCount, VFE_BANZAI_PAGE_KIND_FREE);
+
+  if (first > 0 && pages[first - 1].kind == VFE_BANZAI_PAGE_KIND_FREE) {
+    const uint32_t previousFirst = pages[first - 1].spanFirst;
+    pagesCount += pages[previousFirst].spanPagesCount;
+    vfeInternalBanzaiBinRemove(allocator, previousFirst);
+    first = previousFirst;
+  }
+  if (end < allocator->pagesCount && pages[end].kind == VFE_BANZAI_PAGE_KIND_FREE) {
+    pagesCount += pages[end].spanPagesCount;
+    vfeInternalBanzaiBinRemove(allocator, end);
+  }
+  vfeInternalBanzaiSpanSet(allocator, first, pagesCount, VFE_BANZAI_PAGE_KIND_FREE);
+  vfeInternalBanzaiBinInsert(allocator, first);
+}
+
+static void vfeInternalBanzaiPartialSlabsInsert(gpu_extra_banzai_allocator_t allocator, vfe_banzai_slab_t * slab) {
+  slab->prev = NULL;
+  slab->next = allocator->partialSlabs[slab->sizeClass];
+  if (slab->next != NULL) {
+    slab->next->prev = slab;
+  }
+  allocator->partialSlabs[slab->sizeClass] = slab;
+}
+
+static void vfeInternalBanzaiPartialSlabsRemove(gpu_extra_banzai_allocator_t allocator, vfe_banzai_slab_t * slab) {
+  if (slab->prev == NULL) {
+    allocator->partialSlabs[slab->sizeClass] = slab->next;
+  } else {
+    slab->prev->next = slab->next;
+  }
+  if (slab->next != NULL) {
+    slab->next->prev = slab->prev;
+  }
+  slab->prev = NULL;
+  slab->next = NULL;
+}
+
+static vfe_banzai_slab_t * vfeInternalBanzaiSlabCreate(gpu_extra_banzai_allocator_t allocator, unsigned sizeClass, const char * optionalFile, int optionalLine) {
+  const uint32_t first = vfeInternalBanzaiPagesAllocate(allocator, VFE_BANZAI_SLAB_PAGES_COUNT, VFE_BANZAI_PAGE_KIND_SLAB);
+  if (first == VFE_BANZAI_NO_PAGE) {
+    return NULL;
+  }
+
+  const unsigned slotsCount = GPU_EXTRA_BANZAI_ALLOCATOR_SLAB_BYTES_COUNT / vfeInternalBanzaiSizeClasses[sizeClass];
+  const unsigned wordsCount = (slotsCount + 63) / 64;
+  // To free
+  vfe_banzai_slab_t * slab = (vfe_banzai_slab_t *)red32MemoryCalloc(sizeof(vfe_banzai_slab_t) + sizeof(uint64_t) * wordsCount);
+  REDGPU_2_EXPECTFL(slab != NULL);
+  slab->bytesFirst     = (uint64_t)first * GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT;
+  slab->sizeClass      = sizeClass;
+  slab->slotsCount     = slotsCount;
+  slab->freeSlotsCount = slotsCount;
+  slab->freeWordHint   = 0;
+  slab->freeBits       = (uint64_t *)(void *)&slab[1];
+  for (unsigned i = 0; i < wordsCount; i += 1) {
+    const unsigned bitsCount = slotsCount - i * 64 < 64 ? slotsCount - i * 64 : 64;
+    slab->freeBits[i] = bitsCount == 64 ? ~(uint64_t)0 : (((uint64_t)1 << bitsCount) - 1);
+  }
+
+  for (uint32_t i = 0; i < VFE_BANZAI_SLAB_PAGES_COUNT; i += 1) {
+    allocator->pages[first + i].kind = VFE_BANZAI_PAGE_KIND_SLAB;
+    allocator->pages[first + i].slab = slab;
+  }
+  vfeInternalBanzaiPartialSlabsInsert(allocator, slab);
+  allocator->slabsCount += 1;
+  return slab;
+}
+
+static void vfeInternalBanzaiSlabDestroy(gpu_extra_banzai_allocator_t allocator, vfe_banzai_slab_t * slab) {
+  const uint32_t first = (uint32_t)(slab->bytesFirst / GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT);
+  vfeInternalBanzaiPartialSlabsRemove(allocator, slab);
+  for (uint32_t i = 0; i < VFE_BANZAI_SLAB_PAGES_COUNT; i += 1) {
+    allocator->pages[first + i].kind = VFE_BANZAI_PAGE_KIND_FREE;
+    allocator->pages[first + i].slab = NULL;
+  }
+  vfeInternalBanzaiPagesFree(allocator, first);
+  allocator->slabsCount -= 1;
+  red32MemoryFree(slab);
+}
+
+// NOTE(Constantine): Takes up to slotsCount slots of the size class, returns how many were taken.
+static unsigned vfeInternalBanzaiSlotsAllocate(gpu_extra_banzai_allocator_t allocator, unsigned sizeClass, unsigned slotsCount, uint64_t * outSlots, const char * optionalFile, int optionalLine) {
+  const uint32_t slotBytesCount = vfeInternalBanzaiSizeClasses[sizeClass];
+  unsigned taken = 0;
+  while (taken < slotsCount) {
+    vfe_banzai_slab_t * slab = allocator->partialSlabs[sizeClass];
+    if (slab == NULL) {
+      slab = vfeInternalBanzaiSlabCreate(allocator, sizeClass, optionalFile, optionalLine);
+      if (slab == NULL) {
+        break;
+      }
+    }
+    while (taken < slotsCount && slab->freeSlotsCount > 0) {
+      while (slab->freeBits[slab->freeWordHint] == 0) {
+        slab->freeWordHint += 1;
+      }
+      uint64_t * word = &slab->freeBits[slab->freeWordHint];
+      const unsigned bit = vfeInternalBanzaiCountTrailingZeros(word[0]);
+      word[0] &= word[0] - 1;
+      slab->freeSlotsCount -= 1;
+      outSlots[taken] = slab->bytesFirst + (uint64_t)(slab->freeWordHint * 64 + bit) * slotBytesCount;
+      taken += 1;
+    }
+    if (slab->freeSlotsCount == 0) {
+      vfeInternalBanzaiPartialSlabsRemove(allocator, slab);
+    }
+  }
+  allocator->slotsUsedCount      += taken;
+  allocator->slotsUsedBytesCount += (uint64_t)taken * slotBytesCount;
+  return taken;
+}
+
+static void vfeInternalBanzaiSlotFree(gpu_extra_banzai_allocator_t allocator, uint64_t slot, const char * optionalFile, int optionalLine) {
+  vfe_banzai_slab_t * slab = allocator->pages[slot / GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT].slab;
+  const uint32_t slotBytesCount = vfeInternalBanzaiSizeClasses[slab->sizeClass];
+  const uint64_t slabBytes      = slot - slab->bytesFirst;
+  REDGPU_2_EXPECTFL(slabBytes % slotBytesCount == 0 || !"Not a pointer returned by the Banzai allocator.");
+  const unsigned index = (unsigned)(slabBytes / slotBytesCount);
+  REDGPU_2_EXPECTFL(index < slab->slotsCount || !"Not a pointer returned by the Banzai allocator.");
+  REDGPU_2_EXPECTFL((slab->freeBits[index / 64] & ((uint64_t)1 << (index % 64))) == 0 || !"Double free of a Banzai allocator pointer.");
+
+  slab->freeBits[index / 64] |= (uint64_t)1 << (index % 64);
+  slab->freeWordHint = index / 64 < slab->freeWordHint ? index / 64 : slab->freeWordHint;
+  slab->freeSlotsCount += 1;
+  allocator->slotsUsedCount      -= 1;
+  allocator->slotsUsedBytesCount -= slotBytesCount;
+  if (slab->freeSlotsCount == 1) {
+    vfeInternalBanzaiPartialSlabsInsert(allocator, slab);
+  }
+  if (slab->freeSlotsCount == slab->slotsCount && (allocator->partialSlabs[slab->sizeClass] != slab || slab->next != NULL)) {
+    // NOTE(Constantine): Keeping the last slab of a size class, so a class that allocates and frees one object doesn't create and destroy a slab every time.
+    vfeInternalBanzaiSlabDestroy(allocator, slab);
+  }
+}
+
+static void vfeInternalBanzaiFillPointer(gpu_extra_banzai_allocator_t allocator, uint64_t bytes, gpu_extra_banzai_pointer_t * outBanzaiPointer, const char * optionalFile, int optionalLine) {
+  vfeBanzaiGetPointer(&allocator->storage, allocator->bytesFirst + bytes, outBanzaiPointer, optionalFile, optionalLine);
+}
+
+// NOTE(Constantine): Returns the kind of the allocation, and its bytes relative to the managed range.
+static vfe_banzai_page_kind_t vfeInternalBanzaiCheckPointer(gpu_extra_banzai_allocator_t allocator, const gpu_extra_banzai_pointer_t * banzai_pointer, uint64_t * outBytes, const char * optionalFile, int optionalLine) {
+  REDGPU_2_EXPECTFL(banzai_pointer->id == allocator->storage.id || !"The Banzai pointer is of another storage.");
+  REDGPU_2_EXPECTFL(banzai_pointer->bytes_first >= allocator->bytesFirst || !"Not a pointer returned by the Banzai allocator.");
+  const uint64_t bytes = banzai_pointer->bytes_first - allocator->bytesFirst;
+  const uint64_t page  = bytes / GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT;
+  REDGPU_2_EXPECTFL(page < allocator->pagesCount || !"Not a pointer returned by the Banzai allocator.");
+  const vfe_banzai_page_t * pagesPage = &allocator->pages[page];
+  if (pagesPage->kind == VFE_BANZAI_PAGE_KIND_LARGE) {
+    REDGPU_2_EXPECTFL((bytes % GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT == 0 && pagesPage->spanFirst == page) || !"Not a pointer returned by the Banzai allocator.");
+  } else {
+    REDGPU_2_EXPECTFL(pagesPage->kind == VFE_BANZAI_PAGE_KIND_SLAB || !"Not a pointer returned by the Banzai allocator, or freed already.");
+  }
+  outBytes[0] = bytes;
+  return (vfe_banzai_page_kind_t)pagesPage->kind;
+}
+
+static unsigned vfeInternalBanzaiSizeClass(gpu_extra_banzai_allocator_t allocator, uint64_t bytes_count) {
+  return allocator->sizeClassOf16Bytes[(bytes_count + 15) / 16];
+}
+
+GPU_API_PRE gpu_extra_banzai_allocator_t GPU_API_POST vfeBanzaiAllocatorCreate(const gpu_storage_t * banzai_storage, uint64_t bytes_first, uint64_t bytes_count, const char * optionalFile, int optionalLine) {
+  REDGPU_2_EXPECTFL(banzai_storage != NULL);
+  REDGPU_2_EXPECTFL(bytes_first % GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT == 0);
+  REDGPU_2_EXPECTFL(bytes_first < banzai_storage->info.bytes_count);
+  const uint64_t bytesCount = bytes_count == 0 ? banzai_storage->info.bytes_count - bytes_first : bytes_count;
+  REDGPU_2_EXPECTFL(bytes_first + bytesCount <= banzai_storage->info.bytes_count);
+  const uint64_t pagesCount = bytesCount / GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT;
+  REDGPU_2_EXPECTFL(pagesCount > 0);
+  REDGPU_2_EXPECTFL(pagesCount < VFE_BANZAI_NO_PAGE);
+
+  // To free
+  gpu_extra_banzai_allocator_t allocator = (gpu_extra_banzai_allocator_t)red32MemoryCalloc(sizeof(gpu_extra_type_banzai_allocator_t));
+  REDGPU_2_EXPECTFL(allocator != NULL);
+  allocator->storage    = banzai_storage[0];
+  allocator->bytesFirst = bytes_first;
+  allocator->pagesCount = (uint32_t)pagesCount;
+  // To free
+  allocator->pages = (vfe_banzai_page_t *)red32MemoryCalloc(sizeof(vfe_banzai_page_t) * pagesCount);
+  REDGPU_2_EXPECTFL(allocator->pages != NULL);
+
+  for (unsigned i = 0; i < VFE_BANZAI_BINS_COUNT; i += 1) {
+    allocator->bins[i] = VFE_BANZAI_NO_PAGE;
+  }
+  unsigned sizeClass = 0;
+  for (unsigned i = 0; i < sizeof(allocator->sizeClassOf16Bytes) / sizeof(allocator->sizeClassOf16Bytes[0]); i += 1) {
+    while (vfeInternalBanzaiSizeClasses[sizeClass] < i * 16) {
+      sizeClass += 1;
+    }
+    allocator->sizeClassOf16Bytes[i] = (uint8_t)sizeClass;
+  }
+
+  vfeInternalBanzaiSpanSet(allocator, 0, allocator->pagesCount, VFE_BANZAI_PAGE_KIND_FREE);
+  vfeInternalBanzaiBinInsert(allocator, 0);
+
+#if defined(_WIN32)
+  InitializeSRWLock(&allocator->lock);
+#else
+  pthread_mutex_init(&allocator->lock, NULL);
+#endif
+
+  return allocator;
+}
+
+GPU_API_PRE void GPU_API_POST vfeBanzaiAllocatorDestroy(gpu_extra_banzai_allocator_t allocator, const char * optionalFile, int optionalLine) {
+  if (allocator == NULL) {
+    return;
+  }
+  REDGPU_2_EXPECTFL(allocator->cachesCount == 0 || !"Destroy the caches of the Banzai allocator first.");
+
+  // NOTE(Constantine): Every slab is on a slab span, freeing each one once.
+  for (uint32_t i = 0; i < allocator->pagesCount; i += VFE_BANZAI_SLAB_PAGES_COUNT) {
+    while (i < allocator->pagesCount && allocator->pages[i].kind != VFE_BANZAI_PAGE_KIND_SLAB) {
+      i += 1;
+    }
+    if (i < allocator->pagesCount) {
+      red32MemoryFree(allocator->pages[i].slab);
+    }
+  }
+
+#if !defined(_WIN32)
+  pthread_mutex_destroy(&allocator->lock);
+#endif
+
+  red32MemoryFree(allocator->pages);
+  red32MemoryFree(allocator);
+}
+
+GPU_API_PRE RedBool32 GPU_API_POST vfeBanzaiAllocatorAllocate(gpu_extra_banzai_allocator_t allocator, uint64_t bytes_count, gpu_extra_banzai_pointer_t * out_banzai_pointer, const char * optionalFile, int optionalLine) {
+  uint64_t bytes   = 0;
+  unsigned success = 0;
+
+  vfeInternalBanzaiAllocatorLock(allocator);
+  allocator->allocateCallsCount += 1;
+  if (bytes_count <= GPU_EXTRA_BANZAI_ALLOCATOR_MAX_SMALL_BYTES_COUNT) {
+    success = vfeInternalBanzaiSlotsAllocate(allocator, vfeInternalBanzaiSizeClass(allocator, bytes_count), 1, &bytes, optionalFile, optionalLine);
+  } else {
+    const uint64_t pagesCount = (bytes_count + GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT - 1) / GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT;
+    const uint32_t first      = pagesCount <= allocator->pagesCount ? vfeInternalBanzaiPagesAllocate(allocator, (uint32_t)pagesCount, VFE_BANZAI_PAGE_KIND_LARGE) : VFE_BANZAI_NO_PAGE;
+    if (first != VFE_BANZAI_NO_PAGE) {
+      allocator->largeAllocationsCount      += 1;
+      allocator->largeAllocationsPagesCount += pagesCount;
+      bytes   = (uint64_t)first * GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT;
+      success = 1;
+    }
+  }
+  allocator->failedAllocateCallsCount += success == 1 ? 0 : 1;
+  vfeInternalBanzaiAllocatorUnlock(allocator);
+
+  if (success == 0) {
+    gpu_extra_banzai_pointer_t pointer = {0};
+    out_banzai_pointer[0] = pointer;
+    return 0;
+  }
+  vfeInternalBanzaiFillPointer(allocator, bytes, out_banzai_pointer, optionalFile, optionalLine);
+  return 1;
+}
+
+GPU_API_PRE void GPU_API_POST vfeBanzaiAllocatorFree(gpu_extra_banzai_allocator_t allocator, const gpu_extra_banzai_pointer_t * banzai_pointer, const char * optionalFile, int optionalLine) {
+  vfeInternalBanzaiAllocatorLock(allocator);
+  allocator->freeCallsCount += 1;
+  uint64_t bytes = 0;
+  if (vfeInternalBanzaiCheckPointer(allocator, banzai_pointer, &bytes, optionalFile, optionalLine) == VFE_BANZAI_PAGE_KIND_LARGE) {
+    const uint32_t first = (uint32_t)(bytes / GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT);
+    allocator->largeAllocationsCount      -= 1;
+    allocator->largeAllocationsPagesCount -= allocator->pages[first].spanPagesCount;
+    vfeInternalBanzaiPagesFree(allocator, first);
+  } else {
+    vfeInternalBanzaiSlotFree(allocator, bytes, optionalFile, optionalLine);
+  }
+  vfeInternalBanzaiAllocatorUnlock(allocator);
+}
+
+GPU_API_PRE uint64_t GPU_API_POST vfeBanzaiAllocatorGetBytesCount(gpu_extra_banzai_allocator_t allocator, const gpu_extra_banzai_pointer_t * banzai_pointer, const char * optionalFile, int optionalLine) {
+  vfeInternalBanzaiAllocatorLock(allocator);
+  uint64_t bytes = 0;
+  uint64_t bytesCount = 0;
+  if (vfeInternalBanzaiCheckPointer(allocator, banzai_pointer, &bytes, optionalFile, optionalLine) == VFE_BANZAI_PAGE_KIND_LARGE) {
+    bytesCount = (uint64_t)allocator->pages[bytes / GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT].spanPagesCount * GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT;
+  } else {
+    bytesCount = vfeInternalBanzaiSizeClasses[allocator->pages[bytes / GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT].slab->sizeClass];
+  }
+  vfeInternalBanzaiAllocatorUnlock(allocator);
+  return bytesCount;
+}
+
+GPU_API_PRE void GPU_API_POST vfeBanzaiAllocatorGetStatistics(gpu_extra_banzai_allocator_t allocator, gpu_extra_banzai_allocator_statistics_t * out_statistics) {
+  vfeInternalBanzaiAllocatorLock(allocator);
+  uint32_t largestFreeSpanPagesCount = 0;
+  for (unsigned bin = VFE_BANZAI_BINS_COUNT; bin > 0 && largestFreeSpanPagesCount == 0; bin -= 1) {
+    for (uint32_t page = allocator->bins[bin - 1]; page != VFE_BANZAI_NO_PAGE; page = allocator->pages[page].nextFree) {
+      largestFreeSpanPagesCount = allocator->pages[page].spanPagesCount > largestFreeSpanPagesCount ? allocator->pages[page].spanPagesCount : largestFreeSpanPagesCount;
+    }
+  }
+
+  // Filling
+  gpu_extra_banzai_allocator_statistics_t statistics = {0};
+  statistics.bytes_count                   = (uint64_t)allocator->pagesCount * GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT;
+  statistics.free_pages_bytes_count        = allocator->freePagesCount * GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT;
+  statistics.largest_free_span_bytes_count = (uint64_t)largestFreeSpanPagesCount * GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT;
+  statistics.large_allocations_count       = allocator->largeAllocationsCount;
+  statistics.large_allocations_bytes_count = allocator->largeAllocationsPagesCount * GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT;
+  statistics.slabs_count                   = allocator->slabsCount;
+  statistics.slab_slots_used_count         = allocator->slotsUsedCount;
+  statistics.slab_slots_used_bytes_count   = allocator->slotsUsedBytesCount;
+  statistics.slab_slots_free_bytes_count   = allocator->slabsCount * GPU_EXTRA_BANZAI_ALLOCATOR_SLAB_BYTES_COUNT - allocator->slotsUsedBytesCount;
+  statistics.cached_slots_count            = allocator->cachedSlotsCount;
+  statistics.cached_slots_bytes_count      = allocator->cachedSlotsBytesCount;
+  statistics.allocate_calls_count          = allocator->allocateCallsCount;
+  statistics.free_calls_count              = allocator->freeCallsCount;
+  statistics.failed_allocate_calls_count   = allocator->failedAllocateCallsCount;
+  vfeInternalBanzaiAllocatorUnlock(allocator);
+  out_statistics[0] = statistics;
+}
+
+// NOTE(Constantine): Called with the lock held, cached calls and slots are added to the allocator's statistics only here.
+static void vfeInternalBanzaiCacheMergeStatistics(gpu_extra_banzai_allocator_cache_t cache) {
+  uint64_t slotsCount      = 0;
+  uint64_t slotsBytesCount = 0;
+  for (unsigned i = 0; i < GPU_EXTRA_BANZAI_ALLOCATOR_SIZE_CLASSES_COUNT; i += 1) {
+    slotsCount      += cache->slotsCount[i];
+    slotsBytesCount += (uint64_t)cache->slotsCount[i] * vfeInternalBanzaiSizeClasses[i];
+  }
+  cache->allocator->cachedSlotsCount      = cache->allocator->cachedSlotsCount      - cache->reportedSlotsCount      + slotsCount;
+  cache->allocator->cachedSlotsBytesCount = cache->allocator->cachedSlotsBytesCount - cache->reportedSlotsBytesCount + slotsBytesCount;
+  cache->reportedSlotsCount      = slotsCount;
+  cache->reportedSlotsBytesCount = slotsBytesCount;
+
+  cache->allocator->allocateCallsCount       += cache->allocateCallsCount;
+  cache->allocator->freeCallsCount           += cache->freeCallsCount;
+  cache->allocator->failedAllocateCallsCount += cache->failedAllocateCallsCount;
+  cache->allocateCallsCount       = 0;
+  cache->freeCallsCount           = 0;
+  cache->failedAllocateCallsCount = 0;
+}
+
+// NOTE(Constantine): Called with the lock held, returns the first slotsCount cached slots of the size class.
+static void vfeInternalBanzaiCacheReturnSlots(gpu_extra_banzai_allocator_cache_t cache, unsigned sizeClass, unsigned slotsCount, const char * optionalFile, int optionalLine) {
+  gpu_extra_banzai_allocator_t allocator = cache->allocator;
+  for (unsigned i = 0; i < slotsCount; i += 1) {
+    vfeInternalBanzaiSlotFree(allocator, cache->slots[sizeClass][i], optionalFile, optionalLine);
+  }
+  const unsigned keptCount = cache->slotsCount[sizeClass] - slotsCount;
+  for (unsigned i = 0; i < keptCount; i += 1) {
+    cache->slots[sizeClass][i] = cache->slots[sizeClass][slotsCount + i];
+  }
+  cache->slotsCount[sizeClass] = keptCount;
+}
+
+GPU_API_PRE gpu_extra_banzai_allocator_cache_t GPU_API_POST vfeBanzaiAllocatorCacheCreate(gpu_extra_banzai_allocator_t allocator, const char * optionalFile, int optionalLine) {
+  // To free
+  gpu_extra_banzai_allocator_cache_t cache = (gpu_extra_banzai_allocator_cache_t)red32MemoryCalloc(sizeof(gpu_extra_type_banzai_allocator_cache_t));
+  REDGPU_2_EXPECTFL(cache != NULL);
+  cache->allocator = allocator;
+
+  vfeInternalBanzaiAllocatorLock(allocator);
+  allocator->cachesCount += 1;
+  vfeInternalBanzaiAllocatorUnlock(allocator);
+
+  return cache;
+}
+
+GPU_API_PRE void GPU_API_POST vfeBanzaiAllocatorCacheDestroy(gpu_extra_banzai_allocator_cache_t cache, const char * optionalFile, int optionalLine) {
+  if (cache == NULL) {
+    return;
+  }
+  gpu_extra_banzai_allocator_t allocator = cache->allocator;
+
+  vfeBanzaiAllocatorCacheFlush(cache, optionalFile, optionalLine);
+  vfeInternalBanzaiAllocatorLock(allocator);
+  allocator->cachesCount -= 1;
+  vfeInternalBanzaiAllocatorUnlock(allocator);
+
+  red32MemoryFree(cache);
+}
+
+GPU_API_PRE RedBool32 GPU_API_POST vfeBanzaiAllocatorCacheAllocate(gpu_extra_banzai_allocator_cache_t cache, uint64_t bytes_count, gpu_extra_banzai_pointer_t * out_banzai_pointer, const char * optionalFile, int optionalLine) {
+  gpu_extra_banzai_allocator_t allocator = cache->allocator;
+  if (bytes_count > GPU_EXTRA_BANZAI_ALLOCATOR_MAX_SMALL_BYTES_COUNT) {
+    return vfeBanzaiAllocatorAllocate(allocator, bytes_count, out_banzai_pointer, optionalFile, optionalLine);
+  }
+
+  const unsigned sizeClass = vfeInternalBanzaiSizeClass(allocator, bytes_count);
+  cache->allocateCallsCount += 1;
+  if (cache->slotsCount[sizeClass] == 0) {
+    vfeInternalBanzaiAllocatorLock(allocator);
+    const unsigned taken = vfeInternalBanzaiSlotsAllocate(allocator, sizeClass, VFE_BANZAI_CACHE_BATCH_COUNT, cache->slots[sizeClass], optionalFile, optionalLine);
+    cache->slotsCount[sizeClass]     = taken;
+    cache->failedAllocateCallsCount += taken == 0 ? 1 : 0;
+    vfeInternalBanzaiCacheMergeStatistics(cache);
+    vfeInternalBanzaiAllocatorUnlock(allocator);
+    if (taken == 0) {
+      gpu_extra_banzai_pointer_t pointer = {0};
+      out_banzai_pointer[0] = pointer;
+      return 0;
+    }
+  }
+
+  cache->slotsCount[sizeClass] -= 1;
+  const uint64_t bytes = cache->slots[sizeClass][cache->slotsCount[sizeClass]];
+  vfeInternalBanzaiFillPointer(allocator, bytes, out_banzai_pointer, optionalFile, optionalLine);
+  return 1;
+}
+
+GPU_API_PRE void GPU_API_POST vfeBanzaiAllocatorCacheFree(gpu_extra_banzai_allocator_cache_t cache, const gpu_extra_banzai_pointer_t * banzai_pointer, const char * optionalFile, int optionalLine) {
+  gpu_extra_banzai_allocator_t allocator = cache->allocator;
+
+  // NOTE(Constantine): The pages of a live allocation don't change, so they're read without the lock.
+  uint64_t bytes = 0;
+  if (vfeInternalBanzaiCheckPointer(allocator, banzai_pointer, &bytes, optionalFile, optionalLine) == VFE_BANZAI_PAGE_KIND_LARGE) {
+    vfeBanzaiAllocatorFree(allocator, banzai_pointer, optionalFile, optionalLine);
+    return;
+  }
+
+  const unsigned sizeClass = allocator->pages[bytes / GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT].slab->sizeClass;
+  cache->freeCallsCount += 1;
+  if (cache->slotsCount[sizeClass] == GPU_EXTRA_BANZAI_ALLOCATOR_CACHE_SLOTS_COUNT) {
+    vfeInternalBanzaiAllocatorLock(allocator);
+    vfeInternalBanzaiCacheReturnSlots(cache, sizeClass, VFE_BANZAI_CACHE_BATCH_COUNT, optionalFile, optionalLine);
+    vfeInternalBanzaiCacheMergeStatistics(cache);
+    vfeInternalBanzaiAllocatorUnlock(allocator);
+  }
+  cache->slots[sizeClass][cache->slotsCount[sizeClass]] = bytes;
+  cache->slotsCount[sizeClass] += 1;
+}
+
+GPU_API_PRE void GPU_API_POST vfeBanzaiAllocatorCacheFlush(gpu_extra_banzai_allocator_cache_t cache, const char * optionalFile, int optionalLine) {
+  gpu_extra_banzai_allocator_t allocator = cache->allocator;
+  vfeInternalBanzaiAllocatorLock(allocator);
+  for (unsigned i = 0; i < GPU_EXTRA_BANZAI_ALLOCATOR_SIZE_CLASSES_COUNT; i += 1) {
+    vfeInternalBanzaiCacheReturnSlots(cache, i, cache->slotsCount[i], optionalFile, optionalLine);
+  }
+  vfeInternalBanzaiCacheMergeStatistics(cache);
+  vfeInternalBanzaiAllocatorUnlock(allocator);
+}
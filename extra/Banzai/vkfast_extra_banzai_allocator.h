@@ -0,0 +1,67 @@
+#pragma once
+
+#include "vkfast_extra_banzai_pointer.h"
+
+// NOTE(Constantine):
+// A malloc/free-style allocator that hands out gpu_extra_banzai_pointer_t values inside one storage, usually one of the
+// whole-heap storages of vfeBanzaiStoragesCreate(), so millions of small objects can live behind a single binding.
+// All bookkeeping is on the CPU, nothing is ever written into the storage, so GPU_ONLY storages are managed the same way.
+//
+// The managed range is split into 4 KiB pages. Allocations above 8 KiB take whole pages from a page heap that keeps free
+// spans in power of two bins and coalesces a freed span with its free neighbours. Smaller allocations are rounded up to
+// one of 32 size classes (16 to 128 bytes in 16 bytes steps, then 4 classes per doubling up to 8 KiB) and taken from
+// 64 KiB slabs of that class, an empty slab returns its pages to the page heap unless it's the last one of its class.
+// Every allocation is 16 bytes aligned, allocations above 8 KiB are page aligned, relative to the storage.
+//
+// vfeBanzaiAllocatorAllocate() and vfeBanzaiAllocatorFree() take a lock. For many small allocations from several threads,
+// give each thread its own cache from vfeBanzaiAllocatorCacheCreate(): a cache keeps up to 64 free slots per size class
+// and takes or returns them 32 at a time under the lock, so most cached calls don't lock. A pointer can be freed through
+// any cache or through the allocator, not only the one that allocated it. A cache must only be used by one thread at a
+// time. Double frees are detected on the locked paths only.
+
+#define GPU_EXTRA_BANZAI_ALLOCATOR_PAGE_BYTES_COUNT        4096
+#define GPU_EXTRA_BANZAI_ALLOCATOR_SLAB_BYTES_COUNT        (64 * 1024)
+#define GPU_EXTRA_BANZAI_ALLOCATOR_MAX_SMALL_BYTES_COUNT   8192
+#define GPU_EXTRA_BANZAI_ALLOCATOR_SIZE_CLASSES_COUNT      32
+#define GPU_EXTRA_BANZAI_ALLOCATOR_ALIGNMENT               16
+#define GPU_EXTRA_BANZAI_ALLOCATOR_CACHE_SLOTS_COUNT       64
+
+typedef struct gpu_extra_type_banzai_allocator_t       * gpu_extra_banzai_allocator_t;
+typedef struct gpu_extra_type_banzai_allocator_cache_t * gpu_extra_banzai_allocator_cache_t;
+
+typedef struct gpu_extra_banzai_allocator_statistics_t {
+  uint64_t bytes_count;                   // NOTE(Constantine): Managed bytes, whole pages only.
+  uint64_t free_pages_bytes_count;
+  uint64_t largest_free_span_bytes_count; // NOTE(Constantine): The largest allocation above 8 KiB that can succeed right now.
+  uint64_t large_allocations_count;
+  uint64_t large_allocations_bytes_count;
+  uint64_t slabs_count;
+  uint64_t slab_slots_used_count;         // NOTE(Constantine): Includes the slots held by caches.
+  uint64_t slab_slots_used_bytes_count;
+  uint64_t slab_slots_free_bytes_count;   // NOTE(Constantine): Free bytes inside the slabs, including their unusable tails.
+  uint64_t cached_slots_count;
+  uint64_t cached_slots_bytes_count;
+  uint64_t allocate_calls_count;          // NOTE(Constantine): Calls through caches are counted when a cache takes or returns slots, or is destroyed.
+  uint64_t free_calls_count;
+  uint64_t failed_allocate_calls_count;
+} gpu_extra_banzai_allocator_statistics_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+GPU_API_PRE gpu_extra_banzai_allocator_t GPU_API_POST vfeBanzaiAllocatorCreate(const gpu_storage_t * banzai_storage, uint64_t bytes_first, uint64_t bytes_count, const char * optional_file, int optional_line); // NOTE(Constantine): Manages [bytes_first, bytes_first + bytes_count) of the storage, bytes_count 0 is the rest of the storage. bytes_first must be page aligned.
+GPU_API_PRE void GPU_API_POST vfeBanzaiAllocatorDestroy(gpu_extra_banzai_allocator_t allocator, const char * optional_file, int optional_line); // NOTE(Constantine): Destroy the caches first.
+GPU_API_PRE RedBool32 GPU_API_POST vfeBanzaiAllocatorAllocate(gpu_extra_banzai_allocator_t allocator, uint64_t bytes_count, gpu_extra_banzai_pointer_t * out_banzai_pointer, const char * optional_file, int optional_line); // NOTE(Constantine): Returns 0 and a zeroed pointer when out of memory.
+GPU_API_PRE void GPU_API_POST vfeBanzaiAllocatorFree(gpu_extra_banzai_allocator_t allocator, const gpu_extra_banzai_pointer_t * banzai_pointer, const char * optional_file, int optional_line);
+GPU_API_PRE uint64_t GPU_API_POST vfeBanzaiAllocatorGetBytesCount(gpu_extra_banzai_allocator_t allocator, const gpu_extra_banzai_pointer_t * banzai_pointer, const char * optional_file, int optional_line); // NOTE(Constantine): The usable bytes count of an allocation, its size class or its pages.
+GPU_API_PRE void GPU_API_POST vfeBanzaiAllocatorGetStatistics(gpu_extra_banzai_allocator_t allocator, gpu_extra_banzai_allocator_statistics_t * out_statistics);
+GPU_API_PRE gpu_extra_banzai_allocator_cache_t GPU_API_POST vfeBanzaiAllocatorCacheCreate(gpu_extra_banzai_allocator_t allocator, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfeBanzaiAllocatorCacheDestroy(gpu_extra_banzai_allocator_cache_t cache, const char * optional_file, int optional_line); // NOTE(Constantine): Returns the cached slots to the allocator.
+GPU_API_PRE RedBool32 GPU_API_POST vfeBanzaiAllocatorCacheAllocate(gpu_extra_banzai_allocator_cache_t cache, uint64_t bytes_count, gpu_extra_banzai_pointer_t * out_banzai_pointer, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfeBanzaiAllocatorCacheFree(gpu_extra_banzai_allocator_cache_t cache, const gpu_extra_banzai_pointer_t * banzai_pointer, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfeBanzaiAllocatorCacheFlush(gpu_extra_banzai_allocator_cache_t cache, const char * optional_file, int optional_line); // NOTE(Constantine): Returns the cached slots to the allocator, so empty slabs can be released.
+
+#ifdef __cplusplus
+}
+#endif
@@ -34,7 +34,7 @@ GPU_API_PRE void GPU_API_POST vfeBanzaiPointerGetRaw(const gpu_extra_banzai_poin
   // Filling
   RedStructMemberArray raw = {0};
   raw.array = storage->storage.arrayRangeInfo.array;
-  raw.arrayRangeBytesFirst = banzai_pointer->bytes_first;
+  raw.arrayRangeBytesFirst = storage->storage.arrayRangeInfo.arrayRangeBytesFirst + banzai_pointer->bytes_first;
   raw.arrayRangeBytesCount = storage->storage.arrayRangeInfo.arrayRangeBytesCount - banzai_pointer->bytes_first;
   out_banzai_pointer_raw[0] = raw;
 }
@@ -48,7 +48,7 @@ GPU_API_PRE void GPU_API_POST vfeBanzaiPointerGetRawLimited(const gpu_extra_banz
   // Filling
   RedStructMemberArray raw = {0};
   raw.array = storage->storage.arrayRangeInfo.array;
-  raw.arrayRangeBytesFirst = banzai_pointer->bytes_first;
+  raw.arrayRangeBytesFirst = storage->storage.arrayRangeInfo.arrayRangeBytesFirst + banzai_pointer->bytes_first;
   raw.arrayRangeBytesCount = bytes_count;
   out_banzai_pointer_raw[0] = raw;
 }
@@ -66,7 +66,7 @@ GPU_API_PRE void GPU_API_POST vfeBanzaiPointerGetRawCapped(const gpu_extra_banza
   // Filling
   RedStructMemberArray raw = {0};
   raw.array = storage->storage.arrayRangeInfo.array;
-  raw.arrayRangeBytesFirst = banzai_pointer->bytes_first;
+  raw.arrayRangeBytesFirst = storage->storage.arrayRangeInfo.arrayRangeBytesFirst + banzai_pointer->bytes_first;
   raw.arrayRangeBytesCount = capped_bytes_count;
   out_banzai_pointer_raw[0] = raw;
 }
@@ -0,0 +1,512 @@
+#include "../../vkfast.h"
+#include "../../vkfast_ids.h"
+
+#ifdef _WIN32
+#undef GPU_API_PRE
+#undef GPU_API_POST
+#define GPU_API_PRE __declspec(dllexport)
+#define GPU_API_POST
+#endif
+
+#include "vkfast_extra_cpu_compute.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#include <string.h>
+
+#define VFE_CPU_COMPUTE_HANDLE_TYPE_STORAGE          1
+#define VFE_CPU_COMPUTE_HANDLE_TYPE_PROGRAM_PIPELINE 2
+#define VFE_CPU_COMPUTE_HANDLE_TYPE_BATCH            3
+
+#define VFE_CPU_COMPUTE_COMMAND_TYPE_COPY    1
+#define VFE_CPU_COMPUTE_COMMAND_TYPE_COMPUTE 2
+
+#define VFE_CPU_COMPUTE_STORAGE_ALIGNMENT 64
+
+// NOTE(Constantine): Every thread runs chunks of its own range first, then steals chunks from the ranges of the other threads.
+#define VFE_CPU_COMPUTE_CHUNKS_PER_RANGE 8
+
+typedef struct vfe_cpu_compute_storage_t {
+  int      handleType;
+  void *   allocation;
+  void *   pointer;
+  uint64_t bytesCount;
+} vfe_cpu_compute_storage_t;
+
+typedef struct vfe_cpu_compute_program_pipeline_t {
+  int                            handleType;
+  gpu_extra_cpu_compute_kernel_t kernel;
+  unsigned                       variablesBytesCount;
+} vfe_cpu_compute_program_pipeline_t;
+
+typedef struct vfe_cpu_compute_command_t {
+  int                            commandType;
+  void *                         copyFrom;
+  void *                         copyTo;
+  uint64_t                       copyBytesCount;
+  gpu_extra_cpu_compute_kernel_t kernel;
+  unsigned                       workgroupsCount[3];
+  void *                         storages[GPU_EXTRA_CPU_COMPUTE_MAX_STORAGE_SLOTS];
+  uint64_t                       storagesBytesCount[GPU_EXTRA_CPU_COMPUTE_MAX_STORAGE_SLOTS];
+  unsigned char                  variables[GPU_EXTRA_CPU_COMPUTE_MAX_VARIABLES_BYTES];
+} vfe_cpu_compute_command_t;
+
+typedef struct vfe_cpu_compute_batch_t {
+  int                                  handleType;
+  int                                  recording;
+  vfe_cpu_compute_program_pipeline_t * programPipeline;
+  void *                               storages[GPU_EXTRA_CPU_COMPUTE_MAX_STORAGE_SLOTS];
+  uint64_t                             storagesBytesCount[GPU_EXTRA_CPU_COMPUTE_MAX_STORAGE_SLOTS];
+  unsigned char                        variables[GPU_EXTRA_CPU_COMPUTE_MAX_VARIABLES_BYTES];
+  uint64_t                             commandsCount;
+  uint64_t                             commandsCapacity;
+  vfe_cpu_compute_command_t *          commands;
+} vfe_cpu_compute_batch_t;
+
+typedef struct vfe_cpu_compute_range_t {
+  uint64_t next;
+  uint64_t end;
+  uint64_t padding[6]; // NOTE(Constantine): Keeps the ranges of different threads on different cache lines.
+} vfe_cpu_compute_range_t;
+
+typedef struct vfe_cpu_compute_worker_t {
+  gpu_extra_cpu_compute_context_t context;
+  unsigned                        index;
+#if defined(_WIN32)
+  HANDLE                          thread;
+#else
+  pthread_t                       thread;
+#endif
+} vfe_cpu_compute_worker_t;
+
+typedef struct gpu_extra_type_cpu_compute_context_t {
+  unsigned                          threadsCount; // NOTE(Constantine): Including the thread that calls vfeCpuComputeBatchExecute().
+  vfe_cpu_compute_worker_t *        workers;
+  vfe_cpu_compute_range_t *         ranges;
+#if defined(_WIN32)
+  SRWLOCK                           lock;
+  CONDITION_VARIABLE                jobCondition;
+  CONDITION_VARIABLE                doneCondition;
+#else
+  pthread_mutex_t                   lock;
+  pthread_cond_t                    jobCondition;
+  pthread_cond_t                    doneCondition;
+#endif
+  uint64_t                          jobGeneration;
+  unsigned                          jobWorkersFinished;
+  int                               quit;
+  const vfe_cpu_compute_command_t * job;
+  uint64_t                          jobChunk;
+} gpu_extra_type_cpu_compute_context_t;
+
+static uint64_t vfeInternalCpuComputeAtomicFetchAddUint64(uint64_t * value, uint64_t add) {
+#if defined(_WIN32)
+  return (uint64_t)InterlockedExchangeAdd64((volatile LONG64 *)value, (LONG64)add);
+#else
+  return __atomic_fetch_add(value, add, __ATOMIC_ACQ_REL);
+#endif
+}
+
+static void vfeInternalCpuComputeLock(gpu_extra_cpu_compute_context_t context) {
+#if defined(_WIN32)
+  AcquireSRWLockExclusive(&context->lock);
+#else
+  pthread_mutex_lock(&context->lock);
+#endif
+}
+
+static void vfeInternalCpuComputeUnlock(gpu_extra_cpu_compute_context_t context) {
+#if defined(_WIN32)
+  ReleaseSRWLockExclusive(&context->lock);
+#else
+  pthread_mutex_unlock(&context->lock);
+#endif
+}
+
+static void vfeInternalCpuComputeRunJob(gpu_extra_cpu_compute_context_t context, unsigned workerIndex) {
+  const vfe_cpu_compute_command_t * job = context->job;
+
+  gpu_extra_cpu_compute_workgroup_t workgroup = {0};
+  workgroup.workgroups_count[0] = job->workgroupsCount[0];
+  workgroup.workgroups_count[1] = job->workgroupsCount[1];
+  workgroup.workgroups_count[2] = job->workgroupsCount[2];
+  for (unsigned i = 0; i < GPU_EXTRA_CPU_COMPUTE_MAX_STORAGE_SLOTS; i += 1) {
+    workgroup.storages[i]             = job->storages[i];
+    workgroup.storages_bytes_count[i] = job->storagesBytesCount[i];
+  }
+  workgroup.variables = job->variables;
+
+  const uint64_t countX  = job->workgroupsCount[0];
+  const uint64_t countXY = job->workgroupsCount[0] * (uint64_t)job->workgroupsCount[1];
+
+  for (unsigned r = 0; r < context->threadsCount; r += 1) {
+    vfe_cpu_compute_range_t * range = &context->ranges[(workerIndex + r) % context->threadsCount];
+    for (;;) {
+      const uint64_t first = vfeInternalCpuComputeAtomicFetchAddUint64(&range->next, context->jobChunk);
+      if (first >= range->end) {
+        break;
+      }
+      const uint64_t last = first + context->jobChunk < range->end ? first + context->jobChunk : range->end;
+      for (uint64_t i = first; i < last; i += 1) {
+        workgroup.workgroup_id[0] = (unsigned)(i % countX);
+        workgroup.workgroup_id[1] = (unsigned)((i % countXY) / countX);
+        workgroup.workgroup_id[2] = (unsigned)(i / countXY);
+        job->kernel(&workgroup);
+      }
+    }
+  }
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI vfeInternalCpuComputeWorkerMain(LPVOID parameter) {
+#else
+static void * vfeInternalCpuComputeWorkerMain(void * parameter) {
+#endif
+  vfe_cpu_compute_worker_t *      worker  = (vfe_cpu_compute_worker_t *)parameter;
+  gpu_extra_cpu_compute_context_t context = worker->context;
+
+  uint64_t seenGeneration = 0;
+  for (;;) {
+    vfeInternalCpuComputeLock(context);
+    while (context->jobGeneration == seenGeneration && context->quit == 0) {
+#if defined(_WIN32)
+      SleepConditionVariableSRW(&context->jobCondition, &context->lock, INFINITE, 0);
+#else
+      pthread_cond_wait(&context->jobCondition, &context->lock);
+#endif
+    }
+    if (context->quit == 1) {
+      vfeInternalCpuComputeUnlock(context);
+      break;
+    }
+    seenGeneration = context->jobGeneration;
+    vfeInternalCpuComputeUnlock(context);
+
+    vfeInternalCpuComputeRunJob(context, worker->index);
+
+    vfeInternalCpuComputeLock(context);
+    context->jobWorkersFinished += 1;
+    if (context->jobWorkersFinished == context->threadsCount - 1) {
+#if defined(_WIN32)
+      WakeConditionVariable(&context->doneCondition);
+#else
+      pthread_cond_signal(&context->doneCondition);
+#endif
+    }
+    vfeInternalCpuComputeUnlock(context);
+  }
+
+#if defined(_WIN32)
+  return 0;
+#else
+  return NULL;
+#endif
+}
+
+static void vfeInternalCpuComputeDispatch(gpu_extra_cpu_compute_context_t context, const vfe_cpu_compute_command_t * command) {
+  const uint64_t workgroupsCount = (uint64_t)command->workgroupsCount[0] * command->workgroupsCount[1] * command->workgroupsCount[2];
+  if (workgroupsCount == 0) {
+    return;
+  }
+
+  const uint64_t threadsCount = context->threadsCount;
+  const uint64_t rangeSize    = (workgroupsCount + threadsCount - 1) / threadsCount;
+
+  vfeInternalCpuComputeLock(context);
+  for (uint64_t i = 0; i < threadsCount; i += 1) {
+    const uint64_t first = i * rangeSize;
+    const uint64_t end   = first + rangeSize;
+    context->ranges[i].next = first < workgroupsCount ? first : workgroupsCount;
+    context->ranges[i].end  = end   < workgroupsCount ? end   : workgroupsCount;
+  }
+  context->job                = command;
+  context->jobChunk           = rangeSize / VFE_CPU_COMPUTE_CHUNKS_PER_RANGE > 0 ? rangeSize / VFE_CPU_COMPUTE_CHUNKS_PER_RANGE : 1;
+  context->jobWorkersFinished = 0;
+  context->jobGeneration     += 1;
+#if defined(_WIN32)
+  WakeAllConditionVariable(&context->jobCondition);
+#else
+  pthread_cond_broadcast(&context->jobCondition);
+#endif
+  vfeInternalCpuComputeUnlock(context);
+
+  vfeInternalCpuComputeRunJob(context, 0);
+
+  vfeInternalCpuComputeLock(context);
+  while (context->jobWorkersFinished < context->threadsCount - 1) {
+#if defined(_WIN32)
+    SleepConditionVariableSRW(&context->doneCondition, &context->lock, INFINITE, 0);
+#else
+    pthread_cond_wait(&context->doneCondition, &context->lock);
+#endif
+  }
+  context->job = NULL;
+  vfeInternalCpuComputeUnlock(context);
+}
+
+GPU_API_PRE gpu_extra_cpu_compute_context_t GPU_API_POST vfeCpuComputeContextInit(unsigned optional_threads_count, const char * optionalFile, int optionalLine) {
+  unsigned threadsCount = optional_threads_count;
+  if (threadsCount == 0) {
+#if defined(_WIN32)
+    SYSTEM_INFO systemInfo = {0};
+    GetSystemInfo(&systemInfo);
+    threadsCount = (unsigned)systemInfo.dwNumberOfProcessors;
+#else
+    long processorsCount = sysconf(_SC_NPROCESSORS_ONLN);
+    threadsCount = processorsCount > 0 ? (unsigned)processorsCount : 1;
+#endif
+  }
+  if (threadsCount == 0) {
+    threadsCount = 1;
+  }
+
+  gpu_extra_cpu_compute_context_t context = (gpu_extra_cpu_compute_context_t)red32MemoryCalloc(sizeof(gpu_extra_type_cpu_compute_context_t));
+  REDGPU_2_EXPECTFL(context != NULL);
+  context->threadsCount = threadsCount;
+  context->workers      = (vfe_cpu_compute_worker_t *)red32MemoryCalloc(sizeof(vfe_cpu_compute_worker_t) * threadsCount);
+  context->ranges       = (vfe_cpu_compute_range_t *)red32MemoryCalloc(sizeof(vfe_cpu_compute_range_t) * threadsCount);
+  REDGPU_2_EXPECTFL(context->workers != NULL);
+  REDGPU_2_EXPECTFL(context->ranges != NULL);
+
+#if defined(_WIN32)
+  InitializeSRWLock(&context->lock);
+  InitializeConditionVariable(&context->jobCondition);
+  InitializeConditionVariable(&context->doneCondition);
+#else
+  pthread_mutex_init(&context->lock, NULL);
+  pthread_cond_init(&context->jobCondition, NULL);
+  pthread_cond_init(&context->doneCondition, NULL);
+#endif
+
+  // NOTE(Constantine): Worker 0 is the calling thread.
+  for (unsigned i = 1; i < threadsCount; i += 1) {
+    context->workers[i].context = context;
+    context->workers[i].index   = i;
+#if defined(_WIN32)
+    context->workers[i].thread = CreateThread(NULL, 0, vfeInternalCpuComputeWorkerMain, &context->workers[i], 0, NULL);
+    REDGPU_2_EXPECTFL(context->workers[i].thread != NULL);
+#else
+    int status = pthread_create(&context->workers[i].thread, NULL, vfeInternalCpuComputeWorkerMain, &context->workers[i]);
+    REDGPU_2_EXPECTFL(status == 0);
+#endif
+  }
+
+  return context;
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuComputeContextDeinit(gpu_extra_cpu_compute_context_t context, const char * optionalFile, int optionalLine) {
+  if (context == NULL) {
+    return;
+  }
+
+  vfeInternalCpuComputeLock(context);
+  context->quit = 1;
+#if defined(_WIN32)
+  WakeAllConditionVariable(&context->jobCondition);
+#else
+  pthread_cond_broadcast(&context->jobCondition);
+#endif
+  vfeInternalCpuComputeUnlock(context);
+
+  for (unsigned i = 1; i < context->threadsCount; i += 1) {
+#if defined(_WIN32)
+    WaitForSingleObject(context->workers[i].thread, INFINITE);
+    CloseHandle(context->workers[i].thread);
+#else
+    pthread_join(context->workers[i].thread, NULL);
+#endif
+  }
+
+#if !defined(_WIN32)
+  pthread_cond_destroy(&context->doneCondition);
+  pthread_cond_destroy(&context->jobCondition);
+  pthread_mutex_destroy(&context->lock);
+#endif
+
+  red32MemoryFree(context->ranges);
+  red32MemoryFree(context->workers);
+  red32MemoryFree(context);
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuComputeStorageCreate(gpu_extra_cpu_compute_context_t context, const gpu_storage_info_t * storage_info, gpu_storage_t * out_storage, const char * optionalFile, int optionalLine) {
+  REDGPU_2_EXPECTFL(storage_info->bytes_count > 0);
+
+  vfe_cpu_compute_storage_t * storage = (vfe_cpu_compute_storage_t *)red32MemoryCalloc(sizeof(vfe_cpu_compute_storage_t));
+  REDGPU_2_EXPECTFL(storage != NULL);
+  storage->handleType = VFE_CPU_COMPUTE_HANDLE_TYPE_STORAGE;
+  storage->allocation = red32MemoryCalloc(storage_info->bytes_count + VFE_CPU_COMPUTE_STORAGE_ALIGNMENT);
+  REDGPU_2_EXPECTFL(storage->allocation != NULL);
+  storage->pointer    = (void *)(((uintptr_t)storage->allocation + VFE_CPU_COMPUTE_STORAGE_ALIGNMENT - 1) & ~(uintptr_t)(VFE_CPU_COMPUTE_STORAGE_ALIGNMENT - 1));
+  storage->bytesCount = storage_info->bytes_count;
+
+  gpu_storage_t out = {0};
+  out.id              = (uint64_t)(void *)storage;
+  out.info            = storage_info[0];
+  out.alignment       = VFE_CPU_COMPUTE_STORAGE_ALIGNMENT;
+  out.mapped_void_ptr = storage->pointer;
+  out_storage[0] = out;
+}
+
+GPU_API_PRE uint64_t GPU_API_POST vfeCpuComputeProgramPipelineCreate(gpu_extra_cpu_compute_context_t context, gpu_extra_cpu_compute_kernel_t kernel, unsigned variables_bytes_count, const char * optionalFile, int optionalLine) {
+  REDGPU_2_EXPECTFL(kernel != NULL);
+  REDGPU_2_EXPECTFL(variables_bytes_count <= GPU_EXTRA_CPU_COMPUTE_MAX_VARIABLES_BYTES);
+
+  vfe_cpu_compute_program_pipeline_t * programPipeline = (vfe_cpu_compute_program_pipeline_t *)red32MemoryCalloc(sizeof(vfe_cpu_compute_program_pipeline_t));
+  REDGPU_2_EXPECTFL(programPipeline != NULL);
+  programPipeline->handleType          = VFE_CPU_COMPUTE_HANDLE_TYPE_PROGRAM_PIPELINE;
+  programPipeline->kernel              = kernel;
+  programPipeline->variablesBytesCount = variables_bytes_count;
+  return (uint64_t)(void *)programPipeline;
+}
+
+static vfe_cpu_compute_command_t * vfeInternalCpuComputeBatchAddCommand(vfe_cpu_compute_batch_t * batch, const char * optionalFile, int optionalLine) {
+  REDGPU_2_EXPECTFL(batch->recording == 1);
+  if (batch->commandsCount == batch->commandsCapacity) {
+    uint64_t capacity = batch->commandsCapacity == 0 ? 16 : batch->commandsCapacity * 2;
+    vfe_cpu_compute_command_t * commands = (vfe_cpu_compute_command_t *)red32MemoryCalloc(sizeof(vfe_cpu_compute_command_t) * capacity);
+    REDGPU_2_EXPECTFL(commands != NULL);
+    if (batch->commands != NULL) {
+      red32MemoryCopy(commands, batch->commands, sizeof(vfe_cpu_compute_command_t) * batch->commandsCount);
+      red32MemoryFree(batch->commands);
+    }
+    batch->commands         = commands;
+    batch->commandsCapacity = capacity;
+  }
+  vfe_cpu_compute_command_t * command = &batch->commands[batch->commandsCount];
+  batch->commandsCount += 1;
+  memset(command, 0, sizeof(vfe_cpu_compute_command_t));
+  return command;
+}
+
+GPU_API_PRE uint64_t GPU_API_POST vfeCpuComputeBatchBegin(gpu_extra_cpu_compute_context_t context, uint64_t existing_batch_id, const char * optionalFile, int optionalLine) {
+  vfe_cpu_compute_batch_t * batch = (vfe_cpu_compute_batch_t *)(void *)existing_batch_id;
+  if (batch == NULL) {
+    batch = (vfe_cpu_compute_batch_t *)red32MemoryCalloc(sizeof(vfe_cpu_compute_batch_t));
+    REDGPU_2_EXPECTFL(batch != NULL);
+    batch->handleType = VFE_CPU_COMPUTE_HANDLE_TYPE_BATCH;
+  }
+  REDGPU_2_EXPECTFL(batch->handleType == VFE_CPU_COMPUTE_HANDLE_TYPE_BATCH);
+  REDGPU_2_EXPECTFL(batch->recording == 0);
+  batch->recording       = 1;
+  batch->programPipeline = NULL;
+  batch->commandsCount   = 0;
+  memset(batch->storages, 0, sizeof(batch->storages));
+  memset(batch->storagesBytesCount, 0, sizeof(batch->storagesBytesCount));
+  memset(batch->variables, 0, sizeof(batch->variables));
+  return (uint64_t)(void *)batch;
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchStorageCopy(gpu_extra_cpu_compute_context_t context, uint64_t batch_id, uint64_t from_storage_id, uint64_t to_storage_id, const char * optionalFile, int optionalLine) {
+  vfe_cpu_compute_batch_t *   batch = (vfe_cpu_compute_batch_t *)(void *)batch_id;
+  vfe_cpu_compute_storage_t * from  = (vfe_cpu_compute_storage_t *)(void *)from_storage_id;
+  vfe_cpu_compute_storage_t * to    = (vfe_cpu_compute_storage_t *)(void *)to_storage_id;
+  REDGPU_2_EXPECTFL(from->handleType == VFE_CPU_COMPUTE_HANDLE_TYPE_STORAGE);
+  REDGPU_2_EXPECTFL(to->handleType == VFE_CPU_COMPUTE_HANDLE_TYPE_STORAGE);
+
+  vfe_cpu_compute_command_t * command = vfeInternalCpuComputeBatchAddCommand(batch, optionalFile, optionalLine);
+  command->commandType    = VFE_CPU_COMPUTE_COMMAND_TYPE_COPY;
+  command->copyFrom       = from->pointer;
+  command->copyTo         = to->pointer;
+  command->copyBytesCount = from->bytesCount < to->bytesCount ? from->bytesCount : to->bytesCount;
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchBindProgramPipeline(gpu_extra_cpu_compute_context_t context, uint64_t batch_id, uint64_t program_pipeline_id, const char * optionalFile, int optionalLine) {
+  vfe_cpu_compute_batch_t *            batch           = (vfe_cpu_compute_batch_t *)(void *)batch_id;
+  vfe_cpu_compute_program_pipeline_t * programPipeline = (vfe_cpu_compute_program_pipeline_t *)(void *)program_pipeline_id;
+  REDGPU_2_EXPECTFL(batch->recording == 1);
+  REDGPU_2_EXPECTFL(programPipeline->handleType == VFE_CPU_COMPUTE_HANDLE_TYPE_PROGRAM_PIPELINE);
+  batch->programPipeline = programPipeline;
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchBindStorageSingleLimited(gpu_extra_cpu_compute_context_t context, uint64_t batch_id, int slot, uint64_t storage_id, uint64_t bytes_first, uint64_t bytes_count, const char * optionalFile, int optionalLine) {
+  vfe_cpu_compute_batch_t *   batch   = (vfe_cpu_compute_batch_t *)(void *)batch_id;
+  vfe_cpu_compute_storage_t * storage = (vfe_cpu_compute_storage_t *)(void *)storage_id;
+  REDGPU_2_EXPECTFL(batch->recording == 1);
+  REDGPU_2_EXPECTFL(slot >= 0 && slot < GPU_EXTRA_CPU_COMPUTE_MAX_STORAGE_SLOTS);
+  REDGPU_2_EXPECTFL(storage->handleType == VFE_CPU_COMPUTE_HANDLE_TYPE_STORAGE);
+  REDGPU_2_EXPECTFL(bytes_first <= storage->bytesCount && bytes_count <= storage->bytesCount - bytes_first);
+  batch->storages[slot]           = (void *)((uint8_t *)storage->pointer + bytes_first);
+  batch->storagesBytesCount[slot] = bytes_count;
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchBindStorageSingle(gpu_extra_cpu_compute_context_t context, uint64_t batch_id, int slot, uint64_t storage_id, const char * optionalFile, int optionalLine) {
+  vfe_cpu_compute_storage_t * storage = (vfe_cpu_compute_storage_t *)(void *)storage_id;
+  vfeCpuComputeBatchBindStorageSingleLimited(context, batch_id, slot, storage_id, 0, storage->bytesCount, optionalFile, optionalLine);
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchBindVariablesCopy(gpu_extra_cpu_compute_context_t context, uint64_t batch_id, unsigned variables_bytes_offset, unsigned data_bytes_count, const void * data, const char * optionalFile, int optionalLine) {
+  vfe_cpu_compute_batch_t * batch = (vfe_cpu_compute_batch_t *)(void *)batch_id;
+  REDGPU_2_EXPECTFL(batch->recording == 1);
+  REDGPU_2_EXPECTFL(batch->programPipeline != NULL);
+  REDGPU_2_EXPECTFL(variables_bytes_offset + data_bytes_count <= batch->programPipeline->variablesBytesCount);
+  red32MemoryCopy(&batch->variables[variables_bytes_offset], data, data_bytes_count);
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchCompute(gpu_extra_cpu_compute_context_t context, uint64_t batch_id, unsigned workgroups_count_x, unsigned workgroups_count_y, unsigned workgroups_count_z, const char * optionalFile, int optionalLine) {
+  vfe_cpu_compute_batch_t * batch = (vfe_cpu_compute_batch_t *)(void *)batch_id;
+  REDGPU_2_EXPECTFL(batch->programPipeline != NULL);
+
+  vfe_cpu_compute_command_t * command = vfeInternalCpuComputeBatchAddCommand(batch, optionalFile, optionalLine);
+  command->commandType        = VFE_CPU_COMPUTE_COMMAND_TYPE_COMPUTE;
+  command->kernel             = batch->programPipeline->kernel;
+  command->workgroupsCount[0] = workgroups_count_x;
+  command->workgroupsCount[1] = workgroups_count_y;
+  command->workgroupsCount[2] = workgroups_count_z;
+  red32MemoryCopy(command->storages, batch->storages, sizeof(command->storages));
+  red32MemoryCopy(command->storagesBytesCount, batch->storagesBytesCount, sizeof(command->storagesBytesCount));
+  red32MemoryCopy(command->variables, batch->variables, sizeof(command->variables));
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchBarrierMemory(gpu_extra_cpu_compute_context_t context, uint64_t batch_id, const char * optionalFile, int optionalLine) {
+  vfe_cpu_compute_batch_t * batch = (vfe_cpu_compute_batch_t *)(void *)batch_id;
+  REDGPU_2_EXPECTFL(batch->recording == 1);
+  // NOTE(Constantine): Commands run one after another and every dispatch waits for all of its workgroups.
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchEnd(gpu_extra_cpu_compute_context_t context, uint64_t batch_id, const char * optionalFile, int optionalLine) {
+  vfe_cpu_compute_batch_t * batch = (vfe_cpu_compute_batch_t *)(void *)batch_id;
+  REDGPU_2_EXPECTFL(batch->recording == 1);
+  batch->recording = 0;
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchExecute(gpu_extra_cpu_compute_context_t context, uint64_t batches_count, const uint64_t * batch_ids, const char * optionalFile, int optionalLine) {
+  for (uint64_t i = 0; i < batches_count; i += 1) {
+    vfe_cpu_compute_batch_t * batch = (vfe_cpu_compute_batch_t *)(void *)batch_ids[i];
+    REDGPU_2_EXPECTFL(batch->handleType == VFE_CPU_COMPUTE_HANDLE_TYPE_BATCH);
+    REDGPU_2_EXPECTFL(batch->recording == 0);
+    for (uint64_t j = 0; j < batch->commandsCount; j += 1) {
+      const vfe_cpu_compute_command_t * command = &batch->commands[j];
+      if (command->commandType == VFE_CPU_COMPUTE_COMMAND_TYPE_COPY) {
+        memmove(command->copyTo, command->copyFrom, command->copyBytesCount);
+      } else if (command->commandType == VFE_CPU_COMPUTE_COMMAND_TYPE_COMPUTE) {
+        vfeInternalCpuComputeDispatch(context, command);
+      }
+    }
+  }
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuComputeIdDestroy(gpu_extra_cpu_compute_context_t context, uint64_t ids_count, const uint64_t * ids, const char * optionalFile, int optionalLine) {
+  for (uint64_t i = 0; i < ids_count; i += 1) {
+    if (ids[i] == 0) {
+      continue;
+    }
+    int handleType = ((int *)(void *)ids[i])[0];
+    if (handleType == VFE_CPU_COMPUTE_HANDLE_TYPE_STORAGE) {
+      vfe_cpu_compute_storage_t * storage = (vfe_cpu_compute_storage_t *)(void *)ids[i];
+      red32MemoryFree(storage->allocation);
+      red32MemoryFree(storage);
+    } else if (handleType == VFE_CPU_COMPUTE_HANDLE_TYPE_PROGRAM_PIPELINE) {
+      red32MemoryFree((void *)ids[i]);
+    } else if (handleType == VFE_CPU_COMPUTE_HANDLE_TYPE_BATCH) {
+      vfe_cpu_compute_batch_t * batch = (vfe_cpu_compute_batch_t *)(void *)ids[i];
+      red32MemoryFree(batch->commands);
+      red32MemoryFree(batch);
+    } else {
+      REDGPU_2_EXPECTFL(!"Unknown CPU compute id");
+    }
+  }
+}
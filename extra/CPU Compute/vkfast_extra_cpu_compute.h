@@ -0,0 +1,51 @@
+#pragma once
+
+#include "../../vkfast.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// NOTE(Constantine):
+// A CPU execution backend for compute programs written in the shared HLSL/C++ subset of vkfast_extra_cpu_compute_shared.h.
+// The same kernel source is compiled by dxc for vkFast and natively for this backend, so GPU-less machines can run the
+// same pipelines and serve as a correctness oracle for the GPU results. The API mirrors the vkFast batch API:
+// storages are host memory, batches record calls and vfeCpuComputeBatchExecute() runs them in order on the calling
+// thread, dispatching the workgroups of every vfeCpuComputeBatchCompute() across a work-stealing thread pool.
+// Dispatches never overlap, so vfeCpuComputeBatchBarrierMemory() is only kept for the API to match. groupshared memory and
+// GroupMemoryBarrierWithGroupSync() are not supported, workgroup invocations run one after another.
+
+#define GPU_EXTRA_CPU_COMPUTE_MAX_STORAGE_SLOTS   16
+#define GPU_EXTRA_CPU_COMPUTE_MAX_VARIABLES_BYTES 256
+
+typedef struct gpu_extra_cpu_compute_workgroup_t {
+  unsigned     workgroup_id[3];
+  unsigned     workgroups_count[3];
+  void *       storages[GPU_EXTRA_CPU_COMPUTE_MAX_STORAGE_SLOTS];
+  uint64_t     storages_bytes_count[GPU_EXTRA_CPU_COMPUTE_MAX_STORAGE_SLOTS];
+  const void * variables;
+} gpu_extra_cpu_compute_workgroup_t;
+
+typedef void (*gpu_extra_cpu_compute_kernel_t)(const gpu_extra_cpu_compute_workgroup_t * workgroup); // NOTE(Constantine): Defined by VF_KERNEL() of vkfast_extra_cpu_compute_shared.h.
+
+typedef struct gpu_extra_type_cpu_compute_context_t * gpu_extra_cpu_compute_context_t;
+
+GPU_API_PRE gpu_extra_cpu_compute_context_t GPU_API_POST vfeCpuComputeContextInit(unsigned optional_threads_count, const char * optional_file, int optional_line); // NOTE(Constantine): 0 threads count uses all logical CPUs.
+GPU_API_PRE void GPU_API_POST vfeCpuComputeContextDeinit(gpu_extra_cpu_compute_context_t context, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfeCpuComputeStorageCreate(gpu_extra_cpu_compute_context_t context, const gpu_storage_info_t * storage_info, gpu_storage_t * out_storage, const char * optional_file, int optional_line); // NOTE(Constantine): Every storage type is mapped.
+GPU_API_PRE uint64_t GPU_API_POST vfeCpuComputeProgramPipelineCreate(gpu_extra_cpu_compute_context_t context, gpu_extra_cpu_compute_kernel_t kernel, unsigned variables_bytes_count, const char * optional_file, int optional_line);
+GPU_API_PRE uint64_t GPU_API_POST vfeCpuComputeBatchBegin(gpu_extra_cpu_compute_context_t context, uint64_t existing_batch_id, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchStorageCopy(gpu_extra_cpu_compute_context_t context, uint64_t batch_id, uint64_t from_storage_id, uint64_t to_storage_id, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchBindProgramPipeline(gpu_extra_cpu_compute_context_t context, uint64_t batch_id, uint64_t program_pipeline_id, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchBindStorageSingle(gpu_extra_cpu_compute_context_t context, uint64_t batch_id, int slot, uint64_t storage_id, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchBindStorageSingleLimited(gpu_extra_cpu_compute_context_t context, uint64_t batch_id, int slot, uint64_t storage_id, uint64_t bytes_first, uint64_t bytes_count, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchBindVariablesCopy(gpu_extra_cpu_compute_context_t context, uint64_t batch_id, unsigned variables_bytes_offset, unsigned data_bytes_count, const void * data, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchCompute(gpu_extra_cpu_compute_context_t context, uint64_t batch_id, unsigned workgroups_count_x, unsigned workgroups_count_y, unsigned workgroups_count_z, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchBarrierMemory(gpu_extra_cpu_compute_context_t context, uint64_t batch_id, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchEnd(gpu_extra_cpu_compute_context_t context, uint64_t batch_id, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfeCpuComputeBatchExecute(gpu_extra_cpu_compute_context_t context, uint64_t batches_count, const uint64_t * batch_ids, const char * optional_file, int optional_line); // NOTE(Constantine): Returns when all batches finished.
+GPU_API_PRE void GPU_API_POST vfeCpuComputeIdDestroy(gpu_extra_cpu_compute_context_t context, uint64_t ids_count, const uint64_t * ids, const char * optional_file, int optional_line);
+
+#ifdef __cplusplus
+}
+#endif
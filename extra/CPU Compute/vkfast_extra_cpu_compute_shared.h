@@ -0,0 +1,95 @@
+#pragma once
+
+// NOTE(Constantine):
+// A subset of HLSL that compiles both with dxc for vkFast and with a C++ compiler for vkfast_extra_cpu_compute.h.
+// Write one kernel per source file:
+//
+// VF_STORAGE(0, float4, array0)
+// VF_STORAGE(1, float4, array1)
+//
+// struct Variables {
+//   float4 salt;
+// };
+// VF_VARIABLES(Variables, variables) // NOTE(Constantine): Or VF_NO_VARIABLES if the kernel has no variables.
+//
+// VF_KERNEL(64, 1, 1, main, tid) {
+//   array1[tid.x] = array0[tid.x] + variables.salt;
+// }
+//
+// For the GPU: dxc.exe kernel.hlsl -T cs_6_0 -E main -Fh kernel.cs.h -spirv
+// For the CPU: include glm and this header in a .cpp file, then include kernel.hlsl. The kernel is exported as
+// extern "C" void VF_KERNEL_NAME(main)(const gpu_extra_cpu_compute_workgroup_t *) to pass to vfeCpuComputeProgramPipelineCreate().
+// On the CPU, storage slots index gpu_extra_cpu_compute_workgroup_t::storages[] and variables are read once per workgroup.
+// groupshared memory, wave intrinsics and group barriers are not supported.
+
+#if defined(__HLSL_VERSION)
+
+#define VF_STORAGE(slot, type, name)  [[vk::binding(slot, 0)]] RWStructuredBuffer<type> name;
+#define VF_VARIABLES(type, name)      [[vk::push_constant]] ConstantBuffer<type> name;
+#define VF_NO_VARIABLES
+#define VF_KERNEL(x, y, z, name, tid) [numthreads(x, y, z)] void name(uint3 tid: SV_DispatchThreadId)
+
+#else
+
+#ifndef GLM_VERSION
+#error Include glm before vkfast_extra_cpu_compute_shared.h
+#endif
+
+#include "vkfast_extra_cpu_compute.h"
+
+#include <string.h>
+
+typedef unsigned   uint;
+typedef glm::vec2  float2;
+typedef glm::vec3  float3;
+typedef glm::vec4  float4;
+typedef glm::ivec2 int2;
+typedef glm::ivec3 int3;
+typedef glm::ivec4 int4;
+typedef glm::uvec2 uint2;
+typedef glm::uvec3 uint3;
+typedef glm::uvec4 uint4;
+
+static thread_local const gpu_extra_cpu_compute_workgroup_t * vfeCpuComputeCurrentWorkgroup = 0;
+
+template<class T, int Slot>
+struct VfeCpuComputeRWStructuredBuffer {
+  T & operator[](uint64_t index) const {
+    return ((T *)vfeCpuComputeCurrentWorkgroup->storages[Slot])[index];
+  }
+  void GetDimensions(uint & out_count, uint & out_stride) const {
+    out_count  = (uint)(vfeCpuComputeCurrentWorkgroup->storages_bytes_count[Slot] / sizeof(T));
+    out_stride = (uint)sizeof(T);
+  }
+};
+
+#define VF_STORAGE(slot, type, name) static VfeCpuComputeRWStructuredBuffer<type, slot> name;
+
+#define VF_VARIABLES(type, name) \
+  static thread_local type name; \
+  static void vfeCpuComputeLoadVariables(const void * vfeCpuComputeVariables) { \
+    memcpy(&name, vfeCpuComputeVariables, sizeof(type)); \
+  }
+
+#define VF_NO_VARIABLES \
+  static void vfeCpuComputeLoadVariables(const void * vfeCpuComputeVariables) { \
+  }
+
+#define VF_KERNEL_NAME(name) vfeCpuComputeKernel_##name
+
+#define VF_KERNEL(x, y, z, name, tid) \
+  static void vfeCpuComputeInvocation_##name(uint3 tid); \
+  extern "C" void VF_KERNEL_NAME(name)(const gpu_extra_cpu_compute_workgroup_t * workgroup) { \
+    vfeCpuComputeCurrentWorkgroup = workgroup; \
+    vfeCpuComputeLoadVariables(workgroup->variables); \
+    for (uint lz = 0; lz < (z); lz += 1) { \
+      for (uint ly = 0; ly < (y); ly += 1) { \
+        for (uint lx = 0; lx < (x); lx += 1) { \
+          vfeCpuComputeInvocation_##name(uint3(workgroup->workgroup_id[0] * (x) + lx, workgroup->workgroup_id[1] * (y) + ly, workgroup->workgroup_id[2] * (z) + lz)); \
+        } \
+      } \
+    } \
+  } \
+  static void vfeCpuComputeInvocation_##name(uint3 tid)
+
+#endif
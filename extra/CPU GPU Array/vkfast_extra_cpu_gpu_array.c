@@ -90,3 +90,189 @@ GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayOffset(gpu_extra_cpu_gpu_array * cpu
   cpu_gpu_array->gpu.arrayRangeBytesFirst += bytes_offset;
   cpu_gpu_array->gpu.arrayRangeBytesCount -= bytes_offset;
 }
+
+GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayTrackedInit(gpu_extra_cpu_gpu_array_tracked * out_tracked, const gpu_extra_cpu_gpu_array * cpu_gpu_array, uint64_t bytes_count, uint64_t page_bytes_count, const char * optionalFile, int optionalLine) {
+  const uint64_t rangeBytesCount = cpu_gpu_array->cpu.arrayRangeBytesCount < cpu_gpu_array->gpu.arrayRangeBytesCount ? cpu_gpu_array->cpu.arrayRangeBytesCount : cpu_gpu_array->gpu.arrayRangeBytesCount;
+  const uint64_t bytesCount      = bytes_count == 0 ? rangeBytesCount : bytes_count;
+  const uint64_t pageBytesCount  = page_bytes_count == 0 ? GPU_EXTRA_CPU_GPU_ARRAY_TRACKED_DEFAULT_PAGE_BYTES_COUNT : page_bytes_count;
+  REDGPU_2_EXPECTFL(bytesCount <= rangeBytesCount);
+  REDGPU_2_EXPECTFL(bytesCount > 0);
+
+  // Filling
+  gpu_extra_cpu_gpu_array_tracked tracked = {0};
+  tracked.array             = cpu_gpu_array[0];
+  tracked.bytes_count       = bytesCount;
+  tracked.page_bytes_count  = pageBytesCount;
+  tracked.pages_count       = (bytesCount + pageBytesCount - 1) / pageBytesCount;
+  tracked.dirty_pages_count = 0;
+  // To free
+  tracked.dirty_bits        = (uint64_t *)red32MemoryCalloc(sizeof(uint64_t) * ((tracked.pages_count + 63) / 64));
+  REDGPU_2_EXPECTFL(tracked.dirty_bits != NULL);
+  out_tracked[0] = tracked;
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayTrackedDeinit(gpu_extra_cpu_gpu_array_tracked * tracked) {
+  red32MemoryFree(tracked->dirty_bits);
+  tracked->dirty_bits        = NULL;
+  tracked->dirty_pages_count = 0;
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayTrackedMarkDirty(gpu_extra_cpu_gpu_array_tracked * tracked, uint64_t bytes_first, uint64_t bytes_count, const char * optionalFile, int optionalLine) {
+  REDGPU_2_EXPECTFL(bytes_first <= tracked->bytes_count && bytes_count <= tracked->bytes_count - bytes_first);
+  if (bytes_count == 0) {
+    return;
+  }
+
+  const uint64_t pageFirst = bytes_first / tracked->page_bytes_count;
+  const uint64_t pageLast  = (bytes_first + bytes_count - 1) / tracked->page_bytes_count;
+  for (uint64_t page = pageFirst; page <= pageLast; page += 1) {
+    const uint64_t bit = (uint64_t)1 << (page % 64);
+    if ((tracked->dirty_bits[page / 64] & bit) == 0) {
+      tracked->dirty_bits[page / 64] |= bit;
+      tracked->dirty_pages_count += 1;
+    }
+  }
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayTrackedWrite(gpu_extra_cpu_gpu_array_tracked * tracked, uint64_t bytes_first, uint64_t bytes_count, const void * data, const char * optionalFile, int optionalLine) {
+  vfeCpuGpuArrayTrackedMarkDirty(tracked, bytes_first, bytes_count, optionalFile, optionalLine);
+  red32MemoryCopy((unsigned char *)tracked->array.cpu_ptr + bytes_first, data, bytes_count);
+}
+
+GPU_API_PRE uint64_t GPU_API_POST vfeCpuGpuArrayTrackedBatchCopyDirtyFromCpuToGpu(gpu_handle_context_t context, uint64_t batch_id, gpu_extra_cpu_gpu_array_tracked * tracked, const char * optionalFile, int optionalLine) {
+  if (tracked->dirty_pages_count == 0) {
+    return 0;
+  }
+
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
+
+  // NOTE(Constantine): Runs of dirty pages are merged into one range each, the ranges are recorded up to 64 per call.
+  RedCopyArrayRange ranges[64];
+  unsigned rangesCount = 0;
+  uint64_t copiedBytesCount = 0;
+  uint64_t page = 0;
+  while (page < tracked->pages_count) {
+    const uint64_t word = tracked->dirty_bits[page / 64] >> (page % 64);
+    if (word == 0) {
+      page = (page / 64 + 1) * 64;
+      continue;
+    }
+    if ((word & 1) == 0) {
+      page += 1;
+      continue;
+    }
+    const uint64_t pageFirst = page;
+    while (page < tracked->pages_count && (tracked->dirty_bits[page / 64] & ((uint64_t)1 << (page % 64))) != 0) {
+      page += 1;
+    }
+    const uint64_t bytesFirst = pageFirst * tracked->page_bytes_count;
+    const uint64_t bytesEnd   = page * tracked->page_bytes_count < tracked->bytes_count ? page * tracked->page_bytes_count : tracked->bytes_count;
+
+    RedCopyArrayRange range = {0};
+    range.arrayRBytesFirst  = tracked->array.cpu.arrayRangeBytesFirst + bytesFirst;
+    range.arrayWBytesFirst  = tracked->array.gpu.arrayRangeBytesFirst + bytesFirst;
+    range.bytesCount        = bytesEnd - bytesFirst;
+    ranges[rangesCount]     = range;
+    rangesCount      += 1;
+    copiedBytesCount += bytesEnd - bytesFirst;
+
+    if (rangesCount == sizeof(ranges) / sizeof(ranges[0])) {
+      npfp(redCallCopyArrayToArray, batch->batch.addresses.redCallCopyArrayToArray,
+        "calls", batch->batch.calls.handle,
+        "arrayR", tracked->array.cpu.array,
+        "arrayW", tracked->array.gpu.array,
+        "rangesCount", rangesCount,
+        "ranges", ranges
+      );
+      rangesCount = 0;
+    }
+  }
+  if (rangesCount > 0) {
+    npfp(redCallCopyArrayToArray, batch->batch.addresses.redCallCopyArrayToArray,
+      "calls", batch->batch.calls.handle,
+      "arrayR", tracked->array.cpu.array,
+      "arrayW", tracked->array.gpu.array,
+      "rangesCount", rangesCount,
+      "ranges", ranges
+    );
+  }
+
+  for (uint64_t i = 0; i < (tracked->pages_count + 63) / 64; i += 1) {
+    tracked->dirty_bits[i] = 0;
+  }
+  tracked->dirty_pages_count = 0;
+  return copiedBytesCount;
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayFramesInit(gpu_extra_cpu_gpu_array_frames * out_frames, unsigned frames_count, const char * optionalFile, int optionalLine) {
+  REDGPU_2_EXPECTFL(frames_count > 0 && frames_count <= GPU_EXTRA_CPU_GPU_ARRAY_MAX_FRAMES_IN_FLIGHT);
+
+  // Filling
+  gpu_extra_cpu_gpu_array_frames frames = {0};
+  frames.frames_count       = frames_count;
+  frames.frame_slot         = frames_count - 1; // NOTE(Constantine): The first vfeCpuGpuArrayFramesBegin() moves to slot 0.
+  frames.frames_begun_count = 0;
+  out_frames[0] = frames;
+}
+
+GPU_API_PRE unsigned GPU_API_POST vfeCpuGpuArrayFramesBegin(gpu_handle_context_t context, gpu_extra_cpu_gpu_array_frames * frames, const char * optionalFile, int optionalLine) {
+  frames->frame_slot          = (frames->frame_slot + 1) % frames->frames_count;
+  frames->frames_begun_count += 1;
+  if (frames->asyncs[frames->frame_slot] != 0) {
+    vfAsyncWaitToFinish(context, frames->asyncs[frames->frame_slot], optionalFile, optionalLine);
+    frames->asyncs[frames->frame_slot] = 0;
+  }
+  return frames->frame_slot;
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayFramesEnd(gpu_extra_cpu_gpu_array_frames * frames, uint64_t async_id, const char * optionalFile, int optionalLine) {
+  REDGPU_2_EXPECTFL(frames->frames_begun_count > 0);
+  REDGPU_2_EXPECTFL(frames->asyncs[frames->frame_slot] == 0 || !"vfeCpuGpuArrayFramesEnd() was called twice for one frame.");
+  frames->asyncs[frames->frame_slot] = async_id;
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayFramesWaitAll(gpu_handle_context_t context, gpu_extra_cpu_gpu_array_frames * frames, const char * optionalFile, int optionalLine) {
+  // NOTE(Constantine): Oldest frame first.
+  for (unsigned i = 1; i <= frames->frames_count; i += 1) {
+    const unsigned slot = (frames->frame_slot + i) % frames->frames_count;
+    if (frames->asyncs[slot] != 0) {
+      vfAsyncWaitToFinish(context, frames->asyncs[slot], optionalFile, optionalLine);
+      frames->asyncs[slot] = 0;
+    }
+  }
+}
+
+GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayMultiBufferedInit(gpu_extra_cpu_gpu_array_multi_buffered * out_multi_buffered, const gpu_extra_cpu_gpu_array * cpu_gpu_array, unsigned slices_count, RedBool32 slice_gpu_range, const char * optionalFile, int optionalLine) {
+  REDGPU_2_EXPECTFL(slices_count > 0 && slices_count <= GPU_EXTRA_CPU_GPU_ARRAY_MAX_FRAMES_IN_FLIGHT);
+
+  const uint64_t alignment      = GPU_EXTRA_CPU_GPU_ARRAY_MULTI_BUFFERED_SLICE_ALIGNMENT;
+  const uint64_t cpuSliceBytes  = cpu_gpu_array->cpu.arrayRangeBytesCount / slices_count / alignment * alignment;
+  const uint64_t gpuSliceBytes  = slice_gpu_range == 1 ? cpu_gpu_array->gpu.arrayRangeBytesCount / slices_count / alignment * alignment : cpu_gpu_array->gpu.arrayRangeBytesCount;
+  const uint64_t sliceBytes     = cpuSliceBytes < gpuSliceBytes ? cpuSliceBytes : gpuSliceBytes;
+  REDGPU_2_EXPECTFL(sliceBytes > 0);
+
+  // Filling
+  gpu_extra_cpu_gpu_array_multi_buffered multiBuffered = {0};
+  multiBuffered.slices_count      = slices_count;
+  multiBuffered.slice_gpu_range   = slice_gpu_range;
+  multiBuffered.slice_bytes_count = sliceBytes;
+  for (unsigned i = 0; i < slices_count; i += 1) {
+    gpu_extra_cpu_gpu_array slice = cpu_gpu_array[0];
+    slice.cpu_ptr                   = (void *)((unsigned char *)cpu_gpu_array->cpu_ptr + i * cpuSliceBytes);
+    slice.cpu.arrayRangeBytesFirst += i * cpuSliceBytes;
+    slice.cpu.arrayRangeBytesCount  = sliceBytes;
+    if (slice_gpu_range == 1) {
+      slice.gpu.arrayRangeBytesFirst += i * gpuSliceBytes;
+    }
+    slice.gpu.arrayRangeBytesCount  = sliceBytes;
+    multiBuffered.slices[i] = slice;
+  }
+  out_multi_buffered[0] = multiBuffered;
+}
+
+GPU_API_PRE gpu_extra_cpu_gpu_array * GPU_API_POST vfeCpuGpuArrayMultiBufferedGetSlice(gpu_extra_cpu_gpu_array_multi_buffered * multi_buffered, unsigned frame_slot) {
+  return &multi_buffered->slices[frame_slot % multi_buffered->slices_count];
+}
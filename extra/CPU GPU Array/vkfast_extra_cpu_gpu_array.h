@@ -17,9 +17,66 @@ typedef struct gpu_extra_cpu_gpu_array {
   RedStructMemberArray gpu;
 } gpu_extra_cpu_gpu_array;
 
+// NOTE(Constantine): The opt-in tracked mode. Writes through vfeCpuGpuArrayTrackedWrite() or vfeCpuGpuArrayTrackedMarkDirty()
+// set bits of a page-granular dirty bitmap, vfeCpuGpuArrayTrackedBatchCopyDirtyFromCpuToGpu() records one copy range per run
+// of dirty pages into the batch and clears the bitmap. Writes through array.cpu_ptr directly must be marked dirty by hand.
+
+#define GPU_EXTRA_CPU_GPU_ARRAY_TRACKED_DEFAULT_PAGE_BYTES_COUNT 4096
+
+typedef struct gpu_extra_cpu_gpu_array_tracked {
+  gpu_extra_cpu_gpu_array array;
+  uint64_t                bytes_count;       // NOTE(Constantine): Tracked bytes from the start of the array.
+  uint64_t                page_bytes_count;
+  uint64_t                pages_count;
+  uint64_t                dirty_pages_count;
+  uint64_t *              dirty_bits;
+} gpu_extra_cpu_gpu_array_tracked;
+
+// NOTE(Constantine): The multi-buffered mode for per-frame streaming. gpu_extra_cpu_gpu_array_frames paces up to
+// GPU_EXTRA_CPU_GPU_ARRAY_MAX_FRAMES_IN_FLIGHT frames: vfeCpuGpuArrayFramesBegin() returns the frame slot and waits only for
+// the submit of the frame that used the same slot frames_count frames ago, vfeCpuGpuArrayFramesEnd() takes the async id of
+// this frame's submit. The frames object owns the async ids it's given, don't vfAsyncWaitToFinish them elsewhere. Waited
+// async ids return their CPU signals to the context's pool, so streaming doesn't create a signal per frame.
+// gpu_extra_cpu_gpu_array_multi_buffered splits one CPU GPU array into one slice per frame slot, the CPU side is always
+// split, the GPU side is split too if slice_gpu_range is 1, otherwise every slice copies to the start of the GPU range.
+// Several multi-buffered arrays can share one frames object and one submit per frame.
+//
+//   unsigned slot = vfeCpuGpuArrayFramesBegin(ctx, &frames, FF, LL);
+//   gpu_extra_cpu_gpu_array * slice = vfeCpuGpuArrayMultiBufferedGetSlice(&particles, slot);
+//   ... write slice->cpu_ptr, vfeCpuGpuArrayBatchCopyFromCpuToGpu(ctx, batch, slice, 0, bytes_count, FF, LL) ...
+//   vfeCpuGpuArrayFramesEnd(&frames, vfAsyncBatchExecuteRaw(...));
+
+#define GPU_EXTRA_CPU_GPU_ARRAY_MAX_FRAMES_IN_FLIGHT            8
+#define GPU_EXTRA_CPU_GPU_ARRAY_MULTI_BUFFERED_SLICE_ALIGNMENT  256
+
+typedef struct gpu_extra_cpu_gpu_array_frames {
+  unsigned frames_count;
+  unsigned frame_slot;                                       // NOTE(Constantine): Of the current frame.
+  uint64_t frames_begun_count;
+  uint64_t asyncs[GPU_EXTRA_CPU_GPU_ARRAY_MAX_FRAMES_IN_FLIGHT]; // NOTE(Constantine): The submit of each frame slot, 0 once waited.
+} gpu_extra_cpu_gpu_array_frames;
+
+typedef struct gpu_extra_cpu_gpu_array_multi_buffered {
+  unsigned                slices_count;
+  unsigned                slice_gpu_range;
+  uint64_t                slice_bytes_count;
+  gpu_extra_cpu_gpu_array slices[GPU_EXTRA_CPU_GPU_ARRAY_MAX_FRAMES_IN_FLIGHT];
+} gpu_extra_cpu_gpu_array_multi_buffered;
+
 GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayBatchCopyFromCpuToGpu(gpu_handle_context_t context, uint64_t batch_id, gpu_extra_cpu_gpu_array * cpu_gpu_array, uint64_t bytes_first, uint64_t bytes_count, const char * optional_file, int optional_line);
 GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayBatchCopyFromGpuToCpu(gpu_handle_context_t context, uint64_t batch_id, gpu_extra_cpu_gpu_array * cpu_gpu_array, uint64_t bytes_first, uint64_t bytes_count, const char * optional_file, int optional_line);
 GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayOffset(gpu_extra_cpu_gpu_array * cpu_gpu_array, uint64_t bytes_offset);
+GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayTrackedInit(gpu_extra_cpu_gpu_array_tracked * out_tracked, const gpu_extra_cpu_gpu_array * cpu_gpu_array, uint64_t bytes_count, uint64_t page_bytes_count, const char * optional_file, int optional_line); // NOTE(Constantine): bytes_count 0 is the smaller of the CPU and the GPU ranges, page_bytes_count 0 is GPU_EXTRA_CPU_GPU_ARRAY_TRACKED_DEFAULT_PAGE_BYTES_COUNT. Starts with nothing dirty.
+GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayTrackedDeinit(gpu_extra_cpu_gpu_array_tracked * tracked);
+GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayTrackedMarkDirty(gpu_extra_cpu_gpu_array_tracked * tracked, uint64_t bytes_first, uint64_t bytes_count, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayTrackedWrite(gpu_extra_cpu_gpu_array_tracked * tracked, uint64_t bytes_first, uint64_t bytes_count, const void * data, const char * optional_file, int optional_line);
+GPU_API_PRE uint64_t GPU_API_POST vfeCpuGpuArrayTrackedBatchCopyDirtyFromCpuToGpu(gpu_handle_context_t context, uint64_t batch_id, gpu_extra_cpu_gpu_array_tracked * tracked, const char * optional_file, int optional_line); // NOTE(Constantine): Returns the copied bytes count, 0 records nothing.
+GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayFramesInit(gpu_extra_cpu_gpu_array_frames * out_frames, unsigned frames_count, const char * optional_file, int optional_line);
+GPU_API_PRE unsigned GPU_API_POST vfeCpuGpuArrayFramesBegin(gpu_handle_context_t context, gpu_extra_cpu_gpu_array_frames * frames, const char * optional_file, int optional_line); // NOTE(Constantine): Returns the frame slot whose slices are safe to write now.
+GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayFramesEnd(gpu_extra_cpu_gpu_array_frames * frames, uint64_t async_id, const char * optional_file, int optional_line); // NOTE(Constantine): async_id 0 if the frame submitted nothing.
+GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayFramesWaitAll(gpu_handle_context_t context, gpu_extra_cpu_gpu_array_frames * frames, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfeCpuGpuArrayMultiBufferedInit(gpu_extra_cpu_gpu_array_multi_buffered * out_multi_buffered, const gpu_extra_cpu_gpu_array * cpu_gpu_array, unsigned slices_count, RedBool32 slice_gpu_range, const char * optional_file, int optional_line); // NOTE(Constantine): slices_count is the frames_count of the frames object. Slices are GPU_EXTRA_CPU_GPU_ARRAY_MULTI_BUFFERED_SLICE_ALIGNMENT aligned.
+GPU_API_PRE gpu_extra_cpu_gpu_array * GPU_API_POST vfeCpuGpuArrayMultiBufferedGetSlice(gpu_extra_cpu_gpu_array_multi_buffered * multi_buffered, unsigned frame_slot);
 
 #ifdef __cplusplus
 }
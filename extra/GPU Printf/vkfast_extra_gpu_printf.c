@@ -0,0 +1,495 @@
+#include "../../vkfast.h"
+#include "../../vkfast_ids.h"
+
+#ifdef _WIN32
+#undef GPU_API_PRE
+#undef GPU_API_POST
+#define GPU_API_PRE __declspec(dllexport)
+#define GPU_API_POST
+#endif
+
+#include "vkfast_extra_gpu_printf.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+#include <stdio.h>
+#include <string.h>
+
+#define VFE_GPU_PRINTF_RECORD_END_MARKER  0xFFFFFFFF
+#define VFE_GPU_PRINTF_TEXT_BYTES_COUNT   1024
+
+typedef enum vfe_gpu_printf_ring_state_t {
+  VFE_GPU_PRINTF_RING_STATE_FREE     = 0,
+  VFE_GPU_PRINTF_RING_STATE_ACQUIRED = 1,
+  VFE_GPU_PRINTF_RING_STATE_RELEASED = 2, // NOTE(Constantine): Queued for or being decoded.
+} vfe_gpu_printf_ring_state_t;
+
+typedef struct vfe_gpu_printf_ring_t {
+  gpu_storage_t               gpu;
+  gpu_storage_t               cpu; // NOTE(Constantine): GPU_STORAGE_TYPE_CPU_READBACK, read by the decoder thread.
+  uint64_t                    cpuBytesCount; // NOTE(Constantine): Of the header and the records copied back to cpu by vfeGpuPrintfRingRelease().
+  uint64_t                    copyBatch;     // NOTE(Constantine): Copies back the records of the ring, recorded again by every vfeGpuPrintfRingRelease(). One per ring, since only the thread that acquired a ring releases it, rings are released concurrently.
+  vfe_gpu_printf_ring_state_t state;
+} vfe_gpu_printf_ring_t;
+
+typedef struct gpu_extra_type_gpu_printf_t {
+  gpu_handle_context_t            context;
+  gpu_storage_t                   headerTemplate; // NOTE(Constantine): GPU_STORAGE_TYPE_CPU_UPLOAD, the ring header with a zero cursor.
+  unsigned                        ringsCount;
+  vfe_gpu_printf_ring_t *         rings;
+  unsigned                        formatsCount;
+  char **                         formats;
+  gpu_extra_gpu_printf_callback_t callback;
+  void *                          callbackUserData;
+  // NOTE(Constantine): Guarded by lock.
+  unsigned *                      queue;          // NOTE(Constantine): Released rings in release order.
+  unsigned                        queueFirst;
+  unsigned                        queueCount;
+  unsigned                        decoding;
+  unsigned                        quit;
+  uint64_t                        droppedRecordsCount;
+#if defined(_WIN32)
+  SRWLOCK                         lock;
+  CONDITION_VARIABLE              queueCondition;
+  CONDITION_VARIABLE              freeCondition;
+  HANDLE                          thread;
+#else
+  pthread_mutex_t                 lock;
+  pthread_cond_t                  queueCondition;
+  pthread_cond_t                  freeCondition;
+  pthread_t                       thread;
+#endif
+} gpu_extra_type_gpu_printf_t;
+
+static void vfeInternalGpuPrintfLock(gpu_extra_gpu_printf_t gpuPrintf) {
+#if defined(_WIN32)
+  AcquireSRWLockExclusive(&gpuPrintf->lock);
+#else
+  pthread_mutex_lock(&gpuPrintf->lock);
+#endif
+}
+
+static void vfeInternalGpuPrintfUnlock(gpu_extra_gpu_printf_t gpuPrintf) {
+#if defined(_WIN32)
+  ReleaseSRWLockExclusive(&gpuPrintf->lock);
+#else
+  pthread_mutex_unlock(&gpuPrintf->lock);
+#endif
+}
+
+static void vfeInternalGpuPrintfWait(gpu_extra_gpu_printf_t gpuPrintf, int isFreeCondition) {
+#if defined(_WIN32)
+  SleepConditionVariableSRW(isFreeCondition == 1 ? &gpuPrintf->freeCondition : &gpuPrintf->queueCondition, &gpuPrintf->lock, INFINITE, 0);
+#else
+  pthread_cond_wait(isFreeCondition == 1 ? &gpuPrintf->freeCondition : &gpuPrintf->queueCondition, &gpuPrintf->lock);
+#endif
+}
+
+static void vfeInternalGpuPrintfWakeAll(gpu_extra_gpu_printf_t gpuPrintf, int isFreeCondition) {
+#if defined(_WIN32)
+  WakeAllConditionVariable(isFreeCondition == 1 ? &gpuPrintf->freeCondition : &gpuPrintf->queueCondition);
+#else
+  pthread_cond_broadcast(isFreeCondition == 1 ? &gpuPrintf->freeCondition : &gpuPrintf->queueCondition);
+#endif
+}
+
+static void vfeInternalGpuPrintfDefaultCallback(const char * text, void * userData) {
+  fputs(text, stdout);
+}
+
+static void vfeInternalGpuPrintfFormat(char * text, size_t textBytesCount, const char * format, unsigned argsCount, const uint32_t * args) {
+  size_t   length = 0;
+  unsigned arg    = 0;
+  const char * c = format;
+  while (c[0] != 0 && length + 1 < textBytesCount) {
+    if (c[0] != '%') {
+      text[length] = c[0];
+      length += 1;
+      c += 1;
+      continue;
+    }
+    if (c[1] == '%') {
+      text[length] = '%';
+      length += 1;
+      c += 2;
+      continue;
+    }
+
+    // NOTE(Constantine): Flags, width and precision are passed to snprintf as is, length modifiers are skipped since every arg is 32-bit.
+    const char * specFirst = c;
+    c += 1;
+    while (c[0] != 0 && strchr("-+ #0", c[0]) != NULL) { c += 1; }
+    while (c[0] >= '0' && c[0] <= '9') { c += 1; }
+    if (c[0] == '.') {
+      c += 1;
+      while (c[0] >= '0' && c[0] <= '9') { c += 1; }
+    }
+    const char * specEnd = c;
+    while (c[0] != 0 && strchr("hlLjzt", c[0]) != NULL) { c += 1; }
+    const char conversion = c[0];
+    if (conversion == 0) {
+      break;
+    }
+    c += 1;
+
+    char spec[32] = {0};
+    size_t specBytesCount = (size_t)(specEnd - specFirst);
+    if (specBytesCount > sizeof(spec) - 2) {
+      specBytesCount = sizeof(spec) - 2;
+    }
+    red32MemoryCopy(spec, specFirst, specBytesCount);
+    spec[specBytesCount] = conversion;
+
+    const size_t remaining = textBytesCount - length;
+    int written = 0;
+    if (strchr("diuxXocfFeEgG", conversion) == NULL) {
+      written = snprintf(&text[length], remaining, "%.*s", (int)(c - specFirst), specFirst);
+    } else if (arg >= argsCount) {
+      written = snprintf(&text[length], remaining, "(missing)");
+    } else {
+      const uint32_t value = args[arg];
+      arg += 1;
+      if (conversion == 'd' || conversion == 'i') {
+        written = snprintf(&text[length], remaining, spec, (int)(int32_t)value);
+      } else if (conversion == 'c') {
+        written = snprintf(&text[length], remaining, spec, (int)value);
+      } else if (conversion == 'u' || conversion == 'x' || conversion == 'X' || conversion == 'o') {
+        written = snprintf(&text[length], remaining, spec, (unsigned)value);
+      } else {
+        float f = 0;
+        red32MemoryCopy(&f, &value, sizeof(float));
+        written = snprintf(&text[length], remaining, spec, (double)f);
+      }
+    }
+    if (written > 0) {
+      length += (size_t)written < remaining ? (size_t)written : remaining - 1;
+    }
+  }
+  text[length] = 0;
+}
+
+GPU_API_PRE uint64_t GPU_API_POST vfeGpuPrintfDecode(unsigned formats_count, const char * const * formats, const void * ring, uint64_t ring_bytes_count, gpu_extra_gpu_printf_callback_t optional_callback, void * optional_callback_user_data) {
+  if (ring_bytes_count < GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT) {
+    return 0;
+  }
+  gpu_extra_gpu_printf_callback_t callback = optional_callback == NULL ? vfeInternalGpuPrintfDefaultCallback : optional_callback;
+
+  // NOTE(Constantine): Records are read up to the cursor, the capacity and the copied bytes, whichever ends first, so the stale records past them are never read.
+  const uint32_t * words        = (const uint32_t *)ring;
+  const uint32_t * records      = &words[GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT / sizeof(uint32_t)];
+  const uint64_t   copiedCount  = (ring_bytes_count - GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT) / sizeof(uint32_t);
+  const uint32_t   cursor       = words[0];
+  const uint32_t   capacity     = words[1];
+  uint32_t         end          = cursor < capacity ? cursor : capacity;
+  if (end > copiedCount) {
+    end = (uint32_t)copiedCount;
+  }
+
+  char text[VFE_GPU_PRINTF_TEXT_BYTES_COUNT];
+  uint64_t recordsCount = 0;
+  uint32_t i = 0;
+  while (i < end) {
+    const uint32_t header = records[i];
+    if (header == VFE_GPU_PRINTF_RECORD_END_MARKER) {
+      break;
+    }
+    const unsigned formatId  = header >> 4;
+    const unsigned argsCount = header & 15;
+    if (argsCount > GPU_EXTRA_GPU_PRINTF_MAX_ARGS || end - i - 1 < argsCount) {
+      break;
+    }
+    uint32_t args[GPU_EXTRA_GPU_PRINTF_MAX_ARGS] = {0};
+    for (unsigned j = 0; j < argsCount; j += 1) {
+      args[j] = records[i + 1 + j];
+    }
+    if (formatId < formats_count) {
+      vfeInternalGpuPrintfFormat(text, sizeof(text), formats[formatId], argsCount, args);
+    } else {
+      snprintf(text, sizeof(text), "[vkFast][GPU printf] Unknown format id %u\n", formatId);
+    }
+    callback(text, optional_callback_user_data);
+    recordsCount += 1;
+    i += 1 + argsCount;
+  }
+  return recordsCount;
+}
+
+static void vfeInternalGpuPrintfDecodeRing(gpu_extra_gpu_printf_t gpuPrintf, unsigned ring) {
+  // NOTE(Constantine): vfAsyncWaitToFinish already made the readback visible to the CPU, and the ring isn't reacquired until it's decoded.
+  const gpu_storage_t * cpu = &gpuPrintf->rings[ring].cpu;
+  vfeGpuPrintfDecode(gpuPrintf->formatsCount, (const char * const *)gpuPrintf->formats, cpu->mapped_void_ptr, gpuPrintf->rings[ring].cpuBytesCount, gpuPrintf->callback, gpuPrintf->callbackUserData);
+
+  vfeInternalGpuPrintfLock(gpuPrintf);
+  gpuPrintf->droppedRecordsCount += cpu->as_u32[2];
+  vfeInternalGpuPrintfUnlock(gpuPrintf);
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI vfeInternalGpuPrintfDecoderMain(LPVOID parameter) {
+#else
+static void * vfeInternalGpuPrintfDecoderMain(void * parameter) {
+#endif
+  gpu_extra_gpu_printf_t gpuPrintf = (gpu_extra_gpu_printf_t)parameter;
+
+  for (;;) {
+    vfeInternalGpuPrintfLock(gpuPrintf);
+    while (gpuPrintf->queueCount == 0 && gpuPrintf->quit == 0) {
+      vfeInternalGpuPrintfWait(gpuPrintf, 0);
+    }
+    if (gpuPrintf->queueCount == 0) {
+      // NOTE(Constantine): Quitting only once the queue is empty.
+      vfeInternalGpuPrintfUnlock(gpuPrintf);
+      break;
+    }
+    const unsigned ring = gpuPrintf->queue[gpuPrintf->queueFirst];
+    gpuPrintf->queueFirst  = (gpuPrintf->queueFirst + 1) % gpuPrintf->ringsCount;
+    gpuPrintf->queueCount -= 1;
+    gpuPrintf->decoding    = 1;
+    vfeInternalGpuPrintfUnlock(gpuPrintf);
+
+    vfeInternalGpuPrintfDecodeRing(gpuPrintf, ring);
+
+    vfeInternalGpuPrintfLock(gpuPrintf);
+    gpuPrintf->rings[ring].state = VFE_GPU_PRINTF_RING_STATE_FREE;
+    gpuPrintf->decoding          = 0;
+    vfeInternalGpuPrintfWakeAll(gpuPrintf, 1);
+    vfeInternalGpuPrintfUnlock(gpuPrintf);
+  }
+
+#if defined(_WIN32)
+  return 0;
+#else
+  return NULL;
+#endif
+}
+
+GPU_API_PRE gpu_extra_gpu_printf_t GPU_API_POST vfeGpuPrintfCreate(gpu_handle_context_t context, const gpu_extra_gpu_printf_info_t * info, const char * optionalFile, int optionalLine) {
+  REDGPU_2_EXPECTFL(info != NULL);
+  REDGPU_2_EXPECTFL(info->formats_count == 0 || info->formats != NULL);
+  REDGPU_2_EXPECTFL(info->formats_count <= (VFE_GPU_PRINTF_RECORD_END_MARKER >> 4));
+
+  const unsigned ringsCount     = info->rings_count == 0 ? GPU_EXTRA_GPU_PRINTF_DEFAULT_RINGS_COUNT : info->rings_count;
+  const uint64_t ringBytesCount = info->ring_bytes_count == 0 ? GPU_EXTRA_GPU_PRINTF_DEFAULT_RING_BYTES_COUNT : info->ring_bytes_count;
+  REDGPU_2_EXPECTFL(ringBytesCount > GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT);
+  REDGPU_2_EXPECTFL(ringBytesCount % sizeof(uint32_t) == 0);
+  REDGPU_2_EXPECTFL((ringBytesCount - GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT) / sizeof(uint32_t) < VFE_GPU_PRINTF_RECORD_END_MARKER);
+
+  // To free
+  gpu_extra_gpu_printf_t gpuPrintf = (gpu_extra_gpu_printf_t)red32MemoryCalloc(sizeof(gpu_extra_type_gpu_printf_t));
+  REDGPU_2_EXPECTFL(gpuPrintf != NULL);
+  gpuPrintf->context          = context;
+  gpuPrintf->ringsCount       = ringsCount;
+  gpuPrintf->formatsCount     = info->formats_count;
+  gpuPrintf->callback         = info->optional_callback == NULL ? vfeInternalGpuPrintfDefaultCallback : info->optional_callback;
+  gpuPrintf->callbackUserData = info->optional_callback_user_data;
+  // To free
+  gpuPrintf->rings = (vfe_gpu_printf_ring_t *)red32MemoryCalloc(sizeof(vfe_gpu_printf_ring_t) * ringsCount);
+  gpuPrintf->queue = (unsigned *)red32MemoryCalloc(sizeof(unsigned) * ringsCount);
+  REDGPU_2_EXPECTFL(gpuPrintf->rings != NULL);
+  REDGPU_2_EXPECTFL(gpuPrintf->queue != NULL);
+
+  // NOTE(Constantine): The format pointers and the strings share one allocation.
+  uint64_t formatsBytesCount = sizeof(char *) * info->formats_count;
+  for (unsigned i = 0; i < info->formats_count; i += 1) {
+    REDGPU_2_EXPECTFL(info->formats[i] != NULL);
+    formatsBytesCount += strlen(info->formats[i]) + 1;
+  }
+  if (info->formats_count > 0) {
+    // To free
+    gpuPrintf->formats = (char **)red32MemoryCalloc(formatsBytesCount);
+    REDGPU_2_EXPECTFL(gpuPrintf->formats != NULL);
+    char * strings = (char *)&gpuPrintf->formats[info->formats_count];
+    for (unsigned i = 0; i < info->formats_count; i += 1) {
+      const uint64_t bytesCount = strlen(info->formats[i]) + 1;
+      red32MemoryCopy(strings, info->formats[i], bytesCount);
+      gpuPrintf->formats[i] = strings;
+      strings += bytesCount;
+    }
+  }
+
+  // To destroy
+  gpu_storage_info_t headerInfo = {0};
+  headerInfo.storage_type = GPU_STORAGE_TYPE_CPU_UPLOAD;
+  headerInfo.bytes_count  = GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT;
+  vfStorageCreate(context, &headerInfo, &gpuPrintf->headerTemplate, optionalFile, optionalLine);
+  gpuPrintf->headerTemplate.as_u32[0] = 0;
+  gpuPrintf->headerTemplate.as_u32[1] = (uint32_t)((ringBytesCount - GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT) / sizeof(uint32_t));
+  gpuPrintf->headerTemplate.as_u32[2] = 0;
+  gpuPrintf->headerTemplate.as_u32[3] = 0;
+
+  for (unsigned i = 0; i < ringsCount; i += 1) {
+    gpu_storage_info_t ringInfo = {0};
+    ringInfo.bytes_count  = ringBytesCount;
+    // To destroy
+    ringInfo.storage_type = GPU_STORAGE_TYPE_GPU_ONLY;
+    vfStorageCreate(context, &ringInfo, &gpuPrintf->rings[i].gpu, optionalFile, optionalLine);
+    // To destroy
+    ringInfo.storage_type = GPU_STORAGE_TYPE_CPU_READBACK;
+    vfStorageCreate(context, &ringInfo, &gpuPrintf->rings[i].cpu, optionalFile, optionalLine);
+  }
+
+#if defined(_WIN32)
+  InitializeSRWLock(&gpuPrintf->lock);
+  InitializeConditionVariable(&gpuPrintf->queueCondition);
+  InitializeConditionVariable(&gpuPrintf->freeCondition);
+  // To close
+  gpuPrintf->thread = CreateThread(NULL, 0, vfeInternalGpuPrintfDecoderMain, gpuPrintf, 0, NULL);
+  REDGPU_2_EXPECTFL(gpuPrintf->thread != NULL);
+#else
+  pthread_mutex_init(&gpuPrintf->lock, NULL);
+  pthread_cond_init(&gpuPrintf->queueCondition, NULL);
+  pthread_cond_init(&gpuPrintf->freeCondition, NULL);
+  // To join
+  int status = pthread_create(&gpuPrintf->thread, NULL, vfeInternalGpuPrintfDecoderMain, gpuPrintf);
+  REDGPU_2_EXPECTFL(status == 0);
+#endif
+
+  return gpuPrintf;
+}
+
+GPU_API_PRE void GPU_API_POST vfeGpuPrintfDestroy(gpu_extra_gpu_printf_t gpuPrintf, const char * optionalFile, int optionalLine) {
+  if (gpuPrintf == NULL) {
+    return;
+  }
+
+  vfeInternalGpuPrintfLock(gpuPrintf);
+  gpuPrintf->quit = 1;
+  vfeInternalGpuPrintfWakeAll(gpuPrintf, 0);
+  vfeInternalGpuPrintfUnlock(gpuPrintf);
+
+#if defined(_WIN32)
+  WaitForSingleObject(gpuPrintf->thread, INFINITE);
+  CloseHandle(gpuPrintf->thread);
+#else
+  pthread_join(gpuPrintf->thread, NULL);
+  pthread_cond_destroy(&gpuPrintf->freeCondition);
+  pthread_cond_destroy(&gpuPrintf->queueCondition);
+  pthread_mutex_destroy(&gpuPrintf->lock);
+#endif
+
+  for (unsigned i = 0; i < gpuPrintf->ringsCount; i += 1) {
+    const uint64_t ids[2] = {gpuPrintf->rings[i].gpu.id, gpuPrintf->rings[i].cpu.id};
+    vfIdDestroy(2, ids, optionalFile, optionalLine);
+    if (gpuPrintf->rings[i].copyBatch != 0) {
+      vfIdDestroy(1, &gpuPrintf->rings[i].copyBatch, optionalFile, optionalLine);
+    }
+  }
+  vfIdDestroy(1, &gpuPrintf->headerTemplate.id, optionalFile, optionalLine);
+
+  red32MemoryFree(gpuPrintf->formats);
+  red32MemoryFree(gpuPrintf->queue);
+  red32MemoryFree(gpuPrintf->rings);
+  red32MemoryFree(gpuPrintf);
+}
+
+GPU_API_PRE unsigned GPU_API_POST vfeGpuPrintfRingAcquire(gpu_extra_gpu_printf_t gpuPrintf, const char * optionalFile, int optionalLine) {
+  unsigned ring = gpuPrintf->ringsCount;
+
+  vfeInternalGpuPrintfLock(gpuPrintf);
+  for (;;) {
+    for (unsigned i = 0; i < gpuPrintf->ringsCount; i += 1) {
+      if (gpuPrintf->rings[i].state == VFE_GPU_PRINTF_RING_STATE_FREE) {
+        ring = i;
+        break;
+      }
+    }
+    if (ring < gpuPrintf->ringsCount) {
+      break;
+    }
+    // NOTE(Constantine): Every ring is acquired or released, one must be released for the wait to end.
+    unsigned releasedCount = 0;
+    for (unsigned i = 0; i < gpuPrintf->ringsCount; i += 1) {
+      releasedCount += gpuPrintf->rings[i].state == VFE_GPU_PRINTF_RING_STATE_RELEASED ? 1 : 0;
+    }
+    REDGPU_2_EXPECTFL(releasedCount > 0);
+    vfeInternalGpuPrintfWait(gpuPrintf, 1);
+  }
+  gpuPrintf->rings[ring].state = VFE_GPU_PRINTF_RING_STATE_ACQUIRED;
+  vfeInternalGpuPrintfUnlock(gpuPrintf);
+
+  return ring;
+}
+
+GPU_API_PRE gpu_storage_t GPU_API_POST vfeGpuPrintfRingGetStorage(gpu_extra_gpu_printf_t gpuPrintf, unsigned ring) {
+  return gpuPrintf->rings[ring].gpu;
+}
+
+static void vfeInternalGpuPrintfRingCopy(gpu_extra_gpu_printf_t gpuPrintf, unsigned ring, uint64_t batch, uint64_t bytesFirst, uint64_t bytesCount, const char * optionalFile, int optionalLine) {
+  RedStructMemberArray from = {0};
+  RedStructMemberArray to   = {0};
+  vfStorageGetRaw(gpuPrintf->context, gpuPrintf->rings[ring].gpu.id, &from, optionalFile, optionalLine);
+  vfStorageGetRaw(gpuPrintf->context, gpuPrintf->rings[ring].cpu.id, &to, optionalFile, optionalLine);
+  RedCopyArrayRange range = {0};
+  range.arrayRBytesFirst = from.arrayRangeBytesFirst + bytesFirst;
+  range.arrayWBytesFirst = to.arrayRangeBytesFirst + bytesFirst;
+  range.bytesCount       = bytesCount;
+  vfBatchStorageCopyRaw(gpuPrintf->context, batch, from.array, to.array, &range, optionalFile, optionalLine);
+}
+
+GPU_API_PRE void GPU_API_POST vfeGpuPrintfBatchRingBegin(gpu_extra_gpu_printf_t gpuPrintf, unsigned ring, uint64_t batch_id, const char * optionalFile, int optionalLine) {
+  REDGPU_2_EXPECTFL(ring < gpuPrintf->ringsCount);
+  REDGPU_2_EXPECTFL(gpuPrintf->rings[ring].state == VFE_GPU_PRINTF_RING_STATE_ACQUIRED);
+
+  // NOTE(Constantine): Only the header is reset, the records past the cursor are stale and never read.
+  vfBatchStorageCopyFromCpuToGpu(gpuPrintf->context, batch_id, gpuPrintf->headerTemplate.id, gpuPrintf->rings[ring].gpu.id, optionalFile, optionalLine);
+  vfBatchBarrierMemory(gpuPrintf->context, batch_id, optionalFile, optionalLine);
+}
+
+GPU_API_PRE void GPU_API_POST vfeGpuPrintfBatchRingEnd(gpu_extra_gpu_printf_t gpuPrintf, unsigned ring, uint64_t batch_id, const char * optionalFile, int optionalLine) {
+  REDGPU_2_EXPECTFL(ring < gpuPrintf->ringsCount);
+  REDGPU_2_EXPECTFL(gpuPrintf->rings[ring].state == VFE_GPU_PRINTF_RING_STATE_ACQUIRED);
+
+  // NOTE(Constantine): Only the header is copied back here, the records count isn't known until the batch finishes.
+  vfBatchBarrierMemory(gpuPrintf->context, batch_id, optionalFile, optionalLine);
+  vfeInternalGpuPrintfRingCopy(gpuPrintf, ring, batch_id, 0, GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT, optionalFile, optionalLine);
+  vfBatchBarrierCpuReadback(gpuPrintf->context, batch_id, optionalFile, optionalLine);
+}
+
+GPU_API_PRE void GPU_API_POST vfeGpuPrintfRingRelease(gpu_extra_gpu_printf_t gpuPrintf, unsigned ring, const char * optionalFile, int optionalLine) {
+  REDGPU_2_EXPECTFL(ring < gpuPrintf->ringsCount);
+
+  vfeInternalGpuPrintfLock(gpuPrintf);
+  REDGPU_2_EXPECTFL(gpuPrintf->rings[ring].state == VFE_GPU_PRINTF_RING_STATE_ACQUIRED);
+  vfeInternalGpuPrintfUnlock(gpuPrintf);
+
+  // NOTE(Constantine): The header copied back by the batch has the write head, only the records from the start of the ring up to it are
+  // copied back, so a batch that printed nothing costs the 16 bytes of the header and no second copy.
+  const uint32_t cursor            = gpuPrintf->rings[ring].cpu.as_u32[0];
+  const uint32_t capacity          = gpuPrintf->rings[ring].cpu.as_u32[1];
+  const uint64_t recordsBytesCount = (uint64_t)(cursor < capacity ? cursor : capacity) * sizeof(uint32_t);
+  if (recordsBytesCount > 0) {
+    vfe_gpu_printf_ring_t * printfRing = &gpuPrintf->rings[ring];
+    printfRing->copyBatch = vfBatchBegin(gpuPrintf->context, printfRing->copyBatch, NULL, "vkFast_vfeGpuPrintfRingRelease", optionalFile, optionalLine);
+    vfeInternalGpuPrintfRingCopy(gpuPrintf, ring, printfRing->copyBatch, GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT, recordsBytesCount, optionalFile, optionalLine);
+    vfBatchBarrierCpuReadback(gpuPrintf->context, printfRing->copyBatch, optionalFile, optionalLine);
+    vfBatchEnd(gpuPrintf->context, printfRing->copyBatch, optionalFile, optionalLine);
+    RedHandleCalls batchRaw = vfBatchGetRawHandle(gpuPrintf->context, printfRing->copyBatch, optionalFile, optionalLine);
+    vfAsyncWaitToFinish(gpuPrintf->context, vfAsyncBatchExecuteRaw(gpuPrintf->context, 1, &batchRaw, 0, NULL, NULL, optionalFile, optionalLine), optionalFile, optionalLine);
+  }
+  gpuPrintf->rings[ring].cpuBytesCount = GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT + recordsBytesCount;
+
+  vfeInternalGpuPrintfLock(gpuPrintf);
+  gpuPrintf->rings[ring].state = VFE_GPU_PRINTF_RING_STATE_RELEASED;
+  gpuPrintf->queue[(gpuPrintf->queueFirst + gpuPrintf->queueCount) % gpuPrintf->ringsCount] = ring;
+  gpuPrintf->queueCount += 1;
+  vfeInternalGpuPrintfWakeAll(gpuPrintf, 0);
+  vfeInternalGpuPrintfUnlock(gpuPrintf);
+}
+
+GPU_API_PRE void GPU_API_POST vfeGpuPrintfFlush(gpu_extra_gpu_printf_t gpuPrintf) {
+  vfeInternalGpuPrintfLock(gpuPrintf);
+  while (gpuPrintf->queueCount > 0 || gpuPrintf->decoding == 1) {
+    vfeInternalGpuPrintfWait(gpuPrintf, 1);
+  }
+  vfeInternalGpuPrintfUnlock(gpuPrintf);
+}
+
+GPU_API_PRE uint64_t GPU_API_POST vfeGpuPrintfGetDroppedRecordsCount(gpu_extra_gpu_printf_t gpuPrintf) {
+  vfeInternalGpuPrintfLock(gpuPrintf);
+  const uint64_t droppedRecordsCount = gpuPrintf->droppedRecordsCount;
+  vfeInternalGpuPrintfUnlock(gpuPrintf);
+  return droppedRecordsCount;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "../../vkfast.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// NOTE(Constantine):
+// A GPU printf that doesn't go through the validation layers like VKFAST_DEFINE_ENABLE_FEATURE_GPU_DEBUG_PRINTF does.
+// Kernels include vkfast_extra_gpu_printf.hlsl and call vfPrintf(ring, format_id, args...) which appends a compact record
+// (format id, args count and up to 8 uint args) to a ring storage bound as a RWByteAddressBuffer. The format strings stay
+// on the CPU, vfeGpuPrintfCreate() gets them once, a record's format id indexes them.
+//
+// Per batch:
+//   unsigned ring = vfeGpuPrintfRingAcquire(gpuPrintf, FF, LL);
+//   vfeGpuPrintfBatchRingBegin(gpuPrintf, ring, batch, FF, LL);
+//   ... bind vfeGpuPrintfRingGetStorage(gpuPrintf, ring) to the kernel's ring slot, vfBatchCompute ...
+//   vfeGpuPrintfBatchRingEnd(gpuPrintf, ring, batch, FF, LL);
+//   vfBatchEnd, vfAsyncBatchExecute, vfAsyncWaitToFinish
+//   vfeGpuPrintfRingRelease(gpuPrintf, ring, FF, LL);
+//
+// vfeGpuPrintfBatchRingBegin() resets the ring's cursor with a 16 bytes copy, so rings aren't cleared on the CPU and
+// a ring only holds the records of one batch. vfeGpuPrintfRingRelease() hands the ring's readback copy to a decoder
+// thread that formats the records and calls the callback there, so the thread that submits batches never formats
+// strings, and makes the ring available to vfeGpuPrintfRingAcquire() again. Records that don't fit into a ring are
+// dropped and counted, see vfeGpuPrintfGetDroppedRecordsCount(). Size a ring for the expected output of one batch.
+//
+// The batch only copies the ring header back, vfeGpuPrintfRingRelease() reads the records cursor from it and copies back
+// just the records the batch wrote with a second small copy it waits for, so a batch that printed nothing reads back
+// 16 bytes instead of the whole ring. vfeGpuPrintfDecode() decodes a CPU copy of a ring without a context.
+//
+// Supported conversions: %d %i %u %x %X %o %c %f %F %e %E %g %G and %%, with flags, width and precision. Floats are
+// passed to vfPrintf() as asuint(value).
+
+#define GPU_EXTRA_GPU_PRINTF_MAX_ARGS                      8
+#define GPU_EXTRA_GPU_PRINTF_RING_HEADER_BYTES_COUNT       16
+#define GPU_EXTRA_GPU_PRINTF_DEFAULT_RINGS_COUNT           4
+#define GPU_EXTRA_GPU_PRINTF_DEFAULT_RING_BYTES_COUNT      (256 * 1024)
+
+typedef struct gpu_extra_type_gpu_printf_t * gpu_extra_gpu_printf_t;
+
+typedef void (*gpu_extra_gpu_printf_callback_t)(const char * text, void * user_data); // NOTE(Constantine): Called on the decoder thread once per record, text has no trailing newline unless the format has one.
+
+typedef struct gpu_extra_gpu_printf_info_t {
+  unsigned                        rings_count;                 // NOTE(Constantine): 0 is GPU_EXTRA_GPU_PRINTF_DEFAULT_RINGS_COUNT.
+  unsigned                        reserved;
+  uint64_t                        ring_bytes_count;            // NOTE(Constantine): 0 is GPU_EXTRA_GPU_PRINTF_DEFAULT_RING_BYTES_COUNT, includes the ring header.
+  unsigned                        formats_count;
+  const char * const *            formats;                     // NOTE(Constantine): Copied.
+  gpu_extra_gpu_printf_callback_t optional_callback;           // NOTE(Constantine): NULL writes the records to stdout.
+  void *                          optional_callback_user_data;
+} gpu_extra_gpu_printf_info_t;
+
+GPU_API_PRE gpu_extra_gpu_printf_t GPU_API_POST vfeGpuPrintfCreate(gpu_handle_context_t context, const gpu_extra_gpu_printf_info_t * info, const char * optional_file, int optional_line); // NOTE(Constantine): The rings are storages of the context, vfContextResetAndInvalidateAllStorages invalidates them.
+GPU_API_PRE void GPU_API_POST vfeGpuPrintfDestroy(gpu_extra_gpu_printf_t gpu_printf, const char * optional_file, int optional_line); // NOTE(Constantine): Decodes the released rings first.
+GPU_API_PRE unsigned GPU_API_POST vfeGpuPrintfRingAcquire(gpu_extra_gpu_printf_t gpu_printf, const char * optional_file, int optional_line); // NOTE(Constantine): Waits while every ring is acquired or being decoded.
+GPU_API_PRE gpu_storage_t GPU_API_POST vfeGpuPrintfRingGetStorage(gpu_extra_gpu_printf_t gpu_printf, unsigned ring); // NOTE(Constantine): The GPU storage to bind as the kernel's RWByteAddressBuffer ring.
+GPU_API_PRE void GPU_API_POST vfeGpuPrintfBatchRingBegin(gpu_extra_gpu_printf_t gpu_printf, unsigned ring, uint64_t batch_id, const char * optional_file, int optional_line); // NOTE(Constantine): Before the first vfBatchCompute that prints.
+GPU_API_PRE void GPU_API_POST vfeGpuPrintfBatchRingEnd(gpu_extra_gpu_printf_t gpu_printf, unsigned ring, uint64_t batch_id, const char * optional_file, int optional_line); // NOTE(Constantine): After the last vfBatchCompute that prints.
+GPU_API_PRE void GPU_API_POST vfeGpuPrintfRingRelease(gpu_extra_gpu_printf_t gpu_printf, unsigned ring, const char * optional_file, int optional_line); // NOTE(Constantine): After vfAsyncWaitToFinish of the batch, waits for the copy of the printed records if there are any, but returns without waiting for the decoding.
+GPU_API_PRE void GPU_API_POST vfeGpuPrintfFlush(gpu_extra_gpu_printf_t gpu_printf); // NOTE(Constantine): Waits until every released ring is decoded.
+GPU_API_PRE uint64_t GPU_API_POST vfeGpuPrintfGetDroppedRecordsCount(gpu_extra_gpu_printf_t gpu_printf); // NOTE(Constantine): Of the decoded rings.
+GPU_API_PRE uint64_t GPU_API_POST vfeGpuPrintfDecode(unsigned formats_count, const char * const * formats, const void * ring, uint64_t ring_bytes_count, gpu_extra_gpu_printf_callback_t optional_callback, void * optional_callback_user_data); // NOTE(Constantine): Decodes ring_bytes_count bytes of a ring, the header included, on the calling thread and returns the decoded records count.
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,79 @@
+// NOTE(Constantine):
+// The kernel side of vkfast_extra_gpu_printf.h. The ring is a RWByteAddressBuffer of 32-bit words:
+//   word 0: records cursor, in words
+//   word 1: records capacity, in words
+//   word 2: dropped records count
+//   word 3: reserved
+//   words 4..: records, each one is a (format_id << 4 | args_count) word followed by args_count words
+// A record that doesn't fit is dropped, and if it starts inside the ring it writes the 0xFFFFFFFF end marker there, so
+// the decoder never reads the stale records of the previous batch.
+//
+// Usage:
+//   #include "vkfast_extra_gpu_printf.hlsl"
+//   [[vk::binding(0, 0)]] RWByteAddressBuffer printfRing : register(u0, space0);
+//   vfPrintf(printfRing, 0, id.x, asuint(value)); // NOTE(Constantine): formats[0] is "thread %u: %f\n" on the CPU.
+
+#ifndef VKFAST_EXTRA_GPU_PRINTF_HLSL
+#define VKFAST_EXTRA_GPU_PRINTF_HLSL
+
+#define VF_PRINTF_RING_HEADER_BYTES_COUNT 16
+#define VF_PRINTF_RECORD_END_MARKER       0xFFFFFFFF
+
+uint vfPrintfInternalReserve(RWByteAddressBuffer ring, uint formatId, uint argsCount) {
+  uint first = 0;
+  ring.InterlockedAdd(0, 1 + argsCount, first);
+  uint capacity = ring.Load(4);
+  if (first + 1 + argsCount > capacity) {
+    uint dropped = 0;
+    ring.InterlockedAdd(8, 1, dropped);
+    if (first < capacity) {
+      ring.Store(VF_PRINTF_RING_HEADER_BYTES_COUNT + first * 4, VF_PRINTF_RECORD_END_MARKER);
+    }
+    return VF_PRINTF_RECORD_END_MARKER;
+  }
+  uint address = VF_PRINTF_RING_HEADER_BYTES_COUNT + first * 4;
+  ring.Store(address, (formatId << 4) | argsCount);
+  return address + 4;
+}
+
+void vfPrintf(RWByteAddressBuffer ring, uint formatId) {
+  vfPrintfInternalReserve(ring, formatId, 0);
+}
+
+void vfPrintf(RWByteAddressBuffer ring, uint formatId, uint a0) {
+  uint address = vfPrintfInternalReserve(ring, formatId, 1);
+  if (address != VF_PRINTF_RECORD_END_MARKER) {
+    ring.Store(address, a0);
+  }
+}
+
+void vfPrintf(RWByteAddressBuffer ring, uint formatId, uint a0, uint a1) {
+  uint address = vfPrintfInternalReserve(ring, formatId, 2);
+  if (address != VF_PRINTF_RECORD_END_MARKER) {
+    ring.Store2(address, uint2(a0, a1));
+  }
+}
+
+void vfPrintf(RWByteAddressBuffer ring, uint formatId, uint a0, uint a1, uint a2) {
+  uint address = vfPrintfInternalReserve(ring, formatId, 3);
+  if (address != VF_PRINTF_RECORD_END_MARKER) {
+    ring.Store3(address, uint3(a0, a1, a2));
+  }
+}
+
+void vfPrintf(RWByteAddressBuffer ring, uint formatId, uint a0, uint a1, uint a2, uint a3) {
+  uint address = vfPrintfInternalReserve(ring, formatId, 4);
+  if (address != VF_PRINTF_RECORD_END_MARKER) {
+    ring.Store4(address, uint4(a0, a1, a2, a3));
+  }
+}
+
+void vfPrintf(RWByteAddressBuffer ring, uint formatId, uint a0, uint a1, uint a2, uint a3, uint a4, uint a5, uint a6, uint a7) {
+  uint address = vfPrintfInternalReserve(ring, formatId, 8);
+  if (address != VF_PRINTF_RECORD_END_MARKER) {
+    ring.Store4(address,      uint4(a0, a1, a2, a3));
+    ring.Store4(address + 16, uint4(a4, a5, a6, a7));
+  }
+}
+
+#endif
@@ -0,0 +1,435 @@
+#include "../../vkfast.h"
+#include "../../vkfast_ex.h"
+#include "../../vkfast_ids.h"
+
+#ifdef _WIN32
+#undef GPU_API_PRE
+#undef GPU_API_POST
+#define GPU_API_PRE __declspec(dllexport)
+#define GPU_API_POST
+#endif
+
+#include "vkfast_extra_multi_gpu.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#endif
+#include <string.h>
+
+typedef struct vfe_multi_gpu_program_pipeline_t {
+  uint64_t                     programs[GPU_EXTRA_MULTI_GPU_MAX_GPUS];
+  uint64_t                     programPipelines[GPU_EXTRA_MULTI_GPU_MAX_GPUS];
+  unsigned                     slotsCount;
+  RedStructDeclarationMember * slots;
+} vfe_multi_gpu_program_pipeline_t;
+
+typedef struct vfe_multi_gpu_storage_t {
+  gpu_storage_t cpu;      // NOTE(Constantine): GPU_STORAGE_TYPE_CPU_UPLOAD for inputs, GPU_STORAGE_TYPE_CPU_READBACK for the output.
+  gpu_storage_t gpu;
+  uint64_t      capacity;
+} vfe_multi_gpu_storage_t;
+
+typedef struct vfe_multi_gpu_device_t {
+  unsigned                               gpuIndex;
+  gpu_handle_context_t                   context;
+  uint64_t                               batch;
+  vfe_multi_gpu_storage_t                inputs[GPU_EXTRA_MULTI_GPU_MAX_INPUTS];
+  vfe_multi_gpu_storage_t                output;
+  double                                 throughput; // NOTE(Constantine): Split units per second, 0 until the first dispatch that gave this GPU a slice.
+  // NOTE(Constantine): Set for every dispatch.
+  const gpu_extra_multi_gpu_dispatch_t * dispatch;
+  unsigned                               splitUnitsFirst;
+  unsigned                               splitUnitsCount;
+  uint64_t                               nanoseconds;
+  const char *                           optionalFile;
+  int                                    optionalLine;
+#if defined(_WIN32)
+  HANDLE                                 thread;
+#else
+  pthread_t                              thread;
+#endif
+} vfe_multi_gpu_device_t;
+
+typedef struct gpu_extra_type_multi_gpu_t {
+  unsigned               gpusCount;
+  vfe_multi_gpu_device_t devices[GPU_EXTRA_MULTI_GPU_MAX_GPUS];
+} gpu_extra_type_multi_gpu_t;
+
+static uint64_t vfeInternalMultiGpuGetTimeNanoseconds(void) {
+#if defined(_WIN32)
+  LARGE_INTEGER frequency = {0};
+  LARGE_INTEGER counter   = {0};
+  QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&counter);
+  return (uint64_t)((counter.QuadPart / frequency.QuadPart) * 1000000000ULL + ((counter.QuadPart % frequency.QuadPart) * 1000000000ULL) / frequency.QuadPart);
+#else
+  struct timespec ts = {0};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+GPU_API_PRE gpu_extra_multi_gpu_t GPU_API_POST vfeMultiGpuInit(int enable_debug_mode, const gpu_context_optional_parameters_t * optional_parameters, const char * optionalFile, int optionalLine) {
+  REDGPU_2_EXPECTFL(optional_parameters == NULL || optional_parameters->optional_pointer_to_custom_vf_handle_context == NULL);
+
+  // To free
+  gpu_extra_multi_gpu_t multiGpu = (gpu_extra_multi_gpu_t)red32MemoryCalloc(sizeof(gpu_extra_type_multi_gpu_t));
+  REDGPU_2_EXPECTFL(multiGpu != NULL);
+
+  // NOTE(Constantine): Growable heaps, so the storages of vfeMultiGpuDispatch() can grow without resetting the storages of the user.
+  gpu_context_ex4_parameters_t ex4 = {0};
+  ex4.growableHeapsBlockBytesCount = GPU_EXTRA_MULTI_GPU_HEAPS_BLOCK_BYTES_COUNT;
+
+  // To deinit
+  multiGpu->devices[0].context = vfContextInitEx4(enable_debug_mode, 0, optional_parameters, NULL, NULL, &ex4, optionalFile, optionalLine);
+
+  // NOTE(Constantine): Every REDGPU context already has a device per GPU, the other vkFast contexts reuse the one of the first context.
+  RedContext context = vfContextGetRaw(multiGpu->devices[0].context, optionalFile, optionalLine);
+  multiGpu->gpusCount = context->gpusCount < GPU_EXTRA_MULTI_GPU_MAX_GPUS ? context->gpusCount : GPU_EXTRA_MULTI_GPU_MAX_GPUS;
+  for (unsigned i = 0; i < multiGpu->gpusCount; i += 1) {
+    multiGpu->devices[i].gpuIndex = i;
+  }
+
+  for (unsigned i = 1; i < multiGpu->gpusCount; i += 1) {
+    // To free (by vfContextDeinit)
+    vf_handle_context_t * vkfast = (vf_handle_context_t *)red32MemoryCalloc(sizeof(vf_handle_context_t));
+    REDGPU_2_EXPECTFL(vkfast != NULL);
+    vkfast->doNotDestroyRawContext = 1;
+    vkfast->doNotFreeHandle        = 0;
+    vkfast->context                = context;
+    vkfast->gpuIndex               = i;
+
+    gpu_context_optional_parameters_t parameters = {0};
+    parameters.internal_memory_allocation_sizes             = optional_parameters == NULL ? NULL : optional_parameters->internal_memory_allocation_sizes;
+    parameters.optional_pointer_to_custom_vf_handle_context = (void *)vkfast;
+    // To deinit
+    multiGpu->devices[i].context = vfContextInitEx4(enable_debug_mode, i, &parameters, NULL, NULL, &ex4, optionalFile, optionalLine);
+  }
+
+  return multiGpu;
+}
+
+GPU_API_PRE void GPU_API_POST vfeMultiGpuDeinit(gpu_extra_multi_gpu_t multiGpu, const char * optionalFile, int optionalLine) {
+  if (multiGpu == NULL) {
+    return;
+  }
+
+  // NOTE(Constantine): The first context owns the REDGPU context, so it's deinited last.
+  for (unsigned i = multiGpu->gpusCount; i > 0; i -= 1) {
+    vfe_multi_gpu_device_t * device = &multiGpu->devices[i - 1];
+    vfAllQueuesWaitIdle(device->context, optionalFile, optionalLine);
+    if (device->batch != 0) {
+      vfIdDestroy(1, &device->batch, optionalFile, optionalLine);
+    }
+    for (unsigned j = 0; j < GPU_EXTRA_MULTI_GPU_MAX_INPUTS; j += 1) {
+      if (device->inputs[j].capacity > 0) {
+        const uint64_t ids[2] = {device->inputs[j].cpu.id, device->inputs[j].gpu.id};
+        vfIdDestroy(2, ids, optionalFile, optionalLine);
+      }
+    }
+    if (device->output.capacity > 0) {
+      const uint64_t ids[2] = {device->output.cpu.id, device->output.gpu.id};
+      vfIdDestroy(2, ids, optionalFile, optionalLine);
+    }
+    vfContextDeinit(device->context, optionalFile, optionalLine);
+  }
+
+  red32MemoryFree(multiGpu);
+}
+
+GPU_API_PRE unsigned GPU_API_POST vfeMultiGpuGetGpusCount(gpu_extra_multi_gpu_t multiGpu) {
+  return multiGpu->gpusCount;
+}
+
+GPU_API_PRE gpu_handle_context_t GPU_API_POST vfeMultiGpuGetContext(gpu_extra_multi_gpu_t multiGpu, unsigned gpu_index) {
+  return gpu_index < multiGpu->gpusCount ? multiGpu->devices[gpu_index].context : NULL;
+}
+
+GPU_API_PRE uint64_t GPU_API_POST vfeMultiGpuProgramPipelineCreateCompute(gpu_extra_multi_gpu_t multiGpu, const gpu_program_info_t * program_info, const gpu_program_pipeline_compute_info_t * program_pipeline_compute_info, const char * optionalFile, int optionalLine) {
+  // To free
+  vfe_multi_gpu_program_pipeline_t * pipeline = (vfe_multi_gpu_program_pipeline_t *)red32MemoryCalloc(sizeof(vfe_multi_gpu_program_pipeline_t));
+  REDGPU_2_EXPECTFL(pipeline != NULL);
+
+  if (program_pipeline_compute_info->struct_members_count > 0) {
+    // To free
+    pipeline->slots = (RedStructDeclarationMember *)red32MemoryCalloc(sizeof(RedStructDeclarationMember) * program_pipeline_compute_info->struct_members_count);
+    REDGPU_2_EXPECTFL(pipeline->slots != NULL);
+    red32MemoryCopy(pipeline->slots, program_pipeline_compute_info->struct_members, sizeof(RedStructDeclarationMember) * program_pipeline_compute_info->struct_members_count);
+  }
+  pipeline->slotsCount = program_pipeline_compute_info->struct_members_count;
+
+  for (unsigned i = 0; i < multiGpu->gpusCount; i += 1) {
+    // To destroy
+    pipeline->programs[i] = vfProgramCreateFromBinaryCompute(multiGpu->devices[i].context, program_info, optionalFile, optionalLine);
+
+    gpu_program_pipeline_compute_info_t info = program_pipeline_compute_info[0];
+    info.compute_program = pipeline->programs[i];
+    // To destroy
+    pipeline->programPipelines[i] = vfProgramPipelineCreateCompute(multiGpu->devices[i].context, &info, optionalFile, optionalLine);
+  }
+
+  return (uint64_t)(void *)pipeline;
+}
+
+GPU_API_PRE void GPU_API_POST vfeMultiGpuProgramPipelineDestroy(gpu_extra_multi_gpu_t multiGpu, uint64_t program_pipeline_id, const char * optionalFile, int optionalLine) {
+  vfe_multi_gpu_program_pipeline_t * pipeline = (vfe_multi_gpu_program_pipeline_t *)(void *)program_pipeline_id;
+  if (pipeline == NULL) {
+    return;
+  }
+  for (unsigned i = 0; i < multiGpu->gpusCount; i += 1) {
+    const uint64_t ids[2] = {pipeline->programPipelines[i], pipeline->programs[i]};
+    vfIdDestroy(2, ids, optionalFile, optionalLine);
+  }
+  if (pipeline->slots != NULL) {
+    red32MemoryFree(pipeline->slots);
+  }
+  red32MemoryFree(pipeline);
+}
+
+// NOTE(Constantine): Storages are suballocated and can't be freed one by one. The contexts are shared with the user through
+// vfeMultiGpuGetContext(), so instead of resetting all storages of a context, the too small storages of the dispatcher are dropped
+// and the new ones grow the heaps. The dropped bytes stay in the earlier heap blocks until vfeMultiGpuDeinit(), capacities double,
+// so they add up to less than the current ones.
+static void vfeInternalMultiGpuStoragesReserve(vfe_multi_gpu_device_t * device, const uint64_t * inputsBytesCount, uint64_t outputBytesCount, const char * optionalFile, int optionalLine) {
+  int isTooSmall = outputBytesCount > device->output.capacity;
+  for (unsigned i = 0; i < GPU_EXTRA_MULTI_GPU_MAX_INPUTS; i += 1) {
+    if (inputsBytesCount[i] > device->inputs[i].capacity) {
+      isTooSmall = 1;
+    }
+  }
+  if (isTooSmall == 0) {
+    return;
+  }
+
+  // NOTE(Constantine): The previous dispatch of this device waited for its batch, the only one that uses these storages.
+  for (unsigned i = 0; i <= GPU_EXTRA_MULTI_GPU_MAX_INPUTS; i += 1) {
+    vfe_multi_gpu_storage_t * storage   = i < GPU_EXTRA_MULTI_GPU_MAX_INPUTS ? &device->inputs[i] : &device->output;
+    const uint64_t            needed  = i < GPU_EXTRA_MULTI_GPU_MAX_INPUTS ? inputsBytesCount[i] : outputBytesCount;
+    if (storage->capacity > 0) {
+      const uint64_t ids[2] = {storage->cpu.id, storage->gpu.id};
+      vfIdDestroy(2, ids, optionalFile, optionalLine);
+    }
+    memset(&storage->cpu, 0, sizeof(gpu_storage_t));
+    memset(&storage->gpu, 0, sizeof(gpu_storage_t));
+    if (needed > storage->capacity) {
+      storage->capacity = needed > storage->capacity * 2 ? needed : storage->capacity * 2;
+    }
+  }
+
+  for (unsigned i = 0; i <= GPU_EXTRA_MULTI_GPU_MAX_INPUTS; i += 1) {
+    vfe_multi_gpu_storage_t * storage = i < GPU_EXTRA_MULTI_GPU_MAX_INPUTS ? &device->inputs[i] : &device->output;
+    if (storage->capacity == 0) {
+      continue;
+    }
+    gpu_storage_info_t info = {0};
+    info.storage_type = i < GPU_EXTRA_MULTI_GPU_MAX_INPUTS ? GPU_STORAGE_TYPE_CPU_UPLOAD : GPU_STORAGE_TYPE_CPU_READBACK;
+    info.bytes_count  = storage->capacity;
+    // To destroy
+    vfStorageCreate(device->context, &info, &storage->cpu, optionalFile, optionalLine);
+    info.storage_type = GPU_STORAGE_TYPE_GPU_ONLY;
+    // To destroy
+    vfStorageCreate(device->context, &info, &storage->gpu, optionalFile, optionalLine);
+  }
+}
+
+static void vfeInternalMultiGpuStorageCopy(gpu_handle_context_t context, uint64_t batch, uint64_t fromStorageId, uint64_t toStorageId, uint64_t bytesCount, const char * optionalFile, int optionalLine) {
+  RedStructMemberArray from = {0};
+  RedStructMemberArray to   = {0};
+  vfStorageGetRaw(context, fromStorageId, &from, optionalFile, optionalLine);
+  vfStorageGetRaw(context, toStorageId, &to, optionalFile, optionalLine);
+  RedCopyArrayRange range = {0};
+  range.arrayRBytesFirst = from.arrayRangeBytesFirst;
+  range.arrayWBytesFirst = to.arrayRangeBytesFirst;
+  range.bytesCount       = bytesCount;
+  vfBatchStorageCopyRaw(context, batch, from.array, to.array, &range, optionalFile, optionalLine);
+}
+
+static void vfeInternalMultiGpuDeviceRun(vfe_multi_gpu_device_t * device) {
+  const gpu_extra_multi_gpu_dispatch_t * dispatch     = device->dispatch;
+  const char *                           optionalFile = device->optionalFile;
+  const int                              optionalLine = device->optionalLine;
+  gpu_handle_context_t                   context      = device->context;
+
+  uint64_t inputsBytesFirst[GPU_EXTRA_MULTI_GPU_MAX_INPUTS] = {0};
+  uint64_t inputsBytesCount[GPU_EXTRA_MULTI_GPU_MAX_INPUTS] = {0};
+  for (unsigned i = 0; i < dispatch->inputs_count; i += 1) {
+    const gpu_extra_multi_gpu_input_t * input = &dispatch->inputs[i];
+    if (input->bytes_per_split_unit == 0) {
+      inputsBytesFirst[i] = 0;
+      inputsBytesCount[i] = input->bytes_count;
+    } else {
+      const uint64_t first = device->splitUnitsFirst * input->bytes_per_split_unit;
+      const uint64_t count = device->splitUnitsCount * input->bytes_per_split_unit;
+      inputsBytesFirst[i] = first < input->bytes_count ? first : input->bytes_count;
+      inputsBytesCount[i] = count < input->bytes_count - inputsBytesFirst[i] ? count : input->bytes_count - inputsBytesFirst[i];
+    }
+  }
+  const uint64_t outputBytesCount = device->splitUnitsCount * dispatch->output_bytes_per_split_unit;
+
+  // NOTE(Constantine): A slice past the end of a partitioned input is empty, but the input still needs a storage to bind.
+  uint64_t inputsBytesReserve[GPU_EXTRA_MULTI_GPU_MAX_INPUTS] = {0};
+  for (unsigned i = 0; i < dispatch->inputs_count; i += 1) {
+    inputsBytesReserve[i] = inputsBytesCount[i] > 4 ? inputsBytesCount[i] : 4;
+  }
+
+  vfeInternalMultiGpuStoragesReserve(device, inputsBytesReserve, outputBytesCount, optionalFile, optionalLine);
+
+  for (unsigned i = 0; i < dispatch->inputs_count; i += 1) {
+    if (inputsBytesCount[i] > 0) {
+      red32MemoryCopy(device->inputs[i].cpu.mapped_void_ptr, (const uint8_t *)dispatch->inputs[i].data + inputsBytesFirst[i], inputsBytesCount[i]);
+    }
+  }
+
+  const vfe_multi_gpu_program_pipeline_t * pipeline = (const vfe_multi_gpu_program_pipeline_t *)(const void *)dispatch->program_pipeline_id;
+  const int      isSplitAlongY      = dispatch->workgroups_count_y > 1;
+  const unsigned workgroupOffset[2] = {
+    isSplitAlongY == 1 ? 0 : device->splitUnitsFirst,
+    isSplitAlongY == 1 ? device->splitUnitsFirst : 0,
+  };
+
+  gpu_batch_info_t batchInfo = {0};
+  batchInfo.use_bindings_sets_cache = 1;
+  device->batch = vfBatchBegin(context, device->batch, &batchInfo, "vkFast_vfeMultiGpuDispatch", optionalFile, optionalLine);
+  for (unsigned i = 0; i < dispatch->inputs_count; i += 1) {
+    if (inputsBytesCount[i] > 0) {
+      vfeInternalMultiGpuStorageCopy(context, device->batch, device->inputs[i].cpu.id, device->inputs[i].gpu.id, inputsBytesCount[i], optionalFile, optionalLine);
+    }
+  }
+  vfBatchBarrierMemory(context, device->batch, optionalFile, optionalLine);
+  vfBatchBindProgramPipelineCompute(context, device->batch, pipeline->programPipelines[device->gpuIndex], optionalFile, optionalLine);
+  vfBatchBindNewBindingsSet(context, device->batch, pipeline->slotsCount, pipeline->slots, optionalFile, optionalLine);
+  for (unsigned i = 0; i < dispatch->inputs_count; i += 1) {
+    vfBatchBindStorageSingleLimited(context, device->batch, dispatch->inputs[i].slot, device->inputs[i].gpu.id, 0, inputsBytesCount[i] > 0 ? inputsBytesCount[i] : device->inputs[i].capacity, optionalFile, optionalLine);
+  }
+  vfBatchBindStorageSingleLimited(context, device->batch, dispatch->output_slot, device->output.gpu.id, 0, outputBytesCount, optionalFile, optionalLine);
+  vfBatchBindNewBindingsEnd(context, device->batch, optionalFile, optionalLine);
+  if (dispatch->variables_bytes_count > 0) {
+    unsigned char variables[GPU_EXTRA_MULTI_GPU_MAX_VARIABLES_BYTES] = {0};
+    red32MemoryCopy(variables, dispatch->variables, dispatch->variables_bytes_count);
+    if (dispatch->variables_workgroup_offset_bytes_offset != GPU_EXTRA_MULTI_GPU_NO_WORKGROUP_OFFSET) {
+      red32MemoryCopy(&variables[dispatch->variables_workgroup_offset_bytes_offset], workgroupOffset, sizeof(workgroupOffset));
+    }
+    vfBatchBindVariablesCopy(context, device->batch, 0, dispatch->variables_bytes_count, variables, optionalFile, optionalLine);
+  }
+  vfBatchCompute(context, device->batch,
+    isSplitAlongY == 1 ? dispatch->workgroups_count_x : device->splitUnitsCount,
+    isSplitAlongY == 1 ? device->splitUnitsCount : 1,
+    1,
+    optionalFile, optionalLine
+  );
+  vfBatchBarrierMemory(context, device->batch, optionalFile, optionalLine);
+  vfeInternalMultiGpuStorageCopy(context, device->batch, device->output.gpu.id, device->output.cpu.id, outputBytesCount, optionalFile, optionalLine);
+  vfBatchBarrierCpuReadback(context, device->batch, optionalFile, optionalLine);
+  vfBatchEnd(context, device->batch, optionalFile, optionalLine);
+
+  // NOTE(Constantine): Only the submit and the wait are timed, storages growth and host copies would skew the throughput of the GPU.
+  RedHandleCalls batchRaw = vfBatchGetRawHandle(context, device->batch, optionalFile, optionalLine);
+  const uint64_t startNanoseconds = vfeInternalMultiGpuGetTimeNanoseconds();
+  const uint64_t async = vfAsyncBatchExecuteRaw(context, 1, &batchRaw, 0, NULL, NULL, optionalFile, optionalLine);
+  vfAsyncWaitToFinish(context, async, optionalFile, optionalLine);
+  device->nanoseconds = vfeInternalMultiGpuGetTimeNanoseconds() - startNanoseconds;
+
+  red32MemoryCopy((uint8_t *)dispatch->output + device->splitUnitsFirst * dispatch->output_bytes_per_split_unit, device->output.cpu.mapped_void_ptr, outputBytesCount);
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI vfeInternalMultiGpuDeviceMain(LPVOID parameter) {
+  vfeInternalMultiGpuDeviceRun((vfe_multi_gpu_device_t *)parameter);
+  return 0;
+}
+#else
+static void * vfeInternalMultiGpuDeviceMain(void * parameter) {
+  vfeInternalMultiGpuDeviceRun((vfe_multi_gpu_device_t *)parameter);
+  return NULL;
+}
+#endif
+
+GPU_API_PRE void GPU_API_POST vfeMultiGpuDispatch(gpu_extra_multi_gpu_t multiGpu, const gpu_extra_multi_gpu_dispatch_t * dispatch, gpu_extra_multi_gpu_dispatch_result_t * out_optional_result, const char * optionalFile, int optionalLine) {
+  REDGPU_2_EXPECTFL(dispatch->program_pipeline_id != 0);
+  REDGPU_2_EXPECTFL(dispatch->inputs_count <= GPU_EXTRA_MULTI_GPU_MAX_INPUTS);
+  REDGPU_2_EXPECTFL(dispatch->variables_bytes_count <= GPU_EXTRA_MULTI_GPU_MAX_VARIABLES_BYTES);
+  REDGPU_2_EXPECTFL(dispatch->variables_workgroup_offset_bytes_offset == GPU_EXTRA_MULTI_GPU_NO_WORKGROUP_OFFSET || dispatch->variables_workgroup_offset_bytes_offset + 2 * sizeof(unsigned) <= dispatch->variables_bytes_count);
+  REDGPU_2_EXPECTFL(dispatch->output_bytes_per_split_unit > 0);
+
+  const unsigned splitUnitsCount = dispatch->workgroups_count_y > 1 ? dispatch->workgroups_count_y : dispatch->workgroups_count_x;
+
+  // NOTE(Constantine): Slices are proportional to the measured throughputs, or equal until every GPU has one.
+  double throughputsSum     = 0;
+  int    isEveryGpuMeasured = 1;
+  for (unsigned i = 0; i < multiGpu->gpusCount; i += 1) {
+    throughputsSum += multiGpu->devices[i].throughput;
+    if (multiGpu->devices[i].throughput == 0) {
+      isEveryGpuMeasured = 0;
+    }
+  }
+  double   sharesSum       = 0;
+  unsigned splitUnitsFirst = 0;
+  for (unsigned i = 0; i < multiGpu->gpusCount; i += 1) {
+    vfe_multi_gpu_device_t * device = &multiGpu->devices[i];
+    sharesSum += isEveryGpuMeasured == 1 ? device->throughput / throughputsSum : 1.0 / multiGpu->gpusCount;
+    unsigned splitUnitsLast = i == multiGpu->gpusCount - 1 ? splitUnitsCount : (unsigned)(splitUnitsCount * sharesSum + 0.5);
+    splitUnitsLast = splitUnitsLast < splitUnitsFirst ? splitUnitsFirst : splitUnitsLast;
+    splitUnitsLast = splitUnitsLast > splitUnitsCount ? splitUnitsCount : splitUnitsLast;
+    device->dispatch        = dispatch;
+    device->splitUnitsFirst = splitUnitsFirst;
+    device->splitUnitsCount = splitUnitsLast - splitUnitsFirst;
+    device->nanoseconds     = 0;
+    device->optionalFile    = optionalFile;
+    device->optionalLine    = optionalLine;
+    splitUnitsFirst = splitUnitsLast;
+  }
+
+  // NOTE(Constantine): The calling thread drives the first GPU.
+  for (unsigned i = 1; i < multiGpu->gpusCount; i += 1) {
+    vfe_multi_gpu_device_t * device = &multiGpu->devices[i];
+    if (device->splitUnitsCount == 0) {
+      continue;
+    }
+#if defined(_WIN32)
+    device->thread = CreateThread(NULL, 0, vfeInternalMultiGpuDeviceMain, device, 0, NULL);
+    REDGPU_2_EXPECTFL(device->thread != NULL);
+#else
+    const int status = pthread_create(&device->thread, NULL, vfeInternalMultiGpuDeviceMain, device);
+    REDGPU_2_EXPECTFL(status == 0);
+#endif
+  }
+  if (multiGpu->devices[0].splitUnitsCount > 0) {
+    vfeInternalMultiGpuDeviceRun(&multiGpu->devices[0]);
+  }
+  for (unsigned i = 1; i < multiGpu->gpusCount; i += 1) {
+    vfe_multi_gpu_device_t * device = &multiGpu->devices[i];
+    if (device->splitUnitsCount == 0) {
+      continue;
+    }
+#if defined(_WIN32)
+    WaitForSingleObject(device->thread, INFINITE);
+    CloseHandle(device->thread);
+#else
+    pthread_join(device->thread, NULL);
+#endif
+  }
+
+  for (unsigned i = 0; i < multiGpu->gpusCount; i += 1) {
+    vfe_multi_gpu_device_t * device = &multiGpu->devices[i];
+    if (device->splitUnitsCount == 0 || device->nanoseconds == 0) {
+      continue;
+    }
+    const double measured = device->splitUnitsCount / (device->nanoseconds / 1000000000.0);
+    device->throughput = device->throughput == 0 ? measured : 0.5 * device->throughput + 0.5 * measured;
+  }
+
+  if (out_optional_result != NULL) {
+    gpu_extra_multi_gpu_dispatch_result_t result = {0};
+    result.gpus_count = multiGpu->gpusCount;
+    for (unsigned i = 0; i < multiGpu->gpusCount; i += 1) {
+      result.split_units_first[i] = multiGpu->devices[i].splitUnitsFirst;
+      result.split_units_count[i] = multiGpu->devices[i].splitUnitsCount;
+      result.nanoseconds[i]       = multiGpu->devices[i].nanoseconds;
+      result.throughput[i]        = multiGpu->devices[i].throughput;
+    }
+    out_optional_result[0] = result;
+  }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "../../vkfast.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// NOTE(Constantine):
+// Splits one compute dispatch across every GPU of the machine. vfeMultiGpuInit() creates one vkFast context per GPU on
+// a shared REDGPU context, vfeMultiGpuProgramPipelineCreateCompute() mirrors a program and its pipeline on each of them.
+// vfeMultiGpuDispatch() partitions a 1D domain along x or a 2D domain along y into contiguous slices, one per GPU, sized
+// by the throughput each GPU measured on the previous dispatches (equal slices on the first one). Every GPU uploads its
+// inputs, runs its slice and copies its part of the output back on its own CPU thread, so readbacks overlap, and the
+// slices are gathered into the host output in domain order. Outputs and partitioned inputs are sliced: a kernel sees
+// SV_DispatchThreadID relative to its slice, replicated inputs are uploaded whole to every GPU. If the kernel needs the
+// global position, set variables_workgroup_offset_bytes_offset and read the uint2 workgroup offset of the slice from there.
+// The contexts have growable heaps, storages the user creates on a context of vfeMultiGpuGetContext() stay valid: vfeMultiGpuDispatch()
+// never resets the storages of a context, its own storages grow the heaps by blocks of GPU_EXTRA_MULTI_GPU_HEAPS_BLOCK_BYTES_COUNT.
+
+#define GPU_EXTRA_MULTI_GPU_MAX_GPUS                       8
+#define GPU_EXTRA_MULTI_GPU_MAX_INPUTS                     15
+#define GPU_EXTRA_MULTI_GPU_MAX_VARIABLES_BYTES            256
+#define GPU_EXTRA_MULTI_GPU_NO_WORKGROUP_OFFSET            ((unsigned)-1)
+#define GPU_EXTRA_MULTI_GPU_HEAPS_BLOCK_BYTES_COUNT        (64ULL * 1024ULL * 1024ULL)
+
+typedef struct gpu_extra_type_multi_gpu_t * gpu_extra_multi_gpu_t;
+
+typedef struct gpu_extra_multi_gpu_input_t {
+  unsigned     slot;
+  unsigned     reserved;
+  uint64_t     bytes_count;
+  const void * data;
+  uint64_t     bytes_per_split_unit; // NOTE(Constantine): 0 uploads the whole input to every GPU, otherwise every GPU gets only the bytes of its slice.
+} gpu_extra_multi_gpu_input_t;
+
+typedef struct gpu_extra_multi_gpu_dispatch_t {
+  uint64_t                            program_pipeline_id;   // NOTE(Constantine): Returned by vfeMultiGpuProgramPipelineCreateCompute().
+  unsigned                            workgroups_count_x;
+  unsigned                            workgroups_count_y;    // NOTE(Constantine): If above 1, the domain is split along y in rows of workgroups, otherwise along x in workgroups.
+  unsigned                            inputs_count;
+  const gpu_extra_multi_gpu_input_t * inputs;
+  unsigned                            output_slot;
+  unsigned                            reserved;
+  uint64_t                            output_bytes_per_split_unit; // NOTE(Constantine): Bytes written by one workgroup (1D) or by one row of workgroups (2D).
+  void *                              output;                      // NOTE(Constantine): Receives split units count times output_bytes_per_split_unit bytes.
+  unsigned                            variables_bytes_count;
+  const void *                        variables;
+  unsigned                            variables_workgroup_offset_bytes_offset; // NOTE(Constantine): GPU_EXTRA_MULTI_GPU_NO_WORKGROUP_OFFSET or where the uint2 workgroup offset of the slice is written into the variables.
+} gpu_extra_multi_gpu_dispatch_t;
+
+typedef struct gpu_extra_multi_gpu_dispatch_result_t {
+  unsigned gpus_count;
+  unsigned split_units_first[GPU_EXTRA_MULTI_GPU_MAX_GPUS];
+  unsigned split_units_count[GPU_EXTRA_MULTI_GPU_MAX_GPUS];
+  uint64_t nanoseconds[GPU_EXTRA_MULTI_GPU_MAX_GPUS];      // NOTE(Constantine): Submit and wait of the batch of every GPU, they overlap. Excludes storages growth and host copies.
+  double   throughput[GPU_EXTRA_MULTI_GPU_MAX_GPUS];       // NOTE(Constantine): Split units per second after this dispatch, used to size the next slices.
+} gpu_extra_multi_gpu_dispatch_result_t;
+
+GPU_API_PRE gpu_extra_multi_gpu_t GPU_API_POST vfeMultiGpuInit(int enable_debug_mode, const gpu_context_optional_parameters_t * optional_parameters, const char * optional_file, int optional_line); // NOTE(Constantine): optional_parameters apply to every context, its optional_pointer_to_custom_vf_handle_context must be NULL.
+GPU_API_PRE void GPU_API_POST vfeMultiGpuDeinit(gpu_extra_multi_gpu_t multi_gpu, const char * optional_file, int optional_line);
+GPU_API_PRE unsigned GPU_API_POST vfeMultiGpuGetGpusCount(gpu_extra_multi_gpu_t multi_gpu);
+GPU_API_PRE gpu_handle_context_t GPU_API_POST vfeMultiGpuGetContext(gpu_extra_multi_gpu_t multi_gpu, unsigned gpu_index);
+GPU_API_PRE uint64_t GPU_API_POST vfeMultiGpuProgramPipelineCreateCompute(gpu_extra_multi_gpu_t multi_gpu, const gpu_program_info_t * program_info, const gpu_program_pipeline_compute_info_t * program_pipeline_compute_info, const char * optional_file, int optional_line); // NOTE(Constantine): program_pipeline_compute_info::compute_program is ignored.
+GPU_API_PRE void GPU_API_POST vfeMultiGpuProgramPipelineDestroy(gpu_extra_multi_gpu_t multi_gpu, uint64_t program_pipeline_id, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfeMultiGpuDispatch(gpu_extra_multi_gpu_t multi_gpu, const gpu_extra_multi_gpu_dispatch_t * dispatch, gpu_extra_multi_gpu_dispatch_result_t * out_optional_result, const char * optional_file, int optional_line); // NOTE(Constantine): Returns when the output is gathered.
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,412 @@
+#include "../../vkfast.h"
+#include "../../vkfast_ids.h"
+
+#ifdef _WIN32
+#undef GPU_API_PRE
+#undef GPU_API_POST
+#define GPU_API_PRE __declspec(dllexport)
+#define GPU_API_POST
+#endif
+
+#include "vkfast_extra_task_graph.h"
+
+#include <stdint.h> // For UINT32_MAX
+
+#ifndef __cplusplus
+#define REDGPU_DISABLE_NAMED_PARAMETERS
+#endif
+#if defined(_WIN32)
+  #if defined(VKFAST_INCLUDE_TERMUX_PATHS)
+    #include "/data/data/com.termux/files/home/RedGpuSDK/misc/np/np.h"
+    #include "/data/data/com.termux/files/home/RedGpuSDK/misc/np/np_redgpu.h"
+    #include "/data/data/com.termux/files/home/RedGpuSDK/misc/np/np_redgpu_2.h"
+    #include "/data/data/com.termux/files/home/RedGpuSDK/misc/np/np_redgpu_wsi.h"
+  #elif defined(VKFAST_INCLUDE_LINUX_PATHS)
+    #include "/home/linuxbrew/RedGpuSDK/misc/np/np.h"
+    #include "/home/linuxbrew/RedGpuSDK/misc/np/np_redgpu.h"
+    #include "/home/linuxbrew/RedGpuSDK/misc/np/np_redgpu_2.h"
+    #include "/home/linuxbrew/RedGpuSDK/misc/np/np_redgpu_wsi.h"
+  #else
+    #include "C:/RedGpuSDK/misc/np/np.h"
+    #include "C:/RedGpuSDK/misc/np/np_redgpu.h"
+    #include "C:/RedGpuSDK/misc/np/np_redgpu_2.h"
+    #include "C:/RedGpuSDK/misc/np/np_redgpu_wsi.h"
+  #endif
+#elif defined(__linux__) && !defined(__ANDROID__)
+  #include "/home/linuxbrew/RedGpuSDK/misc/np/np.h"
+  #include "/home/linuxbrew/RedGpuSDK/misc/np/np_redgpu.h"
+  #include "/home/linuxbrew/RedGpuSDK/misc/np/np_redgpu_2.h"
+  #include "/home/linuxbrew/RedGpuSDK/misc/np/np_redgpu_wsi.h"
+#else
+  #error Unsupported OS for now
+#endif
+
+static int vfeInternalTaskGraphStoragesIntersect(unsigned a_count, const uint64_t * a, unsigned b_count, const uint64_t * b) {
+  for (unsigned i = 0; i < a_count; i += 1) {
+    for (unsigned j = 0; j < b_count; j += 1) {
+      if (a[i] == b[j]) {
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+// NOTE(Constantine): Returns 1 if pass b, declared after pass a, must wait for pass a: RAW, WAR or WAW on any storage.
+static int vfeInternalTaskGraphPassDependsOn(const gpu_extra_task_graph_pass_t * b, const gpu_extra_task_graph_pass_t * a) {
+  if (vfeInternalTaskGraphStoragesIntersect(b->input_storages_count,  b->input_storages,  a->output_storages_count, a->output_storages) == 1) { return 1; }
+  if (vfeInternalTaskGraphStoragesIntersect(b->output_storages_count, b->output_storages, a->input_storages_count,  a->input_storages)  == 1) { return 1; }
+  if (vfeInternalTaskGraphStoragesIntersect(b->output_storages_count, b->output_storages, a->output_storages_count, a->output_storages) == 1) { return 1; }
+  return 0;
+}
+
+static void vfeInternalTaskGraphScheduleAddSignal(gpu_extra_task_graph_schedule_t * schedule, unsigned * signalsCapacity, unsigned fromSubmission, unsigned toSubmission) {
+  for (unsigned i = 0; i < schedule->signals_count; i += 1) {
+    if (schedule->signal_from_submission[i] == fromSubmission && schedule->signal_to_submission[i] == toSubmission) {
+      return;
+    }
+  }
+  if (schedule->signals_count == signalsCapacity[0]) {
+    unsigned capacity = signalsCapacity[0] == 0 ? 16 : signalsCapacity[0] * 2;
+    // To free
+    unsigned * from = (unsigned *)red32MemoryCalloc(sizeof(unsigned) * capacity);
+    unsigned * to   = (unsigned *)red32MemoryCalloc(sizeof(unsigned) * capacity);
+    REDGPU_2_EXPECTFL(from != NULL);
+    REDGPU_2_EXPECTFL(to != NULL);
+    for (unsigned i = 0; i < schedule->signals_count; i += 1) {
+      from[i] = schedule->signal_from_submission[i];
+      to[i]   = schedule->signal_to_submission[i];
+    }
+    if (schedule->signal_from_submission != NULL) { red32MemoryFree(schedule->signal_from_submission); }
+    if (schedule->signal_to_submission   != NULL) { red32MemoryFree(schedule->signal_to_submission);   }
+    schedule->signal_from_submission = from;
+    schedule->signal_to_submission   = to;
+    signalsCapacity[0] = capacity;
+  }
+  schedule->signal_from_submission[schedule->signals_count] = fromSubmission;
+  schedule->signal_to_submission[schedule->signals_count]   = toSubmission;
+  schedule->signals_count += 1;
+}
+
+// NOTE(Constantine): Everything the schedule depends on, in the order vfeTaskGraphHash() hashes it. Writes the words to words, or if
+// isCompare is 1, returns 0 on the first word that differs from words, which must hold vfeInternalTaskGraphKeyWordsCount() of them.
+static int vfeInternalTaskGraphKeyWriteOrCompare(unsigned passes_count, const gpu_extra_task_graph_pass_t * passes, uint64_t * words, int isCompare) {
+  uint64_t w = 0;
+  #define VFE_INTERNAL_TASK_GRAPH_KEY(value) if (isCompare == 1) { if (words[w] != (uint64_t)(value)) { return 0; } } else { words[w] = (uint64_t)(value); } w += 1
+  VFE_INTERNAL_TASK_GRAPH_KEY(passes_count);
+  for (unsigned i = 0; i < passes_count; i += 1) {
+    VFE_INTERNAL_TASK_GRAPH_KEY(passes[i].queue_index);
+    VFE_INTERNAL_TASK_GRAPH_KEY(passes[i].input_storages_count);
+    for (unsigned j = 0; j < passes[i].input_storages_count; j += 1) {
+      VFE_INTERNAL_TASK_GRAPH_KEY(passes[i].input_storages[j]);
+    }
+    VFE_INTERNAL_TASK_GRAPH_KEY(passes[i].output_storages_count);
+    for (unsigned j = 0; j < passes[i].output_storages_count; j += 1) {
+      VFE_INTERNAL_TASK_GRAPH_KEY(passes[i].output_storages[j]);
+    }
+  }
+  #undef VFE_INTERNAL_TASK_GRAPH_KEY
+  return 1;
+}
+
+static uint64_t vfeInternalTaskGraphKeyWordsCount(unsigned passes_count, const gpu_extra_task_graph_pass_t * passes) {
+  uint64_t wordsCount = 1;
+  for (unsigned i = 0; i < passes_count; i += 1) {
+    wordsCount += 3 + passes[i].input_storages_count + passes[i].output_storages_count;
+  }
+  return wordsCount;
+}
+
+GPU_API_PRE uint64_t GPU_API_POST vfeTaskGraphHash(unsigned passes_count, const gpu_extra_task_graph_pass_t * passes) {
+  // NOTE(Constantine): FNV-1a over everything the schedule depends on.
+  uint64_t hash = 14695981039346656037ULL;
+  #define VFE_INTERNAL_TASK_GRAPH_HASH(value) hash = (hash ^ (uint64_t)(value)) * 1099511628211ULL
+  VFE_INTERNAL_TASK_GRAPH_HASH(passes_count);
+  for (unsigned i = 0; i < passes_count; i += 1) {
+    VFE_INTERNAL_TASK_GRAPH_HASH(passes[i].queue_index);
+    VFE_INTERNAL_TASK_GRAPH_HASH(passes[i].input_storages_count);
+    for (unsigned j = 0; j < passes[i].input_storages_count; j += 1) {
+      VFE_INTERNAL_TASK_GRAPH_HASH(passes[i].input_storages[j]);
+    }
+    VFE_INTERNAL_TASK_GRAPH_HASH(passes[i].output_storages_count);
+    for (unsigned j = 0; j < passes[i].output_storages_count; j += 1) {
+      VFE_INTERNAL_TASK_GRAPH_HASH(passes[i].output_storages[j]);
+    }
+  }
+  #undef VFE_INTERNAL_TASK_GRAPH_HASH
+  return hash;
+}
+
+GPU_API_PRE void GPU_API_POST vfeTaskGraphScheduleCompile(unsigned passes_count, const gpu_extra_task_graph_pass_t * passes, unsigned queues_count, gpu_extra_task_graph_schedule_t * out_schedule) {
+  REDGPU_2_EXPECTFL(passes_count > 0);
+  REDGPU_2_EXPECTFL(queues_count > 0);
+
+  gpu_extra_task_graph_schedule_t schedule = {0};
+  schedule.hash            = vfeTaskGraphHash(passes_count, passes);
+  schedule.key_words_count = vfeInternalTaskGraphKeyWordsCount(passes_count, passes);
+  schedule.passes_count    = passes_count;
+
+  // To free
+  schedule.key_words = (uint64_t *)red32MemoryCalloc(sizeof(uint64_t) * schedule.key_words_count);
+  REDGPU_2_EXPECTFL(schedule.key_words != NULL);
+  vfeInternalTaskGraphKeyWriteOrCompare(passes_count, passes, schedule.key_words, 0);
+
+  // To free
+  schedule.pass_queue_index        = (unsigned *)red32MemoryCalloc(sizeof(unsigned) * passes_count);
+  schedule.pass_submission_index   = (unsigned *)red32MemoryCalloc(sizeof(unsigned) * passes_count);
+  schedule.pass_barrier_before     = (unsigned *)red32MemoryCalloc(sizeof(unsigned) * passes_count);
+  schedule.submission_queue_index  = (unsigned *)red32MemoryCalloc(sizeof(unsigned) * passes_count);
+  schedule.submission_passes_first = (unsigned *)red32MemoryCalloc(sizeof(unsigned) * passes_count);
+  schedule.submission_passes_count = (unsigned *)red32MemoryCalloc(sizeof(unsigned) * passes_count);
+  REDGPU_2_EXPECTFL(schedule.pass_queue_index        != NULL);
+  REDGPU_2_EXPECTFL(schedule.pass_submission_index   != NULL);
+  REDGPU_2_EXPECTFL(schedule.pass_barrier_before     != NULL);
+  REDGPU_2_EXPECTFL(schedule.submission_queue_index  != NULL);
+  REDGPU_2_EXPECTFL(schedule.submission_passes_first != NULL);
+  REDGPU_2_EXPECTFL(schedule.submission_passes_count != NULL);
+
+  // NOTE(Constantine): A barrier recorded before pass k orders it after every pass submitted to the same queue before k,
+  // so barrierFences[q] is the index of the last pass on queue q that got one, UINT32_MAX if none did yet.
+  // To free
+  unsigned * barrierFences = (unsigned *)red32MemoryCalloc(sizeof(unsigned) * queues_count);
+  REDGPU_2_EXPECTFL(barrierFences != NULL);
+  for (unsigned q = 0; q < queues_count; q += 1) {
+    barrierFences[q] = UINT32_MAX;
+  }
+
+  unsigned signalsCapacity = 0;
+
+  for (unsigned i = 0; i < passes_count; i += 1) {
+    const gpu_extra_task_graph_pass_t * pass = &passes[i];
+
+    unsigned queue = pass->queue_index;
+    if (queue == GPU_EXTRA_TASK_GRAPH_QUEUE_AUTO) {
+      queue = 0;
+      for (unsigned j = i; j > 0; j -= 1) {
+        if (vfeInternalTaskGraphPassDependsOn(pass, &passes[j - 1]) == 1) {
+          queue = schedule.pass_queue_index[j - 1];
+          break;
+        }
+      }
+    }
+    REDGPU_2_EXPECTFL(queue < queues_count);
+    schedule.pass_queue_index[i] = queue;
+
+    if (i == 0 || schedule.pass_queue_index[i - 1] != queue) {
+      schedule.submission_queue_index[schedule.submissions_count]  = queue;
+      schedule.submission_passes_first[schedule.submissions_count] = i;
+      schedule.submissions_count += 1;
+    }
+    const unsigned submission = schedule.submissions_count - 1;
+    schedule.pass_submission_index[i] = submission;
+    schedule.submission_passes_count[submission] += 1;
+
+    for (unsigned j = 0; j < i; j += 1) {
+      if (vfeInternalTaskGraphPassDependsOn(pass, &passes[j]) == 0) {
+        continue;
+      }
+      if (schedule.pass_queue_index[j] == queue) {
+        if (barrierFences[queue] == UINT32_MAX || j >= barrierFences[queue]) {
+          schedule.pass_barrier_before[i] = 1;
+          barrierFences[queue] = i;
+        }
+      } else {
+        vfeInternalTaskGraphScheduleAddSignal(&schedule, &signalsCapacity, schedule.pass_submission_index[j], submission);
+      }
+    }
+  }
+
+  // NOTE(Constantine): The join submission goes to the queue of the last submission, which already orders after
+  // everything submitted to that queue, so only the last submission of every other queue has to signal it.
+  const unsigned joinQueue = schedule.submission_queue_index[schedule.submissions_count - 1];
+  for (unsigned q = 0; q < queues_count; q += 1) {
+    if (q == joinQueue) {
+      continue;
+    }
+    for (unsigned s = schedule.submissions_count; s > 0; s -= 1) {
+      if (schedule.submission_queue_index[s - 1] == q) {
+        vfeInternalTaskGraphScheduleAddSignal(&schedule, &signalsCapacity, s - 1, schedule.submissions_count);
+        break;
+      }
+    }
+  }
+
+  red32MemoryFree(barrierFences);
+
+  out_schedule[0] = schedule;
+}
+
+GPU_API_PRE RedBool32 GPU_API_POST vfeTaskGraphScheduleMatches(const gpu_extra_task_graph_schedule_t * schedule, unsigned passes_count, const gpu_extra_task_graph_pass_t * passes) {
+  if (schedule->submissions_count == 0 || schedule->hash != vfeTaskGraphHash(passes_count, passes)) {
+    return 0;
+  }
+  // NOTE(Constantine): Equal hashes of different passes would reuse a schedule with the wrong barriers and signals, so the key is compared too.
+  if (schedule->key_words_count != vfeInternalTaskGraphKeyWordsCount(passes_count, passes)) {
+    return 0;
+  }
+  return vfeInternalTaskGraphKeyWriteOrCompare(passes_count, passes, schedule->key_words, 1) == 1 ? 1 : 0;
+}
+
+GPU_API_PRE void GPU_API_POST vfeTaskGraphScheduleFree(gpu_extra_task_graph_schedule_t * schedule) {
+  if (schedule->key_words               != NULL) { red32MemoryFree(schedule->key_words);               }
+  if (schedule->pass_queue_index        != NULL) { red32MemoryFree(schedule->pass_queue_index);        }
+  if (schedule->pass_submission_index   != NULL) { red32MemoryFree(schedule->pass_submission_index);   }
+  if (schedule->pass_barrier_before     != NULL) { red32MemoryFree(schedule->pass_barrier_before);     }
+  if (schedule->submission_queue_index  != NULL) { red32MemoryFree(schedule->submission_queue_index);  }
+  if (schedule->submission_passes_first != NULL) { red32MemoryFree(schedule->submission_passes_first); }
+  if (schedule->submission_passes_count != NULL) { red32MemoryFree(schedule->submission_passes_count); }
+  if (schedule->signal_from_submission  != NULL) { red32MemoryFree(schedule->signal_from_submission);  }
+  if (schedule->signal_to_submission    != NULL) { red32MemoryFree(schedule->signal_to_submission);    }
+  gpu_extra_task_graph_schedule_t empty = {0};
+  schedule[0] = empty;
+}
+
+GPU_API_PRE void GPU_API_POST vfeTaskGraphDestroy(gpu_handle_context_t context, gpu_extra_task_graph_t * graph, const char * optionalFile, int optionalLine) {
+  if (graph->batches != NULL) {
+    vfIdDestroy(graph->schedule.submissions_count, graph->batches, optionalFile, optionalLine);
+    red32MemoryFree(graph->batches);
+  }
+  if (graph->signals != NULL) {
+    for (unsigned i = 0; i < graph->schedule.signals_count; i += 1) {
+      vfGpuThreadDestroy(context, graph->signals[i]);
+    }
+    red32MemoryFree(graph->signals);
+  }
+  if (graph->signals_array_of_65536_int_values != NULL) { red32MemoryFree(graph->signals_array_of_65536_int_values); }
+  if (graph->scratch_waits                     != NULL) { red32MemoryFree(graph->scratch_waits);                     }
+  if (graph->scratch_signals                   != NULL) { red32MemoryFree(graph->scratch_signals);                   }
+  vfeTaskGraphScheduleFree(&graph->schedule);
+
+  gpu_extra_task_graph_t empty = {0};
+  graph[0] = empty;
+}
+
+GPU_API_PRE uint64_t GPU_API_POST vfeTaskGraphExecute(gpu_handle_context_t context, gpu_extra_task_graph_t * graph, unsigned passes_count, const gpu_extra_task_graph_pass_t * passes, const gpu_batch_info_t * batch_info, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+  RedHandleGpu gpu = vkfast->gpu;
+
+  if (vfeTaskGraphScheduleMatches(&graph->schedule, passes_count, passes) == 0) {
+    vfeTaskGraphDestroy(context, graph, optionalFile, optionalLine);
+
+    vfeTaskGraphScheduleCompile(passes_count, passes, vkfast->gpuInfo->queuesCount, &graph->schedule);
+
+    const unsigned signalsCount = graph->schedule.signals_count;
+    // To free
+    graph->batches                           = (uint64_t *)red32MemoryCalloc(sizeof(uint64_t) * graph->schedule.submissions_count);
+    graph->signals                           = (gpu_thread_t *)red32MemoryCalloc(sizeof(gpu_thread_t) * (signalsCount + 1));
+    graph->signals_array_of_65536_int_values = (unsigned *)red32MemoryCalloc(sizeof(unsigned) * (signalsCount + 1));
+    graph->scratch_waits                     = (gpu_thread_t *)red32MemoryCalloc(sizeof(gpu_thread_t) * (signalsCount + 1));
+    graph->scratch_signals                   = (gpu_thread_t *)red32MemoryCalloc(sizeof(gpu_thread_t) * (signalsCount + 1));
+    REDGPU_2_EXPECTWG(graph->batches                           != NULL);
+    REDGPU_2_EXPECTWG(graph->signals                           != NULL);
+    REDGPU_2_EXPECTWG(graph->signals_array_of_65536_int_values != NULL);
+    REDGPU_2_EXPECTWG(graph->scratch_waits                     != NULL);
+    REDGPU_2_EXPECTWG(graph->scratch_signals                   != NULL);
+    for (unsigned i = 0; i < signalsCount + 1; i += 1) {
+      graph->signals_array_of_65536_int_values[i] = 65536;
+    }
+    // NOTE(Constantine): Not vfGpuThreadCreate(), these signals must start unsignaled, since each is signaled and waited on once per execution.
+    for (unsigned i = 0; i < signalsCount; i += 1) {
+      np(redCreateGpuSignal,
+        "context", vkfast->context,
+        "gpu", gpu,
+        "handleName", "vkFast_vfeTaskGraphExecute_signal",
+        "outGpuSignal", &graph->signals[i],
+        "outStatuses", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      REDGPU_2_EXPECTWG(graph->signals[i] != NULL);
+    }
+  }
+
+  const gpu_extra_task_graph_schedule_t * schedule = &graph->schedule;
+
+  for (unsigned i = 0; i < passes_count; i += 1) {
+    for (unsigned j = 0; j < passes[i].input_storages_count; j += 1) {
+      vf_handle_t * storage = (vf_handle_t *)(void *)passes[i].input_storages[j];
+      if (storage->storage.info.storage_type == GPU_STORAGE_TYPE_CPU_UPLOAD) {
+        vfStorageCpuUploadFlush(context, passes[i].input_storages[j], optionalFile, optionalLine);
+      }
+    }
+  }
+
+  for (unsigned s = 0; s < schedule->submissions_count + 1; s += 1) {
+    const int isJoin = s == schedule->submissions_count ? 1 : 0;
+    const unsigned queueIndex = isJoin == 1 ? schedule->submission_queue_index[s - 1] : schedule->submission_queue_index[s];
+
+    RedHandleCalls calls = NULL;
+    if (isJoin == 0) {
+      const unsigned passesFirst = schedule->submission_passes_first[s];
+      graph->batches[s] = vfBatchBeginEx(context, graph->batches[s], batch_info, queueIndex, passes[passesFirst].optional_debug_name, optionalFile, optionalLine);
+      for (unsigned i = passesFirst; i < passesFirst + schedule->submission_passes_count[s]; i += 1) {
+        if (schedule->pass_barrier_before[i] == 1) {
+          vfBatchBarrierMemory(context, graph->batches[s], optionalFile, optionalLine);
+        }
+        passes[i].record(context, graph->batches[s], passes[i].record_user_data);
+      }
+      vfBatchEnd(context, graph->batches[s], optionalFile, optionalLine);
+      calls = vfBatchGetRawHandle(context, graph->batches[s], optionalFile, optionalLine);
+    }
+
+    unsigned waitsCount   = 0;
+    unsigned signalsCount = 0;
+    for (unsigned i = 0; i < schedule->signals_count; i += 1) {
+      if (schedule->signal_to_submission[i] == s) {
+        graph->scratch_waits[waitsCount] = graph->signals[i];
+        waitsCount += 1;
+      }
+      if (schedule->signal_from_submission[i] == s) {
+        graph->scratch_signals[signalsCount] = graph->signals[i];
+        signalsCount += 1;
+      }
+    }
+
+    // To destroy
+    RedHandleCpuSignal cpuSignal = NULL;
+    if (isJoin == 1) {
+      np(redCreateCpuSignal,
+        "context", vkfast->context,
+        "gpu", gpu,
+        "handleName", NULL,
+        "createSignaled", 0,
+        "outCpuSignal", &cpuSignal,
+        "outStatuses", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      REDGPU_2_EXPECTWG(cpuSignal != NULL);
+    }
+
+    RedGpuTimeline timelines[1] = {0};
+    timelines[0].setTo4                            = 4;
+    timelines[0].setTo0                            = 0;
+    timelines[0].waitForAndUnsignalGpuSignalsCount = waitsCount;
+    timelines[0].waitForAndUnsignalGpuSignals      = graph->scratch_waits;
+    timelines[0].setTo65536                        = graph->signals_array_of_65536_int_values;
+    timelines[0].callsCount                        = isJoin == 1 ? 0 : 1;
+    timelines[0].calls                             = isJoin == 1 ? NULL : &calls;
+    timelines[0].signalGpuSignalsCount             = signalsCount;
+    timelines[0].signalGpuSignals                  = graph->scratch_signals;
+    np(redQueueSubmit,
+      "context", vkfast->context,
+      "gpu", gpu,
+      "queue", vkfast->gpuInfo->queues[queueIndex],
+      "timelinesCount", 1,
+      "timelines", timelines,
+      "signalCpuSignal", cpuSignal,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+
+    if (isJoin == 1) {
+      return (uint64_t)(void *)cpuSignal;
+    }
+  }
+
+  return 0;
+}
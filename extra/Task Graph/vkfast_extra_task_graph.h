@@ -0,0 +1,67 @@
+#pragma once
+
+#include "../../vkfast.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// NOTE(Constantine):
+// Passes are declared in program order with the storages they read and write. vfeTaskGraphScheduleCompile()
+// derives read-after-write, write-after-read and write-after-write dependencies between them, groups consecutive
+// passes of the same queue into one submission, records a memory barrier only before passes that depend on an
+// earlier pass of the same queue, and allocates one GPU signal per cross-queue submission dependency.
+// It makes no GPU calls, so schedules can be inspected and tested without a context.
+
+#define GPU_EXTRA_TASK_GRAPH_QUEUE_AUTO ((unsigned)-1) // NOTE(Constantine): Runs the pass on the queue of the last pass it depends on, or on queue 0.
+
+typedef void (*gpu_extra_task_graph_pass_record_t)(gpu_handle_context_t context, uint64_t batch_id, void * user_data);
+
+typedef struct gpu_extra_task_graph_pass_t {
+  unsigned                           queue_index; // NOTE(Constantine): Index into RedGpuInfo::queues or GPU_EXTRA_TASK_GRAPH_QUEUE_AUTO.
+  unsigned                           input_storages_count;
+  const uint64_t *                   input_storages;
+  unsigned                           output_storages_count;
+  const uint64_t *                   output_storages;
+  gpu_extra_task_graph_pass_record_t record;
+  void *                             record_user_data;
+  const char *                       optional_debug_name;
+} gpu_extra_task_graph_pass_t;
+
+typedef struct gpu_extra_task_graph_schedule_t {
+  uint64_t   hash;
+  uint64_t   key_words_count;
+  uint64_t * key_words;              // NOTE(Constantine): The queues and storages of the passes the schedule was compiled for, compared when the hash matches.
+  unsigned   passes_count;
+  unsigned * pass_queue_index;
+  unsigned * pass_submission_index;
+  unsigned * pass_barrier_before;
+  unsigned   submissions_count;
+  unsigned * submission_queue_index;
+  unsigned * submission_passes_first;
+  unsigned * submission_passes_count;
+  unsigned   signals_count;
+  unsigned * signal_from_submission;
+  unsigned * signal_to_submission;   // NOTE(Constantine): submissions_count is the final join submission that signals the CPU.
+} gpu_extra_task_graph_schedule_t;
+
+typedef struct gpu_extra_task_graph_t {
+  gpu_extra_task_graph_schedule_t schedule;
+  uint64_t *                      batches;
+  gpu_thread_t *                  signals;
+  unsigned *                      signals_array_of_65536_int_values;
+  gpu_thread_t *                  scratch_waits;
+  gpu_thread_t *                  scratch_signals;
+} gpu_extra_task_graph_t;
+
+GPU_API_PRE uint64_t GPU_API_POST vfeTaskGraphHash(unsigned passes_count, const gpu_extra_task_graph_pass_t * passes);
+GPU_API_PRE void GPU_API_POST vfeTaskGraphScheduleCompile(unsigned passes_count, const gpu_extra_task_graph_pass_t * passes, unsigned queues_count, gpu_extra_task_graph_schedule_t * out_schedule);
+GPU_API_PRE RedBool32 GPU_API_POST vfeTaskGraphScheduleMatches(const gpu_extra_task_graph_schedule_t * schedule, unsigned passes_count, const gpu_extra_task_graph_pass_t * passes); // NOTE(Constantine): Returns 1 if schedule was compiled for the same passes, queues and storages.
+GPU_API_PRE void GPU_API_POST vfeTaskGraphScheduleFree(gpu_extra_task_graph_schedule_t * schedule);
+// NOTE(Constantine): Recompiles only if the passes, their queues or their storages changed since the previous call. Wait for the returned async id before the next call.
+GPU_API_PRE uint64_t GPU_API_POST vfeTaskGraphExecute(gpu_handle_context_t context, gpu_extra_task_graph_t * graph, unsigned passes_count, const gpu_extra_task_graph_pass_t * passes, const gpu_batch_info_t * batch_info, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfeTaskGraphDestroy(gpu_handle_context_t context, gpu_extra_task_graph_t * graph, const char * optional_file, int optional_line);
+
+#ifdef __cplusplus
+}
+#endif
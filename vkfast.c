@@ -45,20 +45,178 @@
 
 #if defined(_WIN32)
 #include <windows.h>
+#include <psapi.h>  // For K32GetProcessMemoryInfo
 #endif
 #if defined(__linux__) && !defined(__ANDROID__)
 #include <X11/Xlib.h> // For X11 Display, Window
 #endif
-#include <string.h> // For strcmp
+#include <string.h> // For strcmp, memcmp
+#include <stdio.h>  // For fopen
+#if defined(__linux__) && !defined(__ANDROID__)
+#include <time.h>   // For clock_gettime, clock_nanosleep
+#endif
+#if !defined(_WIN32)
+#include <pthread.h>  // For pthread_mutex_t
+#include <sched.h>    // For sched_yield
+#include <dlfcn.h>    // For dlopen, dlsym
+#include <unistd.h>   // For sysconf, close
+#include <fcntl.h>    // For open
+#include <sys/stat.h> // For fstat
+#include <sys/mman.h> // For mmap
+#endif
+#if !defined(VULKAN_CORE_H_)
+#define VK_NO_PROTOTYPES
+#include "extra/Modified Vulkan/include/vulkan/vulkan_core.h" // NOTE(Constantine): For the GPU timestamps of vfProgramPipelineTuneCompute() and the host memory import of vfStorageCreateFromHostPointer(), REDGPU has neither.
+#endif
 
 static void vfInternalPrint(const char * string) {
   red32OutputDebugString(string);
   red32ConsolePrint(string);
 }
 
+static uint64_t vfInternalGetTimeNanoseconds(void) {
+#if defined(_WIN32)
+  LARGE_INTEGER frequency = {0};
+  LARGE_INTEGER counter   = {0};
+  QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&counter);
+  return (uint64_t)((counter.QuadPart / frequency.QuadPart) * 1000000000ULL + ((counter.QuadPart % frequency.QuadPart) * 1000000000ULL) / frequency.QuadPart);
+#else
+  struct timespec ts = {0};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static uint64_t vfInternalAtomicLoadUint64(uint64_t * value) {
+#if defined(_WIN32)
+  return (uint64_t)InterlockedCompareExchange64((volatile LONG64 *)value, 0, 0);
+#else
+  return __atomic_load_n(value, __ATOMIC_SEQ_CST); // NOTE(Constantine): Sequentially consistent like InterlockedCompareExchange64, see vfInternalHeapsGrowBegin().
+#endif
+}
+
+static void vfInternalAtomicAddUint64(uint64_t * value, uint64_t addend) {
+#if defined(_WIN32)
+  InterlockedExchangeAdd64((volatile LONG64 *)value, (LONG64)addend);
+#else
+  __atomic_add_fetch(value, addend, __ATOMIC_SEQ_CST);
+#endif
+}
+
+static int vfInternalAtomicCompareExchangeUint64(uint64_t * value, uint64_t expected, uint64_t desired) {
+#if defined(_WIN32)
+  return (uint64_t)InterlockedCompareExchange64((volatile LONG64 *)value, (LONG64)desired, (LONG64)expected) == expected ? 1 : 0;
+#else
+  return __atomic_compare_exchange_n(value, &expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ? 1 : 0;
+#endif
+}
+
+// NOTE(Constantine): Spins with a CPU pause hint, and yields the thread once spinning took long enough that the owner is likely descheduled.
+static void vfInternalSpinPause(uint64_t spinsCount) {
+#if defined(_WIN32)
+  if (spinsCount >= 64) {
+    SwitchToThread();
+  } else {
+    YieldProcessor();
+  }
+#else
+  if (spinsCount >= 64) {
+    sched_yield();
+  } else {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+  }
+#endif
+}
+
+static void vfInternalSpinLock(uint64_t * lock) {
+  for (uint64_t spinsCount = 0; vfInternalAtomicCompareExchangeUint64(lock, 0, 1) == 0; spinsCount += 1) {
+    vfInternalSpinPause(spinsCount);
+  }
+}
+
+static void vfInternalSpinUnlock(uint64_t * lock) {
+#if defined(_WIN32)
+  InterlockedExchange64((volatile LONG64 *)lock, 0);
+#else
+  __atomic_store_n(lock, 0, __ATOMIC_RELEASE);
+#endif
+}
+
+// NOTE(Constantine): A sleeping lock for long critical sections, like a heap growth that allocates memory. Returns NULL if out of memory.
+static void * vfInternalMutexCreate(void) {
+#if defined(_WIN32)
+  SRWLOCK * mutex = (SRWLOCK *)red32MemoryCalloc(sizeof(SRWLOCK));
+  if (mutex != NULL) {
+    InitializeSRWLock(mutex);
+  }
+#else
+  pthread_mutex_t * mutex = (pthread_mutex_t *)red32MemoryCalloc(sizeof(pthread_mutex_t));
+  if (mutex != NULL && pthread_mutex_init(mutex, NULL) != 0) {
+    red32MemoryFree(mutex);
+    mutex = NULL;
+  }
+#endif
+  return (void *)mutex;
+}
+
+static void vfInternalMutexDestroy(void * mutex) {
+  if (mutex == NULL) {
+    return;
+  }
+#if !defined(_WIN32)
+  pthread_mutex_destroy((pthread_mutex_t *)mutex);
+#endif
+  red32MemoryFree(mutex);
+}
+
+static void vfInternalMutexLock(void * mutex) {
+#if defined(_WIN32)
+  AcquireSRWLockExclusive((SRWLOCK *)mutex);
+#else
+  pthread_mutex_lock((pthread_mutex_t *)mutex);
+#endif
+}
+
+static void vfInternalMutexUnlock(void * mutex) {
+#if defined(_WIN32)
+  ReleaseSRWLockExclusive((SRWLOCK *)mutex);
+#else
+  pthread_mutex_unlock((pthread_mutex_t *)mutex);
+#endif
+}
+
+static uint64_t vfInternalGetProcessResidentBytesCount(void) {
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters = {0};
+  counters.cb = sizeof(PROCESS_MEMORY_COUNTERS);
+  if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(PROCESS_MEMORY_COUNTERS)) == 0) {
+    return 0;
+  }
+  return (uint64_t)counters.WorkingSetSize;
+#else
+  FILE * fh = fopen("/proc/self/statm", "rb");
+  if (fh == NULL) {
+    return 0;
+  }
+  unsigned long long pagesCount         = 0;
+  unsigned long long residentPagesCount = 0;
+  int scanned = fscanf(fh, "%llu %llu", &pagesCount, &residentPagesCount);
+  fclose(fh);
+  if (scanned != 2) {
+    return 0;
+  }
+  return (uint64_t)residentPagesCount * (uint64_t)sysconf(_SC_PAGESIZE);
+#endif
+}
+
 #if defined(__linux__) && !defined(__ANDROID__)
 #include <stdio.h>  // For printf
-#include <stdlib.h> // For exit
+#include <stdlib.h> // For exit, qsort
 
 #define MB_OK 0
 
@@ -318,6 +476,10 @@ static unsigned vfPickSpecificMemoryTypeCpuReadback(const RedGpuInfo * gpuInfo,
   unsigned char arrayMemoryTypeIsSupported[32] = {0};
   vfFillMemoryTypeIsSupportedArray(memoryTypesSupported, arrayMemoryTypeIsSupported);
 
+  // NOTE(Constantine):
+  // CPU reads from uncached (write-combined) memory are 10-20x slower than from cached memory,
+  // so cached memory types are ranked first, even if they are not coherent. Non-coherent types
+  // are handled with explicit flushes and invalidates, see vfInternalMemoryNonCoherentFlushOrInvalidate().
   for (int isGpuVram = 0; isGpuVram < 2; isGpuVram += 1) { // NOTE(Constantine): First, we look for non-VRAM heaps, then can fall back to VRAM heaps.
     for (unsigned i = 0; i < gpuInfo->memoryTypesCount; i += 1) {
       const RedMemoryType * type = &gpuInfo->memoryTypes[i];
@@ -331,6 +493,17 @@ static unsigned vfPickSpecificMemoryTypeCpuReadback(const RedGpuInfo * gpuInfo,
         return i;
       }
     }
+    for (unsigned i = 0; i < gpuInfo->memoryTypesCount; i += 1) {
+      const RedMemoryType * type = &gpuInfo->memoryTypes[i];
+      if (arrayMemoryTypeIsSupported[i] == 1 &&
+          type->isCpuMappable == 1 &&
+          type->isCpuCached   == 1 &&
+          gpuInfo->memoryHeaps[type->memoryHeapIndex].isGpuVram == isGpuVram &&
+          gpuInfo->memoryHeaps[type->memoryHeapIndex].memoryBytesCount > 0)
+      {
+        return i;
+      }
+    }
     for (unsigned i = 0; i < gpuInfo->memoryTypesCount; i += 1) {
       const RedMemoryType * type = &gpuInfo->memoryTypes[i];
       if (arrayMemoryTypeIsSupported[i] == 1 &&
@@ -347,408 +520,1524 @@ static unsigned vfPickSpecificMemoryTypeCpuReadback(const RedGpuInfo * gpuInfo,
   return -1;
 }
 
-static RedBool32 vfRedGpuDebugCallback(RedDebugCallbackSeverity severity, RedDebugCallbackTypeBitflags types, const RedDebugCallbackData * data, RedContext context) {
-  if (0 == strcmp(data->messageIdName, "VUID-VkDebugUtilsMessengerCallbackDataEXT-flags-zerobitmask")) {
+static void vfInternalPrintMemoryType(const RedGpuInfo * gpuInfo, const char * storagesTypeName, unsigned memoryTypeIndex) {
+  char numberString[4096] = {0};
+  vfInternalPrint("[vkFast][Debug] Memory type picked for ");
+  vfInternalPrint(storagesTypeName);
+  vfInternalPrint(" storages: ");
+  if (memoryTypeIndex == -1) {
+    vfInternalPrint("none" "\n");
+    return;
+  }
+  const RedMemoryType * type = &gpuInfo->memoryTypes[memoryTypeIndex];
+  red32Uint64ToChars(memoryTypeIndex, numberString);
+  vfInternalPrint(numberString);
+  vfInternalPrint(" (heap ");
+  red32Uint64ToChars(type->memoryHeapIndex, numberString);
+  vfInternalPrint(numberString);
+  vfInternalPrint(type->isGpuVram     == 1 ? ", gpu vram"     : "");
+  vfInternalPrint(type->isCpuMappable == 1 ? ", cpu mappable" : "");
+  vfInternalPrint(type->isCpuCoherent == 1 ? ", cpu coherent" : "");
+  vfInternalPrint(type->isCpuCached   == 1 ? ", cpu cached"   : "");
+  vfInternalPrint(")" "\n");
+}
+
+typedef struct vf_internal_memory_probe_result_t {
+  unsigned memoryTypeCpuUpload;
+  unsigned memoryTypeCpuReadback;
+} vf_internal_memory_probe_result_t;
+
+// NOTE(Constantine): What a cached memory type index must still point to: the heap index and size and the type's flags. Toggling resizable
+// BAR in the firmware, for example, changes the memory types and heaps without changing the driver version.
+static uint64_t vfInternalMemoryProbeTypeSignature(const RedGpuInfo * gpuInfo, unsigned memoryTypeIndex) {
+  if (memoryTypeIndex == -1) {
     return 0;
   }
-  if (0 == strcmp(data->messageIdName, "RED_PROCEDURE_ID_redQueuePresent") &&
-      0 == strcmp(data->message,       "RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE"))
-  {
+  const RedMemoryType * type = &gpuInfo->memoryTypes[memoryTypeIndex];
+  uint64_t signature = (gpuInfo->memoryHeaps[type->memoryHeapIndex].memoryBytesCount / (1024 * 1024)) << 16;
+  signature |= (uint64_t)type->memoryHeapIndex << 4;
+  signature |= type->isGpuVram     == 1 ? 8 : 0;
+  signature |= type->isCpuMappable == 1 ? 4 : 0;
+  signature |= type->isCpuCoherent == 1 ? 2 : 0;
+  signature |= type->isCpuCached   == 1 ? 1 : 0;
+  return signature;
+}
+
+static int vfInternalMemoryProbeCacheIsValidType(const RedGpuInfo * gpuInfo, const RedArray * array, unsigned memoryTypeIndex, uint64_t signature) {
+  if (memoryTypeIndex == -1) {
+    return signature == 0 ? 1 : 0;
+  }
+  if (memoryTypeIndex >= gpuInfo->memoryTypesCount || memoryTypeIndex >= 32) {
     return 0;
   }
-  if (0 == strcmp(data->messageIdName, "RED_PROCEDURE_ID_redPresentGetImageIndex") &&
-      0 == strcmp(data->message,       "RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE"))
+  unsigned char memoryTypeIsSupported[32] = {0};
+  vfFillMemoryTypeIsSupportedArray(array->memoryTypesSupported, memoryTypeIsSupported);
+  if (memoryTypeIsSupported[memoryTypeIndex] == 0 || gpuInfo->memoryTypes[memoryTypeIndex].isCpuMappable == 0) {
+    return 0;
+  }
+  return vfInternalMemoryProbeTypeSignature(gpuInfo, memoryTypeIndex) == signature ? 1 : 0;
+}
+
+// NOTE(Constantine): Returns 0 if there's no cache for this GPU and driver or if a cached pick no longer matches the memory types of the
+// device, the types are probed again then.
+static int vfInternalMemoryProbeCacheRead(const RedGpuInfo * gpuInfo, const RedArray * arrayCpuUpload, const RedArray * arrayCpuReadback, const char * cacheFilepath, vf_internal_memory_probe_result_t * outResult) {
+  if (cacheFilepath == NULL) {
+    return 0;
+  }
+  FILE * fh = fopen(cacheFilepath, "rb");
+  if (fh == NULL) {
+    return 0;
+  }
+  unsigned version = 0;
+  unsigned vendorId = 0;
+  unsigned deviceId = 0;
+  unsigned driverVersion = 0;
+  unsigned memoryTypesCount = 0;
+  unsigned upload = -1;
+  unsigned readback = -1;
+  unsigned long long uploadSignature = 0;
+  unsigned long long readbackSignature = 0;
+  int scanned = fscanf(fh, "vkFast memory probe %u %x %x %x %u %u %llx %u %llx", &version, &vendorId, &deviceId, &driverVersion, &memoryTypesCount, &upload, &uploadSignature, &readback, &readbackSignature);
+  fclose(fh);
+  if (scanned != 9 ||
+      version          != 2 ||
+      vendorId         != gpuInfo->gpuVendorId ||
+      deviceId         != gpuInfo->gpuDeviceId ||
+      driverVersion    != gpuInfo->gpuDriverVersion ||
+      memoryTypesCount != gpuInfo->memoryTypesCount)
   {
     return 0;
   }
-  if (0 == strcmp(data->messageIdName, "RED_PROCEDURE_ID_redCreateContext") &&
-      0 == strcmp(data->message,       "RED_STATUS_ERROR_INCOMPATIBLE_DRIVER"))
+  if (vfInternalMemoryProbeCacheIsValidType(gpuInfo, arrayCpuUpload,   upload,   uploadSignature)   == 0 ||
+      vfInternalMemoryProbeCacheIsValidType(gpuInfo, arrayCpuReadback, readback, readbackSignature) == 0 ||
+      (upload != -1 && gpuInfo->memoryTypes[upload].isCpuCoherent == 0))
   {
-    return 0; // NOTE(Constantine): Android can only set 4 GPU structs max.
+    return 0;
   }
-  vfInternalPrint("[vkFast][Debug callback] ");
-  vfInternalPrint(data->message);
-  vfInternalPrint("\n");
+  outResult->memoryTypeCpuUpload   = upload;
+  outResult->memoryTypeCpuReadback = readback;
+  return 1;
+}
 
-  #ifndef VKFAST_DEFINE_ENABLE_FEATURE_GPU_DEBUG_PRINTF
-    MessageBoxA(NULL, data->message, "[vkFast][Debug callback]", MB_OK);
-    #if defined(_WIN32)
-    system("pause");
-    #endif
-    red32Exit(1);
-  #endif
+static void vfInternalMemoryProbeCacheWrite(const RedGpuInfo * gpuInfo, const char * cacheFilepath, const vf_internal_memory_probe_result_t * result) {
+  if (cacheFilepath == NULL) {
+    return;
+  }
+  FILE * fh = fopen(cacheFilepath, "wb");
+  if (fh == NULL) {
+    return; // NOTE(Constantine): The cache is optional, a read-only location is not an error.
+  }
+  fprintf(fh, "vkFast memory probe %u %x %x %x %u %u %llx %u %llx\n", 2, gpuInfo->gpuVendorId, gpuInfo->gpuDeviceId, gpuInfo->gpuDriverVersion, gpuInfo->memoryTypesCount,
+    result->memoryTypeCpuUpload,   (unsigned long long)vfInternalMemoryProbeTypeSignature(gpuInfo, result->memoryTypeCpuUpload),
+    result->memoryTypeCpuReadback, (unsigned long long)vfInternalMemoryProbeTypeSignature(gpuInfo, result->memoryTypeCpuReadback));
+  fclose(fh);
+}
 
-  return 0;
+static int vfInternalValidationCacheRead(const RedGpuInfo * gpuInfo, const char * cacheFilepath) {
+  if (cacheFilepath == NULL) {
+    return 0;
+  }
+  FILE * fh = fopen(cacheFilepath, "rb");
+  if (fh == NULL) {
+    return 0;
+  }
+  int isValidated = 0;
+  for (;;) {
+    unsigned version = 0;
+    unsigned vendorId = 0;
+    unsigned deviceId = 0;
+    unsigned driverVersion = 0;
+    unsigned vkfastVersion = 0;
+    unsigned sdkVersion = 0;
+    int scanned = fscanf(fh, " vkFast validation %u %x %x %x %u %u", &version, &vendorId, &deviceId, &driverVersion, &vkfastVersion, &sdkVersion);
+    if (scanned != 6) {
+      break;
+    }
+    if (version       == 1 &&
+        vendorId      == gpuInfo->gpuVendorId &&
+        deviceId      == gpuInfo->gpuDeviceId &&
+        driverVersion == gpuInfo->gpuDriverVersion &&
+        vkfastVersion == VKFAST_VERSION &&
+        sdkVersion    == (unsigned)RED_SDK_VERSION_1_0_135)
+    {
+      isValidated = 1;
+      break;
+    }
+  }
+  fclose(fh);
+  return isValidated;
 }
 
-static void vfInternalExpectMinimumGuaranteesAdreno735(const RedGpuInfo * gpuInfo, const char * optionalFile, int optionalLine) {
-  RedHandleGpu gpu = gpuInfo->gpu;
-  REDGPU_2_EXPECTWG(gpuInfo->maxMemoryAllocateCount                      >= REDGPU_2_EXPECTED_maxMemoryAllocateCount_4096); // maxMemoryAllocationCount
-  REDGPU_2_EXPECTWG(gpuInfo->minMemoryAllocateBytesAlignment             <= REDGPU_2_EXPECTED_minMemoryAllocateBytesAlignment_4096); // minMemoryMapAlignment; RX 550 and Arc A770 and Arc B580 on Linux
-  REDGPU_2_EXPECTWG(gpuInfo->maxMemoryAllocateBytesCount                 >= REDGPU_2_EXPECTED_maxMemoryAllocateBytesCount_1073741824); // maxMemoryAllocationSize; Redmi Note 8 on Android 11; Not used: RX 550 and RX 9070 XT on Windows is 2147483648
-  REDGPU_2_EXPECTWG(gpuInfo->minMemoryNonCoherentBlockBytesCount         <= REDGPU_2_EXPECTED_minMemoryNonCoherentBlockBytesCount_256); // nonCoherentAtomSize
-  REDGPU_2_EXPECTWG(gpuInfo->maxCreateSamplerCount                       >= REDGPU_2_EXPECTED_maxCreateSamplerCount_4000); // maxSamplerAllocationCount
-  REDGPU_2_EXPECTWG(gpuInfo->minMemoryPageSeparationArrayImageBytesCount <= REDGPU_2_EXPECTED_minMemoryPageSeparationArrayImageBytesCount_65536); // bufferImageGranularity; D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT (65536)
-  REDGPU_2_EXPECTWG(gpuInfo->minArrayROCStructMemberRangeBytesAlignment  <= REDGPU_2_EXPECTED_minArrayROCStructMemberRangeBytesAlignment_256); // minUniformBufferOffsetAlignment; D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT (256)
-  REDGPU_2_EXPECTWG(gpuInfo->maxArrayROCStructMemberRangeBytesCount      >= REDGPU_2_EXPECTED_maxArrayROCStructMemberRangeBytesCount_65536); // maxUniformBufferRange; D3D12_REQ_CONSTANT_BUFFER_ELEMENT_COUNT (4096) * 16
-  REDGPU_2_EXPECTWG(gpuInfo->minArrayRORWStructMemberRangeBytesAlignment <= REDGPU_2_EXPECTED_minArrayRORWStructMemberRangeBytesAlignment_64); // minStorageBufferOffsetAlignment; Arc A770 and Arc B580 on Windows, Redmi Note 8 on Android 11; Not used: D3D12_RAW_UAV_SRV_BYTE_ALIGNMENT (16)
-  REDGPU_2_EXPECTWG(gpuInfo->maxArrayRORWStructMemberRangeBytesCount     >= 134217728); // maxStorageBufferRange; Adreno 735 on Android
-  REDGPU_2_EXPECTWG(gpuInfo->maxArrayIndexUint32Value                    == 0xFFFFFFFF); // maxDrawIndexedIndexValue
-  REDGPU_2_EXPECTWG(gpuInfo->maxImageDimensions1D                        >= REDGPU_2_EXPECTED_maxImageDimensions1D_16384); // maxImageDimension1D; D3D12_REQ_TEXTURE1D_U_DIMENSION (16384)
-  REDGPU_2_EXPECTWG(gpuInfo->maxImageDimensions2D                        >= REDGPU_2_EXPECTED_maxImageDimensions2D_16384); // maxImageDimension2D; D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION (16384)
-  REDGPU_2_EXPECTWG(gpuInfo->maxImageDimensions3D                        >= REDGPU_2_EXPECTED_maxImageDimensions3D_2048); // maxImageDimension3D; D3D12_REQ_TEXTURE3D_U_V_OR_W_DIMENSION (2048)
-  REDGPU_2_EXPECTWG(gpuInfo->maxImageDimensionsCube                      >= REDGPU_2_EXPECTED_maxImageDimensionsCube_16384); // maxImageDimensionCube; D3D12_REQ_TEXTURECUBE_DIMENSION (16384)
-  REDGPU_2_EXPECTWG(gpuInfo->maxImageLayersCount                         >= REDGPU_2_EXPECTED_maxImageLayersCount_2048); // maxImageArrayLayers; D3D12_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION (2048)
-  REDGPU_2_EXPECTWG(gpuInfo->maxSamplerMipLodBias                        >= REDGPU_2_EXPECTED_maxSamplerMipLodBias_15); // maxSamplerLodBias; RTX 2060; Not used: D3D12_MIP_LOD_BIAS_MAX (15.99f)
-  REDGPU_2_EXPECTWG(gpuInfo->maxSamplerAnisotropy                        >= REDGPU_2_EXPECTED_maxSamplerAnisotropy_16); // maxSamplerAnisotropy; D3D12_MAX_MAXANISOTROPY (16)
-  REDGPU_2_EXPECTWG(gpuInfo->precisionBitsSamplerFilteringMagMin         >= REDGPU_2_EXPECTED_precisionBitsSamplerFilteringMagMin_8); // subTexelPrecisionBits; D3D12_SUBTEXEL_FRACTIONAL_BIT_COUNT (8)
-  REDGPU_2_EXPECTWG(gpuInfo->precisionBitsSamplerFilteringMip            >= REDGPU_2_EXPECTED_precisionBitsSamplerFilteringMip_8); // mipmapPrecisionBits; D3D12_MIP_LOD_FRACTIONAL_BIT_COUNT (8)
-  REDGPU_2_EXPECTWG(gpuInfo->maxOutputWidth                              >= REDGPU_2_EXPECTED_maxOutputWidth_16384); // maxFramebufferWidth; D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION (16384)
-  REDGPU_2_EXPECTWG(gpuInfo->maxOutputHeight                             >= REDGPU_2_EXPECTED_maxOutputHeight_16384); // maxFramebufferHeight; D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION (16384)
-  REDGPU_2_EXPECTWG(gpuInfo->maxOutputColorsCount                        >= REDGPU_2_EXPECTED_maxOutputColorsCount_8); // maxColorAttachments; D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT (8)
-  REDGPU_2_EXPECTWG(gpuInfo->supportedMultisampleCountsForOutputDepth    >= (RED_MULTISAMPLE_COUNT_BITFLAG_1 | RED_MULTISAMPLE_COUNT_BITFLAG_4));
-  REDGPU_2_EXPECTWG(gpuInfo->supportedMultisampleCountsForOutputStencil  >= (RED_MULTISAMPLE_COUNT_BITFLAG_1 | RED_MULTISAMPLE_COUNT_BITFLAG_4));
-  REDGPU_2_EXPECTWG(gpuInfo->supportedMultisampleCountsForOutputColor    >= (RED_MULTISAMPLE_COUNT_BITFLAG_1 | RED_MULTISAMPLE_COUNT_BITFLAG_4));
-  REDGPU_2_EXPECTWG(gpuInfo->supportedMultisampleCountsForEmptyOutput    >= (RED_MULTISAMPLE_COUNT_BITFLAG_1 | RED_MULTISAMPLE_COUNT_BITFLAG_4));
-  REDGPU_2_EXPECTWG(gpuInfo->maxStructSlotsCount                         >= REDGPU_2_EXPECTED_maxStructSlotsCount_1024); // maxPerSetDescriptors; Arc A770 and Arc B580 on Linux
-  REDGPU_2_EXPECTWG(gpuInfo->maxStructPerStageArrayROCsCount             >= REDGPU_2_EXPECTED_maxStructPerStageArrayROCsCount_12); // maxPerStageDescriptorUniformBuffers; Not used: Tegra X1 on Linux is 15
-  REDGPU_2_EXPECTWG(gpuInfo->maxStructPerStageArrayRORWsCount            >= 200); // Intel UHD Graphics 730 on Windows 10
-  REDGPU_2_EXPECTWG(gpuInfo->maxStructPerStageSamplersCount              >= 64); // Intel UHD Graphics 730 on Windows 10
-  REDGPU_2_EXPECTWG(gpuInfo->maxStructPerStageTextureROsCount            >= 200); // Intel UHD Graphics 730 on Windows 10
-  REDGPU_2_EXPECTWG(gpuInfo->maxStructPerStageTextureRWsCount            >= 16); // Intel UHD Graphics 730 on Windows 10
-  REDGPU_2_EXPECTWG(gpuInfo->maxStructPerStageAllResourcesCount          >= 200); // Intel UHD Graphics 730 on Windows 10
-  REDGPU_2_EXPECTWG(gpuInfo->maxStructArrayROCsCount                     >= 1800); // Intel UHD Graphics 730 on Windows 10
-  REDGPU_2_EXPECTWG(gpuInfo->maxStructArrayRORWsCount                    >= 1800); // Intel UHD Graphics 730 on Windows 10
-  REDGPU_2_EXPECTWG(gpuInfo->maxStructSamplersCount                      >= 576); // Intel UHD Graphics 730 on Windows 10
-  REDGPU_2_EXPECTWG(gpuInfo->maxStructTextureROsCount                    >= 1800); // Intel UHD Graphics 730 on Windows 10
-  REDGPU_2_EXPECTWG(gpuInfo->maxStructTextureRWsCount                    >= 144); // Intel UHD Graphics 730 on Windows 10
-  REDGPU_2_EXPECTWG(gpuInfo->maxProcedureParametersVariablesBytesCount   >= REDGPU_2_EXPECTED_maxProcedureParametersVariablesBytesCount_128); // maxPushConstantsSize; Arc A770 on Linux, RX 550 on Windows, Redmi Note 8 on Android 11
-  REDGPU_2_EXPECTWG(gpuInfo->maxViewportDimensions[0]                    >= REDGPU_2_EXPECTED_maxViewportDimensionsX_16384); // maxViewportDimensions[0]; D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION (16384)
-  REDGPU_2_EXPECTWG(gpuInfo->maxViewportDimensions[1]                    >= REDGPU_2_EXPECTED_maxViewportDimensionsY_16384); // maxViewportDimensions[1]; D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION (16384)
-  REDGPU_2_EXPECTWG(gpuInfo->minViewportBoundsRange                      <= REDGPU_2_EXPECTED_minViewportBoundsRange_minus_32768); // viewportBoundsRange[0]; D3D12_VIEWPORT_BOUNDS_MIN (-32768)
-  REDGPU_2_EXPECTWG(gpuInfo->maxViewportBoundsRange                      >= REDGPU_2_EXPECTED_maxViewportBoundsRange_32767); // viewportBoundsRange[1]; D3D12_VIEWPORT_BOUNDS_MAX (32767)
-  REDGPU_2_EXPECTWG(gpuInfo->precisionBitsViewportCoordinates            >= REDGPU_2_EXPECTED_precisionBitsViewportCoordinates_8); // subPixelPrecisionBits; D3D12_SUBPIXEL_FRACTIONAL_BIT_COUNT (8)
-  REDGPU_2_EXPECTWG(gpuInfo->precisionBitsViewportBounds                 >= REDGPU_2_EXPECTED_precisionBitsViewportBounds_8); // viewportSubPixelBits; D3D12_SUBPIXEL_FRACTIONAL_BIT_COUNT (8)
-  REDGPU_2_EXPECTWG(gpuInfo->maxPerStageClipDistances                    >= REDGPU_2_EXPECTED_maxPerStageClipDistances_8); // maxClipDistances; D3D12_CLIP_OR_CULL_DISTANCE_COUNT (8)
-  REDGPU_2_EXPECTWG(gpuInfo->maxPerStageCullDistances                    >= REDGPU_2_EXPECTED_maxPerStageCullDistances_8); // maxCullDistances; D3D12_CLIP_OR_CULL_DISTANCE_COUNT (8)
-  REDGPU_2_EXPECTWG(gpuInfo->maxPerStageClipAndCullDistances             >= REDGPU_2_EXPECTED_maxPerStageClipAndCullDistances_8); // maxCombinedClipAndCullDistances; D3D12_CLIP_OR_CULL_DISTANCE_COUNT (8)
-  REDGPU_2_EXPECTWG(gpuInfo->maxVertexOutputLocationsCount               >= REDGPU_2_EXPECTED_maxVertexOutputLocationsCount_128); // maxVertexOutputComponents; D3D12_VS_INPUT_REGISTER_COUNT (32) * D3D12_VS_INPUT_REGISTER_COMPONENTS (4)
-  REDGPU_2_EXPECTWG(gpuInfo->maxFragmentInputLocationsCount              >= REDGPU_2_EXPECTED_maxFragmentInputLocationsCount_112); // maxFragmentInputComponents; Redmi Note 8 on Android 11; Not used: Arc A770 and Arc B580 on Linux is 116; Not used: D3D12_PS_INPUT_REGISTER_COUNT (32) * D3D12_PS_INPUT_REGISTER_COMPONENTS (4)
-  REDGPU_2_EXPECTWG(gpuInfo->maxFragmentOutputColorsCount                >= REDGPU_2_EXPECTED_maxFragmentOutputColorsCount_8); // maxFragmentOutputAttachments; D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT (8)
-  REDGPU_2_EXPECTWG(gpuInfo->maxFragmentOutputColorsCountBlendDualSource >= REDGPU_2_EXPECTED_maxFragmentOutputColorsCountBlendDualSource_1); // maxFragmentDualSrcAttachments
-  REDGPU_2_EXPECTWG(gpuInfo->maxFragmentOutputResourcesCount             >= REDGPU_2_EXPECTED_maxFragmentOutputResourcesCount_16); // maxFragmentCombinedOutputResources; Tegra X1 on Linux, D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT (8) + D3D12_PS_CS_UAV_REGISTER_COUNT (8); Not used: Redmi Note 8 on Android 11 is 72
-  REDGPU_2_EXPECTWG(gpuInfo->maxComputeSharedMemoryBytesCount            >= REDGPU_2_EXPECTED_maxComputeSharedMemoryBytesCount_16384); // maxComputeSharedMemorySize; Redmi Note 8 on Android 11, D3D12_CS_THREAD_LOCAL_TEMP_REGISTER_POOL (16384); Not used: Arc A770 and Arc B580 and RX 9070 XT on Windows is 32768
-  REDGPU_2_EXPECTWG(gpuInfo->maxComputeWorkgroupsCount[0]                >= REDGPU_2_EXPECTED_maxComputeWorkgroupsCountX_65535); // maxComputeWorkGroupCount[0]; D3D12_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION (65535)
-  REDGPU_2_EXPECTWG(gpuInfo->maxComputeWorkgroupsCount[1]                >= REDGPU_2_EXPECTED_maxComputeWorkgroupsCountY_65535); // maxComputeWorkGroupCount[1]; D3D12_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION (65535)
-  REDGPU_2_EXPECTWG(gpuInfo->maxComputeWorkgroupsCount[2]                >= REDGPU_2_EXPECTED_maxComputeWorkgroupsCountZ_65535); // maxComputeWorkGroupCount[2]; D3D12_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION (65535)
-  REDGPU_2_EXPECTWG(gpuInfo->maxComputeWorkgroupInvocationsCount         >= REDGPU_2_EXPECTED_maxComputeWorkgroupInvocationsCount_1024); // maxComputeWorkGroupInvocations; D3D12_CS_THREAD_GROUP_MAX_THREADS_PER_GROUP (1024)
-  REDGPU_2_EXPECTWG(gpuInfo->maxComputeWorkgroupDimensions[0]            >= REDGPU_2_EXPECTED_maxComputeWorkgroupDimensionsX_1024); // maxComputeWorkGroupSize[0]; D3D12_CS_THREAD_GROUP_MAX_X (1024)
-  REDGPU_2_EXPECTWG(gpuInfo->maxComputeWorkgroupDimensions[1]            >= REDGPU_2_EXPECTED_maxComputeWorkgroupDimensionsY_1024); // maxComputeWorkGroupSize[1]; D3D12_CS_THREAD_GROUP_MAX_Y (1024)
-  REDGPU_2_EXPECTWG(gpuInfo->maxComputeWorkgroupDimensions[2]            >= REDGPU_2_EXPECTED_maxComputeWorkgroupDimensionsZ_64); // maxComputeWorkGroupSize[2]; D3D12_CS_THREAD_GROUP_MAX_Z (64)
-  REDGPU_2_EXPECTWG(gpuInfo->minImageSampleImageFetchOffset              <= REDGPU_2_EXPECTED_minImageSampleImageFetchOffset_minus_8); // minTexelOffset; D3D12_COMMONSHADER_TEXEL_OFFSET_MAX_NEGATIVE (-8)
-  REDGPU_2_EXPECTWG(gpuInfo->maxImageSampleImageFetchOffset              >= REDGPU_2_EXPECTED_maxImageSampleImageFetchOffset_7); // maxTexelOffset; D3D12_COMMONSHADER_TEXEL_OFFSET_MAX_POSITIVE (7)
-  REDGPU_2_EXPECTWG(gpuInfo->minImageGatherOffset                        <= REDGPU_2_EXPECTED_minImageGatherOffset_minus_32); // minTexelGatherOffset
-  REDGPU_2_EXPECTWG(gpuInfo->maxImageGatherOffset                        >= REDGPU_2_EXPECTED_maxImageGatherOffset_31); // maxTexelGatherOffset
-  REDGPU_2_EXPECTWG(gpuInfo->minInterpolateAtOffset                      <= -0.5f); // minInterpolationOffset
-  REDGPU_2_EXPECTWG(gpuInfo->maxInterpolateAtOffset                      >= 0.4375f); // maxInterpolationOffset
-  REDGPU_2_EXPECTWG(gpuInfo->precisionBitsInterpolateAtOffset            >= 4); // subPixelInterpolationOffsetBits
-  REDGPU_2_EXPECTWG(gpuInfo->optimalCopyArrayImageRangeArrayBytesFirstBytesAlignment           <= REDGPU_2_EXPECTED_optimalCopyArrayImageRangeArrayBytesFirstBytesAlignment_128); // optimalBufferCopyOffsetAlignment
-  REDGPU_2_EXPECTWG(gpuInfo->optimalCopyArrayImageRangeArrayTexelsCountToNextRowBytesAlignment <= REDGPU_2_EXPECTED_optimalCopyArrayImageRangeArrayTexelsCountToNextRowBytesAlignment_128); // optimalBufferCopyRowPitchAlignment
-  REDGPU_2_EXPECTWG(gpuInfo->supportsWsi                                                       == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsMemoryGetBudget                                           >= 0); // Not supported on Redmi Note 8 on Android 11
-  REDGPU_2_EXPECTWG(gpuInfo->supportsFullArrayIndexUint32Value                                 == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsSamplerAnisotropy                                         == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsTextureDimensionsCubeLayered                              == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateRasterizationDepthClamp                     == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateRasterizationDepthBiasDynamic               == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateRasterizationDepthBiasClamp                 == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateMultisampleSampleShading                    == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateMultisampleAlphaToOne                       >= 0); // Not supported on RX 550 and RX 9070 XT on Windows
-  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateDepthTestBoundsTest                         >= 0); // Not supported on Intel HD Graphics 520 on Windows
-  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateDepthTestBoundsTestDynamic                  >= 0); // Not supported on Intel HD Graphics 520 on Windows
-  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateStencilTestFrontAndBackDynamicCompareMask   == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateStencilTestFrontAndBackDynamicWriteMask     == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateBlendLogicOp                                >= 0); // Not supported on Redmi Note 8 on Android 11
-  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateOutputColorsBlendVaryingPerColor            == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateOutputColorsBlendDualSource                 == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsMultisampleEmptyOutputVariableMultisampleCount            >= 0); // Not supported on Redmi Note 8 on Android 11
-  REDGPU_2_EXPECTWG(gpuInfo->supportsMultisampleStandardSampleLocations                        == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeWritesAndAtomicsInStageVertex                      == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeWritesAndAtomicsInStageFragment                    == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeImageGatherExtended                                == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeTextureRWExtendedFormats                           == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeTextureRWMultisample                               >= 0); // Not supported on Redmi Note 8 on Android 11
-  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeTextureRWReadWithoutFormat                         >= 0); // Intel UHD Graphics 730 on Windows 10
-  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeTextureRWWriteWithoutFormat                        == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeDynamicallyIndexableArraysOfArrayROCs              == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeDynamicallyIndexableArraysOfArrayRORWs             == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeDynamicallyIndexableArraysOfSamplers               == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeDynamicallyIndexableArraysOfTextureROs             == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeDynamicallyIndexableArraysOfTextureRWs             == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeClipDistance                                       == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeCullDistance                                       == 1);
-  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeInt64                                              >= 0); // Not supported on Redmi Note 8 on Android 11
-  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeFloat64                                            >= 0); // Not supported on Redmi Note 8 on Android 11
-  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeMinLod                                             >= 0); // Not supported on Redmi Note 8 on Android 11
+static void vfInternalValidationCacheAppend(const RedGpuInfo * gpuInfo, const char * cacheFilepath) {
+  if (cacheFilepath == NULL) {
+    return;
+  }
+  FILE * fh = fopen(cacheFilepath, "ab");
+  if (fh == NULL) {
+    return; // NOTE(Constantine): The cache is optional, a read-only location is not an error.
+  }
+  fprintf(fh, "vkFast validation %u %x %x %x %u %u\n", 1, gpuInfo->gpuVendorId, gpuInfo->gpuDeviceId, gpuInfo->gpuDriverVersion, (unsigned)VKFAST_VERSION, (unsigned)RED_SDK_VERSION_1_0_135);
+  fclose(fh);
 }
 
-static void vfInternalExpectMinimumImageFormatsLimitsAndFeaturesAdreno735(const RedGpuInfo * gpuInfo, const char * optionalFile, int optionalLine) {
-  RedHandleGpu gpu = gpuInfo->gpu;
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_SINT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_SINT].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_SINT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_SINT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_SINT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_SINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_SINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_SINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_UINT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_UINT].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_UINT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_UINT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_UINT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_UINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_UINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_SINT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_SINT].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_SINT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_SINT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_SINT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_SINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_SINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_FLOAT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_FLOAT].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_FLOAT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_FLOAT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_FLOAT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_FLOAT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_FLOAT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_UINT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_UINT].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_UINT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_UINT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_UINT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_UINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_UINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_SINT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_SINT].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_SINT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_SINT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_SINT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_SINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_SINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_FLOAT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_UINT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_UINT].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_UINT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_UINT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_UINT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_UINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_UINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_SINT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_SINT].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_SINT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_SINT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_SINT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_SINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_SINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_FLOAT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_FLOAT].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_FLOAT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_FLOAT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_FLOAT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_FLOAT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_FLOAT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_UINT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_UINT].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_UINT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_UINT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_UINT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_UINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_UINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_SINT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_SINT].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_SINT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_SINT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_SINT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_SINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_SINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxDimensions.maxHeight >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_FLOAT].status >= RED_STATUS_SUCCESS);
-  if (gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].status == RED_STATUS_SUCCESS) {
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 16384);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 1);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 1);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxLevelsCount >= 15);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxLayersCount >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
+static void vfInternalTuningSet(vf_handle_context_t * vkfast, const char * key, const unsigned * localSize) {
+  vfInternalSpinLock(&vkfast->tuningLock);
+  vf_tuning_entry_t * entry = NULL;
+  for (uint64_t i = 0; i < vkfast->tuningEntriesCount; i += 1) {
+    if (strcmp(vkfast->tuningEntries[i].key, key) == 0) {
+      entry = &vkfast->tuningEntries[i];
+      break;
+    }
   }
-  if (gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].status == RED_STATUS_SUCCESS) {
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxWidth >= 16384);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxHeight >= 1);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxDepth >= 1);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].maxLevelsCount >= 15);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].maxLayersCount >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].maxBytesCount >= 2147483648);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].status >= RED_STATUS_SUCCESS);
+  if (entry == NULL) {
+    if (vkfast->tuningEntriesCount == vkfast->tuningEntriesCapacity) {
+      const uint64_t capacity = vkfast->tuningEntriesCapacity == 0 ? 16 : vkfast->tuningEntriesCapacity * 2;
+      vf_tuning_entry_t * entries = (vf_tuning_entry_t *)red32MemoryCalloc(sizeof(vf_tuning_entry_t) * capacity);
+      REDGPU_2_EXPECT(entries != NULL);
+      if (vkfast->tuningEntries != NULL) {
+        red32MemoryCopy(entries, vkfast->tuningEntries, sizeof(vf_tuning_entry_t) * vkfast->tuningEntriesCount);
+        red32MemoryFree(vkfast->tuningEntries);
+      }
+      vkfast->tuningEntries         = entries;
+      vkfast->tuningEntriesCapacity = capacity;
+    }
+    entry = &vkfast->tuningEntries[vkfast->tuningEntriesCount];
+    vkfast->tuningEntriesCount += 1;
+    red32MemoryCopy(entry->key, key, strlen(key) + 1);
   }
-  if (gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].status == RED_STATUS_SUCCESS) {
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxWidth >= 16384);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxHeight >= 1);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxDepth >= 1);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxLevelsCount >= 15);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxLayersCount >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxBytesCount >= 2147483648);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].status >= RED_STATUS_SUCCESS);
+  entry->localSize[0] = localSize[0];
+  entry->localSize[1] = localSize[1];
+  entry->localSize[2] = localSize[2];
+  vfInternalSpinUnlock(&vkfast->tuningLock);
+}
+
+static int vfInternalTuningGet(vf_handle_context_t * vkfast, const char * key, unsigned * outLocalSize) {
+  int isFound = 0;
+  vfInternalSpinLock(&vkfast->tuningLock);
+  for (uint64_t i = 0; i < vkfast->tuningEntriesCount; i += 1) {
+    if (strcmp(vkfast->tuningEntries[i].key, key) == 0) {
+      outLocalSize[0] = vkfast->tuningEntries[i].localSize[0];
+      outLocalSize[1] = vkfast->tuningEntries[i].localSize[1];
+      outLocalSize[2] = vkfast->tuningEntries[i].localSize[2];
+      isFound = 1;
+      break;
+    }
   }
-  if (gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].status == RED_STATUS_SUCCESS) {
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxWidth >= 16384);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxHeight >= 1);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxDepth >= 1);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxLevelsCount >= 15);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxLayersCount >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxBytesCount >= 2147483648);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].status >= RED_STATUS_SUCCESS);
+  vfInternalSpinUnlock(&vkfast->tuningLock);
+  return isFound;
+}
+
+// NOTE(Constantine):
+// Tuning cache file is a text file of "vkFast tuning <version> <vendor id> <device id> <driver version> <key> <x> <y> <z>" lines.
+// Several GPUs can share one file, lines of other GPUs and driver versions are skipped, later lines override earlier ones.
+// vfInternalTuningCacheStore() keeps one line per GPU, driver version and key.
+static void vfInternalTuningCacheLoad(vf_handle_context_t * vkfast, const char * cacheFilepath) {
+  if (cacheFilepath == NULL) {
+    return;
   }
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT].maxDimensions.maxHeight >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_SINT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_SINT].maxDimensions.maxHeight >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_SINT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_SINT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_SINT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_SINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_SINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxHeight >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxHeight >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_SINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxWidth >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxHeight >= 16384);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxDepth >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxLevelsCount >= 15);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxLayersCount >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxBytesCount >= 2147483648);
+  FILE * fh = fopen(cacheFilepath, "rb");
+  if (fh == NULL) {
+    return;
+  }
+  for (;;) {
+    unsigned version = 0;
+    unsigned vendorId = 0;
+    unsigned deviceId = 0;
+    unsigned driverVersion = 0;
+    char     key[VF_TUNING_KEY_MAX_BYTES] = {0};
+    unsigned localSize[3] = {0};
+    int scanned = fscanf(fh, " vkFast tuning %u %x %x %x %127s %u %u %u", &version, &vendorId, &deviceId, &driverVersion, key, &localSize[0], &localSize[1], &localSize[2]);
+    if (scanned != 8) {
+      break;
+    }
+    if (version       != 1 ||
+        vendorId      != vkfast->gpuInfo->gpuVendorId ||
+        deviceId      != vkfast->gpuInfo->gpuDeviceId ||
+        driverVersion != vkfast->gpuInfo->gpuDriverVersion)
+    {
+      continue;
+    }
+    vfInternalTuningSet(vkfast, key, localSize);
+  }
+  fclose(fh);
+}
+
+// NOTE(Constantine): Rewrites the tuning cache file with the line of key for this GPU and driver version replaced, so contexts that tuned
+// the same key concurrently don't grow the file. Lines of other GPUs, driver versions and keys are kept as they are.
+static void vfInternalTuningCacheStore(vf_handle_context_t * vkfast, const char * key, const unsigned * localSize) {
+  if (vkfast->tuningCacheFilepath == NULL) {
+    return;
+  }
+
+  // To free
+  char *   kept              = NULL;
+  uint64_t keptBytesCount    = 0;
+  uint64_t keptBytesCapacity = 0;
+
+  FILE * fh = fopen(vkfast->tuningCacheFilepath, "rb");
+  if (fh != NULL) {
+    char line[512] = {0};
+    while (fgets(line, sizeof(line), fh) != NULL) {
+      unsigned version = 0;
+      unsigned vendorId = 0;
+      unsigned deviceId = 0;
+      unsigned driverVersion = 0;
+      char     lineKey[VF_TUNING_KEY_MAX_BYTES] = {0};
+      unsigned lineLocalSize[3] = {0};
+      int scanned = sscanf(line, " vkFast tuning %u %x %x %x %127s %u %u %u", &version, &vendorId, &deviceId, &driverVersion, lineKey, &lineLocalSize[0], &lineLocalSize[1], &lineLocalSize[2]);
+      if (scanned       == 8 &&
+          version       == 1 &&
+          vendorId      == vkfast->gpuInfo->gpuVendorId &&
+          deviceId      == vkfast->gpuInfo->gpuDeviceId &&
+          driverVersion == vkfast->gpuInfo->gpuDriverVersion &&
+          strcmp(lineKey, key) == 0)
+      {
+        continue;
+      }
+      const uint64_t lineBytesCount = strlen(line);
+      if (keptBytesCount + lineBytesCount > keptBytesCapacity) {
+        const uint64_t capacity = (keptBytesCount + lineBytesCount) * 2;
+        char * bytes = (char *)red32MemoryCalloc(capacity);
+        if (bytes == NULL) {
+          break;
+        }
+        if (kept != NULL) {
+          red32MemoryCopy(bytes, kept, keptBytesCount);
+          red32MemoryFree(kept);
+        }
+        kept              = bytes;
+        keptBytesCapacity = capacity;
+      }
+      red32MemoryCopy(kept + keptBytesCount, line, lineBytesCount);
+      keptBytesCount += lineBytesCount;
+    }
+    fclose(fh);
+  }
+
+  fh = fopen(vkfast->tuningCacheFilepath, "wb");
+  if (fh != NULL) { // NOTE(Constantine): The cache is optional, a read-only location is not an error.
+    if (keptBytesCount > 0) {
+      fwrite(kept, 1, keptBytesCount, fh);
+    }
+    fprintf(fh, "vkFast tuning %u %x %x %x %s %u %u %u\n", 1, vkfast->gpuInfo->gpuVendorId, vkfast->gpuInfo->gpuDeviceId, vkfast->gpuInfo->gpuDriverVersion, key, localSize[0], localSize[1], localSize[2]);
+    fclose(fh);
+  }
+  if (kept != NULL) {
+    red32MemoryFree(kept);
+  }
+}
+
+// NOTE(Constantine): Small writes and reads mostly stay in the CPU caches of cached memory types while large ones stream through them,
+// so one size alone can rank the types wrong for the other. Every size is timed over the same bytes count in total, the largest size once.
+static const uint64_t vfInternalMemoryProbeBytesCounts[3] = {64 * 1024, 1024 * 1024, 16 * 1024 * 1024};
+
+// NOTE(Constantine):
+// Measures CPU write and read speed of every mappable memory type that both CPU storages arrays
+// support at each of vfInternalMemoryProbeBytesCounts, and picks the type with the lowest average time
+// per byte over them to write for uploads and the one with the lowest to read for readbacks.
+static void vfInternalMemoryProbeBandwidth(RedContext context, const RedGpuInfo * gpuInfo, const RedArray * arrayCpuUpload, const RedArray * arrayCpuReadback, int isDebugMode, vf_internal_memory_probe_result_t * outResult, const char * optionalFile, int optionalLine) {
+  RedHandleGpu gpu = gpuInfo->gpu;
+
+  const unsigned probeSizesCount = sizeof(vfInternalMemoryProbeBytesCounts) / sizeof(vfInternalMemoryProbeBytesCounts[0]);
+  const uint64_t probeBytesCount = vfInternalMemoryProbeBytesCounts[probeSizesCount - 1];
+
+  unsigned char uploadMemoryTypeIsSupported[32]   = {0};
+  unsigned char readbackMemoryTypeIsSupported[32] = {0};
+  vfFillMemoryTypeIsSupportedArray(arrayCpuUpload->memoryTypesSupported,   uploadMemoryTypeIsSupported);
+  vfFillMemoryTypeIsSupportedArray(arrayCpuReadback->memoryTypesSupported, readbackMemoryTypeIsSupported);
+
+  uint64_t bestWriteCost = -1;
+  uint64_t bestReadCost  = -1;
+  outResult->memoryTypeCpuUpload   = -1;
+  outResult->memoryTypeCpuReadback = -1;
+
+  for (unsigned i = 0; i < gpuInfo->memoryTypesCount; i += 1) {
+    const RedMemoryType * type = &gpuInfo->memoryTypes[i];
+    if (type->isCpuMappable == 0 || (uploadMemoryTypeIsSupported[i] == 0 && readbackMemoryTypeIsSupported[i] == 0)) {
+      continue;
+    }
+    if (gpuInfo->memoryHeaps[type->memoryHeapIndex].memoryBytesCount < probeBytesCount) {
+      continue;
+    }
+
+    // To destroy
+    RedHandleMemory memory = NULL;
+    np(redMemoryAllocate,
+      "context", context,
+      "gpu", gpu,
+      "handleName", "vkFast_vfInternalMemoryProbeBandwidth_memory",
+      "bytesCount", probeBytesCount,
+      "memoryTypeIndex", i,
+      "dedicateToArray", NULL,
+      "dedicateToImage", NULL,
+      "memoryBitflags", 0,
+      "outMemory", &memory,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    if (memory == NULL) {
+      continue; // NOTE(Constantine): Heap is exhausted or the type is restricted, skip it.
+    }
+
+    void * mapped = NULL;
+    np(redMemoryMap,
+      "context", context,
+      "gpu", gpu,
+      "mappableMemory", memory,
+      "mappableMemoryBytesFirst", 0,
+      "mappableMemoryBytesCount", probeBytesCount,
+      "outVolatilePointer", &mapped,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+
+    if (mapped != NULL) {
+      volatile uint64_t * words = (volatile uint64_t *)mapped;
+
+      // NOTE(Constantine): Costs are picoseconds per byte summed over the sizes, a smaller size is timed in several passes and its fastest
+      // pass counts, so timer resolution and preemption don't decide the pick.
+      uint64_t writeCost = 0;
+      uint64_t readCost  = 0;
+      for (unsigned s = 0; s < probeSizesCount; s += 1) {
+        const uint64_t bytesCount  = vfInternalMemoryProbeBytesCounts[s];
+        const uint64_t wordsCount  = bytesCount / sizeof(uint64_t);
+        const uint64_t passesCount = probeBytesCount / bytesCount;
+
+        uint64_t writeNanoseconds = -1;
+        uint64_t readNanoseconds  = -1;
+        for (uint64_t p = 0; p < passesCount; p += 1) {
+          uint64_t writeStart = vfInternalGetTimeNanoseconds();
+          for (uint64_t w = 0; w < wordsCount; w += 1) {
+            words[w] = w + p;
+          }
+          uint64_t writeElapsed = vfInternalGetTimeNanoseconds() - writeStart;
+
+          uint64_t sum = 0;
+          uint64_t readStart = vfInternalGetTimeNanoseconds();
+          for (uint64_t w = 0; w < wordsCount; w += 1) {
+            sum += words[w];
+          }
+          uint64_t readElapsed = vfInternalGetTimeNanoseconds() - readStart;
+          REDGPU_2_EXPECTWG(sum == wordsCount * p + (wordsCount * (wordsCount - 1)) / 2);
+
+          writeNanoseconds = writeElapsed < writeNanoseconds ? writeElapsed : writeNanoseconds;
+          readNanoseconds  = readElapsed  < readNanoseconds  ? readElapsed  : readNanoseconds;
+        }
+        writeCost += (writeNanoseconds * 1000) / bytesCount;
+        readCost  += (readNanoseconds  * 1000) / bytesCount;
+
+        if (isDebugMode == 1) {
+          char numberString[4096] = {0};
+          vfInternalPrint("[vkFast][Debug] Memory type ");
+          red32Uint64ToChars(i, numberString);
+          vfInternalPrint(numberString);
+          vfInternalPrint(", ");
+          red32Uint64ToChars(bytesCount / 1024, numberString);
+          vfInternalPrint(numberString);
+          vfInternalPrint(" KB, CPU write MB/s: ");
+          red32Uint64ToChars(writeNanoseconds == 0 ? 0 : (bytesCount * 1000) / writeNanoseconds, numberString);
+          vfInternalPrint(numberString);
+          vfInternalPrint(", CPU read MB/s: ");
+          red32Uint64ToChars(readNanoseconds == 0 ? 0 : (bytesCount * 1000) / readNanoseconds, numberString);
+          vfInternalPrint(numberString);
+          vfInternalPrint("\n");
+        }
+      }
+
+      // NOTE(Constantine): Upload storages are flushed by the caller, see vfStorageCpuUploadFlush(), so the probe doesn't pick non-coherent upload types on its own.
+      if (uploadMemoryTypeIsSupported[i] == 1 && type->isCpuCoherent == 1 && writeCost < bestWriteCost) {
+        bestWriteCost = writeCost;
+        outResult->memoryTypeCpuUpload = i;
+      }
+      if (readbackMemoryTypeIsSupported[i] == 1 && readCost < bestReadCost) {
+        bestReadCost = readCost;
+        outResult->memoryTypeCpuReadback = i;
+      }
+
+      np(redMemoryUnmap,
+        "context", context,
+        "gpu", gpu,
+        "mappableMemory", memory,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+    }
+
+    np(red2DestroyHandle,
+      "context", context,
+      "gpu", gpu,
+      "handleType", RED_HANDLE_TYPE_MEMORY,
+      "handle", memory,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+  }
+}
+
+static void vfInternalMemoryNonCoherentFlushOrInvalidate(vf_handle_context_t * vkfast, int isInvalidate, RedHandleMemory memory, uint64_t memoryBytesCount, uint64_t bytesFirst, uint64_t bytesCount, const char * optionalFile, int optionalLine) {
+  if (memory == NULL || bytesCount == 0) {
+    return;
+  }
+
+  RedHandleGpu gpu = vkfast->gpu;
+
+  // NOTE(Constantine): Ranges must be aligned to nonCoherentAtomSize, or end at the end of the memory allocation.
+  const uint64_t atom = vkfast->gpuInfo->minMemoryNonCoherentBlockBytesCount == 0 ? 1 : vkfast->gpuInfo->minMemoryNonCoherentBlockBytesCount;
+  uint64_t first = bytesFirst - (bytesFirst % atom);
+  uint64_t last  = bytesFirst + bytesCount;
+  last += REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(last, atom);
+  if (last > memoryBytesCount) {
+    last = memoryBytesCount;
+  }
+
+  RedMappableMemoryRange range = {0};
+  range.setTo6                        = 6;
+  range.setTo0                        = 0;
+  range.mappableMemory                = memory;
+  range.mappableMemoryRangeBytesFirst = first;
+  range.mappableMemoryRangeBytesCount = last - first;
+  if (isInvalidate == 1) {
+    np(redMemoryNonCoherentInvalidate,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "mappableMemoryRangesCount", 1,
+      "mappableMemoryRanges", &range,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+  } else {
+    np(redMemoryNonCoherentFlush,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "mappableMemoryRangesCount", 1,
+      "mappableMemoryRanges", &range,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+  }
+}
+
+static void vfInternalHeapGetCurrentBlock(const vf_handle_context_t * vkfast, gpu_storage_type_t storageType, vf_heap_block_t * outBlock) {
+  vf_heap_block_t block = {0};
+  if (storageType == GPU_STORAGE_TYPE_GPU_ONLY) {
+    block.array                        = vkfast->memoryGpuVramForArrays_array;
+    block.memory                       = vkfast->memoryGpuVramForArrays_memory;
+    block.memory_suballocations_offset = vkfast->memoryGpuVramForArrays_memory_suballocations_offset;
+  } else if (storageType == GPU_STORAGE_TYPE_CPU_UPLOAD) {
+    block.array                        = vkfast->memoryCpuUpload_array;
+    block.memory                       = vkfast->memoryCpuUpload_memory;
+    block.mapped_void_ptr_original     = vkfast->memoryCpuUpload_mapped_void_ptr_original;
+    block.memory_suballocations_offset = vkfast->memoryCpuUpload_memory_suballocations_offset;
+  } else if (storageType == GPU_STORAGE_TYPE_CPU_READBACK) {
+    block.array                        = vkfast->memoryCpuReadback_array;
+    block.memory                       = vkfast->memoryCpuReadback_memory;
+    block.mapped_void_ptr_original     = vkfast->memoryCpuReadback_mapped_void_ptr_original;
+    block.memory_suballocations_offset = vkfast->memoryCpuReadback_memory_suballocations_offset;
+  }
+  outBlock[0] = block;
+}
+
+static void vfInternalHeapSetCurrentBlock(vf_handle_context_t * vkfast, gpu_storage_type_t storageType, const vf_heap_block_t * block) {
+  if (storageType == GPU_STORAGE_TYPE_GPU_ONLY) {
+    vkfast->memoryGpuVramForArrays_array                        = block->array;
+    vkfast->memoryGpuVramForArrays_memory                       = block->memory;
+    vkfast->memoryGpuVramForArrays_memory_suballocations_offset = block->memory_suballocations_offset;
+  } else if (storageType == GPU_STORAGE_TYPE_CPU_UPLOAD) {
+    vkfast->memoryCpuUpload_array                               = block->array;
+    vkfast->memoryCpuUpload_memory                              = block->memory;
+    vkfast->memoryCpuUpload_mapped_void_ptr_original            = block->mapped_void_ptr_original;
+    vkfast->memoryCpuUpload_memory_suballocations_offset        = block->memory_suballocations_offset;
+  } else if (storageType == GPU_STORAGE_TYPE_CPU_READBACK) {
+    vkfast->memoryCpuReadback_array                             = block->array;
+    vkfast->memoryCpuReadback_memory                            = block->memory;
+    vkfast->memoryCpuReadback_mapped_void_ptr_original          = block->mapped_void_ptr_original;
+    vkfast->memoryCpuReadback_memory_suballocations_offset      = block->memory_suballocations_offset;
+  }
+}
+
+static uint64_t * vfInternalHeapGetSuballocationsOffset(vf_handle_context_t * vkfast, gpu_storage_type_t storageType) {
+  if (storageType == GPU_STORAGE_TYPE_GPU_ONLY) {
+    return &vkfast->memoryGpuVramForArrays_memory_suballocations_offset;
+  } else if (storageType == GPU_STORAGE_TYPE_CPU_UPLOAD) {
+    return &vkfast->memoryCpuUpload_memory_suballocations_offset;
+  } else {
+    return &vkfast->memoryCpuReadback_memory_suballocations_offset;
+  }
+}
+
+// NOTE(Constantine): Lock-free bump of a heap block suballocations offset, returns 0 if bytesCount doesn't fit into memoryBytesCount.
+static int vfInternalHeapBump(uint64_t * suballocationsOffset, uint64_t memoryBytesCount, uint64_t alignment, uint64_t bytesCount, uint64_t * outBytesFirst) {
+  for (;;) {
+    uint64_t offset = vfInternalAtomicLoadUint64(suballocationsOffset);
+    uint64_t first  = offset + REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(offset, alignment);
+    if (first + bytesCount > memoryBytesCount) {
+      return 0;
+    }
+    if (vfInternalAtomicCompareExchangeUint64(suballocationsOffset, offset, first + bytesCount) == 1) {
+      outBytesFirst[0] = first;
+      return 1;
+    }
+  }
+}
+
+// NOTE(Constantine): vfInternalHeapGrow() swaps the current block and reallocates retiredBlocks under heapsGrowMutex, so the lookup takes it too.
+static int vfInternalHeapFindBlock(const vf_handle_context_t * vkfast, gpu_storage_type_t storageType, RedHandleArray array, vf_heap_block_t * outBlock) {
+  int isFound = 0;
+  vfInternalMutexLock(vkfast->heapsGrowMutex);
+  vfInternalHeapGetCurrentBlock(vkfast, storageType, outBlock);
+  if (outBlock->array.handle == array) {
+    isFound = 1;
+  }
+  const vf_heap_blocks_t * heap = &vkfast->heapsBlocks[storageType];
+  for (uint64_t i = 0; isFound == 0 && i < heap->retiredBlocksCount; i += 1) {
+    if (heap->retiredBlocks[i].array.handle == array) {
+      outBlock[0] = heap->retiredBlocks[i];
+      isFound = 1;
+    }
+  }
+  vfInternalMutexUnlock(vkfast->heapsGrowMutex);
+  return isFound;
+}
+
+// NOTE(Constantine): Allocates, binds and, for CPU storage types, maps a new block of bytesCount bytes. The block isn't added to any heap.
+static void vfInternalHeapBlockCreate(vf_handle_context_t * vkfast, gpu_storage_type_t storageType, uint64_t bytesCount, vf_heap_block_t * outBlock, const char * optionalFile, int optionalLine) {
+  RedHandleGpu gpu = vkfast->gpu;
+
+  RedArrayType      arrayType        = RED_ARRAY_TYPE_ARRAY_RW;
+  RedAccessBitflags restrictToAccess = RED_ARRAY_TYPE_ARRAY_RW;
+  unsigned          memoryTypeIndex  = vkfast->specificMemoryTypesGpuVram;
+  if (storageType == GPU_STORAGE_TYPE_CPU_UPLOAD) {
+    arrayType        = RED_ARRAY_TYPE_ARRAY_RO;
+    restrictToAccess = RED_ACCESS_BITFLAG_COPY_R;
+    memoryTypeIndex  = vkfast->specificMemoryTypesCpuUpload;
+  } else if (storageType == GPU_STORAGE_TYPE_CPU_READBACK) {
+    arrayType        = RED_ARRAY_TYPE_ARRAY_RW;
+    restrictToAccess = RED_ACCESS_BITFLAG_COPY_W;
+    memoryTypeIndex  = vkfast->specificMemoryTypesCpuReadback;
+  }
+  REDGPU_2_EXPECTWG(memoryTypeIndex != -1);
+
+  np(redCreateArray,
+    "context", vkfast->context,
+    "gpu", gpu,
+    "handleName", "vkFast_vfInternalHeapBlockCreate_array",
+    "type", arrayType,
+    "bytesCount", bytesCount,
+    "structuredBufferElementBytesCount", 0,
+    "restrictToAccess", restrictToAccess,
+    "initialQueueFamilyIndex", vkfast->gpuInfo->queuesCount > 1 ? -1 : (unsigned)vkfast->gpuInfo->queuesFamilyIndex[vkfast->mainQueueFamilyIndex],
+    "dedicate", 0,
+    "outArray", &outBlock->array,
+    "outStatuses", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+  REDGPU_2_EXPECTWG(outBlock->array.handle != NULL);
+
+  np(redMemoryAllocate,
+    "context", vkfast->context,
+    "gpu", gpu,
+    "handleName", "vkFast_vfInternalHeapBlockCreate_memory",
+    "bytesCount", outBlock->array.memoryBytesCount,
+    "memoryTypeIndex", memoryTypeIndex,
+    "dedicateToArray", NULL,
+    "dedicateToImage", NULL,
+    "memoryBitflags", 0,
+    "outMemory", &outBlock->memory,
+    "outStatuses", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+  REDGPU_2_EXPECTWG(outBlock->memory != NULL);
+
+  RedMemoryArray memoryArray = {0};
+  memoryArray.setTo1000157000  = 1000157000;
+  memoryArray.setTo0           = 0;
+  memoryArray.array            = outBlock->array.handle;
+  memoryArray.memory           = outBlock->memory;
+  memoryArray.memoryBytesFirst = 0;
+  RedStatuses opstatuses = {0};
+  np(redMemorySet,
+    "context", vkfast->context,
+    "gpu", gpu,
+    "memoryArraysCount", 1,
+    "memoryArrays", &memoryArray,
+    "memoryImagesCount", 0,
+    "memoryImages", NULL,
+    "outStatuses", &opstatuses,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+  REDGPU_2_EXPECTWG(opstatuses.statusError == RED_STATUS_SUCCESS);
+
+  if (storageType != GPU_STORAGE_TYPE_GPU_ONLY) {
+    np(redMemoryMap,
+      "context", vkfast->context,
+      "gpu", gpu,
+      "mappableMemory", outBlock->memory,
+      "mappableMemoryBytesFirst", 0,
+      "mappableMemoryBytesCount", outBlock->array.memoryBytesCount,
+      "outVolatilePointer", &outBlock->mapped_void_ptr_original,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    REDGPU_2_EXPECTWG(outBlock->mapped_void_ptr_original != NULL);
+    REDGPU_2_EXPECTWG(!"Start address is not aligned" || (0 == REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY((uint64_t)outBlock->mapped_void_ptr_original, vkfast->gpuInfo->minMemoryAllocateBytesAlignment)));
+  }
+}
+
+static void vfInternalHeapBlockDestroy(vf_handle_context_t * vkfast, const vf_heap_block_t * block, const char * optionalFile, int optionalLine) {
+  RedHandleGpu gpu = vkfast->gpu;
+
+  if (block->mapped_void_ptr_original != NULL) {
+    np(redMemoryUnmap,
+      "context", vkfast->context,
+      "gpu", gpu,
+      "mappableMemory", block->memory,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+  }
+  np(red2DestroyHandle,
+    "context", vkfast->context,
+    "gpu", gpu,
+    "handleType", RED_HANDLE_TYPE_ARRAY,
+    "handle", block->array.handle,
+    "optionalHandle2", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+  np(red2DestroyHandle,
+    "context", vkfast->context,
+    "gpu", gpu,
+    "handleType", RED_HANDLE_TYPE_MEMORY,
+    "handle", block->memory,
+    "optionalHandle2", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+}
+
+// NOTE(Constantine):
+// Makes a new block current for storageType that fits at least minBytesCount, the previous current block is retired.
+// Blocks emptied by vfContextResetAndInvalidateAllStorages() are reused before new memory is allocated.
+// A heap that was created with 0 bytes has no current block to retire.
+static void vfInternalHeapGrow(vf_handle_context_t * vkfast, gpu_storage_type_t storageType, uint64_t minBytesCount, const char * optionalFile, int optionalLine) {
+  RedHandleGpu gpu = vkfast->gpu;
+
+  vf_heap_blocks_t * heap = &vkfast->heapsBlocks[storageType];
+
+  vf_heap_block_t current = {0};
+  vfInternalHeapGetCurrentBlock(vkfast, storageType, &current);
+
+  for (uint64_t i = 0; i < heap->retiredBlocksCount; i += 1) {
+    if (heap->retiredBlocks[i].memory_suballocations_offset == 0 && heap->retiredBlocks[i].array.memoryBytesCount >= minBytesCount) {
+      vfInternalHeapSetCurrentBlock(vkfast, storageType, &heap->retiredBlocks[i]);
+      if (current.array.handle != NULL) {
+        heap->retiredBlocks[i] = current;
+      } else {
+        heap->retiredBlocks[i] = heap->retiredBlocks[heap->retiredBlocksCount - 1];
+        heap->retiredBlocksCount -= 1;
+      }
+      return;
+    }
+  }
+
+  uint64_t bytesCount = vkfast->heapsGrowBlockBytesCount > minBytesCount ? vkfast->heapsGrowBlockBytesCount : minBytesCount;
+  bytesCount += REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(bytesCount, vkfast->gpuInfo->minMemoryAllocateBytesAlignment);
+  if (vkfast->heapsGrowMaxTotalBytesCount > 0) {
+    REDGPU_2_EXPECTWG(!"Storages heap reached its maximum total size" || (heap->totalBytesCount + bytesCount <= vkfast->heapsGrowMaxTotalBytesCount));
+  }
+
+  // To destroy
+  vf_heap_block_t block = {0};
+  vfInternalHeapBlockCreate(vkfast, storageType, bytesCount, &block, optionalFile, optionalLine);
+
+  if (current.array.handle != NULL) {
+    // To free
+    vf_heap_block_t * retiredBlocks = (vf_heap_block_t *)red32MemoryCalloc(sizeof(vf_heap_block_t) * (heap->retiredBlocksCount + 1));
+    REDGPU_2_EXPECTWG(retiredBlocks != NULL);
+    for (uint64_t i = 0; i < heap->retiredBlocksCount; i += 1) {
+      retiredBlocks[i] = heap->retiredBlocks[i];
+    }
+    retiredBlocks[heap->retiredBlocksCount] = current;
+    if (heap->retiredBlocks != NULL) {
+      red32MemoryFree(heap->retiredBlocks);
+    }
+    heap->retiredBlocks       = retiredBlocks;
+    heap->retiredBlocksCount += 1;
+  }
+  heap->totalBytesCount += block.array.memoryBytesCount;
+
+  vfInternalHeapSetCurrentBlock(vkfast, storageType, &block);
+
+  if (vkfast->isDebugMode == 1) {
+    char numberString[4096] = {0};
+    vfInternalPrint("[vkFast][Debug] Storages heap ");
+    red32Uint64ToChars(storageType, numberString);
+    vfInternalPrint(numberString);
+    vfInternalPrint(" grew by ");
+    red32Uint64ToChars(block.array.memoryBytesCount, numberString);
+    vfInternalPrint(numberString);
+    vfInternalPrint(" bytes to ");
+    red32Uint64ToChars(heap->totalBytesCount, numberString);
+    vfInternalPrint(numberString);
+    vfInternalPrint(" bytes" "\n");
+  }
+}
+
+// NOTE(Constantine):
+// Heap growth swaps the current block of a heap, which is several fields, so it must not overlap the lock-free bumps of vfStorageCreate().
+// Bumpers announce themselves in heapsBumpersCount and then check heapsGrowing, growth sets heapsGrowing and then waits for heapsBumpersCount
+// to drain. Both sides are sequentially consistent, so either the bumper sees the growth and takes the slow path, or the growth waits for it.
+// Growths are serialized by heapsGrowMutex, which bumpers that took the slow path sleep on instead of spinning.
+static void vfInternalHeapsGrowBegin(vf_handle_context_t * vkfast) {
+  vfInternalMutexLock(vkfast->heapsGrowMutex);
+  vfInternalAtomicAddUint64(&vkfast->heapsGrowing, 1);
+  for (uint64_t spinsCount = 0; vfInternalAtomicLoadUint64(&vkfast->heapsBumpersCount) != 0; spinsCount += 1) {
+    vfInternalSpinPause(spinsCount);
+  }
+}
+
+static void vfInternalHeapsGrowEnd(vf_handle_context_t * vkfast) {
+  vfInternalAtomicAddUint64(&vkfast->heapsGrowing, (uint64_t)-1);
+  vfInternalMutexUnlock(vkfast->heapsGrowMutex);
+}
+
+static void vfInternalHeapsNonCoherentFlushOrInvalidate(vf_handle_context_t * vkfast, gpu_storage_type_t storageType, const char * optionalFile, int optionalLine) {
+  const int isInvalidate = storageType == GPU_STORAGE_TYPE_CPU_READBACK ? 1 : 0;
+
+  vfInternalMutexLock(vkfast->heapsGrowMutex);
+  vf_heap_block_t current = {0};
+  vfInternalHeapGetCurrentBlock(vkfast, storageType, &current);
+  vfInternalMemoryNonCoherentFlushOrInvalidate(vkfast, isInvalidate, current.memory, current.array.memoryBytesCount, 0, current.memory_suballocations_offset, optionalFile, optionalLine);
+
+  const vf_heap_blocks_t * heap = &vkfast->heapsBlocks[storageType];
+  for (uint64_t i = 0; i < heap->retiredBlocksCount; i += 1) {
+    const vf_heap_block_t * block = &heap->retiredBlocks[i];
+    vfInternalMemoryNonCoherentFlushOrInvalidate(vkfast, isInvalidate, block->memory, block->array.memoryBytesCount, 0, block->memory_suballocations_offset, optionalFile, optionalLine);
+  }
+  vfInternalMutexUnlock(vkfast->heapsGrowMutex);
+}
+
+static void vfInternalHeapsDestroyRetiredBlocks(vf_handle_context_t * vkfast, const char * optionalFile, int optionalLine) {
+  for (int storageType = GPU_STORAGE_TYPE_GPU_ONLY; storageType <= GPU_STORAGE_TYPE_CPU_READBACK; storageType += 1) {
+    vf_heap_blocks_t * heap = &vkfast->heapsBlocks[storageType];
+    for (uint64_t i = 0; i < heap->retiredBlocksCount; i += 1) {
+      vfInternalHeapBlockDestroy(vkfast, &heap->retiredBlocks[i], optionalFile, optionalLine);
+    }
+    if (heap->retiredBlocks != NULL) {
+      red32MemoryFree(heap->retiredBlocks);
+    }
+    heap->retiredBlocks      = NULL;
+    heap->retiredBlocksCount = 0;
+  }
+}
+
+static uint64_t vfInternalCaptureHashContents(const void * contents, uint64_t bytesCount) {
+  // NOTE(Constantine): FNV-1a over 8-byte words, only used to skip writing unchanged storages contents.
+  const uint8_t * bytes = (const uint8_t *)contents;
+  uint64_t hash = 14695981039346656037ULL;
+  uint64_t i = 0;
+  for (; i + 8 <= bytesCount; i += 8) {
+    uint64_t word = 0;
+    red32MemoryCopy(&word, &bytes[i], 8);
+    hash = (hash ^ word) * 1099511628211ULL;
+  }
+  for (; i < bytesCount; i += 1) {
+    hash = (hash ^ bytes[i]) * 1099511628211ULL;
+  }
+  return hash;
+}
+
+// NOTE(Constantine): Must be called with vkfast->captureMutex taken.
+static void vfInternalCaptureWriteLocked(vf_handle_context_t * vkfast, gpu_capture_op_t op, int optionalLine, unsigned wordsCount, const uint64_t * words, uint64_t blobBytesCount, const void * blob) {
+  FILE * fh = (FILE *)vkfast->captureFile;
+
+  gpu_capture_record_header_t header = {0};
+  header.op               = (uint32_t)op;
+  header.optional_line    = (int32_t)optionalLine;
+  header.words_count      = wordsCount;
+  header.blob_bytes_count = blobBytesCount;
+  fwrite(&header, sizeof(header), 1, fh);
+  if (wordsCount > 0) {
+    fwrite(words, sizeof(uint64_t), wordsCount, fh);
+  }
+  if (blobBytesCount > 0) {
+    fwrite(blob, 1, blobBytesCount, fh);
+  }
+}
+
+static void vfInternalCaptureWrite(vf_handle_context_t * vkfast, gpu_capture_op_t op, int optionalLine, unsigned wordsCount, const uint64_t * words, uint64_t blobBytesCount, const void * blob) {
+  if (vkfast->captureFile == NULL) {
+    return;
+  }
+  vfInternalMutexLock(vkfast->captureMutex);
+  if (vkfast->captureFile != NULL) {
+    vfInternalCaptureWriteLocked(vkfast, op, optionalLine, wordsCount, words, blobBytesCount, blob);
+  }
+  vfInternalMutexUnlock(vkfast->captureMutex);
+}
+
+static void vfInternalCaptureStorageCreate(vf_handle_context_t * vkfast, const gpu_storage_t * storage, int optionalLine) {
+  if (vkfast->captureFile == NULL) {
+    return;
+  }
+  const uint64_t words[3] = {storage->id, (uint64_t)storage->info.storage_type, storage->info.bytes_count};
+  vfInternalMutexLock(vkfast->captureMutex);
+  if (vkfast->captureFile != NULL) {
+    vfInternalCaptureWriteLocked(vkfast, GPU_CAPTURE_OP_STORAGE_CREATE, optionalLine, 3, words, 0, NULL);
+    if (storage->info.storage_type == GPU_STORAGE_TYPE_CPU_UPLOAD) {
+      if (vkfast->captureCpuUploadStoragesCount == vkfast->captureCpuUploadStoragesCapacity) {
+        const uint64_t capacity = vkfast->captureCpuUploadStoragesCapacity == 0 ? 64 : vkfast->captureCpuUploadStoragesCapacity * 2;
+        // To free
+        vf_capture_storage_t * storages = (vf_capture_storage_t *)red32MemoryCalloc(sizeof(vf_capture_storage_t) * capacity);
+        REDGPU_2_EXPECTFL(storages != NULL);
+        if (vkfast->captureCpuUploadStorages != NULL) {
+          red32MemoryCopy(storages, vkfast->captureCpuUploadStorages, sizeof(vf_capture_storage_t) * vkfast->captureCpuUploadStoragesCount);
+          red32MemoryFree(vkfast->captureCpuUploadStorages);
+        }
+        vkfast->captureCpuUploadStorages         = storages;
+        vkfast->captureCpuUploadStoragesCapacity = capacity;
+      }
+      vf_capture_storage_t * captured = &vkfast->captureCpuUploadStorages[vkfast->captureCpuUploadStoragesCount];
+      captured->id              = storage->id;
+      captured->mapped_void_ptr = storage->mapped_void_ptr;
+      captured->bytes_count     = storage->info.bytes_count;
+      captured->contents_hash   = 0;
+      vkfast->captureCpuUploadStoragesCount += 1;
+    }
+  }
+  vfInternalMutexUnlock(vkfast->captureMutex);
+}
+
+static void vfInternalCaptureIdDestroy(vf_handle_context_t * vkfast, uint64_t id, int optionalLine) {
+  if (vkfast->captureFile == NULL) {
+    return;
+  }
+  vfInternalMutexLock(vkfast->captureMutex);
+  if (vkfast->captureFile != NULL) {
+    vfInternalCaptureWriteLocked(vkfast, GPU_CAPTURE_OP_ID_DESTROY, optionalLine, 1, &id, 0, NULL);
+    for (uint64_t i = 0; i < vkfast->captureCpuUploadStoragesCount; i += 1) {
+      if (vkfast->captureCpuUploadStorages[i].id == id) {
+        vkfast->captureCpuUploadStorages[i] = vkfast->captureCpuUploadStorages[vkfast->captureCpuUploadStoragesCount - 1];
+        vkfast->captureCpuUploadStoragesCount -= 1;
+        break;
+      }
+    }
+  }
+  vfInternalMutexUnlock(vkfast->captureMutex);
+}
+
+static void vfInternalStoragesAdd(vf_handle_context_t * vkfast, vf_handle_t * storage, const char * optionalFile, int optionalLine) {
+  vfInternalSpinLock(&vkfast->storagesLock);
+  storage->storage.isInStorages = 1;
+  storage->storage.storagesPrev = vkfast->storagesLast;
+  storage->storage.storagesNext = NULL;
+  if (vkfast->storagesLast != NULL) {
+    vkfast->storagesLast->storage.storagesNext = storage;
+  } else {
+    vkfast->storagesFirst = storage;
+  }
+  vkfast->storagesLast   = storage;
+  vkfast->storagesCount += 1;
+  vfInternalSpinUnlock(&vkfast->storagesLock);
+}
+
+static void vfInternalStoragesRemove(vf_handle_context_t * vkfast, vf_handle_t * storage) {
+  vfInternalSpinLock(&vkfast->storagesLock);
+  if (storage->storage.isInStorages == 1) {
+    if (storage->storage.storagesPrev != NULL) {
+      storage->storage.storagesPrev->storage.storagesNext = storage->storage.storagesNext;
+    } else {
+      vkfast->storagesFirst = storage->storage.storagesNext;
+    }
+    if (storage->storage.storagesNext != NULL) {
+      storage->storage.storagesNext->storage.storagesPrev = storage->storage.storagesPrev;
+    } else {
+      vkfast->storagesLast = storage->storage.storagesPrev;
+    }
+    storage->storage.isInStorages = 0;
+    storage->storage.storagesPrev = NULL;
+    storage->storage.storagesNext = NULL;
+    vkfast->storagesCount -= 1;
+  }
+  vfInternalSpinUnlock(&vkfast->storagesLock);
+}
+
+// NOTE(Constantine): Storages invalidated by vfContextResetAndInvalidateAllStorages() leave the list, their vfIdDestroy() then doesn't touch it.
+static void vfInternalStoragesClear(vf_handle_context_t * vkfast) {
+  vfInternalSpinLock(&vkfast->storagesLock);
+  for (vf_handle_t * storage = vkfast->storagesFirst; storage != NULL;) {
+    vf_handle_t * next = storage->storage.storagesNext;
+    storage->storage.isInStorages = 0;
+    storage->storage.storagesPrev = NULL;
+    storage->storage.storagesNext = NULL;
+    storage = next;
+  }
+  vkfast->storagesFirst = NULL;
+  vkfast->storagesLast  = NULL;
+  vkfast->storagesCount = 0;
+  vfInternalSpinUnlock(&vkfast->storagesLock);
+}
+
+// NOTE(Constantine): Imported storages are suballocated from the heap of the exporting context.
+static vf_handle_context_t * vfInternalStorageGetHeapContext(const vf_handle_t * storage) {
+  return storage->storage.share != NULL ? storage->storage.share->heapVkfast : storage->vkfast;
+}
+
+static void vfInternalStorageShareRelease(vf_storage_share_t * share) {
+  vfInternalSpinLock(&share->lock);
+  share->referencesCount -= 1;
+  const uint64_t referencesCount = share->referencesCount;
+  vfInternalSpinUnlock(&share->lock);
+  if (referencesCount == 0) {
+    red32MemoryFree(share);
+  }
+}
+
+// NOTE(Constantine): Returns NULL if the pool is empty.
+static RedHandleCpuSignal vfInternalCpuSignalsPoolPop(vf_handle_context_t * vkfast) {
+  RedHandleCpuSignal cpuSignal = NULL;
+  vfInternalSpinLock(&vkfast->cpuSignalsPoolLock);
+  if (vkfast->cpuSignalsPoolCount > 0) {
+    vkfast->cpuSignalsPoolCount -= 1;
+    cpuSignal = vkfast->cpuSignalsPool[vkfast->cpuSignalsPoolCount];
+  }
+  vfInternalSpinUnlock(&vkfast->cpuSignalsPoolLock);
+  return cpuSignal;
+}
+
+// NOTE(Constantine): cpuSignal must be unsignaled.
+static void vfInternalCpuSignalsPoolPush(vf_handle_context_t * vkfast, RedHandleCpuSignal cpuSignal, const char * optionalFile, int optionalLine) {
+  vfInternalSpinLock(&vkfast->cpuSignalsPoolLock);
+  if (vkfast->cpuSignalsPoolCount == vkfast->cpuSignalsPoolCapacity) {
+    const uint64_t capacity = vkfast->cpuSignalsPoolCapacity == 0 ? 16 : vkfast->cpuSignalsPoolCapacity * 2;
+    // To free
+    RedHandleCpuSignal * pool = (RedHandleCpuSignal *)red32MemoryCalloc(sizeof(RedHandleCpuSignal) * capacity);
+    REDGPU_2_EXPECTFL(pool != NULL);
+    if (vkfast->cpuSignalsPool != NULL) {
+      red32MemoryCopy(pool, vkfast->cpuSignalsPool, sizeof(RedHandleCpuSignal) * vkfast->cpuSignalsPoolCount);
+      red32MemoryFree(vkfast->cpuSignalsPool);
+    }
+    vkfast->cpuSignalsPool         = pool;
+    vkfast->cpuSignalsPoolCapacity = capacity;
+  }
+  vkfast->cpuSignalsPool[vkfast->cpuSignalsPoolCount] = cpuSignal;
+  vkfast->cpuSignalsPoolCount += 1;
+  vfInternalSpinUnlock(&vkfast->cpuSignalsPoolLock);
+}
+
+// NOTE(Constantine): The pool only holds the signals of asyncs that were waited on and not handed out again, usually a few.
+static int vfInternalCpuSignalsPoolContains(vf_handle_context_t * vkfast, RedHandleCpuSignal cpuSignal) {
+  int isPooled = 0;
+  vfInternalSpinLock(&vkfast->cpuSignalsPoolLock);
+  for (uint64_t i = 0; i < vkfast->cpuSignalsPoolCount; i += 1) {
+    if (vkfast->cpuSignalsPool[i] == cpuSignal) {
+      isPooled = 1;
+      break;
+    }
+  }
+  vfInternalSpinUnlock(&vkfast->cpuSignalsPoolLock);
+  return isPooled;
+}
+
+static void vfInternalCaptureAsyncBatchExecute(vf_handle_context_t * vkfast, uint64_t asyncId, RedHandleQueue queue, uint64_t batchCallsCount, const RedHandleCalls * batchCalls, unsigned gpuThreadsCount, const gpu_thread_t * gpuThreads, int optionalLine) {
+  if (vkfast->captureFile == NULL) {
+    return;
+  }
+  unsigned queueIndex = 0;
+  for (unsigned i = 0; i < vkfast->gpuInfo->queuesCount; i += 1) {
+    if (vkfast->gpuInfo->queues[i] == queue) {
+      queueIndex = i;
+      break;
+    }
+  }
+  const unsigned wordsCount = 4 + (unsigned)batchCallsCount + gpuThreadsCount;
+  // To free
+  uint64_t * words = (uint64_t *)red32MemoryCalloc(sizeof(uint64_t) * wordsCount);
+  REDGPU_2_EXPECTFL(words != NULL);
+  words[0] = asyncId;
+  words[1] = queueIndex;
+  words[2] = batchCallsCount;
+  words[3] = gpuThreadsCount;
+  for (uint64_t i = 0; i < batchCallsCount; i += 1) {
+    words[4 + i] = (uint64_t)(void *)batchCalls[i];
+  }
+  for (unsigned i = 0; i < gpuThreadsCount; i += 1) {
+    words[4 + batchCallsCount + i] = (uint64_t)(void *)gpuThreads[i];
+  }
+  // NOTE(Constantine): Snapshotting the CPU upload storages under captureMutex, then hashing them with it released, so a submit
+  // that hashes megabytes of upload storages doesn't stall other threads' captured calls. Storages mapped pointers stay readable
+  // after a concurrent vfIdDestroy() since heap blocks outlive the storages suballocated from them, host pointers imported with
+  // vfStorageCreateFromHostPointer() must not be freed while another thread submits during a capture.
+  vfInternalMutexLock(vkfast->captureMutex);
+  const uint64_t snapshotCount = vkfast->captureCpuUploadStoragesCount;
+  // To free
+  vf_capture_storage_t * snapshot = NULL;
+  if (snapshotCount > 0) {
+    snapshot = (vf_capture_storage_t *)red32MemoryCalloc(sizeof(vf_capture_storage_t) * snapshotCount);
+    if (snapshot != NULL) {
+      red32MemoryCopy(snapshot, vkfast->captureCpuUploadStorages, sizeof(vf_capture_storage_t) * snapshotCount);
+    }
+  }
+  vfInternalMutexUnlock(vkfast->captureMutex);
+  REDGPU_2_EXPECTFL(snapshotCount == 0 || snapshot != NULL);
+  for (uint64_t i = 0; i < snapshotCount; i += 1) {
+    const uint64_t hash = vfInternalCaptureHashContents(snapshot[i].mapped_void_ptr, snapshot[i].bytes_count);
+    // NOTE(Constantine): Reusing mapped_void_ptr as a changed flag for the write pass below.
+    if (hash == snapshot[i].contents_hash) {
+      snapshot[i].mapped_void_ptr = NULL;
+    }
+    snapshot[i].contents_hash = hash;
+  }
+  vfInternalMutexLock(vkfast->captureMutex);
+  if (vkfast->captureFile != NULL) {
+    // NOTE(Constantine): Writing the contents of every CPU upload storage the CPU changed since the previous submit, skipping the ones
+    // destroyed or whose capture ended and began again since the snapshot.
+    for (uint64_t i = 0; i < snapshotCount; i += 1) {
+      if (snapshot[i].mapped_void_ptr == NULL) {
+        continue;
+      }
+      for (uint64_t j = 0; j < vkfast->captureCpuUploadStoragesCount; j += 1) {
+        vf_capture_storage_t * captured = &vkfast->captureCpuUploadStorages[j];
+        if (captured->id == snapshot[i].id) {
+          vfInternalCaptureWriteLocked(vkfast, GPU_CAPTURE_OP_STORAGE_CONTENTS, optionalLine, 1, &captured->id, captured->bytes_count, captured->mapped_void_ptr);
+          captured->contents_hash = snapshot[i].contents_hash;
+          break;
+        }
+      }
+    }
+    vfInternalCaptureWriteLocked(vkfast, GPU_CAPTURE_OP_ASYNC_BATCH_EXECUTE, optionalLine, wordsCount, words, 0, NULL);
+  }
+  vfInternalMutexUnlock(vkfast->captureMutex);
+  if (snapshot != NULL) {
+    red32MemoryFree(snapshot);
+  }
+  red32MemoryFree(words);
+}
+
+static RedBool32 vfRedGpuDebugCallback(RedDebugCallbackSeverity severity, RedDebugCallbackTypeBitflags types, const RedDebugCallbackData * data, RedContext context) {
+  if (0 == strcmp(data->messageIdName, "VUID-VkDebugUtilsMessengerCallbackDataEXT-flags-zerobitmask")) {
+    return 0;
+  }
+  if (0 == strcmp(data->messageIdName, "RED_PROCEDURE_ID_redQueuePresent") &&
+      0 == strcmp(data->message,       "RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE"))
+  {
+    return 0;
+  }
+  if (0 == strcmp(data->messageIdName, "RED_PROCEDURE_ID_redPresentGetImageIndex") &&
+      0 == strcmp(data->message,       "RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE"))
+  {
+    return 0;
+  }
+  if (0 == strcmp(data->messageIdName, "RED_PROCEDURE_ID_redCreateContext") &&
+      0 == strcmp(data->message,       "RED_STATUS_ERROR_INCOMPATIBLE_DRIVER"))
+  {
+    return 0; // NOTE(Constantine): Android can only set 4 GPU structs max.
+  }
+  vfInternalPrint("[vkFast][Debug callback] ");
+  vfInternalPrint(data->message);
+  vfInternalPrint("\n");
+
+  #ifndef VKFAST_DEFINE_ENABLE_FEATURE_GPU_DEBUG_PRINTF
+    MessageBoxA(NULL, data->message, "[vkFast][Debug callback]", MB_OK);
+    #if defined(_WIN32)
+    system("pause");
+    #endif
+    red32Exit(1);
+  #endif
+
+  return 0;
+}
+
+static void vfInternalExpectMinimumGuaranteesAdreno735(const RedGpuInfo * gpuInfo, const char * optionalFile, int optionalLine) {
+  RedHandleGpu gpu = gpuInfo->gpu;
+  REDGPU_2_EXPECTWG(gpuInfo->maxMemoryAllocateCount                      >= REDGPU_2_EXPECTED_maxMemoryAllocateCount_4096); // maxMemoryAllocationCount
+  REDGPU_2_EXPECTWG(gpuInfo->minMemoryAllocateBytesAlignment             <= REDGPU_2_EXPECTED_minMemoryAllocateBytesAlignment_4096); // minMemoryMapAlignment; RX 550 and Arc A770 and Arc B580 on Linux
+  REDGPU_2_EXPECTWG(gpuInfo->maxMemoryAllocateBytesCount                 >= REDGPU_2_EXPECTED_maxMemoryAllocateBytesCount_1073741824); // maxMemoryAllocationSize; Redmi Note 8 on Android 11; Not used: RX 550 and RX 9070 XT on Windows is 2147483648
+  REDGPU_2_EXPECTWG(gpuInfo->minMemoryNonCoherentBlockBytesCount         <= REDGPU_2_EXPECTED_minMemoryNonCoherentBlockBytesCount_256); // nonCoherentAtomSize
+  REDGPU_2_EXPECTWG(gpuInfo->maxCreateSamplerCount                       >= REDGPU_2_EXPECTED_maxCreateSamplerCount_4000); // maxSamplerAllocationCount
+  REDGPU_2_EXPECTWG(gpuInfo->minMemoryPageSeparationArrayImageBytesCount <= REDGPU_2_EXPECTED_minMemoryPageSeparationArrayImageBytesCount_65536); // bufferImageGranularity; D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT (65536)
+  REDGPU_2_EXPECTWG(gpuInfo->minArrayROCStructMemberRangeBytesAlignment  <= REDGPU_2_EXPECTED_minArrayROCStructMemberRangeBytesAlignment_256); // minUniformBufferOffsetAlignment; D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT (256)
+  REDGPU_2_EXPECTWG(gpuInfo->maxArrayROCStructMemberRangeBytesCount      >= REDGPU_2_EXPECTED_maxArrayROCStructMemberRangeBytesCount_65536); // maxUniformBufferRange; D3D12_REQ_CONSTANT_BUFFER_ELEMENT_COUNT (4096) * 16
+  REDGPU_2_EXPECTWG(gpuInfo->minArrayRORWStructMemberRangeBytesAlignment <= REDGPU_2_EXPECTED_minArrayRORWStructMemberRangeBytesAlignment_64); // minStorageBufferOffsetAlignment; Arc A770 and Arc B580 on Windows, Redmi Note 8 on Android 11; Not used: D3D12_RAW_UAV_SRV_BYTE_ALIGNMENT (16)
+  REDGPU_2_EXPECTWG(gpuInfo->maxArrayRORWStructMemberRangeBytesCount     >= 134217728); // maxStorageBufferRange; Adreno 735 on Android
+  REDGPU_2_EXPECTWG(gpuInfo->maxArrayIndexUint32Value                    == 0xFFFFFFFF); // maxDrawIndexedIndexValue
+  REDGPU_2_EXPECTWG(gpuInfo->maxImageDimensions1D                        >= REDGPU_2_EXPECTED_maxImageDimensions1D_16384); // maxImageDimension1D; D3D12_REQ_TEXTURE1D_U_DIMENSION (16384)
+  REDGPU_2_EXPECTWG(gpuInfo->maxImageDimensions2D                        >= REDGPU_2_EXPECTED_maxImageDimensions2D_16384); // maxImageDimension2D; D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION (16384)
+  REDGPU_2_EXPECTWG(gpuInfo->maxImageDimensions3D                        >= REDGPU_2_EXPECTED_maxImageDimensions3D_2048); // maxImageDimension3D; D3D12_REQ_TEXTURE3D_U_V_OR_W_DIMENSION (2048)
+  REDGPU_2_EXPECTWG(gpuInfo->maxImageDimensionsCube                      >= REDGPU_2_EXPECTED_maxImageDimensionsCube_16384); // maxImageDimensionCube; D3D12_REQ_TEXTURECUBE_DIMENSION (16384)
+  REDGPU_2_EXPECTWG(gpuInfo->maxImageLayersCount                         >= REDGPU_2_EXPECTED_maxImageLayersCount_2048); // maxImageArrayLayers; D3D12_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION (2048)
+  REDGPU_2_EXPECTWG(gpuInfo->maxSamplerMipLodBias                        >= REDGPU_2_EXPECTED_maxSamplerMipLodBias_15); // maxSamplerLodBias; RTX 2060; Not used: D3D12_MIP_LOD_BIAS_MAX (15.99f)
+  REDGPU_2_EXPECTWG(gpuInfo->maxSamplerAnisotropy                        >= REDGPU_2_EXPECTED_maxSamplerAnisotropy_16); // maxSamplerAnisotropy; D3D12_MAX_MAXANISOTROPY (16)
+  REDGPU_2_EXPECTWG(gpuInfo->precisionBitsSamplerFilteringMagMin         >= REDGPU_2_EXPECTED_precisionBitsSamplerFilteringMagMin_8); // subTexelPrecisionBits; D3D12_SUBTEXEL_FRACTIONAL_BIT_COUNT (8)
+  REDGPU_2_EXPECTWG(gpuInfo->precisionBitsSamplerFilteringMip            >= REDGPU_2_EXPECTED_precisionBitsSamplerFilteringMip_8); // mipmapPrecisionBits; D3D12_MIP_LOD_FRACTIONAL_BIT_COUNT (8)
+  REDGPU_2_EXPECTWG(gpuInfo->maxOutputWidth                              >= REDGPU_2_EXPECTED_maxOutputWidth_16384); // maxFramebufferWidth; D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION (16384)
+  REDGPU_2_EXPECTWG(gpuInfo->maxOutputHeight                             >= REDGPU_2_EXPECTED_maxOutputHeight_16384); // maxFramebufferHeight; D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION (16384)
+  REDGPU_2_EXPECTWG(gpuInfo->maxOutputColorsCount                        >= REDGPU_2_EXPECTED_maxOutputColorsCount_8); // maxColorAttachments; D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT (8)
+  REDGPU_2_EXPECTWG(gpuInfo->supportedMultisampleCountsForOutputDepth    >= (RED_MULTISAMPLE_COUNT_BITFLAG_1 | RED_MULTISAMPLE_COUNT_BITFLAG_4));
+  REDGPU_2_EXPECTWG(gpuInfo->supportedMultisampleCountsForOutputStencil  >= (RED_MULTISAMPLE_COUNT_BITFLAG_1 | RED_MULTISAMPLE_COUNT_BITFLAG_4));
+  REDGPU_2_EXPECTWG(gpuInfo->supportedMultisampleCountsForOutputColor    >= (RED_MULTISAMPLE_COUNT_BITFLAG_1 | RED_MULTISAMPLE_COUNT_BITFLAG_4));
+  REDGPU_2_EXPECTWG(gpuInfo->supportedMultisampleCountsForEmptyOutput    >= (RED_MULTISAMPLE_COUNT_BITFLAG_1 | RED_MULTISAMPLE_COUNT_BITFLAG_4));
+  REDGPU_2_EXPECTWG(gpuInfo->maxStructSlotsCount                         >= REDGPU_2_EXPECTED_maxStructSlotsCount_1024); // maxPerSetDescriptors; Arc A770 and Arc B580 on Linux
+  REDGPU_2_EXPECTWG(gpuInfo->maxStructPerStageArrayROCsCount             >= REDGPU_2_EXPECTED_maxStructPerStageArrayROCsCount_12); // maxPerStageDescriptorUniformBuffers; Not used: Tegra X1 on Linux is 15
+  REDGPU_2_EXPECTWG(gpuInfo->maxStructPerStageArrayRORWsCount            >= 200); // Intel UHD Graphics 730 on Windows 10
+  REDGPU_2_EXPECTWG(gpuInfo->maxStructPerStageSamplersCount              >= 64); // Intel UHD Graphics 730 on Windows 10
+  REDGPU_2_EXPECTWG(gpuInfo->maxStructPerStageTextureROsCount            >= 200); // Intel UHD Graphics 730 on Windows 10
+  REDGPU_2_EXPECTWG(gpuInfo->maxStructPerStageTextureRWsCount            >= 16); // Intel UHD Graphics 730 on Windows 10
+  REDGPU_2_EXPECTWG(gpuInfo->maxStructPerStageAllResourcesCount          >= 200); // Intel UHD Graphics 730 on Windows 10
+  REDGPU_2_EXPECTWG(gpuInfo->maxStructArrayROCsCount                     >= 1800); // Intel UHD Graphics 730 on Windows 10
+  REDGPU_2_EXPECTWG(gpuInfo->maxStructArrayRORWsCount                    >= 1800); // Intel UHD Graphics 730 on Windows 10
+  REDGPU_2_EXPECTWG(gpuInfo->maxStructSamplersCount                      >= 576); // Intel UHD Graphics 730 on Windows 10
+  REDGPU_2_EXPECTWG(gpuInfo->maxStructTextureROsCount                    >= 1800); // Intel UHD Graphics 730 on Windows 10
+  REDGPU_2_EXPECTWG(gpuInfo->maxStructTextureRWsCount                    >= 144); // Intel UHD Graphics 730 on Windows 10
+  REDGPU_2_EXPECTWG(gpuInfo->maxProcedureParametersVariablesBytesCount   >= REDGPU_2_EXPECTED_maxProcedureParametersVariablesBytesCount_128); // maxPushConstantsSize; Arc A770 on Linux, RX 550 on Windows, Redmi Note 8 on Android 11
+  REDGPU_2_EXPECTWG(gpuInfo->maxViewportDimensions[0]                    >= REDGPU_2_EXPECTED_maxViewportDimensionsX_16384); // maxViewportDimensions[0]; D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION (16384)
+  REDGPU_2_EXPECTWG(gpuInfo->maxViewportDimensions[1]                    >= REDGPU_2_EXPECTED_maxViewportDimensionsY_16384); // maxViewportDimensions[1]; D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION (16384)
+  REDGPU_2_EXPECTWG(gpuInfo->minViewportBoundsRange                      <= REDGPU_2_EXPECTED_minViewportBoundsRange_minus_32768); // viewportBoundsRange[0]; D3D12_VIEWPORT_BOUNDS_MIN (-32768)
+  REDGPU_2_EXPECTWG(gpuInfo->maxViewportBoundsRange                      >= REDGPU_2_EXPECTED_maxViewportBoundsRange_32767); // viewportBoundsRange[1]; D3D12_VIEWPORT_BOUNDS_MAX (32767)
+  REDGPU_2_EXPECTWG(gpuInfo->precisionBitsViewportCoordinates            >= REDGPU_2_EXPECTED_precisionBitsViewportCoordinates_8); // subPixelPrecisionBits; D3D12_SUBPIXEL_FRACTIONAL_BIT_COUNT (8)
+  REDGPU_2_EXPECTWG(gpuInfo->precisionBitsViewportBounds                 >= REDGPU_2_EXPECTED_precisionBitsViewportBounds_8); // viewportSubPixelBits; D3D12_SUBPIXEL_FRACTIONAL_BIT_COUNT (8)
+  REDGPU_2_EXPECTWG(gpuInfo->maxPerStageClipDistances                    >= REDGPU_2_EXPECTED_maxPerStageClipDistances_8); // maxClipDistances; D3D12_CLIP_OR_CULL_DISTANCE_COUNT (8)
+  REDGPU_2_EXPECTWG(gpuInfo->maxPerStageCullDistances                    >= REDGPU_2_EXPECTED_maxPerStageCullDistances_8); // maxCullDistances; D3D12_CLIP_OR_CULL_DISTANCE_COUNT (8)
+  REDGPU_2_EXPECTWG(gpuInfo->maxPerStageClipAndCullDistances             >= REDGPU_2_EXPECTED_maxPerStageClipAndCullDistances_8); // maxCombinedClipAndCullDistances; D3D12_CLIP_OR_CULL_DISTANCE_COUNT (8)
+  REDGPU_2_EXPECTWG(gpuInfo->maxVertexOutputLocationsCount               >= REDGPU_2_EXPECTED_maxVertexOutputLocationsCount_128); // maxVertexOutputComponents; D3D12_VS_INPUT_REGISTER_COUNT (32) * D3D12_VS_INPUT_REGISTER_COMPONENTS (4)
+  REDGPU_2_EXPECTWG(gpuInfo->maxFragmentInputLocationsCount              >= REDGPU_2_EXPECTED_maxFragmentInputLocationsCount_112); // maxFragmentInputComponents; Redmi Note 8 on Android 11; Not used: Arc A770 and Arc B580 on Linux is 116; Not used: D3D12_PS_INPUT_REGISTER_COUNT (32) * D3D12_PS_INPUT_REGISTER_COMPONENTS (4)
+  REDGPU_2_EXPECTWG(gpuInfo->maxFragmentOutputColorsCount                >= REDGPU_2_EXPECTED_maxFragmentOutputColorsCount_8); // maxFragmentOutputAttachments; D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT (8)
+  REDGPU_2_EXPECTWG(gpuInfo->maxFragmentOutputColorsCountBlendDualSource >= REDGPU_2_EXPECTED_maxFragmentOutputColorsCountBlendDualSource_1); // maxFragmentDualSrcAttachments
+  REDGPU_2_EXPECTWG(gpuInfo->maxFragmentOutputResourcesCount             >= REDGPU_2_EXPECTED_maxFragmentOutputResourcesCount_16); // maxFragmentCombinedOutputResources; Tegra X1 on Linux, D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT (8) + D3D12_PS_CS_UAV_REGISTER_COUNT (8); Not used: Redmi Note 8 on Android 11 is 72
+  REDGPU_2_EXPECTWG(gpuInfo->maxComputeSharedMemoryBytesCount            >= REDGPU_2_EXPECTED_maxComputeSharedMemoryBytesCount_16384); // maxComputeSharedMemorySize; Redmi Note 8 on Android 11, D3D12_CS_THREAD_LOCAL_TEMP_REGISTER_POOL (16384); Not used: Arc A770 and Arc B580 and RX 9070 XT on Windows is 32768
+  REDGPU_2_EXPECTWG(gpuInfo->maxComputeWorkgroupsCount[0]                >= REDGPU_2_EXPECTED_maxComputeWorkgroupsCountX_65535); // maxComputeWorkGroupCount[0]; D3D12_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION (65535)
+  REDGPU_2_EXPECTWG(gpuInfo->maxComputeWorkgroupsCount[1]                >= REDGPU_2_EXPECTED_maxComputeWorkgroupsCountY_65535); // maxComputeWorkGroupCount[1]; D3D12_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION (65535)
+  REDGPU_2_EXPECTWG(gpuInfo->maxComputeWorkgroupsCount[2]                >= REDGPU_2_EXPECTED_maxComputeWorkgroupsCountZ_65535); // maxComputeWorkGroupCount[2]; D3D12_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION (65535)
+  REDGPU_2_EXPECTWG(gpuInfo->maxComputeWorkgroupInvocationsCount         >= REDGPU_2_EXPECTED_maxComputeWorkgroupInvocationsCount_1024); // maxComputeWorkGroupInvocations; D3D12_CS_THREAD_GROUP_MAX_THREADS_PER_GROUP (1024)
+  REDGPU_2_EXPECTWG(gpuInfo->maxComputeWorkgroupDimensions[0]            >= REDGPU_2_EXPECTED_maxComputeWorkgroupDimensionsX_1024); // maxComputeWorkGroupSize[0]; D3D12_CS_THREAD_GROUP_MAX_X (1024)
+  REDGPU_2_EXPECTWG(gpuInfo->maxComputeWorkgroupDimensions[1]            >= REDGPU_2_EXPECTED_maxComputeWorkgroupDimensionsY_1024); // maxComputeWorkGroupSize[1]; D3D12_CS_THREAD_GROUP_MAX_Y (1024)
+  REDGPU_2_EXPECTWG(gpuInfo->maxComputeWorkgroupDimensions[2]            >= REDGPU_2_EXPECTED_maxComputeWorkgroupDimensionsZ_64); // maxComputeWorkGroupSize[2]; D3D12_CS_THREAD_GROUP_MAX_Z (64)
+  REDGPU_2_EXPECTWG(gpuInfo->minImageSampleImageFetchOffset              <= REDGPU_2_EXPECTED_minImageSampleImageFetchOffset_minus_8); // minTexelOffset; D3D12_COMMONSHADER_TEXEL_OFFSET_MAX_NEGATIVE (-8)
+  REDGPU_2_EXPECTWG(gpuInfo->maxImageSampleImageFetchOffset              >= REDGPU_2_EXPECTED_maxImageSampleImageFetchOffset_7); // maxTexelOffset; D3D12_COMMONSHADER_TEXEL_OFFSET_MAX_POSITIVE (7)
+  REDGPU_2_EXPECTWG(gpuInfo->minImageGatherOffset                        <= REDGPU_2_EXPECTED_minImageGatherOffset_minus_32); // minTexelGatherOffset
+  REDGPU_2_EXPECTWG(gpuInfo->maxImageGatherOffset                        >= REDGPU_2_EXPECTED_maxImageGatherOffset_31); // maxTexelGatherOffset
+  REDGPU_2_EXPECTWG(gpuInfo->minInterpolateAtOffset                      <= -0.5f); // minInterpolationOffset
+  REDGPU_2_EXPECTWG(gpuInfo->maxInterpolateAtOffset                      >= 0.4375f); // maxInterpolationOffset
+  REDGPU_2_EXPECTWG(gpuInfo->precisionBitsInterpolateAtOffset            >= 4); // subPixelInterpolationOffsetBits
+  REDGPU_2_EXPECTWG(gpuInfo->optimalCopyArrayImageRangeArrayBytesFirstBytesAlignment           <= REDGPU_2_EXPECTED_optimalCopyArrayImageRangeArrayBytesFirstBytesAlignment_128); // optimalBufferCopyOffsetAlignment
+  REDGPU_2_EXPECTWG(gpuInfo->optimalCopyArrayImageRangeArrayTexelsCountToNextRowBytesAlignment <= REDGPU_2_EXPECTED_optimalCopyArrayImageRangeArrayTexelsCountToNextRowBytesAlignment_128); // optimalBufferCopyRowPitchAlignment
+  REDGPU_2_EXPECTWG(gpuInfo->supportsWsi                                                       == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsMemoryGetBudget                                           >= 0); // Not supported on Redmi Note 8 on Android 11
+  REDGPU_2_EXPECTWG(gpuInfo->supportsFullArrayIndexUint32Value                                 == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsSamplerAnisotropy                                         == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsTextureDimensionsCubeLayered                              == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateRasterizationDepthClamp                     == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateRasterizationDepthBiasDynamic               == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateRasterizationDepthBiasClamp                 == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateMultisampleSampleShading                    == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateMultisampleAlphaToOne                       >= 0); // Not supported on RX 550 and RX 9070 XT on Windows
+  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateDepthTestBoundsTest                         >= 0); // Not supported on Intel HD Graphics 520 on Windows
+  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateDepthTestBoundsTestDynamic                  >= 0); // Not supported on Intel HD Graphics 520 on Windows
+  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateStencilTestFrontAndBackDynamicCompareMask   == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateStencilTestFrontAndBackDynamicWriteMask     == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateBlendLogicOp                                >= 0); // Not supported on Redmi Note 8 on Android 11
+  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateOutputColorsBlendVaryingPerColor            == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsProcedureStateOutputColorsBlendDualSource                 == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsMultisampleEmptyOutputVariableMultisampleCount            >= 0); // Not supported on Redmi Note 8 on Android 11
+  REDGPU_2_EXPECTWG(gpuInfo->supportsMultisampleStandardSampleLocations                        == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeWritesAndAtomicsInStageVertex                      == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeWritesAndAtomicsInStageFragment                    == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeImageGatherExtended                                == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeTextureRWExtendedFormats                           == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeTextureRWMultisample                               >= 0); // Not supported on Redmi Note 8 on Android 11
+  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeTextureRWReadWithoutFormat                         >= 0); // Intel UHD Graphics 730 on Windows 10
+  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeTextureRWWriteWithoutFormat                        == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeDynamicallyIndexableArraysOfArrayROCs              == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeDynamicallyIndexableArraysOfArrayRORWs             == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeDynamicallyIndexableArraysOfSamplers               == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeDynamicallyIndexableArraysOfTextureROs             == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeDynamicallyIndexableArraysOfTextureRWs             == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeClipDistance                                       == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeCullDistance                                       == 1);
+  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeInt64                                              >= 0); // Not supported on Redmi Note 8 on Android 11
+  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeFloat64                                            >= 0); // Not supported on Redmi Note 8 on Android 11
+  REDGPU_2_EXPECTWG(gpuInfo->supportsGpuCodeMinLod                                             >= 0); // Not supported on Redmi Note 8 on Android 11
+}
+
+static void vfInternalExpectMinimumImageFormatsLimitsAndFeaturesAdreno735(const RedGpuInfo * gpuInfo, const char * optionalFile, int optionalLine) {
+  RedHandleGpu gpu = gpuInfo->gpu;
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_UINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_SINT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_SINT].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_SINT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_SINT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_SINT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_SINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_8_SINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_SINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_UINT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_UINT].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_UINT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_UINT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_UINT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_UINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_UINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_SINT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_SINT].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_SINT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_SINT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_SINT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_SINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_SINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_FLOAT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_FLOAT].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_FLOAT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_FLOAT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_FLOAT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_FLOAT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_16_FLOAT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_UINT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_UINT].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_UINT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_UINT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_UINT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_UINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_UINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_SINT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_SINT].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_SINT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_SINT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_SINT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_SINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_SINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_16_16_16_16_FLOAT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_UINT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_UINT].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_UINT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_UINT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_UINT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_UINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_UINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_SINT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_SINT].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_SINT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_SINT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_SINT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_SINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_SINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_FLOAT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_FLOAT].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_FLOAT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_FLOAT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_FLOAT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_FLOAT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_R_32_FLOAT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_UINT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_UINT].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_UINT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_UINT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_UINT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_UINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_UINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_SINT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_SINT].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_SINT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_SINT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_SINT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_SINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_SINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxDimensions.maxHeight >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_RGBA_32_32_32_32_FLOAT].status >= RED_STATUS_SUCCESS);
+  if (gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].status == RED_STATUS_SUCCESS) {
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 16384);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 1);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 1);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxLevelsCount >= 15);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxLayersCount >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
+  }
+  if (gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].status == RED_STATUS_SUCCESS) {
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxWidth >= 16384);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxHeight >= 1);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxDepth >= 1);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].maxLevelsCount >= 15);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].maxLayersCount >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].maxBytesCount >= 2147483648);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT].status >= RED_STATUS_SUCCESS);
+  }
+  if (gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].status == RED_STATUS_SUCCESS) {
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxWidth >= 16384);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxHeight >= 1);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxDepth >= 1);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxLevelsCount >= 15);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxLayersCount >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxBytesCount >= 2147483648);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].status >= RED_STATUS_SUCCESS);
+  }
+  if (gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].status == RED_STATUS_SUCCESS) {
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxWidth >= 16384);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxHeight >= 1);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxDepth >= 1);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxLevelsCount >= 15);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxLayersCount >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxBytesCount >= 2147483648);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions1D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].status >= RED_STATUS_SUCCESS);
+  }
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT].maxDimensions.maxHeight >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_UINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_SINT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_SINT].maxDimensions.maxHeight >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_SINT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_SINT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_SINT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_SINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_R_8_SINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxHeight >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxHeight >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_SINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_SINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxWidth >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxHeight >= 16384);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxDepth >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxLevelsCount >= 15);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxLayersCount >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxBytesCount >= 2147483648);
   REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].status >= RED_STATUS_SUCCESS);
   REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 16384);
   REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions2D[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 16384);
@@ -1440,2512 +2729,6447 @@ static void vfInternalExpectMinimumImageFormatsLimitsAndFeaturesAdreno735(const
     REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
     REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
   }
-  if (gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].status == RED_STATUS_SUCCESS) {
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxWidth >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxHeight >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxDepth >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].maxLevelsCount >= 12);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].maxLayersCount >= 1);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].maxBytesCount >= 2147483648);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].status >= RED_STATUS_SUCCESS);
+  if (gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].status == RED_STATUS_SUCCESS) {
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxWidth >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxHeight >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxDepth >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].maxLevelsCount >= 12);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].maxLayersCount >= 1);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].maxBytesCount >= 2147483648);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT].status >= RED_STATUS_SUCCESS);
+  }
+  if (gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].status == RED_STATUS_SUCCESS) {
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxWidth >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxHeight >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxDepth >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxLevelsCount >= 12);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxLayersCount >= 1);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxBytesCount >= 2147483648);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].status >= RED_STATUS_SUCCESS);
+  }
+  if (gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].status == RED_STATUS_SUCCESS) {
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxWidth >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxHeight >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxDepth >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxLevelsCount >= 12);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxLayersCount >= 1);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxBytesCount >= 2147483648);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].status >= RED_STATUS_SUCCESS);
+  }
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_SINT].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_SINT].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_SINT].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_SINT].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_SINT].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_SINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_SINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_SINT].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_SINT].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_SINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_SINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_UINT].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_UINT].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_UINT].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_UINT].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_UINT].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_UINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_UINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_SINT].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_SINT].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_SINT].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_SINT].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_SINT].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_SINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_SINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_FLOAT].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_FLOAT].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_FLOAT].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_FLOAT].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_FLOAT].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_FLOAT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_FLOAT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_UINT].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_UINT].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_UINT].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_UINT].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_UINT].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_UINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_UINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_SINT].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_SINT].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_SINT].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_SINT].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_SINT].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_SINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_SINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_FLOAT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_UINT].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_UINT].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_UINT].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_UINT].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_UINT].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_UINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_UINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_SINT].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_SINT].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_SINT].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_SINT].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_SINT].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_SINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_SINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_FLOAT].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_FLOAT].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_FLOAT].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_FLOAT].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_FLOAT].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_FLOAT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_FLOAT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_UINT].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_UINT].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_UINT].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_UINT].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_UINT].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_UINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_UINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_SINT].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_SINT].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_SINT].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_SINT].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_SINT].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_SINT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_SINT].status >= RED_STATUS_SUCCESS);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxDimensions.maxWidth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxDimensions.maxHeight >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxDimensions.maxDepth >= 2048);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxLevelsCount >= 12);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxLayersCount >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxBytesCount >= 2147483648);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_FLOAT].status >= RED_STATUS_SUCCESS);
+  if (gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].status == RED_STATUS_SUCCESS) {
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxLevelsCount >= 12);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxLayersCount >= 1);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
+  }
+  if (gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].status == RED_STATUS_SUCCESS) {
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxWidth >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxHeight >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxDepth >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].maxLevelsCount >= 12);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].maxLayersCount >= 1);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].maxBytesCount >= 2147483648);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].status >= RED_STATUS_SUCCESS);
+  }
+  if (gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].status == RED_STATUS_SUCCESS) {
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxWidth >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxHeight >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxDepth >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxLevelsCount >= 12);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxLayersCount >= 1);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxBytesCount >= 2147483648);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].status >= RED_STATUS_SUCCESS);
+  }
+  if (gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].status == RED_STATUS_SUCCESS) {
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxWidth >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxHeight >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxDepth >= 2048);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxLevelsCount >= 12);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxLayersCount >= 1);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxBytesCount >= 2147483648);
+    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].status >= RED_STATUS_SUCCESS);
+  }
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsTextureROFilteringLinear >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsOutputColorBlend >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsTextureROFilteringLinear >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsOutputColorBlend >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsTextureROFilteringLinear >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsOutputColorBlend >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsTextureROFilteringLinear >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsOutputColorBlend >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsTextureROFilteringLinear >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsOutputColorBlend >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsTextureROFilteringLinear >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsOutputColorBlend >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsTextureROFilteringLinear >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsOutputColorBlend >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsTextureROFilteringLinear >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsOutputColorBlend >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsTextureROFilteringLinear >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsOutputColorBlend >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsTextureROFilteringLinear >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsOutputColorBlend >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsTextureROFilteringLinear >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsOutputColorBlend >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsTextureROFilteringLinear >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsOutputColorBlend >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsTextureROFilteringLinear >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsOutputColorBlend >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsTextureROFilteringLinear >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsOutputColorBlend >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsTextureROFilteringLinear >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsTextureRWAtomics >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsOutputColorBlend >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsTextureROFilteringLinear >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsTextureRWAtomics >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsOutputColorBlend >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsTextureROFilteringLinear >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsTextureRWAtomics >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsOutputColorBlend >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsTextureROFilteringLinear >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsOutputColorBlend >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsTextureROFilteringLinear >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsOutputColorBlend >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsOutputDepthStencil >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsOutputColor >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsTextureROFilteringLinear >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsTextureRWAtomics >= 0); // Not supported on Adreno 735
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsOutputColorBlend >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsOutputDepthStencil >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsOutputColor >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsTextureROFilteringLinear >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsOutputColorBlend >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsTextureRW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsOutputDepthStencil >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsOutputColor >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsTextureROFilteringLinear >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsOutputColorBlend >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsTextureRW >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsOutputDepthStencil >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsOutputColor >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsTextureROFilteringLinear >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsOutputColorBlend >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsCopyR >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsCopyW >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsTextureRO >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsTextureRW >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsOutputDepthStencil >= 1);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsOutputColor >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsTextureROFilteringLinear >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsTextureRWAtomics >= 0);
+  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsOutputColorBlend >= 0);
+}
+
+static gpu_handle_context_t vfInternalContextInit(int enable_debug_mode, unsigned gpu_index, const gpu_context_optional_parameters_t * optional_parameters, const gpu_context_ex2_parameters_t * optional_ex2_parameters, const gpu_context_ex3_parameters_t * optional_ex3_parameters, const gpu_context_ex4_parameters_t * optional_ex4_parameters, const char * optionalFile, int optionalLine) {
+  if (enable_debug_mode) {
+    vfInternalPrint("[vkFast][Debug] In case of an error, email me (Constantine) at: iamvfx@gmail.com" "\n");
+  }
+
+  const uint64_t initStartNanoseconds   = vfInternalGetTimeNanoseconds();
+  const uint64_t initStartResidentBytes = vfInternalGetProcessResidentBytesCount();
+
+  void * optional_pointer_to_custom_vf_handle_context = 0;
+
+  if (optional_parameters != NULL) {
+    optional_pointer_to_custom_vf_handle_context = optional_parameters->optional_pointer_to_custom_vf_handle_context;
+  }
+
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)optional_pointer_to_custom_vf_handle_context;
+  if (vkfast == NULL) {
+    // To free
+    vkfast = (vf_handle_context_t *)red32MemoryCalloc(sizeof(vf_handle_context_t));
+    REDGPU_2_EXPECT(vkfast != NULL);
+    vkfast->gpuIndex = gpu_index;
+  }
+
+  uint64_t internalMemoryAllocationSizeGpuVramArrays           = VKFAST_DEFAULT_MEMORY_ALLOCATION_SIZE_GPU_ONLY_512MB;
+  uint64_t internalMemoryAllocationSizeCpuVisible              = VKFAST_DEFAULT_MEMORY_ALLOCATION_SIZE_CPU_UPLOAD_512MB;
+  uint64_t internalMemoryAllocationSizeCpuReadback             = VKFAST_DEFAULT_MEMORY_ALLOCATION_SIZE_CPU_READBACK_512MB;
+  uint64_t internalMemoryAllocationSizeCpuVisiblePresentPixels = VKFAST_DEFAULT_MEMORY_ALLOCATION_SIZE_PRESENT_PIXELS_CPU_UPLOAD_288MB;
+  if (optional_parameters != NULL) {
+    if (optional_parameters->internal_memory_allocation_sizes != NULL) {
+      internalMemoryAllocationSizeGpuVramArrays           = optional_parameters->internal_memory_allocation_sizes->bytes_count_for_memory_storages_type_gpu_only;
+      internalMemoryAllocationSizeCpuVisible              = optional_parameters->internal_memory_allocation_sizes->bytes_count_for_memory_storages_type_cpu_upload;
+      internalMemoryAllocationSizeCpuReadback             = optional_parameters->internal_memory_allocation_sizes->bytes_count_for_memory_storages_type_cpu_readback;
+      internalMemoryAllocationSizeCpuVisiblePresentPixels = optional_parameters->internal_memory_allocation_sizes->bytes_count_for_memory_present_pixels_type_cpu_upload;
+    }
+  }
+  uint64_t heapsGrowBlockBytesCount    = 0;
+  uint64_t heapsGrowMaxTotalBytesCount = 0;
+  if (optional_ex4_parameters != NULL) {
+    heapsGrowBlockBytesCount    = optional_ex4_parameters->growableHeapsBlockBytesCount;
+    heapsGrowMaxTotalBytesCount = optional_ex4_parameters->growableHeapsMaxTotalBytesCount;
+  }
+  if (heapsGrowBlockBytesCount > 0 && (optional_parameters == NULL || optional_parameters->internal_memory_allocation_sizes == NULL)) {
+    // NOTE(Constantine): Growable heaps start with one block instead of the full default size.
+    internalMemoryAllocationSizeGpuVramArrays = heapsGrowBlockBytesCount;
+    internalMemoryAllocationSizeCpuVisible    = heapsGrowBlockBytesCount;
+    internalMemoryAllocationSizeCpuReadback   = heapsGrowBlockBytesCount;
+  }
+
+  RedContext context = vkfast->context;
+  if (context == NULL) {
+    RedContextOptionalSettingsContextFromVk            contextFromVk            = {0};
+    RedContextOptionalSettings0                        optionalSettings0        = {0};
+    RedContextOptionalSettingsCreateContextPerformance createContextPerformance = {0};
+    void * optionalSettings = NULL;
+    if (optional_ex2_parameters != NULL) {
+      contextFromVk.settings             = RED_CONTEXT_OPTIONAL_SETTINGS_CONTEXT_FROM_VK;
+      contextFromVk.next                 = NULL;
+      contextFromVk.instance             = optional_ex2_parameters->external_VkInstance;
+      contextFromVk.physicalDevicesCount = 1;
+      contextFromVk.physicalDevices      = (uint64_t *)&optional_ex2_parameters->external_VkPhysicalDevice;
+      contextFromVk.devices              = (uint64_t *)&optional_ex2_parameters->external_VkDevice;
+
+      optionalSettings0.settings                      = RED_CONTEXT_OPTIONAL_SETTINGS_0;
+      optionalSettings0.next                          = optional_ex2_parameters->external_VkInstance == 0 ? NULL : &contextFromVk;
+      optionalSettings0.skipCheckingContextLayers     = 0;
+      optionalSettings0.skipCheckingContextExtensions = 0;
+      optionalSettings0.gpusExposeOnlyOneQueue        = optional_ex2_parameters->exposeOnlyOneQueue;
+
+      createContextPerformance.settings         = RED_CONTEXT_OPTIONAL_SETTINGS_CREATE_CONTEXT_PERFORMANCE;
+      createContextPerformance.next             = &optionalSettings0;
+      createContextPerformance.exposeOnlyOneGpu = optional_ex2_parameters->exposeOnlyOneGpu;
+
+      optionalSettings = &createContextPerformance;
+    }
+
+    unsigned extensions[] = {
+      #if defined(_WIN32)
+      RED_SDK_EXTENSION_WSI_WIN32,
+      #endif
+      #if defined(__linux__) && !defined(__ANDROID__)
+      RED_SDK_EXTENSION_WSI_XLIB,
+      #endif
+      #if defined(VKFAST_DEFINE_ENABLE_FEATURE_GPU_DEBUG_PRINTF) || defined(VKFAST_DEFINE_ENABLE_FEATURE_COMPUTE_BASED_RAY_TRACING)
+      RED_SDK_EXTENSION_RAY_TRACING,
+      #endif
+      #if defined(VKFAST_DEFINE_ENABLE_FEATURE_REII_MESH_STATE_RASTERIZATION_MODE)
+      RED_SDK_EXTENSION_RASTERIZATION_MODE,
+      #endif
+    };
+
+    np(redCreateContext,
+      "malloc", red32MemoryCalloc,
+      "free", red32MemoryFree,
+      "optionalMallocTagged", NULL,
+      "optionalFreeTagged", NULL,
+      "debugCallback", enable_debug_mode == 1 ? vfRedGpuDebugCallback : NULL,
+      "sdkVersion", RED_SDK_VERSION_1_0_135,
+      "sdkExtensionsCount", sizeof(extensions) / sizeof(extensions[0]),
+      "sdkExtensions", extensions,
+      "optionalProgramName", NULL,
+      "optionalProgramVersion", 0,
+      "optionalEngineName", NULL,
+      "optionalEngineVersion", 0,
+      "optionalSettings", optionalSettings,
+      "outContext", &context,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+  }
+
+  REDGPU_2_EXPECT(context != NULL);
+  REDGPU_2_EXPECT(context->gpusCount > 0);
+  REDGPU_2_EXPECT(vkfast->gpuIndex < context->gpusCount);
+
+  const RedGpuInfo * gpuInfo = &context->gpus[vkfast->gpuIndex]; // NOTE(Constantine): Picking the first available GPU by default.
+
+  const uint64_t initContextEndNanoseconds = vfInternalGetTimeNanoseconds();
+
+  if (enable_debug_mode == 1) {
+    vfInternalPrint("[vkFast][Debug] Your GPU name: ");
+    vfInternalPrint(gpuInfo->gpuName);
+    vfInternalPrint("\n");
+    vfInternalPrint("[vkFast][Debug] For extra debug information, recompile redgpu.c as redgpu.cpp with REDGPU_COMPILE_SWITCH 3" "\n");
+  }
+
+  REDGPU_2_EXPECT(gpuInfo->queuesCount > 0);
+
+  if (enable_debug_mode == 1) {
+    if (gpuInfo->supportsMemoryGetBudget == 1) {
+      RedMemoryBudget memoryBudget = {0};
+      memoryBudget.setTo1000237000 = 1000237000;
+      memoryBudget.setTo0          = 0;
+      np(redMemoryGetBudget,
+        "context", context,
+        "gpu", gpuInfo->gpu,
+        "outMemoryBudget", &memoryBudget,
+        "outStatuses", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+
+      char numberString[4096] = {0};
+
+      vfInternalPrint("[vkFast][Debug] gpuInfo->memoryHeaps current process heap budget:" "\n");
+      for (unsigned i = 0; i < gpuInfo->memoryHeapsCount; i += 1) {
+        vfInternalPrint("[vkFast][Debug]   [");
+        red32Uint64ToChars(i, numberString);
+        vfInternalPrint(numberString);
+        vfInternalPrint("]: ");
+        red32Uint64ToChars(memoryBudget.memoryHeapsBudget[i], numberString);
+        vfInternalPrint(numberString);
+        vfInternalPrint("\n");
+      }
+
+      vfInternalPrint("[vkFast][Debug] gpuInfo->memoryHeaps current process estimated heap usage:" "\n");
+      for (unsigned i = 0; i < gpuInfo->memoryHeapsCount; i += 1) {
+        vfInternalPrint("[vkFast][Debug]   [");
+        red32Uint64ToChars(i, numberString);
+        vfInternalPrint(numberString);
+        vfInternalPrint("]: ");
+        red32Uint64ToChars(memoryBudget.memoryHeapsUsage[i], numberString);
+        vfInternalPrint(numberString);
+        vfInternalPrint("\n");
+      }
+    }
+  }
+
+  // NOTE(Constantine): The expectations sweep is over a thousand checks, a GPU and driver that passed it once are not checked again if the validation cache is set.
+  const char * validationCacheFilepath = optional_ex4_parameters == NULL ? NULL : optional_ex4_parameters->optionalValidationCacheFilepath;
+  const int    validationWasCached     = vfInternalValidationCacheRead(gpuInfo, validationCacheFilepath);
+  if (validationWasCached == 0) {
+    if (gpuInfo->gpuVendorId == 0x5143) {
+      vfInternalExpectMinimumGuaranteesAdreno735(gpuInfo, optionalFile, optionalLine);
+    } else {
+      np(red2ExpectMinimumGuaranteesIntelUHDGraphics730,
+        "gpuInfo", gpuInfo,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine
+      );
+    }
+
+    if (gpuInfo->gpuVendorId == 0x5143) {
+      vfInternalExpectMinimumImageFormatsLimitsAndFeaturesAdreno735(gpuInfo, optionalFile, optionalLine);
+    } else {
+      np(red2ExpectMinimumImageFormatsLimitsAndFeatures,
+        "gpuInfo", gpuInfo,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine
+      );
+    }
+
+    vfInternalValidationCacheAppend(gpuInfo, validationCacheFilepath);
+  } else if (enable_debug_mode == 1) {
+    vfInternalPrint("[vkFast][Debug] Skipped the minimum capability expectations, this GPU and driver passed them before according to: ");
+    vfInternalPrint(validationCacheFilepath);
+    vfInternalPrint("\n");
+  }
+
+  const uint64_t initValidationEndNanoseconds = vfInternalGetTimeNanoseconds();
+
+  RedHandleGpu   gpu       = gpuInfo->gpu;
+  RedHandleQueue mainQueue = gpuInfo->queues[vkfast->mainQueueIndex];
+
+  RedArray memoryGpuVramForArrays_array   = {0};
+  RedArray memoryCpuUpload_array          = {0};
+  RedArray memoryCpuReadback_array        = {0};
+  unsigned specificMemoryTypesGpuVram     = -1;
+  unsigned specificMemoryTypesCpuUpload   = -1;
+  unsigned specificMemoryTypesCpuReadback = -1;
+  RedHandleMemory memoryGpuVramForArrays_memory = NULL;
+  RedHandleMemory memoryCpuUpload_memory        = NULL;
+  RedHandleMemory memoryCpuReadback_memory      = NULL;
+  void * memoryCpuUpload_mapped_void_ptr        = NULL;
+  void * memoryCpuReadback_mapped_void_ptr      = NULL;
+  {
+    if (internalMemoryAllocationSizeGpuVramArrays > 0) {
+      uint64_t bytesCount = internalMemoryAllocationSizeGpuVramArrays;
+      const char * handleName = "vkFast_vfInternalContextInit_memoryGpuVramForArrays_array";
+      uint64_t maxAllowedOverallocationBytesCount = 64; // NOTE(Constantine)(Aug 15, 2026): Vulkan SDK Frame Capture feature needs 64 bytes of overallocation here.
+      RedArray array = {0};
+
+      np(redCreateArray,
+        "context", context,
+        "gpu", gpu,
+        "handleName", handleName,
+        "type", RED_ARRAY_TYPE_ARRAY_RW,
+        "bytesCount", bytesCount,
+        "structuredBufferElementBytesCount", 0,
+        "restrictToAccess", RED_ARRAY_TYPE_ARRAY_RW,
+        "initialQueueFamilyIndex", gpuInfo->queuesCount > 1 ? -1 : (unsigned)gpuInfo->queuesFamilyIndex[vkfast->mainQueueFamilyIndex],
+        "dedicate", 0,
+        "outArray", &array,
+        "outStatuses", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      REDGPU_2_EXPECTWG(array.handle != NULL);
+      size_t bytesToNextAlignmentBoundary = REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(array.memoryBytesCount, array.memoryBytesAlignment);
+      REDGPU_2_EXPECTWG(bytesToNextAlignmentBoundary == 0);
+      REDGPU_2_EXPECTWG((array.memoryBytesCount - bytesCount) <= maxAllowedOverallocationBytesCount);
+
+      memoryGpuVramForArrays_array = array;
+    }
+    if (internalMemoryAllocationSizeCpuVisible > 0) {
+      uint64_t bytesCount = internalMemoryAllocationSizeCpuVisible;
+      const char * handleName = "vkFast_vfInternalContextInit_memoryCpuUpload_array";
+      uint64_t maxAllowedOverallocationBytesCount = 0;
+      RedArray array = {0};
+
+      np(redCreateArray,
+        "context", context,
+        "gpu", gpu,
+        "handleName", handleName,
+        "type", RED_ARRAY_TYPE_ARRAY_RO,
+        "bytesCount", bytesCount,
+        "structuredBufferElementBytesCount", 0,
+        "restrictToAccess", RED_ACCESS_BITFLAG_COPY_R,
+        "initialQueueFamilyIndex", gpuInfo->queuesCount > 1 ? -1 : (unsigned)gpuInfo->queuesFamilyIndex[vkfast->mainQueueFamilyIndex],
+        "dedicate", 0,
+        "outArray", &array,
+        "outStatuses", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      REDGPU_2_EXPECTWG(array.handle != NULL);
+      size_t bytesToNextAlignmentBoundary = REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(array.memoryBytesCount, array.memoryBytesAlignment);
+      REDGPU_2_EXPECTWG(bytesToNextAlignmentBoundary == 0);
+      REDGPU_2_EXPECTWG((array.memoryBytesCount - bytesCount) <= maxAllowedOverallocationBytesCount);
+
+      memoryCpuUpload_array = array;
+    }
+    if (internalMemoryAllocationSizeCpuReadback > 0) {
+      uint64_t bytesCount = internalMemoryAllocationSizeCpuReadback;
+      const char * handleName = "vkFast_vfInternalContextInit_memoryCpuReadback_array";
+      uint64_t maxAllowedOverallocationBytesCount = 0;
+      RedArray array = {0};
+
+      np(redCreateArray,
+        "context", context,
+        "gpu", gpu,
+        "handleName", handleName,
+        "type", RED_ARRAY_TYPE_ARRAY_RW,
+        "bytesCount", bytesCount,
+        "structuredBufferElementBytesCount", 0,
+        "restrictToAccess", RED_ACCESS_BITFLAG_COPY_W,
+        "initialQueueFamilyIndex", gpuInfo->queuesCount > 1 ? -1 : (unsigned)gpuInfo->queuesFamilyIndex[vkfast->mainQueueFamilyIndex],
+        "dedicate", 0,
+        "outArray", &array,
+        "outStatuses", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      REDGPU_2_EXPECTWG(array.handle != NULL);
+      size_t bytesToNextAlignmentBoundary = REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(array.memoryBytesCount, array.memoryBytesAlignment);
+      REDGPU_2_EXPECTWG(bytesToNextAlignmentBoundary == 0);
+      REDGPU_2_EXPECTWG((array.memoryBytesCount - bytesCount) <= maxAllowedOverallocationBytesCount);
+
+      memoryCpuReadback_array = array;
+    }
+
+    int userSpecificMemoryTypeGpuVram     = 0;
+    int userSpecificMemoryTypeCpuUpload   = 0;
+    int userSpecificMemoryTypeCpuReadback = 0;
+    if (optional_ex3_parameters != NULL) {
+      if (optional_ex3_parameters->optionalSpecificMemoryTypeGpuVram     != NULL) { userSpecificMemoryTypeGpuVram     = 1; }
+      if (optional_ex3_parameters->optionalSpecificMemoryTypeCpuUpload   != NULL) { userSpecificMemoryTypeCpuUpload   = 1; }
+      if (optional_ex3_parameters->optionalSpecificMemoryTypeCpuReadback != NULL) { userSpecificMemoryTypeCpuReadback = 1; }
+    }
+    if (userSpecificMemoryTypeGpuVram == 1) {
+      specificMemoryTypesGpuVram = optional_ex3_parameters->optionalSpecificMemoryTypeGpuVram[0];
+    } else {
+      specificMemoryTypesGpuVram = vfPickSpecificMemoryTypeGpuVram(gpuInfo, &memoryGpuVramForArrays_array);
+    }
+    if (userSpecificMemoryTypeCpuUpload == 1) {
+      specificMemoryTypesCpuUpload = optional_ex3_parameters->optionalSpecificMemoryTypeCpuUpload[0];
+    } else {
+      specificMemoryTypesCpuUpload = vfPickSpecificMemoryTypeCpuUpload(gpuInfo, &memoryCpuUpload_array);
+    }
+    if (userSpecificMemoryTypeCpuReadback == 1) {
+      specificMemoryTypesCpuReadback = optional_ex3_parameters->optionalSpecificMemoryTypeCpuReadback[0];
+    } else {
+      specificMemoryTypesCpuReadback = vfPickSpecificMemoryTypeCpuReadback(gpuInfo, &memoryCpuReadback_array);
+    }
+    if (optional_ex4_parameters != NULL && optional_ex4_parameters->probeMemoryTypesBandwidth == 1 && (userSpecificMemoryTypeCpuUpload == 0 || userSpecificMemoryTypeCpuReadback == 0)) {
+      vf_internal_memory_probe_result_t probe = {0};
+      if (vfInternalMemoryProbeCacheRead(gpuInfo, &memoryCpuUpload_array, &memoryCpuReadback_array, optional_ex4_parameters->optionalProbeCacheFilepath, &probe) == 0) {
+        vfInternalMemoryProbeBandwidth(context, gpuInfo, &memoryCpuUpload_array, &memoryCpuReadback_array, enable_debug_mode, &probe, optionalFile, optionalLine);
+        vfInternalMemoryProbeCacheWrite(gpuInfo, optional_ex4_parameters->optionalProbeCacheFilepath, &probe);
+      }
+      if (userSpecificMemoryTypeCpuUpload == 0 && probe.memoryTypeCpuUpload != -1 && internalMemoryAllocationSizeCpuVisible > 0) {
+        specificMemoryTypesCpuUpload = probe.memoryTypeCpuUpload;
+      }
+      if (userSpecificMemoryTypeCpuReadback == 0 && probe.memoryTypeCpuReadback != -1 && internalMemoryAllocationSizeCpuReadback > 0) {
+        specificMemoryTypesCpuReadback = probe.memoryTypeCpuReadback;
+      }
+    }
+    if (internalMemoryAllocationSizeGpuVramArrays > 0) { REDGPU_2_EXPECTWG(specificMemoryTypesGpuVram     != -1); }
+    if (internalMemoryAllocationSizeCpuVisible    > 0) { REDGPU_2_EXPECTWG(specificMemoryTypesCpuUpload   != -1); }
+    if (internalMemoryAllocationSizeCpuReadback   > 0) { REDGPU_2_EXPECTWG(specificMemoryTypesCpuReadback != -1); }
+
+    if (enable_debug_mode == 1) {
+      vfInternalPrintMemoryType(gpuInfo, "GPU_STORAGE_TYPE_GPU_ONLY",     specificMemoryTypesGpuVram);
+      vfInternalPrintMemoryType(gpuInfo, "GPU_STORAGE_TYPE_CPU_UPLOAD",   specificMemoryTypesCpuUpload);
+      vfInternalPrintMemoryType(gpuInfo, "GPU_STORAGE_TYPE_CPU_READBACK", specificMemoryTypesCpuReadback);
+    }
+
+    if (internalMemoryAllocationSizeGpuVramArrays > 0) {
+      np(redMemoryAllocate,
+        "context", context,
+        "gpu", gpu,
+        "handleName", "vkFast_vfInternalContextInit_memoryGpuVramForArrays_memory",
+        "bytesCount", internalMemoryAllocationSizeGpuVramArrays,
+        "memoryTypeIndex", specificMemoryTypesGpuVram,
+        "dedicateToArray", NULL,
+        "dedicateToImage", NULL,
+        "memoryBitflags", 0,
+        "outMemory", &memoryGpuVramForArrays_memory,
+        "outStatuses", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      REDGPU_2_EXPECTWG(memoryGpuVramForArrays_memory != NULL);
+
+      RedMemoryArray memoryArray = {0};
+      memoryArray.setTo1000157000  = 1000157000;
+      memoryArray.setTo0           = 0;
+      memoryArray.array            = memoryGpuVramForArrays_array.handle;
+      memoryArray.memory           = memoryGpuVramForArrays_memory;
+      memoryArray.memoryBytesFirst = 0;
+      RedStatuses opstatuses = {0};
+      np(redMemorySet,
+        "context", context,
+        "gpu", gpu,
+        "memoryArraysCount", 1,
+        "memoryArrays", &memoryArray,
+        "memoryImagesCount", 0,
+        "memoryImages", NULL,
+        "outStatuses", &opstatuses,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      REDGPU_2_EXPECTWG(opstatuses.statusError == RED_STATUS_SUCCESS);
+    }
+    if (internalMemoryAllocationSizeCpuVisible > 0) {
+      np(redMemoryAllocate,
+        "context", context,
+        "gpu", gpu,
+        "handleName", "vkFast_vfInternalContextInit_memoryCpuUpload_memory",
+        "bytesCount", internalMemoryAllocationSizeCpuVisible,
+        "memoryTypeIndex", specificMemoryTypesCpuUpload,
+        "dedicateToArray", NULL,
+        "dedicateToImage", NULL,
+        "memoryBitflags", 0,
+        "outMemory", &memoryCpuUpload_memory,
+        "outStatuses", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      REDGPU_2_EXPECTWG(memoryCpuUpload_memory != NULL);
+
+      RedMemoryArray memoryArray = {0};
+      memoryArray.setTo1000157000  = 1000157000;
+      memoryArray.setTo0           = 0;
+      memoryArray.array            = memoryCpuUpload_array.handle;
+      memoryArray.memory           = memoryCpuUpload_memory;
+      memoryArray.memoryBytesFirst = 0;
+      RedStatuses opstatuses = {0};
+      np(redMemorySet,
+        "context", context,
+        "gpu", gpu,
+        "memoryArraysCount", 1,
+        "memoryArrays", &memoryArray,
+        "memoryImagesCount", 0,
+        "memoryImages", NULL,
+        "outStatuses", &opstatuses,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      REDGPU_2_EXPECTWG(opstatuses.statusError == RED_STATUS_SUCCESS);
+
+      np(redMemoryMap,
+        "context", context,
+        "gpu", gpu,
+        "mappableMemory", memoryCpuUpload_memory,
+        "mappableMemoryBytesFirst", 0,
+        "mappableMemoryBytesCount", memoryCpuUpload_array.memoryBytesCount,
+        "outVolatilePointer", &memoryCpuUpload_mapped_void_ptr,
+        "outStatuses", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      REDGPU_2_EXPECTWG(memoryCpuUpload_mapped_void_ptr != NULL);
+      REDGPU_2_EXPECTWG(!"Start address is not aligned" || (0 == REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY((uint64_t)memoryCpuUpload_mapped_void_ptr, gpuInfo->minMemoryAllocateBytesAlignment)));
+    }
+    if (internalMemoryAllocationSizeCpuReadback > 0) {
+      np(redMemoryAllocate,
+        "context", context,
+        "gpu", gpu,
+        "handleName", "vkFast_vfInternalContextInit_memoryCpuReadback_memory",
+        "bytesCount", internalMemoryAllocationSizeCpuReadback,
+        "memoryTypeIndex", specificMemoryTypesCpuReadback,
+        "dedicateToArray", NULL,
+        "dedicateToImage", NULL,
+        "memoryBitflags", 0,
+        "outMemory", &memoryCpuReadback_memory,
+        "outStatuses", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      REDGPU_2_EXPECTWG(memoryCpuReadback_memory != NULL);
+
+      RedMemoryArray memoryArray = {0};
+      memoryArray.setTo1000157000  = 1000157000;
+      memoryArray.setTo0           = 0;
+      memoryArray.array            = memoryCpuReadback_array.handle;
+      memoryArray.memory           = memoryCpuReadback_memory;
+      memoryArray.memoryBytesFirst = 0;
+      RedStatuses opstatuses = {0};
+      np(redMemorySet,
+        "context", context,
+        "gpu", gpu,
+        "memoryArraysCount", 1,
+        "memoryArrays", &memoryArray,
+        "memoryImagesCount", 0,
+        "memoryImages", NULL,
+        "outStatuses", &opstatuses,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      REDGPU_2_EXPECTWG(opstatuses.statusError == RED_STATUS_SUCCESS);
+
+      np(redMemoryMap,
+        "context", context,
+        "gpu", gpu,
+        "mappableMemory", memoryCpuReadback_memory,
+        "mappableMemoryBytesFirst", 0,
+        "mappableMemoryBytesCount", memoryCpuReadback_array.memoryBytesCount,
+        "outVolatilePointer", &memoryCpuReadback_mapped_void_ptr,
+        "outStatuses", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      REDGPU_2_EXPECTWG(memoryCpuReadback_mapped_void_ptr != NULL);
+      REDGPU_2_EXPECTWG(!"Start address is not aligned" || (0 == REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY((uint64_t)memoryCpuReadback_mapped_void_ptr, gpuInfo->minMemoryAllocateBytesAlignment)));
+    }
+  }
+
+  const uint64_t initHeapsEndNanoseconds = vfInternalGetTimeNanoseconds();
+
+  RedCalls presentCopyCalls = {0};
+  np(redCreateCalls,
+    "context", context,
+    "gpu", gpu,
+    "handleName", "vkFast_vfInternalContextInit_presentCopyCalls",
+    "queueFamilyIndex", gpuInfo->queuesFamilyIndex[vkfast->presentQueueIndex],
+    "outCalls", &presentCopyCalls,
+    "outStatuses", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+  REDGPU_2_EXPECTWG(presentCopyCalls.handle != NULL);
+
+  REDGPU_2_EXPECTWG(gpuInfo->minArrayRORWStructMemberRangeBytesAlignment <= 64);
+
+  // Filling
+  vf_handle_context_t;
+  vkfast->doNotDestroyRawContext;
+  vkfast->doNotFreeHandle;
+  vkfast->isDebugMode = enable_debug_mode;
+  vkfast->context = context;
+  vkfast->gpuInfo = gpuInfo;
+  vkfast->gpuIndex;
+  vkfast->gpu = gpu; // NOTE(Constantine): If vkfast->gpuIndex is changed on the user side, vkfast->gpu must be changed by the user too.
+  vkfast->mainQueueIndex;
+  vkfast->mainQueueFamilyIndex;
+  vkfast->mainQueue = mainQueue; // NOTE(Constantine): If vkfast->mainQueueIndex is changed on the user side, vkfast->mainQueue must be changed by the user too.
+  vkfast->specificMemoryTypesGpuVram = specificMemoryTypesGpuVram;
+  vkfast->specificMemoryTypesCpuUpload = specificMemoryTypesCpuUpload;
+  vkfast->specificMemoryTypesCpuReadback = specificMemoryTypesCpuReadback;
+  vkfast->specificMemoryTypesCpuUploadIsCoherent = specificMemoryTypesCpuUpload == -1 ? 1 : gpuInfo->memoryTypes[specificMemoryTypesCpuUpload].isCpuCoherent;
+  vkfast->specificMemoryTypesCpuReadbackIsCoherent = specificMemoryTypesCpuReadback == -1 ? 1 : gpuInfo->memoryTypes[specificMemoryTypesCpuReadback].isCpuCoherent;
+  vkfast->memoryAllocationSizeGpuVram = internalMemoryAllocationSizeGpuVramArrays;
+  vkfast->memoryAllocationSizeCpuUpload = internalMemoryAllocationSizeCpuVisible;
+  vkfast->memoryAllocationSizeCpuReadback = internalMemoryAllocationSizeCpuReadback;
+  vkfast->memoryAllocationSizeCpuUploadPresentPixels = internalMemoryAllocationSizeCpuVisiblePresentPixels;
+  vkfast->memoryGpuVramForArrays_array = memoryGpuVramForArrays_array;
+  vkfast->memoryGpuVramForArrays_memory = memoryGpuVramForArrays_memory;
+  vkfast->memoryGpuVramForArrays_memory_suballocations_offset = 0;
+  vkfast->memoryCpuUpload_array = memoryCpuUpload_array;
+  vkfast->memoryCpuUpload_memory = memoryCpuUpload_memory;
+  vkfast->memoryCpuUpload_mapped_void_ptr_original = memoryCpuUpload_mapped_void_ptr;
+  vkfast->memoryCpuUpload_memory_suballocations_offset = 0;
+  vkfast->memoryCpuReadback_array = memoryCpuReadback_array;
+  vkfast->memoryCpuReadback_memory = memoryCpuReadback_memory;
+  vkfast->memoryCpuReadback_mapped_void_ptr_original = memoryCpuReadback_mapped_void_ptr;
+  vkfast->memoryCpuReadback_memory_suballocations_offset = 0;
+  vkfast->heapsGrowBlockBytesCount = heapsGrowBlockBytesCount;
+  vkfast->heapsGrowMaxTotalBytesCount = heapsGrowMaxTotalBytesCount;
+  vkfast->heapsGrowing = 0;
+  vkfast->heapsBumpersCount = 0;
+  vkfast->heapsGrowMutex = vfInternalMutexCreate();
+  REDGPU_2_EXPECTWG(vkfast->heapsGrowMutex != NULL);
+  vkfast->heapsBlocks[GPU_STORAGE_TYPE_NONE] = REDGPU_32_STRUCT(vf_heap_blocks_t, 0);
+  vkfast->heapsBlocks[GPU_STORAGE_TYPE_GPU_ONLY] = REDGPU_32_STRUCT(vf_heap_blocks_t, memoryGpuVramForArrays_array.memoryBytesCount);
+  vkfast->heapsBlocks[GPU_STORAGE_TYPE_CPU_UPLOAD] = REDGPU_32_STRUCT(vf_heap_blocks_t, memoryCpuUpload_array.memoryBytesCount);
+  vkfast->heapsBlocks[GPU_STORAGE_TYPE_CPU_READBACK] = REDGPU_32_STRUCT(vf_heap_blocks_t, memoryCpuReadback_array.memoryBytesCount);
+  vkfast->windowHandle = NULL;
+  vkfast->windowHandleDoDestroy = 0;
+  vkfast->screenWidth = 0;
+  vkfast->screenHeight = 0;
+  vkfast->presentQueueIndex;
+  vkfast->surface = NULL;
+  vkfast->present = NULL;
+  vkfast->presentImages[0] = NULL;
+  vkfast->presentImages[1] = NULL;
+  vkfast->presentImages[2] = NULL;
+  vkfast->presentCpuSignal = NULL;
+  vkfast->presentGpuSignalAcquire = NULL;
+  vkfast->presentGpuSignalSubmit = NULL;
+  vkfast->presentCopyCalls = presentCopyCalls;
+  vkfast->presentPixelsCpuUpload_memory_allocation_size = internalMemoryAllocationSizeCpuVisiblePresentPixels;
+  vkfast->presentPixelsCpuUpload_memory_and_array = REDGPU_32_STRUCT(Red2Array, 0);
+  vkfast->presentPixelsCpuUpload_void_ptr_original = NULL;
+  vkfast->presentVsyncMode = RED_PRESENT_VSYNC_MODE_ON;
+  vkfast->presentImagesCount = 3;
+  vkfast->presentRetired = NULL;
+  vkfast->presentRetiredGpuSignalAcquire = NULL;
+  vkfast->presentRetiredPixelsCpuUpload_memory_and_array = REDGPU_32_STRUCT(Red2Array, 0);
+  vkfast->presentRetiredDrawsCount = 0;
+  vkfast->windowsCount = 0;
+  vkfast->windows = NULL;
+  vkfast->pacingFrameNanoseconds = 0;
+  vkfast->pacingMarginNanoseconds = 1000000;
+  vkfast->pacingDeadlineNanoseconds = 0;
+  vkfast->pacingWorkNanosecondsEstimate = 0;
+  vkfast->pacingTimer = NULL;
+  vkfast->framesCount = 0;
+  for (unsigned i = 0; i < VF_FRAMES_TIMESTAMPS_COUNT; i += 1) {
+    vf_frame_timestamps_t zero = {0};
+    vkfast->framesTimestamps[i] = zero;
+  }
+  vkfast->presentConvertProgram = 0;
+  vkfast->presentConvertProgramPipeline = 0;
+  vkfast->presentConvertStructsMemory = NULL;
+  vkfast->presentConvertStruct = REDGPU_32_STRUCT(Red2Struct, 0);
+  vkfast->presentConvertPixelsCpuUploadBytesCount = 0;
+  vkfast->presentConvertPixelsCpuUpload_memory_and_array = REDGPU_32_STRUCT(Red2Array, 0);
+  vkfast->presentConvertPixelsCpuUpload_void_ptr_original = NULL;
+  vkfast->presentConvertPixelsGpuBytesCount = 0;
+  vkfast->presentConvertPixelsGpu_memory_and_array = REDGPU_32_STRUCT(Red2Array, 0);
+  vkfast->presentUpscaleProgram = 0;
+  vkfast->presentUpscaleProgramPipeline = 0;
+  vkfast->presentUpscaleStruct = REDGPU_32_STRUCT(Red2Struct, 0);
+  vkfast->initContextNanoseconds = initContextEndNanoseconds - initStartNanoseconds;
+  vkfast->initValidationNanoseconds = initValidationEndNanoseconds - initContextEndNanoseconds;
+  vkfast->initHeapsNanoseconds = initHeapsEndNanoseconds - initValidationEndNanoseconds;
+  vkfast->initTotalNanoseconds = 0; // NOTE(Constantine): Set at the end of init.
+  vkfast->initValidationWasCached = validationWasCached;
+  vkfast->storagesLock = 0;
+  vkfast->storagesCount = 0;
+  vkfast->storagesFirst = NULL;
+  vkfast->storagesLast = NULL;
+  vkfast->cpuSignalsPoolLock = 0;
+  vkfast->cpuSignalsPoolCount = 0;
+  vkfast->cpuSignalsPoolCapacity = 0;
+  vkfast->cpuSignalsPool = NULL;
+  vkfast->programPipelinesCacheLock = 0;
+  vkfast->programPipelinesCacheCount = 0;
+  vkfast->programPipelinesCacheCapacity = 0;
+  vkfast->programPipelinesCache = NULL;
+  vkfast->programPipelinesCacheIndex.capacity = 0;
+  vkfast->programPipelinesCacheIndex.slots = NULL;
+  vkfast->tuningCacheFilepath = NULL;
+  vkfast->tuningLock = 0;
+  vkfast->tuningEntriesCount = 0;
+  vkfast->tuningEntriesCapacity = 0;
+  vkfast->tuningEntries = NULL;
+  vkfast->captureFile = NULL;
+  vkfast->captureMutex = vfInternalMutexCreate();
+  REDGPU_2_EXPECTWG(vkfast->captureMutex != NULL);
+  vkfast->captureCpuUploadStoragesCount = 0;
+  vkfast->captureCpuUploadStoragesCapacity = 0;
+  vkfast->captureCpuUploadStorages = NULL;
+  vkfast->bindingsSetsLock = 0;
+  vkfast->bindingsSetsUseClock = 0;
+  vkfast->bindingsSetsCount = 0;
+  vkfast->bindingsSetsCapacity = 0;
+  vkfast->bindingsSets = NULL;
+  vkfast->bindingsSetsIndex.capacity = 0;
+  vkfast->bindingsSetsIndex.slots = NULL;
+  vkfast->bindingsSetsHitsCount = 0;
+  vkfast->bindingsSetsMissesCount = 0;
+  vkfast->bindingsSetsPoolResetsCount = 0;
+  vkfast->bindingsSetsPoolsCount = 0;
+  vkfast->bindingsSetsPoolsCapacity = 0;
+  vkfast->bindingsSetsPools = NULL;
+
+  if (optional_ex4_parameters != NULL && optional_ex4_parameters->optionalTuningCacheFilepath != NULL) {
+    const uint64_t filepathBytesCount = strlen(optional_ex4_parameters->optionalTuningCacheFilepath) + 1;
+    // To free
+    vkfast->tuningCacheFilepath = (char *)red32MemoryCalloc(filepathBytesCount);
+    REDGPU_2_EXPECTWG(vkfast->tuningCacheFilepath != NULL);
+    red32MemoryCopy(vkfast->tuningCacheFilepath, optional_ex4_parameters->optionalTuningCacheFilepath, filepathBytesCount);
+    vfInternalTuningCacheLoad(vkfast, vkfast->tuningCacheFilepath);
+  }
+
+  vkfast->initTotalNanoseconds = vfInternalGetTimeNanoseconds() - initStartNanoseconds;
+
+  if (enable_debug_mode == 1) {
+    const uint64_t initEndResidentBytes = vfInternalGetProcessResidentBytesCount();
+    char numberString[4096] = {0};
+    vfInternalPrint("[vkFast][Debug] Context init took ");
+    red32Uint64ToChars(vkfast->initTotalNanoseconds / 1000, numberString);
+    vfInternalPrint(numberString);
+    vfInternalPrint(" us, process resident memory before: ");
+    red32Uint64ToChars(initStartResidentBytes, numberString);
+    vfInternalPrint(numberString);
+    vfInternalPrint(" bytes, after: ");
+    red32Uint64ToChars(initEndResidentBytes, numberString);
+    vfInternalPrint(numberString);
+    vfInternalPrint(" bytes" "\n");
+    vfInternalPrint("[vkFast][Debug] Context init timeline: context ");
+    red32Uint64ToChars(vkfast->initContextNanoseconds / 1000, numberString);
+    vfInternalPrint(numberString);
+    vfInternalPrint(" us, validation ");
+    red32Uint64ToChars(vkfast->initValidationNanoseconds / 1000, numberString);
+    vfInternalPrint(numberString);
+    vfInternalPrint(vkfast->initValidationWasCached == 1 ? " us (cached), heaps " : " us, heaps ");
+    red32Uint64ToChars(vkfast->initHeapsNanoseconds / 1000, numberString);
+    vfInternalPrint(numberString);
+    vfInternalPrint(" us, other ");
+    red32Uint64ToChars((vkfast->initTotalNanoseconds - vkfast->initContextNanoseconds - vkfast->initValidationNanoseconds - vkfast->initHeapsNanoseconds) / 1000, numberString);
+    vfInternalPrint(numberString);
+    vfInternalPrint(" us" "\n");
+  }
+
+  return (gpu_handle_context_t)(void *)vkfast;
+}
+
+GPU_API_PRE gpu_handle_context_t GPU_API_POST vfContextInit(int enable_debug_mode, const gpu_context_optional_parameters_t * optional_parameters, const char * optionalFile, int optionalLine) {
+  return vfInternalContextInit(enable_debug_mode, 0, optional_parameters, NULL, NULL, NULL, optionalFile, optionalLine);
+}
+
+GPU_API_PRE gpu_handle_context_t GPU_API_POST vfContextInitEx(int enable_debug_mode, unsigned gpu_index, const gpu_context_optional_parameters_t * optional_parameters, const char * optionalFile, int optionalLine) {
+  return vfInternalContextInit(enable_debug_mode, gpu_index, optional_parameters, NULL, NULL, NULL, optionalFile, optionalLine);
+}
+
+GPU_API_PRE gpu_handle_context_t GPU_API_POST vfContextInitEx2(int enable_debug_mode, unsigned gpu_index, const gpu_context_optional_parameters_t * optional_parameters, const gpu_context_ex2_parameters_t * optional_ex2_parameters, const char * optionalFile, int optionalLine) {
+  return vfInternalContextInit(enable_debug_mode, 0, optional_parameters, optional_ex2_parameters, NULL, NULL, optionalFile, optionalLine);
+}
+
+GPU_API_PRE gpu_handle_context_t GPU_API_POST vfContextInitEx3(int enable_debug_mode, unsigned gpu_index, const gpu_context_optional_parameters_t * optional_parameters, const gpu_context_ex2_parameters_t * optional_ex2_parameters, const gpu_context_ex3_parameters_t * optional_ex3_parameters, const char * optionalFile, int optionalLine) {
+  return vfInternalContextInit(enable_debug_mode, 0, optional_parameters, optional_ex2_parameters, optional_ex3_parameters, NULL, optionalFile, optionalLine);
+}
+
+GPU_API_PRE gpu_handle_context_t GPU_API_POST vfContextInitEx4(int enable_debug_mode, unsigned gpu_index, const gpu_context_optional_parameters_t * optional_parameters, const gpu_context_ex2_parameters_t * optional_ex2_parameters, const gpu_context_ex3_parameters_t * optional_ex3_parameters, const gpu_context_ex4_parameters_t * optional_ex4_parameters, const char * optionalFile, int optionalLine) {
+  return vfInternalContextInit(enable_debug_mode, gpu_index, optional_parameters, optional_ex2_parameters, optional_ex3_parameters, optional_ex4_parameters, optionalFile, optionalLine);
+}
+
+GPU_API_PRE void GPU_API_POST vfContextGetMemoryTypes(gpu_handle_context_t context, gpu_context_memory_types_t * out_memory_types, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  REDGPU_2_EXPECT(vkfast != NULL);
+
+  gpu_context_memory_types_t types = {0};
+  types.memoryTypeGpuVram               = vkfast->specificMemoryTypesGpuVram;
+  types.memoryTypeCpuUpload             = vkfast->specificMemoryTypesCpuUpload;
+  types.memoryTypeCpuReadback           = vkfast->specificMemoryTypesCpuReadback;
+  types.memoryTypeCpuUploadIsCoherent   = vkfast->specificMemoryTypesCpuUploadIsCoherent;
+  types.memoryTypeCpuUploadIsCached     = vkfast->specificMemoryTypesCpuUpload   == -1 ? 0 : vkfast->gpuInfo->memoryTypes[vkfast->specificMemoryTypesCpuUpload].isCpuCached;
+  types.memoryTypeCpuReadbackIsCoherent = vkfast->specificMemoryTypesCpuReadbackIsCoherent;
+  types.memoryTypeCpuReadbackIsCached   = vkfast->specificMemoryTypesCpuReadback == -1 ? 0 : vkfast->gpuInfo->memoryTypes[vkfast->specificMemoryTypesCpuReadback].isCpuCached;
+  out_memory_types[0] = types;
+}
+
+GPU_API_PRE void GPU_API_POST vfContextGetInitTimeline(gpu_handle_context_t context, gpu_context_init_timeline_t * out_init_timeline, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  REDGPU_2_EXPECT(vkfast != NULL);
+
+  gpu_context_init_timeline_t timeline = {0};
+  timeline.context_nanoseconds    = vkfast->initContextNanoseconds;
+  timeline.validation_nanoseconds = vkfast->initValidationNanoseconds;
+  timeline.heaps_nanoseconds      = vkfast->initHeapsNanoseconds;
+  timeline.other_nanoseconds      = vkfast->initTotalNanoseconds - vkfast->initContextNanoseconds - vkfast->initValidationNanoseconds - vkfast->initHeapsNanoseconds;
+  timeline.total_nanoseconds      = vkfast->initTotalNanoseconds;
+  timeline.validation_was_cached  = vkfast->initValidationWasCached;
+  out_init_timeline[0] = timeline;
+}
+
+GPU_API_PRE void GPU_API_POST vfContextCaptureBegin(gpu_handle_context_t context, const char * capture_filepath, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  REDGPU_2_EXPECT(vkfast != NULL);
+  REDGPU_2_EXPECT(vkfast->captureFile == NULL);
+
+  FILE * fh = fopen(capture_filepath, "wb");
+  REDGPU_2_EXPECT(fh != NULL || !"[vkFast] Can't open the capture file for writing.");
+
+  gpu_capture_file_header_t header = {0};
+  header.magic   = GPU_CAPTURE_FILE_MAGIC;
+  header.version = GPU_CAPTURE_FILE_VERSION;
+  fwrite(&header, sizeof(header), 1, fh);
+
+  vfInternalMutexLock(vkfast->captureMutex);
+  vkfast->captureFile = (void *)fh;
+  vfInternalMutexUnlock(vkfast->captureMutex);
+}
+
+GPU_API_PRE void GPU_API_POST vfContextCaptureEnd(gpu_handle_context_t context, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  REDGPU_2_EXPECT(vkfast != NULL);
+
+  vfInternalMutexLock(vkfast->captureMutex);
+  if (vkfast->captureFile != NULL) {
+    fclose((FILE *)vkfast->captureFile);
+  }
+  if (vkfast->captureCpuUploadStorages != NULL) {
+    red32MemoryFree(vkfast->captureCpuUploadStorages);
+  }
+  vkfast->captureFile                      = NULL;
+  vkfast->captureCpuUploadStoragesCount    = 0;
+  vkfast->captureCpuUploadStoragesCapacity = 0;
+  vkfast->captureCpuUploadStorages         = NULL;
+  vfInternalMutexUnlock(vkfast->captureMutex);
+}
+
+#define VF_LZ4_HASH_BITS 12
+
+static uint32_t vfInternalLz4Read32(const uint8_t * bytes) {
+  uint32_t value = 0;
+  red32MemoryCopy(&value, bytes, 4);
+  return value;
+}
+
+static uint64_t vfInternalLz4WriteLength(uint8_t * dst, uint64_t o, uint64_t length) {
+  for (; length >= 255; length -= 255) {
+    dst[o] = 255;
+    o += 1;
+  }
+  dst[o] = (uint8_t)length;
+  return o + 1;
+}
+
+// NOTE(Constantine):
+// Greedy LZ4 block format compressor, any LZ4 block decoder reads its output. hashTable is 1 << VF_LZ4_HASH_BITS zeroed entries.
+// Returns 0 if the compressed block doesn't fit into dstCapacity bytes.
+static uint64_t vfInternalLz4Compress(const uint8_t * src, uint64_t srcCount, uint8_t * dst, uint64_t dstCapacity, uint32_t * hashTable) {
+  uint64_t anchor = 0;
+  uint64_t o      = 0;
+  if (srcCount >= 13) {
+    const uint64_t matchStartLimit = srcCount - 12; // NOTE(Constantine): The last match starts at least 12 bytes before the end.
+    const uint64_t matchEndLimit   = srcCount - 5;  // NOTE(Constantine): The last 5 bytes are always literals.
+    uint64_t i = 1;
+    while (i < matchStartLimit) {
+      const uint32_t sequence  = vfInternalLz4Read32(&src[i]);
+      const uint32_t hash      = (sequence * 2654435761U) >> (32 - VF_LZ4_HASH_BITS);
+      const uint64_t candidate = hashTable[hash];
+      hashTable[hash] = (uint32_t)(i + 1);
+      if (candidate == 0 || i - (candidate - 1) > 65535 || vfInternalLz4Read32(&src[candidate - 1]) != sequence) {
+        i += 1 + ((i - anchor) >> 6); // NOTE(Constantine): Skips faster through data that doesn't compress.
+        continue;
+      }
+      const uint64_t match = candidate - 1;
+      uint64_t matchBytesCount = 4;
+      while (i + matchBytesCount < matchEndLimit && src[match + matchBytesCount] == src[i + matchBytesCount]) {
+        matchBytesCount += 1;
+      }
+      const uint64_t literalsCount = i - anchor;
+      if (o + 1 + literalsCount / 255 + 1 + literalsCount + 2 + (matchBytesCount - 4) / 255 + 1 > dstCapacity) {
+        return 0;
+      }
+      dst[o] = (uint8_t)(((literalsCount < 15 ? literalsCount : 15) << 4) | (matchBytesCount - 4 < 15 ? matchBytesCount - 4 : 15));
+      o += 1;
+      if (literalsCount >= 15) {
+        o = vfInternalLz4WriteLength(dst, o, literalsCount - 15);
+      }
+      red32MemoryCopy(&dst[o], &src[anchor], literalsCount);
+      o += literalsCount;
+      dst[o + 0] = (uint8_t)((i - match) & 255);
+      dst[o + 1] = (uint8_t)((i - match) >> 8);
+      o += 2;
+      if (matchBytesCount - 4 >= 15) {
+        o = vfInternalLz4WriteLength(dst, o, matchBytesCount - 4 - 15);
+      }
+      i     += matchBytesCount;
+      anchor = i;
+    }
+  }
+  const uint64_t literalsCount = srcCount - anchor;
+  if (o + 1 + literalsCount / 255 + 1 + literalsCount > dstCapacity) {
+    return 0;
+  }
+  dst[o] = (uint8_t)((literalsCount < 15 ? literalsCount : 15) << 4);
+  o += 1;
+  if (literalsCount >= 15) {
+    o = vfInternalLz4WriteLength(dst, o, literalsCount - 15);
+  }
+  red32MemoryCopy(&dst[o], &src[anchor], literalsCount);
+  return o + literalsCount;
+}
+
+// NOTE(Constantine): Returns 1 if src is a valid LZ4 block that decompresses to exactly dstCount bytes.
+static int vfInternalLz4Decompress(const uint8_t * src, uint64_t srcCount, uint8_t * dst, uint64_t dstCount) {
+  uint64_t i = 0;
+  uint64_t o = 0;
+  while (i < srcCount) {
+    const unsigned token = src[i];
+    i += 1;
+    uint64_t literalsCount = token >> 4;
+    if (literalsCount == 15) {
+      unsigned byte = 255;
+      while (byte == 255) {
+        if (i >= srcCount) {
+          return 0;
+        }
+        byte = src[i];
+        i += 1;
+        literalsCount += byte;
+      }
+    }
+    if (literalsCount > srcCount - i || literalsCount > dstCount - o) {
+      return 0;
+    }
+    red32MemoryCopy(&dst[o], &src[i], literalsCount);
+    i += literalsCount;
+    o += literalsCount;
+    if (i == srcCount) {
+      break; // NOTE(Constantine): The last sequence has no match.
+    }
+    if (srcCount - i < 2) {
+      return 0;
+    }
+    const uint64_t offset = (uint64_t)src[i] | ((uint64_t)src[i + 1] << 8);
+    i += 2;
+    if (offset == 0 || offset > o) {
+      return 0;
+    }
+    uint64_t matchBytesCount = token & 15;
+    if (matchBytesCount == 15) {
+      unsigned byte = 255;
+      while (byte == 255) {
+        if (i >= srcCount) {
+          return 0;
+        }
+        byte = src[i];
+        i += 1;
+        matchBytesCount += byte;
+      }
+    }
+    matchBytesCount += 4;
+    if (matchBytesCount > dstCount - o) {
+      return 0;
+    }
+    for (uint64_t j = 0; j < matchBytesCount; j += 1) {
+      dst[o + j] = dst[o - offset + j]; // NOTE(Constantine): Byte by byte, a match can overlap its own output.
+    }
+    o += matchBytesCount;
+  }
+  return o == dstCount ? 1 : 0;
+}
+
+typedef struct vf_internal_checkpoint_chunk_t {
+  const uint8_t * contents;
+  uint64_t        bytesCount;
+  int             stagingIndex; // NOTE(Constantine): -1 if contents are the mapped memory of a CPU storage.
+} vf_internal_checkpoint_chunk_t;
+
+static const uint8_t vfInternalCheckpointPadding[GPU_CHECKPOINT_FILE_RAW_CHUNK_ALIGNMENT] = {0};
+
+// NOTE(Constantine): Waits for the readback of chunk if it's in a staging block and writes it to fh, returns the new file size.
+static uint64_t vfInternalCheckpointWriteChunk(vf_handle_context_t * vkfast, FILE * fh, uint64_t fileBytesCount, const vf_internal_checkpoint_chunk_t * chunk, const uint64_t * asyncs, const vf_heap_block_t * staging, uint8_t * compressed, uint64_t compressedCapacity, uint32_t * hashTable, const char * optionalFile, int optionalLine) {
+  if (chunk->stagingIndex >= 0) {
+    vfAsyncWaitToFinish((gpu_handle_context_t)(void *)vkfast, asyncs[chunk->stagingIndex], optionalFile, optionalLine);
+    if (vkfast->specificMemoryTypesCpuReadbackIsCoherent == 0) {
+      vfInternalMemoryNonCoherentFlushOrInvalidate(vkfast, 1, staging[chunk->stagingIndex].memory, staging[chunk->stagingIndex].array.memoryBytesCount, 0, chunk->bytesCount, optionalFile, optionalLine);
+    }
+  }
+
+  gpu_checkpoint_file_chunk_t header = {0};
+  header.codec              = GPU_CHECKPOINT_CODEC_RAW;
+  header.bytes_count        = chunk->bytesCount;
+  header.stored_bytes_count = chunk->bytesCount;
+  header.contents_hash      = vfInternalCaptureHashContents(chunk->contents, chunk->bytesCount);
+  if (compressed != NULL) {
+    for (uint64_t i = 0; i < (1 << VF_LZ4_HASH_BITS); i += 1) {
+      hashTable[i] = 0;
+    }
+    const uint64_t compressedBytesCount = vfInternalLz4Compress(chunk->contents, chunk->bytesCount, compressed, compressedCapacity, hashTable);
+    if (compressedBytesCount > 0) {
+      header.codec              = GPU_CHECKPOINT_CODEC_LZ4;
+      header.stored_bytes_count = compressedBytesCount;
+    }
+  }
+
+  uint64_t writtenCount = fwrite(&header, sizeof(header), 1, fh);
+  fileBytesCount += sizeof(header);
+  if (header.codec == GPU_CHECKPOINT_CODEC_RAW) {
+    const uint64_t paddingBytesCount = REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(fileBytesCount, GPU_CHECKPOINT_FILE_RAW_CHUNK_ALIGNMENT);
+    writtenCount += fwrite(vfInternalCheckpointPadding, 1, paddingBytesCount, fh) == paddingBytesCount ? 1 : 0;
+    writtenCount += fwrite(chunk->contents, 1, header.stored_bytes_count, fh) == header.stored_bytes_count ? 1 : 0;
+    fileBytesCount += paddingBytesCount;
+  } else {
+    writtenCount += 1;
+    writtenCount += fwrite(compressed, 1, header.stored_bytes_count, fh) == header.stored_bytes_count ? 1 : 0;
+  }
+  REDGPU_2_EXPECT(writtenCount == 3 || !"[vkFast] Can't write the checkpoint file.");
+  return fileBytesCount + header.stored_bytes_count;
+}
+
+GPU_API_PRE void GPU_API_POST vfContextCheckpoint(gpu_handle_context_t context, const char * checkpoint_filepath, uint64_t chunk_bytes_count, RedBool32 compress, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  REDGPU_2_EXPECT(vkfast != NULL);
+
+  RedHandleGpu gpu = vkfast->gpu;
+
+  const uint64_t chunkBytesCount = chunk_bytes_count == 0 ? GPU_CHECKPOINT_DEFAULT_CHUNK_BYTES_COUNT : chunk_bytes_count;
+  REDGPU_2_EXPECTWG(chunkBytesCount <= 0x7FFFFFFF); // NOTE(Constantine): LZ4 hash table positions are 32-bit.
+
+  // To close
+  FILE * fh = fopen(checkpoint_filepath, "wb");
+  REDGPU_2_EXPECT(fh != NULL || !"[vkFast] Can't open the checkpoint file for writing.");
+
+  vfAllQueuesWaitIdle(context, optionalFile, optionalLine);
+
+  // NOTE(Constantine): Storages created or destroyed during a checkpoint are not checkpointed consistently, the list is copied once.
+  vfInternalSpinLock(&vkfast->storagesLock);
+  const uint64_t storagesCount = vkfast->storagesCount;
+  // To free
+  vf_handle_t ** storages = (vf_handle_t **)red32MemoryCalloc(sizeof(vf_handle_t *) * (storagesCount > 0 ? storagesCount : 1));
+  if (storages != NULL) {
+    uint64_t i = 0;
+    for (vf_handle_t * storage = vkfast->storagesFirst; storage != NULL; storage = storage->storage.storagesNext) {
+      storages[i] = storage;
+      i += 1;
+    }
+  }
+  vfInternalSpinUnlock(&vkfast->storagesLock);
+  REDGPU_2_EXPECTWG(storages != NULL);
+
+  gpu_checkpoint_file_header_t header = {0};
+  header.magic             = GPU_CHECKPOINT_FILE_MAGIC;
+  header.version           = GPU_CHECKPOINT_FILE_VERSION;
+  header.storages_count    = storagesCount;
+  header.chunk_bytes_count = chunkBytesCount;
+  uint64_t writtenCount = fwrite(&header, sizeof(header), 1, fh);
+  int hasGpuOnlyStorages = 0;
+  for (uint64_t i = 0; i < storagesCount; i += 1) {
+    gpu_checkpoint_file_storage_t storage = {0};
+    storage.storage_type = (uint32_t)storages[i]->storage.info.storage_type;
+    storage.bytes_count  = storages[i]->storage.info.bytes_count;
+    writtenCount += fwrite(&storage, sizeof(storage), 1, fh);
+    if (storages[i]->storage.info.storage_type == GPU_STORAGE_TYPE_GPU_ONLY) {
+      hasGpuOnlyStorages = 1;
+    }
+  }
+  REDGPU_2_EXPECT(writtenCount == 1 + storagesCount || !"[vkFast] Can't write the checkpoint file.");
+  uint64_t fileBytesCount = sizeof(header) + sizeof(gpu_checkpoint_file_storage_t) * storagesCount;
+
+  // To destroy
+  vf_heap_block_t staging[2] = {0};
+  uint64_t        batches[2] = {0};
+  uint64_t        asyncs[2]  = {0};
+  if (hasGpuOnlyStorages == 1) {
+    vfInternalHeapBlockCreate(vkfast, GPU_STORAGE_TYPE_CPU_READBACK, chunkBytesCount, &staging[0], optionalFile, optionalLine);
+    vfInternalHeapBlockCreate(vkfast, GPU_STORAGE_TYPE_CPU_READBACK, chunkBytesCount, &staging[1], optionalFile, optionalLine);
+  }
+
+  // NOTE(Constantine): A chunk is kept only if LZ4 saves at least 1/16 of it.
+  const uint64_t compressedCapacity = chunkBytesCount - chunkBytesCount / 16;
+  uint8_t *      compressed         = NULL;
+  uint32_t *     hashTable          = NULL;
+  if (compress == 1) {
+    // To free
+    compressed = (uint8_t *)red32MemoryCalloc(compressedCapacity > 0 ? compressedCapacity : 1);
+    REDGPU_2_EXPECTWG(compressed != NULL);
+    // To free
+    hashTable = (uint32_t *)red32MemoryCalloc(sizeof(uint32_t) << VF_LZ4_HASH_BITS);
+    REDGPU_2_EXPECTWG(hashTable != NULL);
+  }
+
+  // NOTE(Constantine): The readback of chunk i is submitted before chunk i - 1 is written, chunk i uses staging block i % 2.
+  vf_internal_checkpoint_chunk_t pending    = {0};
+  int                            hasPending = 0;
+  uint64_t                       chunkIndex = 0;
+  for (uint64_t i = 0; i < storagesCount; i += 1) {
+    const vf_handle_t * storage    = storages[i];
+    const uint64_t      bytesCount = storage->storage.info.bytes_count;
+
+    const uint8_t * mapped = (const uint8_t *)storage->storage.hostImportPointer;
+    if (storage->storage.info.storage_type != GPU_STORAGE_TYPE_GPU_ONLY && storage->storage.hostImportPointer == NULL) {
+      vf_heap_block_t block = {0};
+      REDGPU_2_EXPECTWG(vfInternalHeapFindBlock(vkfast, storage->storage.info.storage_type, storage->storage.arrayRangeInfo.array, &block) == 1);
+      mapped = (const uint8_t *)block.mapped_void_ptr_original + storage->storage.arrayRangeInfo.arrayRangeBytesFirst;
+      if (storage->storage.info.storage_type == GPU_STORAGE_TYPE_CPU_READBACK && vkfast->specificMemoryTypesCpuReadbackIsCoherent == 0) {
+        vfInternalMemoryNonCoherentFlushOrInvalidate(vkfast, 1, block.memory, block.array.memoryBytesCount, storage->storage.arrayRangeInfo.arrayRangeBytesFirst, bytesCount, optionalFile, optionalLine);
+      }
+    }
+
+    for (uint64_t bytesFirst = 0; bytesFirst < bytesCount; bytesFirst += chunkBytesCount) {
+      vf_internal_checkpoint_chunk_t chunk = {0};
+      chunk.bytesCount   = bytesCount - bytesFirst < chunkBytesCount ? bytesCount - bytesFirst : chunkBytesCount;
+      chunk.stagingIndex = -1;
+      if (mapped != NULL) {
+        chunk.contents = mapped + bytesFirst;
+      } else {
+        const int k = (int)(chunkIndex % 2);
+        RedCopyArrayRange range = {0};
+        range.arrayRBytesFirst = storage->storage.arrayRangeInfo.arrayRangeBytesFirst + bytesFirst;
+        range.arrayWBytesFirst = 0;
+        range.bytesCount       = chunk.bytesCount;
+        batches[k] = vfBatchBegin(context, batches[k], NULL, "vkFast_vfContextCheckpoint", optionalFile, optionalLine);
+        vfBatchStorageCopyRaw(context, batches[k], storage->storage.arrayRangeInfo.array, staging[k].array.handle, &range, optionalFile, optionalLine);
+        vfBatchBarrierCpuReadback(context, batches[k], optionalFile, optionalLine);
+        vfBatchEnd(context, batches[k], optionalFile, optionalLine);
+        RedHandleCalls batchRaw = vfBatchGetRawHandle(context, batches[k], optionalFile, optionalLine);
+        asyncs[k] = vfAsyncBatchExecuteRaw(context, 1, &batchRaw, 0, NULL, NULL, optionalFile, optionalLine);
+        chunk.contents     = (const uint8_t *)staging[k].mapped_void_ptr_original;
+        chunk.stagingIndex = k;
+      }
+      if (hasPending == 1) {
+        fileBytesCount = vfInternalCheckpointWriteChunk(vkfast, fh, fileBytesCount, &pending, asyncs, staging, compressed, compressedCapacity, hashTable, optionalFile, optionalLine);
+      }
+      pending     = chunk;
+      hasPending  = 1;
+      chunkIndex += 1;
+    }
+  }
+  if (hasPending == 1) {
+    fileBytesCount = vfInternalCheckpointWriteChunk(vkfast, fh, fileBytesCount, &pending, asyncs, staging, compressed, compressedCapacity, hashTable, optionalFile, optionalLine);
+  }
+
+  REDGPU_2_EXPECT(fclose(fh) == 0 || !"[vkFast] Can't write the checkpoint file.");
+
+  for (int k = 0; k < 2; k += 1) {
+    if (batches[k] != 0) {
+      vfIdDestroy(1, &batches[k], optionalFile, optionalLine);
+    }
+    if (staging[k].array.handle != NULL) {
+      vfInternalHeapBlockDestroy(vkfast, &staging[k], optionalFile, optionalLine);
+    }
+  }
+  if (compressed != NULL) {
+    red32MemoryFree(compressed);
+  }
+  if (hashTable != NULL) {
+    red32MemoryFree(hashTable);
+  }
+  red32MemoryFree(storages);
+}
+
+typedef struct vf_internal_file_map_t {
+  const uint8_t * bytes;
+  uint64_t        bytesCount;
+#if defined(_WIN32)
+  HANDLE          file;
+  HANDLE          mapping;
+#endif
+} vf_internal_file_map_t;
+
+// NOTE(Constantine): Maps a whole file read-only, returns 0 if it can't be opened, is empty or can't be mapped.
+static int vfInternalFileMapOpen(const char * filepath, vf_internal_file_map_t * outMap) {
+  vf_internal_file_map_t map = {0};
+#if defined(_WIN32)
+  map.file = CreateFileA(filepath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  if (map.file == INVALID_HANDLE_VALUE) {
+    return 0;
+  }
+  LARGE_INTEGER fileSize = {0};
+  if (GetFileSizeEx(map.file, &fileSize) == 0 || fileSize.QuadPart <= 0) {
+    CloseHandle(map.file);
+    return 0;
+  }
+  map.mapping = CreateFileMappingA(map.file, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (map.mapping == NULL) {
+    CloseHandle(map.file);
+    return 0;
+  }
+  map.bytes = (const uint8_t *)MapViewOfFile(map.mapping, FILE_MAP_READ, 0, 0, 0);
+  if (map.bytes == NULL) {
+    CloseHandle(map.mapping);
+    CloseHandle(map.file);
+    return 0;
+  }
+  map.bytesCount = (uint64_t)fileSize.QuadPart;
+#else
+  const int fd = open(filepath, O_RDONLY);
+  if (fd < 0) {
+    return 0;
+  }
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+    close(fd);
+    return 0;
+  }
+  void * bytes = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd); // NOTE(Constantine): The mapping keeps the file open.
+  if (bytes == MAP_FAILED) {
+    return 0;
+  }
+  madvise(bytes, (size_t)fileStat.st_size, MADV_SEQUENTIAL);
+  map.bytes      = (const uint8_t *)bytes;
+  map.bytesCount = (uint64_t)fileStat.st_size;
+#endif
+  outMap[0] = map;
+  return 1;
+}
+
+static void vfInternalFileMapClose(vf_internal_file_map_t * map) {
+#if defined(_WIN32)
+  UnmapViewOfFile(map->bytes);
+  CloseHandle(map->mapping);
+  CloseHandle(map->file);
+#else
+  munmap((void *)map->bytes, (size_t)map->bytesCount);
+#endif
+  map->bytes      = NULL;
+  map->bytesCount = 0;
+}
+
+GPU_API_PRE uint64_t GPU_API_POST vfContextRestore(gpu_handle_context_t context, const char * checkpoint_filepath, uint64_t out_storages_capacity, gpu_storage_t * out_storages, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  REDGPU_2_EXPECT(vkfast != NULL);
+
+  RedHandleGpu gpu = vkfast->gpu;
+
+  // NOTE(Constantine): The file is mapped, raw chunks are hashed and copied straight from the mapping and LZ4 chunks are decompressed from it.
+  // To close
+  vf_internal_file_map_t file = {0};
+  REDGPU_2_EXPECT(vfInternalFileMapOpen(checkpoint_filepath, &file) == 1 || !"[vkFast] Can't open the checkpoint file for reading.");
+
+  gpu_checkpoint_file_header_t header = {0};
+  REDGPU_2_EXPECT(file.bytesCount >= sizeof(header) || !"[vkFast] Not a vkFast checkpoint file, or a checkpoint file of another version.");
+  red32MemoryCopy(&header, file.bytes, sizeof(header));
+  REDGPU_2_EXPECT((header.magic == GPU_CHECKPOINT_FILE_MAGIC && header.version == GPU_CHECKPOINT_FILE_VERSION) || !"[vkFast] Not a vkFast checkpoint file, or a checkpoint file of another version.");
+  REDGPU_2_EXPECT((header.chunk_bytes_count > 0 && header.chunk_bytes_count <= 0x7FFFFFFF) || !"[vkFast] Checkpoint file is corrupted.");
+
+  if (out_storages == NULL) {
+    vfInternalFileMapClose(&file);
+    return header.storages_count;
+  }
+  REDGPU_2_EXPECTWG(out_storages_capacity >= header.storages_count);
+
+  const uint64_t storagesCount   = header.storages_count;
+  const uint64_t chunkBytesCount = header.chunk_bytes_count;
+
+  REDGPU_2_EXPECT(storagesCount <= (file.bytesCount - sizeof(header)) / sizeof(gpu_checkpoint_file_storage_t) || !"[vkFast] Checkpoint file is corrupted.");
+  // To free
+  gpu_checkpoint_file_storage_t * fileStorages = (gpu_checkpoint_file_storage_t *)red32MemoryCalloc(sizeof(gpu_checkpoint_file_storage_t) * (storagesCount > 0 ? storagesCount : 1));
+  REDGPU_2_EXPECTWG(fileStorages != NULL);
+  if (storagesCount > 0) {
+    red32MemoryCopy(fileStorages, file.bytes + sizeof(header), sizeof(gpu_checkpoint_file_storage_t) * storagesCount);
+  }
+  uint64_t fileBytesCount = sizeof(header) + sizeof(gpu_checkpoint_file_storage_t) * storagesCount;
+
+  vfAllQueuesWaitIdle(context, optionalFile, optionalLine);
+
+  int hasGpuOnlyStorages = 0;
+  for (uint64_t i = 0; i < storagesCount; i += 1) {
+    REDGPU_2_EXPECT((fileStorages[i].storage_type >= GPU_STORAGE_TYPE_GPU_ONLY && fileStorages[i].storage_type <= GPU_STORAGE_TYPE_CPU_READBACK) || !"[vkFast] Checkpoint file is corrupted.");
+    gpu_storage_info_t info = {0};
+    info.storage_type = (gpu_storage_type_t)fileStorages[i].storage_type;
+    info.bytes_count  = fileStorages[i].bytes_count;
+    // To destroy (by the caller)
+    vfStorageCreate(context, &info, &out_storages[i], optionalFile, optionalLine);
+    if (info.storage_type == GPU_STORAGE_TYPE_GPU_ONLY) {
+      hasGpuOnlyStorages = 1;
+    }
+  }
+
+  // To destroy
+  vf_heap_block_t staging[2] = {0};
+  uint64_t        batches[2] = {0};
+  uint64_t        asyncs[2]  = {0};
+  if (hasGpuOnlyStorages == 1) {
+    vfInternalHeapBlockCreate(vkfast, GPU_STORAGE_TYPE_CPU_UPLOAD, chunkBytesCount, &staging[0], optionalFile, optionalLine);
+    vfInternalHeapBlockCreate(vkfast, GPU_STORAGE_TYPE_CPU_UPLOAD, chunkBytesCount, &staging[1], optionalFile, optionalLine);
+  }
+
+  // NOTE(Constantine): Allocated by the first LZ4 chunk. Chunks are never decompressed into mapped upload memory, it's often write-combined and slow to hash from.
+  // To free
+  uint8_t * decompressed = NULL;
+
+  // NOTE(Constantine): Chunk i is hashed while the upload of chunk i - 1 runs, chunk i uses staging block i % 2.
+  uint64_t chunkIndex = 0;
+  for (uint64_t i = 0; i < storagesCount; i += 1) {
+    const gpu_storage_t * storage    = &out_storages[i];
+    const uint64_t        bytesCount = fileStorages[i].bytes_count;
+
+    for (uint64_t bytesFirst = 0; bytesFirst < bytesCount; bytesFirst += chunkBytesCount) {
+      const uint64_t chunkBytesCountExpected = bytesCount - bytesFirst < chunkBytesCount ? bytesCount - bytesFirst : chunkBytesCount;
+
+      gpu_checkpoint_file_chunk_t chunk = {0};
+      REDGPU_2_EXPECT(file.bytesCount - fileBytesCount >= sizeof(chunk) || !"[vkFast] Checkpoint file is corrupted.");
+      red32MemoryCopy(&chunk, file.bytes + fileBytesCount, sizeof(chunk));
+      fileBytesCount += sizeof(chunk);
+      REDGPU_2_EXPECT((chunk.bytes_count == chunkBytesCountExpected && chunk.stored_bytes_count <= chunkBytesCount) || !"[vkFast] Checkpoint file is corrupted.");
+      const uint8_t * contents = NULL;
+      if (chunk.codec == GPU_CHECKPOINT_CODEC_RAW) {
+        const uint64_t paddingBytesCount = REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(fileBytesCount, GPU_CHECKPOINT_FILE_RAW_CHUNK_ALIGNMENT);
+        REDGPU_2_EXPECT(chunk.stored_bytes_count == chunk.bytes_count || !"[vkFast] Checkpoint file is corrupted.");
+        REDGPU_2_EXPECT(file.bytesCount - fileBytesCount >= paddingBytesCount + chunk.stored_bytes_count || !"[vkFast] Checkpoint file is corrupted.");
+        fileBytesCount += paddingBytesCount;
+        contents = file.bytes + fileBytesCount;
+      } else {
+        REDGPU_2_EXPECT(chunk.codec == GPU_CHECKPOINT_CODEC_LZ4 || !"[vkFast] Checkpoint file is corrupted.");
+        REDGPU_2_EXPECT(file.bytesCount - fileBytesCount >= chunk.stored_bytes_count || !"[vkFast] Checkpoint file is corrupted.");
+        if (decompressed == NULL) {
+          decompressed = (uint8_t *)red32MemoryCalloc(chunkBytesCount);
+          REDGPU_2_EXPECTWG(decompressed != NULL);
+        }
+        REDGPU_2_EXPECT(vfInternalLz4Decompress(file.bytes + fileBytesCount, chunk.stored_bytes_count, decompressed, chunk.bytes_count) == 1 || !"[vkFast] Checkpoint file is corrupted.");
+        contents = decompressed;
+      }
+      fileBytesCount += chunk.stored_bytes_count;
+      REDGPU_2_EXPECT(vfInternalCaptureHashContents(contents, chunk.bytes_count) == chunk.contents_hash || !"[vkFast] Checkpoint file is corrupted.");
+
+      if (storage->info.storage_type != GPU_STORAGE_TYPE_GPU_ONLY) {
+        red32MemoryCopy((uint8_t *)storage->mapped_void_ptr + bytesFirst, contents, chunk.bytes_count);
+        if (storage->info.storage_type == GPU_STORAGE_TYPE_CPU_UPLOAD && bytesFirst + chunk.bytes_count == storage->info.bytes_count) {
+          vfStorageCpuUploadFlush(context, storage->id, optionalFile, optionalLine);
+        }
+      } else {
+        const int k = (int)(chunkIndex % 2);
+        vfAsyncWaitToFinish(context, asyncs[k], optionalFile, optionalLine);
+        asyncs[k] = 0;
+        red32MemoryCopy(staging[k].mapped_void_ptr_original, contents, chunk.bytes_count);
+        if (vkfast->specificMemoryTypesCpuUploadIsCoherent == 0) {
+          vfInternalMemoryNonCoherentFlushOrInvalidate(vkfast, 0, staging[k].memory, staging[k].array.memoryBytesCount, 0, chunk.bytes_count, optionalFile, optionalLine);
+        }
+        const vf_handle_t * handle = (const vf_handle_t *)(void *)storage->id;
+        RedCopyArrayRange range = {0};
+        range.arrayRBytesFirst = 0;
+        range.arrayWBytesFirst = handle->storage.arrayRangeInfo.arrayRangeBytesFirst + bytesFirst;
+        range.bytesCount       = chunk.bytes_count;
+        batches[k] = vfBatchBegin(context, batches[k], NULL, "vkFast_vfContextRestore", optionalFile, optionalLine);
+        vfBatchStorageCopyRaw(context, batches[k], staging[k].array.handle, handle->storage.arrayRangeInfo.array, &range, optionalFile, optionalLine);
+        vfBatchBarrierMemory(context, batches[k], optionalFile, optionalLine);
+        vfBatchEnd(context, batches[k], optionalFile, optionalLine);
+        RedHandleCalls batchRaw = vfBatchGetRawHandle(context, batches[k], optionalFile, optionalLine);
+        asyncs[k] = vfAsyncBatchExecuteRaw(context, 1, &batchRaw, 0, NULL, NULL, optionalFile, optionalLine);
+      }
+      chunkIndex += 1;
+    }
+
+    if (storage->info.storage_type == GPU_STORAGE_TYPE_CPU_UPLOAD) {
+      vfStorageCpuUploadFlush(context, storage->id, optionalFile, optionalLine);
+    }
+  }
+
+  vfInternalFileMapClose(&file);
+
+  for (int k = 0; k < 2; k += 1) {
+    vfAsyncWaitToFinish(context, asyncs[k], optionalFile, optionalLine);
+    if (batches[k] != 0) {
+      vfIdDestroy(1, &batches[k], optionalFile, optionalLine);
+    }
+    if (staging[k].array.handle != NULL) {
+      vfInternalHeapBlockDestroy(vkfast, &staging[k], optionalFile, optionalLine);
+    }
+  }
+  if (decompressed != NULL) {
+    red32MemoryFree(decompressed);
+  }
+  red32MemoryFree(fileStorages);
+
+  return storagesCount;
+}
+
+static void vfInternalHashIndexInsert(vf_hash_index_t * index, uint64_t hash, uint64_t entryIndex) {
+  const uint64_t mask = index->capacity - 1;
+  uint64_t slot = hash & mask;
+  while (index->slots[slot * 2 + 1] != 0) {
+    slot = (slot + 1) & mask;
+  }
+  index->slots[slot * 2 + 0] = hash;
+  index->slots[slot * 2 + 1] = entryIndex + 1;
+}
+
+// NOTE(Constantine): Grows the index to fit entriesCount entries and reinserts the indexed ones.
+static void vfInternalHashIndexReserve(vf_hash_index_t * index, uint64_t entriesCount) {
+  if (entriesCount * 2 <= index->capacity) {
+    return;
+  }
+  uint64_t capacity = index->capacity == 0 ? 32 : index->capacity;
+  while (entriesCount * 2 > capacity) {
+    capacity *= 2;
+  }
+  uint64_t * slots = (uint64_t *)red32MemoryCalloc(sizeof(uint64_t) * 2 * capacity);
+  REDGPU_2_EXPECTWG(slots != NULL);
+  vf_hash_index_t grown;
+  grown.capacity = capacity;
+  grown.slots    = slots;
+  for (uint64_t i = 0; i < index->capacity; i += 1) {
+    if (index->slots[i * 2 + 1] != 0) {
+      vfInternalHashIndexInsert(&grown, index->slots[i * 2 + 0], index->slots[i * 2 + 1] - 1);
+    }
+  }
+  if (index->slots != NULL) {
+    red32MemoryFree(index->slots);
+  }
+  index[0] = grown;
+}
+
+// NOTE(Constantine): Returns the index plus 1 of the next entry with key hash hash, or 0 if there are no more. Start with *cursor at 0.
+static uint64_t vfInternalHashIndexNext(const vf_hash_index_t * index, uint64_t hash, uint64_t * cursor) {
+  const uint64_t mask = index->capacity - 1;
+  while (cursor[0] < index->capacity) {
+    const uint64_t slot = (hash + cursor[0]) & mask;
+    if (index->slots[slot * 2 + 1] == 0) {
+      break;
+    }
+    cursor[0] += 1;
+    if (index->slots[slot * 2 + 0] == hash) {
+      return index->slots[slot * 2 + 1];
+    }
+  }
+  cursor[0] = index->capacity;
+  return 0;
+}
+
+static uint64_t vfInternalHashIndexFindSlot(const vf_hash_index_t * index, uint64_t hash, uint64_t entryIndex) {
+  const uint64_t mask = index->capacity - 1;
+  uint64_t slot = hash & mask;
+  while (index->slots[slot * 2 + 1] != entryIndex + 1) {
+    REDGPU_2_EXPECTWG(!"Hash index entry is not indexed" || (index->slots[slot * 2 + 1] != 0));
+    slot = (slot + 1) & mask;
+  }
+  return slot;
+}
+
+// NOTE(Constantine): Backward shift deletion, the entries probed past the removed one move closer to their home slots.
+static void vfInternalHashIndexRemove(vf_hash_index_t * index, uint64_t hash, uint64_t entryIndex) {
+  const uint64_t mask = index->capacity - 1;
+  uint64_t hole = vfInternalHashIndexFindSlot(index, hash, entryIndex);
+  uint64_t slot = hole;
+  for (;;) {
+    slot = (slot + 1) & mask;
+    if (index->slots[slot * 2 + 1] == 0) {
+      break;
+    }
+    const uint64_t home = index->slots[slot * 2 + 0] & mask;
+    const int homeIsInHole = hole <= slot ? (home <= hole || home > slot) : (home <= hole && home > slot);
+    if (homeIsInHole) {
+      index->slots[hole * 2 + 0] = index->slots[slot * 2 + 0];
+      index->slots[hole * 2 + 1] = index->slots[slot * 2 + 1];
+      hole = slot;
+    }
+  }
+  index->slots[hole * 2 + 0] = 0;
+  index->slots[hole * 2 + 1] = 0;
+}
+
+// NOTE(Constantine): For swap removes, the entry at fromEntryIndex moved to toEntryIndex.
+static void vfInternalHashIndexMove(vf_hash_index_t * index, uint64_t hash, uint64_t fromEntryIndex, uint64_t toEntryIndex) {
+  const uint64_t slot = vfInternalHashIndexFindSlot(index, hash, fromEntryIndex);
+  index->slots[slot * 2 + 1] = toEntryIndex + 1;
+}
+
+// NOTE(Constantine): Call with programPipelinesCacheLock locked.
+static void vfInternalProgramPipelinesCacheRemoveAt(vf_handle_context_t * vkfast, uint64_t i) {
+  vf_program_pipeline_cache_entry_t * entry = &vkfast->programPipelinesCache[i];
+  vf_handle_t * handle = (vf_handle_t *)(void *)entry->programPipeline;
+  handle->procedure.isCached      = 0;
+  handle->procedure.cachedKeyHash = 0;
+  vfInternalHashIndexRemove(&vkfast->programPipelinesCacheIndex, entry->keyHash, i);
+  red32MemoryFree(entry->keyWords);
+  const uint64_t last = vkfast->programPipelinesCacheCount - 1;
+  if (i != last) {
+    vfInternalHashIndexMove(&vkfast->programPipelinesCacheIndex, vkfast->programPipelinesCache[last].keyHash, last, i);
+    vkfast->programPipelinesCache[i] = vkfast->programPipelinesCache[last];
+  }
+  vkfast->programPipelinesCacheCount -= 1;
+}
+
+// NOTE(Constantine): Call with programPipelinesCacheLock locked. Returns the entry index plus 1, or 0 if programPipeline is not cached.
+static uint64_t vfInternalProgramPipelinesCacheFind(vf_handle_context_t * vkfast, uint64_t programPipeline) {
+  vf_handle_t * handle = (vf_handle_t *)(void *)programPipeline;
+  if (handle->procedure.isCached == 0) {
+    return 0;
+  }
+  uint64_t cursor = 0;
+  for (uint64_t e = vfInternalHashIndexNext(&vkfast->programPipelinesCacheIndex, handle->procedure.cachedKeyHash, &cursor); e != 0; e = vfInternalHashIndexNext(&vkfast->programPipelinesCacheIndex, handle->procedure.cachedKeyHash, &cursor)) {
+    if (vkfast->programPipelinesCache[e - 1].programPipeline == programPipeline) {
+      return e;
+    }
+  }
+  return 0;
+}
+
+// NOTE(Constantine): Drops the cache entries that return program_pipeline or that were created from program.
+static void vfInternalProgramPipelinesCacheRemove(vf_handle_context_t * vkfast, uint64_t program, uint64_t programPipeline) {
+  vfInternalSpinLock(&vkfast->programPipelinesCacheLock);
+  if (programPipeline != 0) {
+    const uint64_t e = vfInternalProgramPipelinesCacheFind(vkfast, programPipeline);
+    if (e != 0) {
+      vfInternalProgramPipelinesCacheRemoveAt(vkfast, e - 1);
+    }
+  }
+  if (program != 0) {
+    for (uint64_t i = 0; i < vkfast->programPipelinesCacheCount;) {
+      if (vkfast->programPipelinesCache[i].keyWords[0] == program) {
+        vfInternalProgramPipelinesCacheRemoveAt(vkfast, i);
+        continue;
+      }
+      i += 1;
+    }
+  }
+  vfInternalSpinUnlock(&vkfast->programPipelinesCacheLock);
+}
+
+// NOTE(Constantine): Drops the references of batch to the cached bindings sets it bound, their pools can be reset after that.
+static void vfInternalBatchReleaseBindingsSets(vf_handle_t * batch) {
+  vf_handle_context_t * vkfast = batch->vkfast;
+  if (batch->batch.referencedBindingsSetsCount == 0) {
+    return;
+  }
+  vfInternalSpinLock(&vkfast->bindingsSetsLock);
+  for (uint64_t i = 0; i < batch->batch.referencedBindingsSetsCount; i += 1) {
+    batch->batch.referencedBindingsSets[i]->referencesCount -= 1;
+  }
+  vfInternalSpinUnlock(&vkfast->bindingsSetsLock);
+  batch->batch.referencedBindingsSetsCount = 0;
+}
+
+GPU_API_PRE void GPU_API_POST vfIdDestroy(uint64_t ids_count, const uint64_t * ids, const char * optionalFile, int optionalLine) {
+  for (uint64_t i = 0; i < ids_count; i += 1) {
+    vf_handle_t * handle = (vf_handle_t *)(void *)ids[i];
+    if (handle == NULL) {
+      continue;
+    }
+    if (handle->handle_id == VF_HANDLE_ID_INVALID) {
+      continue;
+    }
+
+    vfInternalCaptureIdDestroy(handle->vkfast, ids[i], optionalLine);
+
+    if (handle->handle_id == VF_HANDLE_ID_STORAGE) {
+      vfInternalStoragesRemove(handle->vkfast, handle);
+      if (handle->storage.share != NULL) {
+        vfInternalStorageShareRelease(handle->storage.share);
+        handle->storage.share = NULL;
+      }
+      if (handle->storage.hostImportMemory != NULL) {
+        np(red2DestroyHandle,
+          "context", handle->vkfast->context,
+          "gpu", handle->vkfast->gpu,
+          "handleType", RED_HANDLE_TYPE_ARRAY,
+          "handle", handle->storage.arrayRangeInfo.array,
+          "optionalHandle2", NULL,
+          "optionalFile", optionalFile,
+          "optionalLine", optionalLine,
+          "optionalUserData", NULL
+        );
+        np(red2DestroyHandle,
+          "context", handle->vkfast->context,
+          "gpu", handle->vkfast->gpu,
+          "handleType", RED_HANDLE_TYPE_MEMORY,
+          "handle", handle->storage.hostImportMemory,
+          "optionalHandle2", NULL,
+          "optionalFile", optionalFile,
+          "optionalLine", optionalLine,
+          "optionalUserData", NULL
+        );
+        handle->storage.hostImportMemory = NULL;
+      }
+      continue;
+    }
+
+    if (handle->handle_id == VF_HANDLE_ID_GPU_CODE) {
+      vfInternalProgramPipelinesCacheRemove(handle->vkfast, ids[i], 0);
+      np(red2DestroyHandle,
+        "context", handle->vkfast->context,
+        "gpu", handle->vkfast->gpu,
+        "handleType", RED_HANDLE_TYPE_GPU_CODE,
+        "handle", handle->gpuCode.gpuCode,
+        "optionalHandle2", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      if (handle->gpuCode.specializableIr != NULL) {
+        red32MemoryFree(handle->gpuCode.specializableIr);
+        handle->gpuCode.specializableIr = NULL;
+      }
+      continue;
+    }
+
+    if (handle->handle_id == VF_HANDLE_ID_PROCEDURE) {
+      vfInternalProgramPipelinesCacheRemove(handle->vkfast, 0, ids[i]);
+      np(red2DestroyHandle,
+        "context", handle->vkfast->context,
+        "gpu", handle->vkfast->gpu,
+        "handleType", RED_HANDLE_TYPE_PROCEDURE_PARAMETERS,
+        "handle", handle->procedure.procedureParameters.procedureParameters,
+        "optionalHandle2", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      for (int i = 0; i < 7; i += 1) {
+        np(red2DestroyHandle,
+          "context", handle->vkfast->context,
+          "gpu", handle->vkfast->gpu,
+          "handleType", RED_HANDLE_TYPE_STRUCT_DECLARATION,
+          "handle", handle->procedure.procedureParameters.structsDeclarations[i],
+          "optionalHandle2", NULL,
+          "optionalFile", optionalFile,
+          "optionalLine", optionalLine,
+          "optionalUserData", NULL
+        );
+      }
+      np(red2DestroyHandle,
+        "context", handle->vkfast->context,
+        "gpu", handle->vkfast->gpu,
+        "handleType", RED_HANDLE_TYPE_STRUCT_DECLARATION,
+        "handle", handle->procedure.procedureParameters.handlesDeclaration,
+        "optionalHandle2", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      np(red2DestroyHandle,
+        "context", handle->vkfast->context,
+        "gpu", handle->vkfast->gpu,
+        "handleType", RED_HANDLE_TYPE_PROCEDURE,
+        "handle", handle->procedure.procedure,
+        "optionalHandle2", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      if (handle->procedure.specializedGpuCode != NULL) {
+        np(red2DestroyHandle,
+          "context", handle->vkfast->context,
+          "gpu", handle->vkfast->gpu,
+          "handleType", RED_HANDLE_TYPE_GPU_CODE,
+          "handle", handle->procedure.specializedGpuCode,
+          "optionalHandle2", NULL,
+          "optionalFile", optionalFile,
+          "optionalLine", optionalLine,
+          "optionalUserData", NULL
+        );
+      }
+      continue;
+    }
+
+    if (handle->handle_id == VF_HANDLE_ID_BATCH) {
+      vfInternalBatchReleaseBindingsSets(handle);
+      if (handle->batch.pendingBindingsSetKeyWords != NULL) {
+        red32MemoryFree(handle->batch.pendingBindingsSetKeyWords);
+      }
+      if (handle->batch.referencedBindingsSets != NULL) {
+        red32MemoryFree(handle->batch.referencedBindingsSets);
+      }
+      np(red2DestroyHandle,
+        "context", handle->vkfast->context,
+        "gpu", handle->vkfast->gpu,
+        "handleType", RED_HANDLE_TYPE_STRUCTS_MEMORY,
+        "handle", handle->batch.structsMemory,
+        "optionalHandle2", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      np(red2DestroyHandle,
+        "context", handle->vkfast->context,
+        "gpu", handle->vkfast->gpu,
+        "handleType", RED_HANDLE_TYPE_STRUCTS_MEMORY,
+        "handle", handle->batch.structsMemorySamplers,
+        "optionalHandle2", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      np(red2DestroyHandle,
+        "context", handle->vkfast->context,
+        "gpu", handle->vkfast->gpu,
+        "handleType", RED_HANDLE_TYPE_STRUCT_DECLARATION,
+        "handle", handle->batch.currentStructSamplers.handleDeclaration,
+        "optionalHandle2", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      np(red2DestroyHandle,
+        "context", handle->vkfast->context,
+        "gpu", handle->vkfast->gpu,
+        "handleType", RED_HANDLE_TYPE_CALLS,
+        "handle", handle->batch.calls.handle,
+        "optionalHandle2", handle->batch.calls.memory,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+      continue;
+    }
+  }
+
+  for (uint64_t i = 0; i < ids_count; i += 1) {
+    vf_handle_t * handle = (vf_handle_t *)(void *)ids[i];
+    red32MemoryFree(handle); // NOTE(Constantine): Internally, all handles must be allocated, except for async_id.
+  }
+}
+
+static void vfInternalPresentRetiredDestroy(vf_handle_context_t * vkfast, const char * optionalFile, int optionalLine) {
+  if (vkfast->presentRetired != NULL) {
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_PRESENT,
+      "handle", vkfast->presentRetired,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    vkfast->presentRetired = NULL;
+  }
+  if (vkfast->presentRetiredGpuSignalAcquire != NULL) {
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_GPU_SIGNAL,
+      "handle", vkfast->presentRetiredGpuSignalAcquire,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    vkfast->presentRetiredGpuSignalAcquire = NULL;
+  }
+  if (vkfast->presentRetiredPixelsCpuUpload_memory_and_array.array.handle != NULL) {
+    np(redMemoryUnmap,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "mappableMemory", vkfast->presentRetiredPixelsCpuUpload_memory_and_array.handleAllocatedDedicatedOrMappableMemoryOrPickedMemory,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_ARRAY,
+      "handle", vkfast->presentRetiredPixelsCpuUpload_memory_and_array.array.handle,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_MEMORY,
+      "handle", vkfast->presentRetiredPixelsCpuUpload_memory_and_array.handleAllocatedDedicatedOrMappableMemoryOrPickedMemory,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    Red2Array zero = {0};
+    vkfast->presentRetiredPixelsCpuUpload_memory_and_array = zero;
+  }
+  vkfast->presentRetiredDrawsCount = 0;
+}
+
+static void vfInternalPresentConvertArraysDestroy(vf_handle_context_t * vkfast, int destroyCpuUpload, int destroyGpu, const char * optionalFile, int optionalLine) {
+  if (destroyCpuUpload == 1 && vkfast->presentConvertPixelsCpuUpload_memory_and_array.array.handle != NULL) {
+    np(redMemoryUnmap,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "mappableMemory", vkfast->presentConvertPixelsCpuUpload_memory_and_array.handleAllocatedDedicatedOrMappableMemoryOrPickedMemory,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_ARRAY,
+      "handle", vkfast->presentConvertPixelsCpuUpload_memory_and_array.array.handle,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_MEMORY,
+      "handle", vkfast->presentConvertPixelsCpuUpload_memory_and_array.handleAllocatedDedicatedOrMappableMemoryOrPickedMemory,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    Red2Array zero = {0};
+    vkfast->presentConvertPixelsCpuUpload_memory_and_array  = zero;
+    vkfast->presentConvertPixelsCpuUpload_void_ptr_original = NULL;
+    vkfast->presentConvertPixelsCpuUploadBytesCount         = 0;
+  }
+  if (destroyGpu == 1 && vkfast->presentConvertPixelsGpu_memory_and_array.array.handle != NULL) {
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_ARRAY,
+      "handle", vkfast->presentConvertPixelsGpu_memory_and_array.array.handle,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_MEMORY,
+      "handle", vkfast->presentConvertPixelsGpu_memory_and_array.handleAllocatedDedicatedOrMappableMemoryOrPickedMemory,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    Red2Array zero = {0};
+    vkfast->presentConvertPixelsGpu_memory_and_array = zero;
+    vkfast->presentConvertPixelsGpuBytesCount        = 0;
+  }
+}
+
+GPU_API_PRE void GPU_API_POST vfContextDeinit(gpu_handle_context_t context, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  vfAllQueuesWaitIdle(context, optionalFile, optionalLine);
+
+  // NOTE(Constantine): Extra windows share the raw context, so they're deinited before it.
+  for (uint64_t i = 0; i < vkfast->windowsCount; i += 1) {
+    vfContextDeinit((gpu_handle_context_t)(void *)vkfast->windows[i], optionalFile, optionalLine);
+  }
+  if (vkfast->windows != NULL) {
+    red32MemoryFree(vkfast->windows);
+    vkfast->windows      = NULL;
+    vkfast->windowsCount = 0;
+  }
+
+  // NOTE(Constantine): WSI.
+  {
+    vfInternalPresentRetiredDestroy(vkfast, optionalFile, optionalLine);
+
+    vfInternalPresentConvertArraysDestroy(vkfast, 1, 1, optionalFile, optionalLine);
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_STRUCTS_MEMORY,
+      "handle", vkfast->presentConvertStructsMemory,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_STRUCT_DECLARATION,
+      "handle", vkfast->presentConvertStruct.handleDeclaration,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    if (vkfast->presentConvertProgramPipeline != 0) {
+      vfIdDestroy(1, &vkfast->presentConvertProgramPipeline, optionalFile, optionalLine);
+    }
+    if (vkfast->presentConvertProgram != 0) {
+      vfIdDestroy(1, &vkfast->presentConvertProgram, optionalFile, optionalLine);
+    }
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_STRUCT_DECLARATION,
+      "handle", vkfast->presentUpscaleStruct.handleDeclaration,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    if (vkfast->presentUpscaleProgramPipeline != 0) {
+      vfIdDestroy(1, &vkfast->presentUpscaleProgramPipeline, optionalFile, optionalLine);
+    }
+    if (vkfast->presentUpscaleProgram != 0) {
+      vfIdDestroy(1, &vkfast->presentUpscaleProgram, optionalFile, optionalLine);
+    }
+
+    #if defined(_WIN32)
+    if (vkfast->pacingTimer != NULL) {
+      CloseHandle((HANDLE)vkfast->pacingTimer);
+    }
+    #endif
+
+    if (vkfast->presentPixelsCpuUpload_memory_and_array.handleAllocatedDedicatedOrMappableMemoryOrPickedMemory != NULL) {
+      np(redMemoryUnmap,
+        "context", vkfast->context,
+        "gpu", vkfast->gpu,
+        "mappableMemory", vkfast->presentPixelsCpuUpload_memory_and_array.handleAllocatedDedicatedOrMappableMemoryOrPickedMemory,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+    }
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_ARRAY,
+      "handle", vkfast->presentPixelsCpuUpload_memory_and_array.array.handle,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_MEMORY,
+      "handle", vkfast->presentPixelsCpuUpload_memory_and_array.handleAllocatedDedicatedOrMappableMemoryOrPickedMemory,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_CALLS,
+      "handle", vkfast->presentCopyCalls.handle,
+      "optionalHandle2", vkfast->presentCopyCalls.memory,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_CPU_SIGNAL,
+      "handle", vkfast->presentCpuSignal,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_GPU_SIGNAL,
+      "handle", vkfast->presentGpuSignalAcquire,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_GPU_SIGNAL,
+      "handle", vkfast->presentGpuSignalSubmit,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_PRESENT,
+      "handle", vkfast->present,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_SURFACE,
+      "handle", vkfast->surface,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+  }
+
+  vfContextCaptureEnd(context, optionalFile, optionalLine);
+
+  for (uint64_t i = 0; i < vkfast->cpuSignalsPoolCount; i += 1) {
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_CPU_SIGNAL,
+      "handle", vkfast->cpuSignalsPool[i],
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+  }
+  if (vkfast->cpuSignalsPool != NULL) {
+    red32MemoryFree(vkfast->cpuSignalsPool);
+  }
+
+  // NOTE(Constantine): Cached program pipelines that are still referenced are destroyed by their users, only the cache itself is freed.
+  for (uint64_t i = 0; i < vkfast->programPipelinesCacheCount; i += 1) {
+    red32MemoryFree(vkfast->programPipelinesCache[i].keyWords);
+  }
+  if (vkfast->programPipelinesCache != NULL) {
+    red32MemoryFree(vkfast->programPipelinesCache);
+  }
+  if (vkfast->programPipelinesCacheIndex.slots != NULL) {
+    red32MemoryFree(vkfast->programPipelinesCacheIndex.slots);
+  }
+  if (vkfast->tuningEntries != NULL) {
+    red32MemoryFree(vkfast->tuningEntries);
+  }
+  if (vkfast->tuningCacheFilepath != NULL) {
+    red32MemoryFree(vkfast->tuningCacheFilepath);
+  }
+  for (uint64_t i = 0; i < vkfast->bindingsSetsCount; i += 1) {
+    red32MemoryFree(vkfast->bindingsSets[i]->keyWords);
+    red32MemoryFree(vkfast->bindingsSets[i]);
+  }
+  if (vkfast->bindingsSets != NULL) {
+    red32MemoryFree(vkfast->bindingsSets);
+  }
+  if (vkfast->bindingsSetsIndex.slots != NULL) {
+    red32MemoryFree(vkfast->bindingsSetsIndex.slots);
+  }
+  for (uint64_t i = 0; i < vkfast->bindingsSetsPoolsCount; i += 1) {
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_STRUCTS_MEMORY,
+      "handle", vkfast->bindingsSetsPools[i].structsMemory,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+  }
+  if (vkfast->bindingsSetsPools != NULL) {
+    red32MemoryFree(vkfast->bindingsSetsPools);
+  }
+
+  vfInternalHeapsDestroyRetiredBlocks(vkfast, optionalFile, optionalLine);
+  vfInternalMutexDestroy(vkfast->heapsGrowMutex);
+  vkfast->heapsGrowMutex = NULL;
+  vfInternalMutexDestroy(vkfast->captureMutex);
+  vkfast->captureMutex = NULL;
+
+  np(red2DestroyHandle,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "handleType", RED_HANDLE_TYPE_ARRAY,
+    "handle", vkfast->memoryGpuVramForArrays_array.handle,
+    "optionalHandle2", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+  np(red2DestroyHandle,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "handleType", RED_HANDLE_TYPE_MEMORY,
+    "handle", vkfast->memoryGpuVramForArrays_memory,
+    "optionalHandle2", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+
+  if (vkfast->memoryCpuUpload_memory != NULL) {
+    np(redMemoryUnmap,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "mappableMemory", vkfast->memoryCpuUpload_memory,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+  }
+  np(red2DestroyHandle,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "handleType", RED_HANDLE_TYPE_ARRAY,
+    "handle", vkfast->memoryCpuUpload_array.handle,
+    "optionalHandle2", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+  np(red2DestroyHandle,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "handleType", RED_HANDLE_TYPE_MEMORY,
+    "handle", vkfast->memoryCpuUpload_memory,
+    "optionalHandle2", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+
+  if (vkfast->memoryCpuReadback_memory != NULL) {
+    np(redMemoryUnmap,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "mappableMemory", vkfast->memoryCpuReadback_memory,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+  }
+  np(red2DestroyHandle,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "handleType", RED_HANDLE_TYPE_ARRAY,
+    "handle", vkfast->memoryCpuReadback_array.handle,
+    "optionalHandle2", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+  np(red2DestroyHandle,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "handleType", RED_HANDLE_TYPE_MEMORY,
+    "handle", vkfast->memoryCpuReadback_memory,
+    "optionalHandle2", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+
+  if (vkfast->doNotDestroyRawContext == 0) {
+    np(redDestroyContext,
+      "context", vkfast->context,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+  }
+
+  if (vkfast->windowHandle != NULL && vkfast->windowHandleDoDestroy == 1) {
+    red32WindowDestroy(vkfast->windowHandle);
+  }
+
+  if (vkfast->doNotFreeHandle == 0) {
+    red32MemoryFree(vkfast);
+  }
+}
+
+GPU_API_PRE RedContext GPU_API_POST vfContextGetRaw(gpu_handle_context_t context, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  REDGPU_2_EXPECT(vkfast != NULL);
+
+  return vkfast->context;
+}
+
+GPU_API_PRE void GPU_API_POST vfContextResetAndInvalidateAllStorages(gpu_handle_context_t context, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  vkfast->memoryGpuVramForArrays_memory_suballocations_offset = 0;
+  vkfast->memoryCpuUpload_memory_suballocations_offset = 0;
+  vkfast->memoryCpuReadback_memory_suballocations_offset = 0;
+
+  vfInternalStoragesClear(vkfast);
+
+  // NOTE(Constantine): Grown blocks are kept and reused by the next heap growth, see vfInternalHeapGrow().
+  vfInternalMutexLock(vkfast->heapsGrowMutex);
+  for (int storageType = GPU_STORAGE_TYPE_GPU_ONLY; storageType <= GPU_STORAGE_TYPE_CPU_READBACK; storageType += 1) {
+    vf_heap_blocks_t * heap = &vkfast->heapsBlocks[storageType];
+    for (uint64_t i = 0; i < heap->retiredBlocksCount; i += 1) {
+      heap->retiredBlocks[i].memory_suballocations_offset = 0;
+    }
+  }
+  vfInternalMutexUnlock(vkfast->heapsGrowMutex);
+}
+
+GPU_API_PRE void GPU_API_POST vfContextHeapsAppendBlocks(gpu_handle_context_t context, const gpu_internal_memory_allocation_sizes_t * memory_allocation_sizes, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  RedHandleGpu gpu = vkfast->gpu;
+
+  REDGPU_2_EXPECTWG(memory_allocation_sizes != NULL);
+  REDGPU_2_EXPECTWG(!"Present pixels memory can't be appended" || memory_allocation_sizes->bytes_count_for_memory_present_pixels_type_cpu_upload == 0);
+
+  const uint64_t bytesCounts[4] = {
+    0,
+    memory_allocation_sizes->bytes_count_for_memory_storages_type_gpu_only,
+    memory_allocation_sizes->bytes_count_for_memory_storages_type_cpu_upload,
+    memory_allocation_sizes->bytes_count_for_memory_storages_type_cpu_readback,
+  };
+
+  // NOTE(Constantine): Excludes the bumps of vfStorageCreate() like a heap growth does, storages of the previous current blocks stay valid.
+  vfInternalHeapsGrowBegin(vkfast);
+  for (int storageType = GPU_STORAGE_TYPE_GPU_ONLY; storageType <= GPU_STORAGE_TYPE_CPU_READBACK; storageType += 1) {
+    if (bytesCounts[storageType] > 0) {
+      vfInternalHeapGrow(vkfast, (gpu_storage_type_t)storageType, bytesCounts[storageType], optionalFile, optionalLine);
+    }
+  }
+  vfInternalHeapsGrowEnd(vkfast);
+}
+
+#if defined(_WIN32)
+GPU_API_PRE void GPU_API_POST vfGetMainMonitorAreaRectangle(int * out4ints, const char * optionalFile, int optionalLine) {
+  // https://learn.microsoft.com/ru-ru/windows/win32/api/winuser/nf-winuser-monitorfrompoint
+  POINT point = {0};
+  HMONITOR hmonitor = MonitorFromPoint(point, MONITOR_DEFAULTTONEAREST);
+
+  // https://learn.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-getmonitorinfoa
+  MONITORINFO monitorInfo = {0};
+  monitorInfo.cbSize = sizeof(MONITORINFO);
+  REDGPU_2_EXPECT(GetMonitorInfoA(hmonitor, &monitorInfo));
+
+  out4ints[0] = monitorInfo.rcMonitor.left;
+  out4ints[1] = monitorInfo.rcMonitor.top;
+  out4ints[2] = monitorInfo.rcMonitor.right;
+  out4ints[3] = monitorInfo.rcMonitor.bottom;
+}
+#endif
+
+#if defined(__linux__) && !defined(__ANDROID__)
+GPU_API_PRE void GPU_API_POST vfGetMainMonitorAreaRectangle(int * out4ints, const char * optionalFile, int optionalLine) {
+  Display * display = XOpenDisplay(NULL);
+  REDGPU_2_EXPECT(display != NULL);
+
+  int screen = DefaultScreen(display);
+
+  out4ints[0] = 0;
+  out4ints[1] = 0;
+  out4ints[2] = (int)DisplayWidth(display, screen);
+  out4ints[3] = (int)DisplayHeight(display, screen);
+
+  XCloseDisplay(display);
+  display = NULL;
+}
+#endif
+
+// NOTE(Constantine):
+// Present pixels CPU upload memory is allocated on the first present rebuild and reallocated only when the window
+// grows past it. The previous one can still be read by the last present copy, so it's retired instead of destroyed.
+static void vfInternalPresentPixelsCpuUploadReserve(vf_handle_context_t * vkfast, const char * optionalFile, int optionalLine) {
+  RedHandleGpu gpu = vkfast->gpu;
+
+  const uint64_t presentPixelsBytesCount = sizeof(unsigned char) * 4 * (uint64_t)vkfast->screenHeight * (uint64_t)vkfast->screenWidth;
+  if (vkfast->presentPixelsCpuUpload_memory_allocation_size > 0 && vkfast->presentPixelsCpuUpload_memory_allocation_size < presentPixelsBytesCount) {
+    if (vkfast->presentPixelsCpuUpload_memory_and_array.array.handle != NULL) {
+      REDGPU_2_EXPECTWG(vkfast->presentRetiredPixelsCpuUpload_memory_and_array.array.handle == NULL);
+      vkfast->presentRetiredPixelsCpuUpload_memory_and_array = vkfast->presentPixelsCpuUpload_memory_and_array;
+      Red2Array zero = {0};
+      vkfast->presentPixelsCpuUpload_memory_and_array = zero;
+      vkfast->presentPixelsCpuUpload_void_ptr_original = NULL;
+    }
+    vkfast->presentPixelsCpuUpload_memory_allocation_size = presentPixelsBytesCount;
+  }
+
+  if (vkfast->presentPixelsCpuUpload_memory_and_array.array.handle == NULL && vkfast->presentPixelsCpuUpload_memory_allocation_size > 0) {
+    unsigned specificMemoryTypeCpuUpload = -1;
+    if (vkfast->specificMemoryTypesCpuUpload != -1) {
+      specificMemoryTypeCpuUpload = vkfast->specificMemoryTypesCpuUpload;
+    } else {
+      // NOTE(Constantine)(Aug 4, 2026):
+      // vkfast->specificMemoryTypesCpuUpload == -1 means that the user
+      // requested 0 bytes for memory storages of type cpu upload. If so,
+      // we can simply pick the first available upload memory type.
+      RedArray allMemoryTypes = {0};
+      allMemoryTypes.memoryTypesSupported = REDGPU_B32(1111,1111,1111,1111,1111,1111,1111,1111);
+      specificMemoryTypeCpuUpload = vfPickSpecificMemoryTypeCpuUpload(vkfast->gpuInfo, &allMemoryTypes);
+      REDGPU_2_EXPECTWG(specificMemoryTypeCpuUpload != -1);
+    }
+    np(red2CreateArray,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleName", "vkFast_vfInternalPresentPixelsCpuUploadReserve_presentPixelsCpuUpload_memory_and_array",
+      "type", RED_ARRAY_TYPE_ARRAY_RO,
+      "bytesCount", vkfast->presentPixelsCpuUpload_memory_allocation_size,
+      "structuredBufferElementBytesCount", 0,
+      "restrictToAccess", RED_ACCESS_BITFLAG_COPY_R,
+      "initialQueueFamilyIndex", vkfast->gpuInfo->queuesCount > 1 ? -1 : (unsigned)vkfast->gpuInfo->queuesFamilyIndex[vkfast->mainQueueFamilyIndex],
+      "maxAllowedOverallocationBytesCount", 0, // NOTE(Constantine): Intel UHD Graphics 730 on Windows 10 aligns CPU visible allocations to 64 bytes.
+      "dedicate", 0,
+      "mappable", 1,
+      "dedicateOrMappableMemoryTypeIndex", specificMemoryTypeCpuUpload,
+      "dedicateOrMappableMemoryBitflags", 0,
+      "suballocateFromMemoryOnFirstMatchPointersCount", 0,
+      "suballocateFromMemoryOnFirstMatchPointers", NULL,
+      "outArray", &vkfast->presentPixelsCpuUpload_memory_and_array,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    np(redMemoryMap,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "mappableMemory", vkfast->presentPixelsCpuUpload_memory_and_array.handleAllocatedDedicatedOrMappableMemoryOrPickedMemory,
+      "mappableMemoryBytesFirst", 0,
+      "mappableMemoryBytesCount", vkfast->presentPixelsCpuUpload_memory_and_array.array.memoryBytesCount,
+      "outVolatilePointer", &vkfast->presentPixelsCpuUpload_void_ptr_original,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    REDGPU_2_EXPECTWG(vkfast->presentPixelsCpuUpload_void_ptr_original != NULL);
+    REDGPU_2_EXPECTWG(0 == REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY((uint64_t)vkfast->presentPixelsCpuUpload_void_ptr_original, vkfast->gpuInfo->minMemoryAllocateBytesAlignment)); // NOTE(Constantine): Start address is guaranteed to be aligned.
+  }
+}
+
+static int vfInternalPresentHasRetired(vf_handle_context_t * vkfast) {
+  return vkfast->presentRetired != NULL || vkfast->presentRetiredGpuSignalAcquire != NULL || vkfast->presentRetiredPixelsCpuUpload_memory_and_array.array.handle != NULL;
+}
+
+// NOTE(Constantine):
+// Called by draws right after they waited presentCpuSignal. The first draw after a rebuild waits for the last
+// submission that used the retired resources, the second one for a submission queued after their last present.
+static void vfInternalPresentRetiredRelease(vf_handle_context_t * vkfast, const char * optionalFile, int optionalLine) {
+  if (vfInternalPresentHasRetired(vkfast) == 0) {
+    return;
+  }
+  vkfast->presentRetiredDrawsCount += 1;
+  if (vkfast->presentRetiredDrawsCount >= 2) {
+    vfInternalPresentRetiredDestroy(vkfast, optionalFile, optionalLine);
+  }
+}
+
+static int vfInternalRebuildPresentEx(gpu_handle_context_t context, RedPresentVsyncMode presentVsyncMode, int presentImagesCount, int fakeSurfaceWidth, int fakeSurfaceHeight, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  RedHandleGpu gpu = vkfast->gpu;
+
+  REDGPU_2_EXPECT(presentImagesCount == 2 || presentImagesCount == 3);
+
+  RedHandlePresent present = NULL;
+  RedHandleImage presentImages[3] = {0};
+
+  // NOTE(Constantine):
+  // The present is rebuilt without waiting for the GPU: the previous present is passed as the old present and retired
+  // with the acquire GPU signal, which a suboptimal image acquire can leave signaled. The present CPU and submit GPU
+  // signals are kept, draws wait for the CPU one before re-recording the present copy calls anyway. Only if a previous
+  // rebuild's resources are still retired, like in a resize storm without draws in between, their last use is waited for.
+  if (vfInternalPresentHasRetired(vkfast) == 1) {
+    if (vkfast->presentCpuSignal != NULL) {
+      np(redCpuSignalWait,
+        "context", vkfast->context,
+        "gpu", vkfast->gpu,
+        "cpuSignalsCount", 1,
+        "cpuSignals", &vkfast->presentCpuSignal,
+        "waitAll", 1,
+        "outStatuses", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+    }
+
+    // NOTE(Constantine): Present queue wait idle.
+    if (vkfast->surface != NULL) {
+      np(redQueuePresent,
+        "context", vkfast->context,
+        "gpu", vkfast->gpu,
+        "queue", vkfast->gpuInfo->queues[vkfast->presentQueueIndex],
+        "waitForAndUnsignalGpuSignalsCount", 0,
+        "waitForAndUnsignalGpuSignals", NULL,
+        "presentsCount", 0,
+        "presents", NULL,
+        "presentsImageIndex", NULL,
+        "outPresentsStatus", NULL,
+        "outStatuses", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+    }
+
+    vfInternalPresentRetiredDestroy(vkfast, optionalFile, optionalLine);
+  }
+  vkfast->presentRetiredGpuSignalAcquire = vkfast->presentGpuSignalAcquire;
+  vkfast->presentGpuSignalAcquire        = NULL;
+  vkfast->presentRetiredDrawsCount       = 0;
+
+  if (vkfast->surface == NULL && vkfast->windowHandle == NULL) {
+    // NOTE(Constantine): Headless, only the size dependent present resources are rebuilt for the fake surface size.
+    REDGPU_2_EXPECTWG(fakeSurfaceWidth > 0 && fakeSurfaceHeight > 0);
+    vkfast->screenWidth  = fakeSurfaceWidth;
+    vkfast->screenHeight = fakeSurfaceHeight;
+    vfInternalPresentPixelsCpuUploadReserve(vkfast, optionalFile, optionalLine);
+    int isRebuilded = 1;
+    return isRebuilded;
+  }
+
+  if (vkfast->surface == NULL) {
+    #if defined(_WIN32)
+    np(redCreateSurfaceWin32,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleName", "vkFast_vfInternalRebuildPresent_surface_win32",
+      "win32Hinstance", GetModuleHandle(NULL),
+      "win32Hwnd", vkfast->windowHandle,
+      "outSurface", &vkfast->surface,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    #endif
+    #if defined(__linux__) && !defined(__ANDROID__)
+    {
+      // NOTE(Constantine): this struct's layout is defined in redgpu_32.c file of REDGPU 2 SDK.
+      struct X11WindowData {
+        Display * display;
+        Window    window;
+        Atom      wmDeleteMessage;
+      };
+      struct X11WindowData * h = vkfast->windowHandle;
+
+      np(redCreateSurfaceXlibOrXcb,
+        "context", vkfast->context,
+        "gpu", vkfast->gpu,
+        "handleName", "vkFast_vfInternalRebuildPresent_surface_xlib",
+        "xlibDisplay", h->display,
+        "xlibWindow", h->window,
+        "xcbConnection", NULL,
+        "xcbWindow", 0,
+        "outSurface", &vkfast->surface,
+        "outStatuses", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
+    }
+    #endif
+    REDGPU_2_EXPECTWG(vkfast->surface != NULL);
+  }
+
+  RedQueueFamilyIndexGetSupportsPresentOnSurface queueFamilyIndexSupportsPresentOnSurface = {0};
+  queueFamilyIndexSupportsPresentOnSurface.surface                                     = vkfast->surface;
+  queueFamilyIndexSupportsPresentOnSurface.outQueueFamilyIndexSupportsPresentOnSurface = 0;
+  np(redQueueFamilyIndexGetSupportsPresent,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "queueFamilyIndex", vkfast->gpuInfo->queuesFamilyIndex[vkfast->presentQueueIndex],
+    "supportsPresentOnWin32", NULL,
+    "supportsPresentOnXlib", NULL,
+    "supportsPresentOnXcb", NULL,
+    "supportsPresentOnSurface", &queueFamilyIndexSupportsPresentOnSurface,
+    "outStatuses", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+  REDGPU_2_EXPECTWG(queueFamilyIndexSupportsPresentOnSurface.outQueueFamilyIndexSupportsPresentOnSurface == 1);
+
+  RedSurfaceCurrentPropertiesAndPresentLimits surfaceCurrentPropertiesAndPresentLimits = {0};
+  np(redSurfaceGetCurrentPropertiesAndPresentLimits,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "surface", vkfast->surface,
+    "outSurfaceCurrentPropertiesAndPresentLimits", &surfaceCurrentPropertiesAndPresentLimits,
+    "outStatuses", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+  // printf("[vkFast][DEBUG PRINTF] surfaceCurrentPropertiesAndPresentLimits.currentSurfaceWidth/Height: %d, %d\n", surfaceCurrentPropertiesAndPresentLimits.currentSurfaceWidth, surfaceCurrentPropertiesAndPresentLimits.currentSurfaceHeight);
+  if (surfaceCurrentPropertiesAndPresentLimits.currentSurfaceWidth == 0 || surfaceCurrentPropertiesAndPresentLimits.currentSurfaceHeight == 0) {
+    // NOTE(Constantine): The window is minimized or of unwatchable size (resized to 0 in width or 0 in height). Tested on Windows 10.
+    int isRebuilded = 0;
+    return isRebuilded;
+  }
+  if (surfaceCurrentPropertiesAndPresentLimits.currentSurfaceWidth != -1) {
+    vkfast->screenWidth = surfaceCurrentPropertiesAndPresentLimits.currentSurfaceWidth;
+  } else if (fakeSurfaceWidth > 0) {
+    vkfast->screenWidth = fakeSurfaceWidth;
+  }
+  if (surfaceCurrentPropertiesAndPresentLimits.currentSurfaceHeight != -1) {
+    vkfast->screenHeight = surfaceCurrentPropertiesAndPresentLimits.currentSurfaceHeight;
+  } else if (fakeSurfaceHeight > 0) {
+    vkfast->screenHeight = fakeSurfaceHeight;
+  }
+
+  np(redCreatePresent,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "queue", vkfast->gpuInfo->queues[vkfast->presentQueueIndex],
+    "handleName", "vkFast_vfInternalRebuildPresent_present",
+    "surface", vkfast->surface,
+    "imagesCount", presentImagesCount,
+    "imagesWidth", vkfast->screenWidth,
+    "imagesHeight", vkfast->screenHeight,
+    "imagesLayersCount", 1,
+    "imagesRestrictToAccess", RED_ACCESS_BITFLAG_COPY_W,
+    "transform", RED_SURFACE_TRANSFORM_BITFLAG_IDENTITY,
+    "compositeAlpha", RED_SURFACE_COMPOSITE_ALPHA_BITFLAG_OPAQUE,
+    "vsyncMode", presentVsyncMode,
+    "clipped", 0,
+    "discardAfterPresent", 1, // NOTE(Constantine): Optimization.
+    "oldPresent", vkfast->present,
+    "outPresent", &present,
+    "outImages", presentImages,
+    "outTextures", NULL,
+    "outStatuses", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+  REDGPU_2_EXPECTWG(present != NULL);
+
+  // NOTE(Constantine): The old present is retired, it's destroyed once its images can't be in use anymore.
+  vkfast->presentRetired = vkfast->present;
+
+  vfInternalPresentPixelsCpuUploadReserve(vkfast, optionalFile, optionalLine);
+
+  vkfast->surface;
+  vkfast->present = present;
+  vkfast->presentImages[0] = presentImages[0];
+  vkfast->presentImages[1] = presentImages[1];
+  vkfast->presentImages[2] = presentImages[2];
+  vkfast->presentCpuSignal;
+  vkfast->presentGpuSignalAcquire;
+  vkfast->presentGpuSignalSubmit;
+  vkfast->presentCopyCalls;
+  vkfast->presentVsyncMode;
+  vkfast->presentImagesCount;
+
+  int isRebuilded = 1;
+  return isRebuilded;
+}
+
+static int vfInternalRebuildPresent(gpu_handle_context_t context, RedPresentVsyncMode presentVsyncMode, int presentImagesCount, const char * optionalFile, int optionalLine) {
+  return vfInternalRebuildPresentEx(context, presentVsyncMode, presentImagesCount, 0, 0, optionalFile, optionalLine);
+}
+
+GPU_API_PRE int GPU_API_POST vfWindowFullscreenEx(gpu_handle_context_t context, void * optional_external_window_handle, const char * window_title, int screen_width, int screen_height, unsigned draw_queue_index, RedPresentVsyncMode present_vsync_mode, int present_images_count, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+  
+  RedHandleGpu gpu = vkfast->gpu;
+
+  REDGPU_2_EXPECTWG(draw_queue_index < vkfast->gpuInfo->queuesCount);
+
+  void * window_handle = optional_external_window_handle;
+  int window_handle_do_destroy = 0;
+  if (window_handle == NULL) {
+    window_handle = red32WindowCreate(window_title);
+    window_handle_do_destroy = 1;
+  }
+  REDGPU_2_EXPECTWG(window_handle != NULL);
+
+  vkfast->windowHandle = window_handle;
+  vkfast->windowHandleDoDestroy = window_handle_do_destroy;
+  vkfast->screenWidth = screen_width;
+  vkfast->screenHeight = screen_height;
+  vkfast->presentQueueIndex = draw_queue_index;
+  vkfast->presentVsyncMode = present_vsync_mode;
+  vkfast->presentImagesCount = present_images_count;
+
+  return vfInternalRebuildPresent(context, present_vsync_mode, present_images_count, optionalFile, optionalLine);
+}
+
+GPU_API_PRE int GPU_API_POST vfWindowFullscreen(gpu_handle_context_t context, void * optional_external_window_handle, const char * window_title, int screen_width, int screen_height, unsigned draw_queue_index, RedPresentVsyncMode present_vsync_mode, const char * optionalFile, int optionalLine) {
+  return vfWindowFullscreenEx(context, optional_external_window_handle, window_title, screen_width, screen_height, draw_queue_index, present_vsync_mode, 3, optionalFile, optionalLine);
+}
+
+GPU_API_PRE int GPU_API_POST vfWindowLoop(gpu_handle_context_t context) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+  return red32WindowLoop(vkfast->windowHandle);
+}
+
+#if defined(_WIN32)
+GPU_API_PRE int GPU_API_POST vfWindowIsMinimized(gpu_handle_context_t context) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  return (int)IsIconic((HWND)vkfast->windowHandle);
+}
+#endif
+
+#if defined(__linux__) && !defined(__ANDROID__)
+GPU_API_PRE int GPU_API_POST vfWindowIsMinimized(gpu_handle_context_t context) {
+  return 0; // NOTE(Constantine): There's no simple X11 code to check for this, so just assume the window is always visible.
+}
+#endif
+
+GPU_API_PRE void GPU_API_POST vfWindowGetSize(gpu_handle_context_t context, int * out_window_width, int * out_window_height) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  if (out_window_width  != NULL) { out_window_width[0]  = vkfast->screenWidth;  }
+  if (out_window_height != NULL) { out_window_height[0] = vkfast->screenHeight; }
+}
+
+// NOTE(Constantine): Sleeps until wakeNanoseconds of vfInternalGetTimeNanoseconds(), yielding instead of sleeping only for the last tens of microseconds.
+static void vfInternalSleepUntilNanoseconds(vf_handle_context_t * vkfast, uint64_t wakeNanoseconds) {
+#if defined(_WIN32)
+  const uint64_t yieldTailNanoseconds = 100000;
+  if (vkfast->pacingTimer == NULL) {
+    #ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+    #define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+    #endif
+    vkfast->pacingTimer = (void *)CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    if (vkfast->pacingTimer == NULL) {
+      // NOTE(Constantine): Windows before 10 1803, the timer is only as precise as timeBeginPeriod() allows.
+      vkfast->pacingTimer = (void *)CreateWaitableTimerExW(NULL, NULL, 0, TIMER_ALL_ACCESS);
+    }
+  }
+  const uint64_t now = vfInternalGetTimeNanoseconds();
+  if (vkfast->pacingTimer != NULL && wakeNanoseconds > now + yieldTailNanoseconds) {
+    LARGE_INTEGER dueTime = {0};
+    dueTime.QuadPart = -(LONGLONG)((wakeNanoseconds - now - yieldTailNanoseconds) / 100); // NOTE(Constantine): Relative, in 100 nanoseconds.
+    if (SetWaitableTimer((HANDLE)vkfast->pacingTimer, &dueTime, 0, NULL, NULL, FALSE)) {
+      WaitForSingleObject((HANDLE)vkfast->pacingTimer, INFINITE);
+    }
+  }
+  while (vfInternalGetTimeNanoseconds() < wakeNanoseconds) {
+    SwitchToThread();
+  }
+#else
+  const uint64_t yieldTailNanoseconds = 50000;
+  if (wakeNanoseconds > yieldTailNanoseconds) {
+    const uint64_t sleepUntil = wakeNanoseconds - yieldTailNanoseconds;
+    struct timespec ts = {0};
+    ts.tv_sec  = (time_t)(sleepUntil / 1000000000ULL);
+    ts.tv_nsec = (long)(sleepUntil % 1000000000ULL);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) != 0) {} // NOTE(Constantine): Restarted on signals.
+  }
+  while (vfInternalGetTimeNanoseconds() < wakeNanoseconds) {
+    sched_yield();
+  }
+#endif
+}
+
+static vf_frame_timestamps_t * vfInternalFrameTimestampsCurrent(vf_handle_context_t * vkfast) {
+  return &vkfast->framesTimestamps[vkfast->framesCount % VF_FRAMES_TIMESTAMPS_COUNT];
+}
+
+// NOTE(Constantine): Called right after redQueuePresent() of a drawn frame returned.
+static void vfInternalFramePresented(vf_handle_context_t * vkfast) {
+  vf_frame_timestamps_t * frame = vfInternalFrameTimestampsCurrent(vkfast);
+  frame->frameIndex         = vkfast->framesCount;
+  frame->presentNanoseconds = vfInternalGetTimeNanoseconds();
+  if (frame->pacingWokeNanoseconds != 0 && frame->presentNanoseconds > frame->pacingWokeNanoseconds) {
+    const uint64_t work = frame->presentNanoseconds - frame->pacingWokeNanoseconds;
+    if (work > vkfast->pacingWorkNanosecondsEstimate) {
+      vkfast->pacingWorkNanosecondsEstimate = work;
+    } else {
+      vkfast->pacingWorkNanosecondsEstimate -= (vkfast->pacingWorkNanosecondsEstimate - work) / 16;
+    }
+  }
+  vkfast->framesCount += 1;
+  vf_frame_timestamps_t zero = {0};
+  vfInternalFrameTimestampsCurrent(vkfast)[0] = zero;
+}
+
+GPU_API_PRE void GPU_API_POST vfWindowSetPacing(gpu_handle_context_t context, const gpu_present_pacing_t * pacing, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  vkfast->pacingFrameNanoseconds        = pacing != NULL ? pacing->frame_nanoseconds : 0;
+  vkfast->pacingMarginNanoseconds       = pacing != NULL && pacing->safety_margin_nanoseconds != 0 ? pacing->safety_margin_nanoseconds : 1000000;
+  vkfast->pacingDeadlineNanoseconds     = 0;
+  vkfast->pacingWorkNanosecondsEstimate = 0;
+}
+
+GPU_API_PRE void GPU_API_POST vfWindowPacingWait(gpu_handle_context_t context, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  vf_frame_timestamps_t * frame = vfInternalFrameTimestampsCurrent(vkfast);
+  if (vkfast->pacingFrameNanoseconds == 0) {
+    frame->pacingSleepNanoseconds = 0;
+    frame->pacingWakeNanoseconds  = 0;
+    frame->pacingWokeNanoseconds  = 0;
+    return;
+  }
+
+  const uint64_t now      = vfInternalGetTimeNanoseconds();
+  const uint64_t work     = vkfast->pacingWorkNanosecondsEstimate + vkfast->pacingMarginNanoseconds;
+  uint64_t       deadline = vkfast->pacingDeadlineNanoseconds + vkfast->pacingFrameNanoseconds;
+  if (vkfast->pacingDeadlineNanoseconds == 0 || deadline < now + work) {
+    // NOTE(Constantine): The first paced frame, or the last one was late, the cadence restarts from now instead of catching up.
+    deadline = now + work;
+  }
+  vkfast->pacingDeadlineNanoseconds = deadline;
+
+  const uint64_t wake = deadline - work;
+  if (wake > now) {
+    vfInternalSleepUntilNanoseconds(vkfast, wake);
+  }
+  const uint64_t woke = vfInternalGetTimeNanoseconds();
+  frame->pacingSleepNanoseconds = woke - now;
+  frame->pacingWakeNanoseconds  = wake;
+  frame->pacingWokeNanoseconds  = woke;
+}
+
+GPU_API_PRE uint64_t GPU_API_POST vfWindowGetFrameLatencies(gpu_handle_context_t context, uint64_t out_frame_latencies_capacity, gpu_frame_latency_t * out_frame_latencies) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  uint64_t count = vkfast->framesCount < GPU_FRAME_LATENCIES_MAX_COUNT ? vkfast->framesCount : GPU_FRAME_LATENCIES_MAX_COUNT;
+  if (count > out_frame_latencies_capacity) {
+    count = out_frame_latencies_capacity;
+  }
+  for (uint64_t i = 0; i < count; i += 1) {
+    const vf_frame_timestamps_t * frame = &vkfast->framesTimestamps[(vkfast->framesCount - count + i) % VF_FRAMES_TIMESTAMPS_COUNT];
+    gpu_frame_latency_t latency = {0};
+    latency.frame_index                       = frame->frameIndex;
+    latency.acquire_to_present_nanoseconds    = frame->presentNanoseconds - frame->acquireNanoseconds;
+    latency.cpu_submit_to_present_nanoseconds = frame->presentNanoseconds - frame->submitNanoseconds;
+    latency.input_to_present_nanoseconds      = frame->pacingWokeNanoseconds != 0 ? frame->presentNanoseconds - frame->pacingWokeNanoseconds : 0;
+    latency.pacing_sleep_nanoseconds          = frame->pacingSleepNanoseconds;
+    latency.pacing_wake_error_nanoseconds     = frame->pacingWakeNanoseconds != 0 ? (int64_t)frame->pacingWokeNanoseconds - (int64_t)frame->pacingWakeNanoseconds : 0;
+    out_frame_latencies[i] = latency;
+  }
+  return count;
+}
+
+GPU_API_PRE int GPU_API_POST vfWindowRebuildPresent(gpu_handle_context_t context, int optional_fake_surface_width, int optional_fake_surface_height, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  const int presentImagesCount = vkfast->presentImagesCount != 0 ? vkfast->presentImagesCount : 3;
+  return vfInternalRebuildPresentEx(context, vkfast->presentVsyncMode, presentImagesCount, optional_fake_surface_width, optional_fake_surface_height, optionalFile, optionalLine);
+}
+
+GPU_API_PRE unsigned GPU_API_POST vfWindowAdd(gpu_handle_context_t context, void * optional_external_window_handle, const char * window_title, int screen_width, int screen_height, RedPresentVsyncMode present_vsync_mode, int present_images_count, uint64_t present_pixels_bytes_count, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  RedHandleGpu gpu = vkfast->gpu;
+
+  REDGPU_2_EXPECTWG(!"Call vfWindowFullscreen() for the window 0 first" || vkfast->surface != NULL);
+  REDGPU_2_EXPECTWG(vkfast->windowsCount + 1 < GPU_WINDOWS_MAX_COUNT);
+
+  // NOTE(Constantine): Same as vfeBanzaiAllocateExtraMemory(), the window is a context that shares the raw context and only has present resources.
+  // To deinit
+  vf_handle_context_t * window = (vf_handle_context_t *)red32MemoryCalloc(sizeof(vf_handle_context_t));
+  REDGPU_2_EXPECTWG(window != NULL);
+  window->doNotDestroyRawContext = 1;
+  window->doNotFreeHandle        = 0;
+  window->context                = vkfast->context;
+  window->gpuIndex               = vkfast->gpuIndex;
+  window->presentQueueIndex      = vkfast->presentQueueIndex;
+  gpu_internal_memory_allocation_sizes_t windowAllocationSizes = {0};
+  windowAllocationSizes.bytes_count_for_memory_present_pixels_type_cpu_upload = present_pixels_bytes_count > 0 ? present_pixels_bytes_count : vkfast->presentPixelsCpuUpload_memory_allocation_size;
+  gpu_context_optional_parameters_t windowParameters = {0};
+  windowParameters.internal_memory_allocation_sizes             = &windowAllocationSizes;
+  windowParameters.optional_pointer_to_custom_vf_handle_context = (void *)window;
+  gpu_handle_context_t windowContext = vfContextInit(vkfast->isDebugMode, &windowParameters, optionalFile, optionalLine);
+
+  vfWindowFullscreenEx(windowContext, optional_external_window_handle, window_title, screen_width, screen_height, vkfast->presentQueueIndex, present_vsync_mode, present_images_count, optionalFile, optionalLine);
+
+  // To free
+  vf_handle_context_t ** windows = (vf_handle_context_t **)red32MemoryCalloc(sizeof(vf_handle_context_t *) * (vkfast->windowsCount + 1));
+  REDGPU_2_EXPECTWG(windows != NULL);
+  for (uint64_t i = 0; i < vkfast->windowsCount; i += 1) {
+    windows[i] = vkfast->windows[i];
+  }
+  windows[vkfast->windowsCount] = (vf_handle_context_t *)(void *)windowContext;
+  if (vkfast->windows != NULL) {
+    red32MemoryFree(vkfast->windows);
+  }
+  vkfast->windows       = windows;
+  vkfast->windowsCount += 1;
+
+  return (unsigned)vkfast->windowsCount;
+}
+
+GPU_API_PRE gpu_handle_context_t GPU_API_POST vfWindowGetContext(gpu_handle_context_t context, unsigned window_index) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  REDGPU_2_EXPECT(window_index <= vkfast->windowsCount);
+
+  if (window_index == 0) {
+    return context;
+  }
+  return (gpu_handle_context_t)(void *)vkfast->windows[window_index - 1];
+}
+
+GPU_API_PRE void GPU_API_POST vfExit(int exit_code) {
+  red32Exit(exit_code);
+}
+
+GPU_API_PRE void GPU_API_POST vfStorageCreate(gpu_handle_context_t context, const gpu_storage_info_t * storage_info, gpu_storage_t * out_storage, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  RedHandleGpu gpu = vkfast->gpu;
+
+  REDGPU_2_EXPECTWG(storage_info->storage_type != GPU_STORAGE_TYPE_NONE);
+
+  uint64_t             alignment         = 0;
+  RedStructMemberArray arrayRangeInfo    = {0};
+  void *               mappedVoidPointer = NULL;
+  {
+    // NOTE(Constantine): Storage range mapping.
+    // NOTE(Constantine): Storages can be created from multiple threads concurrently, the suballocations offset is bumped with a compare-exchange loop.
+    // Growable heaps bump lock-free too, only a storage that doesn't fit takes heapsGrowMutex to grow the heap, see vfInternalHeapsGrowBegin().
+
+    if (storage_info->storage_type == GPU_STORAGE_TYPE_GPU_ONLY) {
+      alignment = vkfast->gpuInfo->minArrayRORWStructMemberRangeBytesAlignment;
+    } else if (storage_info->storage_type == GPU_STORAGE_TYPE_CPU_UPLOAD || storage_info->storage_type == GPU_STORAGE_TYPE_CPU_READBACK) {
+      alignment = vkfast->gpuInfo->minMemoryAllocateBytesAlignment; // NOTE(Constantine): Can't be placed into a struct, so picking only one alignment.
+    } else {
+#if defined(__linux__) || defined(__MINGW32__)
+      REDGPU_2_EXPECT(!"[vkFast Internal] Unreachable enum value.");
+#else
+      REDGPU_2_EXPECT(!"[vkFast Internal][" __FUNCTION__ "] Unreachable enum value.");
+#endif
+    }
+
+    const uint64_t bytesCount = storage_info->bytes_count + REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(storage_info->bytes_count, alignment);
+
+    vf_heap_block_t current    = {0};
+    uint64_t        bytesFirst = 0;
+    int             isBumped   = 0;
+    if (vkfast->heapsGrowBlockBytesCount == 0) {
+      vfInternalHeapGetCurrentBlock(vkfast, storage_info->storage_type, &current);
+      isBumped = vfInternalHeapBump(vfInternalHeapGetSuballocationsOffset(vkfast, storage_info->storage_type), current.array.memoryBytesCount, alignment, bytesCount, &bytesFirst);
+    } else {
+      vfInternalAtomicAddUint64(&vkfast->heapsBumpersCount, 1);
+      if (vfInternalAtomicLoadUint64(&vkfast->heapsGrowing) == 0) {
+        vfInternalHeapGetCurrentBlock(vkfast, storage_info->storage_type, &current);
+        isBumped = vfInternalHeapBump(vfInternalHeapGetSuballocationsOffset(vkfast, storage_info->storage_type), current.array.memoryBytesCount, alignment, bytesCount, &bytesFirst);
+      }
+      vfInternalAtomicAddUint64(&vkfast->heapsBumpersCount, (uint64_t)-1);
+
+      if (isBumped == 0) {
+        vfInternalHeapsGrowBegin(vkfast);
+        // NOTE(Constantine): Another thread may have grown the heap while this one waited.
+        vfInternalHeapGetCurrentBlock(vkfast, storage_info->storage_type, &current);
+        isBumped = vfInternalHeapBump(vfInternalHeapGetSuballocationsOffset(vkfast, storage_info->storage_type), current.array.memoryBytesCount, alignment, bytesCount, &bytesFirst);
+        if (isBumped == 0) {
+          // NOTE(Constantine): Growing the heap if the storage doesn't fit into its current block, storages never span blocks.
+          vfInternalHeapGrow(vkfast, storage_info->storage_type, bytesCount, optionalFile, optionalLine);
+          vfInternalHeapGetCurrentBlock(vkfast, storage_info->storage_type, &current);
+          isBumped = vfInternalHeapBump(vfInternalHeapGetSuballocationsOffset(vkfast, storage_info->storage_type), current.array.memoryBytesCount, alignment, bytesCount, &bytesFirst);
+        }
+        vfInternalHeapsGrowEnd(vkfast);
+      }
+    }
+
+    REDGPU_2_EXPECTWG(isBumped == 1);
+
+    arrayRangeInfo.array                = current.array.handle;
+    arrayRangeInfo.arrayRangeBytesFirst = bytesFirst;
+    arrayRangeInfo.arrayRangeBytesCount = bytesCount;
+
+    // NOTE(Constantine): Pointer mapping.
+
+    if (storage_info->storage_type == GPU_STORAGE_TYPE_CPU_UPLOAD || storage_info->storage_type == GPU_STORAGE_TYPE_CPU_READBACK) {
+      mappedVoidPointer = (void *)((uint8_t *)current.mapped_void_ptr_original + bytesFirst); // NOTE(Constantine): Start address is guaranteed to be aligned.
+    }
+  }
+
+  //NOTE(Constantine)(Jun 30, 2026): The line below was here when the vkFast API couldn't bind limited storage and pointer ranges. Now we can.
+  //REDGPU_2_EXPECTWG(arrayRangeInfo.arrayRangeBytesCount <= vkfast->context->gpus[vkfast->gpuIndex].maxArrayRORWStructMemberRangeBytesCount);
+
+  // To free
+  vf_handle_t * handle = (vf_handle_t *)red32MemoryCalloc(sizeof(vf_handle_t));
+  REDGPU_2_EXPECTWG(handle != NULL);
+
+  // Filling
+  vf_handle_t;
+  vf_handle_storage_t;
+  handle->vkfast                 = vkfast;
+  handle->handle_id              = VF_HANDLE_ID_STORAGE;
+  handle->storage.info           = storage_info[0];
+  handle->storage.arrayRangeInfo = arrayRangeInfo;
+
+  // Filling
+  gpu_storage_t;
+  out_storage->id              = (uint64_t)(void *)handle;
+  out_storage->info            = storage_info[0];
+  out_storage->alignment       = alignment;
+  out_storage->mapped_void_ptr = mappedVoidPointer;
+
+  vfInternalStoragesAdd(vkfast, handle, optionalFile, optionalLine);
+  vfInternalCaptureStorageCreate(vkfast, out_storage, optionalLine);
+}
+
+GPU_API_PRE void GPU_API_POST vfStorageGetRaw(gpu_handle_context_t context, uint64_t storage_id, RedStructMemberArray * out_storage_raw, const char * optionalFile, int optionalLine) {
+  vf_handle_t * storage = (vf_handle_t *)(void *)storage_id;
+  vf_handle_context_t * vkfast = storage->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(storage->handle_id == VF_HANDLE_ID_STORAGE);
+
+  out_storage_raw[0] = storage->storage.arrayRangeInfo;
+}
+
+// NOTE(Constantine):
+// REDGPU handles are the Vulkan handles they wrap, the same ones that gpu_context_ex2_parameters_t takes, so what REDGPU doesn't
+// expose is called with Vulkan directly. Procedures are looked up in the Vulkan loader that REDGPU has already loaded, NULL if it isn't found.
+static PFN_vkVoidFunction vfInternalVkGetLoaderProcAddr(const char * name) {
+  PFN_vkVoidFunction procedure = NULL;
+#if defined(_WIN32)
+  HMODULE loader = GetModuleHandleA("vulkan-1.dll");
+  if (loader == NULL) {
+    return NULL;
+  }
+  procedure = (PFN_vkVoidFunction)(void *)GetProcAddress(loader, name);
+#else
+  void * loader = dlopen("libvulkan.so.1", RTLD_NOW | RTLD_NOLOAD);
+  if (loader == NULL) {
+    return NULL;
+  }
+  procedure = (PFN_vkVoidFunction)dlsym(loader, name);
+  dlclose(loader); // NOTE(Constantine): Only drops the reference of RTLD_NOLOAD, REDGPU keeps the loader loaded.
+#endif
+  return procedure;
+}
+
+// NOTE(Constantine):
+// Imports bytesCount bytes at hostPointer with VK_EXT_external_memory_host into a new array bound at the start of a new memory of a
+// host coherent type. Returns 0 if the device can't import it: vkGetDeviceProcAddr() returns NULL for the commands of device extensions
+// that aren't enabled, hostPointer isn't aligned to minImportedHostPointerAlignment, or no importable memory type is host coherent.
+static int vfInternalHostPointerImport(vf_handle_context_t * vkfast, void * hostPointer, uint64_t bytesCount, RedHandleArray * outArray, RedHandleMemory * outMemory, uint64_t * outArrayBytesCount) {
+  PFN_vkGetDeviceProcAddr            getDeviceProcAddr           = (PFN_vkGetDeviceProcAddr)vfInternalVkGetLoaderProcAddr("vkGetDeviceProcAddr");
+  PFN_vkGetPhysicalDeviceProperties2 getPhysicalDeviceProperties2 = (PFN_vkGetPhysicalDeviceProperties2)vfInternalVkGetLoaderProcAddr("vkGetPhysicalDeviceProperties2");
+  if (getDeviceProcAddr == NULL || getPhysicalDeviceProperties2 == NULL) {
+    return 0;
+  }
+
+  const VkDevice device = (VkDevice)vkfast->gpu;
+  PFN_vkGetMemoryHostPointerPropertiesEXT getMemoryHostPointerProperties = (PFN_vkGetMemoryHostPointerPropertiesEXT)getDeviceProcAddr(device, "vkGetMemoryHostPointerPropertiesEXT");
+  PFN_vkCreateBuffer                      createBuffer                   = (PFN_vkCreateBuffer)getDeviceProcAddr(device, "vkCreateBuffer");
+  PFN_vkDestroyBuffer                     destroyBuffer                  = (PFN_vkDestroyBuffer)getDeviceProcAddr(device, "vkDestroyBuffer");
+  PFN_vkGetBufferMemoryRequirements       getBufferMemoryRequirements    = (PFN_vkGetBufferMemoryRequirements)getDeviceProcAddr(device, "vkGetBufferMemoryRequirements");
+  PFN_vkAllocateMemory                    allocateMemory                 = (PFN_vkAllocateMemory)getDeviceProcAddr(device, "vkAllocateMemory");
+  PFN_vkFreeMemory                        freeMemory                     = (PFN_vkFreeMemory)getDeviceProcAddr(device, "vkFreeMemory");
+  PFN_vkBindBufferMemory                  bindBufferMemory               = (PFN_vkBindBufferMemory)getDeviceProcAddr(device, "vkBindBufferMemory");
+  if (getMemoryHostPointerProperties == NULL || createBuffer == NULL || destroyBuffer == NULL || getBufferMemoryRequirements == NULL || allocateMemory == NULL || freeMemory == NULL || bindBufferMemory == NULL) {
+    return 0;
+  }
+
+  VkPhysicalDeviceExternalMemoryHostPropertiesEXT hostProperties = {0};
+  hostProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT;
+  VkPhysicalDeviceProperties2 properties = {0};
+  properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+  properties.pNext = &hostProperties;
+  getPhysicalDeviceProperties2((VkPhysicalDevice)vkfast->gpuInfo->gpuDevice, &properties);
+  const uint64_t alignment = hostProperties.minImportedHostPointerAlignment;
+  if (alignment == 0 || ((uint64_t)hostPointer % alignment) != 0) {
+    return 0;
+  }
+  // NOTE(Constantine): Imported sizes must be aligned too. The tail up to the alignment is in the same host page as the last byte, since
+  // minImportedHostPointerAlignment is at most the page size in practice, so importing it doesn't reach past the caller's allocation.
+  const uint64_t importBytesCount = bytesCount + REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(bytesCount, alignment);
+
+  VkMemoryHostPointerPropertiesEXT hostPointerProperties = {0};
+  hostPointerProperties.sType = VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT;
+  if (getMemoryHostPointerProperties(device, VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT, hostPointer, &hostPointerProperties) != VK_SUCCESS) {
+    return 0;
+  }
+
+  // NOTE(Constantine): Shared by all queue families like the heap arrays are, see vfInternalHeapBlockCreate().
+  uint32_t familiesCount = 0;
+  uint32_t families[64]  = {0};
+  for (unsigned i = 0; i < vkfast->gpuInfo->queuesCount && familiesCount < 64; i += 1) {
+    int isNew = 1;
+    for (uint32_t j = 0; j < familiesCount; j += 1) {
+      isNew = families[j] == vkfast->gpuInfo->queuesFamilyIndex[i] ? 0 : isNew;
+    }
+    if (isNew == 1) {
+      families[familiesCount] = vkfast->gpuInfo->queuesFamilyIndex[i];
+      familiesCount += 1;
+    }
   }
-  if (gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].status == RED_STATUS_SUCCESS) {
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxWidth >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxHeight >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxDepth >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxLevelsCount >= 12);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxLayersCount >= 1);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxBytesCount >= 2147483648);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].status >= RED_STATUS_SUCCESS);
+
+  VkExternalMemoryBufferCreateInfo externalInfo = {0};
+  externalInfo.sType       = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+  externalInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+  VkBufferCreateInfo bufferInfo = {0};
+  bufferInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+  bufferInfo.pNext                 = &externalInfo;
+  bufferInfo.size                  = importBytesCount;
+  bufferInfo.usage                 = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+  bufferInfo.sharingMode           = familiesCount > 1 ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE;
+  bufferInfo.queueFamilyIndexCount = familiesCount > 1 ? familiesCount : 0;
+  bufferInfo.pQueueFamilyIndices   = familiesCount > 1 ? families : NULL;
+  // To destroy
+  VkBuffer buffer = VK_NULL_HANDLE;
+  if (createBuffer(device, &bufferInfo, NULL, &buffer) != VK_SUCCESS) {
+    return 0;
   }
-  if (gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].status == RED_STATUS_SUCCESS) {
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxWidth >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxHeight >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxDepth >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxLevelsCount >= 12);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxLayersCount >= 1);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxBytesCount >= 2147483648);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3D[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].status >= RED_STATUS_SUCCESS);
+
+  VkMemoryRequirements requirements = {0};
+  getBufferMemoryRequirements(device, buffer, &requirements);
+  unsigned memoryTypeIndex = -1;
+  for (unsigned i = 0; i < vkfast->gpuInfo->memoryTypesCount && i < 32; i += 1) {
+    const RedMemoryType * type = &vkfast->gpuInfo->memoryTypes[i];
+    if ((hostPointerProperties.memoryTypeBits & requirements.memoryTypeBits & (1u << i)) != 0 && type->isCpuMappable == 1 && type->isCpuCoherent == 1) {
+      memoryTypeIndex = i;
+      break;
+    }
   }
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_UINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_SINT].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_SINT].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_SINT].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_SINT].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_SINT].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_SINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_8_SINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_SINT].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_SINT].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_SINT].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_SINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_SINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_UINT].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_UINT].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_UINT].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_UINT].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_UINT].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_UINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_UINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_SINT].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_SINT].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_SINT].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_SINT].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_SINT].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_SINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_SINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_FLOAT].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_FLOAT].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_FLOAT].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_FLOAT].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_FLOAT].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_FLOAT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_16_FLOAT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_UINT].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_UINT].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_UINT].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_UINT].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_UINT].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_UINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_UINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_SINT].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_SINT].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_SINT].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_SINT].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_SINT].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_SINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_SINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_FLOAT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_16_16_16_16_FLOAT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_UINT].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_UINT].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_UINT].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_UINT].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_UINT].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_UINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_UINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_SINT].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_SINT].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_SINT].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_SINT].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_SINT].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_SINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_SINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_FLOAT].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_FLOAT].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_FLOAT].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_FLOAT].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_FLOAT].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_FLOAT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_R_32_FLOAT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_UINT].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_UINT].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_UINT].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_UINT].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_UINT].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_UINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_UINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_SINT].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_SINT].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_SINT].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_SINT].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_SINT].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_SINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_SINT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_SINT].status >= RED_STATUS_SUCCESS);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxDimensions.maxWidth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxDimensions.maxHeight >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxDimensions.maxDepth >= 2048);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxLevelsCount >= 12);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxLayersCount >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_FLOAT].maxBytesCount >= 2147483648);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_RGBA_32_32_32_32_FLOAT].status >= RED_STATUS_SUCCESS);
-  if (gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].status == RED_STATUS_SUCCESS) {
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxDimensions.maxWidth >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxDimensions.maxHeight >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxDimensions.maxDepth >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxLevelsCount >= 12);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxLayersCount >= 1);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].maxBytesCount >= 2147483648);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].status >= RED_STATUS_SUCCESS);
+  if (memoryTypeIndex == -1 || requirements.size > importBytesCount) {
+    destroyBuffer(device, buffer, NULL);
+    return 0;
   }
-  if (gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].status == RED_STATUS_SUCCESS) {
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxWidth >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxHeight >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].maxDimensions.maxDepth >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].maxLevelsCount >= 12);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].maxLayersCount >= 1);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].maxBytesCount >= 2147483648);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT].status >= RED_STATUS_SUCCESS);
+
+  VkImportMemoryHostPointerInfoEXT importInfo = {0};
+  importInfo.sType        = VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT;
+  importInfo.handleType   = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+  importInfo.pHostPointer = hostPointer;
+  VkMemoryAllocateInfo allocateInfo = {0};
+  allocateInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+  allocateInfo.pNext           = &importInfo;
+  allocateInfo.allocationSize  = importBytesCount;
+  allocateInfo.memoryTypeIndex = memoryTypeIndex;
+  // To free
+  VkDeviceMemory memory = VK_NULL_HANDLE;
+  if (allocateMemory(device, &allocateInfo, NULL, &memory) != VK_SUCCESS) {
+    destroyBuffer(device, buffer, NULL);
+    return 0;
   }
-  if (gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].status == RED_STATUS_SUCCESS) {
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxWidth >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxHeight >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxDimensions.maxDepth >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxLevelsCount >= 12);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxLayersCount >= 1);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].maxBytesCount >= 2147483648);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].status >= RED_STATUS_SUCCESS);
+  if (bindBufferMemory(device, buffer, memory, 0) != VK_SUCCESS) {
+    destroyBuffer(device, buffer, NULL);
+    freeMemory(device, memory, NULL);
+    return 0;
+  }
+
+  outArray[0]           = (RedHandleArray)buffer;
+  outMemory[0]          = (RedHandleMemory)memory;
+  outArrayBytesCount[0] = importBytesCount;
+  return 1;
+}
+
+// NOTE(Constantine):
+// Imports host_pointer without a copy if the device has the VK_EXT_external_memory_host extension enabled, for example on the
+// external_VkDevice of gpu_context_ex2_parameters_t, and host_pointer is aligned to its minImportedHostPointerAlignment, page-aligned
+// allocations are. The imported memory is host coherent, so vfStorageCpuUploadFlush() and vfStorageCpuReadbackInvalidate() do nothing.
+// Otherwise falls back to a storage of vfStorageCreate(): a CPU upload storage gets a copy of host_pointer contents, later writes to
+// host_pointer aren't seen by the GPU, and the GPU writes of a CPU readback storage are only seen through out_storage->mapped_void_ptr.
+GPU_API_PRE RedBool32 GPU_API_POST vfStorageCreateFromHostPointer(gpu_handle_context_t context, const gpu_storage_info_t * storage_info, void * host_pointer, gpu_storage_t * out_storage, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  RedHandleGpu gpu = vkfast->gpu;
+
+  REDGPU_2_EXPECTWG(host_pointer != NULL);
+  REDGPU_2_EXPECTWG(storage_info->storage_type == GPU_STORAGE_TYPE_CPU_UPLOAD || storage_info->storage_type == GPU_STORAGE_TYPE_CPU_READBACK);
+
+  RedHandleArray  array           = NULL;
+  RedHandleMemory memory          = NULL;
+  uint64_t        arrayBytesCount = 0;
+  if (vfInternalHostPointerImport(vkfast, host_pointer, storage_info->bytes_count, &array, &memory, &arrayBytesCount) == 0) {
+    vfStorageCreate(context, storage_info, out_storage, optionalFile, optionalLine);
+    if (storage_info->storage_type == GPU_STORAGE_TYPE_CPU_UPLOAD) {
+      red32MemoryCopy(out_storage->mapped_void_ptr, host_pointer, storage_info->bytes_count);
+      vfStorageCpuUploadFlush(context, out_storage->id, optionalFile, optionalLine);
+    }
+    return 0;
+  }
+
+  RedStructMemberArray arrayRangeInfo = {0};
+  arrayRangeInfo.array                = array;
+  arrayRangeInfo.arrayRangeBytesFirst = 0;
+  arrayRangeInfo.arrayRangeBytesCount = arrayBytesCount;
+
+  // To free
+  vf_handle_t * handle = (vf_handle_t *)red32MemoryCalloc(sizeof(vf_handle_t));
+  REDGPU_2_EXPECTWG(handle != NULL);
+
+  // Filling
+  vf_handle_t;
+  vf_handle_storage_t;
+  handle->vkfast                    = vkfast;
+  handle->handle_id                 = VF_HANDLE_ID_STORAGE;
+  handle->storage.info              = storage_info[0];
+  handle->storage.arrayRangeInfo    = arrayRangeInfo;
+  handle->storage.hostImportMemory  = memory;
+  handle->storage.hostImportPointer = host_pointer;
+
+  // Filling
+  gpu_storage_t;
+  out_storage->id              = (uint64_t)(void *)handle;
+  out_storage->info            = storage_info[0];
+  out_storage->alignment       = vkfast->gpuInfo->minMemoryAllocateBytesAlignment;
+  out_storage->mapped_void_ptr = host_pointer;
+
+  vfInternalStoragesAdd(vkfast, handle, optionalFile, optionalLine);
+  vfInternalCaptureStorageCreate(vkfast, out_storage, optionalLine);
+  return 1;
+}
+
+GPU_API_PRE void GPU_API_POST vfStorageCpuUploadFlush(gpu_handle_context_t context, uint64_t storage_id, const char * optionalFile, int optionalLine) {
+  vf_handle_t * storage = (vf_handle_t *)(void *)storage_id;
+  vf_handle_context_t * vkfast = vfInternalStorageGetHeapContext(storage);
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(storage->handle_id == VF_HANDLE_ID_STORAGE);
+  REDGPU_2_EXPECTWG(storage->storage.info.storage_type == GPU_STORAGE_TYPE_CPU_UPLOAD);
+
+  if (vkfast->specificMemoryTypesCpuUploadIsCoherent == 1 || storage->storage.hostImportMemory != NULL) {
+    return;
   }
-  if (gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].status == RED_STATUS_SUCCESS) {
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxWidth >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxHeight >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxDimensions.maxDepth >= 2048);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxLevelsCount >= 12);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxLayersCount >= 1);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportedMultisampleCounts >= (RED_MULTISAMPLE_COUNT_BITFLAG_1));
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].maxBytesCount >= 2147483648);
-    REDGPU_2_EXPECTWG(gpuInfo->imageFormatsLimitsImageDimensions3DWithTextureDimensions2DAnd2DLayered[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].status >= RED_STATUS_SUCCESS);
+
+  vf_heap_block_t block = {0};
+  REDGPU_2_EXPECTWG(vfInternalHeapFindBlock(vkfast, GPU_STORAGE_TYPE_CPU_UPLOAD, storage->storage.arrayRangeInfo.array, &block) == 1);
+
+  // NOTE(Constantine): CPU storages arrays are bound at the start of their memory, so array ranges are memory ranges.
+  vfInternalMemoryNonCoherentFlushOrInvalidate(vkfast, 0, block.memory, block.array.memoryBytesCount, storage->storage.arrayRangeInfo.arrayRangeBytesFirst, storage->storage.arrayRangeInfo.arrayRangeBytesCount, optionalFile, optionalLine);
+}
+
+GPU_API_PRE void GPU_API_POST vfStorageCpuReadbackInvalidate(gpu_handle_context_t context, uint64_t storage_id, const char * optionalFile, int optionalLine) {
+  vf_handle_t * storage = (vf_handle_t *)(void *)storage_id;
+  vf_handle_context_t * vkfast = vfInternalStorageGetHeapContext(storage);
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(storage->handle_id == VF_HANDLE_ID_STORAGE);
+  REDGPU_2_EXPECTWG(storage->storage.info.storage_type == GPU_STORAGE_TYPE_CPU_READBACK);
+
+  if (vkfast->specificMemoryTypesCpuReadbackIsCoherent == 1 || storage->storage.hostImportMemory != NULL) {
+    return;
   }
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsTextureROFilteringLinear >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT_TO_FLOAT_0_1].supportsOutputColorBlend >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsTextureROFilteringLinear >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_UINT].supportsOutputColorBlend >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsTextureROFilteringLinear >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_8_SINT].supportsOutputColorBlend >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsTextureROFilteringLinear >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsOutputColorBlend >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsTextureROFilteringLinear >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT].supportsOutputColorBlend >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsTextureROFilteringLinear >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_SINT].supportsOutputColorBlend >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsTextureROFilteringLinear >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_8_8_8_8_UINT_TO_FLOAT_0_1_GAMMA_CORRECTED].supportsOutputColorBlend >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsTextureROFilteringLinear >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_PRESENT_BGRA_8_8_8_8_UINT_TO_FLOAT_0_1].supportsOutputColorBlend >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsTextureROFilteringLinear >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_UINT].supportsOutputColorBlend >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsTextureROFilteringLinear >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_SINT].supportsOutputColorBlend >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsTextureROFilteringLinear >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_16_FLOAT].supportsOutputColorBlend >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsTextureROFilteringLinear >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_UINT].supportsOutputColorBlend >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsTextureROFilteringLinear >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_SINT].supportsOutputColorBlend >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsTextureROFilteringLinear >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_16_16_16_16_FLOAT].supportsOutputColorBlend >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsTextureROFilteringLinear >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsTextureRWAtomics >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_UINT].supportsOutputColorBlend >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsTextureROFilteringLinear >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsTextureRWAtomics >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_SINT].supportsOutputColorBlend >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsTextureROFilteringLinear >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsTextureRWAtomics >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_R_32_FLOAT].supportsOutputColorBlend >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsTextureROFilteringLinear >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_UINT].supportsOutputColorBlend >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsTextureROFilteringLinear >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_SINT].supportsOutputColorBlend >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsOutputDepthStencil >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsOutputColor >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsTextureROFilteringLinear >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsTextureRWAtomics >= 0); // Not supported on Adreno 735
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_RGBA_32_32_32_32_FLOAT].supportsOutputColorBlend >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsOutputDepthStencil >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsOutputColor >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsTextureROFilteringLinear >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_16_UINT_TO_FLOAT_0_1].supportsOutputColorBlend >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsTextureRW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsOutputDepthStencil >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsOutputColor >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsTextureROFilteringLinear >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT].supportsOutputColorBlend >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsTextureRW >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsOutputDepthStencil >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsOutputColor >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsTextureROFilteringLinear >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_24_UINT_TO_FLOAT_0_1_STENCIL_8_UINT].supportsOutputColorBlend >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsCopyR >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsCopyW >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsTextureRO >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsTextureRW >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsOutputDepthStencil >= 1);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsOutputColor >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsTextureROFilteringLinear >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsTextureRWAtomics >= 0);
-  REDGPU_2_EXPECTWG(gpuInfo->imageFormatsFeatures[RED_FORMAT_DEPTH_32_FLOAT_STENCIL_8_UINT].supportsOutputColorBlend >= 0);
+
+  vf_heap_block_t block = {0};
+  REDGPU_2_EXPECTWG(vfInternalHeapFindBlock(vkfast, GPU_STORAGE_TYPE_CPU_READBACK, storage->storage.arrayRangeInfo.array, &block) == 1);
+
+  vfInternalMemoryNonCoherentFlushOrInvalidate(vkfast, 1, block.memory, block.array.memoryBytesCount, storage->storage.arrayRangeInfo.arrayRangeBytesFirst, storage->storage.arrayRangeInfo.arrayRangeBytesCount, optionalFile, optionalLine);
+}
+
+GPU_API_PRE void GPU_API_POST vfStorageExport(gpu_handle_context_t context, uint64_t storage_id, gpu_storage_export_t * out_storage_export, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+  vf_handle_t * storage = (vf_handle_t *)(void *)storage_id;
+
+  RedHandleGpu gpu = vkfast->gpu;
+
+  REDGPU_2_EXPECTWG(storage->handle_id == VF_HANDLE_ID_STORAGE);
+  REDGPU_2_EXPECTWG(!"Storage isn't of this context" || storage->vkfast == vkfast);
+  REDGPU_2_EXPECTWG(!"Storages imported from host pointers can't be exported" || storage->storage.hostImportMemory == NULL);
+
+  if (storage->storage.share == NULL) {
+    // To free
+    vf_storage_share_t * share = (vf_storage_share_t *)red32MemoryCalloc(sizeof(vf_storage_share_t));
+    REDGPU_2_EXPECTWG(share != NULL);
+    share->referencesCount = 1;
+    share->heapVkfast      = vkfast;
+    share->ownerVkfast     = vkfast;
+    storage->storage.share = share;
+  }
+
+  // Filling
+  gpu_storage_export_t storageExport = {0};
+  storageExport.storage_id  = storage_id;
+  storageExport.raw_context = vkfast->context;
+  storageExport.gpu_index   = vkfast->gpuIndex;
+  storageExport.info        = storage->storage.info;
+  out_storage_export[0] = storageExport;
+}
+
+GPU_API_PRE void GPU_API_POST vfStorageImport(gpu_handle_context_t context, const gpu_storage_export_t * storage_export, gpu_storage_t * out_storage, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+  vf_handle_t * exported = (vf_handle_t *)(void *)storage_export->storage_id;
+
+  RedHandleGpu gpu = vkfast->gpu;
+
+  REDGPU_2_EXPECTWG(exported->handle_id == VF_HANDLE_ID_STORAGE);
+  REDGPU_2_EXPECTWG(!"Storage wasn't exported" || exported->storage.share != NULL);
+  REDGPU_2_EXPECTWG(!"Storages can only be shared between contexts with the same raw context" || storage_export->raw_context == vkfast->context);
+  REDGPU_2_EXPECTWG(!"Storages can only be shared between contexts on the same GPU" || storage_export->gpu_index == vkfast->gpuIndex);
+
+  vf_storage_share_t * share = exported->storage.share;
+  const gpu_storage_type_t storageType = exported->storage.info.storage_type;
+
+  // NOTE(Constantine): CPU storages arrays are bound at the start of their memory, so the mapped pointer is at the array range offset.
+  void * mappedVoidPointer = NULL;
+  if (storageType == GPU_STORAGE_TYPE_CPU_UPLOAD || storageType == GPU_STORAGE_TYPE_CPU_READBACK) {
+    vf_heap_block_t block = {0};
+    REDGPU_2_EXPECTWG(vfInternalHeapFindBlock(share->heapVkfast, storageType, exported->storage.arrayRangeInfo.array, &block) == 1);
+    mappedVoidPointer = (void *)((uint8_t *)block.mapped_void_ptr_original + exported->storage.arrayRangeInfo.arrayRangeBytesFirst);
+  }
+
+  vfInternalSpinLock(&share->lock);
+  share->referencesCount += 1;
+  vfInternalSpinUnlock(&share->lock);
+
+  // To free
+  vf_handle_t * handle = (vf_handle_t *)red32MemoryCalloc(sizeof(vf_handle_t));
+  REDGPU_2_EXPECTWG(handle != NULL);
+
+  // Filling
+  vf_handle_t;
+  vf_handle_storage_t;
+  handle->vkfast                 = vkfast;
+  handle->handle_id              = VF_HANDLE_ID_STORAGE;
+  handle->storage.info           = exported->storage.info;
+  handle->storage.arrayRangeInfo = exported->storage.arrayRangeInfo;
+  handle->storage.share          = share;
+
+  // Filling
+  gpu_storage_t;
+  out_storage->id              = (uint64_t)(void *)handle;
+  out_storage->info            = exported->storage.info;
+  out_storage->alignment       = storageType == GPU_STORAGE_TYPE_GPU_ONLY ? vkfast->gpuInfo->minArrayRORWStructMemberRangeBytesAlignment : vkfast->gpuInfo->minMemoryAllocateBytesAlignment;
+  out_storage->mapped_void_ptr = mappedVoidPointer;
 }
 
-static gpu_handle_context_t vfInternalContextInit(int enable_debug_mode, unsigned gpu_index, const gpu_context_optional_parameters_t * optional_parameters, const gpu_context_ex2_parameters_t * optional_ex2_parameters, const gpu_context_ex3_parameters_t * optional_ex3_parameters, const char * optionalFile, int optionalLine) {
-  if (enable_debug_mode) {
-    vfInternalPrint("[vkFast][Debug] In case of an error, email me (Constantine) at: iamvfx@gmail.com" "\n");
+static void vfInternalBatchStorageOwnershipTransfer(gpu_handle_context_t context, uint64_t batch_id, uint64_t storage_id, int isAcquire, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+  vf_handle_t * storage = (vf_handle_t *)(void *)storage_id;
+
+  RedHandleGpu gpu = vkfast->gpu;
+
+  REDGPU_2_EXPECTWG(storage->handle_id == VF_HANDLE_ID_STORAGE);
+  REDGPU_2_EXPECTWG(!"Storage wasn't exported" || storage->storage.share != NULL);
+  REDGPU_2_EXPECTWG(!"Storage isn't of this context" || storage->vkfast == vkfast);
+
+  vf_storage_share_t * share = storage->storage.share;
+
+  vfInternalSpinLock(&share->lock);
+  const vf_handle_context_t * ownerVkfast = share->ownerVkfast;
+  share->ownerVkfast = isAcquire == 1 ? vkfast : NULL;
+  vfInternalSpinUnlock(&share->lock);
+  if (isAcquire == 1) {
+    REDGPU_2_EXPECTWG(!"Storage wasn't released by its owner" || ownerVkfast == NULL);
+  } else {
+    REDGPU_2_EXPECTWG(!"Storage isn't owned by this context" || ownerVkfast == vkfast);
   }
 
-  void * optional_pointer_to_custom_vf_handle_context = 0;
+  // NOTE(Constantine): No queue family release and acquire barriers are recorded, none are needed: with more than one queue, heap arrays are
+  // shared by all queue families (see vfInternalHeapBlockCreate()), with one queue every context submits to its family. Checked in case
+  // that changes.
+  REDGPU_2_EXPECTWG(!"Contexts of a shared storage must submit to the same queue family" || vkfast->gpuInfo->queuesCount > 1 || vkfast->gpuInfo->queuesFamilyIndex[vkfast->mainQueueFamilyIndex] == share->heapVkfast->gpuInfo->queuesFamilyIndex[share->heapVkfast->mainQueueFamilyIndex]);
 
-  if (optional_parameters != NULL) {
-    optional_pointer_to_custom_vf_handle_context = optional_parameters->optional_pointer_to_custom_vf_handle_context;
+  if (batch_id != 0) {
+    // NOTE(Constantine): The GPU thread wait orders the submissions, the barrier makes the writes of the releasing batch visible to the acquiring one.
+    vfBatchBarrierMemory(context, batch_id, optionalFile, optionalLine);
   }
+}
 
-  vf_handle_context_t * vkfast = (vf_handle_context_t *)optional_pointer_to_custom_vf_handle_context;
-  if (vkfast == NULL) {
+GPU_API_PRE void GPU_API_POST vfBatchStorageOwnershipRelease(gpu_handle_context_t context, uint64_t batch_id, uint64_t storage_id, const char * optionalFile, int optionalLine) {
+  vfInternalBatchStorageOwnershipTransfer(context, batch_id, storage_id, 0, optionalFile, optionalLine);
+}
+
+GPU_API_PRE void GPU_API_POST vfBatchStorageOwnershipAcquire(gpu_handle_context_t context, uint64_t batch_id, uint64_t storage_id, const char * optionalFile, int optionalLine) {
+  vfInternalBatchStorageOwnershipTransfer(context, batch_id, storage_id, 1, optionalFile, optionalLine);
+}
+
+#define VF_SPIRV_MAGIC                     0x07230203
+#define VF_SPIRV_OP_SPEC_CONSTANT_TRUE     48
+#define VF_SPIRV_OP_SPEC_CONSTANT_FALSE    49
+#define VF_SPIRV_OP_SPEC_CONSTANT          50
+#define VF_SPIRV_OP_DECORATE               71
+#define VF_SPIRV_DECORATION_SPEC_ID        1
+
+static int vfInternalSpirvHasSpecializationConstants(const void * ir, uint64_t irBytesCount) {
+  const uint32_t * words      = (const uint32_t *)ir;
+  const uint64_t   wordsCount = irBytesCount / 4;
+  if (wordsCount < 5 || words[0] != VF_SPIRV_MAGIC) {
+    return 0;
+  }
+  for (uint64_t i = 5; i < wordsCount;) {
+    const uint32_t opcode          = words[i] & 0xFFFF;
+    const uint32_t instructionSize = words[i] >> 16;
+    if (instructionSize == 0) {
+      return 0;
+    }
+    if (opcode == VF_SPIRV_OP_DECORATE && instructionSize >= 4 && i + 3 < wordsCount && words[i + 2] == VF_SPIRV_DECORATION_SPEC_ID) {
+      return 1;
+    }
+    i += instructionSize;
+  }
+  return 0;
+}
+
+// NOTE(Constantine):
+// REDGPU does not take specialization info at procedure creation, so the default values of OpSpecConstant* in a copy of the program binary are
+// replaced instead. The driver sees them as constants of the module and folds them the same way.
+static void vfInternalSpirvSpecialize(uint32_t * words, uint64_t wordsCount, unsigned constantsCount, const gpu_program_specialization_constant_t * constants, const char * optionalFile, int optionalLine) {
+  REDGPU_2_EXPECTFL(wordsCount >= 5 && words[0] == VF_SPIRV_MAGIC);
+
+  // To free
+  uint32_t * resultIds = (uint32_t *)red32MemoryCalloc(sizeof(uint32_t) * constantsCount);
+  REDGPU_2_EXPECTFL(resultIds != NULL);
+
+  for (uint64_t i = 5; i < wordsCount;) {
+    const uint32_t opcode          = words[i] & 0xFFFF;
+    const uint32_t instructionSize = words[i] >> 16;
+    REDGPU_2_EXPECTFL(instructionSize > 0 && i + instructionSize <= wordsCount);
+    if (opcode == VF_SPIRV_OP_DECORATE && instructionSize >= 4 && words[i + 2] == VF_SPIRV_DECORATION_SPEC_ID) {
+      for (unsigned j = 0; j < constantsCount; j += 1) {
+        if (constants[j].constant_id == words[i + 3]) {
+          resultIds[j] = words[i + 1];
+        }
+      }
+    }
+    i += instructionSize;
+  }
+  for (unsigned j = 0; j < constantsCount; j += 1) {
+    REDGPU_2_EXPECTFL(resultIds[j] != 0 && "Specialization constant id is not in the program");
+  }
+
+  for (uint64_t i = 5; i < wordsCount;) {
+    const uint32_t opcode          = words[i] & 0xFFFF;
+    const uint32_t instructionSize = words[i] >> 16;
+    if ((opcode == VF_SPIRV_OP_SPEC_CONSTANT_TRUE || opcode == VF_SPIRV_OP_SPEC_CONSTANT_FALSE || opcode == VF_SPIRV_OP_SPEC_CONSTANT) && instructionSize >= 3) {
+      for (unsigned j = 0; j < constantsCount; j += 1) {
+        if (resultIds[j] != words[i + 2]) {
+          continue;
+        }
+        if (opcode == VF_SPIRV_OP_SPEC_CONSTANT) {
+          REDGPU_2_EXPECTFL(instructionSize == 4 || instructionSize == 5);
+          words[i + 3] = (uint32_t)(constants[j].value & 0xFFFFFFFF);
+          if (instructionSize == 5) {
+            words[i + 4] = (uint32_t)(constants[j].value >> 32);
+          }
+        } else {
+          words[i] = (instructionSize << 16) | (constants[j].value != 0 ? VF_SPIRV_OP_SPEC_CONSTANT_TRUE : VF_SPIRV_OP_SPEC_CONSTANT_FALSE);
+        }
+      }
+    }
+    i += instructionSize;
+  }
+
+  red32MemoryFree(resultIds);
+}
+
+static uint64_t vfInternalHashWords(const uint64_t * words, uint64_t wordsCount) {
+  uint64_t hash = 14695981039346656037ULL;
+  for (uint64_t i = 0; i < wordsCount; i += 1) {
+    hash = (hash ^ words[i]) * 1099511628211ULL;
+  }
+  return hash;
+}
+
+GPU_API_PRE uint64_t GPU_API_POST vfProgramCreateFromBinaryCompute(gpu_handle_context_t context, const gpu_program_info_t * program_info, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  RedHandleGpu gpu = vkfast->gpu;
+
+  // To destroy
+  RedHandleGpuCode gpuCode = NULL;
+  np(redCreateGpuCode,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "handleName", program_info->optional_debug_name,
+    "irBytesCount", program_info->program_binary_bytes_count,
+    "ir", (const void *)program_info->program_binary,
+    "outGpuCode", &gpuCode,
+    "outStatuses", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+  REDGPU_2_EXPECTWG(gpuCode != NULL);
+
+  // To free
+  vf_handle_t * handle = (vf_handle_t *)red32MemoryCalloc(sizeof(vf_handle_t));
+  REDGPU_2_EXPECTWG(handle != NULL);
+
+  vf_handle_t;
+  vf_handle_gpu_code_t;
+  handle->vkfast              = vkfast;
+  handle->handle_id           = VF_HANDLE_ID_GPU_CODE;
+  handle->gpuCode.info        = program_info[0];
+  handle->gpuCode.gpuCodeType = VF_GPU_CODE_TYPE_COMPUTE;
+  handle->gpuCode.gpuCode     = gpuCode;
+
+  if (vfInternalSpirvHasSpecializationConstants(program_info->program_binary, program_info->program_binary_bytes_count) == 1) {
     // To free
-    vkfast = (vf_handle_context_t *)red32MemoryCalloc(sizeof(vf_handle_context_t));
-    REDGPU_2_EXPECT(vkfast != NULL);
-    vkfast->gpuIndex = gpu_index;
+    handle->gpuCode.specializableIr = red32MemoryCalloc(program_info->program_binary_bytes_count);
+    REDGPU_2_EXPECTWG(handle->gpuCode.specializableIr != NULL);
+    red32MemoryCopy(handle->gpuCode.specializableIr, program_info->program_binary, program_info->program_binary_bytes_count);
+    handle->gpuCode.specializableIrBytesCount = program_info->program_binary_bytes_count;
   }
 
-  uint64_t internalMemoryAllocationSizeGpuVramArrays           = VKFAST_DEFAULT_MEMORY_ALLOCATION_SIZE_GPU_ONLY_512MB;
-  uint64_t internalMemoryAllocationSizeCpuVisible              = VKFAST_DEFAULT_MEMORY_ALLOCATION_SIZE_CPU_UPLOAD_512MB;
-  uint64_t internalMemoryAllocationSizeCpuReadback             = VKFAST_DEFAULT_MEMORY_ALLOCATION_SIZE_CPU_READBACK_512MB;
-  uint64_t internalMemoryAllocationSizeCpuVisiblePresentPixels = VKFAST_DEFAULT_MEMORY_ALLOCATION_SIZE_PRESENT_PIXELS_CPU_UPLOAD_288MB;
-  if (optional_parameters != NULL) {
-    if (optional_parameters->internal_memory_allocation_sizes != NULL) {
-      internalMemoryAllocationSizeGpuVramArrays           = optional_parameters->internal_memory_allocation_sizes->bytes_count_for_memory_storages_type_gpu_only;
-      internalMemoryAllocationSizeCpuVisible              = optional_parameters->internal_memory_allocation_sizes->bytes_count_for_memory_storages_type_cpu_upload;
-      internalMemoryAllocationSizeCpuReadback             = optional_parameters->internal_memory_allocation_sizes->bytes_count_for_memory_storages_type_cpu_readback;
-      internalMemoryAllocationSizeCpuVisiblePresentPixels = optional_parameters->internal_memory_allocation_sizes->bytes_count_for_memory_present_pixels_type_cpu_upload;
+  const uint64_t captureWords[1] = {(uint64_t)(void *)handle};
+  vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_PROGRAM_CREATE_COMPUTE, optionalLine, 1, captureWords, program_info->program_binary_bytes_count, program_info->program_binary);
+
+  return (uint64_t)(void *)handle;
+}
+
+GPU_API_PRE uint64_t GPU_API_POST vfProgramPipelineCreateCompute(gpu_handle_context_t context, const gpu_program_pipeline_compute_info_t * program_pipeline_compute_info, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+  
+  RedHandleGpu gpu = vkfast->gpu;
+
+  vf_handle_t * gpuCodeCompute = (vf_handle_t *)(void *)program_pipeline_compute_info->compute_program;
+  REDGPU_2_EXPECTWG(gpuCodeCompute->handle_id == VF_HANDLE_ID_GPU_CODE);
+  REDGPU_2_EXPECTWG(gpuCodeCompute->gpuCode.gpuCodeType == VF_GPU_CODE_TYPE_COMPUTE);
+
+  if (program_pipeline_compute_info->variables_bytes_count > 0) {
+    for (unsigned i = 0; i < program_pipeline_compute_info->struct_members_count; i += 1) {
+      REDGPU_2_EXPECTWG(program_pipeline_compute_info->variables_slot != program_pipeline_compute_info->struct_members[i].slot);
     }
   }
 
-  RedContext context = vkfast->context;
-  if (context == NULL) {
-    RedContextOptionalSettingsContextFromVk            contextFromVk            = {0};
-    RedContextOptionalSettings0                        optionalSettings0        = {0};
-    RedContextOptionalSettingsCreateContextPerformance createContextPerformance = {0};
-    void * optionalSettings = NULL;
-    if (optional_ex2_parameters != NULL) {
-      contextFromVk.settings             = RED_CONTEXT_OPTIONAL_SETTINGS_CONTEXT_FROM_VK;
-      contextFromVk.next                 = NULL;
-      contextFromVk.instance             = optional_ex2_parameters->external_VkInstance;
-      contextFromVk.physicalDevicesCount = 1;
-      contextFromVk.physicalDevices      = (uint64_t *)&optional_ex2_parameters->external_VkPhysicalDevice;
-      contextFromVk.devices              = (uint64_t *)&optional_ex2_parameters->external_VkDevice;
+  Red2ProcedureParametersDeclaration parameters = {0};
+  parameters.variablesSlot            = program_pipeline_compute_info->variables_slot;
+  parameters.variablesVisibleToStages = program_pipeline_compute_info->variables_bytes_count == 0 ? 0 : RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+  parameters.variablesBytesCount      = program_pipeline_compute_info->variables_bytes_count;
+  parameters.structsDeclarationsCount = program_pipeline_compute_info->struct_members_count == 0 ? 0 : 1;
+  parameters.structsDeclarations[0].structDeclarationMembersCount        = program_pipeline_compute_info->struct_members_count;
+  parameters.structsDeclarations[0].structDeclarationMembers             = program_pipeline_compute_info->struct_members;
+  parameters.structsDeclarations[0].structDeclarationMembersArrayROCount = 0;
+  parameters.structsDeclarations[0].structDeclarationMembersArrayRO      = NULL;
 
-      optionalSettings0.settings                      = RED_CONTEXT_OPTIONAL_SETTINGS_0;
-      optionalSettings0.next                          = optional_ex2_parameters->external_VkInstance == 0 ? NULL : &contextFromVk;
-      optionalSettings0.skipCheckingContextLayers     = 0;
-      optionalSettings0.skipCheckingContextExtensions = 0;
-      optionalSettings0.gpusExposeOnlyOneQueue        = optional_ex2_parameters->exposeOnlyOneQueue;
+  // To destroy
+  Red2ProcedureParametersAndDeclarations procedureParameters = {0};
+  np(red2CreateProcedureParameters,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "handleName", program_pipeline_compute_info->optional_debug_name,
+    "procedureParametersDeclaration", &parameters,
+    "outProcedureParametersAndDeclarations", &procedureParameters,
+    "outStatuses", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+  REDGPU_2_EXPECTWG(procedureParameters.procedureParameters != NULL);
+
+  // To destroy
+  RedHandleGpuCode specializedGpuCode = NULL;
+  if (program_pipeline_compute_info->specialization_constants_count > 0) {
+    REDGPU_2_EXPECTWG(gpuCodeCompute->gpuCode.specializableIr != NULL && "Program has no specialization constants");
+
+    // To free
+    uint32_t * ir = (uint32_t *)red32MemoryCalloc(gpuCodeCompute->gpuCode.specializableIrBytesCount);
+    REDGPU_2_EXPECTWG(ir != NULL);
+    red32MemoryCopy(ir, gpuCodeCompute->gpuCode.specializableIr, gpuCodeCompute->gpuCode.specializableIrBytesCount);
+    vfInternalSpirvSpecialize(ir, gpuCodeCompute->gpuCode.specializableIrBytesCount / 4, program_pipeline_compute_info->specialization_constants_count, program_pipeline_compute_info->specialization_constants, optionalFile, optionalLine);
+
+    np(redCreateGpuCode,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleName", program_pipeline_compute_info->optional_debug_name,
+      "irBytesCount", gpuCodeCompute->gpuCode.specializableIrBytesCount,
+      "ir", (const void *)ir,
+      "outGpuCode", &specializedGpuCode,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    REDGPU_2_EXPECTWG(specializedGpuCode != NULL);
+
+    red32MemoryFree(ir);
+  }
+
+  // To destroy
+  RedHandleProcedure procedure = NULL;
+  np(redCreateProcedureCompute,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "handleName", program_pipeline_compute_info->optional_debug_name,
+    "procedureCache", NULL,
+    "procedureParameters", procedureParameters.procedureParameters,
+    "gpuCodeMainProcedureName", "main",
+    "gpuCode", specializedGpuCode != NULL ? specializedGpuCode : gpuCodeCompute->gpuCode.gpuCode,
+    "outProcedure", &procedure,
+    "outStatuses", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+  REDGPU_2_EXPECTWG(procedure != NULL);
+
+  // To free
+  vf_handle_t * handle = (vf_handle_t *)red32MemoryCalloc(sizeof(vf_handle_t));
+  REDGPU_2_EXPECTWG(handle != NULL);
+
+  // Filling
+  vf_handle_t;
+  vf_handle_procedure_t;
+  handle->vkfast                        = vkfast;
+  handle->handle_id                     = VF_HANDLE_ID_PROCEDURE;
+  handle->procedure.infoCompute         = program_pipeline_compute_info[0];
+  handle->procedure.procedureType       = VF_PROCEDURE_TYPE_COMPUTE;
+  handle->procedure.procedureParameters = procedureParameters;
+  handle->procedure.procedure           = procedure;
+  handle->procedure.specializedGpuCode  = specializedGpuCode;
+  handle->procedure.isCached            = 0;
+  handle->procedure.cachedKeyHash       = 0;
+
+  if (vkfast->captureFile != NULL) {
+    const unsigned membersCount   = program_pipeline_compute_info->struct_members_count;
+    const unsigned constantsCount = program_pipeline_compute_info->specialization_constants_count;
+    // To free
+    uint64_t * captureWords = (uint64_t *)red32MemoryCalloc(sizeof(uint64_t) * (5 + 4 * membersCount + 1 + 2 * constantsCount));
+    REDGPU_2_EXPECTWG(captureWords != NULL);
+    captureWords[0] = (uint64_t)(void *)handle;
+    captureWords[1] = program_pipeline_compute_info->compute_program;
+    captureWords[2] = program_pipeline_compute_info->variables_slot;
+    captureWords[3] = program_pipeline_compute_info->variables_bytes_count;
+    captureWords[4] = membersCount;
+    for (unsigned i = 0; i < membersCount; i += 1) {
+      captureWords[5 + 4 * i + 0] = program_pipeline_compute_info->struct_members[i].slot;
+      captureWords[5 + 4 * i + 1] = program_pipeline_compute_info->struct_members[i].type;
+      captureWords[5 + 4 * i + 2] = program_pipeline_compute_info->struct_members[i].count;
+      captureWords[5 + 4 * i + 3] = program_pipeline_compute_info->struct_members[i].visibleToStages;
+    }
+    captureWords[5 + 4 * membersCount] = constantsCount;
+    for (unsigned i = 0; i < constantsCount; i += 1) {
+      captureWords[5 + 4 * membersCount + 1 + 2 * i + 0] = program_pipeline_compute_info->specialization_constants[i].constant_id;
+      captureWords[5 + 4 * membersCount + 1 + 2 * i + 1] = program_pipeline_compute_info->specialization_constants[i].value;
+    }
+    vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_PROGRAM_PIPELINE_CREATE_COMPUTE, optionalLine, 5 + 4 * membersCount + 1 + 2 * constantsCount, captureWords, 0, NULL);
+    red32MemoryFree(captureWords);
+  }
+
+  return (uint64_t)(void *)handle;
+}
+
+// NOTE(Constantine): Call with programPipelinesCacheLock locked. Counts a reference to the found program pipeline, returns 0 if the key is not cached.
+static uint64_t vfInternalProgramPipelinesCacheLookup(vf_handle_context_t * vkfast, uint64_t keyHash, uint64_t keyWordsCount, const uint64_t * keyWords) {
+  if (vkfast->programPipelinesCacheCount == 0) {
+    return 0;
+  }
+  uint64_t cursor = 0;
+  for (uint64_t e = vfInternalHashIndexNext(&vkfast->programPipelinesCacheIndex, keyHash, &cursor); e != 0; e = vfInternalHashIndexNext(&vkfast->programPipelinesCacheIndex, keyHash, &cursor)) {
+    vf_program_pipeline_cache_entry_t * entry = &vkfast->programPipelinesCache[e - 1];
+    if (entry->keyWordsCount == keyWordsCount && memcmp(entry->keyWords, keyWords, sizeof(uint64_t) * keyWordsCount) == 0) {
+      entry->referencesCount += 1;
+      return entry->programPipeline;
+    }
+  }
+  return 0;
+}
+
+GPU_API_PRE uint64_t GPU_API_POST vfProgramPipelineCreateComputeCached(gpu_handle_context_t context, const gpu_program_pipeline_compute_info_t * program_pipeline_compute_info, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  RedHandleGpu gpu = vkfast->gpu;
+
+  const unsigned membersCount   = program_pipeline_compute_info->struct_members_count;
+  const unsigned constantsCount = program_pipeline_compute_info->specialization_constants_count;
+  const uint64_t keyWordsCount  = 5 + 4 * membersCount + 2 * constantsCount;
+
+  // To free
+  uint64_t * keyWords = (uint64_t *)red32MemoryCalloc(sizeof(uint64_t) * keyWordsCount);
+  REDGPU_2_EXPECTWG(keyWords != NULL);
+  keyWords[0] = program_pipeline_compute_info->compute_program;
+  keyWords[1] = program_pipeline_compute_info->variables_slot;
+  keyWords[2] = program_pipeline_compute_info->variables_bytes_count;
+  keyWords[3] = membersCount;
+  keyWords[4] = constantsCount;
+  for (unsigned i = 0; i < membersCount; i += 1) {
+    keyWords[5 + 4 * i + 0] = program_pipeline_compute_info->struct_members[i].slot;
+    keyWords[5 + 4 * i + 1] = program_pipeline_compute_info->struct_members[i].type;
+    keyWords[5 + 4 * i + 2] = program_pipeline_compute_info->struct_members[i].count;
+    keyWords[5 + 4 * i + 3] = program_pipeline_compute_info->struct_members[i].visibleToStages;
+  }
+  for (unsigned i = 0; i < constantsCount; i += 1) {
+    keyWords[5 + 4 * membersCount + 2 * i + 0] = program_pipeline_compute_info->specialization_constants[i].constant_id;
+    keyWords[5 + 4 * membersCount + 2 * i + 1] = program_pipeline_compute_info->specialization_constants[i].value;
+  }
+  const uint64_t keyHash = vfInternalHashWords(keyWords, keyWordsCount);
+
+  uint64_t programPipeline = 0;
+
+  vfInternalSpinLock(&vkfast->programPipelinesCacheLock);
+  programPipeline = vfInternalProgramPipelinesCacheLookup(vkfast, keyHash, keyWordsCount, keyWords);
+  vfInternalSpinUnlock(&vkfast->programPipelinesCacheLock);
+
+  if (programPipeline != 0) {
+    red32MemoryFree(keyWords);
+    return programPipeline;
+  }
+
+  // NOTE(Constantine): Created outside of the lock, if another thread cached the same key meanwhile, its program pipeline wins.
+  const uint64_t created = vfProgramPipelineCreateCompute(context, program_pipeline_compute_info, optionalFile, optionalLine);
+
+  vfInternalSpinLock(&vkfast->programPipelinesCacheLock);
+  programPipeline = vfInternalProgramPipelinesCacheLookup(vkfast, keyHash, keyWordsCount, keyWords);
+  if (programPipeline == 0) {
+    if (vkfast->programPipelinesCacheCount == vkfast->programPipelinesCacheCapacity) {
+      const uint64_t capacity = vkfast->programPipelinesCacheCapacity == 0 ? 16 : vkfast->programPipelinesCacheCapacity * 2;
+      vf_program_pipeline_cache_entry_t * entries = (vf_program_pipeline_cache_entry_t *)red32MemoryCalloc(sizeof(vf_program_pipeline_cache_entry_t) * capacity);
+      REDGPU_2_EXPECTWG(entries != NULL);
+      if (vkfast->programPipelinesCache != NULL) {
+        red32MemoryCopy(entries, vkfast->programPipelinesCache, sizeof(vf_program_pipeline_cache_entry_t) * vkfast->programPipelinesCacheCount);
+        red32MemoryFree(vkfast->programPipelinesCache);
+      }
+      vkfast->programPipelinesCache         = entries;
+      vkfast->programPipelinesCacheCapacity = capacity;
+    }
+    vfInternalHashIndexReserve(&vkfast->programPipelinesCacheIndex, vkfast->programPipelinesCacheCount + 1);
+    vf_program_pipeline_cache_entry_t * entry = &vkfast->programPipelinesCache[vkfast->programPipelinesCacheCount];
+    entry->keyHash         = keyHash;
+    entry->keyWordsCount   = keyWordsCount;
+    entry->keyWords        = keyWords;
+    entry->programPipeline = created;
+    entry->referencesCount = 1;
+    vfInternalHashIndexInsert(&vkfast->programPipelinesCacheIndex, keyHash, vkfast->programPipelinesCacheCount);
+    vkfast->programPipelinesCacheCount += 1;
+    vf_handle_t * handle = (vf_handle_t *)(void *)created;
+    handle->procedure.isCached      = 1;
+    handle->procedure.cachedKeyHash = keyHash;
+    keyWords        = NULL;
+    programPipeline = created;
+  }
+  vfInternalSpinUnlock(&vkfast->programPipelinesCacheLock);
+
+  if (programPipeline != created) {
+    vfIdDestroy(1, &created, optionalFile, optionalLine);
+  }
+  if (keyWords != NULL) {
+    red32MemoryFree(keyWords);
+  }
+
+  return programPipeline;
+}
+
+GPU_API_PRE void GPU_API_POST vfProgramPipelineReleaseCached(gpu_handle_context_t context, uint64_t program_pipeline_id, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
 
-      createContextPerformance.settings         = RED_CONTEXT_OPTIONAL_SETTINGS_CREATE_CONTEXT_PERFORMANCE;
-      createContextPerformance.next             = &optionalSettings0;
-      createContextPerformance.exposeOnlyOneGpu = optional_ex2_parameters->exposeOnlyOneGpu;
+  int doDestroy = 0;
 
-      optionalSettings = &createContextPerformance;
+  vfInternalSpinLock(&vkfast->programPipelinesCacheLock);
+  const uint64_t e = vfInternalProgramPipelinesCacheFind(vkfast, program_pipeline_id);
+  REDGPU_2_EXPECTWG(!"Program pipeline was not returned by vfProgramPipelineCreateComputeCached() or was already released" || (e != 0));
+  if (e != 0) {
+    vkfast->programPipelinesCache[e - 1].referencesCount -= 1;
+    if (vkfast->programPipelinesCache[e - 1].referencesCount == 0) {
+      vfInternalProgramPipelinesCacheRemoveAt(vkfast, e - 1);
+      doDestroy = 1;
     }
+  }
+  vfInternalSpinUnlock(&vkfast->programPipelinesCacheLock);
 
-    unsigned extensions[] = {
-      #if defined(_WIN32)
-      RED_SDK_EXTENSION_WSI_WIN32,
-      #endif
-      #if defined(__linux__) && !defined(__ANDROID__)
-      RED_SDK_EXTENSION_WSI_XLIB,
-      #endif
-      #if defined(VKFAST_DEFINE_ENABLE_FEATURE_GPU_DEBUG_PRINTF) || defined(VKFAST_DEFINE_ENABLE_FEATURE_COMPUTE_BASED_RAY_TRACING)
-      RED_SDK_EXTENSION_RAY_TRACING,
-      #endif
-      #if defined(VKFAST_DEFINE_ENABLE_FEATURE_REII_MESH_STATE_RASTERIZATION_MODE)
-      RED_SDK_EXTENSION_RASTERIZATION_MODE,
-      #endif
-    };
+  if (doDestroy == 1) {
+    vfIdDestroy(1, &program_pipeline_id, optionalFile, optionalLine);
+  }
+}
 
-    np(redCreateContext,
-      "malloc", red32MemoryCalloc,
-      "free", red32MemoryFree,
-      "optionalMallocTagged", NULL,
-      "optionalFreeTagged", NULL,
-      "debugCallback", enable_debug_mode == 1 ? vfRedGpuDebugCallback : NULL,
-      "sdkVersion", RED_SDK_VERSION_1_0_135,
-      "sdkExtensionsCount", sizeof(extensions) / sizeof(extensions[0]),
-      "sdkExtensions", extensions,
-      "optionalProgramName", NULL,
-      "optionalProgramVersion", 0,
-      "optionalEngineName", NULL,
-      "optionalEngineVersion", 0,
-      "optionalSettings", optionalSettings,
-      "outContext", &context,
-      "outStatuses", NULL,
-      "optionalFile", optionalFile,
-      "optionalLine", optionalLine,
-      "optionalUserData", NULL
-    );
+static int vfInternalCompareUint64(const void * a, const void * b) {
+  const uint64_t x = *(const uint64_t *)a;
+  const uint64_t y = *(const uint64_t *)b;
+  return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+// NOTE(Constantine): Returns 0 for a candidate that can't be dispatched. A dimension that is not specialized is the fixed local size of the
+// program, so it must be the same for every candidate, and the local size and its workgroups counts must be within the limits of the GPU.
+static int vfInternalTuneCandidateIsValid(vf_handle_context_t * vkfast, const gpu_program_pipeline_tune_compute_info_t * tune_info, const unsigned * localSize) {
+  const RedGpuInfo * gpuInfo = vkfast->gpuInfo;
+  uint64_t invocationsCount = 1;
+  for (unsigned i = 0; i < 3; i += 1) {
+    if (localSize[i] == 0 || localSize[i] > gpuInfo->maxComputeWorkgroupDimensions[i]) {
+      return 0;
+    }
+    if (tune_info->local_size_constant_ids[i] == GPU_TUNE_LOCAL_SIZE_NOT_SPECIALIZED && localSize[i] != tune_info->candidates_local_sizes[i]) {
+      return 0;
+    }
+    if (((uint64_t)tune_info->invocations_count[i] + localSize[i] - 1) / localSize[i] > gpuInfo->maxComputeWorkgroupsCount[i]) {
+      return 0;
+    }
+    invocationsCount *= localSize[i];
   }
+  return invocationsCount <= gpuInfo->maxComputeWorkgroupInvocationsCount ? 1 : 0;
+}
 
-  REDGPU_2_EXPECT(context != NULL);
-  REDGPU_2_EXPECT(context->gpusCount > 0);
-  REDGPU_2_EXPECT(vkfast->gpuIndex < context->gpusCount);
+static uint64_t vfInternalTuneCreateCandidate(gpu_handle_context_t context, const gpu_program_pipeline_tune_compute_info_t * tune_info, const unsigned * localSize, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
 
-  const RedGpuInfo * gpuInfo = &context->gpus[vkfast->gpuIndex]; // NOTE(Constantine): Picking the first available GPU by default.
+  RedHandleGpu gpu = vkfast->gpu;
 
-  if (enable_debug_mode == 1) {
-    vfInternalPrint("[vkFast][Debug] Your GPU name: ");
-    vfInternalPrint(gpuInfo->gpuName);
-    vfInternalPrint("\n");
-    vfInternalPrint("[vkFast][Debug] For extra debug information, recompile redgpu.c as redgpu.cpp with REDGPU_COMPILE_SWITCH 3" "\n");
+  const gpu_program_pipeline_compute_info_t * info = tune_info->program_pipeline_compute_info;
+
+  // To free
+  gpu_program_specialization_constant_t * constants = (gpu_program_specialization_constant_t *)red32MemoryCalloc(sizeof(gpu_program_specialization_constant_t) * (info->specialization_constants_count + 3));
+  REDGPU_2_EXPECTWG(constants != NULL);
+  unsigned constantsCount = 0;
+  for (unsigned i = 0; i < info->specialization_constants_count; i += 1) {
+    constants[constantsCount] = info->specialization_constants[i];
+    constantsCount += 1;
+  }
+  for (unsigned i = 0; i < 3; i += 1) {
+    if (tune_info->local_size_constant_ids[i] == GPU_TUNE_LOCAL_SIZE_NOT_SPECIALIZED) {
+      continue;
+    }
+    constants[constantsCount].constant_id = tune_info->local_size_constant_ids[i];
+    constants[constantsCount].value       = localSize[i];
+    constantsCount += 1;
   }
 
-  REDGPU_2_EXPECT(gpuInfo->queuesCount > 0);
+  gpu_program_pipeline_compute_info_t candidateInfo = info[0];
+  candidateInfo.specialization_constants_count = constantsCount;
+  candidateInfo.specialization_constants       = constants;
+  const uint64_t programPipeline = vfProgramPipelineCreateCompute(context, &candidateInfo, optionalFile, optionalLine);
 
-  if (enable_debug_mode == 1) {
-    if (gpuInfo->supportsMemoryGetBudget == 1) {
-      RedMemoryBudget memoryBudget = {0};
-      memoryBudget.setTo1000237000 = 1000237000;
-      memoryBudget.setTo0          = 0;
-      np(redMemoryGetBudget,
-        "context", context,
-        "gpu", gpuInfo->gpu,
-        "outMemoryBudget", &memoryBudget,
-        "outStatuses", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
+  red32MemoryFree(constants);
+  return programPipeline;
+}
 
-      char numberString[4096] = {0};
+// NOTE(Constantine): REDGPU has no queries, so the tuner writes GPU timestamps with Vulkan directly, see vfInternalVkGetLoaderProcAddr().
+typedef struct vf_internal_vk_timestamps_t {
+  VkDevice                  device;
+  VkQueryPool               queryPool;
+  uint64_t                  ticksMask;
+  double                    nanosecondsPerTick;
+  PFN_vkDestroyQueryPool    vkDestroyQueryPool;
+  PFN_vkCmdResetQueryPool   vkCmdResetQueryPool;
+  PFN_vkCmdWriteTimestamp   vkCmdWriteTimestamp;
+  PFN_vkGetQueryPoolResults vkGetQueryPoolResults;
+} vf_internal_vk_timestamps_t;
+
+// NOTE(Constantine): Returns 0 if the loader isn't found or the main queue can't write timestamps.
+static int vfInternalVkTimestampsCreate(vf_handle_context_t * vkfast, vf_internal_vk_timestamps_t * outTimestamps) {
+  vf_internal_vk_timestamps_t timestamps = {0};
+  outTimestamps[0] = timestamps;
+
+  PFN_vkGetDeviceProcAddr                      getDeviceProcAddr                      = (PFN_vkGetDeviceProcAddr)vfInternalVkGetLoaderProcAddr("vkGetDeviceProcAddr");
+  PFN_vkGetPhysicalDeviceProperties            getPhysicalDeviceProperties            = (PFN_vkGetPhysicalDeviceProperties)vfInternalVkGetLoaderProcAddr("vkGetPhysicalDeviceProperties");
+  PFN_vkGetPhysicalDeviceQueueFamilyProperties getPhysicalDeviceQueueFamilyProperties = (PFN_vkGetPhysicalDeviceQueueFamilyProperties)vfInternalVkGetLoaderProcAddr("vkGetPhysicalDeviceQueueFamilyProperties");
+  if (getDeviceProcAddr == NULL || getPhysicalDeviceProperties == NULL || getPhysicalDeviceQueueFamilyProperties == NULL) {
+    return 0;
+  }
 
-      vfInternalPrint("[vkFast][Debug] gpuInfo->memoryHeaps current process heap budget:" "\n");
-      for (unsigned i = 0; i < gpuInfo->memoryHeapsCount; i += 1) {
-        vfInternalPrint("[vkFast][Debug]   [");
-        red32Uint64ToChars(i, numberString);
-        vfInternalPrint(numberString);
-        vfInternalPrint("]: ");
-        red32Uint64ToChars(memoryBudget.memoryHeapsBudget[i], numberString);
-        vfInternalPrint(numberString);
-        vfInternalPrint("\n");
-      }
+  const VkPhysicalDevice physicalDevice = (VkPhysicalDevice)vkfast->gpuInfo->gpuDevice;
 
-      vfInternalPrint("[vkFast][Debug] gpuInfo->memoryHeaps current process estimated heap usage:" "\n");
-      for (unsigned i = 0; i < gpuInfo->memoryHeapsCount; i += 1) {
-        vfInternalPrint("[vkFast][Debug]   [");
-        red32Uint64ToChars(i, numberString);
-        vfInternalPrint(numberString);
-        vfInternalPrint("]: ");
-        red32Uint64ToChars(memoryBudget.memoryHeapsUsage[i], numberString);
-        vfInternalPrint(numberString);
-        vfInternalPrint("\n");
-      }
-    }
+  VkQueueFamilyProperties families[64] = {0};
+  uint32_t familiesCount = 64;
+  getPhysicalDeviceQueueFamilyProperties(physicalDevice, &familiesCount, families);
+  if (vkfast->mainQueueFamilyIndex >= familiesCount) {
+    return 0;
+  }
+  const uint32_t validBits = families[vkfast->mainQueueFamilyIndex].timestampValidBits;
+  if (validBits == 0) {
+    return 0;
   }
 
-  if (gpuInfo->gpuVendorId == 0x5143) {
-    vfInternalExpectMinimumGuaranteesAdreno735(gpuInfo, optionalFile, optionalLine);
-  } else {
-    np(red2ExpectMinimumGuaranteesIntelUHDGraphics730,
-      "gpuInfo", gpuInfo,
-      "optionalFile", optionalFile,
-      "optionalLine", optionalLine
-    );
+  VkPhysicalDeviceProperties properties = {0};
+  getPhysicalDeviceProperties(physicalDevice, &properties);
+
+  timestamps.device                = (VkDevice)vkfast->gpu;
+  timestamps.ticksMask             = validBits >= 64 ? (uint64_t)-1 : ((uint64_t)1 << validBits) - 1;
+  timestamps.nanosecondsPerTick    = (double)properties.limits.timestampPeriod;
+  timestamps.vkDestroyQueryPool    = (PFN_vkDestroyQueryPool)getDeviceProcAddr(timestamps.device, "vkDestroyQueryPool");
+  timestamps.vkCmdResetQueryPool   = (PFN_vkCmdResetQueryPool)getDeviceProcAddr(timestamps.device, "vkCmdResetQueryPool");
+  timestamps.vkCmdWriteTimestamp   = (PFN_vkCmdWriteTimestamp)getDeviceProcAddr(timestamps.device, "vkCmdWriteTimestamp");
+  timestamps.vkGetQueryPoolResults = (PFN_vkGetQueryPoolResults)getDeviceProcAddr(timestamps.device, "vkGetQueryPoolResults");
+  PFN_vkCreateQueryPool createQueryPool = (PFN_vkCreateQueryPool)getDeviceProcAddr(timestamps.device, "vkCreateQueryPool");
+  if (createQueryPool == NULL || timestamps.vkDestroyQueryPool == NULL || timestamps.vkCmdResetQueryPool == NULL || timestamps.vkCmdWriteTimestamp == NULL || timestamps.vkGetQueryPoolResults == NULL) {
+    return 0;
   }
 
-  if (gpuInfo->gpuVendorId == 0x5143) {
-    vfInternalExpectMinimumImageFormatsLimitsAndFeaturesAdreno735(gpuInfo, optionalFile, optionalLine);
-  } else {
-    np(red2ExpectMinimumImageFormatsLimitsAndFeatures,
-      "gpuInfo", gpuInfo,
-      "optionalFile", optionalFile,
-      "optionalLine", optionalLine
-    );
+  VkQueryPoolCreateInfo queryPoolInfo = {0};
+  queryPoolInfo.sType      = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+  queryPoolInfo.queryType  = VK_QUERY_TYPE_TIMESTAMP;
+  queryPoolInfo.queryCount = 2;
+  if (createQueryPool(timestamps.device, &queryPoolInfo, NULL, &timestamps.queryPool) != VK_SUCCESS) {
+    return 0;
   }
 
-  RedHandleGpu   gpu       = gpuInfo->gpu;
-  RedHandleQueue mainQueue = gpuInfo->queues[vkfast->mainQueueIndex];
+  outTimestamps[0] = timestamps;
+  return 1;
+}
 
-  RedArray memoryGpuVramForArrays_array   = {0};
-  RedArray memoryCpuUpload_array          = {0};
-  RedArray memoryCpuReadback_array        = {0};
-  unsigned specificMemoryTypesGpuVram     = -1;
-  unsigned specificMemoryTypesCpuUpload   = -1;
-  unsigned specificMemoryTypesCpuReadback = -1;
-  RedHandleMemory memoryGpuVramForArrays_memory = NULL;
-  RedHandleMemory memoryCpuUpload_memory        = NULL;
-  RedHandleMemory memoryCpuReadback_memory      = NULL;
-  void * memoryCpuUpload_mapped_void_ptr        = NULL;
-  void * memoryCpuReadback_mapped_void_ptr      = NULL;
-  {
-    if (internalMemoryAllocationSizeGpuVramArrays > 0) {
-      uint64_t bytesCount = internalMemoryAllocationSizeGpuVramArrays;
-      const char * handleName = "vkFast_vfInternalContextInit_memoryGpuVramForArrays_array";
-      uint64_t maxAllowedOverallocationBytesCount = 64; // NOTE(Constantine)(Aug 15, 2026): Vulkan SDK Frame Capture feature needs 64 bytes of overallocation here.
-      RedArray array = {0};
+// NOTE(Constantine):
+// Every sample is the GPU time between the timestamps around dispatches_per_sample dispatches of one submit. If the main queue can't
+// write timestamps, a sample is the CPU time of the submit and the wait for it: that overhead is the same for all candidates and doesn't
+// change which one is the fastest, but it hides the differences of short dispatches.
+GPU_API_PRE void GPU_API_POST vfProgramPipelineTuneCompute(gpu_handle_context_t context, const gpu_program_pipeline_tune_compute_info_t * tune_info, gpu_program_pipeline_tune_compute_result_t * out_result, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
 
-      np(redCreateArray,
-        "context", context,
-        "gpu", gpu,
-        "handleName", handleName,
-        "type", RED_ARRAY_TYPE_ARRAY_RW,
-        "bytesCount", bytesCount,
-        "structuredBufferElementBytesCount", 0,
-        "restrictToAccess", RED_ARRAY_TYPE_ARRAY_RW,
-        "initialQueueFamilyIndex", gpuInfo->queuesCount > 1 ? -1 : (unsigned)gpuInfo->queuesFamilyIndex[vkfast->mainQueueFamilyIndex],
-        "dedicate", 0,
-        "outArray", &array,
-        "outStatuses", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      REDGPU_2_EXPECTWG(array.handle != NULL);
-      size_t bytesToNextAlignmentBoundary = REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(array.memoryBytesCount, array.memoryBytesAlignment);
-      REDGPU_2_EXPECTWG(bytesToNextAlignmentBoundary == 0);
-      REDGPU_2_EXPECTWG((array.memoryBytesCount - bytesCount) <= maxAllowedOverallocationBytesCount);
+  RedHandleGpu gpu = vkfast->gpu;
 
-      memoryGpuVramForArrays_array = array;
-    }
-    if (internalMemoryAllocationSizeCpuVisible > 0) {
-      uint64_t bytesCount = internalMemoryAllocationSizeCpuVisible;
-      const char * handleName = "vkFast_vfInternalContextInit_memoryCpuUpload_array";
-      uint64_t maxAllowedOverallocationBytesCount = 0;
-      RedArray array = {0};
+  REDGPU_2_EXPECTWG(tune_info->tuning_key != NULL);
+  REDGPU_2_EXPECTWG(strlen(tune_info->tuning_key) < VF_TUNING_KEY_MAX_BYTES);
+  for (const char * c = tune_info->tuning_key; c[0] != 0; c += 1) {
+    REDGPU_2_EXPECTWG(c[0] != ' ' && c[0] != '\t' && c[0] != '\r' && c[0] != '\n');
+  }
+  REDGPU_2_EXPECTWG(tune_info->candidates_count > 0);
+  REDGPU_2_EXPECTWG(tune_info->bind_callback != NULL);
 
-      np(redCreateArray,
-        "context", context,
-        "gpu", gpu,
-        "handleName", handleName,
-        "type", RED_ARRAY_TYPE_ARRAY_RO,
-        "bytesCount", bytesCount,
-        "structuredBufferElementBytesCount", 0,
-        "restrictToAccess", RED_ACCESS_BITFLAG_COPY_R,
-        "initialQueueFamilyIndex", gpuInfo->queuesCount > 1 ? -1 : (unsigned)gpuInfo->queuesFamilyIndex[vkfast->mainQueueFamilyIndex],
-        "dedicate", 0,
-        "outArray", &array,
-        "outStatuses", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      REDGPU_2_EXPECTWG(array.handle != NULL);
-      size_t bytesToNextAlignmentBoundary = REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(array.memoryBytesCount, array.memoryBytesAlignment);
-      REDGPU_2_EXPECTWG(bytesToNextAlignmentBoundary == 0);
-      REDGPU_2_EXPECTWG((array.memoryBytesCount - bytesCount) <= maxAllowedOverallocationBytesCount);
+  gpu_program_pipeline_tune_compute_result_t result = {0};
 
-      memoryCpuUpload_array = array;
-    }
-    if (internalMemoryAllocationSizeCpuReadback > 0) {
-      uint64_t bytesCount = internalMemoryAllocationSizeCpuReadback;
-      const char * handleName = "vkFast_vfInternalContextInit_memoryCpuReadback_array";
-      uint64_t maxAllowedOverallocationBytesCount = 0;
-      RedArray array = {0};
+  if (vfInternalTuningGet(vkfast, tune_info->tuning_key, result.local_size) == 1) {
+    result.is_from_cache = 1;
+  } else {
+    const unsigned dispatchesPerSample = tune_info->dispatches_per_sample == 0 ? 16 : tune_info->dispatches_per_sample;
+    const unsigned samplesCount        = tune_info->samples_count         == 0 ? 9  : tune_info->samples_count;
+    const unsigned array65536[1]       = {65536};
 
-      np(redCreateArray,
-        "context", context,
-        "gpu", gpu,
-        "handleName", handleName,
-        "type", RED_ARRAY_TYPE_ARRAY_RW,
-        "bytesCount", bytesCount,
-        "structuredBufferElementBytesCount", 0,
-        "restrictToAccess", RED_ACCESS_BITFLAG_COPY_W,
-        "initialQueueFamilyIndex", gpuInfo->queuesCount > 1 ? -1 : (unsigned)gpuInfo->queuesFamilyIndex[vkfast->mainQueueFamilyIndex],
-        "dedicate", 0,
-        "outArray", &array,
-        "outStatuses", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      REDGPU_2_EXPECTWG(array.handle != NULL);
-      size_t bytesToNextAlignmentBoundary = REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(array.memoryBytesCount, array.memoryBytesAlignment);
-      REDGPU_2_EXPECTWG(bytesToNextAlignmentBoundary == 0);
-      REDGPU_2_EXPECTWG((array.memoryBytesCount - bytesCount) <= maxAllowedOverallocationBytesCount);
+    // To free
+    uint64_t * samples = (uint64_t *)red32MemoryCalloc(sizeof(uint64_t) * samplesCount);
+    REDGPU_2_EXPECTWG(samples != NULL);
 
-      memoryCpuReadback_array = array;
-    }
+    // To destroy
+    gpu_thread_t gpuThread = NULL;
+    vfGpuThreadCreate(context, 1, &gpuThread, NULL, optionalFile, optionalLine);
 
-    int userSpecificMemoryTypeGpuVram     = 0;
-    int userSpecificMemoryTypeCpuUpload   = 0;
-    int userSpecificMemoryTypeCpuReadback = 0;
-    if (optional_ex3_parameters != NULL) {
-      if (optional_ex3_parameters->optionalSpecificMemoryTypeGpuVram     != NULL) { userSpecificMemoryTypeGpuVram     = 1; }
-      if (optional_ex3_parameters->optionalSpecificMemoryTypeCpuUpload   != NULL) { userSpecificMemoryTypeCpuUpload   = 1; }
-      if (optional_ex3_parameters->optionalSpecificMemoryTypeCpuReadback != NULL) { userSpecificMemoryTypeCpuReadback = 1; }
-    }
-    if (userSpecificMemoryTypeGpuVram == 1) {
-      specificMemoryTypesGpuVram = optional_ex3_parameters->optionalSpecificMemoryTypeGpuVram[0];
-    } else {
-      specificMemoryTypesGpuVram = vfPickSpecificMemoryTypeGpuVram(gpuInfo, &memoryGpuVramForArrays_array);
-    }
-    if (userSpecificMemoryTypeCpuUpload == 1) {
-      specificMemoryTypesCpuUpload = optional_ex3_parameters->optionalSpecificMemoryTypeCpuUpload[0];
-    } else {
-      specificMemoryTypesCpuUpload = vfPickSpecificMemoryTypeCpuUpload(gpuInfo, &memoryCpuUpload_array);
-    }
-    if (userSpecificMemoryTypeCpuReadback == 1) {
-      specificMemoryTypesCpuReadback = optional_ex3_parameters->optionalSpecificMemoryTypeCpuReadback[0];
-    } else {
-      specificMemoryTypesCpuReadback = vfPickSpecificMemoryTypeCpuReadback(gpuInfo, &memoryCpuReadback_array);
-    }
-    if (internalMemoryAllocationSizeGpuVramArrays > 0) { REDGPU_2_EXPECTWG(specificMemoryTypesGpuVram     != -1); }
-    if (internalMemoryAllocationSizeCpuVisible    > 0) { REDGPU_2_EXPECTWG(specificMemoryTypesCpuUpload   != -1); }
-    if (internalMemoryAllocationSizeCpuReadback   > 0) { REDGPU_2_EXPECTWG(specificMemoryTypesCpuReadback != -1); }
+    // To destroy
+    vf_internal_vk_timestamps_t timestamps = {0};
+    result.is_gpu_timed = vfInternalVkTimestampsCreate(vkfast, &timestamps) == 1 ? 1 : 0;
+
+    uint64_t batch      = 0;
+    uint64_t bestMedian = -1;
+    for (unsigned c = 0; c < tune_info->candidates_count; c += 1) {
+      const unsigned * localSize = &tune_info->candidates_local_sizes[c * 3];
+      if (vfInternalTuneCandidateIsValid(vkfast, tune_info, localSize) == 0) {
+        if (vkfast->isDebugMode == 1) {
+          char numberString[4096] = {0};
+          vfInternalPrint("[vkFast][Debug] Tuning ");
+          vfInternalPrint(tune_info->tuning_key);
+          vfInternalPrint(", rejected candidate ");
+          red32Uint64ToChars(c, numberString);
+          vfInternalPrint(numberString);
+          vfInternalPrint(": its local size doesn't fit the GPU limits or differs from the first candidate in a dimension that is not specialized" "\n");
+        }
+        continue;
+      }
+
+      // To destroy
+      const uint64_t programPipeline = vfInternalTuneCreateCandidate(context, tune_info, localSize, optionalFile, optionalLine);
+
+      batch = vfBatchBegin(context, batch, tune_info->batch_info, NULL, optionalFile, optionalLine);
+      vfBatchBindProgramPipelineCompute(context, batch, programPipeline, optionalFile, optionalLine);
+      tune_info->bind_callback(context, batch, tune_info->bind_callback_user_data);
+      RedHandleCalls batchRaw = vfBatchGetRawHandle(context, batch, optionalFile, optionalLine);
+      if (result.is_gpu_timed == 1) {
+        timestamps.vkCmdResetQueryPool((VkCommandBuffer)batchRaw, timestamps.queryPool, 0, 2);
+        timestamps.vkCmdWriteTimestamp((VkCommandBuffer)batchRaw, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timestamps.queryPool, 0);
+      }
+      for (unsigned d = 0; d < dispatchesPerSample; d += 1) {
+        vfBatchCompute(context, batch,
+          (tune_info->invocations_count[0] + localSize[0] - 1) / localSize[0],
+          (tune_info->invocations_count[1] + localSize[1] - 1) / localSize[1],
+          (tune_info->invocations_count[2] + localSize[2] - 1) / localSize[2],
+          optionalFile, optionalLine
+        );
+        vfBatchBarrierMemory(context, batch, optionalFile, optionalLine);
+      }
+      if (result.is_gpu_timed == 1) {
+        timestamps.vkCmdWriteTimestamp((VkCommandBuffer)batchRaw, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timestamps.queryPool, 1);
+      }
+      vfBatchEnd(context, batch, optionalFile, optionalLine);
+
+      // NOTE(Constantine): The first submit warms up the program pipeline and is not sampled.
+      vfAsyncWaitToFinish(context, vfAsyncBatchExecuteRaw(context, 1, &batchRaw, 1, &gpuThread, array65536, optionalFile, optionalLine), optionalFile, optionalLine);
+      for (unsigned i = 0; i < samplesCount; i += 1) {
+        const uint64_t begin = vfInternalGetTimeNanoseconds();
+        vfAsyncWaitToFinish(context, vfAsyncBatchExecuteRaw(context, 1, &batchRaw, 1, &gpuThread, array65536, optionalFile, optionalLine), optionalFile, optionalLine);
+        samples[i] = vfInternalGetTimeNanoseconds() - begin;
+        uint64_t ticks[2] = {0};
+        if (result.is_gpu_timed == 1 && timestamps.vkGetQueryPoolResults(timestamps.device, timestamps.queryPool, 0, 2, sizeof(ticks), ticks, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT) == VK_SUCCESS) {
+          samples[i] = (uint64_t)((double)((ticks[1] - ticks[0]) & timestamps.ticksMask) * timestamps.nanosecondsPerTick);
+        }
+      }
+      qsort(samples, samplesCount, sizeof(uint64_t), vfInternalCompareUint64);
+      const uint64_t median = samples[samplesCount / 2];
+
+      if (vkfast->isDebugMode == 1) {
+        char numberString[4096] = {0};
+        vfInternalPrint("[vkFast][Debug] Tuning ");
+        vfInternalPrint(tune_info->tuning_key);
+        vfInternalPrint(", local size ");
+        red32Uint64ToChars(localSize[0], numberString);
+        vfInternalPrint(numberString);
+        vfInternalPrint("x");
+        red32Uint64ToChars(localSize[1], numberString);
+        vfInternalPrint(numberString);
+        vfInternalPrint("x");
+        red32Uint64ToChars(localSize[2], numberString);
+        vfInternalPrint(numberString);
+        vfInternalPrint(": ");
+        red32Uint64ToChars(median / 1000, numberString);
+        vfInternalPrint(numberString);
+        vfInternalPrint(" us" "\n");
+      }
 
-    if (internalMemoryAllocationSizeGpuVramArrays > 0) {
-      np(redMemoryAllocate,
-        "context", context,
-        "gpu", gpu,
-        "handleName", "vkFast_vfInternalContextInit_memoryGpuVramForArrays_memory",
-        "bytesCount", internalMemoryAllocationSizeGpuVramArrays,
-        "memoryTypeIndex", specificMemoryTypesGpuVram,
-        "dedicateToArray", NULL,
-        "dedicateToImage", NULL,
-        "memoryBitflags", 0,
-        "outMemory", &memoryGpuVramForArrays_memory,
-        "outStatuses", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      REDGPU_2_EXPECTWG(memoryGpuVramForArrays_memory != NULL);
+      if (median < bestMedian) {
+        bestMedian = median;
+        result.local_size[0] = localSize[0];
+        result.local_size[1] = localSize[1];
+        result.local_size[2] = localSize[2];
+        if (result.program_pipeline_compute != 0) {
+          vfIdDestroy(1, &result.program_pipeline_compute, optionalFile, optionalLine);
+        }
+        result.program_pipeline_compute = programPipeline;
+      } else {
+        vfIdDestroy(1, &programPipeline, optionalFile, optionalLine);
+      }
+    }
+    REDGPU_2_EXPECTWG(result.program_pipeline_compute != 0 || !"[vkFast] No candidate local size of vfProgramPipelineTuneCompute() is valid for this GPU.");
+    result.median_nanoseconds = bestMedian;
 
-      RedMemoryArray memoryArray = {0};
-      memoryArray.setTo1000157000  = 1000157000;
-      memoryArray.setTo0           = 0;
-      memoryArray.array            = memoryGpuVramForArrays_array.handle;
-      memoryArray.memory           = memoryGpuVramForArrays_memory;
-      memoryArray.memoryBytesFirst = 0;
-      RedStatuses opstatuses = {0};
-      np(redMemorySet,
-        "context", context,
-        "gpu", gpu,
-        "memoryArraysCount", 1,
-        "memoryArrays", &memoryArray,
-        "memoryImagesCount", 0,
-        "memoryImages", NULL,
-        "outStatuses", &opstatuses,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      REDGPU_2_EXPECTWG(opstatuses.statusError == RED_STATUS_SUCCESS);
+    if (batch != 0) {
+      vfIdDestroy(1, &batch, optionalFile, optionalLine);
     }
-    if (internalMemoryAllocationSizeCpuVisible > 0) {
-      np(redMemoryAllocate,
-        "context", context,
-        "gpu", gpu,
-        "handleName", "vkFast_vfInternalContextInit_memoryCpuUpload_memory",
-        "bytesCount", internalMemoryAllocationSizeCpuVisible,
-        "memoryTypeIndex", specificMemoryTypesCpuUpload,
-        "dedicateToArray", NULL,
-        "dedicateToImage", NULL,
-        "memoryBitflags", 0,
-        "outMemory", &memoryCpuUpload_memory,
-        "outStatuses", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      REDGPU_2_EXPECTWG(memoryCpuUpload_memory != NULL);
+    if (result.is_gpu_timed == 1) {
+      timestamps.vkDestroyQueryPool(timestamps.device, timestamps.queryPool, NULL);
+    }
+    vfGpuThreadDestroy(context, gpuThread);
+    red32MemoryFree(samples);
 
-      RedMemoryArray memoryArray = {0};
-      memoryArray.setTo1000157000  = 1000157000;
-      memoryArray.setTo0           = 0;
-      memoryArray.array            = memoryCpuUpload_array.handle;
-      memoryArray.memory           = memoryCpuUpload_memory;
-      memoryArray.memoryBytesFirst = 0;
-      RedStatuses opstatuses = {0};
-      np(redMemorySet,
-        "context", context,
-        "gpu", gpu,
-        "memoryArraysCount", 1,
-        "memoryArrays", &memoryArray,
-        "memoryImagesCount", 0,
-        "memoryImages", NULL,
-        "outStatuses", &opstatuses,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      REDGPU_2_EXPECTWG(opstatuses.statusError == RED_STATUS_SUCCESS);
+    vfInternalTuningSet(vkfast, tune_info->tuning_key, result.local_size);
+    vfInternalTuningCacheStore(vkfast, tune_info->tuning_key, result.local_size);
+  }
 
-      np(redMemoryMap,
-        "context", context,
-        "gpu", gpu,
-        "mappableMemory", memoryCpuUpload_memory,
-        "mappableMemoryBytesFirst", 0,
-        "mappableMemoryBytesCount", memoryCpuUpload_array.memoryBytesCount,
-        "outVolatilePointer", &memoryCpuUpload_mapped_void_ptr,
-        "outStatuses", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      REDGPU_2_EXPECTWG(memoryCpuUpload_mapped_void_ptr != NULL);
-      REDGPU_2_EXPECTWG(!"Start address is not aligned" || (0 == REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY((uint64_t)memoryCpuUpload_mapped_void_ptr, gpuInfo->minMemoryAllocateBytesAlignment)));
-    }
-    if (internalMemoryAllocationSizeCpuReadback > 0) {
-      np(redMemoryAllocate,
-        "context", context,
-        "gpu", gpu,
-        "handleName", "vkFast_vfInternalContextInit_memoryCpuReadback_memory",
-        "bytesCount", internalMemoryAllocationSizeCpuReadback,
-        "memoryTypeIndex", specificMemoryTypesCpuReadback,
-        "dedicateToArray", NULL,
-        "dedicateToImage", NULL,
-        "memoryBitflags", 0,
-        "outMemory", &memoryCpuReadback_memory,
-        "outStatuses", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      REDGPU_2_EXPECTWG(memoryCpuReadback_memory != NULL);
+  if (result.program_pipeline_compute == 0) {
+    result.program_pipeline_compute = vfInternalTuneCreateCandidate(context, tune_info, result.local_size, optionalFile, optionalLine);
+  }
+  for (unsigned i = 0; i < 3; i += 1) {
+    result.workgroups_count[i] = (tune_info->invocations_count[i] + result.local_size[i] - 1) / result.local_size[i];
+  }
+  out_result[0] = result;
+}
 
-      RedMemoryArray memoryArray = {0};
-      memoryArray.setTo1000157000  = 1000157000;
-      memoryArray.setTo0           = 0;
-      memoryArray.array            = memoryCpuReadback_array.handle;
-      memoryArray.memory           = memoryCpuReadback_memory;
-      memoryArray.memoryBytesFirst = 0;
-      RedStatuses opstatuses = {0};
-      np(redMemorySet,
-        "context", context,
-        "gpu", gpu,
-        "memoryArraysCount", 1,
-        "memoryArrays", &memoryArray,
-        "memoryImagesCount", 0,
-        "memoryImages", NULL,
-        "outStatuses", &opstatuses,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      REDGPU_2_EXPECTWG(opstatuses.statusError == RED_STATUS_SUCCESS);
+GPU_API_PRE RedBool32 GPU_API_POST vfProgramPipelineGetTunedLocalSize(gpu_handle_context_t context, const char * tuning_key, unsigned * out_local_size, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
 
-      np(redMemoryMap,
-        "context", context,
-        "gpu", gpu,
-        "mappableMemory", memoryCpuReadback_memory,
-        "mappableMemoryBytesFirst", 0,
-        "mappableMemoryBytesCount", memoryCpuReadback_array.memoryBytesCount,
-        "outVolatilePointer", &memoryCpuReadback_mapped_void_ptr,
-        "outStatuses", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      REDGPU_2_EXPECTWG(memoryCpuReadback_mapped_void_ptr != NULL);
-      REDGPU_2_EXPECTWG(!"Start address is not aligned" || (0 == REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY((uint64_t)memoryCpuReadback_mapped_void_ptr, gpuInfo->minMemoryAllocateBytesAlignment)));
+  REDGPU_2_EXPECT(vkfast != NULL);
+
+  return vfInternalTuningGet(vkfast, tuning_key, out_local_size) == 1 ? 1 : 0;
+}
+
+GPU_API_PRE void GPU_API_POST vfContextGetBindingsSetsCacheStats(gpu_handle_context_t context, gpu_bindings_sets_cache_stats_t * out_stats, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  REDGPU_2_EXPECT(vkfast != NULL);
+
+  gpu_bindings_sets_cache_stats_t stats = {0};
+  vfInternalSpinLock(&vkfast->bindingsSetsLock);
+  stats.sets_count        = vkfast->bindingsSetsCount;
+  stats.pools_count       = vkfast->bindingsSetsPoolsCount;
+  stats.hits_count        = vkfast->bindingsSetsHitsCount;
+  stats.misses_count      = vkfast->bindingsSetsMissesCount;
+  stats.pool_resets_count = vkfast->bindingsSetsPoolResetsCount;
+  for (uint64_t i = 0; i < vkfast->bindingsSetsPoolsCount; i += 1) {
+    stats.pools_max_sets_count += vkfast->bindingsSetsPools[i].maxStructsCount;
+  }
+  vfInternalSpinUnlock(&vkfast->bindingsSetsLock);
+  out_stats[0] = stats;
+}
+
+// NOTE(Constantine): Bindings sets cache. Batches that set gpu_batch_info_t::use_bindings_sets_cache record the slots and the binds of
+// a new bindings set as key words and build the set only at vfBatchBindNewBindingsEnd() if no cached set has the same key, which is looked
+// up by key hash through bindingsSetsIndex. Cached sets are suballocated from context owned structs memory pools that double in size, when
+// VF_BINDINGS_SETS_POOLS_SOFT_MAX_COUNT is reached, the least recently used pool that no recorded batch references is reset instead.
+// Binding sets from a structs memory that wasn't set with redCallSetStructsMemory() is fine on REDGPU's Vulkan backend.
+
+static void vfInternalBindingsSetKeyAppend(vf_handle_t * batch, uint64_t bytesCount, const void * bytes) {
+  vf_handle_context_t * vkfast = batch->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+
+  const uint64_t wordsCount    = (bytesCount + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+  const uint64_t requiredCount = batch->batch.pendingBindingsSetKeyWordsCount + wordsCount;
+  if (requiredCount > batch->batch.pendingBindingsSetKeyWordsCapacity) {
+    uint64_t capacity = batch->batch.pendingBindingsSetKeyWordsCapacity == 0 ? 64 : batch->batch.pendingBindingsSetKeyWordsCapacity * 2;
+    while (capacity < requiredCount) {
+      capacity *= 2;
+    }
+    // To free
+    uint64_t * keyWords = (uint64_t *)red32MemoryCalloc(sizeof(uint64_t) * capacity);
+    REDGPU_2_EXPECTWG(keyWords != NULL);
+    if (batch->batch.pendingBindingsSetKeyWords != NULL) {
+      red32MemoryCopy(keyWords, batch->batch.pendingBindingsSetKeyWords, sizeof(uint64_t) * batch->batch.pendingBindingsSetKeyWordsCount);
+      red32MemoryFree(batch->batch.pendingBindingsSetKeyWords);
     }
+    batch->batch.pendingBindingsSetKeyWords         = keyWords;
+    batch->batch.pendingBindingsSetKeyWordsCapacity = capacity;
+  }
+  uint64_t * words = &batch->batch.pendingBindingsSetKeyWords[batch->batch.pendingBindingsSetKeyWordsCount];
+  for (uint64_t i = 0; i < wordsCount; i += 1) {
+    words[i] = 0; // NOTE(Constantine): Zeroes the padding of the last word, key words are compared in full.
   }
+  if (bytesCount > 0) {
+    red32MemoryCopy(words, bytes, bytesCount);
+  }
+  batch->batch.pendingBindingsSetKeyWordsCount = requiredCount;
+}
 
-  RedCalls presentCopyCalls = {0};
-  np(redCreateCalls,
-    "context", context,
-    "gpu", gpu,
-    "handleName", "vkFast_vfInternalContextInit_presentCopyCalls",
-    "queueFamilyIndex", gpuInfo->queuesFamilyIndex[vkfast->presentQueueIndex],
-    "outCalls", &presentCopyCalls,
+static int vfInternalBindingsSetsTrySuballocate(vf_handle_context_t * vkfast, uint64_t poolIndex, uint64_t slotsCount, const RedStructDeclarationMember * slots, Red2Struct * outStructure, const char * optionalFile, int optionalLine) {
+  RedHandleGpu gpu = vkfast->gpu;
+
+  vf_bindings_sets_pool_t * pool = &vkfast->bindingsSetsPools[poolIndex];
+  if (pool->structsCount >= pool->maxStructsCount) {
+    return 0;
+  }
+
+  Red2Struct structure = {0};
+  np(red2StructsMemorySuballocateStruct,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "handleName", NULL,
+    "structsMemory", pool->structsMemory,
+    "structDeclarationMembersCount", slotsCount,
+    "structDeclarationMembers", slots,
+    "structDeclarationMembersArrayROCount", 0,
+    "structDeclarationMembersArrayRO", NULL,
+    "outStruct", &structure,
     "outStatuses", NULL,
     "optionalFile", optionalFile,
     "optionalLine", optionalLine,
     "optionalUserData", NULL
   );
-  REDGPU_2_EXPECTWG(presentCopyCalls.handle != NULL);
+  REDGPU_2_EXPECTWG(structure.handleDeclaration != NULL);
+  if (structure.handle == NULL) {
+    // NOTE(Constantine): Ran out of struct members of the pool before running out of its structs.
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_STRUCT_DECLARATION,
+      "handle", structure.handleDeclaration,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    pool->structsCount = pool->maxStructsCount;
+    return 0;
+  }
+  pool->structsCount += 1;
+  outStructure[0] = structure;
+  return 1;
+}
 
-  REDGPU_2_EXPECTWG(gpuInfo->minArrayRORWStructMemberRangeBytesAlignment <= 64);
+// NOTE(Constantine): Called with bindingsSetsLock released, poolsCount is the pools count the caller saw under it and only sizes the pool.
+static RedHandleStructsMemory vfInternalBindingsSetsPoolAllocate(vf_handle_context_t * vkfast, uint64_t poolsCount, uint64_t slotsCount, const RedStructDeclarationMember * slots, uint64_t * outMaxStructsCount, const char * optionalFile, int optionalLine) {
+  RedHandleGpu gpu = vkfast->gpu;
 
-  // Filling
-  vf_handle_context_t;
-  vkfast->doNotDestroyRawContext;
-  vkfast->doNotFreeHandle;
-  vkfast->isDebugMode = enable_debug_mode;
-  vkfast->context = context;
-  vkfast->gpuInfo = gpuInfo;
-  vkfast->gpuIndex;
-  vkfast->gpu = gpu; // NOTE(Constantine): If vkfast->gpuIndex is changed on the user side, vkfast->gpu must be changed by the user too.
-  vkfast->mainQueueIndex;
-  vkfast->mainQueueFamilyIndex;
-  vkfast->mainQueue = mainQueue; // NOTE(Constantine): If vkfast->mainQueueIndex is changed on the user side, vkfast->mainQueue must be changed by the user too.
-  vkfast->specificMemoryTypesGpuVram = specificMemoryTypesGpuVram;
-  vkfast->specificMemoryTypesCpuUpload = specificMemoryTypesCpuUpload;
-  vkfast->specificMemoryTypesCpuReadback = specificMemoryTypesCpuReadback;
-  vkfast->memoryAllocationSizeGpuVram = internalMemoryAllocationSizeGpuVramArrays;
-  vkfast->memoryAllocationSizeCpuUpload = internalMemoryAllocationSizeCpuVisible;
-  vkfast->memoryAllocationSizeCpuReadback = internalMemoryAllocationSizeCpuReadback;
-  vkfast->memoryAllocationSizeCpuUploadPresentPixels = internalMemoryAllocationSizeCpuVisiblePresentPixels;
-  vkfast->memoryGpuVramForArrays_array = memoryGpuVramForArrays_array;
-  vkfast->memoryGpuVramForArrays_memory = memoryGpuVramForArrays_memory;
-  vkfast->memoryGpuVramForArrays_memory_suballocations_offset = 0;
-  vkfast->memoryCpuUpload_array = memoryCpuUpload_array;
-  vkfast->memoryCpuUpload_memory = memoryCpuUpload_memory;
-  vkfast->memoryCpuUpload_mapped_void_ptr_original = memoryCpuUpload_mapped_void_ptr;
-  vkfast->memoryCpuUpload_mapped_void_ptr_offset = memoryCpuUpload_mapped_void_ptr;
-  vkfast->memoryCpuUpload_memory_suballocations_offset = 0;
-  vkfast->memoryCpuReadback_array = memoryCpuReadback_array;
-  vkfast->memoryCpuReadback_memory = memoryCpuReadback_memory;
-  vkfast->memoryCpuReadback_mapped_void_ptr_original = memoryCpuReadback_mapped_void_ptr;
-  vkfast->memoryCpuReadback_mapped_void_ptr_offset = memoryCpuReadback_mapped_void_ptr;
-  vkfast->memoryCpuReadback_memory_suballocations_offset = 0;
-  vkfast->windowHandle = NULL;
-  vkfast->windowHandleDoDestroy = 0;
-  vkfast->screenWidth = 0;
-  vkfast->screenHeight = 0;
-  vkfast->presentQueueIndex;
-  vkfast->surface = NULL;
-  vkfast->present = NULL;
-  vkfast->presentImages[0] = NULL;
-  vkfast->presentImages[1] = NULL;
-  vkfast->presentImages[2] = NULL;
-  vkfast->presentCpuSignal = NULL;
-  vkfast->presentGpuSignalAcquire = NULL;
-  vkfast->presentGpuSignalSubmit = NULL;
-  vkfast->presentCopyCalls = presentCopyCalls;
-  vkfast->presentPixelsCpuUpload_memory_allocation_size = internalMemoryAllocationSizeCpuVisiblePresentPixels;
-  vkfast->presentPixelsCpuUpload_memory_and_array = REDGPU_32_STRUCT(Red2Array, 0);
-  vkfast->presentPixelsCpuUpload_void_ptr_original = NULL;
-  vkfast->presentVsyncMode = RED_PRESENT_VSYNC_MODE_ON;
-  vkfast->presentImagesCount = 3;
+  uint64_t arraysCount     = 16;
+  uint64_t texturesROCount = 4;
+  uint64_t texturesRWCount = 4;
+  {
+    uint64_t setArraysCount     = 0;
+    uint64_t setTexturesROCount = 0;
+    uint64_t setTexturesRWCount = 0;
+    for (uint64_t i = 0; i < slotsCount; i += 1) {
+      if (slots[i].type == RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW) { setArraysCount     += slots[i].count; }
+      if (slots[i].type == RED_STRUCT_MEMBER_TYPE_TEXTURE_RO)  { setTexturesROCount += slots[i].count; }
+      if (slots[i].type == RED_STRUCT_MEMBER_TYPE_TEXTURE_RW)  { setTexturesRWCount += slots[i].count; }
+    }
+    arraysCount     = setArraysCount     > arraysCount     ? setArraysCount     : arraysCount;
+    texturesROCount = setTexturesROCount > texturesROCount ? setTexturesROCount : texturesROCount;
+    texturesRWCount = setTexturesRWCount > texturesRWCount ? setTexturesRWCount : texturesRWCount;
+  }
+  const uint64_t maxStructsCount = 64ULL << (poolsCount < 10 ? poolsCount : 10);
 
-  return (gpu_handle_context_t)(void *)vkfast;
-}
+  // To destroy
+  RedHandleStructsMemory structsMemory = NULL;
+  np(redStructsMemoryAllocate,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "handleName", "vkFast bindings sets cache",
+    "maxStructsCount", maxStructsCount,
+    "maxStructsMembersOfTypeArrayROConstantCount", 0,
+    "maxStructsMembersOfTypeArrayROOrArrayRWCount", maxStructsCount * arraysCount,
+    "maxStructsMembersOfTypeTextureROCount", maxStructsCount * texturesROCount,
+    "maxStructsMembersOfTypeTextureRWCount", maxStructsCount * texturesRWCount,
+    "outStructsMemory", &structsMemory,
+    "outStatuses", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+  REDGPU_2_EXPECTWG(structsMemory != NULL);
 
-GPU_API_PRE gpu_handle_context_t GPU_API_POST vfContextInit(int enable_debug_mode, const gpu_context_optional_parameters_t * optional_parameters, const char * optionalFile, int optionalLine) {
-  return vfInternalContextInit(enable_debug_mode, 0, optional_parameters, NULL, NULL, optionalFile, optionalLine);
+  outMaxStructsCount[0] = maxStructsCount;
+  return structsMemory;
 }
 
-GPU_API_PRE gpu_handle_context_t GPU_API_POST vfContextInitEx(int enable_debug_mode, unsigned gpu_index, const gpu_context_optional_parameters_t * optional_parameters, const char * optionalFile, int optionalLine) {
-  return vfInternalContextInit(enable_debug_mode, gpu_index, optional_parameters, NULL, NULL, optionalFile, optionalLine);
-}
+// NOTE(Constantine): Called with bindingsSetsLock taken.
+static uint64_t vfInternalBindingsSetsPoolAdd(vf_handle_context_t * vkfast, RedHandleStructsMemory structsMemory, uint64_t maxStructsCount) {
+  if (vkfast->bindingsSetsPoolsCount == vkfast->bindingsSetsPoolsCapacity) {
+    const uint64_t capacity = vkfast->bindingsSetsPoolsCapacity == 0 ? VF_BINDINGS_SETS_POOLS_SOFT_MAX_COUNT : vkfast->bindingsSetsPoolsCapacity * 2;
+    // To free
+    vf_bindings_sets_pool_t * pools = (vf_bindings_sets_pool_t *)red32MemoryCalloc(sizeof(vf_bindings_sets_pool_t) * capacity);
+    REDGPU_2_EXPECTWG(pools != NULL);
+    if (vkfast->bindingsSetsPools != NULL) {
+      red32MemoryCopy(pools, vkfast->bindingsSetsPools, sizeof(vf_bindings_sets_pool_t) * vkfast->bindingsSetsPoolsCount);
+      red32MemoryFree(vkfast->bindingsSetsPools);
+    }
+    vkfast->bindingsSetsPools         = pools;
+    vkfast->bindingsSetsPoolsCapacity = capacity;
+  }
 
-GPU_API_PRE gpu_handle_context_t GPU_API_POST vfContextInitEx2(int enable_debug_mode, unsigned gpu_index, const gpu_context_optional_parameters_t * optional_parameters, const gpu_context_ex2_parameters_t * optional_ex2_parameters, const char * optionalFile, int optionalLine) {
-  return vfInternalContextInit(enable_debug_mode, 0, optional_parameters, optional_ex2_parameters, NULL, optionalFile, optionalLine);
-}
+  const uint64_t poolIndex = vkfast->bindingsSetsPoolsCount;
 
-GPU_API_PRE gpu_handle_context_t GPU_API_POST vfContextInitEx3(int enable_debug_mode, unsigned gpu_index, const gpu_context_optional_parameters_t * optional_parameters, const gpu_context_ex2_parameters_t * optional_ex2_parameters, const gpu_context_ex3_parameters_t * optional_ex3_parameters, const char * optionalFile, int optionalLine) {
-  return vfInternalContextInit(enable_debug_mode, 0, optional_parameters, optional_ex2_parameters, optional_ex3_parameters, optionalFile, optionalLine);
+  // Filling
+  vf_bindings_sets_pool_t;
+  vkfast->bindingsSetsPools[poolIndex].structsMemory   = structsMemory;
+  vkfast->bindingsSetsPools[poolIndex].maxStructsCount = maxStructsCount;
+  vkfast->bindingsSetsPools[poolIndex].structsCount    = 0;
+  vkfast->bindingsSetsPools[poolIndex].lastUse         = 0;
+  vkfast->bindingsSetsPoolsCount += 1;
+
+  return poolIndex;
 }
 
-GPU_API_PRE void GPU_API_POST vfIdDestroy(uint64_t ids_count, const uint64_t * ids, const char * optionalFile, int optionalLine) {
-  for (uint64_t i = 0; i < ids_count; i += 1) {
-    vf_handle_t * handle = (vf_handle_t *)(void *)ids[i];
-    if (handle == NULL) {
-      continue;
+// NOTE(Constantine): Returns the least recently used pool with no referenced bindings sets, or -1 if every pool is referenced.
+static uint64_t vfInternalBindingsSetsFindEvictablePool(vf_handle_context_t * vkfast) {
+  uint64_t poolIndex = (uint64_t)-1;
+  for (uint64_t i = 0; i < vkfast->bindingsSetsPoolsCount; i += 1) {
+    int isReferenced = 0;
+    for (uint64_t j = 0; j < vkfast->bindingsSetsCount; j += 1) {
+      if (vkfast->bindingsSets[j]->poolIndex == i && vkfast->bindingsSets[j]->referencesCount > 0) {
+        isReferenced = 1;
+        break;
+      }
     }
-    if (handle->handle_id == VF_HANDLE_ID_INVALID) {
+    if (isReferenced == 1) {
       continue;
     }
+    if (poolIndex == (uint64_t)-1 || vkfast->bindingsSetsPools[i].lastUse < vkfast->bindingsSetsPools[poolIndex].lastUse) {
+      poolIndex = i;
+    }
+  }
+  return poolIndex;
+}
 
-    if (handle->handle_id == VF_HANDLE_ID_GPU_CODE) {
-      np(red2DestroyHandle,
-        "context", handle->vkfast->context,
-        "gpu", handle->vkfast->gpu,
-        "handleType", RED_HANDLE_TYPE_GPU_CODE,
-        "handle", handle->gpuCode.gpuCode,
-        "optionalHandle2", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
+static void vfInternalBindingsSetsPoolReset(vf_handle_context_t * vkfast, uint64_t poolIndex, const char * optionalFile, int optionalLine) {
+  for (uint64_t i = 0; i < vkfast->bindingsSetsCount;) {
+    vf_bindings_set_t * set = vkfast->bindingsSets[i];
+    if (set->poolIndex == poolIndex) {
+      vfInternalHashIndexRemove(&vkfast->bindingsSetsIndex, set->keyHash, i);
+      red32MemoryFree(set->keyWords);
+      red32MemoryFree(set);
+      const uint64_t last = vkfast->bindingsSetsCount - 1;
+      if (i != last) {
+        vfInternalHashIndexMove(&vkfast->bindingsSetsIndex, vkfast->bindingsSets[last]->keyHash, last, i);
+        vkfast->bindingsSets[i] = vkfast->bindingsSets[last];
+      }
+      vkfast->bindingsSetsCount -= 1;
       continue;
     }
+    i += 1;
+  }
+  np(redStructsMemoryReset,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "structsMemory", vkfast->bindingsSetsPools[poolIndex].structsMemory,
+    "outStatuses", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+  vkfast->bindingsSetsPools[poolIndex].structsCount = 0;
+  vkfast->bindingsSetsPools[poolIndex].lastUse      = 0;
+  vkfast->bindingsSetsPoolResetsCount += 1;
+}
 
-    if (handle->handle_id == VF_HANDLE_ID_PROCEDURE) {
-      np(red2DestroyHandle,
-        "context", handle->vkfast->context,
-        "gpu", handle->vkfast->gpu,
-        "handleType", RED_HANDLE_TYPE_PROCEDURE_PARAMETERS,
-        "handle", handle->procedure.procedureParameters.procedureParameters,
-        "optionalHandle2", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      for (int i = 0; i < 7; i += 1) {
-        np(red2DestroyHandle,
-          "context", handle->vkfast->context,
-          "gpu", handle->vkfast->gpu,
-          "handleType", RED_HANDLE_TYPE_STRUCT_DECLARATION,
-          "handle", handle->procedure.procedureParameters.structsDeclarations[i],
-          "optionalHandle2", NULL,
-          "optionalFile", optionalFile,
-          "optionalLine", optionalLine,
-          "optionalUserData", NULL
-        );
+// NOTE(Constantine): Called with bindingsSetsLock taken. Returns NULL if no cached set has the key.
+static vf_bindings_set_t * vfInternalBindingsSetFind(vf_handle_context_t * vkfast, uint64_t keyHash, uint64_t keyWordsCount, const uint64_t * keyWords) {
+  if (vkfast->bindingsSetsCount == 0) {
+    return NULL;
+  }
+  uint64_t cursor = 0;
+  for (uint64_t e = vfInternalHashIndexNext(&vkfast->bindingsSetsIndex, keyHash, &cursor); e != 0; e = vfInternalHashIndexNext(&vkfast->bindingsSetsIndex, keyHash, &cursor)) {
+    vf_bindings_set_t * cached = vkfast->bindingsSets[e - 1];
+    if (cached->keyWordsCount == keyWordsCount && memcmp(cached->keyWords, keyWords, sizeof(uint64_t) * keyWordsCount) == 0) {
+      return cached;
+    }
+  }
+  return NULL;
+}
+
+// NOTE(Constantine): Called with bindingsSetsLock taken, drops and retakes it around a pool growth. Sets outIsCreated to 0 if another thread
+// created a set with the same key meanwhile, that set is returned then.
+static vf_bindings_set_t * vfInternalBindingsSetCreate(vf_handle_context_t * vkfast, uint64_t keyHash, uint64_t keyWordsCount, const uint64_t * keyWords, int * outIsCreated, const char * optionalFile, int optionalLine) {
+  RedHandleGpu gpu = vkfast->gpu;
+
+  const uint64_t                     slotsCount      = keyWords[0];
+  const RedStructDeclarationMember * slots           = (const RedStructDeclarationMember *)(const void *)&keyWords[1];
+  const uint64_t                     slotsWordsCount = (sizeof(RedStructDeclarationMember) * slotsCount + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+  outIsCreated[0] = 1;
+
+  uint64_t   poolIndex   = (uint64_t)-1;
+  Red2Struct structure   = {0};
+  while (poolIndex == (uint64_t)-1) {
+    for (uint64_t i = 0; i < vkfast->bindingsSetsPoolsCount; i += 1) {
+      if (vfInternalBindingsSetsTrySuballocate(vkfast, i, slotsCount, slots, &structure, optionalFile, optionalLine) == 1) {
+        poolIndex = i;
+        break;
       }
-      np(red2DestroyHandle,
-        "context", handle->vkfast->context,
-        "gpu", handle->vkfast->gpu,
-        "handleType", RED_HANDLE_TYPE_STRUCT_DECLARATION,
-        "handle", handle->procedure.procedureParameters.handlesDeclaration,
-        "optionalHandle2", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      np(red2DestroyHandle,
-        "context", handle->vkfast->context,
-        "gpu", handle->vkfast->gpu,
-        "handleType", RED_HANDLE_TYPE_PROCEDURE,
-        "handle", handle->procedure.procedure,
-        "optionalHandle2", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      continue;
     }
+    if (poolIndex == (uint64_t)-1 && vkfast->bindingsSetsPoolsCount >= VF_BINDINGS_SETS_POOLS_SOFT_MAX_COUNT) {
+      const uint64_t evictablePoolIndex = vfInternalBindingsSetsFindEvictablePool(vkfast);
+      if (evictablePoolIndex != (uint64_t)-1) {
+        vfInternalBindingsSetsPoolReset(vkfast, evictablePoolIndex, optionalFile, optionalLine);
+        if (vfInternalBindingsSetsTrySuballocate(vkfast, evictablePoolIndex, slotsCount, slots, &structure, optionalFile, optionalLine) == 1) {
+          poolIndex = evictablePoolIndex;
+        }
+      }
+    }
+    if (poolIndex == (uint64_t)-1) {
+      // NOTE(Constantine): Every pool is full and referenced by recorded batches, grow past the soft max. The structs memory is allocated
+      // with bindingsSetsLock dropped so other threads' cache hits don't spin on a driver allocation. Pools other threads added meanwhile
+      // are tried again with the new one, after checking that none of them created this set.
+      const uint64_t poolsCount = vkfast->bindingsSetsPoolsCount;
+      vfInternalSpinUnlock(&vkfast->bindingsSetsLock);
+      uint64_t maxStructsCount = 0;
+      RedHandleStructsMemory structsMemory = vfInternalBindingsSetsPoolAllocate(vkfast, poolsCount, slotsCount, slots, &maxStructsCount, optionalFile, optionalLine);
+      vfInternalSpinLock(&vkfast->bindingsSetsLock);
+      vfInternalBindingsSetsPoolAdd(vkfast, structsMemory, maxStructsCount);
+      vf_bindings_set_t * created = vfInternalBindingsSetFind(vkfast, keyHash, keyWordsCount, keyWords);
+      if (created != NULL) {
+        outIsCreated[0] = 0;
+        return created;
+      }
+    }
+  }
 
-    if (handle->handle_id == VF_HANDLE_ID_BATCH) {
-      np(red2DestroyHandle,
-        "context", handle->vkfast->context,
-        "gpu", handle->vkfast->gpu,
-        "handleType", RED_HANDLE_TYPE_STRUCTS_MEMORY,
-        "handle", handle->batch.structsMemory,
-        "optionalHandle2", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      np(red2DestroyHandle,
-        "context", handle->vkfast->context,
-        "gpu", handle->vkfast->gpu,
-        "handleType", RED_HANDLE_TYPE_STRUCTS_MEMORY,
-        "handle", handle->batch.structsMemorySamplers,
-        "optionalHandle2", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      np(red2DestroyHandle,
-        "context", handle->vkfast->context,
-        "gpu", handle->vkfast->gpu,
-        "handleType", RED_HANDLE_TYPE_STRUCT_DECLARATION,
-        "handle", handle->batch.currentStructSamplers.handleDeclaration,
-        "optionalHandle2", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      np(red2DestroyHandle,
-        "context", handle->vkfast->context,
-        "gpu", handle->vkfast->gpu,
-        "handleType", RED_HANDLE_TYPE_CALLS,
-        "handle", handle->batch.calls.handle,
-        "optionalHandle2", handle->batch.calls.memory,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      continue;
+  for (uint64_t w = 1 + slotsWordsCount; w < keyWordsCount;) {
+    const uint64_t slot      = keyWords[w + 0];
+    const int      isTexture = keyWords[w + 1] == RED_STRUCT_MEMBER_TYPE_TEXTURE_RW;
+    const uint64_t count     = keyWords[w + 2];
+    w += 3;
+
+    RedStructMember member = {0};
+    member.setTo35   = 35;
+    member.setTo0    = 0;
+    member.structure = structure.handle;
+    member.slot      = slot;
+    member.first     = 0;
+    member.count     = count;
+    member.type      = isTexture == 1 ? RED_STRUCT_MEMBER_TYPE_TEXTURE_RW : RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+    member.textures  = isTexture == 1 ? (const RedStructMemberTexture *)(const void *)&keyWords[w] : NULL;
+    member.arrays    = isTexture == 1 ? NULL : (const RedStructMemberArray *)(const void *)&keyWords[w];
+    member.setTo00   = 0;
+    np(redStructsSet,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "structsMembersCount", 1,
+      "structsMembers", &member,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+
+    const uint64_t bindBytesCount = count * (isTexture == 1 ? sizeof(RedStructMemberTexture) : sizeof(RedStructMemberArray));
+    w += (bindBytesCount + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+  }
+
+  np(red2DestroyHandle,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "handleType", RED_HANDLE_TYPE_STRUCT_DECLARATION,
+    "handle", structure.handleDeclaration,
+    "optionalHandle2", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+
+  if (vkfast->bindingsSetsCount == vkfast->bindingsSetsCapacity) {
+    const uint64_t capacity = vkfast->bindingsSetsCapacity == 0 ? 64 : vkfast->bindingsSetsCapacity * 2;
+    // To free
+    vf_bindings_set_t ** sets = (vf_bindings_set_t **)red32MemoryCalloc(sizeof(vf_bindings_set_t *) * capacity);
+    REDGPU_2_EXPECTWG(sets != NULL);
+    if (vkfast->bindingsSets != NULL) {
+      red32MemoryCopy(sets, vkfast->bindingsSets, sizeof(vf_bindings_set_t *) * vkfast->bindingsSetsCount);
+      red32MemoryFree(vkfast->bindingsSets);
     }
+    vkfast->bindingsSets         = sets;
+    vkfast->bindingsSetsCapacity = capacity;
   }
 
-  for (uint64_t i = 0; i < ids_count; i += 1) {
-    vf_handle_t * handle = (vf_handle_t *)(void *)ids[i];
-    red32MemoryFree(handle); // NOTE(Constantine): Internally, all handles must be allocated, except for async_id.
+  // To free
+  vf_bindings_set_t * set = (vf_bindings_set_t *)red32MemoryCalloc(sizeof(vf_bindings_set_t));
+  REDGPU_2_EXPECTWG(set != NULL);
+  // To free
+  uint64_t * setKeyWords = (uint64_t *)red32MemoryCalloc(sizeof(uint64_t) * keyWordsCount);
+  REDGPU_2_EXPECTWG(setKeyWords != NULL);
+  red32MemoryCopy(setKeyWords, keyWords, sizeof(uint64_t) * keyWordsCount);
+
+  // Filling
+  vf_bindings_set_t;
+  set->keyHash         = keyHash;
+  set->keyWordsCount   = keyWordsCount;
+  set->keyWords        = setKeyWords;
+  set->structure       = structure.handle;
+  set->poolIndex       = poolIndex;
+  set->referencesCount = 0;
+  set->lastUse         = 0;
+  vfInternalHashIndexReserve(&vkfast->bindingsSetsIndex, vkfast->bindingsSetsCount + 1);
+  vfInternalHashIndexInsert(&vkfast->bindingsSetsIndex, keyHash, vkfast->bindingsSetsCount);
+  vkfast->bindingsSets[vkfast->bindingsSetsCount] = set;
+  vkfast->bindingsSetsCount += 1;
+
+  return set;
+}
+
+static RedHandleStruct vfInternalBindingsSetsAcquire(vf_handle_t * batch, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = batch->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+
+  const uint64_t   keyWordsCount = batch->batch.pendingBindingsSetKeyWordsCount;
+  const uint64_t * keyWords      = batch->batch.pendingBindingsSetKeyWords;
+  const uint64_t   keyHash       = vfInternalHashWords(keyWords, keyWordsCount);
+
+  vfInternalSpinLock(&vkfast->bindingsSetsLock);
+  vf_bindings_set_t * set = vfInternalBindingsSetFind(vkfast, keyHash, keyWordsCount, keyWords);
+  int isCreated = 0;
+  if (set == NULL) {
+    set = vfInternalBindingsSetCreate(vkfast, keyHash, keyWordsCount, keyWords, &isCreated, optionalFile, optionalLine);
   }
+  if (isCreated == 1) {
+    vkfast->bindingsSetsMissesCount += 1;
+  } else {
+    vkfast->bindingsSetsHitsCount += 1;
+  }
+  vkfast->bindingsSetsUseClock += 1;
+  set->lastUse = vkfast->bindingsSetsUseClock;
+  vkfast->bindingsSetsPools[set->poolIndex].lastUse = vkfast->bindingsSetsUseClock;
+  set->referencesCount += 1;
+  const RedHandleStruct structure = set->structure;
+  vfInternalSpinUnlock(&vkfast->bindingsSetsLock);
+
+  // NOTE(Constantine): The set can't be evicted until the batch releases it, so the batch list is grown outside of the lock.
+  if (batch->batch.referencedBindingsSetsCount == batch->batch.referencedBindingsSetsCapacity) {
+    const uint64_t capacity = batch->batch.referencedBindingsSetsCapacity == 0 ? 16 : batch->batch.referencedBindingsSetsCapacity * 2;
+    // To free
+    vf_bindings_set_t ** sets = (vf_bindings_set_t **)red32MemoryCalloc(sizeof(vf_bindings_set_t *) * capacity);
+    REDGPU_2_EXPECTWG(sets != NULL);
+    if (batch->batch.referencedBindingsSets != NULL) {
+      red32MemoryCopy(sets, batch->batch.referencedBindingsSets, sizeof(vf_bindings_set_t *) * batch->batch.referencedBindingsSetsCount);
+      red32MemoryFree(batch->batch.referencedBindingsSets);
+    }
+    batch->batch.referencedBindingsSets         = sets;
+    batch->batch.referencedBindingsSetsCapacity = capacity;
+  }
+  batch->batch.referencedBindingsSets[batch->batch.referencedBindingsSetsCount] = set;
+  batch->batch.referencedBindingsSetsCount += 1;
+
+  return structure;
 }
 
-GPU_API_PRE void GPU_API_POST vfContextDeinit(gpu_handle_context_t context, const char * optionalFile, int optionalLine) {
+static uint64_t vfInternalBatchBegin(gpu_handle_context_t context, uint64_t existing_batch_id, const gpu_batch_info_t * batch_info, unsigned queue_family_index, const char * optional_debug_name, const char * optionalFile, int optionalLine) {
+  vf_handle_t * handle = (vf_handle_t *)(void *)existing_batch_id;
+  
   vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
 
-  vfAllQueuesWaitIdle(context, optionalFile, optionalLine);
+  RedHandleGpu gpu = vkfast->gpu;
 
-  // NOTE(Constantine): WSI.
-  {
-    if (vkfast->presentPixelsCpuUpload_memory_and_array.handleAllocatedDedicatedOrMappableMemoryOrPickedMemory != NULL) {
-      np(redMemoryUnmap,
-        "context", vkfast->context,
-        "gpu", vkfast->gpu,
-        "mappableMemory", vkfast->presentPixelsCpuUpload_memory_and_array.handleAllocatedDedicatedOrMappableMemoryOrPickedMemory,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-    }
-    np(red2DestroyHandle,
+  if (handle == NULL) {
+    // To destroy
+    RedCalls calls = {0};
+    np(redCreateCallsReusable,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "handleType", RED_HANDLE_TYPE_ARRAY,
-      "handle", vkfast->presentPixelsCpuUpload_memory_and_array.array.handle,
-      "optionalHandle2", NULL,
+      "handleName", optional_debug_name,
+      "queueFamilyIndex", vkfast->gpuInfo->queuesFamilyIndex[queue_family_index],
+      "outCalls", &calls,
+      "outStatuses", NULL,
       "optionalFile", optionalFile,
       "optionalLine", optionalLine,
       "optionalUserData", NULL
     );
-    np(red2DestroyHandle,
+    REDGPU_2_EXPECTWG(calls.handle != NULL);
+  
+    RedCallProceduresAndAddresses addresses = {0};
+    np(redGetCallProceduresAndAddresses,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "handleType", RED_HANDLE_TYPE_MEMORY,
-      "handle", vkfast->presentPixelsCpuUpload_memory_and_array.handleAllocatedDedicatedOrMappableMemoryOrPickedMemory,
-      "optionalHandle2", NULL,
+      "outCallProceduresAndAddresses", &addresses,
+      "outStatuses", NULL,
       "optionalFile", optionalFile,
       "optionalLine", optionalLine,
       "optionalUserData", NULL
     );
 
-    np(red2DestroyHandle,
-      "context", vkfast->context,
-      "gpu", vkfast->gpu,
-      "handleType", RED_HANDLE_TYPE_CALLS,
-      "handle", vkfast->presentCopyCalls.handle,
-      "optionalHandle2", vkfast->presentCopyCalls.memory,
-      "optionalFile", optionalFile,
-      "optionalLine", optionalLine,
-      "optionalUserData", NULL
-    );
+    const int useBindingsSetsCache = batch_info != NULL && batch_info->use_bindings_sets_cache == 1;
+
+    RedHandleStructsMemory structsMemory = 0;
+    if (batch_info != NULL && useBindingsSetsCache == 0) {
+      if (batch_info->max_new_bindings_sets_count > 0) {
+        // To destroy
+        np(redStructsMemoryAllocate,
+          "context", vkfast->context,
+          "gpu", vkfast->gpu,
+          "handleName", optional_debug_name,
+          "maxStructsCount", batch_info->max_new_bindings_sets_count,
+          "maxStructsMembersOfTypeArrayROConstantCount", 0,
+          "maxStructsMembersOfTypeArrayROOrArrayRWCount", batch_info->max_storage_binds_count,
+          "maxStructsMembersOfTypeTextureROCount", batch_info->max_texture_ro_binds_count,
+          "maxStructsMembersOfTypeTextureRWCount", batch_info->max_texture_rw_binds_count,
+          "outStructsMemory", &structsMemory,
+          "outStatuses", NULL,
+          "optionalFile", optionalFile,
+          "optionalLine", optionalLine,
+          "optionalUserData", NULL
+        );
+        REDGPU_2_EXPECTWG(structsMemory != NULL);
+      }
+    }
+
+    RedHandleStructsMemory structsMemorySamplers = NULL;
+    if (batch_info != NULL) {
+      if (batch_info->max_sampler_binds_count > 0) {
+        REDGPU_2_EXPECTWG(batch_info->max_sampler_binds_count <= 4000);
+        // To destroy
+        np(redStructsMemoryAllocateSamplers,
+          "context", vkfast->context,
+          "gpu", vkfast->gpu,
+          "handleName", optional_debug_name,
+          "maxStructsCount", 1, // NOTE(Constantine): Only one samplers struct per command list for now.
+          "maxStructsMembersOfTypeSamplerCount", batch_info->max_sampler_binds_count,
+          "outStructsMemory", &structsMemorySamplers,
+          "outStatuses", NULL,
+          "optionalFile", optionalFile,
+          "optionalLine", optionalLine,
+          "optionalUserData", NULL
+        );
+        REDGPU_2_EXPECTWG(structsMemorySamplers != NULL);
+      }
+    }
+
+    // To free
+    handle = (vf_handle_t *)red32MemoryCalloc(sizeof(vf_handle_t));
+    REDGPU_2_EXPECTWG(handle != NULL);
 
-    np(red2DestroyHandle,
+    // Filling
+    vf_handle_t;
+    vf_handle_batch_t;
+    handle->vkfast                                  = vkfast;
+    handle->handle_id                               = VF_HANDLE_ID_BATCH;
+    handle->batch.calls                              = calls;
+    handle->batch.addresses                          = addresses;
+    handle->batch.structsMemory                      = structsMemory;
+    handle->batch.structsMemorySamplers              = structsMemorySamplers;
+    handle->batch.currentStruct                      = REDGPU_32_STRUCT(Red2Struct, 0);
+    handle->batch.currentStructSamplers              = REDGPU_32_STRUCT(Red2Struct, 0); // NOTE(Constantine): Set below.
+    handle->batch.currentProcedureParametersCompute  = NULL;
+    handle->batch.useBindingsSetsCache               = useBindingsSetsCache;
+    handle->batch.pendingBindingsSetIsOpen           = 0;
+    handle->batch.pendingBindingsSetKeyWordsCount    = 0;
+    handle->batch.pendingBindingsSetKeyWordsCapacity = 0;
+    handle->batch.pendingBindingsSetKeyWords         = NULL;
+    handle->batch.referencedBindingsSetsCount        = 0;
+    handle->batch.referencedBindingsSetsCapacity     = 0;
+    handle->batch.referencedBindingsSets             = NULL;
+  }
+
+  vfInternalBatchReleaseBindingsSets(handle);
+  handle->batch.pendingBindingsSetIsOpen        = 0;
+  handle->batch.pendingBindingsSetKeyWordsCount = 0;
+
+  np(redCallsSet,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "calls", handle->batch.calls.handle,
+    "callsMemory", handle->batch.calls.memory,
+    "callsReusable", handle->batch.calls.reusable,
+    "outStatuses", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
+
+  if (handle->batch.structsMemory != NULL) {
+    np(redStructsMemoryReset,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "handleType", RED_HANDLE_TYPE_CPU_SIGNAL,
-      "handle", vkfast->presentCpuSignal,
-      "optionalHandle2", NULL,
+      "structsMemory", handle->batch.structsMemory,
+      "outStatuses", NULL,
       "optionalFile", optionalFile,
       "optionalLine", optionalLine,
       "optionalUserData", NULL
     );
+  }
 
-    np(red2DestroyHandle,
+  if (handle->batch.structsMemorySamplers != NULL) {
+    np(redStructsMemoryReset,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "handleType", RED_HANDLE_TYPE_GPU_SIGNAL,
-      "handle", vkfast->presentGpuSignalAcquire,
-      "optionalHandle2", NULL,
+      "structsMemory", handle->batch.structsMemorySamplers,
+      "outStatuses", NULL,
       "optionalFile", optionalFile,
       "optionalLine", optionalLine,
       "optionalUserData", NULL
     );
-
     np(red2DestroyHandle,
-      "context", vkfast->context,
-      "gpu", vkfast->gpu,
-      "handleType", RED_HANDLE_TYPE_GPU_SIGNAL,
-      "handle", vkfast->presentGpuSignalSubmit,
+      "context", handle->vkfast->context,
+      "gpu", handle->vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_STRUCT_DECLARATION,
+      "handle", handle->batch.currentStructSamplers.handleDeclaration,
       "optionalHandle2", NULL,
       "optionalFile", optionalFile,
       "optionalLine", optionalLine,
       "optionalUserData", NULL
     );
-
-    np(red2DestroyHandle,
+    RedStructDeclarationMember samplers[4000] = {0}; // NOTE(Constantine): Kinda big on stack size, but whatever.
+    for (unsigned i = 0; i < batch_info->max_sampler_binds_count; i += 1) {
+      samplers[i].slot            = i;
+      samplers[i].type            = RED_STRUCT_MEMBER_TYPE_SAMPLER;
+      samplers[i].count           = 1;
+      samplers[i].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_FRAGMENT; // NOTE(Constantine): I doubt anyone needs to sample textures in vertex shaders?
+    }
+    Red2Struct currentStructSamplers = {0};
+    np(red2StructsMemorySuballocateStruct,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "handleType", RED_HANDLE_TYPE_PRESENT,
-      "handle", vkfast->present,
-      "optionalHandle2", NULL,
+      "handleName", optional_debug_name,
+      "structsMemory", handle->batch.structsMemorySamplers,
+      "structDeclarationMembersCount", batch_info->max_sampler_binds_count,
+      "structDeclarationMembers", samplers,
+      "structDeclarationMembersArrayROCount", 0,
+      "structDeclarationMembersArrayRO", NULL,
+      "outStruct", &currentStructSamplers,
+      "outStatuses", NULL,
       "optionalFile", optionalFile,
       "optionalLine", optionalLine,
       "optionalUserData", NULL
     );
+    REDGPU_2_EXPECTWG(currentStructSamplers.handleDeclaration != NULL);
+    REDGPU_2_EXPECTWG(currentStructSamplers.handle != NULL || !"red2StructsMemorySuballocateStruct() call returned NULL. Ran out of vfBatchBegin()::batch_bindings_info::max_new_bindings_sets_count and vfBatchBegin()::batch_bindings_info::max_sampler_binds_count memory to allocate?");
+    handle->batch.currentStructSamplers = currentStructSamplers;
+  }
 
-    np(red2DestroyHandle,
-      "context", vkfast->context,
-      "gpu", vkfast->gpu,
-      "handleType", RED_HANDLE_TYPE_SURFACE,
-      "handle", vkfast->surface,
-      "optionalHandle2", NULL,
-      "optionalFile", optionalFile,
-      "optionalLine", optionalLine,
-      "optionalUserData", NULL
+  if (handle->batch.structsMemory != NULL || handle->batch.structsMemorySamplers != NULL) {
+    // NOTE(Constantine): Oh God, I hope this call doesn't copy descriptors from structsMemory like redCallSetProcedureParametersStructs() :D
+    np(redCallSetStructsMemory,
+      "address", handle->batch.addresses.redCallSetStructsMemory,
+      "calls", handle->batch.calls.handle,
+      "structsMemory", handle->batch.structsMemory,
+      "structsMemorySamplers", handle->batch.structsMemorySamplers
     );
   }
 
-  np(red2DestroyHandle,
-    "context", vkfast->context,
-    "gpu", vkfast->gpu,
-    "handleType", RED_HANDLE_TYPE_ARRAY,
-    "handle", vkfast->memoryGpuVramForArrays_array.handle,
-    "optionalHandle2", NULL,
-    "optionalFile", optionalFile,
-    "optionalLine", optionalLine,
-    "optionalUserData", NULL
+  const uint64_t captureWords[11] = {
+    (uint64_t)(void *)handle,
+    existing_batch_id,
+    queue_family_index,
+    (uint64_t)(void *)handle->batch.calls.handle,
+    batch_info == NULL ? 0 : 1,
+    batch_info == NULL ? 0 : (uint64_t)batch_info->max_new_bindings_sets_count,
+    batch_info == NULL ? 0 : (uint64_t)batch_info->max_storage_binds_count,
+    batch_info == NULL ? 0 : (uint64_t)batch_info->max_texture_rw_binds_count,
+    batch_info == NULL ? 0 : (uint64_t)batch_info->max_texture_ro_binds_count,
+    batch_info == NULL ? 0 : (uint64_t)batch_info->max_sampler_binds_count,
+    batch_info == NULL ? 0 : (uint64_t)batch_info->use_bindings_sets_cache,
+  };
+  vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_BATCH_BEGIN, optionalLine, 11, captureWords, 0, NULL);
+
+  return (uint64_t)(void *)handle;
+}
+
+GPU_API_PRE uint64_t GPU_API_POST vfBatchBegin(gpu_handle_context_t context, uint64_t existing_batch_id, const gpu_batch_info_t * batch_info, const char * optional_debug_name, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+  return vfInternalBatchBegin(context, existing_batch_id, batch_info, vkfast->mainQueueFamilyIndex, optional_debug_name, optionalFile, optionalLine);
+}
+
+GPU_API_PRE uint64_t GPU_API_POST vfBatchBeginEx(gpu_handle_context_t context, uint64_t existing_batch_id, const gpu_batch_info_t * batch_info, unsigned queue_family_index, const char * optional_debug_name, const char * optionalFile, int optionalLine) {
+  return vfInternalBatchBegin(context, existing_batch_id, batch_info, queue_family_index, optional_debug_name, optionalFile, optionalLine);
+}
+
+GPU_API_PRE void GPU_API_POST vfBatchStorageCopyFromCpuToGpu(gpu_handle_context_t context, uint64_t batch_id, uint64_t from_cpu_storage_id, uint64_t to_gpu_storage_id, const char * optionalFile, int optionalLine) {
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
+  
+  vf_handle_t * from_cpu_storage = (vf_handle_t *)(void *)from_cpu_storage_id;
+  REDGPU_2_EXPECTWG(from_cpu_storage->handle_id == VF_HANDLE_ID_STORAGE);
+
+  vf_handle_t * to_gpu_storage = (vf_handle_t *)(void *)to_gpu_storage_id;
+  REDGPU_2_EXPECTWG(to_gpu_storage->handle_id == VF_HANDLE_ID_STORAGE);
+
+  RedCopyArrayRange range = {0};
+  range.arrayRBytesFirst  = from_cpu_storage->storage.arrayRangeInfo.arrayRangeBytesFirst;
+  range.arrayWBytesFirst  = to_gpu_storage->storage.arrayRangeInfo.arrayRangeBytesFirst;
+  range.bytesCount        = from_cpu_storage->storage.info.bytes_count;
+  npfp(redCallCopyArrayToArray, batch->batch.addresses.redCallCopyArrayToArray,
+    "calls", batch->batch.calls.handle,
+    "arrayR", from_cpu_storage->storage.arrayRangeInfo.array,
+    "arrayW", to_gpu_storage->storage.arrayRangeInfo.array,
+    "rangesCount", 1,
+    "ranges", &range
   );
-  np(red2DestroyHandle,
-    "context", vkfast->context,
-    "gpu", vkfast->gpu,
-    "handleType", RED_HANDLE_TYPE_MEMORY,
-    "handle", vkfast->memoryGpuVramForArrays_memory,
-    "optionalHandle2", NULL,
-    "optionalFile", optionalFile,
-    "optionalLine", optionalLine,
-    "optionalUserData", NULL
+
+  const uint64_t captureWords[3] = {batch_id, from_cpu_storage_id, to_gpu_storage_id};
+  vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_BATCH_COPY_FROM_CPU_TO_GPU, optionalLine, 3, captureWords, 0, NULL);
+}
+
+GPU_API_PRE void GPU_API_POST vfBatchStorageCopyFromGpuToCpu(gpu_handle_context_t context, uint64_t batch_id, uint64_t from_gpu_storage_id, uint64_t to_cpu_storage_id, const char * optionalFile, int optionalLine) {
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
+  
+  vf_handle_t * from_gpu_storage = (vf_handle_t *)(void *)from_gpu_storage_id;
+  REDGPU_2_EXPECTWG(from_gpu_storage->handle_id == VF_HANDLE_ID_STORAGE);
+
+  vf_handle_t * to_cpu_storage = (vf_handle_t *)(void *)to_cpu_storage_id;
+  REDGPU_2_EXPECTWG(to_cpu_storage->handle_id == VF_HANDLE_ID_STORAGE);
+
+  RedCopyArrayRange range = {0};
+  range.arrayRBytesFirst  = from_gpu_storage->storage.arrayRangeInfo.arrayRangeBytesFirst;
+  range.arrayWBytesFirst  = to_cpu_storage->storage.arrayRangeInfo.arrayRangeBytesFirst;
+  range.bytesCount        = from_gpu_storage->storage.info.bytes_count;
+  npfp(redCallCopyArrayToArray, batch->batch.addresses.redCallCopyArrayToArray,
+    "calls", batch->batch.calls.handle,
+    "arrayR", from_gpu_storage->storage.arrayRangeInfo.array,
+    "arrayW", to_cpu_storage->storage.arrayRangeInfo.array,
+    "rangesCount", 1,
+    "ranges", &range
   );
 
-  if (vkfast->memoryCpuUpload_memory != NULL) {
-    np(redMemoryUnmap,
-      "context", vkfast->context,
-      "gpu", vkfast->gpu,
-      "mappableMemory", vkfast->memoryCpuUpload_memory,
-      "optionalFile", optionalFile,
-      "optionalLine", optionalLine,
-      "optionalUserData", NULL
-    );
-  }
-  np(red2DestroyHandle,
-    "context", vkfast->context,
-    "gpu", vkfast->gpu,
-    "handleType", RED_HANDLE_TYPE_ARRAY,
-    "handle", vkfast->memoryCpuUpload_array.handle,
-    "optionalHandle2", NULL,
-    "optionalFile", optionalFile,
-    "optionalLine", optionalLine,
-    "optionalUserData", NULL
+  const uint64_t captureWords[3] = {batch_id, from_gpu_storage_id, to_cpu_storage_id};
+  vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_BATCH_COPY_FROM_GPU_TO_CPU, optionalLine, 3, captureWords, 0, NULL);
+}
+
+GPU_API_PRE void GPU_API_POST vfBatchStorageCopyRaw(gpu_handle_context_t context, uint64_t batch_id, RedHandleArray from_storage_raw, RedHandleArray to_storage_raw, const RedCopyArrayRange * range, const char * optionalFile, int optionalLine) {
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
+
+  npfp(redCallCopyArrayToArray, batch->batch.addresses.redCallCopyArrayToArray,
+    "calls", batch->batch.calls.handle,
+    "arrayR", from_storage_raw,
+    "arrayW", to_storage_raw,
+    "rangesCount", 1,
+    "ranges", range
   );
-  np(red2DestroyHandle,
-    "context", vkfast->context,
-    "gpu", vkfast->gpu,
-    "handleType", RED_HANDLE_TYPE_MEMORY,
-    "handle", vkfast->memoryCpuUpload_memory,
-    "optionalHandle2", NULL,
-    "optionalFile", optionalFile,
-    "optionalLine", optionalLine,
-    "optionalUserData", NULL
+}
+
+GPU_API_PRE void GPU_API_POST vfBatchBindProgramPipelineCompute(gpu_handle_context_t context, uint64_t batch_id, uint64_t program_pipeline_compute_id, const char * optionalFile, int optionalLine) {
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
+
+  vf_handle_t * program_pipeline_compute = (vf_handle_t *)(void *)program_pipeline_compute_id;
+  REDGPU_2_EXPECTWG(program_pipeline_compute->handle_id == VF_HANDLE_ID_PROCEDURE);
+  REDGPU_2_EXPECTWG(program_pipeline_compute->procedure.procedureType == VF_PROCEDURE_TYPE_COMPUTE);
+
+  npfp(redCallSetProcedure, batch->batch.addresses.redCallSetProcedure,
+    "calls", batch->batch.calls.handle,
+    "procedureType", RED_PROCEDURE_TYPE_COMPUTE,
+    "procedure", program_pipeline_compute->procedure.procedure
   );
 
-  if (vkfast->memoryCpuReadback_memory != NULL) {
-    np(redMemoryUnmap,
+  batch->batch.currentProcedureParametersCompute = program_pipeline_compute->procedure.procedureParameters.procedureParameters;
+
+  const uint64_t captureWords[2] = {batch_id, program_pipeline_compute_id};
+  vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_BATCH_BIND_PROGRAM_PIPELINE, optionalLine, 2, captureWords, 0, NULL);
+}
+
+GPU_API_PRE void GPU_API_POST vfBatchBindNewBindingsSet(gpu_handle_context_t context, uint64_t batch_id, int slots_count, const RedStructDeclarationMember * slots, const char * optionalFile, int optionalLine) {
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
+
+  REDGPU_2_EXPECTWG(batch->batch.structsMemory != NULL || batch->batch.useBindingsSetsCache == 1 || !"vfBatchBegin()::batch_bindings_info was set to NULL?");
+  if (batch->batch.currentProcedureParametersCompute == NULL) {
+    REDGPU_2_EXPECTWG(!"Was vfBatchBindProgramPipelineCompute() ever called previously?");
+  }
+
+  if (batch->batch.useBindingsSetsCache == 1) {
+    const uint64_t slotsCount = (uint64_t)slots_count;
+    batch->batch.pendingBindingsSetKeyWordsCount = 0;
+    vfInternalBindingsSetKeyAppend(batch, sizeof(uint64_t), &slotsCount);
+    vfInternalBindingsSetKeyAppend(batch, sizeof(RedStructDeclarationMember) * slots_count, slots);
+    batch->batch.pendingBindingsSetIsOpen = 1;
+  } else {
+    Red2Struct structure = {0};
+    np(red2StructsMemorySuballocateStruct,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "mappableMemory", vkfast->memoryCpuReadback_memory,
+      "handleName", NULL,
+      "structsMemory", batch->batch.structsMemory,
+      "structDeclarationMembersCount", slots_count,
+      "structDeclarationMembers", slots,
+      "structDeclarationMembersArrayROCount", 0,
+      "structDeclarationMembersArrayRO", NULL,
+      "outStruct", &structure,
+      "outStatuses", NULL,
       "optionalFile", optionalFile,
       "optionalLine", optionalLine,
       "optionalUserData", NULL
     );
+    REDGPU_2_EXPECTWG(structure.handleDeclaration != NULL);
+    REDGPU_2_EXPECTWG(structure.handle != NULL || !"red2StructsMemorySuballocateStruct() call returned NULL. Ran out of vfBatchBegin()::batch_bindings_info::max_new_bindings_sets_count and all the other vfBatchBegin()::batch_bindings_info::max_* memory to allocate?");
+    batch->batch.currentStruct = structure;
   }
-  np(red2DestroyHandle,
-    "context", vkfast->context,
-    "gpu", vkfast->gpu,
-    "handleType", RED_HANDLE_TYPE_ARRAY,
-    "handle", vkfast->memoryCpuReadback_array.handle,
-    "optionalHandle2", NULL,
-    "optionalFile", optionalFile,
-    "optionalLine", optionalLine,
-    "optionalUserData", NULL
-  );
-  np(red2DestroyHandle,
-    "context", vkfast->context,
-    "gpu", vkfast->gpu,
-    "handleType", RED_HANDLE_TYPE_MEMORY,
-    "handle", vkfast->memoryCpuReadback_memory,
-    "optionalHandle2", NULL,
-    "optionalFile", optionalFile,
-    "optionalLine", optionalLine,
-    "optionalUserData", NULL
+
+  np(redCallSetProcedureParameters,
+    "address", batch->batch.addresses.redCallSetProcedureParameters,
+    "calls", batch->batch.calls.handle,
+    "procedureType", RED_PROCEDURE_TYPE_COMPUTE,
+    "procedureParameters", batch->batch.currentProcedureParametersCompute
   );
 
-  if (vkfast->doNotDestroyRawContext == 0) {
-    np(redDestroyContext,
-      "context", vkfast->context,
-      "optionalFile", optionalFile,
-      "optionalLine", optionalLine,
-      "optionalUserData", NULL
-    );
+  if (vkfast->captureFile != NULL) {
+    // To free
+    uint64_t * captureWords = (uint64_t *)red32MemoryCalloc(sizeof(uint64_t) * (2 + 4 * slots_count));
+    REDGPU_2_EXPECTWG(captureWords != NULL);
+    captureWords[0] = batch_id;
+    captureWords[1] = (uint64_t)slots_count;
+    for (int i = 0; i < slots_count; i += 1) {
+      captureWords[2 + 4 * i + 0] = slots[i].slot;
+      captureWords[2 + 4 * i + 1] = slots[i].type;
+      captureWords[2 + 4 * i + 2] = slots[i].count;
+      captureWords[2 + 4 * i + 3] = slots[i].visibleToStages;
+    }
+    vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_BATCH_BIND_NEW_BINDINGS_SET, optionalLine, 2 + 4 * slots_count, captureWords, 0, NULL);
+    red32MemoryFree(captureWords);
   }
+}
 
-  if (vkfast->windowHandle != NULL && vkfast->windowHandleDoDestroy == 1) {
-    red32WindowDestroy(vkfast->windowHandle);
+GPU_API_PRE void GPU_API_POST vfBatchBindStorageRaw(gpu_handle_context_t context, uint64_t batch_id, int slot, int storage_raw_count, const RedStructMemberArray * storage_raw, const char * optionalFile, int optionalLine) {
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
+
+  REDGPU_2_EXPECTWG(batch->batch.currentStruct.handle != NULL || batch->batch.pendingBindingsSetIsOpen == 1 || !"Was vfBatchBindNewBindingsSet() ever called previously?");
+
+  for (int i = 0; i < storage_raw_count; i += 1) {
+    REDGPU_2_EXPECTWG(storage_raw[i].arrayRangeBytesCount <= vkfast->gpuInfo->maxArrayRORWStructMemberRangeBytesCount);
   }
 
-  if (vkfast->doNotFreeHandle == 0) {
-    red32MemoryFree(vkfast);
+  if (batch->batch.useBindingsSetsCache == 1) {
+    const uint64_t bindWords[3] = {(uint64_t)slot, RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW, (uint64_t)storage_raw_count};
+    vfInternalBindingsSetKeyAppend(batch, sizeof(bindWords), bindWords);
+    vfInternalBindingsSetKeyAppend(batch, sizeof(RedStructMemberArray) * storage_raw_count, storage_raw);
+    return;
   }
+
+  RedStructMember member = {0};
+  member.setTo35   = 35;
+  member.setTo0    = 0;
+  member.structure = batch->batch.currentStruct.handle;
+  member.slot      = slot;
+  member.first     = 0;
+  member.count     = storage_raw_count;
+  member.type      = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+  member.textures  = NULL;
+  member.arrays    = storage_raw;
+  member.setTo00   = 0;
+  np(redStructsSet,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "structsMembersCount", 1,
+    "structsMembers", &member,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
 }
 
-GPU_API_PRE RedContext GPU_API_POST vfContextGetRaw(gpu_handle_context_t context, const char * optionalFile, int optionalLine) {
-  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+GPU_API_PRE void GPU_API_POST vfBatchBindStorageSingle(gpu_handle_context_t context, uint64_t batch_id, int slot, uint64_t storage_id, const char * optionalFile, int optionalLine) {
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
 
-  REDGPU_2_EXPECT(vkfast != NULL);
+  RedStructMemberArray storageRaw = {0};
+  vfStorageGetRaw(context, storage_id, &storageRaw, optionalFile, optionalLine);
+  vfBatchBindStorageRaw(context, batch_id, slot, 1, &storageRaw, optionalFile, optionalLine);
 
-  return vkfast->context;
+  const uint64_t captureWords[6] = {batch_id, (uint64_t)slot, storage_id, 0, 0, 0};
+  vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_BATCH_BIND_STORAGE, optionalLine, 6, captureWords, 0, NULL);
 }
 
-GPU_API_PRE void GPU_API_POST vfContextResetAndInvalidateAllStorages(gpu_handle_context_t context, const char * optionalFile, int optionalLine) {
-  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+GPU_API_PRE void GPU_API_POST vfBatchBindStorageSingleLimited(gpu_handle_context_t context, uint64_t batch_id, int slot, uint64_t storage_id, uint64_t bytes_first, uint64_t bytes_count, const char * optionalFile, int optionalLine) {
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
 
-  vkfast->memoryGpuVramForArrays_memory_suballocations_offset = 0;
-  vkfast->memoryCpuUpload_mapped_void_ptr_offset = vkfast->memoryCpuUpload_mapped_void_ptr_original;
-  vkfast->memoryCpuUpload_memory_suballocations_offset = 0;
-  vkfast->memoryCpuReadback_mapped_void_ptr_offset = vkfast->memoryCpuReadback_mapped_void_ptr_original;
-  vkfast->memoryCpuReadback_memory_suballocations_offset = 0;
-}
+  RedStructMemberArray storageRaw = {0};
+  vfStorageGetRaw(context, storage_id, &storageRaw, optionalFile, optionalLine);
 
-#if defined(_WIN32)
-GPU_API_PRE void GPU_API_POST vfGetMainMonitorAreaRectangle(int * out4ints, const char * optionalFile, int optionalLine) {
-  // https://learn.microsoft.com/ru-ru/windows/win32/api/winuser/nf-winuser-monitorfrompoint
-  POINT point = {0};
-  HMONITOR hmonitor = MonitorFromPoint(point, MONITOR_DEFAULTTONEAREST);
+  const uint64_t range_bytes_first = storageRaw.arrayRangeBytesFirst;
+  const uint64_t range_bytes_count = storageRaw.arrayRangeBytesCount;
 
-  // https://learn.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-getmonitorinfoa
-  MONITORINFO monitorInfo = {0};
-  monitorInfo.cbSize = sizeof(MONITORINFO);
-  REDGPU_2_EXPECT(GetMonitorInfoA(hmonitor, &monitorInfo));
+  REDGPU_2_EXPECTWG(bytes_first < range_bytes_count);
 
-  out4ints[0] = monitorInfo.rcMonitor.left;
-  out4ints[1] = monitorInfo.rcMonitor.top;
-  out4ints[2] = monitorInfo.rcMonitor.right;
-  out4ints[3] = monitorInfo.rcMonitor.bottom;
-}
-#endif
+  const uint64_t available_bytes_count = range_bytes_count - bytes_first;
 
-#if defined(__linux__) && !defined(__ANDROID__)
-GPU_API_PRE void GPU_API_POST vfGetMainMonitorAreaRectangle(int * out4ints, const char * optionalFile, int optionalLine) {
-  Display * display = XOpenDisplay(NULL);
-  REDGPU_2_EXPECT(display != NULL);
+  REDGPU_2_EXPECTWG(bytes_count <= available_bytes_count);
 
-  int screen = DefaultScreen(display);
+  storageRaw.arrayRangeBytesFirst = range_bytes_first + bytes_first;
+  storageRaw.arrayRangeBytesCount = bytes_count;
 
-  out4ints[0] = 0;
-  out4ints[1] = 0;
-  out4ints[2] = (int)DisplayWidth(display, screen);
-  out4ints[3] = (int)DisplayHeight(display, screen);
+  vfBatchBindStorageRaw(context, batch_id, slot, 1, &storageRaw, optionalFile, optionalLine);
 
-  XCloseDisplay(display);
-  display = NULL;
+  const uint64_t captureWords[6] = {batch_id, (uint64_t)slot, storage_id, bytes_first, bytes_count, 1};
+  vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_BATCH_BIND_STORAGE, optionalLine, 6, captureWords, 0, NULL);
 }
-#endif
-
-static int vfInternalRebuildPresent(gpu_handle_context_t context, RedPresentVsyncMode presentVsyncMode, int presentImagesCount, const char * optionalFile, int optionalLine) {
-  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
 
+GPU_API_PRE void GPU_API_POST vfBatchBindStorageSingleCapped(gpu_handle_context_t context, uint64_t batch_id, int slot, uint64_t storage_id, uint64_t bytes_first, uint64_t bytes_count_cap, const char * optionalFile, int optionalLine) {
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
   RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
 
-  REDGPU_2_EXPECT(presentImagesCount == 2 || presentImagesCount == 3);
+  RedStructMemberArray storageRaw = {0};
+  vfStorageGetRaw(context, storage_id, &storageRaw, optionalFile, optionalLine);
 
-  RedHandlePresent present = NULL;
-  RedHandleImage presentImages[3] = {0};
+  const uint64_t range_bytes_first = storageRaw.arrayRangeBytesFirst;
+  const uint64_t range_bytes_count = storageRaw.arrayRangeBytesCount;
 
-  // NOTE(Constantine): Destroying previous possible present resources.
-  {
-    // NOTE(Constantine):
-    // Intentional, do not remove, waiting for the present cpu signal here
-    // because we have to be sure we can re-record calls with which this signal is paired.
-    if (vkfast->presentCpuSignal != NULL) {
-      np(redCpuSignalWait,
-        "context", vkfast->context,
-        "gpu", vkfast->gpu,
-        "cpuSignalsCount", 1,
-        "cpuSignals", &vkfast->presentCpuSignal,
-        "waitAll", 1,
-        "outStatuses", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-    }
+  REDGPU_2_EXPECTWG(bytes_first < range_bytes_count);
 
-    // NOTE(Constantine): Present queue wait idle.
-    np(redQueuePresent,
-      "context", vkfast->context,
-      "gpu", vkfast->gpu,
-      "queue", vkfast->gpuInfo->queues[vkfast->presentQueueIndex],
-      "waitForAndUnsignalGpuSignalsCount", 0,
-      "waitForAndUnsignalGpuSignals", NULL,
-      "presentsCount", 0,
-      "presents", NULL,
-      "presentsImageIndex", NULL,
-      "outPresentsStatus", NULL,
-      "outStatuses", NULL,
-      "optionalFile", optionalFile,
-      "optionalLine", optionalLine,
-      "optionalUserData", NULL
-    );
+  const uint64_t available_bytes_count = range_bytes_count - bytes_first;
 
-    // NOTE(Constantine): Destroy aborted cpu and gpu signals.
-    np(red2DestroyHandle,
-      "context", vkfast->context,
-      "gpu", vkfast->gpu,
-      "handleType", RED_HANDLE_TYPE_CPU_SIGNAL,
-      "handle", vkfast->presentCpuSignal,
-      "optionalHandle2", NULL,
-      "optionalFile", optionalFile,
-      "optionalLine", optionalLine,
-      "optionalUserData", NULL
-    );
-    vkfast->presentCpuSignal = NULL;
-    np(red2DestroyHandle,
-      "context", vkfast->context,
-      "gpu", vkfast->gpu,
-      "handleType", RED_HANDLE_TYPE_GPU_SIGNAL,
-      "handle", vkfast->presentGpuSignalAcquire,
-      "optionalHandle2", NULL,
-      "optionalFile", optionalFile,
-      "optionalLine", optionalLine,
-      "optionalUserData", NULL
-    );
-    vkfast->presentGpuSignalAcquire = NULL;
-    np(red2DestroyHandle,
-      "context", vkfast->context,
-      "gpu", vkfast->gpu,
-      "handleType", RED_HANDLE_TYPE_GPU_SIGNAL,
-      "handle", vkfast->presentGpuSignalSubmit,
-      "optionalHandle2", NULL,
-      "optionalFile", optionalFile,
-      "optionalLine", optionalLine,
-      "optionalUserData", NULL
-    );
-    vkfast->presentGpuSignalSubmit = NULL;
-  }
+  const uint64_t capped_bytes_count = bytes_count_cap <= available_bytes_count ? bytes_count_cap : available_bytes_count;
 
-  if (vkfast->surface == NULL) {
-    #if defined(_WIN32)
-    np(redCreateSurfaceWin32,
-      "context", vkfast->context,
-      "gpu", vkfast->gpu,
-      "handleName", "vkFast_vfInternalRebuildPresent_surface_win32",
-      "win32Hinstance", GetModuleHandle(NULL),
-      "win32Hwnd", vkfast->windowHandle,
-      "outSurface", &vkfast->surface,
-      "outStatuses", NULL,
-      "optionalFile", optionalFile,
-      "optionalLine", optionalLine,
-      "optionalUserData", NULL
-    );
-    #endif
-    #if defined(__linux__) && !defined(__ANDROID__)
-    {
-      // NOTE(Constantine): this struct's layout is defined in redgpu_32.c file of REDGPU 2 SDK.
-      struct X11WindowData {
-        Display * display;
-        Window    window;
-        Atom      wmDeleteMessage;
-      };
-      struct X11WindowData * h = vkfast->windowHandle;
+  storageRaw.arrayRangeBytesFirst = range_bytes_first + bytes_first;
+  storageRaw.arrayRangeBytesCount = capped_bytes_count;
 
-      np(redCreateSurfaceXlibOrXcb,
-        "context", vkfast->context,
-        "gpu", vkfast->gpu,
-        "handleName", "vkFast_vfInternalRebuildPresent_surface_xlib",
-        "xlibDisplay", h->display,
-        "xlibWindow", h->window,
-        "xcbConnection", NULL,
-        "xcbWindow", 0,
-        "outSurface", &vkfast->surface,
-        "outStatuses", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-    }
-    #endif
-    REDGPU_2_EXPECTWG(vkfast->surface != NULL);
+  vfBatchBindStorageRaw(context, batch_id, slot, 1, &storageRaw, optionalFile, optionalLine);
+
+  const uint64_t captureWords[6] = {batch_id, (uint64_t)slot, storage_id, bytes_first, bytes_count_cap, 2};
+  vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_BATCH_BIND_STORAGE, optionalLine, 6, captureWords, 0, NULL);
+}
+
+GPU_API_PRE void GPU_API_POST vfBatchBindTextureRWEx(gpu_handle_context_t context, uint64_t batch_id, int slot, int textures_rw_count, const RedStructMemberTexture * textures_rw, const char * optionalFile, int optionalLine) {
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
+
+  REDGPU_2_EXPECTWG(batch->batch.currentStruct.handle != NULL || batch->batch.pendingBindingsSetIsOpen == 1 || !"Was vfBatchBindNewBindingsSet() ever called previously?");
+
+  if (batch->batch.useBindingsSetsCache == 1) {
+    const uint64_t bindWords[3] = {(uint64_t)slot, RED_STRUCT_MEMBER_TYPE_TEXTURE_RW, (uint64_t)textures_rw_count};
+    vfInternalBindingsSetKeyAppend(batch, sizeof(bindWords), bindWords);
+    vfInternalBindingsSetKeyAppend(batch, sizeof(RedStructMemberTexture) * textures_rw_count, textures_rw);
+    return;
   }
 
-  RedQueueFamilyIndexGetSupportsPresentOnSurface queueFamilyIndexSupportsPresentOnSurface = {0};
-  queueFamilyIndexSupportsPresentOnSurface.surface                                     = vkfast->surface;
-  queueFamilyIndexSupportsPresentOnSurface.outQueueFamilyIndexSupportsPresentOnSurface = 0;
-  np(redQueueFamilyIndexGetSupportsPresent,
+  RedStructMember member = {0};
+  member.setTo35   = 35;
+  member.setTo0    = 0;
+  member.structure = batch->batch.currentStruct.handle;
+  member.slot      = slot;
+  member.first     = 0;
+  member.count     = textures_rw_count;
+  member.type      = RED_STRUCT_MEMBER_TYPE_TEXTURE_RW;
+  member.textures  = textures_rw;
+  member.arrays    = NULL;
+  member.setTo00   = 0;
+  np(redStructsSet,
     "context", vkfast->context,
     "gpu", vkfast->gpu,
-    "queueFamilyIndex", vkfast->gpuInfo->queuesFamilyIndex[vkfast->presentQueueIndex],
-    "supportsPresentOnWin32", NULL,
-    "supportsPresentOnXlib", NULL,
-    "supportsPresentOnXcb", NULL,
-    "supportsPresentOnSurface", &queueFamilyIndexSupportsPresentOnSurface,
-    "outStatuses", NULL,
+    "structsMembersCount", 1,
+    "structsMembers", &member,
     "optionalFile", optionalFile,
     "optionalLine", optionalLine,
     "optionalUserData", NULL
   );
-  REDGPU_2_EXPECTWG(queueFamilyIndexSupportsPresentOnSurface.outQueueFamilyIndexSupportsPresentOnSurface == 1);
+}
 
-  RedSurfaceCurrentPropertiesAndPresentLimits surfaceCurrentPropertiesAndPresentLimits = {0};
-  np(redSurfaceGetCurrentPropertiesAndPresentLimits,
-    "context", vkfast->context,
-    "gpu", vkfast->gpu,
-    "surface", vkfast->surface,
-    "outSurfaceCurrentPropertiesAndPresentLimits", &surfaceCurrentPropertiesAndPresentLimits,
-    "outStatuses", NULL,
-    "optionalFile", optionalFile,
-    "optionalLine", optionalLine,
-    "optionalUserData", NULL
-  );
-  // printf("[vkFast][DEBUG PRINTF] surfaceCurrentPropertiesAndPresentLimits.currentSurfaceWidth/Height: %d, %d\n", surfaceCurrentPropertiesAndPresentLimits.currentSurfaceWidth, surfaceCurrentPropertiesAndPresentLimits.currentSurfaceHeight);
-  if (surfaceCurrentPropertiesAndPresentLimits.currentSurfaceWidth == 0 || surfaceCurrentPropertiesAndPresentLimits.currentSurfaceHeight == 0) {
-    // NOTE(Constantine): The window is minimized or of unwatchable size (resized to 0 in width or 0 in height). Tested on Windows 10.
-    int isRebuilded = 0;
-    return isRebuilded;
-  }
-  if (surfaceCurrentPropertiesAndPresentLimits.currentSurfaceWidth != -1) {
-    vkfast->screenWidth = surfaceCurrentPropertiesAndPresentLimits.currentSurfaceWidth;
-  }
-  if (surfaceCurrentPropertiesAndPresentLimits.currentSurfaceHeight != -1) {
-    vkfast->screenHeight = surfaceCurrentPropertiesAndPresentLimits.currentSurfaceHeight;
-  }
+GPU_API_PRE void GPU_API_POST vfBatchBindNewBindingsEnd(gpu_handle_context_t context, uint64_t batch_id, const char * optionalFile, int optionalLine) {
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
 
-  // NOTE(Constantine):
-  // WSI destroy before the rebuild (except for present calls that are re-recordable anyway,
-  // and present pixels CPU upload resources, since they're pre-allocated for the worst case
-  // window resolution of 8kx8k, currently).
-  {
-    if (vkfast->present != NULL) {
-      np(red2DestroyHandle,
-        "context", vkfast->context,
-        "gpu", vkfast->gpu,
-        "handleType", RED_HANDLE_TYPE_PRESENT,
-        "handle", vkfast->present,
-        "optionalHandle2", NULL,
-        "optionalFile", optionalFile,
-        "optionalLine", optionalLine,
-        "optionalUserData", NULL
-      );
-      vkfast->present = NULL;
-    }
+  if (batch->batch.useBindingsSetsCache == 1) {
+    REDGPU_2_EXPECTWG(batch->batch.pendingBindingsSetIsOpen == 1 || !"Was vfBatchBindNewBindingsSet() ever called previously?");
+
+    const RedHandleStruct structure = vfInternalBindingsSetsAcquire(batch, optionalFile, optionalLine);
+    npfp(redCallSetProcedureParametersStructs, batch->batch.addresses.redCallSetProcedureParametersStructs,
+      "calls", batch->batch.calls.handle,
+      "procedureType", RED_PROCEDURE_TYPE_COMPUTE,
+      "procedureParameters", batch->batch.currentProcedureParametersCompute,
+      "procedureParametersDeclarationStructsDeclarationsFirst", 0,
+      "structsCount", 1, // NOTE(Constantine): Only one struct for now.
+      "structs", &structure,
+      "setTo0", 0,
+      "setTo00", 0
+    );
+    batch->batch.pendingBindingsSetIsOpen = 0;
+
+    const uint64_t captureWords[1] = {batch_id};
+    vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_BATCH_BIND_NEW_BINDINGS_END, optionalLine, 1, captureWords, 0, NULL);
+    return;
   }
 
-  np(redCreatePresent,
+  npfp(redCallSetProcedureParametersStructs, batch->batch.addresses.redCallSetProcedureParametersStructs,
+    "calls", batch->batch.calls.handle,
+    "procedureType", RED_PROCEDURE_TYPE_COMPUTE,
+    "procedureParameters", batch->batch.currentProcedureParametersCompute,
+    "procedureParametersDeclarationStructsDeclarationsFirst", 0,
+    "structsCount", 1, // NOTE(Constantine): Only one struct for now.
+    "structs", &batch->batch.currentStruct.handle,
+    "setTo0", 0,
+    "setTo00", 0
+  );
+
+  np(red2DestroyHandle,
     "context", vkfast->context,
     "gpu", vkfast->gpu,
-    "queue", vkfast->gpuInfo->queues[vkfast->presentQueueIndex],
-    "handleName", "vkFast_vfInternalRebuildPresent_present",
-    "surface", vkfast->surface,
-    "imagesCount", presentImagesCount,
-    "imagesWidth", vkfast->screenWidth,
-    "imagesHeight", vkfast->screenHeight,
-    "imagesLayersCount", 1,
-    "imagesRestrictToAccess", RED_ACCESS_BITFLAG_COPY_W,
-    "transform", RED_SURFACE_TRANSFORM_BITFLAG_IDENTITY,
-    "compositeAlpha", RED_SURFACE_COMPOSITE_ALPHA_BITFLAG_OPAQUE,
-    "vsyncMode", presentVsyncMode,
-    "clipped", 0,
-    "discardAfterPresent", 1, // NOTE(Constantine): Optimization.
-    "oldPresent", NULL,
-    "outPresent", &present,
-    "outImages", presentImages,
-    "outTextures", NULL,
-    "outStatuses", NULL,
+    "handleType", RED_HANDLE_TYPE_STRUCT_DECLARATION,
+    "handle", batch->batch.currentStruct.handleDeclaration,
+    "optionalHandle2", NULL,
     "optionalFile", optionalFile,
     "optionalLine", optionalLine,
     "optionalUserData", NULL
   );
-  REDGPU_2_EXPECTWG(present != NULL);
-
-  if (vkfast->presentPixelsCpuUpload_memory_and_array.array.handle == NULL && vkfast->presentPixelsCpuUpload_memory_allocation_size > 0) {
-    unsigned specificMemoryTypeCpuUpload = -1;
-    if (vkfast->specificMemoryTypesCpuUpload != -1) {
-      specificMemoryTypeCpuUpload = vkfast->specificMemoryTypesCpuUpload;
-    } else {
-      // NOTE(Constantine)(Aug 4, 2026):
-      // vkfast->specificMemoryTypesCpuUpload == -1 means that the user
-      // requested 0 bytes for memory storages of type cpu upload. If so,
-      // we can simply pick the first available upload memory type.
-      RedArray allMemoryTypes = {0};
-      allMemoryTypes.memoryTypesSupported = REDGPU_B32(1111,1111,1111,1111,1111,1111,1111,1111);
-      specificMemoryTypeCpuUpload = vfPickSpecificMemoryTypeCpuUpload(vkfast->gpuInfo, &allMemoryTypes);
-      REDGPU_2_EXPECTWG(specificMemoryTypeCpuUpload != -1);
-    }
-    np(red2CreateArray,
-      "context", vkfast->context,
-      "gpu", vkfast->gpu,
-      "handleName", "vkFast_vfInternalRebuildPresent_presentPixelsCpuUpload_memory_and_array",
-      "type", RED_ARRAY_TYPE_ARRAY_RO,
-      "bytesCount", vkfast->presentPixelsCpuUpload_memory_allocation_size,
-      "structuredBufferElementBytesCount", 0,
-      "restrictToAccess", RED_ACCESS_BITFLAG_COPY_R,
-      "initialQueueFamilyIndex", vkfast->gpuInfo->queuesCount > 1 ? -1 : (unsigned)vkfast->gpuInfo->queuesFamilyIndex[vkfast->mainQueueFamilyIndex],
-      "maxAllowedOverallocationBytesCount", 0, // NOTE(Constantine): Intel UHD Graphics 730 on Windows 10 aligns CPU visible allocations to 64 bytes.
-      "dedicate", 0,
-      "mappable", 1,
-      "dedicateOrMappableMemoryTypeIndex", specificMemoryTypeCpuUpload,
-      "dedicateOrMappableMemoryBitflags", 0,
-      "suballocateFromMemoryOnFirstMatchPointersCount", 0,
-      "suballocateFromMemoryOnFirstMatchPointers", NULL,
-      "outArray", &vkfast->presentPixelsCpuUpload_memory_and_array,
-      "outStatuses", NULL,
-      "optionalFile", optionalFile,
-      "optionalLine", optionalLine,
-      "optionalUserData", NULL
-    );
-    np(redMemoryMap,
-      "context", vkfast->context,
-      "gpu", vkfast->gpu,
-      "mappableMemory", vkfast->presentPixelsCpuUpload_memory_and_array.handleAllocatedDedicatedOrMappableMemoryOrPickedMemory,
-      "mappableMemoryBytesFirst", 0,
-      "mappableMemoryBytesCount", vkfast->presentPixelsCpuUpload_memory_and_array.array.memoryBytesCount,
-      "outVolatilePointer", &vkfast->presentPixelsCpuUpload_void_ptr_original,
-      "outStatuses", NULL,
-      "optionalFile", optionalFile,
-      "optionalLine", optionalLine,
-      "optionalUserData", NULL
-    );
-    REDGPU_2_EXPECTWG(vkfast->presentPixelsCpuUpload_void_ptr_original != NULL);
-    REDGPU_2_EXPECTWG(0 == REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY((uint64_t)vkfast->presentPixelsCpuUpload_void_ptr_original, vkfast->gpuInfo->minMemoryAllocateBytesAlignment)); // NOTE(Constantine): Start address is guaranteed to be aligned.
-  }
-
-  vkfast->surface;
-  vkfast->present = present;
-  vkfast->presentImages[0] = presentImages[0];
-  vkfast->presentImages[1] = presentImages[1];
-  vkfast->presentImages[2] = presentImages[2];
-  vkfast->presentCpuSignal;
-  vkfast->presentGpuSignalAcquire;
-  vkfast->presentGpuSignalSubmit;
-  vkfast->presentCopyCalls;
-  vkfast->presentVsyncMode;
-  vkfast->presentImagesCount;
+  batch->batch.currentStruct.handleDeclaration = NULL;
+  batch->batch.currentStruct.handle = NULL;
 
-  int isRebuilded = 1;
-  return isRebuilded;
+  const uint64_t captureWords[1] = {batch_id};
+  vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_BATCH_BIND_NEW_BINDINGS_END, optionalLine, 1, captureWords, 0, NULL);
 }
 
-GPU_API_PRE int GPU_API_POST vfWindowFullscreenEx(gpu_handle_context_t context, void * optional_external_window_handle, const char * window_title, int screen_width, int screen_height, unsigned draw_queue_index, RedPresentVsyncMode present_vsync_mode, int present_images_count, const char * optionalFile, int optionalLine) {
-  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
-  
+GPU_API_PRE void GPU_API_POST vfBatchBindVariablesCopy(gpu_handle_context_t context, uint64_t batch_id, unsigned variables_bytes_offset, unsigned data_bytes_count, const void * data, const char * optionalFile, int optionalLine) {
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
   RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
 
-  REDGPU_2_EXPECTWG(draw_queue_index < vkfast->gpuInfo->queuesCount);
-
-  void * window_handle = optional_external_window_handle;
-  int window_handle_do_destroy = 0;
-  if (window_handle == NULL) {
-    window_handle = red32WindowCreate(window_title);
-    window_handle_do_destroy = 1;
-  }
-  REDGPU_2_EXPECTWG(window_handle != NULL);
-
-  vkfast->windowHandle = window_handle;
-  vkfast->windowHandleDoDestroy = window_handle_do_destroy;
-  vkfast->screenWidth = screen_width;
-  vkfast->screenHeight = screen_height;
-  vkfast->presentQueueIndex = draw_queue_index;
-  vkfast->presentVsyncMode = present_vsync_mode;
-  vkfast->presentImagesCount = present_images_count;
-
-  return vfInternalRebuildPresent(context, present_vsync_mode, present_images_count, optionalFile, optionalLine);
-}
+  REDGPU_2_EXPECTWG(batch->batch.currentProcedureParametersCompute != NULL || !"Was vfBatchBindProgramPipelineCompute() ever called previously?");
 
-GPU_API_PRE int GPU_API_POST vfWindowFullscreen(gpu_handle_context_t context, void * optional_external_window_handle, const char * window_title, int screen_width, int screen_height, unsigned draw_queue_index, RedPresentVsyncMode present_vsync_mode, const char * optionalFile, int optionalLine) {
-  return vfWindowFullscreenEx(context, optional_external_window_handle, window_title, screen_width, screen_height, draw_queue_index, present_vsync_mode, 3, optionalFile, optionalLine);
-}
+  npfp(redCallSetProcedureParametersVariables, batch->batch.addresses.redCallSetProcedureParametersVariables,
+    "calls", batch->batch.calls.handle,
+    "procedureParameters", batch->batch.currentProcedureParametersCompute,
+    "visibleToStages", RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE,
+    "variablesBytesFirst", variables_bytes_offset,
+    "dataBytesCount", data_bytes_count,
+    "data", data
+  );
 
-GPU_API_PRE int GPU_API_POST vfWindowLoop(gpu_handle_context_t context) {
-  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
-  return red32WindowLoop(vkfast->windowHandle);
+  const uint64_t captureWords[2] = {batch_id, variables_bytes_offset};
+  vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_BATCH_BIND_VARIABLES_COPY, optionalLine, 2, captureWords, data_bytes_count, data);
 }
 
-#if defined(_WIN32)
-GPU_API_PRE int GPU_API_POST vfWindowIsMinimized(gpu_handle_context_t context) {
-  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+GPU_API_PRE void GPU_API_POST vfBatchCompute(gpu_handle_context_t context, uint64_t batch_id, unsigned workgroups_count_x, unsigned workgroups_count_y, unsigned workgroups_count_z, const char * optionalFile, int optionalLine) {
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
 
-  return (int)IsIconic((HWND)vkfast->windowHandle);
-}
-#endif
+  npfp(redCallProcedureCompute, batch->batch.addresses.redCallProcedureCompute,
+    "calls", batch->batch.calls.handle,
+    "workgroupsCountX", workgroups_count_x,
+    "workgroupsCountY", workgroups_count_y,
+    "workgroupsCountZ", workgroups_count_z
+  );
 
-#if defined(__linux__) && !defined(__ANDROID__)
-GPU_API_PRE int GPU_API_POST vfWindowIsMinimized(gpu_handle_context_t context) {
-  return 0; // NOTE(Constantine): There's no simple X11 code to check for this, so just assume the window is always visible.
+  const uint64_t captureWords[4] = {batch_id, workgroups_count_x, workgroups_count_y, workgroups_count_z};
+  vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_BATCH_COMPUTE, optionalLine, 4, captureWords, 0, NULL);
 }
-#endif
 
-GPU_API_PRE void GPU_API_POST vfWindowGetSize(gpu_handle_context_t context, int * out_window_width, int * out_window_height) {
-  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+GPU_API_PRE void GPU_API_POST vfBatchBarrierMemory(gpu_handle_context_t context, uint64_t batch_id, const char * optionalFile, int optionalLine) {
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
 
-  if (out_window_width  != NULL) { out_window_width[0]  = vkfast->screenWidth;  }
-  if (out_window_height != NULL) { out_window_height[0] = vkfast->screenHeight; }
-}
+  np(red2CallGlobalOrderBarrier,
+    "address", batch->batch.addresses.redCallUsageAliasOrderBarrier,
+    "calls", batch->batch.calls.handle
+  );
 
-GPU_API_PRE void GPU_API_POST vfExit(int exit_code) {
-  red32Exit(exit_code);
+  const uint64_t captureWords[1] = {batch_id};
+  vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_BATCH_BARRIER_MEMORY, optionalLine, 1, captureWords, 0, NULL);
 }
 
-GPU_API_PRE void GPU_API_POST vfStorageCreate(gpu_handle_context_t context, const gpu_storage_info_t * storage_info, gpu_storage_t * out_storage, const char * optionalFile, int optionalLine) {
-  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
-
+GPU_API_PRE void GPU_API_POST vfBatchBarrierCpuReadback(gpu_handle_context_t context, uint64_t batch_id, const char * optionalFile, int optionalLine) {
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
   RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
 
-  REDGPU_2_EXPECTWG(storage_info->storage_type != GPU_STORAGE_TYPE_NONE);
+  np(red2CallGlobalReadbackBarrier,
+    "address", batch->batch.addresses.redCallUsageAliasOrderBarrier,
+    "calls", batch->batch.calls.handle
+  );
 
-  uint64_t             alignment         = 0;
-  RedStructMemberArray arrayRangeInfo    = {0};
-  void *               mappedVoidPointer = NULL;
-  {
-    // NOTE(Constantine): Storage range mapping.
+  const uint64_t captureWords[1] = {batch_id};
+  vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_BATCH_BARRIER_CPU_READBACK, optionalLine, 1, captureWords, 0, NULL);
+}
 
-    if (storage_info->storage_type == GPU_STORAGE_TYPE_GPU_ONLY) {
-      
-      alignment = vkfast->gpuInfo->minArrayRORWStructMemberRangeBytesAlignment;
+GPU_API_PRE void GPU_API_POST vfBatchEnd(gpu_handle_context_t context, uint64_t batch_id, const char * optionalFile, int optionalLine) {
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
 
-      // NOTE(Constantine): Aligns start address.
-      vkfast->memoryGpuVramForArrays_memory_suballocations_offset += REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(vkfast->memoryGpuVramForArrays_memory_suballocations_offset, alignment);
+  np(redCallsEnd,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "calls", batch->batch.calls.handle,
+    "callsMemory", batch->batch.calls.memory,
+    "outStatuses", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
+  );
 
-      arrayRangeInfo.array                = vkfast->memoryGpuVramForArrays_array.handle;
-      arrayRangeInfo.arrayRangeBytesFirst = vkfast->memoryGpuVramForArrays_memory_suballocations_offset;
-      arrayRangeInfo.arrayRangeBytesCount = storage_info->bytes_count + REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(storage_info->bytes_count, alignment);
-      vkfast->memoryGpuVramForArrays_memory_suballocations_offset += arrayRangeInfo.arrayRangeBytesCount;
+  batch->batch.currentStruct.handle = NULL;
+  batch->batch.currentStruct.handleDeclaration = NULL;
+  batch->batch.currentProcedureParametersCompute = NULL;
+  batch->batch.pendingBindingsSetIsOpen = 0;
 
-      REDGPU_2_EXPECTWG(vkfast->memoryGpuVramForArrays_memory_suballocations_offset <= vkfast->memoryGpuVramForArrays_array.memoryBytesCount);
+  const uint64_t captureWords[1] = {batch_id};
+  vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_BATCH_END, optionalLine, 1, captureWords, 0, NULL);
+}
 
-    } else if (storage_info->storage_type == GPU_STORAGE_TYPE_CPU_UPLOAD) {
-    
-      alignment = vkfast->gpuInfo->minMemoryAllocateBytesAlignment; // NOTE(Constantine): Can't be placed into a struct, so picking only one alignment.
+GPU_API_PRE void GPU_API_POST vfGpuThreadCreate(gpu_handle_context_t context, unsigned gpu_threads_count, gpu_thread_t * out_gpu_threads, const char ** optional_gpu_threads_debug_name, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
 
-      // NOTE(Constantine): Aligns start address.
-      vkfast->memoryCpuUpload_memory_suballocations_offset += REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(vkfast->memoryCpuUpload_memory_suballocations_offset, alignment);
+  RedHandleGpu gpu = vkfast->gpu;
 
-      arrayRangeInfo.array                = vkfast->memoryCpuUpload_array.handle;
-      arrayRangeInfo.arrayRangeBytesFirst = vkfast->memoryCpuUpload_memory_suballocations_offset;
-      arrayRangeInfo.arrayRangeBytesCount = storage_info->bytes_count + REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(storage_info->bytes_count, alignment);
-      vkfast->memoryCpuUpload_memory_suballocations_offset += arrayRangeInfo.arrayRangeBytesCount;
+  for (unsigned i = 0; i < gpu_threads_count; i += 1) {
+    np(redCreateGpuSignal,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleName", optional_gpu_threads_debug_name == NULL ? NULL : optional_gpu_threads_debug_name[i],
+      "outGpuSignal", &out_gpu_threads[i],
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    REDGPU_2_EXPECTWG(out_gpu_threads[i] != NULL);
+  }
 
-      REDGPU_2_EXPECTWG(vkfast->memoryCpuUpload_memory_suballocations_offset <= vkfast->memoryCpuUpload_array.memoryBytesCount);
+  {
+    RedHandleCpuSignal tempCpuSignal = NULL;
+    np(redCreateCpuSignal,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleName", "vkFast_vfGpuThreadCreate_tempCpuSignal",
+      "createSignaled", 0,
+      "outCpuSignal", &tempCpuSignal,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    REDGPU_2_EXPECTWG(tempCpuSignal != NULL);
 
-    } else if (storage_info->storage_type == GPU_STORAGE_TYPE_CPU_READBACK) {
-    
-      alignment = vkfast->gpuInfo->minMemoryAllocateBytesAlignment; // NOTE(Constantine): Can't be placed into a struct, so picking only one alignment.
+    RedCalls tempCalls = {0};
+    np(redCreateCalls,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleName", "vkFast_vfGpuThreadCreate_tempCalls",
+      "queueFamilyIndex", vkfast->gpuInfo->queuesFamilyIndex[vkfast->presentQueueIndex],
+      "outCalls", &tempCalls,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    REDGPU_2_EXPECTWG(tempCalls.handle != NULL);
 
-      // NOTE(Constantine): Aligns start address.
-      vkfast->memoryCpuReadback_memory_suballocations_offset += REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(vkfast->memoryCpuReadback_memory_suballocations_offset, alignment);
+    {
+      RedCallProceduresAndAddresses addresses = {0};
+      np(redGetCallProceduresAndAddresses,
+        "context", vkfast->context,
+        "gpu", vkfast->gpu,
+        "outCallProceduresAndAddresses", &addresses,
+        "outStatuses", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
 
-      arrayRangeInfo.array                = vkfast->memoryCpuReadback_array.handle;
-      arrayRangeInfo.arrayRangeBytesFirst = vkfast->memoryCpuReadback_memory_suballocations_offset;
-      arrayRangeInfo.arrayRangeBytesCount = storage_info->bytes_count + REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(storage_info->bytes_count, alignment);
-      vkfast->memoryCpuReadback_memory_suballocations_offset += arrayRangeInfo.arrayRangeBytesCount;
+      np(redCallsSet,
+        "context", vkfast->context,
+        "gpu", vkfast->gpu,
+        "calls", tempCalls.handle,
+        "callsMemory", tempCalls.memory,
+        "callsReusable", tempCalls.reusable,
+        "outStatuses", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
 
-      REDGPU_2_EXPECTWG(vkfast->memoryCpuReadback_memory_suballocations_offset <= vkfast->memoryCpuReadback_array.memoryBytesCount);
+      np(red2CallGlobalOrderBarrier,
+        "address", addresses.redCallUsageAliasOrderBarrier,
+        "calls", tempCalls.handle
+      );
 
-    } else {
-#if defined(__linux__) || defined(__MINGW32__)
-      REDGPU_2_EXPECT(!"[vkFast Internal] Unreachable enum value.");
-#else
-      REDGPU_2_EXPECT(!"[vkFast Internal][" __FUNCTION__ "] Unreachable enum value.");
-#endif
+      np(redCallsEnd,
+        "context", vkfast->context,
+        "gpu", vkfast->gpu,
+        "calls", tempCalls.handle,
+        "callsMemory", tempCalls.memory,
+        "outStatuses", NULL,
+        "optionalFile", optionalFile,
+        "optionalLine", optionalLine,
+        "optionalUserData", NULL
+      );
     }
 
-    // NOTE(Constantine): Pointer mapping.
+    RedGpuTimeline timelines[1] = {0};
+    timelines[0].setTo4                            = 4;
+    timelines[0].setTo0                            = 0;
+    timelines[0].waitForAndUnsignalGpuSignalsCount = 0;
+    timelines[0].waitForAndUnsignalGpuSignals      = NULL;
+    timelines[0].setTo65536                        = NULL;
+    timelines[0].callsCount                        = 1;
+    timelines[0].calls                             = &tempCalls.handle;
+    timelines[0].signalGpuSignalsCount             = gpu_threads_count;
+    timelines[0].signalGpuSignals                  = out_gpu_threads;
+    np(redQueueSubmit,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "queue", vkfast->mainQueue,
+      "timelinesCount", 1,
+      "timelines", timelines,
+      "signalCpuSignal", tempCpuSignal,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
 
-    if (storage_info->storage_type == GPU_STORAGE_TYPE_CPU_UPLOAD) {
-    
-      mappedVoidPointer = vkfast->memoryCpuUpload_mapped_void_ptr_offset; // NOTE(Constantine): Start address is guaranteed to be aligned.
-      
-      uint8_t * ptr = (uint8_t *)vkfast->memoryCpuUpload_mapped_void_ptr_offset;
-      ptr += arrayRangeInfo.arrayRangeBytesCount + REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(arrayRangeInfo.arrayRangeBytesCount, alignment);
-      vkfast->memoryCpuUpload_mapped_void_ptr_offset = (void *)ptr;
+    np(redCpuSignalWait,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "cpuSignalsCount", 1,
+      "cpuSignals", &tempCpuSignal,
+      "waitAll", 1,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_CPU_SIGNAL,
+      "handle", tempCpuSignal,
+      "optionalHandle2", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
 
-    } else if (storage_info->storage_type == GPU_STORAGE_TYPE_CPU_READBACK) {
-    
-      mappedVoidPointer = vkfast->memoryCpuReadback_mapped_void_ptr_offset; // NOTE(Constantine): Start address is guaranteed to be aligned.
-      
-      uint8_t * ptr = (uint8_t *)vkfast->memoryCpuReadback_mapped_void_ptr_offset;
-      ptr += arrayRangeInfo.arrayRangeBytesCount + REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(arrayRangeInfo.arrayRangeBytesCount, alignment);
-      vkfast->memoryCpuReadback_mapped_void_ptr_offset = (void *)ptr;
+    np(red2DestroyHandle,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleType", RED_HANDLE_TYPE_CALLS,
+      "handle", tempCalls.handle,
+      "optionalHandle2", tempCalls.memory,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+  }
 
+  if (vkfast->captureFile != NULL) {
+    // To free
+    uint64_t * captureWords = (uint64_t *)red32MemoryCalloc(sizeof(uint64_t) * (1 + gpu_threads_count));
+    REDGPU_2_EXPECTWG(captureWords != NULL);
+    captureWords[0] = gpu_threads_count;
+    for (unsigned i = 0; i < gpu_threads_count; i += 1) {
+      captureWords[1 + i] = (uint64_t)(void *)out_gpu_threads[i];
     }
+    vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_GPU_THREAD_CREATE, optionalLine, 1 + gpu_threads_count, captureWords, 0, NULL);
+    red32MemoryFree(captureWords);
   }
+}
 
-  //NOTE(Constantine)(Jun 30, 2026): The line below was here when the vkFast API couldn't bind limited storage and pointer ranges. Now we can.
-  //REDGPU_2_EXPECTWG(arrayRangeInfo.arrayRangeBytesCount <= vkfast->context->gpus[vkfast->gpuIndex].maxArrayRORWStructMemberRangeBytesCount);
-
-  // To free
-  vf_handle_t * handle = (vf_handle_t *)red32MemoryCalloc(sizeof(vf_handle_t));
-  REDGPU_2_EXPECTWG(handle != NULL);
+GPU_API_PRE void GPU_API_POST vfGpuThreadDestroy(gpu_handle_context_t context, gpu_thread_t gpu_thread) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
 
-  // Filling
-  vf_handle_t;
-  vf_handle_storage_t;
-  handle->vkfast                 = vkfast;
-  handle->handle_id              = VF_HANDLE_ID_STORAGE;
-  handle->storage.info           = storage_info[0];
-  handle->storage.arrayRangeInfo = arrayRangeInfo;
+  const uint64_t captureWords[1] = {(uint64_t)(void *)gpu_thread};
+  vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_GPU_THREAD_DESTROY, 0, 1, captureWords, 0, NULL);
 
-  // Filling
-  gpu_storage_t;
-  out_storage->id              = (uint64_t)(void *)handle;
-  out_storage->info            = storage_info[0];
-  out_storage->alignment       = alignment;
-  out_storage->mapped_void_ptr = mappedVoidPointer;
+  np(red2DestroyHandle,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "handleType", RED_HANDLE_TYPE_GPU_SIGNAL,
+    "handle", gpu_thread,
+    "optionalHandle2", NULL,
+    "optionalFile", NULL,
+    "optionalLine", 0,
+    "optionalUserData", NULL
+  );
 }
 
-GPU_API_PRE void GPU_API_POST vfStorageGetRaw(gpu_handle_context_t context, uint64_t storage_id, RedStructMemberArray * out_storage_raw, const char * optionalFile, int optionalLine) {
-  vf_handle_t * storage = (vf_handle_t *)(void *)storage_id;
-  vf_handle_context_t * vkfast = storage->vkfast;
+GPU_API_PRE RedHandleCalls GPU_API_POST vfBatchGetRawHandle(gpu_handle_context_t context, uint64_t batch_id, const char * optionalFile, int optionalLine) {
+  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
+  vf_handle_context_t * vkfast = batch->vkfast;
   RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(storage->handle_id == VF_HANDLE_ID_STORAGE);
+  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
 
-  out_storage_raw[0] = storage->storage.arrayRangeInfo;
+  return batch->batch.calls.handle;
 }
 
-GPU_API_PRE uint64_t GPU_API_POST vfProgramCreateFromBinaryCompute(gpu_handle_context_t context, const gpu_program_info_t * program_info, const char * optionalFile, int optionalLine) {
-  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+static uint64_t vfInternalAsyncBatchExecuteRaw(gpu_handle_context_t context, RedHandleQueue queue, uint64_t batch_calls_count, const RedHandleCalls * batch_calls, unsigned gpu_threads_count, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  RedHandleGpu gpu = vkfast->gpu;
+
+  // To push back to the pool (by vfAsyncWaitToFinish)
+  RedHandleCpuSignal cpuSignal = vfInternalCpuSignalsPoolPop(vkfast);
+  if (cpuSignal == NULL) {
+    np(redCreateCpuSignal,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleName", NULL,
+      "createSignaled", 0,
+      "outCpuSignal", &cpuSignal,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    REDGPU_2_EXPECTWG(cpuSignal != NULL);
+  }
+
+  // NOTE(Constantine): CPU writes to non-coherent upload storages aren't flushed here, only the caller knows which ranges it wrote since
+  // the last submit, see vfStorageCpuUploadFlush(). vkFast picks non-coherent upload memory only if it's set in gpu_context_ex3_parameters_t.
 
-  RedHandleGpu gpu = vkfast->gpu;
+  vfInternalCaptureAsyncBatchExecute(vkfast, (uint64_t)(void *)cpuSignal, queue, batch_calls_count, batch_calls, gpu_threads_count, gpu_threads, optionalLine);
 
-  // To destroy
-  RedHandleGpuCode gpuCode = NULL;
-  np(redCreateGpuCode,
+  RedGpuTimeline timelines[1] = {0};
+  timelines[0].setTo4                            = 4;
+  timelines[0].setTo0                            = 0;
+  timelines[0].waitForAndUnsignalGpuSignalsCount = gpu_threads_count;
+  timelines[0].waitForAndUnsignalGpuSignals      = gpu_threads;
+  timelines[0].setTo65536                        = gpu_threads_array_of_65536_int_values;
+  timelines[0].callsCount                        = batch_calls_count;
+  timelines[0].calls                             = batch_calls;
+  timelines[0].signalGpuSignalsCount             = gpu_threads_count;
+  timelines[0].signalGpuSignals                  = gpu_threads;
+  np(redQueueSubmit,
     "context", vkfast->context,
     "gpu", vkfast->gpu,
-    "handleName", program_info->optional_debug_name,
-    "irBytesCount", program_info->program_binary_bytes_count,
-    "ir", (const void *)program_info->program_binary,
-    "outGpuCode", &gpuCode,
+    "queue", queue,
+    "timelinesCount", 1,
+    "timelines", timelines,
+    "signalCpuSignal", cpuSignal,
     "outStatuses", NULL,
     "optionalFile", optionalFile,
     "optionalLine", optionalLine,
     "optionalUserData", NULL
   );
-  REDGPU_2_EXPECTWG(gpuCode != NULL);
 
-  // To free
-  vf_handle_t * handle = (vf_handle_t *)red32MemoryCalloc(sizeof(vf_handle_t));
-  REDGPU_2_EXPECTWG(handle != NULL);
+  return (uint64_t)(void *)cpuSignal;
+}
 
-  vf_handle_t;
-  vf_handle_gpu_code_t;
-  handle->vkfast              = vkfast;
-  handle->handle_id           = VF_HANDLE_ID_GPU_CODE;
-  handle->gpuCode.info        = program_info[0];
-  handle->gpuCode.gpuCodeType = VF_GPU_CODE_TYPE_COMPUTE;
-  handle->gpuCode.gpuCode     = gpuCode;
+GPU_API_PRE uint64_t GPU_API_POST vfAsyncBatchExecuteRaw(gpu_handle_context_t context, uint64_t batch_raw_count, const RedHandleCalls * batch_raw, unsigned gpu_threads_count, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+  return vfInternalAsyncBatchExecuteRaw(context, vkfast->mainQueue, batch_raw_count, batch_raw, gpu_threads_count, gpu_threads, gpu_threads_array_of_65536_int_values, optionalFile, optionalLine);
+}
 
-  return (uint64_t)(void *)handle;
+GPU_API_PRE uint64_t GPU_API_POST vfAsyncBatchExecuteRawEx(gpu_handle_context_t context, RedHandleQueue queue, uint64_t batch_raw_count, const RedHandleCalls * batch_raw, unsigned gpu_threads_count, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
+  return vfInternalAsyncBatchExecuteRaw(context, queue, batch_raw_count, batch_raw, gpu_threads_count, gpu_threads, gpu_threads_array_of_65536_int_values, optionalFile, optionalLine);
 }
 
-GPU_API_PRE uint64_t GPU_API_POST vfProgramPipelineCreateCompute(gpu_handle_context_t context, const gpu_program_pipeline_compute_info_t * program_pipeline_compute_info, const char * optionalFile, int optionalLine) {
+GPU_API_PRE void GPU_API_POST vfAsyncWaitToFinish(gpu_handle_context_t context, uint64_t async_id, const char * optionalFile, int optionalLine) {
+  if (async_id == 0) {
+    return;
+  }
+
   vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
-  
-  RedHandleGpu gpu = vkfast->gpu;
 
-  vf_handle_t * gpuCodeCompute = (vf_handle_t *)(void *)program_pipeline_compute_info->compute_program;
-  REDGPU_2_EXPECTWG(gpuCodeCompute->handle_id == VF_HANDLE_ID_GPU_CODE);
-  REDGPU_2_EXPECTWG(gpuCodeCompute->gpuCode.gpuCodeType == VF_GPU_CODE_TYPE_COMPUTE);
+  RedHandleCpuSignal cpuSignal = (RedHandleCpuSignal)(void *)async_id;
 
-  if (program_pipeline_compute_info->variables_bytes_count > 0) {
-    for (unsigned i = 0; i < program_pipeline_compute_info->struct_members_count; i += 1) {
-      REDGPU_2_EXPECTWG(program_pipeline_compute_info->variables_slot != program_pipeline_compute_info->struct_members[i].slot);
-    }
-  }
+  // NOTE(Constantine): A waited async_id's signal is back in the pool unsignaled until a later async execute reuses it, waiting on it
+  // again would never return. Once it's reused, a stale async_id can't be told apart from the new one and waits for the new submission.
+  REDGPU_2_EXPECT(vfInternalCpuSignalsPoolContains(vkfast, cpuSignal) == 0 || !"[vkFast] async_id was already waited on, it's invalid after vfAsyncWaitToFinish().");
 
-  Red2ProcedureParametersDeclaration parameters = {0};
-  parameters.variablesSlot            = program_pipeline_compute_info->variables_slot;
-  parameters.variablesVisibleToStages = program_pipeline_compute_info->variables_bytes_count == 0 ? 0 : RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
-  parameters.variablesBytesCount      = program_pipeline_compute_info->variables_bytes_count;
-  parameters.structsDeclarationsCount = program_pipeline_compute_info->struct_members_count == 0 ? 0 : 1;
-  parameters.structsDeclarations[0].structDeclarationMembersCount        = program_pipeline_compute_info->struct_members_count;
-  parameters.structsDeclarations[0].structDeclarationMembers             = program_pipeline_compute_info->struct_members;
-  parameters.structsDeclarations[0].structDeclarationMembersArrayROCount = 0;
-  parameters.structsDeclarations[0].structDeclarationMembersArrayRO      = NULL;
+  vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_ASYNC_WAIT_TO_FINISH, optionalLine, 1, &async_id, 0, NULL);
 
-  // To destroy
-  Red2ProcedureParametersAndDeclarations procedureParameters = {0};
-  np(red2CreateProcedureParameters,
+  np(redCpuSignalWait,
     "context", vkfast->context,
     "gpu", vkfast->gpu,
-    "handleName", program_pipeline_compute_info->optional_debug_name,
-    "procedureParametersDeclaration", &parameters,
-    "outProcedureParametersAndDeclarations", &procedureParameters,
+    "cpuSignalsCount", 1,
+    "cpuSignals", &cpuSignal,
+    "waitAll", 1,
     "outStatuses", NULL,
     "optionalFile", optionalFile,
     "optionalLine", optionalLine,
     "optionalUserData", NULL
   );
-  REDGPU_2_EXPECTWG(procedureParameters.procedureParameters != NULL);
 
-  // To destroy
-  RedHandleProcedure procedure = NULL;
-  np(redCreateProcedureCompute,
+  if (vkfast->specificMemoryTypesCpuReadbackIsCoherent == 0) {
+    // NOTE(Constantine): Making all GPU writes to readback storages visible to the CPU after the wait.
+    vfInternalHeapsNonCoherentFlushOrInvalidate(vkfast, GPU_STORAGE_TYPE_CPU_READBACK, optionalFile, optionalLine);
+  }
+
+  // NOTE(Constantine): The signal is reused by a later async batch execute instead of being destroyed, so per-frame submits don't create and destroy a signal each.
+  np(redCpuSignalUnsignal,
     "context", vkfast->context,
     "gpu", vkfast->gpu,
-    "handleName", program_pipeline_compute_info->optional_debug_name,
-    "procedureCache", NULL,
-    "procedureParameters", procedureParameters.procedureParameters,
-    "gpuCodeMainProcedureName", "main",
-    "gpuCode", gpuCodeCompute->gpuCode.gpuCode,
-    "outProcedure", &procedure,
+    "cpuSignalsCount", 1,
+    "cpuSignals", &cpuSignal,
     "outStatuses", NULL,
     "optionalFile", optionalFile,
     "optionalLine", optionalLine,
     "optionalUserData", NULL
   );
-  REDGPU_2_EXPECTWG(procedure != NULL);
-
-  // To free
-  vf_handle_t * handle = (vf_handle_t *)red32MemoryCalloc(sizeof(vf_handle_t));
-  REDGPU_2_EXPECTWG(handle != NULL);
-
-  // Filling
-  vf_handle_t;
-  vf_handle_procedure_t;
-  handle->vkfast                        = vkfast;
-  handle->handle_id                     = VF_HANDLE_ID_PROCEDURE;
-  handle->procedure.infoCompute         = program_pipeline_compute_info[0];
-  handle->procedure.procedureType       = VF_PROCEDURE_TYPE_COMPUTE;
-  handle->procedure.procedureParameters = procedureParameters;
-  handle->procedure.procedure           = procedure;
-
-  return (uint64_t)(void *)handle;
+  vfInternalCpuSignalsPoolPush(vkfast, cpuSignal, optionalFile, optionalLine);
 }
 
-static uint64_t vfInternalBatchBegin(gpu_handle_context_t context, uint64_t existing_batch_id, const gpu_batch_info_t * batch_info, unsigned queue_family_index, const char * optional_debug_name, const char * optionalFile, int optionalLine) {
-  vf_handle_t * handle = (vf_handle_t *)(void *)existing_batch_id;
-  
-  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
-
+static void vfInternalPresentSignalsCreate(vf_handle_context_t * vkfast, const char * optionalFile, int optionalLine) {
   RedHandleGpu gpu = vkfast->gpu;
 
-  if (handle == NULL) {
-    // To destroy
-    RedCalls calls = {0};
-    np(redCreateCallsReusable,
+  if (vkfast->presentCpuSignal == NULL) {
+    np(redCreateCpuSignal,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "handleName", optional_debug_name,
-      "queueFamilyIndex", vkfast->gpuInfo->queuesFamilyIndex[queue_family_index],
-      "outCalls", &calls,
+      "handleName", "vkFast_vfInternalAsyncDrawPixels_presentCpuSignal",
+      "createSignaled", 1,
+      "outCpuSignal", &vkfast->presentCpuSignal,
       "outStatuses", NULL,
       "optionalFile", optionalFile,
       "optionalLine", optionalLine,
       "optionalUserData", NULL
     );
-    REDGPU_2_EXPECTWG(calls.handle != NULL);
-  
-    RedCallProceduresAndAddresses addresses = {0};
-    np(redGetCallProceduresAndAddresses,
+    REDGPU_2_EXPECTWG(vkfast->presentCpuSignal != NULL);
+  }
+  if (vkfast->presentGpuSignalAcquire == NULL) {
+    np(redCreateGpuSignal,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "outCallProceduresAndAddresses", &addresses,
+      "handleName", "vkFast_vfInternalAsyncDrawPixels_presentGpuSignalAcquire",
+      "outGpuSignal", &vkfast->presentGpuSignalAcquire,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    REDGPU_2_EXPECTWG(vkfast->presentGpuSignalAcquire != NULL);
+  }
+  if (vkfast->presentGpuSignalSubmit == NULL) {
+    np(redCreateGpuSignal,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleName", "vkFast_vfInternalAsyncDrawPixels_presentGpuSignalSubmit",
+      "outGpuSignal", &vkfast->presentGpuSignalSubmit,
       "outStatuses", NULL,
       "optionalFile", optionalFile,
       "optionalLine", optionalLine,
       "optionalUserData", NULL
     );
+    REDGPU_2_EXPECTWG(vkfast->presentGpuSignalSubmit != NULL);
+  }
+}
 
-    RedHandleStructsMemory structsMemory = 0;
-    if (batch_info != NULL) {
-      if (batch_info->max_new_bindings_sets_count > 0) {
-        // To destroy
-        np(redStructsMemoryAllocate,
-          "context", vkfast->context,
-          "gpu", vkfast->gpu,
-          "handleName", optional_debug_name,
-          "maxStructsCount", batch_info->max_new_bindings_sets_count,
-          "maxStructsMembersOfTypeArrayROConstantCount", 0,
-          "maxStructsMembersOfTypeArrayROOrArrayRWCount", batch_info->max_storage_binds_count,
-          "maxStructsMembersOfTypeTextureROCount", batch_info->max_texture_ro_binds_count,
-          "maxStructsMembersOfTypeTextureRWCount", batch_info->max_texture_rw_binds_count,
-          "outStructsMemory", &structsMemory,
-          "outStatuses", NULL,
-          "optionalFile", optionalFile,
-          "optionalLine", optionalLine,
-          "optionalUserData", NULL
-        );
-        REDGPU_2_EXPECTWG(structsMemory != NULL);
-      }
-    }
+static void vfInternalPresentConvertProgramCreate(vf_handle_context_t * vkfast, const char * optionalFile, int optionalLine) {
+  gpu_handle_context_t context = (gpu_handle_context_t)(void *)vkfast;
 
-    RedHandleStructsMemory structsMemorySamplers = NULL;
-    if (batch_info != NULL) {
-      if (batch_info->max_sampler_binds_count > 0) {
-        REDGPU_2_EXPECTWG(batch_info->max_sampler_binds_count <= 4000);
-        // To destroy
-        np(redStructsMemoryAllocateSamplers,
-          "context", vkfast->context,
-          "gpu", vkfast->gpu,
-          "handleName", optional_debug_name,
-          "maxStructsCount", 1, // NOTE(Constantine): Only one samplers struct per command list for now.
-          "maxStructsMembersOfTypeSamplerCount", batch_info->max_sampler_binds_count,
-          "outStructsMemory", &structsMemorySamplers,
-          "outStatuses", NULL,
-          "optionalFile", optionalFile,
-          "optionalLine", optionalLine,
-          "optionalUserData", NULL
-        );
-        REDGPU_2_EXPECTWG(structsMemorySamplers != NULL);
-      }
-    }
+  RedHandleGpu gpu = vkfast->gpu;
 
-    // To free
-    handle = (vf_handle_t *)red32MemoryCalloc(sizeof(vf_handle_t));
-    REDGPU_2_EXPECTWG(handle != NULL);
+  if (vkfast->presentConvertProgram == 0) {
+    // NOTE(Constantine): g_main[] of vkfast_present_convert.cs.h is hand-assembled, see the note in it.
+    #include "vkfast_present_convert.cs.h"
 
-    // Filling
-    vf_handle_t;
-    vf_handle_batch_t;
-    handle->vkfast                                  = vkfast;
-    handle->handle_id                               = VF_HANDLE_ID_BATCH;
-    handle->batch.calls                             = calls;
-    handle->batch.addresses                         = addresses;
-    handle->batch.structsMemory                     = structsMemory;
-    handle->batch.structsMemorySamplers             = structsMemorySamplers;
-    handle->batch.currentStruct                     = REDGPU_32_STRUCT(Red2Struct, 0);
-    handle->batch.currentStructSamplers             = REDGPU_32_STRUCT(Red2Struct, 0); // NOTE(Constantine): Set below.
-    handle->batch.currentProcedureParametersCompute = NULL;
+    gpu_program_info_t cs_info = {0};
+    cs_info.optional_debug_name        = "vkFast_vfInternalPresentConvertProgramCreate_program";
+    cs_info.program_binary_bytes_count = sizeof(g_main);
+    cs_info.program_binary             = g_main;
+    vkfast->presentConvertProgram = vfProgramCreateFromBinaryCompute(context, &cs_info, optionalFile, optionalLine);
+    REDGPU_2_EXPECTWG(vkfast->presentConvertProgram != 0);
   }
 
-  np(redCallsSet,
-    "context", vkfast->context,
-    "gpu", vkfast->gpu,
-    "calls", handle->batch.calls.handle,
-    "callsMemory", handle->batch.calls.memory,
-    "callsReusable", handle->batch.calls.reusable,
-    "outStatuses", NULL,
-    "optionalFile", optionalFile,
-    "optionalLine", optionalLine,
-    "optionalUserData", NULL
-  );
+  RedStructDeclarationMember slots[2] = {0};
+  slots[0].slot            = 0;
+  slots[0].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+  slots[0].count           = 1;
+  slots[0].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+  slots[1].slot            = 1;
+  slots[1].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+  slots[1].count           = 1;
+  slots[1].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+
+  if (vkfast->presentConvertProgramPipeline == 0) {
+    gpu_program_pipeline_compute_info_t pp_info = {0};
+    pp_info.optional_debug_name   = "vkFast_vfInternalPresentConvertProgramCreate_programPipeline";
+    pp_info.compute_program       = vkfast->presentConvertProgram;
+    pp_info.variables_slot        = 2;
+    pp_info.variables_bytes_count = 4*sizeof(unsigned) + 2*sizeof(float);
+    pp_info.struct_members_count  = 2;
+    pp_info.struct_members        = slots;
+    vkfast->presentConvertProgramPipeline = vfProgramPipelineCreateCompute(context, &pp_info, optionalFile, optionalLine);
+    REDGPU_2_EXPECTWG(vkfast->presentConvertProgramPipeline != 0);
+  }
 
-  if (handle->batch.structsMemory != NULL) {
-    np(redStructsMemoryReset,
+  if (vkfast->presentConvertStructsMemory == NULL) {
+    np(redStructsMemoryAllocate,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "structsMemory", handle->batch.structsMemory,
+      "handleName", "vkFast_vfInternalPresentConvertProgramCreate_structsMemory",
+      "maxStructsCount", 2,
+      "maxStructsMembersOfTypeArrayROConstantCount", 0,
+      "maxStructsMembersOfTypeArrayROOrArrayRWCount", 4,
+      "maxStructsMembersOfTypeTextureROCount", 0,
+      "maxStructsMembersOfTypeTextureRWCount", 0,
+      "outStructsMemory", &vkfast->presentConvertStructsMemory,
       "outStatuses", NULL,
       "optionalFile", optionalFile,
       "optionalLine", optionalLine,
       "optionalUserData", NULL
     );
-  }
+    REDGPU_2_EXPECTWG(vkfast->presentConvertStructsMemory != NULL);
 
-  if (handle->batch.structsMemorySamplers != NULL) {
-    np(redStructsMemoryReset,
+    // NOTE(Constantine): The struct declarations are kept until deinit, the structs are set again on every draw.
+    np(red2StructsMemorySuballocateStruct,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "structsMemory", handle->batch.structsMemorySamplers,
+      "handleName", "vkFast_vfInternalPresentConvertProgramCreate_struct",
+      "structsMemory", vkfast->presentConvertStructsMemory,
+      "structDeclarationMembersCount", 2,
+      "structDeclarationMembers", slots,
+      "structDeclarationMembersArrayROCount", 0,
+      "structDeclarationMembersArrayRO", NULL,
+      "outStruct", &vkfast->presentConvertStruct,
       "outStatuses", NULL,
       "optionalFile", optionalFile,
       "optionalLine", optionalLine,
-      "optionalUserData", NULL
-    );
-    np(red2DestroyHandle,
-      "context", handle->vkfast->context,
-      "gpu", handle->vkfast->gpu,
-      "handleType", RED_HANDLE_TYPE_STRUCT_DECLARATION,
-      "handle", handle->batch.currentStructSamplers.handleDeclaration,
-      "optionalHandle2", NULL,
-      "optionalFile", optionalFile,
-      "optionalLine", optionalLine,
-      "optionalUserData", NULL
-    );
-    RedStructDeclarationMember samplers[4000] = {0}; // NOTE(Constantine): Kinda big on stack size, but whatever.
-    for (unsigned i = 0; i < batch_info->max_sampler_binds_count; i += 1) {
-      samplers[i].slot            = i;
-      samplers[i].type            = RED_STRUCT_MEMBER_TYPE_SAMPLER;
-      samplers[i].count           = 1;
-      samplers[i].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_FRAGMENT; // NOTE(Constantine): I doubt anyone needs to sample textures in vertex shaders?
-    }
-    Red2Struct currentStructSamplers = {0};
+      "optionalUserData", NULL
+    );
+    REDGPU_2_EXPECTWG(vkfast->presentConvertStruct.handleDeclaration != NULL);
+    REDGPU_2_EXPECTWG(vkfast->presentConvertStruct.handle != NULL);
     np(red2StructsMemorySuballocateStruct,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "handleName", optional_debug_name,
-      "structsMemory", handle->batch.structsMemorySamplers,
-      "structDeclarationMembersCount", batch_info->max_sampler_binds_count,
-      "structDeclarationMembers", samplers,
+      "handleName", "vkFast_vfInternalPresentConvertProgramCreate_upscaleStruct",
+      "structsMemory", vkfast->presentConvertStructsMemory,
+      "structDeclarationMembersCount", 2,
+      "structDeclarationMembers", slots,
       "structDeclarationMembersArrayROCount", 0,
       "structDeclarationMembersArrayRO", NULL,
-      "outStruct", &currentStructSamplers,
+      "outStruct", &vkfast->presentUpscaleStruct,
       "outStatuses", NULL,
       "optionalFile", optionalFile,
       "optionalLine", optionalLine,
       "optionalUserData", NULL
     );
-    REDGPU_2_EXPECTWG(currentStructSamplers.handleDeclaration != NULL);
-    REDGPU_2_EXPECTWG(currentStructSamplers.handle != NULL || !"red2StructsMemorySuballocateStruct() call returned NULL. Ran out of vfBatchBegin()::batch_bindings_info::max_new_bindings_sets_count and vfBatchBegin()::batch_bindings_info::max_sampler_binds_count memory to allocate?");
-    handle->batch.currentStructSamplers = currentStructSamplers;
-  }
-
-  if (handle->batch.structsMemory != NULL || handle->batch.structsMemorySamplers != NULL) {
-    // NOTE(Constantine): Oh God, I hope this call doesn't copy descriptors from structsMemory like redCallSetProcedureParametersStructs() :D
-    np(redCallSetStructsMemory,
-      "address", handle->batch.addresses.redCallSetStructsMemory,
-      "calls", handle->batch.calls.handle,
-      "structsMemory", handle->batch.structsMemory,
-      "structsMemorySamplers", handle->batch.structsMemorySamplers
-    );
+    REDGPU_2_EXPECTWG(vkfast->presentUpscaleStruct.handleDeclaration != NULL);
+    REDGPU_2_EXPECTWG(vkfast->presentUpscaleStruct.handle != NULL);
   }
-
-  return (uint64_t)(void *)handle;
-}
-
-GPU_API_PRE uint64_t GPU_API_POST vfBatchBegin(gpu_handle_context_t context, uint64_t existing_batch_id, const gpu_batch_info_t * batch_info, const char * optional_debug_name, const char * optionalFile, int optionalLine) {
-  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
-  return vfInternalBatchBegin(context, existing_batch_id, batch_info, vkfast->mainQueueFamilyIndex, optional_debug_name, optionalFile, optionalLine);
 }
 
-GPU_API_PRE uint64_t GPU_API_POST vfBatchBeginEx(gpu_handle_context_t context, uint64_t existing_batch_id, const gpu_batch_info_t * batch_info, unsigned queue_family_index, const char * optional_debug_name, const char * optionalFile, int optionalLine) {
-  return vfInternalBatchBegin(context, existing_batch_id, batch_info, queue_family_index, optional_debug_name, optionalFile, optionalLine);
-}
+static void vfInternalPresentUpscaleProgramCreate(vf_handle_context_t * vkfast, const char * optionalFile, int optionalLine) {
+  gpu_handle_context_t context = (gpu_handle_context_t)(void *)vkfast;
 
-GPU_API_PRE void GPU_API_POST vfBatchStorageCopyFromCpuToGpu(gpu_handle_context_t context, uint64_t batch_id, uint64_t from_cpu_storage_id, uint64_t to_gpu_storage_id, const char * optionalFile, int optionalLine) {
-  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
-  vf_handle_context_t * vkfast = batch->vkfast;
   RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
-  
-  vf_handle_t * from_cpu_storage = (vf_handle_t *)(void *)from_cpu_storage_id;
-  REDGPU_2_EXPECTWG(from_cpu_storage->handle_id == VF_HANDLE_ID_STORAGE);
-
-  vf_handle_t * to_gpu_storage = (vf_handle_t *)(void *)to_gpu_storage_id;
-  REDGPU_2_EXPECTWG(to_gpu_storage->handle_id == VF_HANDLE_ID_STORAGE);
-
-  RedCopyArrayRange range = {0};
-  range.arrayRBytesFirst  = from_cpu_storage->storage.arrayRangeInfo.arrayRangeBytesFirst;
-  range.arrayWBytesFirst  = to_gpu_storage->storage.arrayRangeInfo.arrayRangeBytesFirst;
-  range.bytesCount        = from_cpu_storage->storage.info.bytes_count;
-  npfp(redCallCopyArrayToArray, batch->batch.addresses.redCallCopyArrayToArray,
-    "calls", batch->batch.calls.handle,
-    "arrayR", from_cpu_storage->storage.arrayRangeInfo.array,
-    "arrayW", to_gpu_storage->storage.arrayRangeInfo.array,
-    "rangesCount", 1,
-    "ranges", &range
-  );
-}
 
-GPU_API_PRE void GPU_API_POST vfBatchStorageCopyFromGpuToCpu(gpu_handle_context_t context, uint64_t batch_id, uint64_t from_gpu_storage_id, uint64_t to_cpu_storage_id, const char * optionalFile, int optionalLine) {
-  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
-  vf_handle_context_t * vkfast = batch->vkfast;
-  RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
-  
-  vf_handle_t * from_gpu_storage = (vf_handle_t *)(void *)from_gpu_storage_id;
-  REDGPU_2_EXPECTWG(from_gpu_storage->handle_id == VF_HANDLE_ID_STORAGE);
+  if (vkfast->presentUpscaleProgram == 0) {
+    // NOTE(Constantine): g_main[] of vkfast_present_upscale.cs.h is hand-assembled, see the note in it.
+    #include "vkfast_present_upscale.cs.h"
 
-  vf_handle_t * to_cpu_storage = (vf_handle_t *)(void *)to_cpu_storage_id;
-  REDGPU_2_EXPECTWG(to_cpu_storage->handle_id == VF_HANDLE_ID_STORAGE);
+    gpu_program_info_t cs_info = {0};
+    cs_info.optional_debug_name        = "vkFast_vfInternalPresentUpscaleProgramCreate_program";
+    cs_info.program_binary_bytes_count = sizeof(g_main);
+    cs_info.program_binary             = g_main;
+    vkfast->presentUpscaleProgram = vfProgramCreateFromBinaryCompute(context, &cs_info, optionalFile, optionalLine);
+    REDGPU_2_EXPECTWG(vkfast->presentUpscaleProgram != 0);
+  }
 
-  RedCopyArrayRange range = {0};
-  range.arrayRBytesFirst  = from_gpu_storage->storage.arrayRangeInfo.arrayRangeBytesFirst;
-  range.arrayWBytesFirst  = to_cpu_storage->storage.arrayRangeInfo.arrayRangeBytesFirst;
-  range.bytesCount        = from_gpu_storage->storage.info.bytes_count;
-  npfp(redCallCopyArrayToArray, batch->batch.addresses.redCallCopyArrayToArray,
-    "calls", batch->batch.calls.handle,
-    "arrayR", from_gpu_storage->storage.arrayRangeInfo.array,
-    "arrayW", to_cpu_storage->storage.arrayRangeInfo.array,
-    "rangesCount", 1,
-    "ranges", &range
-  );
+  if (vkfast->presentUpscaleProgramPipeline == 0) {
+    RedStructDeclarationMember slots[2] = {0};
+    slots[0].slot            = 0;
+    slots[0].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+    slots[0].count           = 1;
+    slots[0].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+    slots[1].slot            = 1;
+    slots[1].type            = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+    slots[1].count           = 1;
+    slots[1].visibleToStages = RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE;
+
+    gpu_program_pipeline_compute_info_t pp_info = {0};
+    pp_info.optional_debug_name   = "vkFast_vfInternalPresentUpscaleProgramCreate_programPipeline";
+    pp_info.compute_program       = vkfast->presentUpscaleProgram;
+    pp_info.variables_slot        = 2;
+    pp_info.variables_bytes_count = 5*sizeof(unsigned) + 1*sizeof(float);
+    pp_info.struct_members_count  = 2;
+    pp_info.struct_members        = slots;
+    vkfast->presentUpscaleProgramPipeline = vfProgramPipelineCreateCompute(context, &pp_info, optionalFile, optionalLine);
+    REDGPU_2_EXPECTWG(vkfast->presentUpscaleProgramPipeline != 0);
+  }
 }
 
-GPU_API_PRE void GPU_API_POST vfBatchStorageCopyRaw(gpu_handle_context_t context, uint64_t batch_id, RedHandleArray from_storage_raw, RedHandleArray to_storage_raw, const RedCopyArrayRange * range, const char * optionalFile, int optionalLine) {
-  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
-  vf_handle_context_t * vkfast = batch->vkfast;
+// NOTE(Constantine):
+// Called by vfDrawPixelsEx() right after it waited presentCpuSignal, so no submission uses the convert arrays and they
+// can be destroyed and grown in place, unlike the present pixels memory that a present rebuild can replace at any time.
+static void vfInternalPresentConvertReserve(vf_handle_context_t * vkfast, uint64_t cpuUploadBytesCount, uint64_t gpuBytesCount, const char * optionalFile, int optionalLine) {
   RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
 
-  npfp(redCallCopyArrayToArray, batch->batch.addresses.redCallCopyArrayToArray,
-    "calls", batch->batch.calls.handle,
-    "arrayR", from_storage_raw,
-    "arrayW", to_storage_raw,
-    "rangesCount", 1,
-    "ranges", range
-  );
-}
+  if (vkfast->presentConvertPixelsCpuUploadBytesCount < cpuUploadBytesCount) {
+    vfInternalPresentConvertArraysDestroy(vkfast, 1, 0, optionalFile, optionalLine);
 
-GPU_API_PRE void GPU_API_POST vfBatchBindProgramPipelineCompute(gpu_handle_context_t context, uint64_t batch_id, uint64_t program_pipeline_compute_id, const char * optionalFile, int optionalLine) {
-  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
-  vf_handle_context_t * vkfast = batch->vkfast;
-  RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
+    unsigned specificMemoryTypeCpuUpload = vkfast->specificMemoryTypesCpuUpload;
+    if (specificMemoryTypeCpuUpload == -1) {
+      RedArray allMemoryTypes = {0};
+      allMemoryTypes.memoryTypesSupported = REDGPU_B32(1111,1111,1111,1111,1111,1111,1111,1111);
+      specificMemoryTypeCpuUpload = vfPickSpecificMemoryTypeCpuUpload(vkfast->gpuInfo, &allMemoryTypes);
+      REDGPU_2_EXPECTWG(specificMemoryTypeCpuUpload != -1);
+    }
+    np(red2CreateArray,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleName", "vkFast_vfInternalPresentConvertReserve_presentConvertPixelsCpuUpload_memory_and_array",
+      "type", RED_ARRAY_TYPE_ARRAY_RO,
+      "bytesCount", cpuUploadBytesCount,
+      "structuredBufferElementBytesCount", 0,
+      "restrictToAccess", RED_ACCESS_BITFLAG_COPY_R,
+      "initialQueueFamilyIndex", vkfast->gpuInfo->queuesCount > 1 ? -1 : (unsigned)vkfast->gpuInfo->queuesFamilyIndex[vkfast->mainQueueFamilyIndex],
+      "maxAllowedOverallocationBytesCount", 0,
+      "dedicate", 0,
+      "mappable", 1,
+      "dedicateOrMappableMemoryTypeIndex", specificMemoryTypeCpuUpload,
+      "dedicateOrMappableMemoryBitflags", 0,
+      "suballocateFromMemoryOnFirstMatchPointersCount", 0,
+      "suballocateFromMemoryOnFirstMatchPointers", NULL,
+      "outArray", &vkfast->presentConvertPixelsCpuUpload_memory_and_array,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    REDGPU_2_EXPECTWG(vkfast->presentConvertPixelsCpuUpload_memory_and_array.array.handle != NULL);
+    np(redMemoryMap,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "mappableMemory", vkfast->presentConvertPixelsCpuUpload_memory_and_array.handleAllocatedDedicatedOrMappableMemoryOrPickedMemory,
+      "mappableMemoryBytesFirst", 0,
+      "mappableMemoryBytesCount", vkfast->presentConvertPixelsCpuUpload_memory_and_array.array.memoryBytesCount,
+      "outVolatilePointer", &vkfast->presentConvertPixelsCpuUpload_void_ptr_original,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    REDGPU_2_EXPECTWG(vkfast->presentConvertPixelsCpuUpload_void_ptr_original != NULL);
+    vkfast->presentConvertPixelsCpuUploadBytesCount = cpuUploadBytesCount;
+  }
 
-  vf_handle_t * program_pipeline_compute = (vf_handle_t *)(void *)program_pipeline_compute_id;
-  REDGPU_2_EXPECTWG(program_pipeline_compute->handle_id == VF_HANDLE_ID_PROCEDURE);
-  REDGPU_2_EXPECTWG(program_pipeline_compute->procedure.procedureType == VF_PROCEDURE_TYPE_COMPUTE);
+  if (vkfast->presentConvertPixelsGpuBytesCount < gpuBytesCount) {
+    vfInternalPresentConvertArraysDestroy(vkfast, 0, 1, optionalFile, optionalLine);
 
-  npfp(redCallSetProcedure, batch->batch.addresses.redCallSetProcedure,
-    "calls", batch->batch.calls.handle,
-    "procedureType", RED_PROCEDURE_TYPE_COMPUTE,
-    "procedure", program_pipeline_compute->procedure.procedure
-  );
+    unsigned specificMemoryTypeGpuVram = vkfast->specificMemoryTypesGpuVram;
+    if (specificMemoryTypeGpuVram == -1) {
+      RedArray allMemoryTypes = {0};
+      allMemoryTypes.memoryTypesSupported = REDGPU_B32(1111,1111,1111,1111,1111,1111,1111,1111);
+      specificMemoryTypeGpuVram = vfPickSpecificMemoryTypeGpuVram(vkfast->gpuInfo, &allMemoryTypes);
+      REDGPU_2_EXPECTWG(specificMemoryTypeGpuVram != -1);
+    }
+    np(red2CreateArray,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "handleName", "vkFast_vfInternalPresentConvertReserve_presentConvertPixelsGpu_memory_and_array",
+      "type", RED_ARRAY_TYPE_ARRAY_RW,
+      "bytesCount", gpuBytesCount,
+      "structuredBufferElementBytesCount", 0,
+      "restrictToAccess", RED_ARRAY_TYPE_ARRAY_RW,
+      "initialQueueFamilyIndex", vkfast->gpuInfo->queuesCount > 1 ? -1 : (unsigned)vkfast->gpuInfo->queuesFamilyIndex[vkfast->mainQueueFamilyIndex],
+      "maxAllowedOverallocationBytesCount", 64,
+      "dedicate", 1,
+      "mappable", 0,
+      "dedicateOrMappableMemoryTypeIndex", specificMemoryTypeGpuVram,
+      "dedicateOrMappableMemoryBitflags", 0,
+      "suballocateFromMemoryOnFirstMatchPointersCount", 0,
+      "suballocateFromMemoryOnFirstMatchPointers", NULL,
+      "outArray", &vkfast->presentConvertPixelsGpu_memory_and_array,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+    REDGPU_2_EXPECTWG(vkfast->presentConvertPixelsGpu_memory_and_array.array.handle != NULL);
+    vkfast->presentConvertPixelsGpuBytesCount = gpuBytesCount;
+  }
+}
 
-  batch->batch.currentProcedureParametersCompute = program_pipeline_compute->procedure.procedureParameters.procedureParameters;
+static uint64_t vfInternalPixelsFormatBytesCount(gpu_pixels_format_t format) {
+  if (format == GPU_PIXELS_FORMAT_RGBA32F) { return 16; }
+  if (format == GPU_PIXELS_FORMAT_RGBA16F) { return 8;  }
+  if (format == GPU_PIXELS_FORMAT_RGB565)  { return 2;  }
+  return 4;
 }
 
-GPU_API_PRE void GPU_API_POST vfBatchBindNewBindingsSet(gpu_handle_context_t context, uint64_t batch_id, int slots_count, const RedStructDeclarationMember * slots, const char * optionalFile, int optionalLine) {
-  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
-  vf_handle_context_t * vkfast = batch->vkfast;
+static void vfInternalPresentConvertRecordCompute(vf_handle_context_t * vkfast, RedHandleCalls calls, const RedCallProceduresAndAddresses * addresses, uint64_t programPipelineId, const Red2Struct * structure, RedStructMemberArray * arrays, const unsigned * variables, unsigned width, unsigned height, const char * optionalFile, int optionalLine) {
   RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
 
-  REDGPU_2_EXPECTWG(batch->batch.structsMemory != NULL || !"vfBatchBegin()::batch_bindings_info was set to NULL?");
-  if (batch->batch.currentProcedureParametersCompute == NULL) {
-    REDGPU_2_EXPECTWG(!"Was vfBatchBindProgramPipelineCompute() ever called previously?");
+  RedStructMember members[2] = {0};
+  for (int i = 0; i < 2; i += 1) {
+    members[i].setTo35   = 35;
+    members[i].setTo0    = 0;
+    members[i].structure = structure->handle;
+    members[i].slot      = i;
+    members[i].first     = 0;
+    members[i].count     = 1;
+    members[i].type      = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
+    members[i].textures  = NULL;
+    members[i].arrays    = &arrays[i];
+    members[i].setTo00   = 0;
   }
-
-  Red2Struct structure = {0};
-  np(red2StructsMemorySuballocateStruct,
+  np(redStructsSet,
     "context", vkfast->context,
     "gpu", vkfast->gpu,
-    "handleName", NULL,
-    "structsMemory", batch->batch.structsMemory,
-    "structDeclarationMembersCount", slots_count,
-    "structDeclarationMembers", slots,
-    "structDeclarationMembersArrayROCount", 0,
-    "structDeclarationMembersArrayRO", NULL,
-    "outStruct", &structure,
-    "outStatuses", NULL,
+    "structsMembersCount", 2,
+    "structsMembers", members,
     "optionalFile", optionalFile,
     "optionalLine", optionalLine,
     "optionalUserData", NULL
   );
-  REDGPU_2_EXPECTWG(structure.handleDeclaration != NULL);
-  REDGPU_2_EXPECTWG(structure.handle != NULL || !"red2StructsMemorySuballocateStruct() call returned NULL. Ran out of vfBatchBegin()::batch_bindings_info::max_new_bindings_sets_count and all the other vfBatchBegin()::batch_bindings_info::max_* memory to allocate?");
-  batch->batch.currentStruct = structure;
 
+  vf_handle_t * programPipeline = (vf_handle_t *)(void *)programPipelineId;
+  RedHandleProcedureParameters procedureParameters = programPipeline->procedure.procedureParameters.procedureParameters;
+
+  np(redCallSetStructsMemory,
+    "address", addresses->redCallSetStructsMemory,
+    "calls", calls,
+    "structsMemory", vkfast->presentConvertStructsMemory,
+    "structsMemorySamplers", NULL
+  );
+  npfp(redCallSetProcedure, addresses->redCallSetProcedure,
+    "calls", calls,
+    "procedureType", RED_PROCEDURE_TYPE_COMPUTE,
+    "procedure", programPipeline->procedure.procedure
+  );
   np(redCallSetProcedureParameters,
-    "address", batch->batch.addresses.redCallSetProcedureParameters,
-    "calls", batch->batch.calls.handle,
+    "address", addresses->redCallSetProcedureParameters,
+    "calls", calls,
     "procedureType", RED_PROCEDURE_TYPE_COMPUTE,
-    "procedureParameters", batch->batch.currentProcedureParametersCompute
+    "procedureParameters", procedureParameters
   );
-}
-
-GPU_API_PRE void GPU_API_POST vfBatchBindStorageRaw(gpu_handle_context_t context, uint64_t batch_id, int slot, int storage_raw_count, const RedStructMemberArray * storage_raw, const char * optionalFile, int optionalLine) {
-  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
-  vf_handle_context_t * vkfast = batch->vkfast;
-  RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
-
-  REDGPU_2_EXPECTWG(batch->batch.currentStruct.handle != NULL || !"Was vfBatchBindNewBindingsSet() ever called previously?");
-
-  for (int i = 0; i < storage_raw_count; i += 1) {
-    REDGPU_2_EXPECTWG(storage_raw[i].arrayRangeBytesCount <= vkfast->gpuInfo->maxArrayRORWStructMemberRangeBytesCount);
-  }
-
-  RedStructMember member = {0};
-  member.setTo35   = 35;
-  member.setTo0    = 0;
-  member.structure = batch->batch.currentStruct.handle;
-  member.slot      = slot;
-  member.first     = 0;
-  member.count     = storage_raw_count;
-  member.type      = RED_STRUCT_MEMBER_TYPE_ARRAY_RO_RW;
-  member.textures  = NULL;
-  member.arrays    = storage_raw;
-  member.setTo00   = 0;
-  np(redStructsSet,
-    "context", vkfast->context,
-    "gpu", vkfast->gpu,
-    "structsMembersCount", 1,
-    "structsMembers", &member,
-    "optionalFile", optionalFile,
-    "optionalLine", optionalLine,
-    "optionalUserData", NULL
+  npfp(redCallSetProcedureParametersStructs, addresses->redCallSetProcedureParametersStructs,
+    "calls", calls,
+    "procedureType", RED_PROCEDURE_TYPE_COMPUTE,
+    "procedureParameters", procedureParameters,
+    "procedureParametersDeclarationStructsDeclarationsFirst", 0,
+    "structsCount", 1,
+    "structs", &structure->handle,
+    "setTo0", 0,
+    "setTo00", 0
+  );
+  npfp(redCallSetProcedureParametersVariables, addresses->redCallSetProcedureParametersVariables,
+    "calls", calls,
+    "procedureParameters", procedureParameters,
+    "visibleToStages", RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE,
+    "variablesBytesFirst", 0,
+    "dataBytesCount", 6*sizeof(unsigned),
+    "data", variables
+  );
+  npfp(redCallProcedureCompute, addresses->redCallProcedureCompute,
+    "calls", calls,
+    "workgroupsCountX", (width / 8) + 1,
+    "workgroupsCountY", (height / 8) + 1,
+    "workgroupsCountZ", 1
   );
-}
-
-GPU_API_PRE void GPU_API_POST vfBatchBindStorageSingle(gpu_handle_context_t context, uint64_t batch_id, int slot, uint64_t storage_id, const char * optionalFile, int optionalLine) {
-  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
-  vf_handle_context_t * vkfast = batch->vkfast;
-  RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
-
-  RedStructMemberArray storageRaw = {0};
-  vfStorageGetRaw(context, storage_id, &storageRaw, optionalFile, optionalLine);
-  vfBatchBindStorageRaw(context, batch_id, slot, 1, &storageRaw, optionalFile, optionalLine);
-}
-
-GPU_API_PRE void GPU_API_POST vfBatchBindStorageSingleLimited(gpu_handle_context_t context, uint64_t batch_id, int slot, uint64_t storage_id, uint64_t bytes_first, uint64_t bytes_count, const char * optionalFile, int optionalLine) {
-  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
-  vf_handle_context_t * vkfast = batch->vkfast;
-  RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
-
-  RedStructMemberArray storageRaw = {0};
-  vfStorageGetRaw(context, storage_id, &storageRaw, optionalFile, optionalLine);
-
-  const uint64_t range_bytes_first = storageRaw.arrayRangeBytesFirst;
-  const uint64_t range_bytes_count = storageRaw.arrayRangeBytesCount;
-
-  REDGPU_2_EXPECTWG(bytes_first < range_bytes_count);
-
-  const uint64_t available_bytes_count = range_bytes_count - bytes_first;
-
-  REDGPU_2_EXPECTWG(bytes_count <= available_bytes_count);
-
-  storageRaw.arrayRangeBytesFirst = range_bytes_first + bytes_first;
-  storageRaw.arrayRangeBytesCount = bytes_count;
 
-  vfBatchBindStorageRaw(context, batch_id, slot, 1, &storageRaw, optionalFile, optionalLine);
+  np(red2CallGlobalOrderBarrier,
+    "address", addresses->redCallUsageAliasOrderBarrier,
+    "calls", calls
+  );
 }
 
-GPU_API_PRE void GPU_API_POST vfBatchBindStorageSingleCapped(gpu_handle_context_t context, uint64_t batch_id, int slot, uint64_t storage_id, uint64_t bytes_first, uint64_t bytes_count_cap, const char * optionalFile, int optionalLine) {
-  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
-  vf_handle_context_t * vkfast = batch->vkfast;
+// NOTE(Constantine):
+// Uploads the pixels and records their copy to the GPU array, the convert dispatch, the optional upscale dispatch and
+// their barriers into calls. The window BGRA8 pixels are written to the start of the GPU array, the source BGRA8 pixels
+// (if upscaled) and the copied pixels follow them, each at the next struct member alignment.
+static void vfInternalPresentConvertRecord(vf_handle_context_t * vkfast, RedHandleCalls calls, const RedCallProceduresAndAddresses * addresses, const void * pixels, const gpu_draw_pixels_info_t * info, unsigned width, unsigned height, RedStructMemberArray * outBgra8, const char * optionalFile, int optionalLine) {
   RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
 
-  RedStructMemberArray storageRaw = {0};
-  vfStorageGetRaw(context, storage_id, &storageRaw, optionalFile, optionalLine);
+  const uint64_t alignment     = vkfast->gpuInfo->minArrayRORWStructMemberRangeBytesAlignment;
+  const unsigned sourceWidth   = info->source_width  != 0 ? info->source_width  : width;
+  const unsigned sourceHeight  = info->source_height != 0 ? info->source_height : height;
+  const int      isUpscaled    = sourceWidth != width || sourceHeight != height;
+
+  const uint64_t bgra8BytesCount       = 4 * (uint64_t)width * (uint64_t)height;
+  const uint64_t sourceBgra8BytesFirst = isUpscaled == 1 ? bgra8BytesCount + REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(bgra8BytesCount, alignment) : 0;
+  const uint64_t sourceBgra8BytesCount = 4 * (uint64_t)sourceWidth * (uint64_t)sourceHeight;
+  const uint64_t pixelsBytesFirst      = sourceBgra8BytesFirst + sourceBgra8BytesCount + REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(sourceBgra8BytesFirst + sourceBgra8BytesCount, alignment);
+  const uint64_t pixelsBytesCount      = vfInternalPixelsFormatBytesCount(info->format) * (uint64_t)sourceWidth * (uint64_t)sourceHeight;
+  const uint64_t pixelsWordsBytesCount = pixelsBytesCount + REDGPU_2_BYTES_TO_NEXT_ALIGNMENT_BOUNDARY(pixelsBytesCount, 4);
+  REDGPU_2_EXPECTWG(pixelsWordsBytesCount <= vkfast->gpuInfo->maxArrayRORWStructMemberRangeBytesCount);
+  REDGPU_2_EXPECTWG(sourceBgra8BytesCount <= vkfast->gpuInfo->maxArrayRORWStructMemberRangeBytesCount);
+
+  vfInternalPresentConvertProgramCreate(vkfast, optionalFile, optionalLine);
+  if (isUpscaled == 1) {
+    vfInternalPresentUpscaleProgramCreate(vkfast, optionalFile, optionalLine);
+  }
+  vfInternalPresentConvertReserve(vkfast, pixelsWordsBytesCount, pixelsBytesFirst + pixelsWordsBytesCount, optionalFile, optionalLine);
 
-  const uint64_t range_bytes_first = storageRaw.arrayRangeBytesFirst;
-  const uint64_t range_bytes_count = storageRaw.arrayRangeBytesCount;
+  red32MemoryCopy(vkfast->presentConvertPixelsCpuUpload_void_ptr_original, pixels, pixelsBytesCount);
+  if (vkfast->specificMemoryTypesCpuUploadIsCoherent == 0) {
+    vfInternalMemoryNonCoherentFlushOrInvalidate(vkfast, 0, vkfast->presentConvertPixelsCpuUpload_memory_and_array.handleAllocatedDedicatedOrMappableMemoryOrPickedMemory, vkfast->presentConvertPixelsCpuUpload_memory_and_array.array.memoryBytesCount, 0, pixelsWordsBytesCount, optionalFile, optionalLine);
+  }
 
-  REDGPU_2_EXPECTWG(bytes_first < range_bytes_count);
+  RedCopyArrayRange range = {0};
+  range.arrayRBytesFirst = 0;
+  range.arrayWBytesFirst = pixelsBytesFirst;
+  range.bytesCount       = pixelsWordsBytesCount;
+  npfp(redCallCopyArrayToArray, addresses->redCallCopyArrayToArray,
+    "calls", calls,
+    "arrayR", vkfast->presentConvertPixelsCpuUpload_memory_and_array.array.handle,
+    "arrayW", vkfast->presentConvertPixelsGpu_memory_and_array.array.handle,
+    "rangesCount", 1,
+    "ranges", &range
+  );
 
-  const uint64_t available_bytes_count = range_bytes_count - bytes_first;
+  np(red2CallGlobalOrderBarrier,
+    "address", addresses->redCallUsageAliasOrderBarrier,
+    "calls", calls
+  );
 
-  const uint64_t capped_bytes_count = bytes_count_cap <= available_bytes_count ? bytes_count_cap : available_bytes_count;
+  RedStructMemberArray bgra8 = {0};
+  bgra8.array                = vkfast->presentConvertPixelsGpu_memory_and_array.array.handle;
+  bgra8.arrayRangeBytesFirst = 0;
+  bgra8.arrayRangeBytesCount = bgra8BytesCount;
 
-  storageRaw.arrayRangeBytesFirst = range_bytes_first + bytes_first;
-  storageRaw.arrayRangeBytesCount = capped_bytes_count;
+  RedStructMemberArray sourceBgra8 = {0};
+  sourceBgra8.array                = vkfast->presentConvertPixelsGpu_memory_and_array.array.handle;
+  sourceBgra8.arrayRangeBytesFirst = sourceBgra8BytesFirst;
+  sourceBgra8.arrayRangeBytesCount = sourceBgra8BytesCount;
 
-  vfBatchBindStorageRaw(context, batch_id, slot, 1, &storageRaw, optionalFile, optionalLine);
+  {
+    RedStructMemberArray arrays[2] = {0};
+    arrays[0].array                = vkfast->presentConvertPixelsGpu_memory_and_array.array.handle;
+    arrays[0].arrayRangeBytesFirst = pixelsBytesFirst;
+    arrays[0].arrayRangeBytesCount = pixelsWordsBytesCount;
+    arrays[1]                      = sourceBgra8;
+
+    const float exposure     = info->exposure == 0 ? 1.0f : info->exposure;
+    const float inverseGamma = 1.0f / (info->gamma == 0 ? 2.2f : info->gamma);
+    unsigned variables[6] = {0};
+    variables[0] = sourceWidth;
+    variables[1] = sourceHeight;
+    variables[2] = info->format;
+    variables[3] = info->transfer;
+    red32MemoryCopy(&variables[4], &exposure, sizeof(float));
+    red32MemoryCopy(&variables[5], &inverseGamma, sizeof(float));
+    vfInternalPresentConvertRecordCompute(vkfast, calls, addresses, vkfast->presentConvertProgramPipeline, &vkfast->presentConvertStruct, arrays, variables, sourceWidth, sourceHeight, optionalFile, optionalLine);
+  }
+
+  if (isUpscaled == 1) {
+    RedStructMemberArray arrays[2] = {0};
+    arrays[0] = sourceBgra8;
+    arrays[1] = bgra8;
+
+    unsigned variables[6] = {0};
+    variables[0] = width;
+    variables[1] = height;
+    variables[2] = sourceWidth;
+    variables[3] = sourceHeight;
+    variables[4] = info->upscale;
+    red32MemoryCopy(&variables[5], &info->sharpness, sizeof(float));
+    vfInternalPresentConvertRecordCompute(vkfast, calls, addresses, vkfast->presentUpscaleProgramPipeline, &vkfast->presentUpscaleStruct, arrays, variables, width, height, optionalFile, optionalLine);
+  }
+
+  outBgra8[0] = bgra8;
 }
 
-GPU_API_PRE void GPU_API_POST vfBatchBindTextureRWEx(gpu_handle_context_t context, uint64_t batch_id, int slot, int textures_rw_count, const RedStructMemberTexture * textures_rw, const char * optionalFile, int optionalLine) {
-  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
-  vf_handle_context_t * vkfast = batch->vkfast;
+static int vfInternalAsyncDrawPixels(gpu_handle_context_t context, const RedStructMemberArray * pixels_storage_raw, const void * copy_pixels, int * out_optional_internal_present_image_index, RedBool32 optional_copy_image, RedHandleImage optional_image_to_copy, const gpu_draw_pixels_info_t * optional_convert_info, unsigned gpu_threads_count_plus_one_empty, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
   RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
 
-  REDGPU_2_EXPECTWG(batch->batch.currentStruct.handle != NULL || !"Was vfBatchBindNewBindingsSet() ever called previously?");
+  unsigned presentImageIndex = 0;
+  RedStatuses presentGetImageIndexStatuses = {0};
 
-  RedStructMember member = {0};
-  member.setTo35   = 35;
-  member.setTo0    = 0;
-  member.structure = batch->batch.currentStruct.handle;
-  member.slot      = slot;
-  member.first     = 0;
-  member.count     = textures_rw_count;
-  member.type      = RED_STRUCT_MEMBER_TYPE_TEXTURE_RW;
-  member.textures  = textures_rw;
-  member.arrays    = NULL;
-  member.setTo00   = 0;
-  np(redStructsSet,
+  vfInternalPresentSignalsCreate(vkfast, optionalFile, optionalLine);
+
+  vfInternalFrameTimestampsCurrent(vkfast)->acquireNanoseconds = vfInternalGetTimeNanoseconds();
+  np(redPresentGetImageIndex,
     "context", vkfast->context,
     "gpu", vkfast->gpu,
-    "structsMembersCount", 1,
-    "structsMembers", &member,
+    "present", vkfast->present,
+    "signalCpuSignal", NULL,
+    "signalGpuSignal", vkfast->presentGpuSignalAcquire,
+    "outImageIndex", &presentImageIndex,
+    "outStatuses", &presentGetImageIndexStatuses,
     "optionalFile", optionalFile,
     "optionalLine", optionalLine,
     "optionalUserData", NULL
   );
-}
 
-GPU_API_PRE void GPU_API_POST vfBatchBindNewBindingsEnd(gpu_handle_context_t context, uint64_t batch_id, const char * optionalFile, int optionalLine) {
-  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
-  vf_handle_context_t * vkfast = batch->vkfast;
-  RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
+  if (out_optional_internal_present_image_index != NULL) {
+    out_optional_internal_present_image_index[0] = presentImageIndex;
+  }
 
-  npfp(redCallSetProcedureParametersStructs, batch->batch.addresses.redCallSetProcedureParametersStructs,
-    "calls", batch->batch.calls.handle,
-    "procedureType", RED_PROCEDURE_TYPE_COMPUTE,
-    "procedureParameters", batch->batch.currentProcedureParametersCompute,
-    "procedureParametersDeclarationStructsDeclarationsFirst", 0,
-    "structsCount", 1, // NOTE(Constantine): Only one struct for now.
-    "structs", &batch->batch.currentStruct.handle,
-    "setTo0", 0,
-    "setTo00", 0
-  );
+  REDGPU_2_EXPECTWG(presentGetImageIndexStatuses.status == RED_STATUS_SUCCESS || presentGetImageIndexStatuses.status == RED_STATUS_PRESENT_IS_SUBOPTIMAL);
+  REDGPU_2_EXPECTWG(presentGetImageIndexStatuses.statusError == RED_STATUS_SUCCESS || presentGetImageIndexStatuses.statusError == RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE);
+  if (presentGetImageIndexStatuses.status == RED_STATUS_PRESENT_IS_SUBOPTIMAL || presentGetImageIndexStatuses.statusError == RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE) {
+    int isRebuilded = vfInternalRebuildPresent(context, vkfast->presentVsyncMode, vkfast->presentImagesCount, optionalFile, optionalLine);
+    return isRebuilded;
+  }
 
-  np(red2DestroyHandle,
+  if (copy_pixels != NULL && optional_convert_info == NULL) {
+    // NOTE(Constantine): The reason we copy pixels here is because vkfast->screenWidth/Height were updated in a potential vfInternalRebuildPresent call above.
+    red32MemoryCopy(vkfast->presentPixelsCpuUpload_void_ptr_original, copy_pixels, sizeof(unsigned char) * 4 * vkfast->screenHeight * vkfast->screenWidth);
+    if (vkfast->specificMemoryTypesCpuUploadIsCoherent == 0) {
+      vfInternalMemoryNonCoherentFlushOrInvalidate(vkfast, 0, vkfast->presentPixelsCpuUpload_memory_and_array.handleAllocatedDedicatedOrMappableMemoryOrPickedMemory, vkfast->presentPixelsCpuUpload_memory_and_array.array.memoryBytesCount, 0, sizeof(unsigned char) * 4 * vkfast->screenHeight * vkfast->screenWidth, optionalFile, optionalLine);
+    }
+  }
+
+  np(redCpuSignalWait,
     "context", vkfast->context,
     "gpu", vkfast->gpu,
-    "handleType", RED_HANDLE_TYPE_STRUCT_DECLARATION,
-    "handle", batch->batch.currentStruct.handleDeclaration,
-    "optionalHandle2", NULL,
+    "cpuSignalsCount", 1,
+    "cpuSignals", &vkfast->presentCpuSignal,
+    "waitAll", 1,
+    "outStatuses", NULL,
     "optionalFile", optionalFile,
     "optionalLine", optionalLine,
     "optionalUserData", NULL
   );
-  batch->batch.currentStruct.handleDeclaration = NULL;
-  batch->batch.currentStruct.handle = NULL;
-}
-
-GPU_API_PRE void GPU_API_POST vfBatchBindVariablesCopy(gpu_handle_context_t context, uint64_t batch_id, unsigned variables_bytes_offset, unsigned data_bytes_count, const void * data, const char * optionalFile, int optionalLine) {
-  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
-  vf_handle_context_t * vkfast = batch->vkfast;
-  RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
-
-  REDGPU_2_EXPECTWG(batch->batch.currentProcedureParametersCompute != NULL || !"Was vfBatchBindProgramPipelineCompute() ever called previously?");
-
-  npfp(redCallSetProcedureParametersVariables, batch->batch.addresses.redCallSetProcedureParametersVariables,
-    "calls", batch->batch.calls.handle,
-    "procedureParameters", batch->batch.currentProcedureParametersCompute,
-    "visibleToStages", RED_VISIBLE_TO_STAGE_BITFLAG_COMPUTE,
-    "variablesBytesFirst", variables_bytes_offset,
-    "dataBytesCount", data_bytes_count,
-    "data", data
+  np(redCpuSignalUnsignal,
+    "context", vkfast->context,
+    "gpu", vkfast->gpu,
+    "cpuSignalsCount", 1,
+    "cpuSignals", &vkfast->presentCpuSignal,
+    "outStatuses", NULL,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
+    "optionalUserData", NULL
   );
-}
+  vfInternalPresentRetiredRelease(vkfast, optionalFile, optionalLine);
 
-GPU_API_PRE void GPU_API_POST vfBatchCompute(gpu_handle_context_t context, uint64_t batch_id, unsigned workgroups_count_x, unsigned workgroups_count_y, unsigned workgroups_count_z, const char * optionalFile, int optionalLine) {
-  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
-  vf_handle_context_t * vkfast = batch->vkfast;
-  RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
+  RedCalls * calls = &vkfast->presentCopyCalls;
 
-  npfp(redCallProcedureCompute, batch->batch.addresses.redCallProcedureCompute,
-    "calls", batch->batch.calls.handle,
-    "workgroupsCountX", workgroups_count_x,
-    "workgroupsCountY", workgroups_count_y,
-    "workgroupsCountZ", workgroups_count_z
-  );
-}
+  {
+    RedCallProceduresAndAddresses addresses = {0};
+    np(redGetCallProceduresAndAddresses,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "outCallProceduresAndAddresses", &addresses,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
 
-GPU_API_PRE void GPU_API_POST vfBatchBarrierMemory(gpu_handle_context_t context, uint64_t batch_id, const char * optionalFile, int optionalLine) {
-  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
-  vf_handle_context_t * vkfast = batch->vkfast;
-  RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
+    np(redCallsSet,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "calls", calls->handle,
+      "callsMemory", calls->memory,
+      "callsReusable", calls->reusable,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
 
-  np(red2CallGlobalOrderBarrier,
-    "address", batch->batch.addresses.redCallUsageAliasOrderBarrier,
-    "calls", batch->batch.calls.handle
-  );
-}
+    // NOTE(Constantine): Converted pixels are uploaded only now, after presentCpuSignal was waited, because the convert arrays are reused in place.
+    RedStructMemberArray convertedPixels = {0};
+    if (optional_convert_info != NULL) {
+      vfInternalPresentConvertRecord(vkfast, calls->handle, &addresses, copy_pixels, optional_convert_info, vkfast->screenWidth, vkfast->screenHeight, &convertedPixels, optionalFile, optionalLine);
+      pixels_storage_raw = &convertedPixels;
+    }
 
-GPU_API_PRE void GPU_API_POST vfBatchBarrierCpuReadback(gpu_handle_context_t context, uint64_t batch_id, const char * optionalFile, int optionalLine) {
-  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
-  vf_handle_context_t * vkfast = batch->vkfast;
-  RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
+    {
+      RedUsageImage imageUsage = {0};
+      imageUsage.barrierSplit           = RED_BARRIER_SPLIT_NONE;
+      imageUsage.oldAccessStages        = 0;
+      imageUsage.newAccessStages        = RED_ACCESS_STAGE_BITFLAG_COPY;
+      imageUsage.oldAccess              = 0;
+      imageUsage.newAccess              = RED_ACCESS_BITFLAG_COPY_W;
+      imageUsage.oldState               = RED_STATE_UNUSABLE;
+      imageUsage.newState               = RED_STATE_USABLE;
+      imageUsage.queueFamilyIndexSource = -1;
+      imageUsage.queueFamilyIndexTarget = -1;
+      imageUsage.image                  = vkfast->presentImages[presentImageIndex];
+      imageUsage.imageAllParts          = RED_IMAGE_PART_BITFLAG_COLOR;
+      imageUsage.imageLevelsFirst       = 0;
+      imageUsage.imageLevelsCount       = -1;
+      imageUsage.imageLayersFirst       = 0;
+      imageUsage.imageLayersCount       = -1;
+      Red2UsageImageTempCallStruct imageUsageTempStruct = {0};
+      np(red2CallUsageAliasOrderBarrier,
+        "address", addresses.redCallUsageAliasOrderBarrier,
+        "calls", calls->handle,
+        "context", vkfast->context,
+        "arrayUsagesCount", 0,
+        "arrayUsages", NULL,
+        "arrayTempCallStructs", NULL,
+        "imageUsagesCount", 1,
+        "imageUsages", &imageUsage,
+        "imageTempCallStructs", &imageUsageTempStruct,
+        "aliasesCount", 0,
+        "aliases", NULL,
+        "ordersCount", 0,
+        "orders", NULL,
+        "dependencyByRegion", 0
+      );
+    }
+
+    if (optional_copy_image == 1) {
+      // NOTE(Constantine):
+      // 'RedBool32 optional_copy_image' parameter is intentional, because
+      // if the user will pass a NULL image accidentally, this will still
+      // take the image copy path, rather than the pixels buffer copy path.
+      RedCopyImageRange copy = {0};
+      copy.imageRParts.allParts     = RED_IMAGE_PART_BITFLAG_COLOR;
+      copy.imageRParts.level        = 0;
+      copy.imageRParts.layersFirst  = 0;
+      copy.imageRParts.layersCount  = 1;
+      copy.imageROffset.texelX      = 0;
+      copy.imageROffset.texelY      = 0;
+      copy.imageROffset.texelZ      = 0;
+      copy.imageWParts.allParts     = RED_IMAGE_PART_BITFLAG_COLOR;
+      copy.imageWParts.level        = 0;
+      copy.imageWParts.layersFirst  = 0;
+      copy.imageWParts.layersCount  = 1;
+      copy.imageWOffset.texelX      = 0;
+      copy.imageWOffset.texelY      = 0;
+      copy.imageWOffset.texelZ      = 0;
+      copy.extent.texelsCountWidth  = vkfast->screenWidth;
+      copy.extent.texelsCountHeight = vkfast->screenHeight;
+      copy.extent.texelsCountDepth  = 1;
+      npfp(redCallCopyImageToImage, addresses.redCallCopyImageToImage,
+        "calls", calls->handle,
+        "imageR", optional_image_to_copy,
+        "setTo1", 1,
+        "imageW", vkfast->presentImages[presentImageIndex],
+        "setTo01", 1,
+        "rangesCount", 1,
+        "ranges", &copy
+      );
+    } else {
+      RedCopyArrayImageRange copy = {0};
+      copy.arrayBytesFirst               = pixels_storage_raw->arrayRangeBytesFirst;
+      copy.arrayTexelsCountToNextRow     = vkfast->screenWidth;
+      copy.arrayTexelsCountToNextLayerOr3DDepthSliceDividedByTexelsCountToNextRow = 0;
+      copy.imageParts.allParts           = RED_IMAGE_PART_BITFLAG_COLOR;
+      copy.imageParts.level              = 0;
+      copy.imageParts.layersFirst        = 0;
+      copy.imageParts.layersCount        = 1;
+      copy.imageOffset.texelX            = 0;
+      copy.imageOffset.texelY            = 0;
+      copy.imageOffset.texelZ            = 0;
+      copy.imageExtent.texelsCountWidth  = vkfast->screenWidth;
+      copy.imageExtent.texelsCountHeight = vkfast->screenHeight;
+      copy.imageExtent.texelsCountDepth  = 1;
+      npfp(redCallCopyArrayToImage, addresses.redCallCopyArrayToImage,
+        "calls", calls->handle,
+        "arrayR", pixels_storage_raw->array,
+        "imageW", vkfast->presentImages[presentImageIndex],
+        "setTo1", 1,
+        "rangesCount", 1,
+        "ranges", &copy
+      );
+    }
 
-  np(red2CallGlobalReadbackBarrier,
-    "address", batch->batch.addresses.redCallUsageAliasOrderBarrier,
-    "calls", batch->batch.calls.handle
-  );
-}
+    {
+      RedUsageImage imageUsage = {0};
+      imageUsage.barrierSplit           = RED_BARRIER_SPLIT_NONE;
+      imageUsage.oldAccessStages        = RED_ACCESS_STAGE_BITFLAG_COPY;
+      imageUsage.newAccessStages        = 0;
+      imageUsage.oldAccess              = RED_ACCESS_BITFLAG_COPY_W;
+      imageUsage.newAccess              = 0;
+      imageUsage.oldState               = RED_STATE_USABLE;
+      imageUsage.newState               = RED_STATE_PRESENT;
+      imageUsage.queueFamilyIndexSource = -1;
+      imageUsage.queueFamilyIndexTarget = -1;
+      imageUsage.image                  = vkfast->presentImages[presentImageIndex];
+      imageUsage.imageAllParts          = RED_IMAGE_PART_BITFLAG_COLOR;
+      imageUsage.imageLevelsFirst       = 0;
+      imageUsage.imageLevelsCount       = -1;
+      imageUsage.imageLayersFirst       = 0;
+      imageUsage.imageLayersCount       = -1;
+      Red2UsageImageTempCallStruct imageUsageTempStruct = {0};
+      np(red2CallUsageAliasOrderBarrier,
+        "address", addresses.redCallUsageAliasOrderBarrier,
+        "calls", calls->handle,
+        "context", vkfast->context,
+        "arrayUsagesCount", 0,
+        "arrayUsages", NULL,
+        "arrayTempCallStructs", NULL,
+        "imageUsagesCount", 1,
+        "imageUsages", &imageUsage,
+        "imageTempCallStructs", &imageUsageTempStruct,
+        "aliasesCount", 0,
+        "aliases", NULL,
+        "ordersCount", 0,
+        "orders", NULL,
+        "dependencyByRegion", 0
+      );
+    }
 
-GPU_API_PRE void GPU_API_POST vfBatchEnd(gpu_handle_context_t context, uint64_t batch_id, const char * optionalFile, int optionalLine) {
-  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
-  vf_handle_context_t * vkfast = batch->vkfast;
-  RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
+    np(redCallsEnd,
+      "context", vkfast->context,
+      "gpu", vkfast->gpu,
+      "calls", calls->handle,
+      "callsMemory", calls->memory,
+      "outStatuses", NULL,
+      "optionalFile", optionalFile,
+      "optionalLine", optionalLine,
+      "optionalUserData", NULL
+    );
+  }
 
-  np(redCallsEnd,
+  // NOTE(Constantine): Defend vkfast->presentGpuSignalSubmit from being signaled while it's still in use by the previous redQueuePresent() call.
+  np(redQueuePresent,
     "context", vkfast->context,
     "gpu", vkfast->gpu,
-    "calls", batch->batch.calls.handle,
-    "callsMemory", batch->batch.calls.memory,
+    "queue", vkfast->gpuInfo->queues[vkfast->presentQueueIndex],
+    "waitForAndUnsignalGpuSignalsCount", 0,
+    "waitForAndUnsignalGpuSignals", NULL,
+    "presentsCount", 0,
+    "presents", NULL,
+    "presentsImageIndex", NULL,
+    "outPresentsStatus", NULL,
     "outStatuses", NULL,
     "optionalFile", optionalFile,
     "optionalLine", optionalLine,
     "optionalUserData", NULL
   );
 
-  batch->batch.currentStruct.handle = NULL;
-  batch->batch.currentStruct.handleDeclaration = NULL;
-  batch->batch.currentProcedureParametersCompute = NULL;
-}
-
-GPU_API_PRE void GPU_API_POST vfGpuThreadCreate(gpu_handle_context_t context, unsigned gpu_threads_count, gpu_thread_t * out_gpu_threads, const char ** optional_gpu_threads_debug_name, const char * optionalFile, int optionalLine) {
-  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+  REDGPU_2_EXPECTWG(gpu_threads_count_plus_one_empty >= 1);
 
-  RedHandleGpu gpu = vkfast->gpu;
+  {
+    gpu_threads[gpu_threads_count_plus_one_empty-1] = vkfast->presentGpuSignalAcquire;
 
-  for (unsigned i = 0; i < gpu_threads_count; i += 1) {
-    np(redCreateGpuSignal,
+    RedGpuTimeline timelines[1] = {0};
+    timelines[0].setTo4                            = 4;
+    timelines[0].setTo0                            = 0;
+    timelines[0].waitForAndUnsignalGpuSignalsCount = gpu_threads_count_plus_one_empty;
+    timelines[0].waitForAndUnsignalGpuSignals      = gpu_threads;
+    timelines[0].setTo65536                        = gpu_threads_array_of_65536_int_values;
+    timelines[0].callsCount                        = 1;
+    timelines[0].calls                             = &calls->handle;
+    timelines[0].signalGpuSignalsCount             = 1;
+    timelines[0].signalGpuSignals                  = &vkfast->presentGpuSignalSubmit;
+    vfInternalFrameTimestampsCurrent(vkfast)->submitNanoseconds = vfInternalGetTimeNanoseconds();
+    np(redQueueSubmit,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "handleName", optional_gpu_threads_debug_name == NULL ? NULL : optional_gpu_threads_debug_name[i],
-      "outGpuSignal", &out_gpu_threads[i],
+      "queue", vkfast->gpuInfo->queues[vkfast->presentQueueIndex],
+      "timelinesCount", 1,
+      "timelines", timelines,
+      "signalCpuSignal", vkfast->presentCpuSignal,
       "outStatuses", NULL,
       "optionalFile", optionalFile,
       "optionalLine", optionalLine,
       "optionalUserData", NULL
     );
-    REDGPU_2_EXPECTWG(out_gpu_threads[i] != NULL);
   }
 
+  // NOTE(Constantine):
+  // This code is here to guarantee that all the input threads are left in the output state.
   {
     RedHandleCpuSignal tempCpuSignal = NULL;
     np(redCreateCpuSignal,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "handleName", "vkFast_vfGpuThreadCreate_tempCpuSignal",
+      "handleName", "vkFast_vfInternalAsyncDrawPixels_tempCpuSignal",
       "createSignaled", 0,
       "outCpuSignal", &tempCpuSignal,
       "outStatuses", NULL,
@@ -3959,7 +9183,7 @@ GPU_API_PRE void GPU_API_POST vfGpuThreadCreate(gpu_handle_context_t context, un
     np(redCreateCalls,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "handleName", "vkFast_vfGpuThreadCreate_tempCalls",
+      "handleName", "vkFast_vfInternalAsyncDrawPixels_tempCalls",
       "queueFamilyIndex", vkfast->gpuInfo->queuesFamilyIndex[vkfast->presentQueueIndex],
       "outCalls", &tempCalls,
       "outStatuses", NULL,
@@ -4010,20 +9234,22 @@ GPU_API_PRE void GPU_API_POST vfGpuThreadCreate(gpu_handle_context_t context, un
       );
     }
 
+    gpu_threads[gpu_threads_count_plus_one_empty-1] = vkfast->presentGpuSignalSubmit;
+
     RedGpuTimeline timelines[1] = {0};
     timelines[0].setTo4                            = 4;
     timelines[0].setTo0                            = 0;
-    timelines[0].waitForAndUnsignalGpuSignalsCount = 0;
-    timelines[0].waitForAndUnsignalGpuSignals      = NULL;
-    timelines[0].setTo65536                        = NULL;
+    timelines[0].waitForAndUnsignalGpuSignalsCount = 1;
+    timelines[0].waitForAndUnsignalGpuSignals      = &vkfast->presentGpuSignalSubmit;
+    timelines[0].setTo65536                        = gpu_threads_array_of_65536_int_values;
     timelines[0].callsCount                        = 1;
     timelines[0].calls                             = &tempCalls.handle;
-    timelines[0].signalGpuSignalsCount             = gpu_threads_count;
-    timelines[0].signalGpuSignals                  = out_gpu_threads;
+    timelines[0].signalGpuSignalsCount             = gpu_threads_count_plus_one_empty;
+    timelines[0].signalGpuSignals                  = gpu_threads;
     np(redQueueSubmit,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "queue", vkfast->mainQueue,
+      "queue", vkfast->gpuInfo->queues[vkfast->presentQueueIndex],
       "timelinesCount", 1,
       "timelines", timelines,
       "signalCpuSignal", tempCpuSignal,
@@ -4067,198 +9293,156 @@ GPU_API_PRE void GPU_API_POST vfGpuThreadCreate(gpu_handle_context_t context, un
       "optionalUserData", NULL
     );
   }
-}
-
-GPU_API_PRE void GPU_API_POST vfGpuThreadDestroy(gpu_handle_context_t context, gpu_thread_t gpu_thread) {
-  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
 
-  np(red2DestroyHandle,
+  RedStatus queuePresentStatus = RED_STATUS_SUCCESS;
+  RedStatuses queuePresentStatuses = {0};
+  np(redQueuePresent,
     "context", vkfast->context,
     "gpu", vkfast->gpu,
-    "handleType", RED_HANDLE_TYPE_GPU_SIGNAL,
-    "handle", gpu_thread,
-    "optionalHandle2", NULL,
-    "optionalFile", NULL,
-    "optionalLine", 0,
+    "queue", vkfast->gpuInfo->queues[vkfast->presentQueueIndex],
+    "waitForAndUnsignalGpuSignalsCount", 1,
+    "waitForAndUnsignalGpuSignals", &vkfast->presentGpuSignalSubmit,
+    "presentsCount", 1,
+    "presents", &vkfast->present,
+    "presentsImageIndex", &presentImageIndex,
+    "outPresentsStatus", &queuePresentStatus,
+    "outStatuses", &queuePresentStatuses,
+    "optionalFile", optionalFile,
+    "optionalLine", optionalLine,
     "optionalUserData", NULL
   );
-}
-
-GPU_API_PRE RedHandleCalls GPU_API_POST vfBatchGetRawHandle(gpu_handle_context_t context, uint64_t batch_id, const char * optionalFile, int optionalLine) {
-  vf_handle_t * batch = (vf_handle_t *)(void *)batch_id;
-  vf_handle_context_t * vkfast = batch->vkfast;
-  RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(batch->handle_id == VF_HANDLE_ID_BATCH);
+  vfInternalFramePresented(vkfast);
+  REDGPU_2_EXPECTWG(queuePresentStatus == RED_STATUS_SUCCESS || queuePresentStatus == RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE || queuePresentStatus == RED_STATUS_PRESENT_IS_SUBOPTIMAL);
+  REDGPU_2_EXPECTWG(queuePresentStatuses.status == RED_STATUS_SUCCESS || queuePresentStatuses.status == RED_STATUS_PRESENT_IS_SUBOPTIMAL);
+  REDGPU_2_EXPECTWG(queuePresentStatuses.statusError == RED_STATUS_SUCCESS || queuePresentStatuses.statusError == RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE);
+  if (queuePresentStatus == RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE || queuePresentStatus == RED_STATUS_PRESENT_IS_SUBOPTIMAL || queuePresentStatuses.status == RED_STATUS_PRESENT_IS_SUBOPTIMAL || queuePresentStatuses.statusError == RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE) {
+    int isRebuilded = vfInternalRebuildPresent(context, vkfast->presentVsyncMode, vkfast->presentImagesCount, optionalFile, optionalLine);
+    return isRebuilded;
+  }
 
-  return batch->batch.calls.handle;
+  int isRebuilded = 0;
+  return isRebuilded;
 }
 
-static uint64_t vfInternalAsyncBatchExecuteRaw(gpu_handle_context_t context, RedHandleQueue queue, uint64_t batch_calls_count, const RedHandleCalls * batch_calls, unsigned gpu_threads_count, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
+GPU_API_PRE int GPU_API_POST vfDrawPixels(gpu_handle_context_t context, const void * pixels, int * out_optional_internal_present_image_index, unsigned gpu_threads_count_plus_one_empty, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
   vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
 
   RedHandleGpu gpu = vkfast->gpu;
 
-  // To destroy
-  RedHandleCpuSignal cpuSignal = NULL;
-  np(redCreateCpuSignal,
-    "context", vkfast->context,
-    "gpu", vkfast->gpu,
-    "handleName", NULL,
-    "createSignaled", 0,
-    "outCpuSignal", &cpuSignal,
-    "outStatuses", NULL,
-    "optionalFile", optionalFile,
-    "optionalLine", optionalLine,
-    "optionalUserData", NULL
-  );
-  REDGPU_2_EXPECTWG(cpuSignal != NULL);
+  RedStructMemberArray presentPixels_storage_raw = {0};
+  presentPixels_storage_raw.array = vkfast->presentPixelsCpuUpload_memory_and_array.array.handle;
+  presentPixels_storage_raw.arrayRangeBytesFirst = 0;
+  presentPixels_storage_raw.arrayRangeBytesCount = vkfast->presentPixelsCpuUpload_memory_allocation_size;
 
-  RedGpuTimeline timelines[1] = {0};
-  timelines[0].setTo4                            = 4;
-  timelines[0].setTo0                            = 0;
-  timelines[0].waitForAndUnsignalGpuSignalsCount = gpu_threads_count;
-  timelines[0].waitForAndUnsignalGpuSignals      = gpu_threads;
-  timelines[0].setTo65536                        = gpu_threads_array_of_65536_int_values;
-  timelines[0].callsCount                        = batch_calls_count;
-  timelines[0].calls                             = batch_calls;
-  timelines[0].signalGpuSignalsCount             = gpu_threads_count;
-  timelines[0].signalGpuSignals                  = gpu_threads;
-  np(redQueueSubmit,
-    "context", vkfast->context,
-    "gpu", vkfast->gpu,
-    "queue", queue,
-    "timelinesCount", 1,
-    "timelines", timelines,
-    "signalCpuSignal", cpuSignal,
-    "outStatuses", NULL,
-    "optionalFile", optionalFile,
-    "optionalLine", optionalLine,
-    "optionalUserData", NULL
-  );
+  int isRebuilded = vfInternalAsyncDrawPixels(context, &presentPixels_storage_raw, pixels, out_optional_internal_present_image_index, 0, NULL, NULL, gpu_threads_count_plus_one_empty, gpu_threads, gpu_threads_array_of_65536_int_values, optionalFile, optionalLine);
+  return isRebuilded;
+}
 
-  return (uint64_t)(void *)cpuSignal;
+GPU_API_PRE int GPU_API_POST vfAsyncDrawPixels(gpu_handle_context_t context, uint64_t pixels_storage_id, int * out_optional_internal_present_image_index, unsigned gpu_threads_count_plus_one_empty, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
+  vf_handle_t * storage = (vf_handle_t *)(void *)pixels_storage_id;
+  vf_handle_context_t * vkfast = storage->vkfast;
+  RedHandleGpu gpu = vkfast->gpu;
+  REDGPU_2_EXPECTWG(storage->handle_id == VF_HANDLE_ID_STORAGE);
+  int isRebuilded = vfInternalAsyncDrawPixels(context, &storage->storage.arrayRangeInfo, NULL, out_optional_internal_present_image_index, 0, NULL, NULL, gpu_threads_count_plus_one_empty, gpu_threads, gpu_threads_array_of_65536_int_values, optionalFile, optionalLine);
+  return isRebuilded;
 }
 
-GPU_API_PRE uint64_t GPU_API_POST vfAsyncBatchExecuteRaw(gpu_handle_context_t context, uint64_t batch_raw_count, const RedHandleCalls * batch_raw, unsigned gpu_threads_count, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
-  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
-  return vfInternalAsyncBatchExecuteRaw(context, vkfast->mainQueue, batch_raw_count, batch_raw, gpu_threads_count, gpu_threads, gpu_threads_array_of_65536_int_values, optionalFile, optionalLine);
+GPU_API_PRE int GPU_API_POST vfAsyncDrawPixelsRaw(gpu_handle_context_t context, const RedStructMemberArray * pixels_storage_raw, int * out_optional_internal_present_image_index, unsigned gpu_threads_count_plus_one_empty, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
+  int isRebuilded = vfInternalAsyncDrawPixels(context, pixels_storage_raw, NULL, out_optional_internal_present_image_index, 0, NULL, NULL, gpu_threads_count_plus_one_empty, gpu_threads, gpu_threads_array_of_65536_int_values, optionalFile, optionalLine);
+  return isRebuilded;
 }
 
-GPU_API_PRE uint64_t GPU_API_POST vfAsyncBatchExecuteRawEx(gpu_handle_context_t context, RedHandleQueue queue, uint64_t batch_raw_count, const RedHandleCalls * batch_raw, unsigned gpu_threads_count, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
-  return vfInternalAsyncBatchExecuteRaw(context, queue, batch_raw_count, batch_raw, gpu_threads_count, gpu_threads, gpu_threads_array_of_65536_int_values, optionalFile, optionalLine);
+GPU_API_PRE int GPU_API_POST vfAsyncDrawImageRaw(gpu_handle_context_t context, RedHandleImage image_raw, int * out_optional_is_image_copy_finished_cpu_signal_index, unsigned gpu_threads_count_plus_one_empty, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
+  int isRebuilded = vfInternalAsyncDrawPixels(context, NULL, NULL, out_optional_is_image_copy_finished_cpu_signal_index, 1, image_raw, NULL, gpu_threads_count_plus_one_empty, gpu_threads, gpu_threads_array_of_65536_int_values, optionalFile, optionalLine);
+  return isRebuilded;
 }
 
-GPU_API_PRE void GPU_API_POST vfAsyncWaitToFinish(gpu_handle_context_t context, uint64_t async_id, const char * optionalFile, int optionalLine) {
-  if (async_id == 0) {
-    return;
+GPU_API_PRE int GPU_API_POST vfDrawPixelsEx(gpu_handle_context_t context, const void * pixels, const gpu_draw_pixels_info_t * draw_pixels_info, int * out_optional_internal_present_image_index, unsigned gpu_threads_count_plus_one_empty, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
+  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+
+  const int isWindowSized = draw_pixels_info == NULL ||
+    ((draw_pixels_info->source_width  == 0 || draw_pixels_info->source_width  == vkfast->screenWidth) &&
+     (draw_pixels_info->source_height == 0 || draw_pixels_info->source_height == vkfast->screenHeight));
+  if (draw_pixels_info == NULL || (isWindowSized == 1 && draw_pixels_info->format == GPU_PIXELS_FORMAT_BGRA8 && draw_pixels_info->transfer == GPU_PIXELS_TRANSFER_NONE && (draw_pixels_info->exposure == 0 || draw_pixels_info->exposure == 1))) {
+    // NOTE(Constantine): Nothing to convert, take the plain copy path.
+    return vfDrawPixels(context, pixels, out_optional_internal_present_image_index, gpu_threads_count_plus_one_empty, gpu_threads, gpu_threads_array_of_65536_int_values, optionalFile, optionalLine);
   }
+  int isRebuilded = vfInternalAsyncDrawPixels(context, NULL, pixels, out_optional_internal_present_image_index, 0, NULL, draw_pixels_info, gpu_threads_count_plus_one_empty, gpu_threads, gpu_threads_array_of_65536_int_values, optionalFile, optionalLine);
+  return isRebuilded;
+}
 
+GPU_API_PRE void GPU_API_POST vfDrawPixelsWindows(gpu_handle_context_t context, unsigned draws_count, gpu_window_draw_t * draws, unsigned gpu_threads_count_plus_one_empty, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
   vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
 
-  RedHandleCpuSignal cpuSignal = (RedHandleCpuSignal)(void *)async_id;
+  RedHandleGpu gpu = vkfast->gpu;
 
-  np(redCpuSignalWait,
-    "context", vkfast->context,
-    "gpu", vkfast->gpu,
-    "cpuSignalsCount", 1,
-    "cpuSignals", &cpuSignal,
-    "waitAll", 1,
-    "outStatuses", NULL,
-    "optionalFile", optionalFile,
-    "optionalLine", optionalLine,
-    "optionalUserData", NULL
-  );
+  REDGPU_2_EXPECTWG(draws_count <= GPU_WINDOWS_MAX_COUNT);
+  REDGPU_2_EXPECTWG(gpu_threads_count_plus_one_empty >= 1);
 
-  np(red2DestroyHandle,
-    "context", vkfast->context,
-    "gpu", vkfast->gpu,
-    "handleType", RED_HANDLE_TYPE_CPU_SIGNAL,
-    "handle", cpuSignal,
-    "optionalHandle2", NULL,
-    "optionalFile", optionalFile,
-    "optionalLine", optionalLine,
-    "optionalUserData", NULL
-  );
-}
+  const unsigned gpuThreadsCount = gpu_threads_count_plus_one_empty - 1;
+
+  vfInternalPresentSignalsCreate(vkfast, optionalFile, optionalLine);
+
+  vfInternalFrameTimestampsCurrent(vkfast)->acquireNanoseconds = vfInternalGetTimeNanoseconds();
+
+  // NOTE(Constantine): Windows whose present images were acquired, in the order of draws.
+  unsigned              drawsIndices[GPU_WINDOWS_MAX_COUNT]          = {0};
+  vf_handle_context_t * windows[GPU_WINDOWS_MAX_COUNT]               = {0};
+  RedHandlePresent      presents[GPU_WINDOWS_MAX_COUNT]              = {0};
+  unsigned              presentsImagesIndices[GPU_WINDOWS_MAX_COUNT] = {0};
+  unsigned              windowsCount = 0;
+
+  for (unsigned i = 0; i < draws_count; i += 1) {
+    draws[i].out_is_rebuilded = 0;
 
-static int vfInternalAsyncDrawPixels(gpu_handle_context_t context, const RedStructMemberArray * pixels_storage_raw, const void * copy_pixels, int * out_optional_internal_present_image_index, RedBool32 optional_copy_image, RedHandleImage optional_image_to_copy, unsigned gpu_threads_count_plus_one_empty, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
-  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
+    vf_handle_context_t * window = (vf_handle_context_t *)(void *)vfWindowGetContext(context, draws[i].window_index);
+    for (unsigned j = 0; j < windowsCount; j += 1) {
+      REDGPU_2_EXPECTWG(!"A window can only be drawn once per call" || windows[j] != window);
+    }
 
-  RedHandleGpu gpu = vkfast->gpu;
+    if (window->present == NULL) {
+      // NOTE(Constantine): The window was minimized when its present was last rebuilt.
+      draws[i].out_is_rebuilded = vfInternalRebuildPresent((gpu_handle_context_t)(void *)window, window->presentVsyncMode, window->presentImagesCount, optionalFile, optionalLine);
+      continue;
+    }
 
-  unsigned presentImageIndex = 0;
-  RedStatuses presentGetImageIndexStatuses = {0};
+    vfInternalPresentSignalsCreate(window, optionalFile, optionalLine);
 
-  if (vkfast->presentCpuSignal == NULL) {
-    np(redCreateCpuSignal,
-      "context", vkfast->context,
-      "gpu", vkfast->gpu,
-      "handleName", "vkFast_vfInternalAsyncDrawPixels_presentCpuSignal",
-      "createSignaled", 1,
-      "outCpuSignal", &vkfast->presentCpuSignal,
-      "outStatuses", NULL,
-      "optionalFile", optionalFile,
-      "optionalLine", optionalLine,
-      "optionalUserData", NULL
-    );
-    REDGPU_2_EXPECTWG(vkfast->presentCpuSignal != NULL);
-  }
-  if (vkfast->presentGpuSignalAcquire == NULL) {
-    np(redCreateGpuSignal,
-      "context", vkfast->context,
-      "gpu", vkfast->gpu,
-      "handleName", "vkFast_vfInternalAsyncDrawPixels_presentGpuSignalAcquire",
-      "outGpuSignal", &vkfast->presentGpuSignalAcquire,
-      "outStatuses", NULL,
-      "optionalFile", optionalFile,
-      "optionalLine", optionalLine,
-      "optionalUserData", NULL
-    );
-    REDGPU_2_EXPECTWG(vkfast->presentGpuSignalAcquire != NULL);
-  }
-  if (vkfast->presentGpuSignalSubmit == NULL) {
-    np(redCreateGpuSignal,
+    unsigned presentImageIndex = 0;
+    RedStatuses presentGetImageIndexStatuses = {0};
+    np(redPresentGetImageIndex,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "handleName", "vkFast_vfInternalAsyncDrawPixels_presentGpuSignalSubmit",
-      "outGpuSignal", &vkfast->presentGpuSignalSubmit,
-      "outStatuses", NULL,
+      "present", window->present,
+      "signalCpuSignal", NULL,
+      "signalGpuSignal", window->presentGpuSignalAcquire,
+      "outImageIndex", &presentImageIndex,
+      "outStatuses", &presentGetImageIndexStatuses,
       "optionalFile", optionalFile,
       "optionalLine", optionalLine,
       "optionalUserData", NULL
     );
-    REDGPU_2_EXPECTWG(vkfast->presentGpuSignalSubmit != NULL);
-  }
-
-  np(redPresentGetImageIndex,
-    "context", vkfast->context,
-    "gpu", vkfast->gpu,
-    "present", vkfast->present,
-    "signalCpuSignal", NULL,
-    "signalGpuSignal", vkfast->presentGpuSignalAcquire,
-    "outImageIndex", &presentImageIndex,
-    "outStatuses", &presentGetImageIndexStatuses,
-    "optionalFile", optionalFile,
-    "optionalLine", optionalLine,
-    "optionalUserData", NULL
-  );
+    REDGPU_2_EXPECTWG(presentGetImageIndexStatuses.status == RED_STATUS_SUCCESS || presentGetImageIndexStatuses.status == RED_STATUS_PRESENT_IS_SUBOPTIMAL);
+    REDGPU_2_EXPECTWG(presentGetImageIndexStatuses.statusError == RED_STATUS_SUCCESS || presentGetImageIndexStatuses.statusError == RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE);
+    if (presentGetImageIndexStatuses.status == RED_STATUS_PRESENT_IS_SUBOPTIMAL || presentGetImageIndexStatuses.statusError == RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE) {
+      draws[i].out_is_rebuilded = vfInternalRebuildPresent((gpu_handle_context_t)(void *)window, window->presentVsyncMode, window->presentImagesCount, optionalFile, optionalLine);
+      continue;
+    }
 
-  if (out_optional_internal_present_image_index != NULL) {
-    out_optional_internal_present_image_index[0] = presentImageIndex;
-  }
+    REDGPU_2_EXPECTWG(draws[i].pixels != NULL || draws[i].pixels_storage_raw != NULL);
 
-  REDGPU_2_EXPECTWG(presentGetImageIndexStatuses.status == RED_STATUS_SUCCESS || presentGetImageIndexStatuses.status == RED_STATUS_PRESENT_IS_SUBOPTIMAL);
-  REDGPU_2_EXPECTWG(presentGetImageIndexStatuses.statusError == RED_STATUS_SUCCESS || presentGetImageIndexStatuses.statusError == RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE);
-  if (presentGetImageIndexStatuses.status == RED_STATUS_PRESENT_IS_SUBOPTIMAL || presentGetImageIndexStatuses.statusError == RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE) {
-    int isRebuilded = vfInternalRebuildPresent(context, vkfast->presentVsyncMode, vkfast->presentImagesCount, optionalFile, optionalLine);
-    return isRebuilded;
+    drawsIndices[windowsCount]          = i;
+    windows[windowsCount]               = window;
+    presents[windowsCount]              = window->present;
+    presentsImagesIndices[windowsCount] = presentImageIndex;
+    windowsCount += 1;
   }
 
-  if (copy_pixels != NULL) {
-    // NOTE(Constantine): The reason we copy pixels here is because vkfast->screenWidth/Height were updated in a potential vfInternalRebuildPresent call above.
-    red32MemoryCopy(vkfast->presentPixelsCpuUpload_void_ptr_original, copy_pixels, sizeof(unsigned char) * 4 * vkfast->screenHeight * vkfast->screenWidth);
+  if (windowsCount == 0) {
+    return;
   }
 
+  // NOTE(Constantine): One CPU wait for all the windows, the previous call's copies are done after it.
   np(redCpuSignalWait,
     "context", vkfast->context,
     "gpu", vkfast->gpu,
@@ -4280,6 +9464,30 @@ static int vfInternalAsyncDrawPixels(gpu_handle_context_t context, const RedStru
     "optionalLine", optionalLine,
     "optionalUserData", NULL
   );
+  vfInternalPresentRetiredRelease(vkfast, optionalFile, optionalLine);
+  for (unsigned i = 0; i < windowsCount; i += 1) {
+    if (windows[i] != vkfast) {
+      vfInternalPresentRetiredRelease(windows[i], optionalFile, optionalLine);
+    }
+  }
+
+  RedStructMemberArray pixelsStoragesRaw[GPU_WINDOWS_MAX_COUNT] = {0};
+  for (unsigned i = 0; i < windowsCount; i += 1) {
+    const gpu_window_draw_t * draw = &draws[drawsIndices[i]];
+    vf_handle_context_t * window = windows[i];
+    if (draw->pixels != NULL) {
+      const uint64_t bytesCount = sizeof(unsigned char) * 4 * window->screenHeight * window->screenWidth;
+      red32MemoryCopy(window->presentPixelsCpuUpload_void_ptr_original, draw->pixels, bytesCount);
+      if (window->specificMemoryTypesCpuUploadIsCoherent == 0) {
+        vfInternalMemoryNonCoherentFlushOrInvalidate(window, 0, window->presentPixelsCpuUpload_memory_and_array.handleAllocatedDedicatedOrMappableMemoryOrPickedMemory, window->presentPixelsCpuUpload_memory_and_array.array.memoryBytesCount, 0, bytesCount, optionalFile, optionalLine);
+      }
+      pixelsStoragesRaw[i].array                = window->presentPixelsCpuUpload_memory_and_array.array.handle;
+      pixelsStoragesRaw[i].arrayRangeBytesFirst = 0;
+      pixelsStoragesRaw[i].arrayRangeBytesCount = window->presentPixelsCpuUpload_memory_allocation_size;
+    } else {
+      pixelsStoragesRaw[i] = draw->pixels_storage_raw[0];
+    }
+  }
 
   RedCalls * calls = &vkfast->presentCopyCalls;
 
@@ -4307,78 +9515,46 @@ static int vfInternalAsyncDrawPixels(gpu_handle_context_t context, const RedStru
       "optionalUserData", NULL
     );
 
-    {
-      RedUsageImage imageUsage = {0};
-      imageUsage.barrierSplit           = RED_BARRIER_SPLIT_NONE;
-      imageUsage.oldAccessStages        = 0;
-      imageUsage.newAccessStages        = RED_ACCESS_STAGE_BITFLAG_COPY;
-      imageUsage.oldAccess              = 0;
-      imageUsage.newAccess              = RED_ACCESS_BITFLAG_COPY_W;
-      imageUsage.oldState               = RED_STATE_UNUSABLE;
-      imageUsage.newState               = RED_STATE_USABLE;
-      imageUsage.queueFamilyIndexSource = -1;
-      imageUsage.queueFamilyIndexTarget = -1;
-      imageUsage.image                  = vkfast->presentImages[presentImageIndex];
-      imageUsage.imageAllParts          = RED_IMAGE_PART_BITFLAG_COLOR;
-      imageUsage.imageLevelsFirst       = 0;
-      imageUsage.imageLevelsCount       = -1;
-      imageUsage.imageLayersFirst       = 0;
-      imageUsage.imageLayersCount       = -1;
-      Red2UsageImageTempCallStruct imageUsageTempStruct = {0};
-      np(red2CallUsageAliasOrderBarrier,
-        "address", addresses.redCallUsageAliasOrderBarrier,
-        "calls", calls->handle,
-        "context", vkfast->context,
-        "arrayUsagesCount", 0,
-        "arrayUsages", NULL,
-        "arrayTempCallStructs", NULL,
-        "imageUsagesCount", 1,
-        "imageUsages", &imageUsage,
-        "imageTempCallStructs", &imageUsageTempStruct,
-        "aliasesCount", 0,
-        "aliases", NULL,
-        "ordersCount", 0,
-        "orders", NULL,
-        "dependencyByRegion", 0
-      );
+    RedUsageImage                imageUsages[GPU_WINDOWS_MAX_COUNT]            = {0};
+    Red2UsageImageTempCallStruct imageUsagesTempStructs[GPU_WINDOWS_MAX_COUNT] = {0};
+    for (unsigned i = 0; i < windowsCount; i += 1) {
+      imageUsages[i].barrierSplit           = RED_BARRIER_SPLIT_NONE;
+      imageUsages[i].oldAccessStages        = 0;
+      imageUsages[i].newAccessStages        = RED_ACCESS_STAGE_BITFLAG_COPY;
+      imageUsages[i].oldAccess              = 0;
+      imageUsages[i].newAccess              = RED_ACCESS_BITFLAG_COPY_W;
+      imageUsages[i].oldState               = RED_STATE_UNUSABLE;
+      imageUsages[i].newState               = RED_STATE_USABLE;
+      imageUsages[i].queueFamilyIndexSource = -1;
+      imageUsages[i].queueFamilyIndexTarget = -1;
+      imageUsages[i].image                  = windows[i]->presentImages[presentsImagesIndices[i]];
+      imageUsages[i].imageAllParts          = RED_IMAGE_PART_BITFLAG_COLOR;
+      imageUsages[i].imageLevelsFirst       = 0;
+      imageUsages[i].imageLevelsCount       = -1;
+      imageUsages[i].imageLayersFirst       = 0;
+      imageUsages[i].imageLayersCount       = -1;
     }
+    np(red2CallUsageAliasOrderBarrier,
+      "address", addresses.redCallUsageAliasOrderBarrier,
+      "calls", calls->handle,
+      "context", vkfast->context,
+      "arrayUsagesCount", 0,
+      "arrayUsages", NULL,
+      "arrayTempCallStructs", NULL,
+      "imageUsagesCount", windowsCount,
+      "imageUsages", imageUsages,
+      "imageTempCallStructs", imageUsagesTempStructs,
+      "aliasesCount", 0,
+      "aliases", NULL,
+      "ordersCount", 0,
+      "orders", NULL,
+      "dependencyByRegion", 0
+    );
 
-    if (optional_copy_image == 1) {
-      // NOTE(Constantine):
-      // 'RedBool32 optional_copy_image' parameter is intentional, because
-      // if the user will pass a NULL image accidentally, this will still
-      // take the image copy path, rather than the pixels buffer copy path.
-      RedCopyImageRange copy = {0};
-      copy.imageRParts.allParts     = RED_IMAGE_PART_BITFLAG_COLOR;
-      copy.imageRParts.level        = 0;
-      copy.imageRParts.layersFirst  = 0;
-      copy.imageRParts.layersCount  = 1;
-      copy.imageROffset.texelX      = 0;
-      copy.imageROffset.texelY      = 0;
-      copy.imageROffset.texelZ      = 0;
-      copy.imageWParts.allParts     = RED_IMAGE_PART_BITFLAG_COLOR;
-      copy.imageWParts.level        = 0;
-      copy.imageWParts.layersFirst  = 0;
-      copy.imageWParts.layersCount  = 1;
-      copy.imageWOffset.texelX      = 0;
-      copy.imageWOffset.texelY      = 0;
-      copy.imageWOffset.texelZ      = 0;
-      copy.extent.texelsCountWidth  = vkfast->screenWidth;
-      copy.extent.texelsCountHeight = vkfast->screenHeight;
-      copy.extent.texelsCountDepth  = 1;
-      npfp(redCallCopyImageToImage, addresses.redCallCopyImageToImage,
-        "calls", calls->handle,
-        "imageR", optional_image_to_copy,
-        "setTo1", 1,
-        "imageW", vkfast->presentImages[presentImageIndex],
-        "setTo01", 1,
-        "rangesCount", 1,
-        "ranges", &copy
-      );
-    } else {
+    for (unsigned i = 0; i < windowsCount; i += 1) {
       RedCopyArrayImageRange copy = {0};
-      copy.arrayBytesFirst               = pixels_storage_raw->arrayRangeBytesFirst;
-      copy.arrayTexelsCountToNextRow     = vkfast->screenWidth;
+      copy.arrayBytesFirst               = pixelsStoragesRaw[i].arrayRangeBytesFirst;
+      copy.arrayTexelsCountToNextRow     = windows[i]->screenWidth;
       copy.arrayTexelsCountToNextLayerOr3DDepthSliceDividedByTexelsCountToNextRow = 0;
       copy.imageParts.allParts           = RED_IMAGE_PART_BITFLAG_COLOR;
       copy.imageParts.level              = 0;
@@ -4387,54 +9563,43 @@ static int vfInternalAsyncDrawPixels(gpu_handle_context_t context, const RedStru
       copy.imageOffset.texelX            = 0;
       copy.imageOffset.texelY            = 0;
       copy.imageOffset.texelZ            = 0;
-      copy.imageExtent.texelsCountWidth  = vkfast->screenWidth;
-      copy.imageExtent.texelsCountHeight = vkfast->screenHeight;
+      copy.imageExtent.texelsCountWidth  = windows[i]->screenWidth;
+      copy.imageExtent.texelsCountHeight = windows[i]->screenHeight;
       copy.imageExtent.texelsCountDepth  = 1;
       npfp(redCallCopyArrayToImage, addresses.redCallCopyArrayToImage,
         "calls", calls->handle,
-        "arrayR", pixels_storage_raw->array,
-        "imageW", vkfast->presentImages[presentImageIndex],
+        "arrayR", pixelsStoragesRaw[i].array,
+        "imageW", windows[i]->presentImages[presentsImagesIndices[i]],
         "setTo1", 1,
         "rangesCount", 1,
         "ranges", &copy
       );
     }
 
-    {
-      RedUsageImage imageUsage = {0};
-      imageUsage.barrierSplit           = RED_BARRIER_SPLIT_NONE;
-      imageUsage.oldAccessStages        = RED_ACCESS_STAGE_BITFLAG_COPY;
-      imageUsage.newAccessStages        = 0;
-      imageUsage.oldAccess              = RED_ACCESS_BITFLAG_COPY_W;
-      imageUsage.newAccess              = 0;
-      imageUsage.oldState               = RED_STATE_USABLE;
-      imageUsage.newState               = RED_STATE_PRESENT;
-      imageUsage.queueFamilyIndexSource = -1;
-      imageUsage.queueFamilyIndexTarget = -1;
-      imageUsage.image                  = vkfast->presentImages[presentImageIndex];
-      imageUsage.imageAllParts          = RED_IMAGE_PART_BITFLAG_COLOR;
-      imageUsage.imageLevelsFirst       = 0;
-      imageUsage.imageLevelsCount       = -1;
-      imageUsage.imageLayersFirst       = 0;
-      imageUsage.imageLayersCount       = -1;
-      Red2UsageImageTempCallStruct imageUsageTempStruct = {0};
-      np(red2CallUsageAliasOrderBarrier,
-        "address", addresses.redCallUsageAliasOrderBarrier,
-        "calls", calls->handle,
-        "context", vkfast->context,
-        "arrayUsagesCount", 0,
-        "arrayUsages", NULL,
-        "arrayTempCallStructs", NULL,
-        "imageUsagesCount", 1,
-        "imageUsages", &imageUsage,
-        "imageTempCallStructs", &imageUsageTempStruct,
-        "aliasesCount", 0,
-        "aliases", NULL,
-        "ordersCount", 0,
-        "orders", NULL,
-        "dependencyByRegion", 0
-      );
+    for (unsigned i = 0; i < windowsCount; i += 1) {
+      imageUsages[i].oldAccessStages = RED_ACCESS_STAGE_BITFLAG_COPY;
+      imageUsages[i].newAccessStages = 0;
+      imageUsages[i].oldAccess       = RED_ACCESS_BITFLAG_COPY_W;
+      imageUsages[i].newAccess       = 0;
+      imageUsages[i].oldState        = RED_STATE_USABLE;
+      imageUsages[i].newState        = RED_STATE_PRESENT;
     }
+    np(red2CallUsageAliasOrderBarrier,
+      "address", addresses.redCallUsageAliasOrderBarrier,
+      "calls", calls->handle,
+      "context", vkfast->context,
+      "arrayUsagesCount", 0,
+      "arrayUsages", NULL,
+      "arrayTempCallStructs", NULL,
+      "imageUsagesCount", windowsCount,
+      "imageUsages", imageUsages,
+      "imageTempCallStructs", imageUsagesTempStructs,
+      "aliasesCount", 0,
+      "aliases", NULL,
+      "ordersCount", 0,
+      "orders", NULL,
+      "dependencyByRegion", 0
+    );
 
     np(redCallsEnd,
       "context", vkfast->context,
@@ -4448,7 +9613,7 @@ static int vfInternalAsyncDrawPixels(gpu_handle_context_t context, const RedStru
     );
   }
 
-  // NOTE(Constantine): Defend vkfast->presentGpuSignalSubmit from being signaled while it's still in use by the previous redQueuePresent() call.
+  // NOTE(Constantine): Defend the windows present submit GPU signals from being signaled while they're still in use by the previous redQueuePresent() call.
   np(redQueuePresent,
     "context", vkfast->context,
     "gpu", vkfast->gpu,
@@ -4465,21 +9630,35 @@ static int vfInternalAsyncDrawPixels(gpu_handle_context_t context, const RedStru
     "optionalUserData", NULL
   );
 
-  REDGPU_2_EXPECTWG(gpu_threads_count_plus_one_empty >= 1);
+  // NOTE(Constantine): The GPU threads, then one acquire or submit GPU signal per window.
+  RedHandleGpuSignal submitSignals[GPU_WINDOWS_MAX_COUNT] = {0};
+  // To free
+  RedHandleGpuSignal * waits  = (RedHandleGpuSignal *)red32MemoryCalloc(sizeof(RedHandleGpuSignal) * (gpuThreadsCount + windowsCount));
+  unsigned *           stages = (unsigned *)red32MemoryCalloc(sizeof(unsigned) * (gpuThreadsCount + windowsCount));
+  REDGPU_2_EXPECTWG(waits != NULL);
+  REDGPU_2_EXPECTWG(stages != NULL);
+  for (unsigned i = 0; i < gpuThreadsCount; i += 1) {
+    waits[i]  = gpu_threads[i];
+    stages[i] = gpu_threads_array_of_65536_int_values[i];
+  }
+  for (unsigned i = 0; i < windowsCount; i += 1) {
+    submitSignals[i]            = windows[i]->presentGpuSignalSubmit;
+    waits[gpuThreadsCount + i]  = windows[i]->presentGpuSignalAcquire;
+    stages[gpuThreadsCount + i] = 65536;
+  }
 
   {
-    gpu_threads[gpu_threads_count_plus_one_empty-1] = vkfast->presentGpuSignalAcquire;
-
     RedGpuTimeline timelines[1] = {0};
     timelines[0].setTo4                            = 4;
     timelines[0].setTo0                            = 0;
-    timelines[0].waitForAndUnsignalGpuSignalsCount = gpu_threads_count_plus_one_empty;
-    timelines[0].waitForAndUnsignalGpuSignals      = gpu_threads;
-    timelines[0].setTo65536                        = gpu_threads_array_of_65536_int_values;
+    timelines[0].waitForAndUnsignalGpuSignalsCount = gpuThreadsCount + windowsCount;
+    timelines[0].waitForAndUnsignalGpuSignals      = waits;
+    timelines[0].setTo65536                        = stages;
     timelines[0].callsCount                        = 1;
     timelines[0].calls                             = &calls->handle;
-    timelines[0].signalGpuSignalsCount             = 1;
-    timelines[0].signalGpuSignals                  = &vkfast->presentGpuSignalSubmit;
+    timelines[0].signalGpuSignalsCount             = windowsCount;
+    timelines[0].signalGpuSignals                  = submitSignals;
+    vfInternalFrameTimestampsCurrent(vkfast)->submitNanoseconds = vfInternalGetTimeNanoseconds();
     np(redQueueSubmit,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
@@ -4494,14 +9673,13 @@ static int vfInternalAsyncDrawPixels(gpu_handle_context_t context, const RedStru
     );
   }
 
-  // NOTE(Constantine):
-  // This code is here to guarantee that all the input threads are left in the output state.
+  // NOTE(Constantine): Same as in vfInternalAsyncDrawPixels(), leaves the input GPU threads and the submit GPU signals signaled.
   {
     RedHandleCpuSignal tempCpuSignal = NULL;
     np(redCreateCpuSignal,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "handleName", "vkFast_vfInternalAsyncDrawPixels_tempCpuSignal",
+      "handleName", "vkFast_vfDrawPixelsWindows_tempCpuSignal",
       "createSignaled", 0,
       "outCpuSignal", &tempCpuSignal,
       "outStatuses", NULL,
@@ -4515,7 +9693,7 @@ static int vfInternalAsyncDrawPixels(gpu_handle_context_t context, const RedStru
     np(redCreateCalls,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
-      "handleName", "vkFast_vfInternalAsyncDrawPixels_tempCalls",
+      "handleName", "vkFast_vfDrawPixelsWindows_tempCalls",
       "queueFamilyIndex", vkfast->gpuInfo->queuesFamilyIndex[vkfast->presentQueueIndex],
       "outCalls", &tempCalls,
       "outStatuses", NULL,
@@ -4566,18 +9744,20 @@ static int vfInternalAsyncDrawPixels(gpu_handle_context_t context, const RedStru
       );
     }
 
-    gpu_threads[gpu_threads_count_plus_one_empty-1] = vkfast->presentGpuSignalSubmit;
+    for (unsigned i = 0; i < windowsCount; i += 1) {
+      waits[gpuThreadsCount + i] = submitSignals[i];
+    }
 
     RedGpuTimeline timelines[1] = {0};
     timelines[0].setTo4                            = 4;
     timelines[0].setTo0                            = 0;
-    timelines[0].waitForAndUnsignalGpuSignalsCount = 1;
-    timelines[0].waitForAndUnsignalGpuSignals      = &vkfast->presentGpuSignalSubmit;
-    timelines[0].setTo65536                        = gpu_threads_array_of_65536_int_values;
+    timelines[0].waitForAndUnsignalGpuSignalsCount = windowsCount;
+    timelines[0].waitForAndUnsignalGpuSignals      = submitSignals;
+    timelines[0].setTo65536                        = &stages[gpuThreadsCount];
     timelines[0].callsCount                        = 1;
     timelines[0].calls                             = &tempCalls.handle;
-    timelines[0].signalGpuSignalsCount             = gpu_threads_count_plus_one_empty;
-    timelines[0].signalGpuSignals                  = gpu_threads;
+    timelines[0].signalGpuSignalsCount             = gpuThreadsCount + windowsCount;
+    timelines[0].signalGpuSignals                  = waits;
     np(redQueueSubmit,
       "context", vkfast->context,
       "gpu", vkfast->gpu,
@@ -4626,66 +9806,36 @@ static int vfInternalAsyncDrawPixels(gpu_handle_context_t context, const RedStru
     );
   }
 
-  RedStatus queuePresentStatus = RED_STATUS_SUCCESS;
+  red32MemoryFree(stages);
+  red32MemoryFree(waits);
+
+  RedStatus queuePresentsStatus[GPU_WINDOWS_MAX_COUNT] = {0};
   RedStatuses queuePresentStatuses = {0};
   np(redQueuePresent,
     "context", vkfast->context,
     "gpu", vkfast->gpu,
     "queue", vkfast->gpuInfo->queues[vkfast->presentQueueIndex],
-    "waitForAndUnsignalGpuSignalsCount", 1,
-    "waitForAndUnsignalGpuSignals", &vkfast->presentGpuSignalSubmit,
-    "presentsCount", 1,
-    "presents", &vkfast->present,
-    "presentsImageIndex", &presentImageIndex,
-    "outPresentsStatus", &queuePresentStatus,
+    "waitForAndUnsignalGpuSignalsCount", windowsCount,
+    "waitForAndUnsignalGpuSignals", submitSignals,
+    "presentsCount", windowsCount,
+    "presents", presents,
+    "presentsImageIndex", presentsImagesIndices,
+    "outPresentsStatus", queuePresentsStatus,
     "outStatuses", &queuePresentStatuses,
     "optionalFile", optionalFile,
     "optionalLine", optionalLine,
     "optionalUserData", NULL
   );
-  REDGPU_2_EXPECTWG(queuePresentStatus == RED_STATUS_SUCCESS || queuePresentStatus == RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE || queuePresentStatus == RED_STATUS_PRESENT_IS_SUBOPTIMAL);
+  vfInternalFramePresented(vkfast);
   REDGPU_2_EXPECTWG(queuePresentStatuses.status == RED_STATUS_SUCCESS || queuePresentStatuses.status == RED_STATUS_PRESENT_IS_SUBOPTIMAL);
   REDGPU_2_EXPECTWG(queuePresentStatuses.statusError == RED_STATUS_SUCCESS || queuePresentStatuses.statusError == RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE);
-  if (queuePresentStatus == RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE || queuePresentStatus == RED_STATUS_PRESENT_IS_SUBOPTIMAL || queuePresentStatuses.status == RED_STATUS_PRESENT_IS_SUBOPTIMAL || queuePresentStatuses.statusError == RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE) {
-    int isRebuilded = vfInternalRebuildPresent(context, vkfast->presentVsyncMode, vkfast->presentImagesCount, optionalFile, optionalLine);
-    return isRebuilded;
+  for (unsigned i = 0; i < windowsCount; i += 1) {
+    const RedStatus status = queuePresentsStatus[i];
+    REDGPU_2_EXPECTWG(status == RED_STATUS_SUCCESS || status == RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE || status == RED_STATUS_PRESENT_IS_SUBOPTIMAL);
+    if (status == RED_STATUS_ERROR_PRESENT_IS_OUT_OF_DATE || status == RED_STATUS_PRESENT_IS_SUBOPTIMAL) {
+      draws[drawsIndices[i]].out_is_rebuilded = vfInternalRebuildPresent((gpu_handle_context_t)(void *)windows[i], windows[i]->presentVsyncMode, windows[i]->presentImagesCount, optionalFile, optionalLine);
+    }
   }
-
-  int isRebuilded = 0;
-  return isRebuilded;
-}
-
-GPU_API_PRE int GPU_API_POST vfDrawPixels(gpu_handle_context_t context, const void * pixels, int * out_optional_internal_present_image_index, unsigned gpu_threads_count_plus_one_empty, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
-  vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
-
-  RedHandleGpu gpu = vkfast->gpu;
-
-  RedStructMemberArray presentPixels_storage_raw = {0};
-  presentPixels_storage_raw.array = vkfast->presentPixelsCpuUpload_memory_and_array.array.handle;
-  presentPixels_storage_raw.arrayRangeBytesFirst = 0;
-  presentPixels_storage_raw.arrayRangeBytesCount = vkfast->presentPixelsCpuUpload_memory_allocation_size;
-
-  int isRebuilded = vfInternalAsyncDrawPixels(context, &presentPixels_storage_raw, pixels, out_optional_internal_present_image_index, 0, NULL, gpu_threads_count_plus_one_empty, gpu_threads, gpu_threads_array_of_65536_int_values, optionalFile, optionalLine);
-  return isRebuilded;
-}
-
-GPU_API_PRE int GPU_API_POST vfAsyncDrawPixels(gpu_handle_context_t context, uint64_t pixels_storage_id, int * out_optional_internal_present_image_index, unsigned gpu_threads_count_plus_one_empty, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
-  vf_handle_t * storage = (vf_handle_t *)(void *)pixels_storage_id;
-  vf_handle_context_t * vkfast = storage->vkfast;
-  RedHandleGpu gpu = vkfast->gpu;
-  REDGPU_2_EXPECTWG(storage->handle_id == VF_HANDLE_ID_STORAGE);
-  int isRebuilded = vfInternalAsyncDrawPixels(context, &storage->storage.arrayRangeInfo, NULL, out_optional_internal_present_image_index, 0, NULL, gpu_threads_count_plus_one_empty, gpu_threads, gpu_threads_array_of_65536_int_values, optionalFile, optionalLine);
-  return isRebuilded;
-}
-
-GPU_API_PRE int GPU_API_POST vfAsyncDrawPixelsRaw(gpu_handle_context_t context, const RedStructMemberArray * pixels_storage_raw, int * out_optional_internal_present_image_index, unsigned gpu_threads_count_plus_one_empty, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
-  int isRebuilded = vfInternalAsyncDrawPixels(context, pixels_storage_raw, NULL, out_optional_internal_present_image_index, 0, NULL, gpu_threads_count_plus_one_empty, gpu_threads, gpu_threads_array_of_65536_int_values, optionalFile, optionalLine);
-  return isRebuilded;
-}
-
-GPU_API_PRE int GPU_API_POST vfAsyncDrawImageRaw(gpu_handle_context_t context, RedHandleImage image_raw, int * out_optional_is_image_copy_finished_cpu_signal_index, unsigned gpu_threads_count_plus_one_empty, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optionalFile, int optionalLine) {
-  int isRebuilded = vfInternalAsyncDrawPixels(context, NULL, NULL, out_optional_is_image_copy_finished_cpu_signal_index, 1, image_raw, gpu_threads_count_plus_one_empty, gpu_threads, gpu_threads_array_of_65536_int_values, optionalFile, optionalLine);
-  return isRebuilded;
 }
 
 GPU_API_PRE RedHandleCpuSignal GPU_API_POST vfAsyncDrawGetCpuSignal(gpu_handle_context_t context) {
@@ -4699,6 +9849,8 @@ GPU_API_PRE RedHandleCpuSignal GPU_API_POST vfAsyncDrawGetCpuSignal(gpu_handle_c
 GPU_API_PRE void GPU_API_POST vfAllQueuesWaitIdle(gpu_handle_context_t context, const char * optionalFile, int optionalLine) {
   vf_handle_context_t * vkfast = (vf_handle_context_t *)(void *)context;
 
+  vfInternalCaptureWrite(vkfast, GPU_CAPTURE_OP_ALL_QUEUES_WAIT_IDLE, optionalLine, 0, NULL, 0, NULL);
+
   // NOTE(Constantine): All queues wait idle
   for (unsigned i = 0; i < vkfast->gpuInfo->queuesCount; i += 1) {
     np(redQueuePresent,
@@ -35,6 +35,8 @@ extern "C" {
 #define VKFAST_DEFAULT_MEMORY_ALLOCATION_SIZE_CPU_READBACK_512MB              (512 * 1024 * 1024)
 #define VKFAST_DEFAULT_MEMORY_ALLOCATION_SIZE_PRESENT_PIXELS_CPU_UPLOAD_288MB (288 * 1024 * 1024)
 
+#define VKFAST_VERSION 1 // NOTE(Constantine): Bumped when a change can invalidate per GPU results cached in files, like the capability validation cache.
+
 typedef struct gpu_type_handle_context_t * gpu_handle_context_t;
 
 typedef struct gpu_internal_memory_allocation_sizes_t {
@@ -110,13 +112,21 @@ typedef struct gpu_program_info_t {
   const char * optional_debug_name;
 } gpu_program_info_t;
 
+typedef struct gpu_program_specialization_constant_t {
+  unsigned constant_id; // NOTE(Constantine): [[vk::constant_id(N)]] in HLSL, layout(constant_id = N) in GLSL.
+  unsigned reserved;
+  uint64_t value;       // NOTE(Constantine): Raw bits of the constant, only the low 32 bits are used for 32-bit constants, bools are true if not 0.
+} gpu_program_specialization_constant_t;
+
 typedef struct gpu_program_pipeline_compute_info_t {
-  uint64_t                           compute_program;
-  unsigned                           variables_slot;
-  unsigned                           variables_bytes_count;
-  unsigned                           struct_members_count;
-  const RedStructDeclarationMember * struct_members;
-  const char *                       optional_debug_name;
+  uint64_t                                      compute_program;
+  unsigned                                      variables_slot;
+  unsigned                                      variables_bytes_count;
+  unsigned                                      struct_members_count;
+  const RedStructDeclarationMember *            struct_members;
+  const char *                                  optional_debug_name;
+  unsigned                                      specialization_constants_count;
+  const gpu_program_specialization_constant_t * specialization_constants;
 } gpu_program_pipeline_compute_info_t;
 
 typedef struct gpu_batch_info_t {
@@ -125,6 +135,7 @@ typedef struct gpu_batch_info_t {
   int max_texture_rw_binds_count;
   int max_texture_ro_binds_count;
   int max_sampler_binds_count;
+  int use_bindings_sets_cache; // NOTE(Constantine): If 1, bindings sets are taken from a per context cache that reuses sets with the same slots and bound ranges, max_new_bindings_sets_count, max_storage_binds_count and max_texture_rw_binds_count are ignored.
 } gpu_batch_info_t;
 
 typedef RedHandleGpuSignal gpu_thread_t;
@@ -153,6 +164,8 @@ GPU_API_PRE void GPU_API_POST vfStorageCreate(gpu_handle_context_t context, cons
 GPU_API_PRE void GPU_API_POST vfStorageGetRaw(gpu_handle_context_t context, uint64_t storage_id, RedStructMemberArray * out_storage_raw, const char * optional_file, int optional_line);
 GPU_API_PRE uint64_t GPU_API_POST vfProgramCreateFromBinaryCompute(gpu_handle_context_t context, const gpu_program_info_t * program_info, const char * optional_file, int optional_line);
 GPU_API_PRE uint64_t GPU_API_POST vfProgramPipelineCreateCompute(gpu_handle_context_t context, const gpu_program_pipeline_compute_info_t * program_pipeline_compute_info, const char * optional_file, int optional_line);
+GPU_API_PRE uint64_t GPU_API_POST vfProgramPipelineCreateComputeCached(gpu_handle_context_t context, const gpu_program_pipeline_compute_info_t * program_pipeline_compute_info, const char * optional_file, int optional_line); // NOTE(Constantine): Returns the same id for the same program, variables, struct members and specialization constants, and counts a reference to it. Release every returned id with vfProgramPipelineReleaseCached() instead of vfIdDestroy().
+GPU_API_PRE void GPU_API_POST vfProgramPipelineReleaseCached(gpu_handle_context_t context, uint64_t program_pipeline_id, const char * optional_file, int optional_line); // NOTE(Constantine): Destroys the program pipeline with its last reference.
 GPU_API_PRE uint64_t GPU_API_POST vfBatchBegin(gpu_handle_context_t context, uint64_t existing_batch_id, const gpu_batch_info_t * batch_info, const char * optional_debug_name, const char * optional_file, int optional_line);
 GPU_API_PRE void GPU_API_POST vfBatchStorageCopyFromCpuToGpu(gpu_handle_context_t context, uint64_t batch_id, uint64_t from_cpu_storage_id, uint64_t to_gpu_storage_id, const char * optional_file, int optional_line);
 GPU_API_PRE void GPU_API_POST vfBatchStorageCopyFromGpuToCpu(gpu_handle_context_t context, uint64_t batch_id, uint64_t from_gpu_storage_id, uint64_t to_cpu_storage_id, const char * optional_file, int optional_line);
@@ -173,7 +186,7 @@ GPU_API_PRE void GPU_API_POST vfGpuThreadCreate(gpu_handle_context_t context, un
 GPU_API_PRE void GPU_API_POST vfGpuThreadDestroy(gpu_handle_context_t context, gpu_thread_t gpu_thread);
 GPU_API_PRE RedHandleCalls GPU_API_POST vfBatchGetRawHandle(gpu_handle_context_t context, uint64_t batch_id, const char * optional_file, int optional_line);
 GPU_API_PRE uint64_t GPU_API_POST vfAsyncBatchExecuteRaw(gpu_handle_context_t context, uint64_t batch_raw_count, const RedHandleCalls * batch_raw, unsigned gpu_threads_count, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optional_file, int optional_line);
-GPU_API_PRE void GPU_API_POST vfAsyncWaitToFinish(gpu_handle_context_t context, uint64_t async_id, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfAsyncWaitToFinish(gpu_handle_context_t context, uint64_t async_id, const char * optional_file, int optional_line); // NOTE(Constantine): Wait for every async_id once. It's invalid after the wait, its CPU signal is reused, so a later async execute can return the same async_id.
 GPU_API_PRE int  GPU_API_POST vfDrawPixels(gpu_handle_context_t context, const void * pixels, int * out_optional_internal_present_image_index, unsigned gpu_threads_count_plus_one_empty, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optional_file, int optional_line);
 GPU_API_PRE int  GPU_API_POST vfAsyncDrawPixels(gpu_handle_context_t context, uint64_t pixels_storage_id, int * out_optional_internal_present_image_index, unsigned gpu_threads_count_plus_one_empty, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optional_file, int optional_line);
 GPU_API_PRE int  GPU_API_POST vfAsyncDrawPixelsRaw(gpu_handle_context_t context, const RedStructMemberArray * pixels_storage_raw, int * out_optional_internal_present_image_index, unsigned gpu_threads_count_plus_one_empty, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optional_file, int optional_line);
@@ -20,9 +20,285 @@ typedef struct gpu_context_ex3_parameters_t {
   unsigned * optionalSpecificMemoryTypeCpuReadback;
 } gpu_context_ex3_parameters_t;
 
+typedef struct gpu_context_ex4_parameters_t {
+  RedBool32    probeMemoryTypesBandwidth;  // NOTE(Constantine): Measures CPU write and read speed per candidate memory type at init, at 64 KB, 1 MB and 16 MB, and picks the fastest ones on average, coherent ones only for upload storages. Ignored for types set in gpu_context_ex3_parameters_t.
+  const char * optionalProbeCacheFilepath; // NOTE(Constantine): If set, probe results are loaded from and stored to this file, keyed by GPU and driver version. Cached picks that no longer match the device's memory types are probed again.
+  uint64_t     growableHeapsBlockBytesCount;    // NOTE(Constantine): If not 0, storages heaps start at this size (unless internal_memory_allocation_sizes is set) and grow by blocks of at least this size on demand. Storages never span blocks.
+  uint64_t     growableHeapsMaxTotalBytesCount; // NOTE(Constantine): If not 0, the maximum total size of each storages heap, initial block included.
+  const char * optionalTuningCacheFilepath;     // NOTE(Constantine): If set, vfProgramPipelineTuneCompute() results for this GPU and driver version are loaded from this file at init and stored to it after tuning, one line per key.
+  const char * optionalValidationCacheFilepath; // NOTE(Constantine): If set, GPUs that passed the minimum capability expectations at init are appended to this file, keyed by GPU, driver, vkFast and REDGPU SDK version, and aren't checked again on later inits.
+} gpu_context_ex4_parameters_t;
+
+typedef struct gpu_context_memory_types_t {
+  unsigned  memoryTypeGpuVram;
+  unsigned  memoryTypeCpuUpload;
+  unsigned  memoryTypeCpuReadback;
+  RedBool32 memoryTypeCpuUploadIsCoherent; // NOTE(Constantine): 0 only if a non-coherent type was set in gpu_context_ex3_parameters_t, upload storages must then be flushed with vfStorageCpuUploadFlush().
+  RedBool32 memoryTypeCpuUploadIsCached;
+  RedBool32 memoryTypeCpuReadbackIsCoherent;
+  RedBool32 memoryTypeCpuReadbackIsCached;
+} gpu_context_memory_types_t;
+
+typedef struct gpu_context_init_timeline_t {
+  uint64_t  context_nanoseconds;    // NOTE(Constantine): REDGPU context creation, instance and devices are created by the same call. Near 0 if the context was passed in.
+  uint64_t  validation_nanoseconds; // NOTE(Constantine): Minimum capability expectations sweep, or the validation cache lookup if it was skipped.
+  uint64_t  heaps_nanoseconds;      // NOTE(Constantine): Memory types picking, optional bandwidth probe, storages heaps allocation and mapping.
+  uint64_t  other_nanoseconds;      // NOTE(Constantine): Everything else, like the present calls and the tuning cache load.
+  uint64_t  total_nanoseconds;
+  RedBool32 validation_was_cached;
+} gpu_context_init_timeline_t;
+
+typedef struct gpu_bindings_sets_cache_stats_t {
+  uint64_t sets_count;
+  uint64_t pools_count;
+  uint64_t pools_max_sets_count; // NOTE(Constantine): Sum of the capacities of the pools, every new pool doubles the capacity up to 65536 sets.
+  uint64_t hits_count;           // NOTE(Constantine): vfBatchBindNewBindingsEnd() calls that reused a cached set.
+  uint64_t misses_count;         // NOTE(Constantine): vfBatchBindNewBindingsEnd() calls that built a new set.
+  uint64_t pool_resets_count;    // NOTE(Constantine): Least recently used pools reset to make room once the soft max count of pools is reached.
+} gpu_bindings_sets_cache_stats_t;
+
+// NOTE(Constantine):
+// A storage exported from one context can be imported into other contexts that share its raw context and GPU, like
+// the custom contexts of example 03, and bound or copied there without duplicating its memory. Only one context owns
+// a shared storage at a time, the exporting one first. The owner releases it at the end of a batch that last uses it,
+// the next one acquires it at the start of a batch that first uses it, and both batches must be executed on the same
+// gpu_thread_t, so the acquiring submission waits for the releasing one. The same GPU thread can be used by any of
+// the contexts that share the raw context. Release and acquire record memory barriers only, no queue family ownership
+// transfer: storages are shared by all queue families of a GPU with more than one queue, and a GPU with one queue has
+// one family. Imported storages aren't checkpointed and captured, destroy them before the exporting context is deinited
+// or reset.
+typedef struct gpu_storage_export_t {
+  uint64_t           storage_id;  // NOTE(Constantine): Of the exporting context.
+  RedContext         raw_context;
+  unsigned           gpu_index;
+  gpu_storage_info_t info;
+} gpu_storage_export_t;
+
+// NOTE(Constantine):
+// Extra windows are added to a context that already has a window with vfWindowAdd(), window 0 is the context's own one.
+// vfDrawPixelsWindows() acquires a present image of every drawn window, records all the copies into one submission on the
+// present queue of the context and presents all the windows with one redQueuePresent() call, so drawing N windows waits
+// on the CPU once instead of N times. Each window has its own present pixels memory, resizes are handled per window.
+#define GPU_WINDOWS_MAX_COUNT 16
+
+typedef struct gpu_window_draw_t {
+  unsigned                     window_index;
+  const void *                 pixels;             // NOTE(Constantine): Copied to the window's present pixels memory, window width * height RGBA8 pixels. If NULL, pixels_storage_raw is used.
+  const RedStructMemberArray * pixels_storage_raw;
+  int                          out_is_rebuilded;   // NOTE(Constantine): 1 if the window's present was rebuilt and the window wasn't drawn, like vfDrawPixels() returns.
+} gpu_window_draw_t;
+
+// NOTE(Constantine):
+// Present pacing: call vfWindowPacingWait() at the start of a frame, right before sampling input. It sleeps until the
+// frame has just enough time left to be presented at the next multiple of frame_nanoseconds, by the estimated time from
+// a wake to the return of the present, so input is sampled as late as possible. Sleeping uses a high resolution waitable
+// timer on Windows and clock_nanosleep() on Linux, only the last tens of microseconds are spent yielding.
+// Latencies are measured on the CPU, from the calls' start to the return of redQueuePresent(), for the last
+// GPU_FRAME_LATENCIES_MAX_COUNT frames drawn with vfDrawPixels(), vfAsyncDrawPixels*(), vfAsyncDrawImageRaw() or vfDrawPixelsWindows().
+#define GPU_FRAME_LATENCIES_MAX_COUNT 63
+
+typedef struct gpu_present_pacing_t {
+  uint64_t frame_nanoseconds;         // NOTE(Constantine): 0 disables pacing, for example 16666667 for 60 FPS.
+  uint64_t safety_margin_nanoseconds; // NOTE(Constantine): Added to the estimated frame time, 0 is 1 millisecond.
+} gpu_present_pacing_t;
+
+typedef struct gpu_frame_latency_t {
+  uint64_t frame_index;
+  uint64_t acquire_to_present_nanoseconds;    // NOTE(Constantine): From the present image acquire.
+  uint64_t cpu_submit_to_present_nanoseconds; // NOTE(Constantine): From the present copy submit.
+  uint64_t input_to_present_nanoseconds;      // NOTE(Constantine): From the return of vfWindowPacingWait(), 0 if the frame wasn't paced.
+  uint64_t pacing_sleep_nanoseconds;
+  int64_t  pacing_wake_error_nanoseconds;     // NOTE(Constantine): Actual minus computed wake time.
+} gpu_frame_latency_t;
+
+// NOTE(Constantine):
+// vfDrawPixelsEx() draws source width * source height pixels of any gpu_pixels_format_t. The pixels are copied to the
+// present convert memory as they are and a built-in compute pass recorded into the present submission converts them to
+// BGRA8, with an optional exposure, tonemap and gamma, right before the copy to the present image. CPU renderers can keep
+// their float framebuffers and skip the per-pixel pack loop. If the source size isn't the window size, a second built-in
+// compute pass upscales (or downscales) the converted pixels to the window, so CPU renderers can trace fewer rays than
+// there are window pixels and the source size doesn't have to follow window resizes.
+typedef enum gpu_pixels_format_t {
+  GPU_PIXELS_FORMAT_BGRA8   = 0, // NOTE(Constantine): vfDrawPixels() pixels, 4 bytes.
+  GPU_PIXELS_FORMAT_RGBA32F = 1, // NOTE(Constantine): 16 bytes.
+  GPU_PIXELS_FORMAT_RGBA16F = 2, // NOTE(Constantine): 8 bytes.
+  GPU_PIXELS_FORMAT_RGB565  = 3, // NOTE(Constantine): 2 bytes, red in the high bits, alpha is 1.
+} gpu_pixels_format_t;
+
+typedef enum gpu_pixels_transfer_t {
+  GPU_PIXELS_TRANSFER_NONE           = 0, // NOTE(Constantine): Exposure only, then clamped to [0, 1].
+  GPU_PIXELS_TRANSFER_GAMMA          = 1,
+  GPU_PIXELS_TRANSFER_REINHARD_GAMMA = 2, // NOTE(Constantine): c / (1 + c), then gamma.
+  GPU_PIXELS_TRANSFER_ACES_GAMMA     = 3, // NOTE(Constantine): Narkowicz's fit of the ACES filmic curve, then gamma.
+} gpu_pixels_transfer_t;
+
+typedef enum gpu_pixels_upscale_t {
+  GPU_PIXELS_UPSCALE_BILINEAR      = 0,
+  GPU_PIXELS_UPSCALE_EDGE_ADAPTIVE = 1, // NOTE(Constantine): Interpolates across luma edges steeper than along them, then sharpens without overshooting the 2x2 source texels.
+} gpu_pixels_upscale_t;
+
+typedef struct gpu_draw_pixels_info_t {
+  gpu_pixels_format_t   format;
+  gpu_pixels_transfer_t transfer;
+  float                 exposure;      // NOTE(Constantine): Multiplies RGB before the tonemap, 0 is 1.
+  float                 gamma;         // NOTE(Constantine): 0 is 2.2, 2 is the sqrt() of the examples.
+  unsigned              source_width;  // NOTE(Constantine): 0 is the window width.
+  unsigned              source_height; // NOTE(Constantine): 0 is the window height.
+  gpu_pixels_upscale_t  upscale;
+  float                 sharpness;     // NOTE(Constantine): GPU_PIXELS_UPSCALE_EDGE_ADAPTIVE only, 0 is none, 1 is max.
+} gpu_draw_pixels_info_t;
+
+typedef void (*gpu_tune_bind_callback_t)(gpu_handle_context_t context, uint64_t batch_id, void * user_data);
+
+#define GPU_TUNE_LOCAL_SIZE_NOT_SPECIALIZED 0xFFFFFFFF // NOTE(Constantine): For gpu_program_pipeline_tune_compute_info_t::local_size_constant_ids.
+
+typedef struct gpu_program_pipeline_tune_compute_info_t {
+  const char *                                tuning_key;                    // NOTE(Constantine): Names the kernel and its representative dispatch in the tuning cache, up to 127 characters without whitespace.
+  const gpu_program_pipeline_compute_info_t * program_pipeline_compute_info; // NOTE(Constantine): Its specialization constants are kept, the local size ones of a candidate are appended.
+  unsigned                                    local_size_constant_ids[3];    // NOTE(Constantine): constant_id of the local size x, y and z, GPU_TUNE_LOCAL_SIZE_NOT_SPECIALIZED for dimensions that are not specialized.
+  unsigned                                    candidates_count;
+  const unsigned *                            candidates_local_sizes;        // NOTE(Constantine): 3 values per candidate, the fixed local size of the program for dimensions that are not specialized. Candidates that differ from the first one in those or exceed maxComputeWorkGroupSize, maxComputeWorkGroupInvocations or maxComputeWorkGroupCount are skipped.
+  unsigned                                    invocations_count[3];          // NOTE(Constantine): Of the representative dispatch, workgroups counts are rounded up per candidate.
+  const gpu_batch_info_t *                    batch_info;
+  gpu_tune_bind_callback_t                    bind_callback;                 // NOTE(Constantine): Binds the bindings set, storages and variables of the representative dispatch, called after the candidate program pipeline is bound.
+  void *                                      bind_callback_user_data;
+  unsigned                                    dispatches_per_sample;         // NOTE(Constantine): 0 is 16.
+  unsigned                                    samples_count;                 // NOTE(Constantine): 0 is 9, the median sample is compared.
+} gpu_program_pipeline_tune_compute_info_t;
+
+typedef struct gpu_program_pipeline_tune_compute_result_t {
+  uint64_t  program_pipeline_compute; // NOTE(Constantine): Specialized with the picked local size, destroy with vfIdDestroy().
+  unsigned  local_size[3];
+  unsigned  workgroups_count[3];      // NOTE(Constantine): For the representative dispatch.
+  RedBool32 is_from_cache;
+  uint64_t  median_nanoseconds;       // NOTE(Constantine): 0 if the local size is from the cache.
+  RedBool32 is_gpu_timed;             // NOTE(Constantine): 1 if the samples were GPU timestamps, 0 if they were CPU times of a submit and its wait.
+} gpu_program_pipeline_tune_compute_result_t;
+
+// NOTE(Constantine):
+// Capture file layout: gpu_capture_file_header_t, then records until the end of the file. Each record is a
+// gpu_capture_record_header_t, followed by words_count uint64_t words, followed by blob_bytes_count bytes.
+// Handles are written as the values the captured process got, replay maps them to its own.
+// Storage types, batch infos and struct members are written as words in their declaration order.
+
+#define GPU_CAPTURE_FILE_MAGIC   0x50434656 // NOTE(Constantine): "VFCP".
+#define GPU_CAPTURE_FILE_VERSION 1
+
+typedef enum gpu_capture_op_t {
+  GPU_CAPTURE_OP_STORAGE_CREATE                  = 1,  // NOTE(Constantine): Words: id, storage_type, bytes_count.
+  GPU_CAPTURE_OP_STORAGE_CONTENTS                = 2,  // NOTE(Constantine): Words: id. Blob: contents of a CPU_UPLOAD storage at submit time.
+  GPU_CAPTURE_OP_PROGRAM_CREATE_COMPUTE          = 3,  // NOTE(Constantine): Words: id. Blob: program binary.
+  GPU_CAPTURE_OP_PROGRAM_PIPELINE_CREATE_COMPUTE = 4,  // NOTE(Constantine): Words: id, compute_program, variables_slot, variables_bytes_count, struct_members_count, 4 words per struct member (slot, type, count, visibleToStages), specialization_constants_count, 2 words per specialization constant (constant_id, value).
+  GPU_CAPTURE_OP_BATCH_BEGIN                     = 5,  // NOTE(Constantine): Words: id, existing_batch_id, queue_family_index, raw calls handle, has batch_info, 5 words of batch_info, use_bindings_sets_cache.
+  GPU_CAPTURE_OP_BATCH_COPY_FROM_CPU_TO_GPU      = 6,  // NOTE(Constantine): Words: batch_id, from_cpu_storage_id, to_gpu_storage_id.
+  GPU_CAPTURE_OP_BATCH_COPY_FROM_GPU_TO_CPU      = 7,  // NOTE(Constantine): Words: batch_id, from_gpu_storage_id, to_cpu_storage_id.
+  GPU_CAPTURE_OP_BATCH_BIND_PROGRAM_PIPELINE     = 8,  // NOTE(Constantine): Words: batch_id, program_pipeline_compute_id.
+  GPU_CAPTURE_OP_BATCH_BIND_NEW_BINDINGS_SET     = 9,  // NOTE(Constantine): Words: batch_id, slots_count, 4 words per slot (slot, type, count, visibleToStages).
+  GPU_CAPTURE_OP_BATCH_BIND_STORAGE              = 10, // NOTE(Constantine): Words: batch_id, slot, storage_id, bytes_first, bytes_count, 0 for Single, 1 for SingleLimited or 2 for SingleCapped.
+  GPU_CAPTURE_OP_BATCH_BIND_NEW_BINDINGS_END     = 11, // NOTE(Constantine): Words: batch_id.
+  GPU_CAPTURE_OP_BATCH_BIND_VARIABLES_COPY       = 12, // NOTE(Constantine): Words: batch_id, variables_bytes_offset. Blob: data.
+  GPU_CAPTURE_OP_BATCH_COMPUTE                   = 13, // NOTE(Constantine): Words: batch_id, workgroups_count_x, workgroups_count_y, workgroups_count_z.
+  GPU_CAPTURE_OP_BATCH_BARRIER_MEMORY            = 14, // NOTE(Constantine): Words: batch_id.
+  GPU_CAPTURE_OP_BATCH_BARRIER_CPU_READBACK      = 15, // NOTE(Constantine): Words: batch_id.
+  GPU_CAPTURE_OP_BATCH_END                       = 16, // NOTE(Constantine): Words: batch_id.
+  GPU_CAPTURE_OP_GPU_THREAD_CREATE               = 17, // NOTE(Constantine): Words: gpu_threads_count, gpu threads.
+  GPU_CAPTURE_OP_GPU_THREAD_DESTROY              = 18, // NOTE(Constantine): Words: gpu_thread.
+  GPU_CAPTURE_OP_ASYNC_BATCH_EXECUTE             = 19, // NOTE(Constantine): Words: async_id, queue index, batch_raw_count, gpu_threads_count, raw calls handles, gpu threads.
+  GPU_CAPTURE_OP_ASYNC_WAIT_TO_FINISH            = 20, // NOTE(Constantine): Words: async_id.
+  GPU_CAPTURE_OP_ID_DESTROY                      = 21, // NOTE(Constantine): Words: id.
+  GPU_CAPTURE_OP_ALL_QUEUES_WAIT_IDLE            = 22, // NOTE(Constantine): No words.
+  GPU_CAPTURE_OP_COUNT                           = 23,
+} gpu_capture_op_t;
+
+typedef struct gpu_capture_file_header_t {
+  uint32_t magic;
+  uint32_t version;
+} gpu_capture_file_header_t;
+
+typedef struct gpu_capture_record_header_t {
+  uint32_t op;
+  int32_t  optional_line; // NOTE(Constantine): Call site line, for attributing replay timings.
+  uint32_t words_count;
+  uint32_t reserved;
+  uint64_t blob_bytes_count;
+} gpu_capture_record_header_t;
+
+// NOTE(Constantine):
+// Checkpoint file layout: gpu_checkpoint_file_header_t, then storages_count gpu_checkpoint_file_storage_t in storages
+// creation order, then the chunks of every storage in the same order. A storage of bytes_count bytes has
+// ceil(bytes_count / chunk_bytes_count) chunks, each is a gpu_checkpoint_file_chunk_t followed by stored_bytes_count
+// bytes. Raw chunks are padded to start at a multiple of GPU_CHECKPOINT_FILE_RAW_CHUNK_ALIGNMENT file bytes, so an
+// uncompressed checkpoint can be memory-mapped and its chunks used in place.
+
+#define GPU_CHECKPOINT_FILE_MAGIC                  0x4B434656 // NOTE(Constantine): "VFCK".
+#define GPU_CHECKPOINT_FILE_VERSION                1
+#define GPU_CHECKPOINT_FILE_RAW_CHUNK_ALIGNMENT    4096
+#define GPU_CHECKPOINT_DEFAULT_CHUNK_BYTES_COUNT   (16 * 1024 * 1024)
+
+typedef enum gpu_checkpoint_codec_t {
+  GPU_CHECKPOINT_CODEC_RAW = 0,
+  GPU_CHECKPOINT_CODEC_LZ4 = 1, // NOTE(Constantine): LZ4 block format, without the LZ4 frame.
+} gpu_checkpoint_codec_t;
+
+typedef struct gpu_checkpoint_file_header_t {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t storages_count;
+  uint64_t chunk_bytes_count;
+} gpu_checkpoint_file_header_t;
+
+typedef struct gpu_checkpoint_file_storage_t {
+  uint32_t storage_type;
+  uint32_t reserved;
+  uint64_t bytes_count;
+} gpu_checkpoint_file_storage_t;
+
+typedef struct gpu_checkpoint_file_chunk_t {
+  uint32_t codec;
+  uint32_t reserved;
+  uint64_t bytes_count;        // NOTE(Constantine): Uncompressed.
+  uint64_t stored_bytes_count; // NOTE(Constantine): In the file, after the padding for raw chunks.
+  uint64_t contents_hash;      // NOTE(Constantine): FNV-1a over 8-byte words of the uncompressed bytes.
+} gpu_checkpoint_file_chunk_t;
+
 GPU_API_PRE gpu_handle_context_t GPU_API_POST vfContextInitEx2(int enable_debug_mode, unsigned gpu_index, const gpu_context_optional_parameters_t * optional_parameters, const gpu_context_ex2_parameters_t * optional_ex2_parameters, const char * optional_file, int optional_line);
 GPU_API_PRE gpu_handle_context_t GPU_API_POST vfContextInitEx3(int enable_debug_mode, unsigned gpu_index, const gpu_context_optional_parameters_t * optional_parameters, const gpu_context_ex2_parameters_t * optional_ex2_parameters, const gpu_context_ex3_parameters_t * optional_ex3_parameters, const char * optional_file, int optional_line);
+GPU_API_PRE gpu_handle_context_t GPU_API_POST vfContextInitEx4(int enable_debug_mode, unsigned gpu_index, const gpu_context_optional_parameters_t * optional_parameters, const gpu_context_ex2_parameters_t * optional_ex2_parameters, const gpu_context_ex3_parameters_t * optional_ex3_parameters, const gpu_context_ex4_parameters_t * optional_ex4_parameters, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfContextGetMemoryTypes(gpu_handle_context_t context, gpu_context_memory_types_t * out_memory_types, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfContextGetInitTimeline(gpu_handle_context_t context, gpu_context_init_timeline_t * out_init_timeline, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfContextHeapsAppendBlocks(gpu_handle_context_t context, const gpu_internal_memory_allocation_sizes_t * memory_allocation_sizes, const char * optional_file, int optional_line); // NOTE(Constantine): Makes a new block of at least the given size current for each storages heap with a non-zero size, earlier storages stay valid. Without growable heaps, don't call it concurrently with vfStorageCreate().
+// NOTE(Constantine): Begin capturing right after context init: storages, programs and batches created before vfContextCaptureBegin() are unknown to replay.
+// Calls that take raw REDGPU handles (vfBatchStorageCopyRaw, vfBatchBindStorageRaw, vfBatchBindTextureRWEx) and window and present calls are not captured.
+GPU_API_PRE void GPU_API_POST vfContextCaptureBegin(gpu_handle_context_t context, const char * capture_filepath, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfContextCaptureEnd(gpu_handle_context_t context, const char * optional_file, int optional_line);
+// NOTE(Constantine):
+// vfContextCheckpoint() waits for all queues to be idle and writes the contents of every live storage to checkpoint_filepath.
+// GPU_ONLY storages are read back chunk by chunk through two staging blocks, so the file write of a chunk overlaps the copy of the next one.
+// vfContextRestore() creates the storages of a checkpoint again in the same order and with the same types and sizes, and uploads their contents.
+// Pass NULL out_storages to get the storages count of a checkpoint. Restored storages get new ids, the order of out_storages is the creation order
+// of the checkpointed storages, so a program that creates its storages in a fixed order can map them back. Storages imported with
+// vfStorageCreateFromHostPointer() are checkpointed by contents and restored as separate storages.
+GPU_API_PRE void GPU_API_POST vfContextCheckpoint(gpu_handle_context_t context, const char * checkpoint_filepath, uint64_t chunk_bytes_count, RedBool32 compress, const char * optional_file, int optional_line); // NOTE(Constantine): chunk_bytes_count 0 is GPU_CHECKPOINT_DEFAULT_CHUNK_BYTES_COUNT. Compressed chunks that don't shrink are stored raw.
+GPU_API_PRE uint64_t GPU_API_POST vfContextRestore(gpu_handle_context_t context, const char * checkpoint_filepath, uint64_t out_storages_capacity, gpu_storage_t * out_storages, const char * optional_file, int optional_line); // NOTE(Constantine): Returns the storages count of the checkpoint.
+GPU_API_PRE void GPU_API_POST vfProgramPipelineTuneCompute(gpu_handle_context_t context, const gpu_program_pipeline_tune_compute_info_t * tune_info, gpu_program_pipeline_tune_compute_result_t * out_result, const char * optional_file, int optional_line); // NOTE(Constantine): Benchmarks the candidates unless tuning_key is already tuned for this GPU.
+GPU_API_PRE RedBool32 GPU_API_POST vfProgramPipelineGetTunedLocalSize(gpu_handle_context_t context, const char * tuning_key, unsigned * out_local_size, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfContextGetBindingsSetsCacheStats(gpu_handle_context_t context, gpu_bindings_sets_cache_stats_t * out_stats, const char * optional_file, int optional_line); // NOTE(Constantine): Counters of the bindings sets cache of gpu_batch_info_t::use_bindings_sets_cache.
+GPU_API_PRE void GPU_API_POST vfStorageCpuUploadFlush(gpu_handle_context_t context, uint64_t storage_id, const char * optional_file, int optional_line); // NOTE(Constantine): Call after writing a storage and before the submit that reads it. Does nothing on coherent memory, async executes don't flush upload storages.
+GPU_API_PRE RedBool32 GPU_API_POST vfStorageCreateFromHostPointer(gpu_handle_context_t context, const gpu_storage_info_t * storage_info, void * host_pointer, gpu_storage_t * out_storage, const char * optional_file, int optional_line); // NOTE(Constantine): Returns 1 if host_pointer was imported without a copy with VK_EXT_external_memory_host. Returns 0 if it fell back to a copy into a vkFast storage, use out_storage->mapped_void_ptr then. While capturing, don't free host_pointer while another thread submits.
+GPU_API_PRE void GPU_API_POST vfStorageCpuReadbackInvalidate(gpu_handle_context_t context, uint64_t storage_id, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfStorageExport(gpu_handle_context_t context, uint64_t storage_id, gpu_storage_export_t * out_storage_export, const char * optional_file, int optional_line);
+GPU_API_PRE void GPU_API_POST vfStorageImport(gpu_handle_context_t context, const gpu_storage_export_t * storage_export, gpu_storage_t * out_storage, const char * optional_file, int optional_line); // NOTE(Constantine): out_storage has the same memory and mapped pointer as the exported storage, destroy it with vfIdDestroy().
+GPU_API_PRE void GPU_API_POST vfBatchStorageOwnershipRelease(gpu_handle_context_t context, uint64_t batch_id, uint64_t storage_id, const char * optional_file, int optional_line); // NOTE(Constantine): Records a memory barrier into batch_id. batch_id 0 releases a storage that no pending batch of context uses.
+GPU_API_PRE void GPU_API_POST vfBatchStorageOwnershipAcquire(gpu_handle_context_t context, uint64_t batch_id, uint64_t storage_id, const char * optional_file, int optional_line); // NOTE(Constantine): Records a memory barrier into batch_id. batch_id 0 acquires a storage whose releasing batch has finished.
 GPU_API_PRE int GPU_API_POST vfWindowFullscreenEx(gpu_handle_context_t context, void * optional_external_window_handle, const char * window_title, int screen_width, int screen_height, unsigned draw_queue_index, RedPresentVsyncMode present_vsync_mode, int present_images_count, const char * optional_file, int optional_line);
+GPU_API_PRE int GPU_API_POST vfWindowRebuildPresent(gpu_handle_context_t context, int optional_fake_surface_width, int optional_fake_surface_height, const char * optional_file, int optional_line); // NOTE(Constantine): Rebuilds the present like a window resize does, without waiting for the GPU. Without a window, only the present pixels memory is reserved for the fake surface size, to benchmark resize storms headless. Returns 0 if the window is minimized.
+GPU_API_PRE void GPU_API_POST vfWindowSetPacing(gpu_handle_context_t context, const gpu_present_pacing_t * pacing, const char * optional_file, int optional_line); // NOTE(Constantine): NULL pacing disables pacing.
+GPU_API_PRE void GPU_API_POST vfWindowPacingWait(gpu_handle_context_t context, const char * optional_file, int optional_line);
+GPU_API_PRE uint64_t GPU_API_POST vfWindowGetFrameLatencies(gpu_handle_context_t context, uint64_t out_frame_latencies_capacity, gpu_frame_latency_t * out_frame_latencies); // NOTE(Constantine): Oldest first, returns the count written.
+GPU_API_PRE unsigned GPU_API_POST vfWindowAdd(gpu_handle_context_t context, void * optional_external_window_handle, const char * window_title, int screen_width, int screen_height, RedPresentVsyncMode present_vsync_mode, int present_images_count, uint64_t present_pixels_bytes_count, const char * optional_file, int optional_line); // NOTE(Constantine): Returns the new window index. present_pixels_bytes_count 0 is the present pixels size of window 0. Extra windows are deinited with the context.
+GPU_API_PRE gpu_handle_context_t GPU_API_POST vfWindowGetContext(gpu_handle_context_t context, unsigned window_index); // NOTE(Constantine): For vfWindowLoop(), vfWindowIsMinimized() and vfWindowGetSize() of an extra window, don't create storages or batches with it.
+GPU_API_PRE void GPU_API_POST vfDrawPixelsWindows(gpu_handle_context_t context, unsigned draws_count, gpu_window_draw_t * draws, unsigned gpu_threads_count_plus_one_empty, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optional_file, int optional_line); // NOTE(Constantine): Same GPU threads contract as vfDrawPixels(), draw each window at most once per call.
+GPU_API_PRE int GPU_API_POST vfDrawPixelsEx(gpu_handle_context_t context, const void * pixels, const gpu_draw_pixels_info_t * draw_pixels_info, int * out_optional_internal_present_image_index, unsigned gpu_threads_count_plus_one_empty, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optional_file, int optional_line); // NOTE(Constantine): Same GPU threads contract and return value as vfDrawPixels(). NULL draw_pixels_info is window-sized BGRA8 without a transfer.
 GPU_API_PRE uint64_t GPU_API_POST vfBatchBeginEx(gpu_handle_context_t context, uint64_t existing_batch_id, const gpu_batch_info_t * batch_info, unsigned queue_family_index, const char * optional_debug_name, const char * optional_file, int optional_line);
 GPU_API_PRE uint64_t GPU_API_POST vfAsyncBatchExecuteRawEx(gpu_handle_context_t context, RedHandleQueue queue, uint64_t batch_raw_count, const RedHandleCalls * batch_raw, unsigned gpu_threads_count, gpu_thread_t * gpu_threads, const unsigned * gpu_threads_array_of_65536_int_values, const char * optional_file, int optional_line);
 GPU_API_PRE void GPU_API_POST vfBatchBindTextureRWEx(gpu_handle_context_t context, uint64_t batch_id, int slot, int textures_rw_count, const RedStructMemberTexture * textures_rw, const char * optional_file, int optional_line);
@@ -30,6 +30,77 @@
 extern "C" {
 #endif
 
+typedef struct vf_heap_block_t {
+  RedArray           array;
+  RedHandleMemory    memory;
+  void *             mapped_void_ptr_original;
+  uint64_t           memory_suballocations_offset;
+} vf_heap_block_t;
+
+typedef struct vf_heap_blocks_t {
+  uint64_t           totalBytesCount;
+  uint64_t           retiredBlocksCount;
+  vf_heap_block_t *  retiredBlocks; // NOTE(Constantine): Blocks that storages were suballocated from before the heap grew. The current block is in the memory* fields of vf_handle_context_t. Read and written only under heapsGrowMutex.
+} vf_heap_blocks_t;
+
+typedef struct vf_capture_storage_t {
+  uint64_t           id;
+  const void *       mapped_void_ptr;
+  uint64_t           bytes_count;
+  uint64_t           contents_hash;
+} vf_capture_storage_t;
+
+typedef struct vf_hash_index_t {
+  uint64_t           capacity;        // NOTE(Constantine): 0 or a power of two, kept at least twice the number of indexed entries.
+  uint64_t *         slots;           // NOTE(Constantine): Pairs of key hash and entry index plus 1, linearly probed, entry index plus 1 of an empty slot is 0.
+} vf_hash_index_t;
+
+typedef struct vf_program_pipeline_cache_entry_t {
+  uint64_t           keyHash;
+  uint64_t           keyWordsCount;
+  uint64_t *         keyWords;        // NOTE(Constantine): Program id, variables, struct members and specialization constants, compared in full on hash match.
+  uint64_t           programPipeline;
+  uint64_t           referencesCount; // NOTE(Constantine): vfProgramPipelineCreateComputeCached() calls not released with vfProgramPipelineReleaseCached() yet.
+} vf_program_pipeline_cache_entry_t;
+
+#define VF_TUNING_KEY_MAX_BYTES 128
+
+typedef struct vf_tuning_entry_t {
+  char               key[VF_TUNING_KEY_MAX_BYTES];
+  unsigned           localSize[3];
+} vf_tuning_entry_t;
+
+#define VF_FRAMES_TIMESTAMPS_COUNT 64
+
+typedef struct vf_frame_timestamps_t {
+  uint64_t           frameIndex;
+  uint64_t           acquireNanoseconds;
+  uint64_t           submitNanoseconds;
+  uint64_t           presentNanoseconds;       // NOTE(Constantine): When redQueuePresent() returned.
+  uint64_t           pacingSleepNanoseconds;
+  uint64_t           pacingWakeNanoseconds;    // NOTE(Constantine): Computed, 0 if the frame wasn't paced.
+  uint64_t           pacingWokeNanoseconds;
+} vf_frame_timestamps_t;
+
+#define VF_BINDINGS_SETS_POOLS_SOFT_MAX_COUNT 8
+
+typedef struct vf_bindings_sets_pool_t {
+  RedHandleStructsMemory structsMemory;
+  uint64_t               maxStructsCount;
+  uint64_t               structsCount;    // NOTE(Constantine): Suballocated since the last reset.
+  uint64_t               lastUse;         // NOTE(Constantine): Largest lastUse of the bindings sets suballocated from this pool.
+} vf_bindings_sets_pool_t;
+
+typedef struct vf_bindings_set_t {
+  uint64_t               keyHash;
+  uint64_t               keyWordsCount;
+  uint64_t *             keyWords;        // NOTE(Constantine): Slots, then slot, type, count and the raw bound ranges of every bind, compared in full on hash match.
+  RedHandleStruct        structure;
+  uint64_t               poolIndex;
+  uint64_t               referencesCount; // NOTE(Constantine): Number of recorded batches that bind this set, the pool can't be reset while it's not 0.
+  uint64_t               lastUse;
+} vf_bindings_set_t;
+
 typedef struct vf_handle_context_t {
   int                doNotDestroyRawContext;
   int                doNotFreeHandle;
@@ -48,6 +119,8 @@ typedef struct vf_handle_context_t {
   unsigned           specificMemoryTypesGpuVram;
   unsigned           specificMemoryTypesCpuUpload;
   unsigned           specificMemoryTypesCpuReadback;
+  int                specificMemoryTypesCpuUploadIsCoherent;   // NOTE(Constantine): If 0, CPU writes are flushed explicitly before submits.
+  int                specificMemoryTypesCpuReadbackIsCoherent; // NOTE(Constantine): If 0, CPU reads are invalidated explicitly after waits.
 
   uint64_t           memoryAllocationSizeGpuVram;
   uint64_t           memoryAllocationSizeCpuUpload;
@@ -63,15 +136,20 @@ typedef struct vf_handle_context_t {
   RedArray           memoryCpuUpload_array;
   RedHandleMemory    memoryCpuUpload_memory;
   void *             memoryCpuUpload_mapped_void_ptr_original;
-  void *             memoryCpuUpload_mapped_void_ptr_offset;
   uint64_t           memoryCpuUpload_memory_suballocations_offset;
 
   RedArray           memoryCpuReadback_array;
   RedHandleMemory    memoryCpuReadback_memory;
   void *             memoryCpuReadback_mapped_void_ptr_original;
-  void *             memoryCpuReadback_mapped_void_ptr_offset;
   uint64_t           memoryCpuReadback_memory_suballocations_offset;
 
+  uint64_t           heapsGrowBlockBytesCount;    // NOTE(Constantine): If 0, storages heaps never grow.
+  uint64_t           heapsGrowMaxTotalBytesCount; // NOTE(Constantine): If 0, storages heaps grow until memory allocation fails.
+  uint64_t           heapsGrowing;                // NOTE(Constantine): 1 while a heap grows, vfStorageCreate then skips its lock-free bump.
+  uint64_t           heapsBumpersCount;           // NOTE(Constantine): vfStorageCreate calls in their lock-free bump, a heap growth waits for them.
+  void *             heapsGrowMutex;              // NOTE(Constantine): SRWLOCK * or pthread_mutex_t *, serializes heap growths.
+  vf_heap_blocks_t   heapsBlocks[4];              // NOTE(Constantine): Indexed by gpu_storage_type_t.
+
   // WSI
 
   void *             windowHandle;
@@ -93,11 +171,118 @@ typedef struct vf_handle_context_t {
 
   RedPresentVsyncMode presentVsyncMode;
   int                 presentImagesCount;
+
+  RedHandlePresent   presentRetired;                                 // NOTE(Constantine): Replaced by the last present rebuild, its images can still be in use.
+  RedHandleGpuSignal presentRetiredGpuSignalAcquire;
+  Red2Array          presentRetiredPixelsCpuUpload_memory_and_array; // NOTE(Constantine): Replaced by a larger one by the last present rebuild.
+  uint64_t           presentRetiredDrawsCount;                       // NOTE(Constantine): Draws that waited presentCpuSignal since the last present rebuild, retired resources are destroyed at 2.
+
+  uint64_t            windowsCount;
+  struct vf_handle_context_t ** windows; // NOTE(Constantine): Extra windows added with vfWindowAdd(), window index minus 1.
+
+  // Present convert
+
+  uint64_t               presentConvertProgram;                      // NOTE(Constantine): Created by the first vfDrawPixelsEx() call.
+  uint64_t               presentConvertProgramPipeline;
+  RedHandleStructsMemory presentConvertStructsMemory;
+  Red2Struct             presentConvertStruct;
+  uint64_t               presentConvertPixelsCpuUploadBytesCount;
+  Red2Array              presentConvertPixelsCpuUpload_memory_and_array;
+  void *                 presentConvertPixelsCpuUpload_void_ptr_original;
+  uint64_t               presentConvertPixelsGpuBytesCount;
+  Red2Array              presentConvertPixelsGpu_memory_and_array;   // NOTE(Constantine): Window BGRA8 pixels, then source BGRA8 pixels if upscaled, then the pixels copied from the CPU upload array.
+  uint64_t               presentUpscaleProgram;                      // NOTE(Constantine): Created by the first upscaled vfDrawPixelsEx() call.
+  uint64_t               presentUpscaleProgramPipeline;
+  Red2Struct             presentUpscaleStruct;                       // NOTE(Constantine): Suballocated from presentConvertStructsMemory.
+
+  // Pacing
+
+  uint64_t              pacingFrameNanoseconds;         // NOTE(Constantine): If 0, vfWindowPacingWait() doesn't sleep.
+  uint64_t              pacingMarginNanoseconds;
+  uint64_t              pacingDeadlineNanoseconds;      // NOTE(Constantine): When the last paced frame was meant to be presented.
+  uint64_t              pacingWorkNanosecondsEstimate;  // NOTE(Constantine): From a pacing wake to the return of the present, rises at once and decays slowly.
+  void *                pacingTimer;                    // NOTE(Constantine): Win32 waitable timer HANDLE.
+  uint64_t              framesCount;
+  vf_frame_timestamps_t framesTimestamps[VF_FRAMES_TIMESTAMPS_COUNT]; // NOTE(Constantine): Ring indexed by frame index, the current frame is at framesCount.
+
+  // Init timeline
+
+  uint64_t           initContextNanoseconds;
+  uint64_t           initValidationNanoseconds;
+  uint64_t           initHeapsNanoseconds;
+  uint64_t           initTotalNanoseconds;
+  int                initValidationWasCached;
+
+  // Storages
+
+  uint64_t               storagesLock;
+  uint64_t               storagesCount;
+  struct vf_handle_t *   storagesFirst;                    // NOTE(Constantine): Intrusive list of the live storages in creation order, for vfContextCheckpoint().
+  struct vf_handle_t *   storagesLast;
+
+  // CPU signals
+
+  uint64_t               cpuSignalsPoolLock;
+  uint64_t               cpuSignalsPoolCount;
+  uint64_t               cpuSignalsPoolCapacity;
+  RedHandleCpuSignal *   cpuSignalsPool;                   // NOTE(Constantine): Unsignaled CPU signals of waited asyncs, reused by the next async batch executes.
+
+  // Capture
+
+  void *                 captureFile;                      // NOTE(Constantine): FILE *, NULL if not capturing.
+  void *                 captureMutex;                     // NOTE(Constantine): SRWLOCK * or pthread_mutex_t *, guards captureFile and captureCpuUploadStorages.
+  uint64_t               captureCpuUploadStoragesCount;
+  uint64_t               captureCpuUploadStoragesCapacity;
+  vf_capture_storage_t * captureCpuUploadStorages;         // NOTE(Constantine): Contents are written before every submit they changed for.
+
+  // Program pipelines cache
+
+  uint64_t                            programPipelinesCacheLock;
+  uint64_t                            programPipelinesCacheCount;
+  uint64_t                            programPipelinesCacheCapacity;
+  vf_program_pipeline_cache_entry_t * programPipelinesCache;
+  vf_hash_index_t                     programPipelinesCacheIndex; // NOTE(Constantine): Entries of programPipelinesCache by key hash.
+
+  // Tuning
+
+  char *                              tuningCacheFilepath; // NOTE(Constantine): A copy of gpu_context_ex4_parameters_t::optionalTuningCacheFilepath, NULL if not set.
+  uint64_t                            tuningLock;
+  uint64_t                            tuningEntriesCount;
+  uint64_t                            tuningEntriesCapacity;
+  vf_tuning_entry_t *                 tuningEntries;
+
+  // Bindings sets cache
+
+  uint64_t                            bindingsSetsLock;
+  uint64_t                            bindingsSetsUseClock;
+  uint64_t                            bindingsSetsCount;
+  uint64_t                            bindingsSetsCapacity;
+  vf_bindings_set_t **                bindingsSets;        // NOTE(Constantine): Allocated one by one, batches keep pointers to them.
+  vf_hash_index_t                     bindingsSetsIndex;   // NOTE(Constantine): Entries of bindingsSets by key hash.
+  uint64_t                            bindingsSetsHitsCount;
+  uint64_t                            bindingsSetsMissesCount;
+  uint64_t                            bindingsSetsPoolResetsCount;
+  uint64_t                            bindingsSetsPoolsCount;
+  uint64_t                            bindingsSetsPoolsCapacity;
+  vf_bindings_sets_pool_t *           bindingsSetsPools;
 } vf_handle_context_t;
 
+typedef struct vf_storage_share_t {
+  uint64_t              lock;
+  uint64_t              referencesCount; // NOTE(Constantine): The exported storage handle and every imported one, the share is freed with the last of them.
+  vf_handle_context_t * heapVkfast;      // NOTE(Constantine): The exporting context, its heap holds the storage memory.
+  vf_handle_context_t * ownerVkfast;     // NOTE(Constantine): NULL while the storage is released and not acquired yet.
+} vf_storage_share_t;
+
 typedef struct vf_handle_storage_t {
   gpu_storage_info_t   info;           // NOTE(Constantine): Optional debug name is a stale pointer, do not use.
   RedStructMemberArray arrayRangeInfo; // NOTE(Constantine): Kept for GPU copy calls.
+  vf_storage_share_t * share;          // NOTE(Constantine): NULL if the storage was never exported.
+  int                  isInStorages;   // NOTE(Constantine): 1 while the storage is in the storages list of its context, imported storages never are.
+  struct vf_handle_t * storagesPrev;
+  struct vf_handle_t * storagesNext;
+  RedHandleMemory      hostImportMemory;  // NOTE(Constantine): Imported host memory of vfStorageCreateFromHostPointer(), NULL for heap storages. Its array is arrayRangeInfo.array, both are destroyed by vfIdDestroy().
+  void *               hostImportPointer; // NOTE(Constantine): host_pointer of vfStorageCreateFromHostPointer(), NULL for heap storages.
 } vf_handle_storage_t;
 
 typedef enum vf_gpu_code_type_t {
@@ -109,6 +294,8 @@ typedef struct vf_handle_gpu_code_t {
   gpu_program_info_t info;        // NOTE(Constantine): Program binary is a stale pointer, do not use.
   vf_gpu_code_type_t gpuCodeType;
   RedHandleGpuCode   gpuCode;     // NOTE(Constantine): Kept to be destroyed.
+  uint64_t           specializableIrBytesCount;
+  void *             specializableIr; // NOTE(Constantine): A copy of the program binary, kept only if it has specialization constants.
 } vf_handle_gpu_code_t;
 
 typedef enum vf_procedure_type_t {
@@ -118,11 +305,14 @@ typedef enum vf_procedure_type_t {
 
 typedef struct vf_handle_procedure_t {
   union {
-    gpu_program_pipeline_compute_info_t infoCompute; // NOTE(Constantine): Optional debug name is a stale pointer, do not use.
+    gpu_program_pipeline_compute_info_t infoCompute; // NOTE(Constantine): Optional debug name, struct members and specialization constants are stale pointers, do not use.
   };
   vf_procedure_type_t                    procedureType;
   Red2ProcedureParametersAndDeclarations procedureParameters;
   RedHandleProcedure                     procedure;
+  RedHandleGpuCode                       specializedGpuCode; // NOTE(Constantine): Kept to be destroyed, NULL if the program pipeline has no specialization constants.
+  int                                    isCached;           // NOTE(Constantine): 1 while the program pipeline is in the program pipelines cache.
+  uint64_t                               cachedKeyHash;
 } vf_handle_procedure_t;
 
 typedef struct vf_handle_batch_t {
@@ -133,6 +323,14 @@ typedef struct vf_handle_batch_t {
   Red2Struct                    currentStruct;
   Red2Struct                    currentStructSamplers;
   RedHandleProcedureParameters  currentProcedureParametersCompute;
+  int                           useBindingsSetsCache;
+  int                           pendingBindingsSetIsOpen;
+  uint64_t                      pendingBindingsSetKeyWordsCount;
+  uint64_t                      pendingBindingsSetKeyWordsCapacity;
+  uint64_t *                    pendingBindingsSetKeyWords;
+  uint64_t                      referencedBindingsSetsCount;
+  uint64_t                      referencedBindingsSetsCapacity;
+  vf_bindings_set_t **          referencedBindingsSets;   // NOTE(Constantine): Released on the next vfBatchBegin() or vfIdDestroy() of the batch.
 } vf_handle_batch_t;
 
 typedef enum vf_handle_id_t {
@@ -0,0 +1,643 @@
+#if 0
+; SPIR-V
+; Version: 1.0
+; Generator: Khronos; 0
+; Bound: 187
+; Schema: 0
+               OpCapability Shader
+          %1 = OpExtInstImport "GLSL.std.450"
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main" %gl_GlobalInvocationID
+               OpExecutionMode %main LocalSize 8 8 1
+               OpName %type_ConstantBuffer_Variables "type.ConstantBuffer.Variables"
+               OpMemberName %type_ConstantBuffer_Variables 0 "width"
+               OpMemberName %type_ConstantBuffer_Variables 1 "height"
+               OpMemberName %type_ConstantBuffer_Variables 2 "format"
+               OpMemberName %type_ConstantBuffer_Variables 3 "transfer"
+               OpMemberName %type_ConstantBuffer_Variables 4 "exposure"
+               OpMemberName %type_ConstantBuffer_Variables 5 "inverse_gamma"
+               OpName %variables "variables"
+               OpName %type_StructuredBuffer_uint "type.StructuredBuffer.uint"
+               OpName %pixels "pixels"
+               OpName %type_RWStructuredBuffer_uint "type.RWStructuredBuffer.uint"
+               OpName %bgra8 "bgra8"
+               OpName %main "main"
+               OpDecorate %gl_GlobalInvocationID BuiltIn GlobalInvocationId
+               OpDecorate %pixels DescriptorSet 0
+               OpDecorate %pixels Binding 0
+               OpDecorate %bgra8 DescriptorSet 0
+               OpDecorate %bgra8 Binding 1
+               OpDecorate %_runtimearr_uint ArrayStride 4
+               OpMemberDecorate %type_StructuredBuffer_uint 0 Offset 0
+               OpMemberDecorate %type_StructuredBuffer_uint 0 NonWritable
+               OpDecorate %type_StructuredBuffer_uint BufferBlock
+               OpMemberDecorate %type_RWStructuredBuffer_uint 0 Offset 0
+               OpDecorate %type_RWStructuredBuffer_uint BufferBlock
+               OpMemberDecorate %type_ConstantBuffer_Variables 0 Offset 0
+               OpMemberDecorate %type_ConstantBuffer_Variables 1 Offset 4
+               OpMemberDecorate %type_ConstantBuffer_Variables 2 Offset 8
+               OpMemberDecorate %type_ConstantBuffer_Variables 3 Offset 12
+               OpMemberDecorate %type_ConstantBuffer_Variables 4 Offset 16
+               OpMemberDecorate %type_ConstantBuffer_Variables 5 Offset 20
+               OpDecorate %type_ConstantBuffer_Variables Block
+       %void = OpTypeVoid
+       %bool = OpTypeBool
+       %uint = OpTypeInt 32 0
+        %int = OpTypeInt 32 1
+      %float = OpTypeFloat 32
+    %v2float = OpTypeVector %float 2
+    %v3float = OpTypeVector %float 3
+    %v4float = OpTypeVector %float 4
+     %v3uint = OpTypeVector %uint 3
+      %int_0 = OpConstant %int 0
+      %int_1 = OpConstant %int 1
+      %int_2 = OpConstant %int 2
+      %int_3 = OpConstant %int 3
+      %int_4 = OpConstant %int 4
+      %int_5 = OpConstant %int 5
+     %uint_0 = OpConstant %uint 0
+     %uint_1 = OpConstant %uint 1
+     %uint_2 = OpConstant %uint 2
+     %uint_3 = OpConstant %uint 3
+     %uint_4 = OpConstant %uint 4
+     %uint_5 = OpConstant %uint 5
+    %uint_11 = OpConstant %uint 11
+    %uint_16 = OpConstant %uint 16
+    %uint_31 = OpConstant %uint 31
+    %uint_63 = OpConstant %uint 63
+ %uint_65535 = OpConstant %uint 65535
+    %float_0 = OpConstant %float 0
+    %float_1 = OpConstant %float 1
+%float_0_0322580636 = OpConstant %float 0.0322580636
+%float_0_0158730168 = OpConstant %float 0.0158730168
+%float_2_50999999 = OpConstant %float 2.50999999
+%float_0_0299999993 = OpConstant %float 0.0299999993
+%float_2_43000007 = OpConstant %float 2.43000007
+%float_0_589999974 = OpConstant %float 0.589999974
+%float_0_140000001 = OpConstant %float 0.140000001
+         %46 = OpConstantComposite %v3float %float_0 %float_0 %float_0
+         %47 = OpConstantComposite %v3float %float_1 %float_1 %float_1
+         %48 = OpConstantComposite %v3float %float_2_50999999 %float_2_50999999 %float_2_50999999
+         %49 = OpConstantComposite %v3float %float_0_0299999993 %float_0_0299999993 %float_0_0299999993
+         %50 = OpConstantComposite %v3float %float_2_43000007 %float_2_43000007 %float_2_43000007
+         %51 = OpConstantComposite %v3float %float_0_589999974 %float_0_589999974 %float_0_589999974
+         %52 = OpConstantComposite %v3float %float_0_140000001 %float_0_140000001 %float_0_140000001
+         %53 = OpConstantComposite %v4float %float_0 %float_0 %float_0 %float_0
+         %54 = OpConstantComposite %v4float %float_1 %float_1 %float_1 %float_1
+%_runtimearr_uint = OpTypeRuntimeArray %uint
+%type_StructuredBuffer_uint = OpTypeStruct %_runtimearr_uint
+%_ptr_Uniform_type_StructuredBuffer_uint = OpTypePointer Uniform %type_StructuredBuffer_uint
+%type_RWStructuredBuffer_uint = OpTypeStruct %_runtimearr_uint
+%_ptr_Uniform_type_RWStructuredBuffer_uint = OpTypePointer Uniform %type_RWStructuredBuffer_uint
+%type_ConstantBuffer_Variables = OpTypeStruct %uint %uint %uint %uint %float %float
+%_ptr_PushConstant_type_ConstantBuffer_Variables = OpTypePointer PushConstant %type_ConstantBuffer_Variables
+%_ptr_Input_v3uint = OpTypePointer Input %v3uint
+         %59 = OpTypeFunction %void
+%_ptr_PushConstant_uint = OpTypePointer PushConstant %uint
+%_ptr_PushConstant_float = OpTypePointer PushConstant %float
+%_ptr_Uniform_uint = OpTypePointer Uniform %uint
+%_ptr_Function_v4float = OpTypePointer Function %v4float
+%_ptr_Function_v3float = OpTypePointer Function %v3float
+     %pixels = OpVariable %_ptr_Uniform_type_StructuredBuffer_uint Uniform
+      %bgra8 = OpVariable %_ptr_Uniform_type_RWStructuredBuffer_uint Uniform
+  %variables = OpVariable %_ptr_PushConstant_type_ConstantBuffer_Variables PushConstant
+%gl_GlobalInvocationID = OpVariable %_ptr_Input_v3uint Input
+       %main = OpFunction %void None %59
+         %65 = OpLabel
+         %66 = OpVariable %_ptr_Function_v4float Function
+         %67 = OpVariable %_ptr_Function_v3float Function
+         %68 = OpLoad %v3uint %gl_GlobalInvocationID
+         %69 = OpCompositeExtract %uint %68 0
+         %70 = OpCompositeExtract %uint %68 1
+         %71 = OpAccessChain %_ptr_PushConstant_uint %variables %int_0
+         %72 = OpLoad %uint %71
+         %73 = OpAccessChain %_ptr_PushConstant_uint %variables %int_1
+         %74 = OpLoad %uint %73
+         %75 = OpUGreaterThanEqual %bool %69 %72
+         %76 = OpUGreaterThanEqual %bool %70 %74
+         %77 = OpLogicalOr %bool %75 %76
+               OpSelectionMerge %78 None
+               OpBranchConditional %77 %79 %78
+         %79 = OpLabel
+               OpReturn
+         %78 = OpLabel
+         %80 = OpIMul %uint %70 %72
+         %81 = OpIAdd %uint %80 %69
+         %82 = OpAccessChain %_ptr_PushConstant_uint %variables %int_2
+         %83 = OpLoad %uint %82
+         %84 = OpIEqual %bool %83 %uint_1
+               OpSelectionMerge %85 None
+               OpBranchConditional %84 %86 %87
+         %86 = OpLabel
+         %88 = OpShiftLeftLogical %uint %81 %uint_2
+         %89 = OpAccessChain %_ptr_Uniform_uint %pixels %int_0 %88
+         %90 = OpLoad %uint %89
+         %91 = OpBitcast %float %90
+         %92 = OpIAdd %uint %88 %uint_1
+         %93 = OpAccessChain %_ptr_Uniform_uint %pixels %int_0 %92
+         %94 = OpLoad %uint %93
+         %95 = OpBitcast %float %94
+         %96 = OpIAdd %uint %88 %uint_2
+         %97 = OpAccessChain %_ptr_Uniform_uint %pixels %int_0 %96
+         %98 = OpLoad %uint %97
+         %99 = OpBitcast %float %98
+        %100 = OpIAdd %uint %88 %uint_3
+        %101 = OpAccessChain %_ptr_Uniform_uint %pixels %int_0 %100
+        %102 = OpLoad %uint %101
+        %103 = OpBitcast %float %102
+        %104 = OpCompositeConstruct %v4float %91 %95 %99 %103
+               OpStore %66 %104
+               OpBranch %85
+         %87 = OpLabel
+        %105 = OpIEqual %bool %83 %uint_2
+               OpSelectionMerge %106 None
+               OpBranchConditional %105 %107 %108
+        %107 = OpLabel
+        %109 = OpShiftLeftLogical %uint %81 %uint_1
+        %110 = OpIAdd %uint %109 %uint_1
+        %111 = OpAccessChain %_ptr_Uniform_uint %pixels %int_0 %109
+        %112 = OpLoad %uint %111
+        %113 = OpAccessChain %_ptr_Uniform_uint %pixels %int_0 %110
+        %114 = OpLoad %uint %113
+        %115 = OpExtInst %v2float %1 UnpackHalf2x16 %112
+        %116 = OpExtInst %v2float %1 UnpackHalf2x16 %114
+        %117 = OpCompositeConstruct %v4float %115 %116
+               OpStore %66 %117
+               OpBranch %106
+        %108 = OpLabel
+        %118 = OpIEqual %bool %83 %uint_3
+               OpSelectionMerge %119 None
+               OpBranchConditional %118 %120 %121
+        %120 = OpLabel
+        %122 = OpShiftRightLogical %uint %81 %uint_1
+        %123 = OpAccessChain %_ptr_Uniform_uint %pixels %int_0 %122
+        %124 = OpLoad %uint %123
+        %125 = OpBitwiseAnd %uint %81 %uint_1
+        %126 = OpShiftLeftLogical %uint %125 %uint_4
+        %127 = OpShiftRightLogical %uint %124 %126
+        %128 = OpBitwiseAnd %uint %127 %uint_65535
+        %129 = OpShiftRightLogical %uint %128 %uint_11
+        %130 = OpBitwiseAnd %uint %129 %uint_31
+        %131 = OpShiftRightLogical %uint %128 %uint_5
+        %132 = OpBitwiseAnd %uint %131 %uint_63
+        %133 = OpBitwiseAnd %uint %128 %uint_31
+        %134 = OpConvertUToF %float %130
+        %135 = OpConvertUToF %float %132
+        %136 = OpConvertUToF %float %133
+        %137 = OpFMul %float %134 %float_0_0322580636
+        %138 = OpFMul %float %135 %float_0_0158730168
+        %139 = OpFMul %float %136 %float_0_0322580636
+        %140 = OpCompositeConstruct %v4float %137 %138 %139 %float_1
+               OpStore %66 %140
+               OpBranch %119
+        %121 = OpLabel
+        %141 = OpAccessChain %_ptr_Uniform_uint %pixels %int_0 %81
+        %142 = OpLoad %uint %141
+        %143 = OpExtInst %v4float %1 UnpackUnorm4x8 %142
+        %144 = OpVectorShuffle %v4float %143 %143 2 1 0 3
+               OpStore %66 %144
+               OpBranch %119
+        %119 = OpLabel
+               OpBranch %106
+        %106 = OpLabel
+               OpBranch %85
+         %85 = OpLabel
+        %145 = OpLoad %v4float %66
+        %146 = OpVectorShuffle %v3float %145 %145 0 1 2
+        %147 = OpAccessChain %_ptr_PushConstant_float %variables %int_4
+        %148 = OpLoad %float %147
+        %149 = OpVectorTimesScalar %v3float %146 %148
+               OpStore %67 %149
+        %150 = OpAccessChain %_ptr_PushConstant_uint %variables %int_3
+        %151 = OpLoad %uint %150
+        %152 = OpIEqual %bool %151 %uint_2
+               OpSelectionMerge %153 None
+               OpBranchConditional %152 %154 %155
+        %154 = OpLabel
+        %156 = OpFAdd %v3float %149 %47
+        %157 = OpFDiv %v3float %149 %156
+               OpStore %67 %157
+               OpBranch %153
+        %155 = OpLabel
+        %158 = OpIEqual %bool %151 %uint_3
+               OpSelectionMerge %159 None
+               OpBranchConditional %158 %160 %159
+        %160 = OpLabel
+        %161 = OpFMul %v3float %149 %48
+        %162 = OpFAdd %v3float %161 %49
+        %163 = OpFMul %v3float %149 %162
+        %164 = OpFMul %v3float %149 %50
+        %165 = OpFAdd %v3float %164 %51
+        %166 = OpFMul %v3float %149 %165
+        %167 = OpFAdd %v3float %166 %52
+        %168 = OpFDiv %v3float %163 %167
+               OpStore %67 %168
+               OpBranch %159
+        %159 = OpLabel
+               OpBranch %153
+        %153 = OpLabel
+        %169 = OpINotEqual %bool %151 %uint_0
+               OpSelectionMerge %170 None
+               OpBranchConditional %169 %171 %170
+        %171 = OpLabel
+        %172 = OpLoad %v3float %67
+        %173 = OpExtInst %v3float %1 FClamp %172 %46 %47
+        %174 = OpAccessChain %_ptr_PushConstant_float %variables %int_5
+        %175 = OpLoad %float %174
+        %176 = OpCompositeConstruct %v3float %175 %175 %175
+        %177 = OpExtInst %v3float %1 Pow %173 %176
+               OpStore %67 %177
+               OpBranch %170
+        %170 = OpLabel
+        %178 = OpLoad %v3float %67
+        %179 = OpCompositeExtract %float %145 3
+        %180 = OpCompositeExtract %float %178 0
+        %181 = OpCompositeExtract %float %178 1
+        %182 = OpCompositeExtract %float %178 2
+        %183 = OpCompositeConstruct %v4float %182 %181 %180 %179
+        %184 = OpExtInst %v4float %1 FClamp %183 %53 %54
+        %185 = OpExtInst %uint %1 PackUnorm4x8 %184
+        %186 = OpAccessChain %_ptr_Uniform_uint %bgra8 %int_0 %81
+               OpStore %186 %185
+               OpReturn
+               OpFunctionEnd
+
+// NOTE(Constantine): Hand-assembled from vkfast_present_convert.cs.hlsl, hence generator word 0. It was checked by decompiling it with
+// SPIRV-Cross and by interpreting it over every gpu_pixels_format_t and gpu_pixels_transfer_t against a C reference. Replace this file with the
+// output of the dxc command in vkfast_present_convert.cs.hlsl.
+
+#endif
+
+const unsigned char g_main[] = {
+  0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x74, 0x79, 0x70, 0x65, 0x2e, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e,
+  0x74, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2e, 0x56, 0x61, 0x72, 0x69,
+  0x61, 0x62, 0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x69, 0x64, 0x74,
+  0x68, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x00, 0x00,
+  0x06, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x74, 0x72, 0x61, 0x6e,
+  0x73, 0x66, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x65, 0x78, 0x70, 0x6f,
+  0x73, 0x75, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x76, 0x65,
+  0x72, 0x73, 0x65, 0x5f, 0x67, 0x61, 0x6d, 0x6d, 0x61, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x76, 0x61, 0x72, 0x69,
+  0x61, 0x62, 0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x05, 0x00, 0x09, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x74, 0x79, 0x70, 0x65, 0x2e, 0x53, 0x74, 0x72,
+  0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x64, 0x42, 0x75, 0x66, 0x66, 0x65,
+  0x72, 0x2e, 0x75, 0x69, 0x6e, 0x74, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 0x00, 0x00,
+  0x05, 0x00, 0x0a, 0x00, 0x08, 0x00, 0x00, 0x00, 0x74, 0x79, 0x70, 0x65,
+  0x2e, 0x52, 0x57, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+  0x64, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2e, 0x75, 0x69, 0x6e, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x62, 0x67, 0x72, 0x61, 0x38, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x3f, 0x2b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x08, 0x21, 0x04, 0x3d, 0x2b, 0x00, 0x04, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x21, 0x08, 0x82, 0x3c,
+  0x2b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0xd7, 0xa3, 0x20, 0x40, 0x2b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x8f, 0xc2, 0xf5, 0x3c, 0x2b, 0x00, 0x04, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x1f, 0x85, 0x1b, 0x40,
+  0x2b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x3d, 0x0a, 0x17, 0x3f, 0x2b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x29, 0x5c, 0x0f, 0x3e, 0x2c, 0x00, 0x06, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x07, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x07, 0x00, 0x12, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x37, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x41, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0xae, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0xae, 0x00, 0x05, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x03, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0xfd, 0x00, 0x01, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x03, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x54, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0xc4, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x62, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x66, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0x63, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x6b, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x05, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x77, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0x7b, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0xc4, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0xc2, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x05, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x05, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x8e, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x77, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x77, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x6a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x91, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x43, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x43, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x99, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x9e, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x03, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x9e, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00,
+  0x9f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xa0, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x05, 0x00, 0x11, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0xa3, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x05, 0x00, 0x11, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x05, 0x00, 0x11, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0xa7, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0xab, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xa9, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xab, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x08, 0x00, 0x11, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x43, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0xb9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0xba, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xba, 0x00, 0x00, 0x00,
+  0xb9, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00
+};
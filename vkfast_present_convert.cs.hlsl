@@ -0,0 +1,48 @@
+// dxc.exe vkfast_present_convert.cs.hlsl -T cs_6_0 -Fh vkfast_present_convert.cs.h -spirv
+
+[[vk::binding(0, 0)]] StructuredBuffer<uint>   pixels;
+[[vk::binding(1, 0)]] RWStructuredBuffer<uint> bgra8;
+
+struct Variables {
+  uint  width;
+  uint  height;
+  uint  format;
+  uint  transfer;
+  float exposure;
+  float inverse_gamma;
+};
+[[vk::push_constant]] ConstantBuffer<Variables> variables;
+
+[numthreads(8, 8, 1)]
+void main(uint3 tid: SV_DispatchThreadId) {
+  if (tid.x >= variables.width || tid.y >= variables.height) {
+    return;
+  }
+  const uint i = tid.y * variables.width + tid.x;
+
+  float4 c;
+  if (variables.format == 1) { // GPU_PIXELS_FORMAT_RGBA32F
+    c = asfloat(uint4(pixels[i*4+0], pixels[i*4+1], pixels[i*4+2], pixels[i*4+3]));
+  } else if (variables.format == 2) { // GPU_PIXELS_FORMAT_RGBA16F
+    c = float4(f16tof32(pixels[i*2+0]), f16tof32(pixels[i*2+0] >> 16), f16tof32(pixels[i*2+1]), f16tof32(pixels[i*2+1] >> 16));
+  } else if (variables.format == 3) { // GPU_PIXELS_FORMAT_RGB565
+    const uint p = (pixels[i/2] >> ((i&1)*16)) & 0xFFFF;
+    c = float4(float((p >> 11) & 31) / 31.0, float((p >> 5) & 63) / 63.0, float(p & 31) / 31.0, 1.0);
+  } else { // GPU_PIXELS_FORMAT_BGRA8
+    const uint p = pixels[i];
+    c = float4((p >> 16) & 255, (p >> 8) & 255, p & 255, p >> 24) / 255.0;
+  }
+
+  float3 rgb = c.rgb * variables.exposure;
+  if (variables.transfer == 2) { // GPU_PIXELS_TRANSFER_REINHARD_GAMMA
+    rgb = rgb / (1.0 + rgb);
+  } else if (variables.transfer == 3) { // GPU_PIXELS_TRANSFER_ACES_GAMMA
+    rgb = (rgb * (2.51 * rgb + 0.03)) / (rgb * (2.43 * rgb + 0.59) + 0.14);
+  }
+  if (variables.transfer != 0) {
+    rgb = pow(saturate(rgb), variables.inverse_gamma);
+  }
+
+  const uint4 b = uint4(round(saturate(float4(rgb.b, rgb.g, rgb.r, c.a)) * 255.0));
+  bgra8[i] = b.x | (b.y << 8) | (b.z << 16) | (b.w << 24);
+}
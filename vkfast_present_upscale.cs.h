@@ -0,0 +1,595 @@
+#if 0
+; SPIR-V
+; Version: 1.0
+; Generator: Khronos; 0
+; Bound: 176
+; Schema: 0
+               OpCapability Shader
+          %1 = OpExtInstImport "GLSL.std.450"
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main" %gl_GlobalInvocationID
+               OpExecutionMode %main LocalSize 8 8 1
+               OpName %type_ConstantBuffer_Variables "type.ConstantBuffer.Variables"
+               OpMemberName %type_ConstantBuffer_Variables 0 "width"
+               OpMemberName %type_ConstantBuffer_Variables 1 "height"
+               OpMemberName %type_ConstantBuffer_Variables 2 "source_width"
+               OpMemberName %type_ConstantBuffer_Variables 3 "source_height"
+               OpMemberName %type_ConstantBuffer_Variables 4 "upscale"
+               OpMemberName %type_ConstantBuffer_Variables 5 "sharpness"
+               OpName %variables "variables"
+               OpName %type_StructuredBuffer_uint "type.StructuredBuffer.uint"
+               OpName %source "source"
+               OpName %type_RWStructuredBuffer_uint "type.RWStructuredBuffer.uint"
+               OpName %bgra8 "bgra8"
+               OpName %main "main"
+               OpDecorate %gl_GlobalInvocationID BuiltIn GlobalInvocationId
+               OpDecorate %source DescriptorSet 0
+               OpDecorate %source Binding 0
+               OpDecorate %bgra8 DescriptorSet 0
+               OpDecorate %bgra8 Binding 1
+               OpDecorate %_runtimearr_uint ArrayStride 4
+               OpMemberDecorate %type_StructuredBuffer_uint 0 Offset 0
+               OpMemberDecorate %type_StructuredBuffer_uint 0 NonWritable
+               OpDecorate %type_StructuredBuffer_uint BufferBlock
+               OpMemberDecorate %type_RWStructuredBuffer_uint 0 Offset 0
+               OpDecorate %type_RWStructuredBuffer_uint BufferBlock
+               OpMemberDecorate %type_ConstantBuffer_Variables 0 Offset 0
+               OpMemberDecorate %type_ConstantBuffer_Variables 1 Offset 4
+               OpMemberDecorate %type_ConstantBuffer_Variables 2 Offset 8
+               OpMemberDecorate %type_ConstantBuffer_Variables 3 Offset 12
+               OpMemberDecorate %type_ConstantBuffer_Variables 4 Offset 16
+               OpMemberDecorate %type_ConstantBuffer_Variables 5 Offset 20
+               OpDecorate %type_ConstantBuffer_Variables Block
+       %void = OpTypeVoid
+       %bool = OpTypeBool
+       %uint = OpTypeInt 32 0
+        %int = OpTypeInt 32 1
+      %float = OpTypeFloat 32
+    %v2float = OpTypeVector %float 2
+    %v3float = OpTypeVector %float 3
+    %v4float = OpTypeVector %float 4
+     %v2uint = OpTypeVector %uint 2
+     %v3uint = OpTypeVector %uint 3
+      %int_0 = OpConstant %int 0
+      %int_1 = OpConstant %int 1
+      %int_2 = OpConstant %int 2
+      %int_3 = OpConstant %int 3
+      %int_4 = OpConstant %int 4
+      %int_5 = OpConstant %int 5
+     %uint_0 = OpConstant %uint 0
+     %uint_1 = OpConstant %uint 1
+    %float_0 = OpConstant %float 0
+ %float_0_25 = OpConstant %float 0.25
+  %float_0_5 = OpConstant %float 0.5
+    %float_1 = OpConstant %float 1
+    %float_2 = OpConstant %float 2
+    %float_3 = OpConstant %float 3
+%float_0_00392156886 = OpConstant %float 0.00392156886
+%float_0_114 = OpConstant %float 0.114
+%float_0_587000012 = OpConstant %float 0.587000012
+%float_0_298999995 = OpConstant %float 0.298999995
+         %39 = OpConstantComposite %v2float %float_0_5 %float_0_5
+         %40 = OpConstantComposite %v2float %float_2 %float_2
+         %41 = OpConstantComposite %v2float %float_3 %float_3
+         %42 = OpConstantComposite %v3float %float_0_114 %float_0_587000012 %float_0_298999995
+%_runtimearr_uint = OpTypeRuntimeArray %uint
+%type_StructuredBuffer_uint = OpTypeStruct %_runtimearr_uint
+%_ptr_Uniform_type_StructuredBuffer_uint = OpTypePointer Uniform %type_StructuredBuffer_uint
+%type_RWStructuredBuffer_uint = OpTypeStruct %_runtimearr_uint
+%_ptr_Uniform_type_RWStructuredBuffer_uint = OpTypePointer Uniform %type_RWStructuredBuffer_uint
+%type_ConstantBuffer_Variables = OpTypeStruct %uint %uint %uint %uint %uint %float
+%_ptr_PushConstant_type_ConstantBuffer_Variables = OpTypePointer PushConstant %type_ConstantBuffer_Variables
+%_ptr_Input_v3uint = OpTypePointer Input %v3uint
+         %47 = OpTypeFunction %void
+%_ptr_PushConstant_uint = OpTypePointer PushConstant %uint
+%_ptr_PushConstant_float = OpTypePointer PushConstant %float
+%_ptr_Uniform_uint = OpTypePointer Uniform %uint
+     %source = OpVariable %_ptr_Uniform_type_StructuredBuffer_uint Uniform
+      %bgra8 = OpVariable %_ptr_Uniform_type_RWStructuredBuffer_uint Uniform
+  %variables = OpVariable %_ptr_PushConstant_type_ConstantBuffer_Variables PushConstant
+%gl_GlobalInvocationID = OpVariable %_ptr_Input_v3uint Input
+       %main = OpFunction %void None %47
+         %51 = OpLabel
+         %52 = OpLoad %v3uint %gl_GlobalInvocationID
+         %53 = OpCompositeExtract %uint %52 0
+         %54 = OpCompositeExtract %uint %52 1
+         %55 = OpAccessChain %_ptr_PushConstant_uint %variables %int_0
+         %56 = OpLoad %uint %55
+         %57 = OpAccessChain %_ptr_PushConstant_uint %variables %int_1
+         %58 = OpLoad %uint %57
+         %59 = OpUGreaterThanEqual %bool %53 %56
+         %60 = OpUGreaterThanEqual %bool %54 %58
+         %61 = OpLogicalOr %bool %59 %60
+               OpSelectionMerge %62 None
+               OpBranchConditional %61 %63 %62
+         %63 = OpLabel
+               OpReturn
+         %62 = OpLabel
+         %64 = OpAccessChain %_ptr_PushConstant_uint %variables %int_2
+         %65 = OpLoad %uint %64
+         %66 = OpAccessChain %_ptr_PushConstant_uint %variables %int_3
+         %67 = OpLoad %uint %66
+         %68 = OpCompositeConstruct %v2uint %53 %54
+         %69 = OpConvertUToF %v2float %68
+         %70 = OpFAdd %v2float %69 %39
+         %71 = OpCompositeConstruct %v2uint %65 %67
+         %72 = OpConvertUToF %v2float %71
+         %73 = OpCompositeConstruct %v2uint %56 %58
+         %74 = OpConvertUToF %v2float %73
+         %75 = OpFMul %v2float %70 %72
+         %76 = OpFDiv %v2float %75 %74
+         %77 = OpFSub %v2float %76 %39
+         %78 = OpExtInst %v2float %1 Floor %77
+         %79 = OpFSub %v2float %77 %78
+         %80 = OpCompositeExtract %float %78 0
+         %81 = OpCompositeExtract %float %78 1
+         %82 = OpFAdd %float %80 %float_1
+         %83 = OpFAdd %float %81 %float_1
+         %84 = OpCompositeExtract %float %72 0
+         %85 = OpCompositeExtract %float %72 1
+         %86 = OpFSub %float %84 %float_1
+         %87 = OpFSub %float %85 %float_1
+         %88 = OpExtInst %float %1 FClamp %80 %float_0 %86
+         %89 = OpConvertFToU %uint %88
+         %90 = OpExtInst %float %1 FClamp %82 %float_0 %86
+         %91 = OpConvertFToU %uint %90
+         %92 = OpExtInst %float %1 FClamp %81 %float_0 %87
+         %93 = OpConvertFToU %uint %92
+         %94 = OpIMul %uint %93 %65
+         %95 = OpExtInst %float %1 FClamp %83 %float_0 %87
+         %96 = OpConvertFToU %uint %95
+         %97 = OpIMul %uint %96 %65
+         %98 = OpIAdd %uint %94 %89
+         %99 = OpAccessChain %_ptr_Uniform_uint %source %int_0 %98
+        %100 = OpLoad %uint %99
+        %101 = OpExtInst %v4float %1 UnpackUnorm4x8 %100
+        %102 = OpIAdd %uint %94 %91
+        %103 = OpAccessChain %_ptr_Uniform_uint %source %int_0 %102
+        %104 = OpLoad %uint %103
+        %105 = OpExtInst %v4float %1 UnpackUnorm4x8 %104
+        %106 = OpIAdd %uint %97 %89
+        %107 = OpAccessChain %_ptr_Uniform_uint %source %int_0 %106
+        %108 = OpLoad %uint %107
+        %109 = OpExtInst %v4float %1 UnpackUnorm4x8 %108
+        %110 = OpIAdd %uint %97 %91
+        %111 = OpAccessChain %_ptr_Uniform_uint %source %int_0 %110
+        %112 = OpLoad %uint %111
+        %113 = OpExtInst %v4float %1 UnpackUnorm4x8 %112
+        %114 = OpAccessChain %_ptr_PushConstant_uint %variables %int_4
+        %115 = OpLoad %uint %114
+        %116 = OpIEqual %bool %115 %uint_1
+               OpSelectionMerge %117 None
+               OpBranchConditional %116 %118 %117
+        %118 = OpLabel
+        %119 = OpVectorShuffle %v3float %101 %101 0 1 2
+        %120 = OpDot %float %119 %42
+        %121 = OpVectorShuffle %v3float %105 %105 0 1 2
+        %122 = OpDot %float %121 %42
+        %123 = OpVectorShuffle %v3float %109 %109 0 1 2
+        %124 = OpDot %float %123 %42
+        %125 = OpVectorShuffle %v3float %113 %113 0 1 2
+        %126 = OpDot %float %125 %42
+        %127 = OpFAdd %float %122 %126
+        %128 = OpFAdd %float %120 %124
+        %129 = OpFAdd %float %124 %126
+        %130 = OpFAdd %float %120 %122
+        %131 = OpFSub %float %127 %128
+        %132 = OpFSub %float %129 %130
+        %133 = OpExtInst %float %1 FAbs %131
+        %134 = OpExtInst %float %1 FAbs %132
+        %135 = OpFAdd %float %133 %134
+        %136 = OpFAdd %float %135 %float_0_00392156886
+        %137 = OpCompositeConstruct %v2float %133 %134
+        %138 = OpCompositeConstruct %v2float %136 %136
+        %139 = OpFDiv %v2float %137 %138
+        %140 = OpFMul %v2float %79 %40
+        %141 = OpFSub %v2float %41 %140
+        %142 = OpFMul %v2float %79 %79
+        %143 = OpFMul %v2float %142 %141
+        %144 = OpExtInst %v2float %1 FMix %79 %143 %139
+               OpBranch %117
+        %117 = OpLabel
+        %145 = OpPhi %v2float %144 %118 %79 %62
+        %146 = OpCompositeExtract %float %145 0
+        %147 = OpCompositeExtract %float %145 1
+        %148 = OpCompositeConstruct %v4float %146 %146 %146 %146
+        %149 = OpCompositeConstruct %v4float %147 %147 %147 %147
+        %150 = OpExtInst %v4float %1 FMix %101 %105 %148
+        %151 = OpExtInst %v4float %1 FMix %109 %113 %148
+        %152 = OpExtInst %v4float %1 FMix %150 %151 %149
+               OpSelectionMerge %153 None
+               OpBranchConditional %116 %154 %153
+        %154 = OpLabel
+        %155 = OpFAdd %v4float %101 %105
+        %156 = OpFAdd %v4float %109 %113
+        %157 = OpFAdd %v4float %155 %156
+        %158 = OpVectorTimesScalar %v4float %157 %float_0_25
+        %159 = OpFSub %v4float %152 %158
+        %160 = OpAccessChain %_ptr_PushConstant_float %variables %int_5
+        %161 = OpLoad %float %160
+        %162 = OpVectorTimesScalar %v4float %159 %161
+        %163 = OpFAdd %v4float %152 %162
+        %164 = OpExtInst %v4float %1 FMin %101 %105
+        %165 = OpExtInst %v4float %1 FMin %109 %113
+        %166 = OpExtInst %v4float %1 FMin %164 %165
+        %167 = OpExtInst %v4float %1 FMax %101 %105
+        %168 = OpExtInst %v4float %1 FMax %109 %113
+        %169 = OpExtInst %v4float %1 FMax %167 %168
+        %170 = OpExtInst %v4float %1 FClamp %163 %166 %169
+               OpBranch %153
+        %153 = OpLabel
+        %171 = OpPhi %v4float %170 %154 %152 %117
+        %172 = OpExtInst %uint %1 PackUnorm4x8 %171
+        %173 = OpIMul %uint %54 %56
+        %174 = OpIAdd %uint %173 %53
+        %175 = OpAccessChain %_ptr_Uniform_uint %bgra8 %int_0 %174
+               OpStore %175 %172
+               OpReturn
+               OpFunctionEnd
+
+// NOTE(Constantine): Hand-assembled from vkfast_present_upscale.cs.hlsl, hence generator word 0. It was checked by decompiling it with
+// SPIRV-Cross and by interpreting both gpu_pixels_upscale_t modes against a C reference. Replace this file with the output of the dxc command
+// in vkfast_present_upscale.cs.hlsl.
+
+#endif
+
+const unsigned char g_main[] = {
+  0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x74, 0x79, 0x70, 0x65, 0x2e, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e,
+  0x74, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2e, 0x56, 0x61, 0x72, 0x69,
+  0x61, 0x62, 0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x69, 0x64, 0x74,
+  0x68, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x00, 0x00,
+  0x06, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x68,
+  0x65, 0x69, 0x67, 0x68, 0x74, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x70, 0x73, 0x63,
+  0x61, 0x6c, 0x65, 0x00, 0x06, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x73, 0x68, 0x61, 0x72, 0x70, 0x6e, 0x65, 0x73,
+  0x73, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x09, 0x00, 0x06, 0x00, 0x00, 0x00, 0x74, 0x79, 0x70, 0x65,
+  0x2e, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x64, 0x42,
+  0x75, 0x66, 0x66, 0x65, 0x72, 0x2e, 0x75, 0x69, 0x6e, 0x74, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x73, 0x6f, 0x75, 0x72,
+  0x63, 0x65, 0x00, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x74, 0x79, 0x70, 0x65, 0x2e, 0x52, 0x57, 0x53, 0x74, 0x72, 0x75, 0x63,
+  0x74, 0x75, 0x72, 0x65, 0x64, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2e,
+  0x75, 0x69, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x62, 0x67, 0x72, 0x61, 0x38, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x02, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3e,
+  0x2b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3f, 0x2b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x2b, 0x00, 0x04, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+  0x2b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x40, 0x40, 0x2b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x81, 0x80, 0x80, 0x3b, 0x2b, 0x00, 0x04, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0xd5, 0x78, 0xe9, 0x3d,
+  0x2b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0xa2, 0x45, 0x16, 0x3f, 0x2b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x87, 0x16, 0x99, 0x3e, 0x2c, 0x00, 0x05, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x31, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x30, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x30, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0xae, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xae, 0x00, 0x05, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x03, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0xfd, 0x00, 0x01, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x30, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x30, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x50, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x6d, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x06, 0x00, 0x12, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x06, 0x00, 0x12, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x06, 0x00, 0x12, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x06, 0x00, 0x12, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x30, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x73, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x76, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x94, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x4f, 0x00, 0x08, 0x00, 0x11, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x94, 0x00, 0x05, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x7b, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x94, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0x7b, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x94, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x50, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x8a, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x75, 0x00, 0x00, 0x00,
+  0xf5, 0x00, 0x07, 0x00, 0x10, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0x91, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x50, 0x00, 0x07, 0x00, 0x12, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x08, 0x00, 0x12, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x9a, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x9a, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x05, 0x00, 0x12, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x9e, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x05, 0x00, 0x12, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0xa1, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0xa1, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0xa3, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x07, 0x00, 0x12, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x07, 0x00, 0x12, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x08, 0x00, 0x12, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0xf5, 0x00, 0x07, 0x00, 0x12, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0xac, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0xab, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0xad, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00,
+  0xad, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0xaf, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00,
+  0x38, 0x00, 0x01, 0x00
+};
@@ -0,0 +1,58 @@
+// dxc.exe vkfast_present_upscale.cs.hlsl -T cs_6_0 -Fh vkfast_present_upscale.cs.h -spirv
+
+[[vk::binding(0, 0)]] StructuredBuffer<uint>   source;
+[[vk::binding(1, 0)]] RWStructuredBuffer<uint> bgra8;
+
+struct Variables {
+  uint  width;
+  uint  height;
+  uint  source_width;
+  uint  source_height;
+  uint  upscale;
+  float sharpness;
+};
+[[vk::push_constant]] ConstantBuffer<Variables> variables;
+
+float4 Load(float x, float y) {
+  const uint i = uint(clamp(y, 0, variables.source_height - 1.0)) * variables.source_width + uint(clamp(x, 0, variables.source_width - 1.0));
+  const uint p = source[i];
+  return float4(p & 255, (p >> 8) & 255, (p >> 16) & 255, p >> 24) / 255.0; // NOTE(Constantine): BGRA.
+}
+
+[numthreads(8, 8, 1)]
+void main(uint3 tid: SV_DispatchThreadId) {
+  if (tid.x >= variables.width || tid.y >= variables.height) {
+    return;
+  }
+
+  const float2 p = (float2(tid.xy) + 0.5) * float2(variables.source_width, variables.source_height) / float2(variables.width, variables.height) - 0.5;
+  const float2 f = floor(p);
+  float2 t = p - f;
+
+  const float4 a = Load(f.x,     f.y);
+  const float4 b = Load(f.x + 1, f.y);
+  const float4 c = Load(f.x,     f.y + 1);
+  const float4 d = Load(f.x + 1, f.y + 1);
+
+  if (variables.upscale == 1) { // GPU_PIXELS_UPSCALE_EDGE_ADAPTIVE
+    // NOTE(Constantine): Smoothstep the interpolation across the luma gradient of the 2x2 texels, keep it linear along it.
+    const float3 luma = float3(0.114, 0.587, 0.299);
+    const float la = dot(a.rgb, luma);
+    const float lb = dot(b.rgb, luma);
+    const float lc = dot(c.rgb, luma);
+    const float ld = dot(d.rgb, luma);
+    const float gx = abs((lb + ld) - (la + lc));
+    const float gy = abs((lc + ld) - (la + lb));
+    t = lerp(t, t * t * (3.0 - t * 2.0), float2(gx, gy) / (gx + gy + 1.0 / 255.0));
+  }
+
+  float4 o = lerp(lerp(a, b, t.x), lerp(c, d, t.x), t.y);
+
+  if (variables.upscale == 1) {
+    // NOTE(Constantine): Unsharp mask against the 2x2 texels average, clamped to their range so edges don't ring.
+    o = clamp(o + (o - (a + b + c + d) * 0.25) * variables.sharpness, min(min(a, b), min(c, d)), max(max(a, b), max(c, d)));
+  }
+
+  const uint4 u = uint4(round(saturate(o) * 255.0));
+  bgra8[tid.y * variables.width + tid.x] = u.x | (u.y << 8) | (u.z << 16) | (u.w << 24);
+}